@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/Coroutine.h>
+#include <AK/kmalloc.h>
+
+namespace AK::Detail {
+
+static constexpr Array<size_t, 5> coroutine_frame_size_classes { 128, 256, 512, 1024, 2048 };
+static constexpr size_t max_cached_coroutine_frames_per_size_class = 64;
+
+struct FreeCoroutineFrame {
+    FreeCoroutineFrame* next { nullptr };
+};
+
+struct CoroutineFrameCache {
+    ~CoroutineFrameCache()
+    {
+        for (size_t i = 0; i < free_frames.size(); ++i) {
+            for (auto* frame = free_frames[i]; frame;) {
+                auto* next = frame->next;
+                kfree_sized(frame, coroutine_frame_size_classes[i]);
+                frame = next;
+            }
+        }
+    }
+
+    Array<FreeCoroutineFrame*, coroutine_frame_size_classes.size()> free_frames {};
+    Array<size_t, coroutine_frame_size_classes.size()> free_frame_counts {};
+};
+
+static thread_local CoroutineFrameCache s_coroutine_frame_cache;
+
+static Optional<size_t> size_class_for(size_t size)
+{
+    for (size_t i = 0; i < coroutine_frame_size_classes.size(); ++i) {
+        if (size <= coroutine_frame_size_classes[i])
+            return i;
+    }
+    return {};
+}
+
+void* allocate_coroutine_frame(size_t size)
+{
+    auto size_class = size_class_for(size);
+    if (!size_class.has_value()) {
+        auto* frame = kmalloc(size);
+        VERIFY(frame);
+        return frame;
+    }
+
+    auto& cache = s_coroutine_frame_cache;
+    if (auto* frame = cache.free_frames[*size_class]) {
+        cache.free_frames[*size_class] = frame->next;
+        --cache.free_frame_counts[*size_class];
+        return frame;
+    }
+
+    auto* frame = kmalloc(coroutine_frame_size_classes[*size_class]);
+    VERIFY(frame);
+    return frame;
+}
+
+void deallocate_coroutine_frame(void* frame, size_t size)
+{
+    auto size_class = size_class_for(size);
+
+    auto& cache = s_coroutine_frame_cache;
+    if (!size_class.has_value() || cache.free_frame_counts[*size_class] >= max_cached_coroutine_frames_per_size_class) {
+        kfree_sized(frame, size_class.has_value() ? coroutine_frame_size_classes[*size_class] : size);
+        return;
+    }
+
+    auto* free_frame = new (frame) FreeCoroutineFrame;
+    free_frame->next = cache.free_frames[*size_class];
+    cache.free_frames[*size_class] = free_frame;
+    ++cache.free_frame_counts[*size_class];
+}
+
+}
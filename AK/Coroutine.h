@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Assertions.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/StdLibExtras.h>
+#include <coroutine>
+
+namespace AK {
+
+namespace Detail {
+
+// Coroutine frames are allocated from per-thread free lists of a few size classes, since they are
+// created and destroyed at a high rate and tend to have the same handful of sizes.
+void* allocate_coroutine_frame(size_t);
+void deallocate_coroutine_frame(void*, size_t);
+
+template<typename T>
+struct CoroutineResultStorage {
+    template<typename U = T>
+    void return_value(U&& value)
+    {
+        m_result = forward<U>(value);
+    }
+
+    T take_result()
+    {
+        VERIFY(m_result.has_value());
+        return m_result.release_value();
+    }
+
+    Optional<T> m_result;
+};
+
+template<>
+struct CoroutineResultStorage<void> {
+    void return_void() { }
+    void take_result() { }
+};
+
+}
+
+// An eagerly started coroutine. It runs until its first suspension point as soon as it is called.
+// Awaiting it from another coroutine suspends the awaiting coroutine until this one has finished,
+// and yields its result. The Coroutine object owns the coroutine frame; destroying it while the
+// coroutine is suspended cancels the coroutine. Use detach() to let it run to completion on its own.
+template<typename T>
+class [[nodiscard]] Coroutine {
+    AK_MAKE_NONCOPYABLE(Coroutine);
+
+public:
+    using ReturnType = T;
+
+    struct promise_type : public Detail::CoroutineResultStorage<T> {
+        Coroutine get_return_object() { return Coroutine { std::coroutine_handle<promise_type>::from_promise(*this) }; }
+
+        std::suspend_never initial_suspend() { return {}; }
+
+        auto final_suspend() noexcept
+        {
+            struct FinalAwaiter {
+                bool await_ready() const noexcept { return false; }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+                {
+                    auto& promise = handle.promise();
+
+                    if (promise.m_detached) {
+                        handle.destroy();
+                        return std::noop_coroutine();
+                    }
+                    if (promise.m_awaiter)
+                        return promise.m_awaiter;
+                    return std::noop_coroutine();
+                }
+
+                void await_resume() const noexcept { }
+            };
+
+            return FinalAwaiter {};
+        }
+
+        void unhandled_exception() { VERIFY_NOT_REACHED(); }
+
+        static void* operator new(size_t size) { return Detail::allocate_coroutine_frame(size); }
+        static void operator delete(void* frame, size_t size) { Detail::deallocate_coroutine_frame(frame, size); }
+
+        std::coroutine_handle<> m_awaiter;
+        bool m_detached { false };
+    };
+
+    Coroutine(Coroutine&& other)
+        : m_handle(AK::exchange(other.m_handle, {}))
+    {
+    }
+
+    Coroutine& operator=(Coroutine&& other)
+    {
+        if (this != &other) {
+            destroy();
+            m_handle = AK::exchange(other.m_handle, {});
+        }
+        return *this;
+    }
+
+    ~Coroutine() { destroy(); }
+
+    bool is_done() const
+    {
+        VERIFY(m_handle);
+        return m_handle.done();
+    }
+
+    // Only valid once the coroutine is done.
+    T take_result()
+    {
+        VERIFY(is_done());
+        return m_handle.promise().take_result();
+    }
+
+    // Lets the coroutine run to completion without an owner. Its result is discarded.
+    void detach()
+    {
+        VERIFY(m_handle);
+        auto handle = AK::exchange(m_handle, {});
+
+        if (handle.done())
+            handle.destroy();
+        else
+            handle.promise().m_detached = true;
+    }
+
+    bool await_ready() const { return is_done(); }
+
+    void await_suspend(std::coroutine_handle<> awaiter)
+    {
+        VERIFY(!m_handle.promise().m_awaiter);
+        m_handle.promise().m_awaiter = awaiter;
+    }
+
+    T await_resume() { return take_result(); }
+
+private:
+    explicit Coroutine(std::coroutine_handle<promise_type> handle)
+        : m_handle(handle)
+    {
+    }
+
+    void destroy()
+    {
+        if (m_handle)
+            AK::exchange(m_handle, {}).destroy();
+    }
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::Coroutine;
+#endif
@@ -0,0 +1,491 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/BuiltinWrappers.h>
+#include <AK/Error.h>
+#include <AK/HashTable.h>
+#include <AK/Optional.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <AK/Traits.h>
+#include <AK/Vector.h>
+#include <AK/kmalloc.h>
+#include <initializer_list>
+
+namespace AK {
+
+// A map from keys K to values V, laid out like a SwissTable: next to its slots, the table keeps one control byte per
+// slot, which is either empty, deleted, or the low 7 bits of the hash of the key in that slot. Lookups match the
+// control bytes of 16 slots at a time against those bits with vector instructions, so that keys are only compared
+// when they very likely are equal, and stop at the first group of slots that has an empty one.
+//
+// Unlike HashMap, this has no ordered variant, moves its entries when it grows, and invalidates iterators whenever an
+// entry is inserted.
+template<typename K, typename V, typename KeyTraits, typename ValueTraits>
+class FastHashMap {
+public:
+    struct Entry {
+        K key;
+        V value;
+    };
+
+private:
+    static constexpr size_t group_size = 16;
+    static constexpr size_t minimum_capacity = group_size;
+
+    static constexpr u8 empty_control = 0x80;
+    static constexpr u8 deleted_control = 0xfe;
+
+    static_assert(alignof(Entry) <= alignof(max_align_t));
+
+    template<bool IsConst>
+    class IteratorBase {
+    public:
+        using MapType = Conditional<IsConst, FastHashMap const, FastHashMap>;
+        using EntryType = Conditional<IsConst, Entry const, Entry>;
+
+        bool operator==(IteratorBase const& other) const { return m_index == other.m_index; }
+
+        EntryType& operator*() { return m_map->m_slots[m_index]; }
+        EntryType* operator->() { return &m_map->m_slots[m_index]; }
+
+        IteratorBase& operator++()
+        {
+            m_index = m_map->next_used_index(m_index + 1);
+            return *this;
+        }
+
+    private:
+        friend class FastHashMap;
+
+        IteratorBase(MapType& map, size_t index)
+            : m_map(&map)
+            , m_index(index)
+        {
+        }
+
+        MapType* m_map { nullptr };
+        size_t m_index { 0 };
+    };
+
+public:
+    using KeyType = K;
+    using ValueType = V;
+    using Iterator = IteratorBase<false>;
+    using ConstIterator = IteratorBase<true>;
+
+    FastHashMap() = default;
+
+    FastHashMap(std::initializer_list<Entry> list)
+    {
+        ensure_capacity(list.size());
+        for (auto& [key, value] : list)
+            set(key, value);
+    }
+
+    FastHashMap(FastHashMap const& other) // FIXME: Not OOM-safe!
+    {
+        ensure_capacity(other.size());
+        for (auto const& [key, value] : other)
+            set(key, value);
+    }
+
+    FastHashMap(FastHashMap&& other) noexcept
+        : m_slots(exchange(other.m_slots, nullptr))
+        , m_control(exchange(other.m_control, nullptr))
+        , m_capacity(exchange(other.m_capacity, 0))
+        , m_size(exchange(other.m_size, 0))
+        , m_deleted_count(exchange(other.m_deleted_count, 0))
+    {
+    }
+
+    FastHashMap& operator=(FastHashMap const& other)
+    {
+        if (this != &other) {
+            FastHashMap copy(other);
+            swap(*this, copy);
+        }
+        return *this;
+    }
+
+    FastHashMap& operator=(FastHashMap&& other) noexcept
+    {
+        FastHashMap moved(move(other));
+        swap(*this, moved);
+        return *this;
+    }
+
+    ~FastHashMap()
+    {
+        destroy_entries();
+        if (m_slots)
+            kfree_sized(m_slots, allocation_size(m_capacity));
+    }
+
+    friend void swap(FastHashMap& a, FastHashMap& b) noexcept
+    {
+        AK::swap(a.m_slots, b.m_slots);
+        AK::swap(a.m_control, b.m_control);
+        AK::swap(a.m_capacity, b.m_capacity);
+        AK::swap(a.m_size, b.m_size);
+        AK::swap(a.m_deleted_count, b.m_deleted_count);
+    }
+
+    [[nodiscard]] bool is_empty() const { return m_size == 0; }
+    [[nodiscard]] size_t size() const { return m_size; }
+    [[nodiscard]] size_t capacity() const { return m_capacity; }
+
+    // The number of bytes allocated for the slots and their control bytes.
+    [[nodiscard]] size_t memory_footprint() const { return m_capacity ? allocation_size(m_capacity) : 0; }
+
+    void clear()
+    {
+        *this = FastHashMap();
+    }
+
+    void clear_with_capacity()
+    {
+        destroy_entries();
+        if (m_control)
+            __builtin_memset(m_control, empty_control, m_capacity);
+        m_size = 0;
+        m_deleted_count = 0;
+    }
+
+    HashSetResult set(K const& key, V const& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace) { return MUST(try_set_impl(key, value, existing_entry_behavior)); }
+    HashSetResult set(K const& key, V&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace) { return MUST(try_set_impl(key, move(value), existing_entry_behavior)); }
+    HashSetResult set(K&& key, V&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace) { return MUST(try_set_impl(move(key), move(value), existing_entry_behavior)); }
+    ErrorOr<HashSetResult> try_set(K const& key, V const& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace) { return try_set_impl(key, value, existing_entry_behavior); }
+    ErrorOr<HashSetResult> try_set(K const& key, V&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace) { return try_set_impl(key, move(value), existing_entry_behavior); }
+    ErrorOr<HashSetResult> try_set(K&& key, V&& value, HashSetExistingEntryBehavior existing_entry_behavior = HashSetExistingEntryBehavior::Replace) { return try_set_impl(move(key), move(value), existing_entry_behavior); }
+
+    [[nodiscard]] Iterator begin() { return { *this, next_used_index(0) }; }
+    [[nodiscard]] Iterator end() { return { *this, m_capacity }; }
+    [[nodiscard]] ConstIterator begin() const { return { *this, next_used_index(0) }; }
+    [[nodiscard]] ConstIterator end() const { return { *this, m_capacity }; }
+
+    [[nodiscard]] Iterator find(K const& key)
+    {
+        return { *this, find_index(KeyTraits::hash(key), [&](auto& entry) { return KeyTraits::equals(entry.key, key); }) };
+    }
+
+    [[nodiscard]] ConstIterator find(K const& key) const
+    {
+        return { *this, find_index(KeyTraits::hash(key), [&](auto& entry) { return KeyTraits::equals(entry.key, key); }) };
+    }
+
+    template<Concepts::HashCompatible<K> Key>
+    requires(IsSame<KeyTraits, Traits<K>>) [[nodiscard]] Iterator find(Key const& key)
+    {
+        return { *this, find_index(Traits<Key>::hash(key), [&](auto& entry) { return Traits<K>::equals(entry.key, key); }) };
+    }
+
+    template<Concepts::HashCompatible<K> Key>
+    requires(IsSame<KeyTraits, Traits<K>>) [[nodiscard]] ConstIterator find(Key const& key) const
+    {
+        return { *this, find_index(Traits<Key>::hash(key), [&](auto& entry) { return Traits<K>::equals(entry.key, key); }) };
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] Iterator find(unsigned hash, TUnaryPredicate predicate)
+    {
+        return { *this, find_index(hash, predicate) };
+    }
+
+    template<typename TUnaryPredicate>
+    [[nodiscard]] ConstIterator find(unsigned hash, TUnaryPredicate predicate) const
+    {
+        return { *this, find_index(hash, predicate) };
+    }
+
+    template<typename Key>
+    [[nodiscard]] bool contains(Key const& key) const
+    {
+        return find(key) != end();
+    }
+
+    template<typename Key>
+    Optional<typename ValueTraits::ConstPeekType> get(Key const& key) const
+    {
+        auto it = find(key);
+        if (it == end())
+            return {};
+        return it->value;
+    }
+
+    template<typename Key>
+    Optional<typename ValueTraits::PeekType> get(Key const& key)
+    requires(!IsConst<typename ValueTraits::PeekType>)
+    {
+        auto it = find(key);
+        if (it == end())
+            return {};
+        return it->value;
+    }
+
+    template<typename Key>
+    bool remove(Key const& key)
+    {
+        auto it = find(key);
+        if (it == end())
+            return false;
+        remove(it);
+        return true;
+    }
+
+    void remove(Iterator iterator)
+    {
+        auto index = iterator.m_index;
+        VERIFY(index < m_capacity);
+
+        m_slots[index].~Entry();
+        --m_size;
+
+        // If the group of this slot still has an empty one, no lookup can have gone past it, so the slot can become
+        // empty again. Otherwise, lookups have to keep going past it.
+        if (SIMD::maskbits(load_group(index & ~(group_size - 1)) == splat(empty_control)) != 0) {
+            m_control[index] = empty_control;
+        } else {
+            m_control[index] = deleted_control;
+            ++m_deleted_count;
+        }
+    }
+
+    template<typename Key>
+    Optional<V> take(Key const& key)
+    {
+        auto it = find(key);
+        if (it == end())
+            return {};
+        auto value = move(it->value);
+        remove(it);
+        return value;
+    }
+
+    V& ensure(K const& key)
+    {
+        return ensure(key, [] { return V(); });
+    }
+
+    template<typename Callback>
+    V& ensure(K const& key, Callback initialization_callback)
+    {
+        auto hash = KeyTraits::hash(key);
+        auto index = find_index(hash, [&](auto& entry) { return KeyTraits::equals(entry.key, key); });
+        if (index != m_capacity)
+            return m_slots[index].value;
+
+        MUST(try_grow_for_insertion());
+        index = insertion_index(hash);
+        new (&m_slots[index]) Entry { key, initialization_callback() };
+        mark_used(index, hash);
+        return m_slots[index].value;
+    }
+
+    ErrorOr<void> try_ensure_capacity(size_t capacity)
+    {
+        auto required_capacity = capacity_for_size(capacity);
+        if (required_capacity <= m_capacity)
+            return {};
+        return try_rehash(required_capacity);
+    }
+
+    void ensure_capacity(size_t capacity)
+    {
+        MUST(try_ensure_capacity(capacity));
+    }
+
+    [[nodiscard]] Vector<K> keys() const
+    {
+        Vector<K> list;
+        list.ensure_capacity(size());
+        for (auto const& [key, _] : *this)
+            list.unchecked_append(key);
+        return list;
+    }
+
+private:
+    // The low 7 bits of a hash are kept in the control byte of its slot, and the remaining bits pick its first group.
+    static constexpr u8 control_for_hash(unsigned hash) { return hash & 0x7f; }
+    static constexpr size_t group_for_hash(unsigned hash) { return hash >> 7; }
+
+    static constexpr size_t allocation_size(size_t capacity) { return capacity * sizeof(Entry) + capacity; }
+
+    // Tables grow once 7/8 of their slots are used or deleted, as only an empty slot ends a lookup.
+    static constexpr size_t usable_slots(size_t capacity) { return capacity - capacity / 8; }
+
+    static size_t capacity_for_size(size_t size)
+    {
+        size_t capacity = minimum_capacity;
+        while (usable_slots(capacity) < size)
+            capacity *= 2;
+        return capacity;
+    }
+
+    static ALWAYS_INLINE SIMD::i8x16 splat(u8 control)
+    {
+        return SIMD::i8x16 {} + static_cast<i8>(control);
+    }
+
+    ALWAYS_INLINE SIMD::i8x16 load_group(size_t first_index) const
+    {
+        return SIMD::load_unaligned<SIMD::i8x16>(m_control + first_index);
+    }
+
+    // Visits the groups in the order of a triangular sequence, which visits every group once as their number is a
+    // power of two.
+    template<typename Callback>
+    ALWAYS_INLINE size_t probe(unsigned hash, Callback callback) const
+    {
+        auto group_mask = m_capacity / group_size - 1;
+        auto group = group_for_hash(hash) & group_mask;
+        for (size_t step = 1;; ++step) {
+            if (auto index = callback(group * group_size); index.has_value())
+                return *index;
+            group = (group + step) & group_mask;
+        }
+    }
+
+    template<typename TUnaryPredicate>
+    size_t find_index(unsigned hash, TUnaryPredicate predicate) const
+    {
+        if (m_size == 0)
+            return m_capacity;
+
+        auto control = splat(control_for_hash(hash));
+        return probe(hash, [&](size_t first_index) -> Optional<size_t> {
+            auto group = load_group(first_index);
+            for (u32 matches = SIMD::maskbits(group == control); matches != 0; matches &= matches - 1) {
+                auto index = first_index + count_trailing_zeroes(matches);
+                if (predicate(m_slots[index]))
+                    return index;
+            }
+            if (SIMD::maskbits(group == splat(empty_control)) != 0)
+                return m_capacity;
+            return {};
+        });
+    }
+
+    // Empty and deleted slots are the ones whose control byte has its top bit set.
+    size_t insertion_index(unsigned hash) const
+    {
+        return probe(hash, [&](size_t first_index) -> Optional<size_t> {
+            if (u32 unused = SIMD::maskbits(load_group(first_index)); unused != 0)
+                return first_index + count_trailing_zeroes(unused);
+            return {};
+        });
+    }
+
+    size_t next_used_index(size_t index) const
+    {
+        while (index < m_capacity) {
+            auto first_index = index & ~(group_size - 1);
+            u32 used = static_cast<u16>(~SIMD::maskbits(load_group(first_index)));
+            used &= 0xffffu << (index - first_index);
+            if (used != 0)
+                return first_index + count_trailing_zeroes(used);
+            index = first_index + group_size;
+        }
+        return m_capacity;
+    }
+
+    void mark_used(size_t index, unsigned hash)
+    {
+        if (m_control[index] == deleted_control)
+            --m_deleted_count;
+        m_control[index] = control_for_hash(hash);
+        ++m_size;
+    }
+
+    template<typename Key, typename Value>
+    ErrorOr<HashSetResult> try_set_impl(Key&& key, Value&& value, HashSetExistingEntryBehavior existing_entry_behavior)
+    {
+        auto hash = KeyTraits::hash(key);
+        if (auto index = find_index(hash, [&](auto& entry) { return KeyTraits::equals(entry.key, key); }); index != m_capacity) {
+            if (existing_entry_behavior == HashSetExistingEntryBehavior::Keep)
+                return HashSetResult::KeptExistingEntry;
+            m_slots[index].key = forward<Key>(key);
+            m_slots[index].value = forward<Value>(value);
+            return HashSetResult::ReplacedExistingEntry;
+        }
+
+        TRY(try_grow_for_insertion());
+        auto index = insertion_index(hash);
+        new (&m_slots[index]) Entry { forward<Key>(key), forward<Value>(value) };
+        mark_used(index, hash);
+        return HashSetResult::InsertedNewEntry;
+    }
+
+    ErrorOr<void> try_grow_for_insertion()
+    {
+        if (m_size + m_deleted_count < usable_slots(m_capacity))
+            return {};
+
+        // If most of the unusable slots are deleted ones, rehashing at the same capacity is enough to reclaim them.
+        return try_rehash(max(m_capacity, capacity_for_size(m_size + 1 + m_size / 2)));
+    }
+
+    ErrorOr<void> try_rehash(size_t new_capacity)
+    {
+        VERIFY(is_power_of_two(new_capacity) && new_capacity >= minimum_capacity);
+
+        auto* new_slots = static_cast<Entry*>(kmalloc(allocation_size(new_capacity)));
+        if (!new_slots)
+            return Error::from_errno(ENOMEM);
+
+        auto* old_slots = m_slots;
+        auto* old_control = m_control;
+        auto old_capacity = m_capacity;
+
+        m_slots = new_slots;
+        m_control = reinterpret_cast<u8*>(new_slots + new_capacity);
+        m_capacity = new_capacity;
+        m_size = 0;
+        m_deleted_count = 0;
+        __builtin_memset(m_control, empty_control, new_capacity);
+
+        if (!old_slots)
+            return {};
+
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (old_control[i] & 0x80)
+                continue;
+            auto& entry = old_slots[i];
+            auto hash = KeyTraits::hash(entry.key);
+            auto index = insertion_index(hash);
+            new (&m_slots[index]) Entry { move(entry.key), move(entry.value) };
+            mark_used(index, hash);
+            entry.~Entry();
+        }
+
+        kfree_sized(old_slots, allocation_size(old_capacity));
+        return {};
+    }
+
+    void destroy_entries()
+    {
+        if constexpr (!IsTriviallyDestructible<Entry>) {
+            for (size_t i = 0; i < m_capacity; ++i) {
+                if (!(m_control[i] & 0x80))
+                    m_slots[i].~Entry();
+            }
+        }
+    }
+
+    Entry* m_slots { nullptr };
+    u8* m_control { nullptr };
+    size_t m_capacity { 0 };
+    size_t m_size { 0 };
+    size_t m_deleted_count { 0 };
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::FastHashMap;
+#endif
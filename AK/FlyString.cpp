@@ -5,7 +5,10 @@
  */
 
 #include <AK/FlyString.h>
+#include <AK/Array.h>
+#include <AK/Atomic.h>
 #include <AK/HashTable.h>
+#include <AK/ScopeGuard.h>
 #include <AK/Singleton.h>
 #include <AK/String.h>
 #include <AK/StringData.h>
@@ -14,25 +17,101 @@
 
 namespace AK {
 
-struct FlyStringTableHashTraits : public Traits<Detail::StringData const*> {
-    static u32 hash(Detail::StringData const* string) { return string->hash(); }
-    static bool equals(Detail::StringData const* a, Detail::StringData const* b) { return *a == *b; }
+namespace Detail {
+
+struct FlyStringTableHashTraits : public Traits<StringData const*> {
+    static u32 hash(StringData const* string) { return string->hash(); }
+    static bool equals(StringData const* a, StringData const* b) { return *a == *b; }
 };
 
-static auto& all_fly_strings()
+// The interned strings, split into shards by hash so that threads interning different strings rarely wait for each
+// other. Each shard is guarded by a spinlock, as it is only ever held for a single hash table operation.
+class FlyStringTable {
+public:
+    using Strings = HashTable<StringData const*, FlyStringTableHashTraits>;
+
+    template<typename Callback>
+    decltype(auto) with_shard_for(unsigned hash, Callback callback)
+    {
+        auto& shard = m_shards[hash >> (32 - shard_bits)];
+        shard.lock();
+        ScopeGuard unlock_guard = [&] { shard.unlock(); };
+        return callback(shard.strings);
+    }
+
+    bool release(StringData const& string_data)
+    {
+        return with_shard_for(string_data.hash(), [&](Strings& strings) {
+            if (string_data.deref_fly_string_data({}) != 0)
+                return false;
+            strings.remove(&string_data);
+            return true;
+        });
+    }
+
+    size_t size()
+    {
+        size_t size = 0;
+        for (auto& shard : m_shards) {
+            shard.lock();
+            size += shard.strings.size();
+            shard.unlock();
+        }
+        return size;
+    }
+
+private:
+    static constexpr size_t shard_bits = 6;
+
+    struct alignas(64) Shard {
+        void lock()
+        {
+            while (m_locked.exchange(true, AK::memory_order_acquire)) {
+                while (m_locked.load(AK::memory_order_relaxed))
+                    AK::atomic_pause();
+            }
+        }
+
+        void unlock() { m_locked.store(false, AK::memory_order_release); }
+
+        Atomic<bool> m_locked { false };
+        Strings strings;
+    };
+
+    Array<Shard, 1 << shard_bits> m_shards;
+};
+
+static FlyStringTable& fly_string_table()
 {
-    static Singleton<HashTable<Detail::StringData const*, FlyStringTableHashTraits>> table;
+    static Singleton<FlyStringTable> table;
     return *table;
 }
 
+bool release_fly_string_data(Badge<StringData>, StringData const& string_data)
+{
+    return fly_string_table().release(string_data);
+}
+
+}
+
+Optional<FlyString> FlyString::find_interned(StringView string)
+{
+    auto hash = string.hash();
+    return Detail::fly_string_table().with_shard_for(hash, [&](auto& strings) -> Optional<FlyString> {
+        if (auto it = strings.find(hash, [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != strings.end())
+            return FlyString { Detail::StringBase(**it) };
+        return {};
+    });
+}
+
 ErrorOr<FlyString> FlyString::from_utf8(StringView string)
 {
     if (string.is_empty())
         return FlyString {};
     if (string.length() <= Detail::MAX_SHORT_STRING_BYTE_COUNT)
         return FlyString { TRY(String::from_utf8(string)) };
-    if (auto it = all_fly_strings().find(string.hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end())
-        return FlyString { Detail::StringBase(**it) };
+    if (auto fly_string = find_interned(string); fly_string.has_value())
+        return fly_string.release_value();
     return FlyString { TRY(String::from_utf8(string)) };
 }
 
@@ -42,8 +121,8 @@ FlyString FlyString::from_utf8_without_validation(ReadonlyBytes string)
         return FlyString {};
     if (string.size() <= Detail::MAX_SHORT_STRING_BYTE_COUNT)
         return FlyString { String::from_utf8_without_validation(string) };
-    if (auto it = all_fly_strings().find(StringView(string).hash(), [&](auto& entry) { return entry->bytes_as_string_view() == string; }); it != all_fly_strings().end())
-        return FlyString { Detail::StringBase(**it) };
+    if (auto fly_string = find_interned(StringView { string }); fly_string.has_value())
+        return fly_string.release_value();
     return FlyString { String::from_utf8_without_validation(string) };
 }
 
@@ -61,15 +140,16 @@ FlyString::FlyString(String const& string)
         return;
     }
 
-    auto it = all_fly_strings().find(string.m_impl.data);
-    if (it == all_fly_strings().end()) {
-        m_data = string;
-        all_fly_strings().set(string.m_impl.data);
-        string.m_impl.data->set_fly_string(true);
-    } else {
-        m_data.m_impl.data = *it;
-        m_data.m_impl.data->ref();
-    }
+    auto const* string_data = string.m_impl.data;
+    m_data = Detail::fly_string_table().with_shard_for(string_data->hash(), [&](auto& strings) -> Detail::StringBase {
+        if (auto it = strings.find(string_data); it != strings.end())
+            return Detail::StringBase(**it);
+
+        // NOTE: This has to happen before any other thread can see the string, as it makes its reference count atomic.
+        string_data->set_fly_string(true);
+        strings.set(string_data);
+        return string;
+    });
 }
 
 FlyString& FlyString::operator=(String const& string)
@@ -116,7 +196,7 @@ Detail::StringBase FlyString::data(Badge<String>) const
 
 size_t FlyString::number_of_fly_strings()
 {
-    return all_fly_strings().size();
+    return Detail::fly_string_table().size();
 }
 
 unsigned Traits<FlyString>::hash(FlyString const& fly_string)
@@ -204,13 +284,4 @@ bool FlyString::ends_with_bytes(StringView bytes, CaseSensitivity case_sensitivi
     return bytes_as_string_view().ends_with(bytes, case_sensitivity);
 }
 
-namespace Detail {
-
-void did_destroy_fly_string_data(Badge<Detail::StringData>, Detail::StringData const& string_data)
-{
-    all_fly_strings().remove(&string_data);
-}
-
-}
-
 }
@@ -88,6 +88,9 @@ class CircularQueue;
 template<typename T>
 struct Traits;
 
+template<typename K, typename V, typename KeyTraits = Traits<K>, typename ValueTraits = Traits<V>>
+class FastHashMap;
+
 template<typename T, typename TraitsForT = Traits<T>, bool IsOrdered = false>
 class HashTable;
 
@@ -103,6 +106,9 @@ using OrderedHashMap = HashMap<K, V, KeyTraits, ValueTraits, true>;
 template<typename T>
 class Badge;
 
+template<typename T>
+class Coroutine;
+
 template<typename T>
 class FixedArray;
 
@@ -160,10 +166,12 @@ using AK::ByteString;
 using AK::CircularBuffer;
 using AK::CircularQueue;
 using AK::ConstrainedStream;
+using AK::Coroutine;
 using AK::CountingStream;
 using AK::DoublyLinkedList;
 using AK::Error;
 using AK::ErrorOr;
+using AK::FastHashMap;
 using AK::FixedArray;
 using AK::FlyString;
 using AK::Function;
@@ -6,25 +6,24 @@
 
 #pragma once
 
-#include <AK/GenericLexer.h>
+#include <AK/JsonStructuralIndex.h>
 #include <AK/JsonValue.h>
 
 namespace AK {
 
-class JsonParser : private GenericLexer {
+class JsonParser {
 public:
     static ErrorOr<JsonValue> parse(StringView);
 
 private:
-    explicit JsonParser(StringView input)
-        : GenericLexer(input)
+    explicit JsonParser(JsonStructuralIndex const& index)
+        : m_reader(index)
     {
     }
 
     ErrorOr<JsonValue> parse_json();
     ErrorOr<JsonValue> parse_helper();
 
-    ErrorOr<ByteString> consume_and_unescape_string();
     ErrorOr<JsonValue> parse_array();
     ErrorOr<JsonValue> parse_object();
     ErrorOr<JsonValue> parse_number();
@@ -32,6 +31,9 @@ private:
     ErrorOr<JsonValue> parse_false();
     ErrorOr<JsonValue> parse_true();
     ErrorOr<JsonValue> parse_null();
+
+    JsonTokenReader m_reader;
+    StringBuilder m_string_builder;
 };
 
 }
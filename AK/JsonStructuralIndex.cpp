@@ -0,0 +1,397 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/BuiltinWrappers.h>
+#include <AK/CharacterTypes.h>
+#include <AK/FloatingPointStringConversions.h>
+#include <AK/JsonStructuralIndex.h>
+#include <AK/NumericLimits.h>
+#include <AK/SIMDExtras.h>
+#include <AK/Utf16View.h>
+
+namespace AK {
+
+static constexpr bool is_space(char ch)
+{
+    return ch == '\t' || ch == '\n' || ch == '\r' || ch == ' ';
+}
+
+namespace {
+
+struct BlockMasks {
+    u64 quote { 0 };
+    u64 backslash { 0 };
+    u64 whitespace { 0 };
+    u64 op { 0 };
+};
+
+}
+
+// Classifies a block of 64 bytes, with bit N of every mask belonging to byte N.
+ALWAYS_INLINE static BlockMasks classify_block(u8 const* block)
+{
+    using SIMD::u8x16;
+
+    BlockMasks masks;
+    for (size_t i = 0; i < 4; ++i) {
+        auto chunk = SIMD::load_unaligned<u8x16>(block + i * 16);
+        auto bits = [&](auto mask) { return static_cast<u64>(SIMD::maskbits(static_cast<SIMD::i8x16>(mask))) << (i * 16); };
+
+        masks.quote |= bits(chunk == '"');
+        masks.backslash |= bits(chunk == '\\');
+        masks.whitespace |= bits((chunk == ' ') | (chunk == '\t') | (chunk == '\n') | (chunk == '\r'));
+        masks.op |= bits((chunk == '{') | (chunk == '}') | (chunk == '[') | (chunk == ']') | (chunk == ':') | (chunk == ','));
+    }
+    return masks;
+}
+
+// Returns the characters that are escaped by a backslash. In a run of backslashes, every other one escapes the next
+// character, so whether the character after a run is escaped depends on the run having an odd length. Adding the
+// start of every run that begins on an odd position to the run carries out of its end exactly when that is the case.
+ALWAYS_INLINE static u64 find_escaped_characters(u64 backslash, bool& next_is_escaped)
+{
+    u64 escaped_from_previous_block = next_is_escaped ? 1 : 0;
+    if (backslash == 0) {
+        next_is_escaped = false;
+        return escaped_from_previous_block;
+    }
+
+    static constexpr u64 even_bits = 0x5555555555555555ull;
+
+    backslash &= ~escaped_from_previous_block;
+    auto follows_escape = (backslash << 1) | escaped_from_previous_block;
+    auto odd_sequence_starts = backslash & ~even_bits & ~follows_escape;
+
+    u64 sequences_starting_on_even_bits;
+    next_is_escaped = __builtin_add_overflow(odd_sequence_starts, backslash, &sequences_starting_on_even_bits);
+
+    auto invert_mask = sequences_starting_on_even_bits << 1;
+    return (even_bits ^ invert_mask) & follows_escape;
+}
+
+// Sets every bit that has an odd number of set bits at or below it, which turns the quotes of a block into a mask of
+// the characters that are inside strings (including the opening quotes, but not the closing ones).
+ALWAYS_INLINE static u64 prefix_xor(u64 bits)
+{
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+ErrorOr<JsonStructuralIndex> JsonStructuralIndex::create(StringView input)
+{
+    if (input.length() >= NumericLimits<u32>::max())
+        return Error::from_string_literal("JsonParser: Input is too large");
+
+    Vector<u32> positions;
+
+    bool next_is_escaped = false;
+    u64 previous_in_string = 0;
+    u64 previous_is_nonquote_scalar = 0;
+
+    auto index_block = [&](u8 const* block, size_t offset) -> ErrorOr<void> {
+        auto masks = classify_block(block);
+
+        auto escaped = find_escaped_characters(masks.backslash, next_is_escaped);
+        auto quote = masks.quote & ~escaped;
+        auto in_string = prefix_xor(quote) ^ previous_in_string;
+        previous_in_string = static_cast<u64>(static_cast<i64>(in_string) >> 63);
+
+        // Every scalar that isn't a string starts with a character that isn't preceded by another character of a
+        // scalar. Strings start with their opening quote, and everything up to and including their closing quote is
+        // not structural.
+        auto scalar = ~(masks.op | masks.whitespace);
+        auto nonquote_scalar = scalar & ~quote;
+        auto follows_nonquote_scalar = (nonquote_scalar << 1) | previous_is_nonquote_scalar;
+        previous_is_nonquote_scalar = nonquote_scalar >> 63;
+
+        auto string_tail = in_string ^ quote;
+        auto structurals = (masks.op | (scalar & ~follows_nonquote_scalar)) & ~string_tail;
+
+        TRY(positions.try_ensure_capacity(positions.size() + popcount(structurals)));
+        while (structurals != 0) {
+            positions.unchecked_append(static_cast<u32>(offset + count_trailing_zeroes(structurals)));
+            structurals &= structurals - 1;
+        }
+        return {};
+    };
+
+    auto const* bytes = reinterpret_cast<u8 const*>(input.characters_without_null_termination());
+
+    size_t offset = 0;
+    for (; offset + 64 <= input.length(); offset += 64)
+        TRY(index_block(bytes + offset, offset));
+
+    if (offset < input.length()) {
+        // Whitespace is never structural, so padding the last block with it doesn't change the result.
+        Array<u8, 64> last_block;
+        last_block.fill(' ');
+        __builtin_memcpy(last_block.data(), bytes + offset, input.length() - offset);
+        TRY(index_block(last_block.data(), offset));
+    }
+
+    if (previous_in_string != 0)
+        return Error::from_string_literal("JsonParser: EOF while parsing String");
+
+    TRY(positions.try_append(static_cast<u32>(input.length())));
+    return JsonStructuralIndex { input, move(positions) };
+}
+
+static Optional<size_t> find_escape_or_control_character(StringView string)
+{
+    using SIMD::u8x16;
+
+    auto const* bytes = reinterpret_cast<u8 const*>(string.characters_without_null_termination());
+
+    size_t i = 0;
+    for (; i + 16 <= string.length(); i += 16) {
+        auto chunk = SIMD::load_unaligned<u8x16>(bytes + i);
+        if (auto mask = SIMD::maskbits(static_cast<SIMD::i8x16>((chunk < 0x20) | (chunk == '\\'))); mask != 0)
+            return i + count_trailing_zeroes(mask);
+    }
+    for (; i < string.length(); ++i) {
+        if (bytes[i] < 0x20 || bytes[i] == '\\')
+            return i;
+    }
+    return {};
+}
+
+// ECMA-404 9 String
+ErrorOr<JsonString> JsonTokenReader::consume_string(StringBuilder& scratch)
+{
+    if (peek() != '"')
+        return Error::from_string_literal("JsonParser: Expected '\"'");
+
+    size_t start = m_positions[m_current] + 1;
+    size_t end = m_positions[m_current + 1];
+    ++m_current;
+
+    // Only whitespace can follow the closing quote before the next structural character, so we don't have to look at
+    // the contents of the string to find it.
+    while (end > start && is_space(m_input[end - 1]))
+        --end;
+    if (end == start || m_input[end - 1] != '"')
+        return Error::from_string_literal("JsonParser: EOF while parsing String");
+
+    auto contents = m_input.substring_view(start, end - 1 - start);
+
+    // Spec: All code points may be placed within the quotation marks except for the code points that must be escaped:
+    //       quotation mark (U+0022), reverse solidus (U+005C), and the control characters U+0000 to U+001F.
+    auto special = find_escape_or_control_character(contents);
+    if (!special.has_value())
+        return JsonString { contents, false };
+
+    scratch.clear();
+
+    auto decode_surrogate = [&](size_t index) -> Optional<u16> {
+        if (index + 4 > contents.length())
+            return {};
+
+        u16 surrogate = 0;
+        for (size_t i = index; i < index + 4; ++i) {
+            if (!is_ascii_hex_digit(contents[i]))
+                return {};
+            surrogate = (surrogate << 4u) | parse_ascii_hex_digit(contents[i]);
+        }
+        return surrogate;
+    };
+
+    size_t index = 0;
+    while (special.has_value()) {
+        scratch.append(contents.substring_view(index, *special));
+        index += *special;
+
+        if (contents[index] != '\\')
+            return Error::from_string_literal("JsonParser: ASCII control sequence encountered");
+        if (++index == contents.length())
+            return Error::from_string_literal("JsonParser: EOF while parsing String");
+
+        switch (contents[index++]) {
+        case '"':
+            scratch.append('"');
+            break;
+        case '\\':
+            scratch.append('\\');
+            break;
+        case '/':
+            scratch.append('/');
+            break;
+        case 'b':
+            scratch.append('\b');
+            break;
+        case 'f':
+            scratch.append('\f');
+            break;
+        case 'n':
+            scratch.append('\n');
+            break;
+        case 'r':
+            scratch.append('\r');
+            break;
+        case 't':
+            scratch.append('\t');
+            break;
+        case 'u': {
+            // A code point outside of the Basic Multilingual Plane may be escaped as a UTF-16 surrogate pair, which we
+            // combine. Unpaired surrogates are kept as they are.
+            auto high_surrogate = decode_surrogate(index);
+            if (!high_surrogate.has_value())
+                return Error::from_string_literal("JsonParser: Error while parsing Unicode escape");
+            index += 4;
+
+            u32 code_point = *high_surrogate;
+            if (Utf16View::is_high_surrogate(*high_surrogate) && contents.substring_view(index).starts_with("\\u"sv)) {
+                auto low_surrogate = decode_surrogate(index + 2);
+                if (!low_surrogate.has_value())
+                    return Error::from_string_literal("JsonParser: Error while parsing Unicode escape");
+                if (Utf16View::is_low_surrogate(*low_surrogate)) {
+                    code_point = Utf16View::decode_surrogate_pair(*high_surrogate, *low_surrogate);
+                    index += 6;
+                }
+            }
+
+            scratch.append_code_point(code_point);
+            break;
+        }
+        default:
+            return Error::from_string_literal("JsonParser: Invalid escaped character");
+        }
+
+        special = find_escape_or_control_character(contents.substring_view(index));
+    }
+    scratch.append(contents.substring_view(index));
+
+    return JsonString { scratch.string_view(), true };
+}
+
+ErrorOr<void> JsonTokenReader::consume_scalar_end(size_t end)
+{
+    for (size_t next = m_positions[m_current + 1]; end < next; ++end) {
+        if (!is_space(m_input[end]))
+            return Error::from_string_literal("JsonParser: Unexpected character after value");
+    }
+    ++m_current;
+    return {};
+}
+
+// ECMA-404 8 Numbers
+ErrorOr<JsonNumber> JsonTokenReader::consume_number()
+{
+    // Every power of ten up to this one is exactly representable as a double.
+    static constexpr double exact_powers_of_ten[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    // A number can't extend past the next structural character.
+    char const* start = m_input.characters_without_null_termination() + m_positions[m_current];
+    char const* end = m_input.characters_without_null_termination() + m_positions[m_current + 1];
+    char const* it = start;
+
+    bool negative = false;
+    if (*it == '-') {
+        negative = true;
+        ++it;
+    }
+    if (it == end || !is_ascii_digit(*it))
+        return Error::from_string_literal("JsonParser: Unexpected '-' without further digits");
+    if (*it == '0' && it + 1 != end && is_ascii_digit(it[1]))
+        return Error::from_string_literal("JsonParser: Cannot have leading zeros");
+
+    u64 significand = 0;
+    bool significand_overflowed = false;
+    size_t digit_count = 0;
+
+    auto consume_digits = [&] {
+        auto digits_start = it;
+        for (; it != end && is_ascii_digit(*it); ++it) {
+            significand_overflowed |= __builtin_mul_overflow(significand, 10u, &significand);
+            significand_overflowed |= __builtin_add_overflow(significand, static_cast<u64>(*it - '0'), &significand);
+        }
+        digit_count += it - digits_start;
+        return static_cast<size_t>(it - digits_start);
+    };
+
+    consume_digits();
+
+    bool is_integer = true;
+    i64 exponent = 0;
+
+    if (it != end && *it == '.') {
+        is_integer = false;
+        ++it;
+
+        auto fraction_digit_count = consume_digits();
+        if (fraction_digit_count == 0)
+            return Error::from_string_literal("JsonParser: Must have digits after decimal point");
+        exponent = -static_cast<i64>(fraction_digit_count);
+    }
+
+    if (it != end && (*it == 'e' || *it == 'E')) {
+        is_integer = false;
+        ++it;
+
+        bool negative_exponent = false;
+        if (it != end && (*it == '+' || *it == '-')) {
+            negative_exponent = *it == '-';
+            ++it;
+        }
+        if (it == end || !is_ascii_digit(*it))
+            return Error::from_string_literal("JsonParser: Must have digits after exponent with an optional sign inbetween");
+
+        // Anything this large over- or underflows anyway, so we only need to keep counting far enough to tell.
+        i64 explicit_exponent = 0;
+        for (; it != end && is_ascii_digit(*it); ++it) {
+            if (explicit_exponent < 100'000)
+                explicit_exponent = explicit_exponent * 10 + (*it - '0');
+        }
+        exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+    }
+
+    auto number_end = it;
+    TRY(consume_scalar_end(number_end - m_input.characters_without_null_termination()));
+
+    if (!significand_overflowed) {
+        // Negative zero can only be represented as a double.
+        if (is_integer && !negative)
+            return JsonNumber { significand };
+        if (is_integer && significand != 0 && significand <= static_cast<u64>(NumericLimits<i64>::max()) + 1)
+            return JsonNumber { static_cast<i64>(0 - significand) };
+        if (significand == 0)
+            return JsonNumber { negative ? -0.0 : 0.0 };
+
+        // If both the significand and the power of ten are exactly representable, a single correctly rounded
+        // multiplication or division gives the correctly rounded result (Clinger's fast path).
+        if (digit_count <= 19 && significand <= (1ull << 53) && exponent >= -22 && exponent <= 22) {
+            auto value = static_cast<double>(significand);
+            if (exponent < 0)
+                value /= exact_powers_of_ten[-exponent];
+            else
+                value *= exact_powers_of_ten[exponent];
+            return JsonNumber { negative ? -value : value };
+        }
+    }
+
+    auto parse_result = parse_first_floating_point(start, number_end);
+    if (!parse_result.parsed_value() || parse_result.end_ptr != number_end)
+        return Error::from_string_literal("JsonParser: Invalid floating point");
+    return JsonNumber { parse_result.value };
+}
+
+ErrorOr<void> JsonTokenReader::consume_literal(StringView literal)
+{
+    auto start = m_positions[m_current];
+    if (!m_input.substring_view(start).starts_with(literal))
+        return Error::from_string_literal("JsonParser: Unexpected character");
+    return consume_scalar_end(start + literal.length());
+}
+
+}
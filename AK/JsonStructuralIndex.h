@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/StringBuilder.h>
+#include <AK/StringView.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+
+namespace AK {
+
+// The positions of all structural characters of a JSON text: the brackets, braces, colons and commas outside of
+// strings, the opening quote of every string, and the first character of every other scalar. This is built 64 bytes
+// at a time with vector instructions, so that a parser can jump from token to token without looking at whitespace or
+// at the contents of strings.
+class JsonStructuralIndex {
+public:
+    static ErrorOr<JsonStructuralIndex> create(StringView input);
+
+    StringView input() const { return m_input; }
+
+    // The positions in ascending order, followed by the length of the input as a sentinel.
+    ReadonlySpan<u32> positions() const { return m_positions; }
+
+private:
+    JsonStructuralIndex(StringView input, Vector<u32> positions)
+        : m_input(input)
+        , m_positions(move(positions))
+    {
+    }
+
+    StringView m_input;
+    Vector<u32> m_positions;
+};
+
+using JsonNumber = Variant<u64, i64, double>;
+
+struct JsonString {
+    // A view into the input if the string had no escapes, and otherwise into the scratch builder that was passed to
+    // JsonTokenReader::consume_string(), which stays valid until that builder is used again.
+    StringView value;
+    bool had_escapes { false };
+};
+
+// Walks the tokens of a JSON text using its structural index. This does the work that is common to every consumer of
+// the tokens, leaving it to them to build values out of them.
+class JsonTokenReader {
+public:
+    explicit JsonTokenReader(JsonStructuralIndex const& index)
+        : m_input(index.input())
+        , m_positions(index.positions())
+    {
+    }
+
+    bool is_eof() const { return m_current + 1 >= m_positions.size(); }
+
+    // The character that the current token starts with, or 0 once all tokens have been consumed.
+    char peek() const { return is_eof() ? '\0' : m_input[m_positions[m_current]]; }
+
+    bool consume_specific(char ch)
+    {
+        if (peek() != ch)
+            return false;
+        ++m_current;
+        return true;
+    }
+
+    ErrorOr<JsonString> consume_string(StringBuilder& scratch);
+    ErrorOr<JsonNumber> consume_number();
+    ErrorOr<void> consume_literal(StringView);
+
+private:
+    ErrorOr<void> consume_scalar_end(size_t end);
+
+    StringView m_input;
+    ReadonlySpan<u32> m_positions;
+    size_t m_current { 0 };
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::JsonNumber;
+using AK::JsonString;
+using AK::JsonStructuralIndex;
+using AK::JsonTokenReader;
+#endif
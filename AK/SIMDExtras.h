@@ -100,6 +100,19 @@ ALWAYS_INLINE static int maskcount(i32x4 mask)
     return count_lut[maskbits(mask)];
 }
 
+// Gathers the most significant bit of every byte, with bit N of the result coming from byte N.
+ALWAYS_INLINE static u16 maskbits(i8x16 mask)
+{
+#if defined(__SSE2__)
+    return static_cast<u16>(__builtin_ia32_pmovmskb128((c8x16)mask));
+#else
+    u16 result = 0;
+    for (size_t i = 0; i < 16; ++i)
+        result |= static_cast<u16>((static_cast<u8>(mask[i]) >> 7) << i);
+    return result;
+#endif
+}
+
 // Load / Store
 
 template<SIMDVector VectorType>
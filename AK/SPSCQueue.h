@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/StdLibExtras.h>
+
+namespace AK {
+
+// A bounded, lock-free queue for handing values from exactly one producer thread to exactly one consumer thread.
+// Neither side ever blocks or allocates, which makes it suitable for talking to real-time threads.
+template<typename T, size_t Capacity>
+class SPSCQueue {
+    AK_MAKE_NONCOPYABLE(SPSCQueue);
+    AK_MAKE_NONMOVABLE(SPSCQueue);
+
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "SPSCQueue capacity must be a power of two");
+
+public:
+    SPSCQueue() = default;
+
+    ~SPSCQueue()
+    {
+        while (try_dequeue().has_value())
+            ;
+    }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+    // May only be called from the producer thread.
+    bool is_full() const
+    {
+        return m_tail.load(AK::memory_order_relaxed) - m_head.load(AK::memory_order_acquire) == Capacity;
+    }
+
+    // May only be called from the consumer thread.
+    bool is_empty() const
+    {
+        return m_head.load(AK::memory_order_relaxed) == m_tail.load(AK::memory_order_acquire);
+    }
+
+    // May only be called from the producer thread. Returns false without consuming the value if the queue is full.
+    template<typename U = T>
+    [[nodiscard]] bool try_enqueue(U&& value)
+    {
+        auto tail = m_tail.load(AK::memory_order_relaxed);
+        if (tail - m_head.load(AK::memory_order_acquire) == Capacity)
+            return false;
+
+        new (&slot(tail)) T(forward<U>(value));
+        m_tail.store(tail + 1, AK::memory_order_release);
+        return true;
+    }
+
+    // May only be called from the consumer thread.
+    Optional<T> try_dequeue()
+    {
+        auto head = m_head.load(AK::memory_order_relaxed);
+        if (head == m_tail.load(AK::memory_order_acquire))
+            return {};
+
+        auto& element = slot(head);
+        T value = move(element);
+        element.~T();
+        m_head.store(head + 1, AK::memory_order_release);
+        return value;
+    }
+
+private:
+    T& slot(size_t index) { return reinterpret_cast<T*>(m_storage)[index & (Capacity - 1)]; }
+
+    // NOTE: The head and tail live on separate cache lines so that the producer and consumer don't keep stealing each
+    //       other's cache line.
+    alignas(64) Atomic<size_t> m_head { 0 };
+    alignas(64) Atomic<size_t> m_tail { 0 };
+    alignas(T) u8 m_storage[sizeof(T) * Capacity];
+};
+
+}
+
+#if USING_AK_GLOBALLY
+using AK::SPSCQueue;
+#endif
@@ -60,6 +60,16 @@ public:
         ++m_size;
     }
 
+    T take_last()
+    {
+        VERIFY(!is_empty());
+        auto value = m_segments.last()->take_last();
+        if (m_segments.last()->is_empty())
+            m_segments.take_last();
+        --m_size;
+        return value;
+    }
+
 private:
     Vector<NonnullOwnPtr<Vector<T, segment_size>>> m_segments;
     size_t m_size { 0 };
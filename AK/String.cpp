@@ -27,13 +27,27 @@ String String::from_utf8_with_replacement_character(StringView view, WithBOMHand
     if (auto bytes = view.bytes(); with_bom_handling == WithBOMHandling::Yes && bytes.size() >= 3 && bytes[0] == 0xEF && bytes[1] == 0xBB && bytes[2] == 0xBF)
         view = view.substring_view(3);
 
-    if (Utf8View(view).validate())
+    size_t valid_bytes = 0;
+    if (Utf8View(view).validate(valid_bytes))
         return String::from_utf8_without_validation(view.bytes());
 
-    StringBuilder builder;
+    // Copy each run of valid UTF-8 in bulk, and only decode the invalid sequences between them one by one.
+    StringBuilder builder(view.length());
+
+    while (true) {
+        builder.append(view.substring_view(0, valid_bytes));
+        view = view.substring_view(valid_bytes);
+
+        Utf8View invalid_sequence { view };
+        auto it = invalid_sequence.begin();
+        builder.append_code_point(*it);
+        view = view.substring_view(invalid_sequence.byte_offset_of(++it));
 
-    for (auto c : Utf8View { view })
-        builder.append_code_point(c);
+        if (Utf8View(view).validate(valid_bytes)) {
+            builder.append(view);
+            break;
+        }
+    }
 
     return builder.to_string_without_validation();
 }
@@ -61,34 +75,120 @@ ErrorOr<String> String::from_utf8(StringView view)
     return result;
 }
 
+template<Endianness endianness>
+static simdutf::result validate_utf16_with_errors(char16_t const* data, size_t length)
+{
+    if constexpr (endianness == Endianness::Little)
+        return simdutf::validate_utf16le_with_errors(data, length);
+    else
+        return simdutf::validate_utf16be_with_errors(data, length);
+}
+
+template<Endianness endianness>
+static size_t utf8_length_from_valid_utf16(char16_t const* data, size_t length)
+{
+    if constexpr (endianness == Endianness::Little)
+        return simdutf::utf8_length_from_utf16le(data, length);
+    else
+        return simdutf::utf8_length_from_utf16be(data, length);
+}
+
+template<Endianness endianness>
+static void convert_valid_utf16_to_utf8(char16_t const* data, size_t length, Bytes buffer)
+{
+    [[maybe_unused]] size_t written = 0;
+    if constexpr (endianness == Endianness::Little)
+        written = simdutf::convert_valid_utf16le_to_utf8(data, length, reinterpret_cast<char*>(buffer.data()));
+    else
+        written = simdutf::convert_valid_utf16be_to_utf8(data, length, reinterpret_cast<char*>(buffer.data()));
+    ASSERT(written == buffer.size());
+}
+
+template<Endianness endianness>
+ErrorOr<String> String::from_utf16_bytes(ReadonlyBytes bytes, bool use_replacement_character)
+{
+    auto const* data = reinterpret_cast<char16_t const*>(bytes.data());
+    size_t length = bytes.size() / 2;
+    bool has_trailing_byte = use_replacement_character && bytes.size() % 2 != 0;
+
+    auto result = validate_utf16_with_errors<endianness>(data, length);
+
+    if (result.error == simdutf::SUCCESS && !has_trailing_byte) {
+        String string;
+        TRY(string.replace_with_new_string(utf8_length_from_valid_utf16<endianness>(data, length), [&](Bytes buffer) -> ErrorOr<void> {
+            convert_valid_utf16_to_utf8<endianness>(data, length, buffer);
+            return {};
+        }));
+        return string;
+    }
+
+    if (!use_replacement_character) {
+        if constexpr (endianness == Endianness::Little)
+            return Error::from_string_literal("String::from_utf16_le: Input was not valid UTF-16LE");
+        else
+            return Error::from_string_literal("String::from_utf16_be: Input was not valid UTF-16BE");
+    }
+
+    static constexpr Array<u8, 3> replacement_character_in_utf8 { 0xEF, 0xBF, 0xBD };
+
+    Vector<u8> output;
+    TRY(output.try_ensure_capacity(bytes.size()));
+
+    // Transcode each run of valid UTF-16 in bulk, and replace the unpaired surrogate that ends it.
+    while (true) {
+        auto offset = output.size();
+        TRY(output.try_resize(offset + utf8_length_from_valid_utf16<endianness>(data, result.count)));
+        convert_valid_utf16_to_utf8<endianness>(data, result.count, output.span().slice(offset));
+
+        if (result.error == simdutf::SUCCESS)
+            break;
+
+        TRY(output.try_append(replacement_character_in_utf8.data(), replacement_character_in_utf8.size()));
+        data += result.count + 1;
+        length -= result.count + 1;
+        result = validate_utf16_with_errors<endianness>(data, length);
+    }
+
+    if (has_trailing_byte)
+        TRY(output.try_append(replacement_character_in_utf8.data(), replacement_character_in_utf8.size()));
+
+    return String::from_utf8_without_validation(output);
+}
+
 ErrorOr<String> String::from_utf16_le(ReadonlyBytes bytes)
 {
-    if (!validate_utf16_le(bytes))
-        return Error::from_string_literal("String::from_utf16_le: Input was not valid UTF-16LE");
-    if (bytes.is_empty())
-        return String {};
-    char16_t const* utf16_data = reinterpret_cast<char16_t const*>(bytes.data());
-    size_t utf16_length = bytes.size() / 2;
-    size_t max_utf8_length = simdutf::utf8_length_from_utf16(utf16_data, utf16_length);
-    Vector<u8> buffer;
-    buffer.resize(max_utf8_length);
-    auto utf8_length = simdutf::convert_utf16le_to_utf8(utf16_data, utf16_length, reinterpret_cast<char*>(buffer.data()));
-    return String::from_utf8_without_validation(ReadonlyBytes { buffer.data(), utf8_length });
+    return from_utf16_bytes<Endianness::Little>(bytes, false);
 }
 
 ErrorOr<String> String::from_utf16_be(ReadonlyBytes bytes)
 {
-    if (!validate_utf16_be(bytes))
-        return Error::from_string_literal("String::from_utf16_be: Input was not valid UTF-16BE");
-    if (bytes.is_empty())
-        return String {};
-    char16_t const* utf16_data = reinterpret_cast<char16_t const*>(bytes.data());
-    size_t utf16_length = bytes.size() / 2;
-    size_t max_utf8_length = simdutf::utf8_length_from_utf16(utf16_data, utf16_length);
-    Vector<u8> buffer;
-    buffer.resize(max_utf8_length);
-    auto utf8_length = simdutf::convert_utf16be_to_utf8(utf16_data, utf16_length, reinterpret_cast<char*>(buffer.data()));
-    return String::from_utf8_without_validation(ReadonlyBytes { buffer.data(), utf8_length });
+    return from_utf16_bytes<Endianness::Big>(bytes, false);
+}
+
+ErrorOr<String> String::from_utf16_le_with_replacement_character(ReadonlyBytes bytes)
+{
+    return from_utf16_bytes<Endianness::Little>(bytes, true);
+}
+
+ErrorOr<String> String::from_utf16_be_with_replacement_character(ReadonlyBytes bytes)
+{
+    return from_utf16_bytes<Endianness::Big>(bytes, true);
+}
+
+ErrorOr<String> String::from_latin1(ReadonlyBytes bytes)
+{
+    auto const* data = reinterpret_cast<char const*>(bytes.data());
+
+    if (simdutf::validate_ascii(data, bytes.size()))
+        return String::from_utf8_without_validation(bytes);
+
+    String result;
+    TRY(result.replace_with_new_string(simdutf::utf8_length_from_latin1(data, bytes.size()), [&](Bytes buffer) -> ErrorOr<void> {
+        [[maybe_unused]] auto written = simdutf::convert_latin1_to_utf8(data, bytes.size(), reinterpret_cast<char*>(buffer.data()));
+        ASSERT(written == buffer.size());
+        return {};
+    }));
+    return result;
 }
 
 ErrorOr<String> String::from_utf16(Utf16View const& utf16)
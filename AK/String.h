@@ -9,6 +9,7 @@
 
 #include <AK/CharacterTypes.h>
 #include <AK/Concepts.h>
+#include <AK/Endian.h>
 #include <AK/Format.h>
 #include <AK/Forward.h>
 #include <AK/Optional.h>
@@ -73,6 +74,14 @@ public:
     static ErrorOr<String> from_utf16_le(ReadonlyBytes);
     static ErrorOr<String> from_utf16_be(ReadonlyBytes);
 
+    // Creates a new String from UTF-16 encoded bytes, using the replacement character for unpaired surrogates and for
+    // a trailing odd byte.
+    static ErrorOr<String> from_utf16_le_with_replacement_character(ReadonlyBytes);
+    static ErrorOr<String> from_utf16_be_with_replacement_character(ReadonlyBytes);
+
+    // Creates a new String from ISO-8859-1 encoded bytes, which map directly to the first 256 code points.
+    static ErrorOr<String> from_latin1(ReadonlyBytes);
+
     // Creates a new String by reading byte_count bytes from a UTF-8 encoded Stream.
     static ErrorOr<String> from_stream(Stream&, size_t byte_count);
 
@@ -230,6 +239,9 @@ private:
 
     using ShortString = Detail::ShortString;
 
+    template<Endianness>
+    static ErrorOr<String> from_utf16_bytes(ReadonlyBytes, bool use_replacement_character);
+
     constexpr bool is_invalid() const
     {
         return raw(Badge<String> {}) == 0;
@@ -70,6 +70,11 @@ inline ErrorOr<void> StringBuilder::will_append(size_t size)
     return {};
 }
 
+ErrorOr<void> StringBuilder::try_ensure_capacity(size_t capacity)
+{
+    return m_buffer.try_ensure_capacity(STRING_BASE_PREFIX_SIZE + capacity);
+}
+
 size_t StringBuilder::length() const
 {
     return m_buffer.size() - STRING_BASE_PREFIX_SIZE;
@@ -42,6 +42,9 @@ public:
     ErrorOr<void> try_append_repeated(StringView, size_t);
     ErrorOr<void> try_append_escaped_for_json(StringView);
 
+    // Makes room for the given number of bytes in total, so that appending up to that many doesn't reallocate.
+    ErrorOr<void> try_ensure_capacity(size_t);
+
     void append(StringView);
     void append(Utf16View const&);
     void append(Utf32View const&);
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/Error.h>
 #include <AK/NonnullRefPtr.h>
 #include <AK/RefCounted.h>
@@ -16,8 +17,11 @@ namespace AK::Detail {
 static constexpr size_t MAX_SHORT_STRING_BYTE_COUNT = sizeof(StringData*) - sizeof(u8);
 
 class StringData;
+class FlyStringTable;
 
-void did_destroy_fly_string_data(Badge<StringData>, StringData const&);
+// Drops what may be the last reference to an interned string, and returns whether it was, in which case the string has
+// been removed from the fly string table and must be destroyed.
+bool release_fly_string_data(Badge<StringData>, StringData const&);
 
 class StringData final : public RefCounted<StringData> {
 public:
@@ -73,8 +77,38 @@ public:
     {
         if (m_substring)
             substring_data().superstring->unref();
-        if (m_is_fly_string)
-            Detail::did_destroy_fly_string_data({}, *this);
+    }
+
+    // Interned strings may be shared between threads, so their reference count is updated atomically. Other threads can
+    // only gain a new reference to one through the fly string table, which is why the last one is dropped under its lock.
+    void ref() const
+    {
+        if (m_is_fly_string) {
+            AK::atomic_fetch_add(&m_ref_count, 1u, AK::memory_order_relaxed);
+            return;
+        }
+        RefCountedBase::ref();
+    }
+
+    bool unref() const
+    {
+        if (!m_is_fly_string)
+            return RefCounted::unref();
+
+        for (auto ref_count = AK::atomic_load(&m_ref_count, AK::memory_order_relaxed); ref_count > 1;) {
+            if (AK::atomic_compare_exchange_strong(&m_ref_count, ref_count, ref_count - 1, AK::memory_order_acq_rel))
+                return false;
+        }
+
+        if (!release_fly_string_data({}, *this))
+            return false;
+        delete this;
+        return true;
+    }
+
+    RefCountType deref_fly_string_data(Badge<FlyStringTable>) const
+    {
+        return AK::atomic_fetch_sub(&m_ref_count, 1u, AK::memory_order_acq_rel) - 1;
     }
 
     SubstringData const& substring_data() const
@@ -168,14 +168,14 @@ ErrorOr<NonnullOwnPtr<DeflateDecompressor>> DeflateDecompressor::create(MaybeOwn
 
 ErrorOr<ByteBuffer> DeflateDecompressor::decompress_all(ReadonlyBytes bytes)
 {
-    return ::Compress::decompress_all<DeflateDecompressor>(bytes);
+    return GenericZlibDecompressor::decompress_all(bytes, -MAX_WBITS);
 }
 
 ErrorOr<NonnullOwnPtr<DeflateCompressor>> DeflateCompressor::create(MaybeOwned<Stream> stream, GenericZlibCompressionLevel compression_level)
 {
     auto buffer = TRY(AK::FixedArray<u8>::create(16 * 1024));
-    auto zstream = TRY(GenericZlibCompressor::new_z_stream(-MAX_WBITS, compression_level));
-    return adopt_nonnull_own_or_enomem(new (nothrow) DeflateCompressor(move(buffer), move(stream), zstream));
+    auto zstream = TRY(GenericZlibCompressor::new_z_stream(compression_level));
+    return adopt_nonnull_own_or_enomem(new (nothrow) DeflateCompressor(move(buffer), move(stream), zstream, compression_level));
 }
 
 ErrorOr<ByteBuffer> DeflateCompressor::compress_all(ReadonlyBytes bytes, GenericZlibCompressionLevel compression_level)
@@ -73,8 +73,8 @@ public:
     static ErrorOr<ByteBuffer> compress_all(ReadonlyBytes, GenericZlibCompressionLevel = GenericZlibCompressionLevel::Default);
 
 private:
-    DeflateCompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, z_stream* zstream)
-        : GenericZlibCompressor(move(buffer), move(stream), zstream)
+    DeflateCompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, z_stream* zstream, GenericZlibCompressionLevel compression_level)
+        : GenericZlibCompressor(move(buffer), move(stream), zstream, Format::Deflate, compression_level)
     {
     }
 };
@@ -4,7 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
+#include <AK/NumericLimits.h>
+#include <AK/ScopeGuard.h>
 #include <LibCompress/GenericZlib.h>
+#include <LibCore/System.h>
+#include <LibThreading/Thread.h>
 
 #include <zlib.h>
 
@@ -88,6 +93,60 @@ ErrorOr<Bytes> GenericZlibDecompressor::read_some(Bytes bytes)
     return bytes.slice(0, bytes.size() - m_zstream->avail_out);
 }
 
+ErrorOr<ByteBuffer> GenericZlibDecompressor::decompress_all(ReadonlyBytes bytes, int window_bits)
+{
+    auto* zstream = TRY(new_z_stream(window_bits));
+    ScopeGuard guard = [&] {
+        inflateEnd(zstream);
+        delete zstream;
+    };
+
+    // Compressed data usually expands to a few times its size, so we start there and double the buffer whenever it
+    // fills up. Large output buffers also let zlib spend most of its time in its fast decoding loop.
+    ByteBuffer output;
+    TRY(output.try_resize(max(bytes.size() * 4, 4 * KiB)));
+    size_t output_size = 0;
+
+    auto remaining_input = bytes;
+
+    while (true) {
+        if (zstream->avail_in == 0 && !remaining_input.is_empty()) {
+            auto input = remaining_input.trim(NumericLimits<uInt>::max());
+            zstream->next_in = const_cast<u8*>(input.data());
+            zstream->avail_in = input.size();
+            remaining_input = remaining_input.slice(input.size());
+        }
+
+        if (output_size == output.size())
+            TRY(output.try_resize(output.size() * 2));
+
+        auto available_output = min(output.size() - output_size, static_cast<size_t>(NumericLimits<uInt>::max()));
+        zstream->next_out = output.data() + output_size;
+        zstream->avail_out = available_output;
+
+        auto ret = inflate(zstream, Z_NO_FLUSH);
+        output_size += available_output - zstream->avail_out;
+
+        if (ret == Z_STREAM_END) {
+            // NOTE: Like the streaming decompressor, we decompress concatenated streams (such as multi-member gzip
+            //       files) as if they were a single one.
+            if (zstream->avail_in == 0 && remaining_input.is_empty())
+                break;
+            inflateReset(zstream);
+            continue;
+        }
+
+        if (ret != Z_OK && ret != Z_BUF_ERROR)
+            return handle_zlib_error(ret);
+
+        if (ret == Z_BUF_ERROR && zstream->avail_in == 0 && remaining_input.is_empty())
+            return Error::from_string_literal("Unexpected end of compressed data");
+    }
+
+    output.resize(output_size);
+    return output;
+}
+
 ErrorOr<size_t> GenericZlibDecompressor::write_some(ReadonlyBytes)
 {
     return Error::from_errno(EBADF);
@@ -107,14 +166,45 @@ void GenericZlibDecompressor::close()
 {
 }
 
-GenericZlibCompressor::GenericZlibCompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, z_stream* zstream)
+// Inputs at least this large are split into blocks that are compressed on several threads, like pigz does. Every block
+// is primed with the data that precedes it, so this costs very little compression ratio.
+static constexpr size_t minimum_size_for_parallel_compression = 1 * MiB;
+static constexpr size_t parallel_compression_block_size = 128 * KiB;
+static constexpr size_t maximum_parallel_compression_threads = 8;
+
+// The largest distance a deflate match can reach back.
+static constexpr size_t window_size = 32 * KiB;
+
+static int zlib_compression_level(GenericZlibCompressionLevel compression_level)
+{
+    switch (compression_level) {
+    case GenericZlibCompressionLevel::Fastest:
+        return Z_BEST_SPEED;
+    case GenericZlibCompressionLevel::Fast:
+        // NOTE: Levels 1 to 3 use zlib's greedy matcher, 4 and up its lazy one.
+        return 4;
+    case GenericZlibCompressionLevel::Default:
+        return 6;
+    case GenericZlibCompressionLevel::Best:
+        return Z_BEST_COMPRESSION;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+GenericZlibCompressor::GenericZlibCompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, z_stream* zstream, Format format, GenericZlibCompressionLevel compression_level)
     : m_stream(move(stream))
     , m_zstream(zstream)
+    , m_format(format)
+    , m_compression_level(compression_level)
     , m_buffer(move(buffer))
 {
+    if (m_format == Format::Zlib)
+        m_checksum = adler32(0, Z_NULL, 0);
+    else if (m_format == Format::Gzip)
+        m_checksum = crc32(0, Z_NULL, 0);
 }
 
-ErrorOr<z_stream*> GenericZlibCompressor::new_z_stream(int window_bits, GenericZlibCompressionLevel compression_level)
+ErrorOr<z_stream*> GenericZlibCompressor::new_z_stream(GenericZlibCompressionLevel compression_level)
 {
     auto zstream = new (nothrow) z_stream {};
     if (!zstream)
@@ -125,20 +215,7 @@ ErrorOr<z_stream*> GenericZlibCompressor::new_z_stream(int window_bits, GenericZ
     zstream->zfree = nullptr;
     zstream->opaque = nullptr;
 
-    int level = [&] {
-        switch (compression_level) {
-        case GenericZlibCompressionLevel::Fastest:
-            return Z_BEST_SPEED;
-        case GenericZlibCompressionLevel::Default:
-            return Z_DEFAULT_COMPRESSION;
-        case GenericZlibCompressionLevel::Best:
-            return Z_BEST_COMPRESSION;
-        default:
-            VERIFY_NOT_REACHED();
-        }
-    }();
-
-    if (auto ret = deflateInit2(zstream, level, Z_DEFLATED, window_bits, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY); ret != Z_OK)
+    if (auto ret = deflateInit2(zstream, zlib_compression_level(compression_level), Z_DEFLATED, -MAX_WBITS, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY); ret != Z_OK)
         return handle_zlib_error(ret);
 
     return zstream;
@@ -155,7 +232,61 @@ ErrorOr<Bytes> GenericZlibCompressor::read_some(Bytes)
     return Error::from_errno(EBADF);
 }
 
-ErrorOr<size_t> GenericZlibCompressor::write_some(ReadonlyBytes bytes)
+// https://datatracker.ietf.org/doc/html/rfc1950#section-2.2
+// https://datatracker.ietf.org/doc/html/rfc1952#section-2.3
+ErrorOr<void> GenericZlibCompressor::write_header_if_needed()
+{
+    if (m_has_written_header)
+        return {};
+    m_has_written_header = true;
+
+    auto level = zlib_compression_level(m_compression_level);
+
+    if (m_format == Format::Zlib) {
+        // CM = 8 (deflate), CINFO = 7 (32 KiB window), no preset dictionary, and FLEVEL as zlib itself would set it.
+        u8 level_flags = level < 2 ? 0 : level < 6 ? 1 : level == 6 ? 2 : 3;
+        u16 header = (0x78 << 8) | (level_flags << 6);
+        header += 31 - (header % 31);
+        Array<u8, 2> bytes { static_cast<u8>(header >> 8), static_cast<u8>(header) };
+        TRY(m_stream->write_until_depleted(bytes));
+    } else if (m_format == Format::Gzip) {
+        // ID1, ID2, CM = 8 (deflate), no flags, no modification time, XFL, and OS = 255 (unknown).
+        u8 extra_flags = level == Z_BEST_COMPRESSION ? 2 : level == Z_BEST_SPEED ? 4 : 0;
+        Array<u8, 10> bytes { 0x1f, 0x8b, 0x08, 0, 0, 0, 0, 0, extra_flags, 0xff };
+        TRY(m_stream->write_until_depleted(bytes));
+    }
+
+    return {};
+}
+
+ErrorOr<void> GenericZlibCompressor::write_trailer()
+{
+    if (m_format == Format::Zlib) {
+        Array<u8, 4> bytes {
+            static_cast<u8>(m_checksum >> 24),
+            static_cast<u8>(m_checksum >> 16),
+            static_cast<u8>(m_checksum >> 8),
+            static_cast<u8>(m_checksum),
+        };
+        TRY(m_stream->write_until_depleted(bytes));
+    } else if (m_format == Format::Gzip) {
+        Array<u8, 8> bytes {
+            static_cast<u8>(m_checksum),
+            static_cast<u8>(m_checksum >> 8),
+            static_cast<u8>(m_checksum >> 16),
+            static_cast<u8>(m_checksum >> 24),
+            static_cast<u8>(m_uncompressed_size),
+            static_cast<u8>(m_uncompressed_size >> 8),
+            static_cast<u8>(m_uncompressed_size >> 16),
+            static_cast<u8>(m_uncompressed_size >> 24),
+        };
+        TRY(m_stream->write_until_depleted(bytes));
+    }
+
+    return {};
+}
+
+ErrorOr<void> GenericZlibCompressor::deflate_into_stream(ReadonlyBytes bytes, int flush)
 {
     m_zstream->avail_in = bytes.size();
     m_zstream->next_in = const_cast<u8*>(bytes.data());
@@ -166,7 +297,7 @@ ErrorOr<size_t> GenericZlibCompressor::write_some(ReadonlyBytes bytes)
         m_zstream->avail_out = m_buffer.size();
         m_zstream->next_out = m_buffer.data();
 
-        auto ret = deflate(m_zstream, Z_NO_FLUSH);
+        auto ret = deflate(m_zstream, flush);
         if (ret != Z_OK && ret != Z_BUF_ERROR)
             return handle_zlib_error(ret);
 
@@ -175,6 +306,144 @@ ErrorOr<size_t> GenericZlibCompressor::write_some(ReadonlyBytes bytes)
     } while (m_zstream->avail_out == 0);
 
     VERIFY(m_zstream->avail_in == 0);
+    return {};
+}
+
+// Compresses a block into raw deflate data that ends on a byte boundary, so that blocks can simply be concatenated.
+static ErrorOr<ByteBuffer> compress_block(ReadonlyBytes input, ReadonlyBytes dictionary, int level)
+{
+    z_stream zstream {};
+    if (auto ret = deflateInit2(&zstream, level, Z_DEFLATED, -MAX_WBITS, MAX_MEM_LEVEL, Z_DEFAULT_STRATEGY); ret != Z_OK)
+        return handle_zlib_error(ret);
+    ScopeGuard guard = [&] { deflateEnd(&zstream); };
+
+    if (!dictionary.is_empty()) {
+        if (auto ret = deflateSetDictionary(&zstream, dictionary.data(), dictionary.size()); ret != Z_OK)
+            return handle_zlib_error(ret);
+    }
+
+    // NOTE: A sync flush appends an empty stored block of at most 5 bytes, plus up to 7 bits of padding.
+    ByteBuffer output;
+    TRY(output.try_resize(deflateBound(&zstream, input.size()) + 6));
+
+    zstream.next_in = const_cast<u8*>(input.data());
+    zstream.avail_in = input.size();
+
+    size_t output_size = 0;
+    do {
+        if (output_size == output.size())
+            TRY(output.try_resize(output.size() * 2));
+
+        zstream.next_out = output.data() + output_size;
+        zstream.avail_out = output.size() - output_size;
+
+        auto ret = deflate(&zstream, Z_SYNC_FLUSH);
+        if (ret != Z_OK && ret != Z_BUF_ERROR)
+            return handle_zlib_error(ret);
+
+        output_size = output.size() - zstream.avail_out;
+    } while (zstream.avail_out == 0);
+
+    output.resize(output_size);
+    return output;
+}
+
+ErrorOr<void> GenericZlibCompressor::compress_in_parallel(ReadonlyBytes bytes)
+{
+    // Everything we have compressed so far has to end on a byte boundary, so that the blocks can follow it.
+    TRY(deflate_into_stream({}, Z_SYNC_FLUSH));
+
+    struct Block {
+        ReadonlyBytes input;
+        ReadonlyBytes dictionary;
+        Optional<ErrorOr<ByteBuffer>> output;
+    };
+
+    Vector<Block> blocks;
+    TRY(blocks.try_ensure_capacity(ceil_div(bytes.size(), parallel_compression_block_size)));
+
+    for (size_t offset = 0; offset < bytes.size(); offset += parallel_compression_block_size) {
+        auto input = bytes.slice(offset, min(parallel_compression_block_size, bytes.size() - offset));
+        auto dictionary = offset == 0 ? m_window.bytes() : bytes.slice(offset - window_size, window_size);
+        blocks.unchecked_append({ input, dictionary, {} });
+    }
+
+    auto level = zlib_compression_level(m_compression_level);
+    Atomic<size_t> next_block_index { 0 };
+
+    auto compress_blocks = [&]() -> intptr_t {
+        for (auto index = next_block_index.fetch_add(1); index < blocks.size(); index = next_block_index.fetch_add(1))
+            blocks[index].output = compress_block(blocks[index].input, blocks[index].dictionary, level);
+        return 0;
+    };
+
+    // NOTE: This thread compresses blocks as well, rather than waiting idly for the others.
+    auto thread_count = min(min(static_cast<size_t>(Core::System::hardware_concurrency()), blocks.size()), maximum_parallel_compression_threads);
+
+    Vector<NonnullRefPtr<Threading::Thread>> threads;
+    for (size_t i = 1; i < thread_count; ++i) {
+        auto thread = Threading::Thread::try_create([&] { return compress_blocks(); }, "Compressor"sv);
+        if (thread.is_error())
+            break;
+        thread.value()->start();
+        threads.append(thread.release_value());
+    }
+
+    compress_blocks();
+
+    for (auto& thread : threads)
+        (void)thread->join();
+
+    for (auto& block : blocks) {
+        auto output = block.output.release_value();
+        if (output.is_error())
+            return output.release_error();
+        TRY(m_stream->write_until_depleted(output.value()));
+    }
+
+    // The stream carries on from where the blocks left off, so its matches must refer to their data rather than to what
+    // it had seen before.
+    if (auto ret = deflateReset(m_zstream); ret != Z_OK)
+        return handle_zlib_error(ret);
+
+    auto dictionary = bytes.slice(bytes.size() - window_size);
+    if (auto ret = deflateSetDictionary(m_zstream, dictionary.data(), dictionary.size()); ret != Z_OK)
+        return handle_zlib_error(ret);
+
+    return {};
+}
+
+void GenericZlibCompressor::update_window(ReadonlyBytes bytes)
+{
+    if (bytes.size() >= window_size) {
+        m_window = MUST(ByteBuffer::copy(bytes.slice(bytes.size() - window_size)));
+        return;
+    }
+
+    auto excess = (m_window.size() + bytes.size()) > window_size ? m_window.size() + bytes.size() - window_size : 0;
+    if (excess > 0) {
+        memmove(m_window.data(), m_window.data() + excess, m_window.size() - excess);
+        m_window.resize(m_window.size() - excess);
+    }
+    m_window.append(bytes);
+}
+
+ErrorOr<size_t> GenericZlibCompressor::write_some(ReadonlyBytes bytes)
+{
+    TRY(write_header_if_needed());
+
+    if (m_format == Format::Zlib)
+        m_checksum = adler32_z(m_checksum, bytes.data(), bytes.size());
+    else if (m_format == Format::Gzip)
+        m_checksum = crc32_z(m_checksum, bytes.data(), bytes.size());
+    m_uncompressed_size += static_cast<u32>(bytes.size());
+
+    if (bytes.size() >= minimum_size_for_parallel_compression && Core::System::hardware_concurrency() > 1)
+        TRY(compress_in_parallel(bytes));
+    else
+        TRY(deflate_into_stream(bytes, Z_NO_FLUSH));
+
+    update_window(bytes);
     return bytes.size();
 }
 
@@ -196,6 +465,8 @@ ErrorOr<void> GenericZlibCompressor::finish()
 {
     VERIFY(m_zstream->avail_in == 0);
 
+    TRY(write_header_if_needed());
+
     // If the parameter flush is set to Z_FINISH, pending input is processed, pending output is flushed and deflate returns with Z_STREAM_END
     // if there was enough output space. If deflate returns with Z_OK or Z_BUF_ERROR, this function must be called again with Z_FINISH
     // and more output space (updated avail_out) but no more input data, until it returns with Z_STREAM_END or an error.
@@ -209,7 +480,7 @@ ErrorOr<void> GenericZlibCompressor::finish()
             TRY(m_stream->write_until_depleted(m_buffer.span().slice(0, have)));
 
             if (ret == Z_STREAM_END)
-                return {};
+                return write_trailer();
         } else {
             return handle_zlib_error(ret);
         }
@@ -20,6 +20,8 @@ namespace Compress {
 
 enum class GenericZlibCompressionLevel : u8 {
     Fastest,
+    // The fastest level that still looks for better matches before settling for one (lazy matching).
+    Fast,
     Default,
     Best,
 };
@@ -41,6 +43,9 @@ protected:
 
     static ErrorOr<z_stream*> new_z_stream(int window_bits);
 
+    // Inflates the whole input at once, straight into the output buffer, without going through the stream interface.
+    static ErrorOr<ByteBuffer> decompress_all(ReadonlyBytes, int window_bits);
+
 private:
     MaybeOwned<Stream> m_stream;
     z_stream* m_zstream;
@@ -64,25 +69,40 @@ public:
     ErrorOr<void> finish();
 
 protected:
-    GenericZlibCompressor(AK::FixedArray<u8>, MaybeOwned<Stream>, z_stream*);
+    enum class Format : u8 {
+        Deflate,
+        Zlib,
+        Gzip,
+    };
+
+    GenericZlibCompressor(AK::FixedArray<u8>, MaybeOwned<Stream>, z_stream*, Format, GenericZlibCompressionLevel);
 
-    static ErrorOr<z_stream*> new_z_stream(int window_bits, GenericZlibCompressionLevel compression_level);
+    // NOTE: The stream always produces raw deflate data. We write the zlib or gzip header and trailer ourselves, so
+    //       that large inputs can be compressed in independent blocks on several threads and spliced into the stream.
+    static ErrorOr<z_stream*> new_z_stream(GenericZlibCompressionLevel compression_level);
 
 private:
+    ErrorOr<void> write_header_if_needed();
+    ErrorOr<void> write_trailer();
+    ErrorOr<void> deflate_into_stream(ReadonlyBytes, int flush);
+    ErrorOr<void> compress_in_parallel(ReadonlyBytes);
+    void update_window(ReadonlyBytes);
+
     MaybeOwned<Stream> m_stream;
     z_stream* m_zstream;
 
+    Format m_format;
+    GenericZlibCompressionLevel m_compression_level;
+    bool m_has_written_header { false };
+    u32 m_checksum { 0 };
+    u32 m_uncompressed_size { 0 };
+
+    // The most recent input, which the blocks that are compressed in parallel use as their dictionary.
+    ByteBuffer m_window;
+
     AK::FixedArray<u8> m_buffer;
 };
 
-template<class T>
-ErrorOr<ByteBuffer> decompress_all(ReadonlyBytes bytes)
-{
-    auto input_stream = make<AK::FixedMemoryStream>(bytes);
-    auto deflate_stream = TRY(T::create(MaybeOwned<Stream>(move(input_stream))));
-    return TRY(deflate_stream->read_until_eof(4096));
-}
-
 template<class T>
 ErrorOr<ByteBuffer> compress_all(ReadonlyBytes bytes, GenericZlibCompressionLevel compression_level)
 {
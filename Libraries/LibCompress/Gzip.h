@@ -32,8 +32,8 @@ public:
     static ErrorOr<ByteBuffer> compress_all(ReadonlyBytes, GenericZlibCompressionLevel = GenericZlibCompressionLevel::Default);
 
 private:
-    GzipCompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, z_stream* zstream)
-        : GenericZlibCompressor(move(buffer), move(stream), zstream)
+    GzipCompressor(AK::FixedArray<u8> buffer, MaybeOwned<Stream> stream, z_stream* zstream, GenericZlibCompressionLevel compression_level)
+        : GenericZlibCompressor(move(buffer), move(stream), zstream, Format::Gzip, compression_level)
     {
     }
 };
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Coroutine.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefPtr.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Notifier.h>
+#include <LibCore/Promise.h>
+
+namespace Core {
+
+// Awaitables that suspend a coroutine until something happens on an event loop, and then resume it
+// on that event loop's thread.
+
+// Suspends the coroutine and resumes it from the given event loop. This may be awaited from any
+// thread, e.g. to hop back to the main thread after doing work on a thread pool.
+inline auto resume_on(EventLoop& event_loop)
+{
+    struct Awaiter {
+        bool await_ready() const { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            event_loop.deferred_invoke([handle] { handle.resume(); });
+            event_loop.wake();
+        }
+
+        void await_resume() const { }
+
+        EventLoop& event_loop;
+    };
+
+    return Awaiter { event_loop };
+}
+
+// Suspends the coroutine until the current event loop has processed the events that are already queued.
+inline auto yield()
+{
+    return resume_on(EventLoop::current());
+}
+
+// Suspends the coroutine until the file descriptor is ready for the given kind of notification.
+inline auto wait_for(int fd, NotificationType type)
+{
+    struct Awaiter {
+        bool await_ready() const { return false; }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            notifier = Notifier::construct(fd, type);
+            notifier->on_activation = [this, handle] {
+                notifier->set_enabled(false);
+                handle.resume();
+            };
+        }
+
+        void await_resume()
+        {
+            notifier = nullptr;
+        }
+
+        int fd { -1 };
+        NotificationType type { NotificationType::None };
+
+        // Destroying the awaiting coroutine while it is suspended also destroys the notifier, so the
+        // handle can never be resumed after the fact.
+        RefPtr<Notifier> notifier;
+    };
+
+    return Awaiter { fd, type, {} };
+}
+
+inline auto wait_for_readable(int fd)
+{
+    return wait_for(fd, NotificationType::Read);
+}
+
+inline auto wait_for_writable(int fd)
+{
+    return wait_for(fd, NotificationType::Write);
+}
+
+// Suspends the coroutine until the promise is resolved or rejected, and yields its result.
+template<typename Result, typename ErrorType>
+auto operator co_await(NonnullRefPtr<Promise<Result, ErrorType>> promise)
+{
+    struct Awaiter {
+        bool await_ready() const { return promise->is_resolved() || promise->is_rejected(); }
+
+        void await_suspend(std::coroutine_handle<> handle)
+        {
+            promise->when_resolved([handle](Result&) { handle.resume(); });
+            promise->when_rejected([handle](ErrorType&) { handle.resume(); });
+        }
+
+        ErrorOr<Result, ErrorType> await_resume()
+        {
+            promise->on_resolution = nullptr;
+            promise->on_rejection = nullptr;
+            return promise->await();
+        }
+
+        NonnullRefPtr<Promise<Result, ErrorType>> promise;
+    };
+
+    return Awaiter { move(promise) };
+}
+
+}
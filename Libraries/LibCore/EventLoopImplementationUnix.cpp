@@ -20,6 +20,11 @@
 #include <sys/select.h>
 #include <unistd.h>
 
+#if defined(AK_OS_LINUX) && !defined(AK_OS_ANDROID)
+#    define EVENT_LOOP_HAS_EPOLL
+#    include <sys/epoll.h>
+#endif
+
 namespace Core {
 
 namespace {
@@ -48,6 +53,36 @@ bool has_flag(int value, int flag)
     return (value & flag) == flag;
 }
 
+#ifdef EVENT_LOOP_HAS_EPOLL
+u32 notification_type_to_epoll_events(NotificationType type)
+{
+    u32 events = 0;
+    if (has_flag(type, NotificationType::Read))
+        events |= EPOLLIN;
+    if (has_flag(type, NotificationType::Write))
+        events |= EPOLLOUT;
+    return events;
+}
+
+NotificationType epoll_events_to_notification_type(u32 events)
+{
+    NotificationType type = NotificationType::None;
+    if (has_flag(events, EPOLLIN))
+        type |= NotificationType::Read;
+    if (has_flag(events, EPOLLOUT))
+        type |= NotificationType::Write;
+    if (has_flag(events, EPOLLHUP))
+        type |= NotificationType::HangUp;
+    if (has_flag(events, EPOLLERR))
+        type |= NotificationType::Error;
+    return type;
+}
+#endif
+
+// Timers may fire up to this much later than they are due, so that the event loop can wake up once for several timers
+// that expire around the same time, rather than once for each of them.
+static constexpr AK::Duration maximum_timer_slack = AK::Duration::from_milliseconds(4);
+
 class EventLoopTimeout {
 public:
     static constexpr ssize_t INVALID_INDEX = NumericLimits<ssize_t>::max();
@@ -59,6 +94,9 @@ public:
 
     MonotonicTime fire_time() const { return m_fire_time; }
 
+    // How much later than its fire time this timeout may fire.
+    virtual AK::Duration slack() const { return {}; }
+
     void absolutize(Badge<TimeoutSet>, MonotonicTime current_time)
     {
         m_fire_time = current_time + m_duration;
@@ -83,10 +121,13 @@ class TimeoutSet {
 public:
     TimeoutSet() = default;
 
-    Optional<MonotonicTime> next_timer_expiration()
+    // The time at which the event loop next has to wake up. This is delayed by the slack of the next timeout, so any
+    // timeouts that expire in the meantime are fired by the same wake-up.
+    Optional<MonotonicTime> next_wake_time()
     {
         if (!m_heap.is_empty()) {
-            return m_heap.peek_min()->fire_time();
+            auto const& timeout = *m_heap.peek_min();
+            return timeout.fire_time() + timeout.slack();
         } else {
             return {};
         }
@@ -175,6 +216,12 @@ public:
 
     void reload(MonotonicTime const& now) { m_fire_time = now + interval; }
 
+    // Timers with short intervals tend to drive animations and the like, so their slack is kept proportionally small.
+    virtual AK::Duration slack() const override
+    {
+        return min(AK::Duration::from_nanoseconds(interval.to_nanoseconds() / 16), maximum_timer_slack);
+    }
+
     virtual void fire(TimeoutSet& timeout_set, MonotonicTime current_time) override
     {
         auto strong_owner = owner.strong_ref();
@@ -255,11 +302,18 @@ struct ThreadData {
     ThreadData()
     {
         pid = getpid();
+#ifdef EVENT_LOOP_HAS_EPOLL
+        initialize_epoll();
+#endif
         initialize_wake_pipe();
     }
 
     ~ThreadData()
     {
+#ifdef EVENT_LOOP_HAS_EPOLL
+        if (epoll_fd != -1)
+            close(epoll_fd);
+#endif
         pthread_rwlock_wrlock(&*s_thread_data_lock);
         s_thread_data.remove(s_thread_id);
         pthread_rwlock_unlock(&*s_thread_data_lock);
@@ -284,8 +338,74 @@ struct ThreadData {
         VERIFY(poll_fds.size() == 0);
         poll_fds.append({ .fd = wake_pipe_fds[0], .events = POLLIN, .revents = 0 });
         notifier_by_index.append(nullptr);
+
+#ifdef EVENT_LOOP_HAS_EPOLL
+        if (uses_epoll()) {
+            epoll_event event { .events = EPOLLIN, .data = { .fd = wake_pipe_fds[0] } };
+            if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wake_pipe_fds[0], &event) < 0)
+                fall_back_to_poll();
+        }
+#endif
     }
 
+#ifdef EVENT_LOOP_HAS_EPOLL
+    void initialize_epoll()
+    {
+        // This allows comparing the two backends, or working around problems with epoll.
+        if (getenv("LIBCORE_EVENT_LOOP_USE_POLL"))
+            return;
+
+        epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+        if (epoll_fd < 0) {
+            dbgln("EventLoopImplementationUnix: Failed to create epoll instance, falling back to poll: {}", Error::from_errno(errno));
+            epoll_fd = -1;
+        }
+    }
+
+    bool uses_epoll() const { return epoll_fd != -1; }
+
+    // The poll state is kept up to date even while we use epoll, which lets us switch over to it at any time. This is
+    // needed for file descriptors that epoll does not support, such as regular files.
+    void fall_back_to_poll()
+    {
+        dbgln("EventLoopImplementationUnix: Falling back to poll: {}", Error::from_errno(errno));
+        close(epoll_fd);
+        epoll_fd = -1;
+        epoll_notifiers.clear();
+    }
+
+    void update_epoll_registration(int fd)
+    {
+        if (!uses_epoll())
+            return;
+
+        auto it = epoll_notifiers.find(fd);
+        if (it == epoll_notifiers.end()) {
+            // NOTE: This fails if the fd has already been closed, but then the kernel has already removed it for us.
+            (void)epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+            return;
+        }
+
+        // Several notifiers may watch the same fd, but epoll only allows registering it once.
+        u32 events = 0;
+        for (auto* notifier : it->value)
+            events |= notification_type_to_epoll_events(notifier->type());
+
+        epoll_event event { .events = events, .data = { .fd = fd } };
+        auto result = epoll_ctl(epoll_fd, it->value.size() == 1 ? EPOLL_CTL_ADD : EPOLL_CTL_MOD, fd, &event);
+
+        // The fd may have been registered by a notifier whose fd was closed and then reused, without the notifier
+        // having been unregistered first.
+        if (result < 0 && errno == EEXIST)
+            result = epoll_ctl(epoll_fd, EPOLL_CTL_MOD, fd, &event);
+        else if (result < 0 && errno == ENOENT)
+            result = epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event);
+
+        if (result < 0)
+            fall_back_to_poll();
+    }
+#endif
+
     // Each thread has its own timers, notifiers and a wake pipe.
     TimeoutSet timeouts;
 
@@ -293,6 +413,12 @@ struct ThreadData {
     HashMap<Notifier*, size_t> notifier_by_ptr;
     Vector<Notifier*> notifier_by_index;
 
+#ifdef EVENT_LOOP_HAS_EPOLL
+    // With epoll, waking up only costs time proportional to the number of ready fds, rather than the number of notifiers.
+    int epoll_fd { -1 };
+    HashMap<int, Vector<Notifier*, 1>> epoll_notifiers;
+#endif
+
     // The wake pipe is used to notify another event loop that someone has called wake(), or a signal has been received.
     // wake() writes 0i32 into the pipe, signals write the signal number (guaranteed non-zero).
     Array<int, 2> wake_pipe_fds { -1, -1 };
@@ -332,8 +458,8 @@ void EventLoopImplementationUnix::quit(int code)
 
 void EventLoopImplementationUnix::post_event(EventReceiver& receiver, NonnullOwnPtr<Event>&& event)
 {
-    m_thread_event_queue.post_event(receiver, move(event));
-    if (&m_thread_event_queue != &ThreadEventQueue::current())
+    bool needs_wake = m_thread_event_queue.post_event(receiver, move(event));
+    if (needs_wake && &m_thread_event_queue != &ThreadEventQueue::current())
         wake();
 }
 
@@ -358,9 +484,9 @@ retry:
     int timeout = 0;
     bool should_wait_forever = false;
     if (mode == EventLoopImplementation::PumpMode::WaitForEvents && !has_pending_events) {
-        auto next_timer_expiration = thread_data.timeouts.next_timer_expiration();
-        if (next_timer_expiration.has_value()) {
-            auto computed_timeout = next_timer_expiration.value() - time_at_iteration_start;
+        auto next_wake_time = thread_data.timeouts.next_wake_time();
+        if (next_wake_time.has_value()) {
+            auto computed_timeout = next_wake_time.value() - time_at_iteration_start;
             if (computed_timeout.is_negative())
                 computed_timeout = AK::Duration::zero();
             i64 true_timeout = computed_timeout.to_milliseconds();
@@ -370,21 +496,9 @@ retry:
         }
     }
 
-try_select_again:
-    // select() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
-    ErrorOr<int> error_or_marked_fd_count = System::poll(thread_data.poll_fds, should_wait_forever ? -1 : timeout);
-    auto time_after_poll = MonotonicTime::now_coarse();
-    // Because POSIX, we might spuriously return from select() with EINTR; just select again.
-    if (error_or_marked_fd_count.is_error()) {
-        if (error_or_marked_fd_count.error().code() == EINTR)
-            goto try_select_again;
-        dbgln("EventLoopImplementationUnix::wait_for_events: {}", error_or_marked_fd_count.error());
-        VERIFY_NOT_REACHED();
-    }
-
     // We woke up due to a call to wake() or a POSIX signal.
-    // Handle signals and see whether we need to handle events as well.
-    if (has_flag(thread_data.poll_fds[0].revents, POLLIN)) {
+    // Handle signals and see whether we need to handle events as well, or whether we should wait again.
+    auto handle_wake_pipe = [&] {
         int wake_events[8];
         ssize_t nread;
         // We might receive another signal while read()ing here. The signal will go to the handle_signal properly,
@@ -409,7 +523,70 @@ try_select_again:
                 wake_requested = true;
         }
 
-        if (!wake_requested && nread == sizeof(wake_events))
+        return !wake_requested && nread == sizeof(wake_events);
+    };
+
+try_select_again:
+#ifdef EVENT_LOOP_HAS_EPOLL
+    if (thread_data.uses_epoll()) {
+        Array<epoll_event, 64> ready_events;
+        int ready_count = epoll_wait(thread_data.epoll_fd, ready_events.data(), ready_events.size(), should_wait_forever ? -1 : timeout);
+        auto time_after_poll = MonotonicTime::now_coarse();
+        // Because POSIX, we might spuriously return from epoll_wait() with EINTR; just wait again.
+        if (ready_count < 0) {
+            if (errno == EINTR)
+                goto try_select_again;
+            dbgln("EventLoopImplementationUnix::wait_for_events: {}", Error::from_errno(errno));
+            VERIFY_NOT_REACHED();
+        }
+
+        auto ready = ready_events.span().trim(ready_count);
+
+        for (auto const& event : ready) {
+            if (event.data.fd == thread_data.wake_pipe_fds[0] && has_flag(event.events, EPOLLIN)) {
+                if (handle_wake_pipe())
+                    goto retry;
+                break;
+            }
+        }
+
+        // Handle file system notifiers by making them normal events.
+        // NOTE: If there were more ready fds than fit into our buffer, epoll will report the rest next time around.
+        for (auto const& event : ready) {
+            if (event.data.fd == thread_data.wake_pipe_fds[0])
+                continue;
+
+            auto it = thread_data.epoll_notifiers.find(event.data.fd);
+            if (it == thread_data.epoll_notifiers.end())
+                continue;
+
+            auto ready_type = epoll_events_to_notification_type(event.events);
+            for (auto* notifier : it->value) {
+                auto type = ready_type & notifier->type();
+                if (type != NotificationType::None)
+                    ThreadEventQueue::current().post_event(*notifier, make<NotifierActivationEvent>(notifier->fd(), type));
+            }
+        }
+
+        // Handle expired timers.
+        thread_data.timeouts.fire_expired(time_after_poll);
+        return;
+    }
+#endif
+
+    // select() and wait for file system events, calls to wake(), POSIX signals, or timer expirations.
+    ErrorOr<int> error_or_marked_fd_count = System::poll(thread_data.poll_fds, should_wait_forever ? -1 : timeout);
+    auto time_after_poll = MonotonicTime::now_coarse();
+    // Because POSIX, we might spuriously return from select() with EINTR; just select again.
+    if (error_or_marked_fd_count.is_error()) {
+        if (error_or_marked_fd_count.error().code() == EINTR)
+            goto try_select_again;
+        dbgln("EventLoopImplementationUnix::wait_for_events: {}", error_or_marked_fd_count.error());
+        VERIFY_NOT_REACHED();
+    }
+
+    if (has_flag(thread_data.poll_fds[0].revents, POLLIN)) {
+        if (handle_wake_pipe())
             goto retry;
     }
 
@@ -666,6 +843,13 @@ void EventLoopManagerUnix::register_notifier(Notifier& notifier)
         .revents = 0,
     });
 
+#ifdef EVENT_LOOP_HAS_EPOLL
+    if (thread_data.uses_epoll()) {
+        thread_data.epoll_notifiers.ensure(notifier.fd()).append(&notifier);
+        thread_data.update_epoll_registration(notifier.fd());
+    }
+#endif
+
     notifier.set_owner_thread(s_thread_id);
 }
 
@@ -689,6 +873,18 @@ void EventLoopManagerUnix::unregister_notifier(Notifier& notifier)
     }
     thread_data.poll_fds.take_last();
     thread_data.notifier_by_index.take_last();
+
+#ifdef EVENT_LOOP_HAS_EPOLL
+    if (thread_data.uses_epoll()) {
+        auto epoll_it = thread_data.epoll_notifiers.find(notifier.fd());
+        if (epoll_it != thread_data.epoll_notifiers.end()) {
+            epoll_it->value.remove_first_matching([&](auto* other) { return other == &notifier; });
+            if (epoll_it->value.is_empty())
+                thread_data.epoll_notifiers.remove(epoll_it);
+        }
+        thread_data.update_epoll_registration(notifier.fd());
+    }
+#endif
 }
 
 void EventLoopManagerUnix::did_post_event()
@@ -152,8 +152,8 @@ void EventLoopImplementationWindows::quit(int code)
 
 void EventLoopImplementationWindows::post_event(EventReceiver& receiver, NonnullOwnPtr<Event>&& event)
 {
-    m_thread_event_queue.post_event(receiver, move(event));
-    if (&m_thread_event_queue != &ThreadEventQueue::current())
+    bool needs_wake = m_thread_event_queue.post_event(receiver, move(event));
+    if (needs_wake && &m_thread_event_queue != &ThreadEventQueue::current())
         wake();
 }
 
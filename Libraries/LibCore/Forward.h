@@ -27,6 +27,7 @@ class File;
 class LocalServer;
 class LocalSocket;
 class MappedFile;
+class MemoryPressureWatcher;
 class MimeData;
 class NetworkJob;
 class NetworkResponse;
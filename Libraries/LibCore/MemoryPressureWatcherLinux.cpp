@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/GenericLexer.h>
+#include <AK/Platform.h>
+#include <LibCore/File.h>
+#include <LibCore/MemoryPressureWatcher.h>
+#include <LibCore/Timer.h>
+
+#if !defined(AK_OS_LINUX)
+static_assert(false, "This file must only be used for Linux");
+#endif
+
+namespace Core {
+
+// Pressure stall information (PSI) reports the share of time in which some task was stalled waiting for memory. The
+// kernel only lets unprivileged processes register PSI triggers with long windows, so we simply sample the averages.
+static constexpr auto pressure_file = "/proc/pressure/memory"sv;
+static constexpr int sample_interval_ms = 5'000;
+static constexpr double pressure_threshold_percent = 10.0;
+
+// Parses the 10-second average of the "some" line, e.g.: some avg10=1.23 avg60=0.50 avg300=0.10 total=123456
+static Optional<double> parse_some_avg10(StringView contents)
+{
+    GenericLexer lexer { contents };
+
+    if (!lexer.consume_specific("some "sv))
+        return {};
+    if (!lexer.consume_specific("avg10="sv))
+        return {};
+
+    return lexer.consume_until(' ').to_number<double>();
+}
+
+class MemoryPressureWatcherImpl final : public MemoryPressureWatcher {
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureWatcherImpl>> create()
+    {
+        auto file = TRY(File::open(pressure_file, File::OpenMode::Read));
+        return adopt_own(*new MemoryPressureWatcherImpl(move(file)));
+    }
+
+private:
+    explicit MemoryPressureWatcherImpl(NonnullOwnPtr<File> file)
+        : m_file(move(file))
+    {
+        m_timer = Timer::create_repeating(sample_interval_ms, [this] { sample(); });
+        m_timer->start();
+    }
+
+    void sample()
+    {
+        if (m_file->seek(0, SeekMode::SetPosition).is_error())
+            return;
+
+        auto contents = m_file->read_until_eof();
+        if (contents.is_error())
+            return;
+
+        auto average = parse_some_avg10(StringView { contents.value() });
+        if (!average.has_value())
+            return;
+
+        // Only notify once per episode of memory pressure, rather than on every sample while it lasts.
+        auto is_under_pressure = *average >= pressure_threshold_percent;
+        if (is_under_pressure && !m_was_under_pressure && on_memory_pressure)
+            on_memory_pressure();
+
+        m_was_under_pressure = is_under_pressure;
+    }
+
+    NonnullOwnPtr<File> m_file;
+    RefPtr<Timer> m_timer;
+    bool m_was_under_pressure { false };
+};
+
+ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> MemoryPressureWatcher::create()
+{
+    return MemoryPressureWatcherImpl::create();
+}
+
+}
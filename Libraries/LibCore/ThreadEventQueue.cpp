@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/Vector.h>
 #include <LibCore/DeferredInvocationContext.h>
 #include <LibCore/EventLoopImplementation.h>
@@ -16,26 +17,80 @@
 
 namespace Core {
 
-struct ThreadEventQueue::Private {
-    struct QueuedEvent {
-        AK_MAKE_NONCOPYABLE(QueuedEvent);
-        AK_MAKE_DEFAULT_MOVABLE(QueuedEvent);
-
-    public:
-        QueuedEvent(EventReceiver& receiver, NonnullOwnPtr<Event> event)
-            : receiver(receiver)
-            , event(move(event))
-        {
+// Events are queued in intrusive nodes on a lock-free stack. Posting threads push nodes onto it,
+// and the owning thread takes the whole stack at once and processes it in posting order.
+struct QueuedEvent {
+    QueuedEvent* next { nullptr };
+    WeakPtr<EventReceiver> receiver;
+    OwnPtr<Event> event;
+};
+
+// Processed nodes are recycled through a process-wide free list. The owning thread of a queue pushes
+// the nodes of every batch it has processed, and posting threads take the whole list at once into a
+// thread-local cache. Nothing ever pops a single node off the shared list, so it is not prone to ABA.
+static constexpr size_t max_free_queued_events = 1024;
+static Atomic<QueuedEvent*> s_free_queued_events { nullptr };
+static Atomic<size_t> s_free_queued_event_count { 0 };
+
+struct QueuedEventCache {
+    ~QueuedEventCache()
+    {
+        while (nodes) {
+            auto* next = nodes->next;
+            delete nodes;
+            nodes = next;
         }
+    }
+
+    QueuedEvent* nodes { nullptr };
+};
 
-        ~QueuedEvent() = default;
+static thread_local QueuedEventCache s_queued_event_cache;
 
-        WeakPtr<EventReceiver> receiver;
-        NonnullOwnPtr<Event> event;
-    };
+static QueuedEvent* allocate_queued_event()
+{
+    auto& cache = s_queued_event_cache.nodes;
+
+    if (!cache) {
+        cache = s_free_queued_events.exchange(nullptr, AK::MemoryOrder::memory_order_acquire);
+        if (cache)
+            s_free_queued_event_count.store(0, AK::MemoryOrder::memory_order_relaxed);
+    }
+
+    if (!cache)
+        return new QueuedEvent;
+
+    auto* node = cache;
+    cache = node->next;
+    node->next = nullptr;
+    return node;
+}
+
+static void recycle_queued_events(QueuedEvent* first, QueuedEvent* last, size_t count)
+{
+    // The count is only approximate, as posting threads reset it when taking the list. It just keeps
+    // a burst of events from growing the free list without bounds.
+    if (s_free_queued_event_count.fetch_add(count, AK::MemoryOrder::memory_order_relaxed) + count > max_free_queued_events) {
+        s_free_queued_event_count.fetch_sub(count, AK::MemoryOrder::memory_order_relaxed);
+        while (first) {
+            auto* next = first->next;
+            delete first;
+            first = next;
+        }
+        return;
+    }
+
+    auto* head = s_free_queued_events.load(AK::MemoryOrder::memory_order_relaxed);
+    do {
+        last->next = head;
+    } while (!s_free_queued_events.compare_exchange_strong(head, first, AK::MemoryOrder::memory_order_acq_rel));
+}
+
+struct ThreadEventQueue::Private {
+    // Most recently posted event first.
+    Atomic<QueuedEvent*> incoming_events { nullptr };
 
     Threading::Mutex mutex;
-    Vector<QueuedEvent> queued_events;
     Vector<NonnullRefPtr<Promise<NonnullRefPtr<EventReceiver>>>, 16> pending_promises;
     bool warned_promise_count { false };
 };
@@ -65,15 +120,34 @@ ThreadEventQueue::ThreadEventQueue()
 {
 }
 
-ThreadEventQueue::~ThreadEventQueue() = default;
-
-void ThreadEventQueue::post_event(Core::EventReceiver& receiver, NonnullOwnPtr<Core::Event> event)
+ThreadEventQueue::~ThreadEventQueue()
 {
-    {
-        Threading::MutexLocker lock(m_private->mutex);
-        m_private->queued_events.empend(receiver, move(event));
+    auto* node = m_private->incoming_events.exchange(nullptr, AK::MemoryOrder::memory_order_acquire);
+    while (node) {
+        auto* next = node->next;
+        delete node;
+        node = next;
     }
+}
+
+bool ThreadEventQueue::post_event(Core::EventReceiver& receiver, NonnullOwnPtr<Core::Event> event)
+{
+    auto* node = allocate_queued_event();
+    node->receiver = receiver;
+    node->event = move(event);
+
+    auto* head = m_private->incoming_events.load(AK::MemoryOrder::memory_order_relaxed);
+    do {
+        node->next = head;
+    } while (!m_private->incoming_events.compare_exchange_strong(head, node, AK::MemoryOrder::memory_order_acq_rel));
+
+    // Only the first event of a batch needs to notify the event loop. Everything posted after it is
+    // picked up by the same call to process().
+    if (head != nullptr)
+        return false;
+
     Core::EventLoopManager::the().did_post_event();
+    return true;
 }
 
 void ThreadEventQueue::add_job(NonnullRefPtr<Promise<NonnullRefPtr<EventReceiver>>> promise)
@@ -93,36 +167,49 @@ void ThreadEventQueue::cancel_all_pending_jobs()
 
 size_t ThreadEventQueue::process()
 {
-    decltype(m_private->queued_events) events;
     {
         Threading::MutexLocker locker(m_private->mutex);
-        events = move(m_private->queued_events);
         m_private->pending_promises.remove_all_matching([](auto& job) { return job->is_resolved() || job->is_rejected(); });
     }
 
+    // Take every event posted so far, and put them back into posting order.
+    QueuedEvent* events = nullptr;
+    QueuedEvent* last_event = nullptr;
+    for (auto* node = m_private->incoming_events.exchange(nullptr, AK::MemoryOrder::memory_order_acquire); node;) {
+        auto* next = node->next;
+        node->next = events;
+        events = node;
+        if (!last_event)
+            last_event = node;
+        node = next;
+    }
+
     size_t processed_events = 0;
-    for (size_t i = 0; i < events.size(); ++i) {
-        auto& queued_event = events.at(i);
-        auto receiver = queued_event.receiver.strong_ref();
-        auto& event = *queued_event.event;
+    for (auto* queued_event = events; queued_event; queued_event = queued_event->next) {
+        auto receiver = queued_event->receiver.strong_ref();
+        auto event = queued_event->event.release_nonnull();
+        queued_event->receiver = nullptr;
 
         if (!receiver) {
-            switch (event.type()) {
+            switch (event->type()) {
             case Event::Quit:
                 VERIFY_NOT_REACHED();
             default:
                 // Receiver disappeared, drop the event on the floor.
                 break;
             }
-        } else if (event.type() == Event::Type::DeferredInvoke) {
-            static_cast<DeferredInvocationEvent&>(event).m_invokee();
+        } else if (event->type() == Event::Type::DeferredInvoke) {
+            static_cast<DeferredInvocationEvent&>(*event).m_invokee();
         } else {
             NonnullRefPtr<EventReceiver> protector(*receiver);
-            receiver->dispatch_event(event);
+            receiver->dispatch_event(*event);
         }
         ++processed_events;
     }
 
+    if (events)
+        recycle_queued_events(events, last_event, processed_events);
+
     {
         Threading::MutexLocker locker(m_private->mutex);
         if (m_private->pending_promises.size() > 30 && !m_private->warned_promise_count) {
@@ -135,8 +222,7 @@ size_t ThreadEventQueue::process()
 
 bool ThreadEventQueue::has_pending_events() const
 {
-    Threading::MutexLocker locker(m_private->mutex);
-    return !m_private->queued_events.is_empty();
+    return m_private->incoming_events.load(AK::MemoryOrder::memory_order_acquire) != nullptr;
 }
 
 }
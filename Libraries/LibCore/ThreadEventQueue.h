@@ -24,8 +24,10 @@ public:
     // Process all queued events. Returns the number of events that were processed.
     size_t process();
 
-    // Posts an event to the event queue.
-    void post_event(EventReceiver& receiver, NonnullOwnPtr<Event>);
+    // Posts an event to the event queue. This may be called from any thread.
+    // Returns true if this is the first event queued since the last call to process(), in which case the
+    // owning event loop needs to be woken up. Otherwise, a wake-up for the current batch is already pending.
+    bool post_event(EventReceiver& receiver, NonnullOwnPtr<Event>);
 
     // Used by Threading::BackgroundAction.
     void add_job(NonnullRefPtr<Promise<NonnullRefPtr<EventReceiver>>>);
@@ -61,8 +61,12 @@ public:
             }
         }
 
-        if (m_cached_records.is_empty() && m_request_done)
+        if (m_cached_records.is_empty() && m_request_done) {
+            // A negative answer is kept around for as long as the zone told us to.
+            if (m_negative_answer_expiration.has_value() && m_negative_answer_expiration.value() >= now)
+                return;
             m_valid = false;
+        }
     }
 
     void add_record(Messages::ResourceRecord record)
@@ -95,6 +99,13 @@ public:
     void will_add_record_of_type(Messages::ResourceType type) { m_desired_types.set(type); }
     void finished_request() { m_request_done = true; }
 
+    // https://www.rfc-editor.org/rfc/rfc2308#section-5
+    void set_negative_answer_ttl(u32 ttl)
+    {
+        m_valid = true;
+        m_negative_answer_expiration = Core::DateTime::from_timestamp(Core::DateTime::now().timestamp() + ttl);
+    }
+
     void set_id(u16 id) { m_id = id; }
     u16 id() { return m_id; }
 
@@ -111,6 +122,7 @@ private:
         Optional<Core::DateTime> expiration;
     };
     Vector<RecordWithExpiration> m_cached_records;
+    Optional<Core::DateTime> m_negative_answer_expiration;
     HashTable<Messages::ResourceType> m_desired_types;
     u16 m_id { 0 };
 };
@@ -426,6 +438,30 @@ public:
     }
 
 private:
+    // https://www.rfc-editor.org/rfc/rfc2308#section-5
+    static Optional<u32> negative_answer_ttl(Messages::Message const& message)
+    {
+        // NOTE: Server failures say nothing about the name, so they must not be cached.
+        auto response_code = message.header.options.response_code();
+        if (response_code != Messages::Options::ResponseCode::NoError && response_code != Messages::Options::ResponseCode::NameError)
+            return {};
+        if (!message.answers.is_empty())
+            return {};
+
+        // Negative responses without SOA records SHOULD NOT be cached.
+        for (auto const& record : message.authorities) {
+            if (auto const* soa = record.record.get_pointer<Messages::Records::SOA>()) {
+                // The TTL of this record is set from the minimum of the MINIMUM field of the SOA record and the TTL
+                // of the SOA itself.
+                // NOTE: We cap this, so that a name that was just created can't stay "missing" for hours.
+                static constexpr u32 maximum_negative_answer_ttl = 300;
+                return min(min(record.ttl, soa->minimum), maximum_negative_answer_ttl);
+            }
+        }
+
+        return {};
+    }
+
     ErrorOr<Messages::Message> parse_one_message()
     {
         if (m_mode == ConnectionMode::UDP)
@@ -467,6 +503,8 @@ private:
                 lookup->repeat_timer->stop();
 
                 auto result = lookup->result.strong_ref();
+                if (auto ttl = negative_answer_ttl(message); ttl.has_value())
+                    result->set_negative_answer_ttl(*ttl);
                 for (auto& record : message.answers)
                     result->add_record(move(record));
 
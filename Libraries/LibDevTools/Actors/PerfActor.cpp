@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/QuickSort.h>
+#include <LibDevTools/Actors/PerfActor.h>
+#include <LibDevTools/DevToolsDelegate.h>
+#include <LibDevTools/DevToolsServer.h>
+
+namespace DevTools {
+
+NonnullRefPtr<PerfActor> PerfActor::create(DevToolsServer& devtools, String name)
+{
+    return adopt_ref(*new PerfActor(devtools, move(name)));
+}
+
+PerfActor::PerfActor(DevToolsServer& devtools, String name)
+    : Actor(devtools, move(name))
+{
+}
+
+PerfActor::~PerfActor() = default;
+
+void PerfActor::handle_message(Message const& message)
+{
+    JsonObject response;
+
+    if (message.type == "startProfiler"sv) {
+        if (m_profiled_tabs.is_empty()) {
+            m_profiled_tabs = devtools().delegate().tab_list();
+
+            for (auto const& tab : m_profiled_tabs)
+                devtools().delegate().start_javascript_profiler(tab);
+        }
+
+        response.set("value"sv, true);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "stopProfilerAndDiscard"sv) {
+        for (auto const& tab : m_profiled_tabs)
+            devtools().delegate().stop_javascript_profiler(tab, [](auto) { });
+        m_profiled_tabs.clear();
+
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "getProfileAndStopProfiler"sv) {
+        auto tabs = move(m_profiled_tabs);
+
+        m_received_profiles.clear();
+        m_pending_profile_count = tabs.size();
+
+        if (tabs.is_empty()) {
+            received_profile(message.id, {}, AK::Error::from_string_literal("The profiler is not running"));
+            return;
+        }
+
+        for (auto const& tab : tabs) {
+            devtools().delegate().stop_javascript_profiler(tab, [weak_self = make_weak_ptr<PerfActor>(), message_id = message.id, title = tab.title](ErrorOr<JsonValue> profile) mutable {
+                if (auto self = weak_self.strong_ref())
+                    self->received_profile(message_id, move(title), move(profile));
+            });
+        }
+
+        return;
+    }
+
+    if (message.type == "isActive"sv) {
+        response.set("value"sv, !m_profiled_tabs.is_empty());
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "isSupportedPlatform"sv) {
+        response.set("value"sv, true);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "isLockedForPrivateBrowsing"sv) {
+        response.set("value"sv, false);
+        send_response(message, move(response));
+        return;
+    }
+
+    if (message.type == "getSupportedFeatures"sv) {
+        response.set("value"sv, JsonArray {});
+        send_response(message, move(response));
+        return;
+    }
+
+    send_unrecognized_packet_type_error(message);
+}
+
+// Combines the .cpuprofile of every profiled tab into one, with each tab's call tree below a node named after the tab.
+static JsonObject merge_profiles(ReadonlySpan<PerfActor::TabProfile> profiles)
+{
+    struct TimedSample {
+        i64 time { 0 };
+        i64 node_id { 0 };
+    };
+    Vector<TimedSample> samples;
+
+    JsonArray nodes;
+    JsonArray root_children;
+    i64 next_node_id = 2;
+
+    Optional<i64> start_time;
+    Optional<i64> end_time;
+
+    for (auto const& [title, profile] : profiles) {
+        auto profile_nodes = profile.get_array("nodes"sv);
+        if (!profile_nodes.has_value() || profile_nodes->is_empty())
+            continue;
+
+        // The profile's own root has id 1, so this moves it to the id right after the previous profile's last node.
+        auto id_offset = next_node_id - 1;
+
+        profile_nodes->for_each([&](JsonValue const& value) {
+            auto node = value.as_object();
+            auto id = node.get_integer<i64>("id"sv).value_or(0);
+
+            JsonArray children;
+            if (auto original_children = node.get_array("children"sv); original_children.has_value()) {
+                original_children->for_each([&](JsonValue const& child) {
+                    children.must_append(child.get_integer<i64>().value_or(0) + id_offset);
+                });
+            }
+
+            node.set("id"sv, id + id_offset);
+            node.set("children"sv, move(children));
+
+            if (id == 1) {
+                if (auto call_frame = node.get_object("callFrame"sv); call_frame.has_value()) {
+                    auto renamed_call_frame = *call_frame;
+                    renamed_call_frame.set("functionName"sv, title);
+                    node.set("callFrame"sv, move(renamed_call_frame));
+                }
+                root_children.must_append(id + id_offset);
+            }
+
+            nodes.must_append(move(node));
+        });
+
+        next_node_id += static_cast<i64>(profile_nodes->size());
+
+        auto profile_start_time = profile.get_integer<i64>("startTime"sv).value_or(0);
+        auto profile_end_time = profile.get_integer<i64>("endTime"sv).value_or(profile_start_time);
+        start_time = start_time.has_value() ? min(*start_time, profile_start_time) : profile_start_time;
+        end_time = end_time.has_value() ? max(*end_time, profile_end_time) : profile_end_time;
+
+        auto profile_samples = profile.get_array("samples"sv);
+        auto profile_time_deltas = profile.get_array("timeDeltas"sv);
+        if (!profile_samples.has_value() || !profile_time_deltas.has_value())
+            continue;
+
+        auto time = profile_start_time;
+        for (size_t i = 0; i < min(profile_samples->size(), profile_time_deltas->size()); ++i) {
+            time += profile_time_deltas->at(i).get_integer<i64>().value_or(0);
+            samples.append({ time, profile_samples->at(i).get_integer<i64>().value_or(0) + id_offset });
+        }
+    }
+
+    JsonObject call_frame;
+    call_frame.set("functionName"sv, "(root)"sv);
+    call_frame.set("scriptId"sv, "0"sv);
+    call_frame.set("url"sv, ""sv);
+    call_frame.set("lineNumber"sv, -1);
+    call_frame.set("columnNumber"sv, -1);
+
+    JsonObject root;
+    root.set("id"sv, 1);
+    root.set("callFrame"sv, move(call_frame));
+    root.set("hitCount"sv, 0);
+    root.set("children"sv, move(root_children));
+
+    JsonArray merged_nodes;
+    merged_nodes.must_append(move(root));
+    nodes.for_each([&](JsonValue const& node) { merged_nodes.must_append(node); });
+
+    quick_sort(samples, [](auto const& a, auto const& b) { return a.time < b.time; });
+
+    JsonArray merged_samples;
+    JsonArray merged_time_deltas;
+    auto previous_time = start_time.value_or(0);
+
+    for (auto const& sample : samples) {
+        merged_samples.must_append(sample.node_id);
+        merged_time_deltas.must_append(sample.time - previous_time);
+        previous_time = sample.time;
+    }
+
+    JsonObject merged_profile;
+    merged_profile.set("nodes"sv, move(merged_nodes));
+    merged_profile.set("startTime"sv, start_time.value_or(0));
+    merged_profile.set("endTime"sv, end_time.value_or(0));
+    merged_profile.set("samples"sv, move(merged_samples));
+    merged_profile.set("timeDeltas"sv, move(merged_time_deltas));
+    return merged_profile;
+}
+
+void PerfActor::received_profile(u64 message_id, String title, ErrorOr<JsonValue> profile)
+{
+    if (profile.is_error())
+        dbgln_if(DEVTOOLS_DEBUG, "Unable to retrieve JavaScript profile: {}", profile.error());
+    else if (profile.value().is_object())
+        m_received_profiles.append({ move(title), move(profile.value().as_object()) });
+
+    if (m_pending_profile_count > 0)
+        --m_pending_profile_count;
+    if (m_pending_profile_count > 0)
+        return;
+
+    JsonObject response;
+    response.set("profile"sv, merge_profiles(m_received_profiles));
+    m_received_profiles.clear();
+
+    send_response({ .id = message_id }, move(response));
+}
+
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/JsonObject.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Vector.h>
+#include <LibDevTools/Actor.h>
+#include <LibDevTools/Actors/TabActor.h>
+
+namespace DevTools {
+
+class PerfActor final : public Actor {
+public:
+    static constexpr auto base_name = "perf"sv;
+
+    static NonnullRefPtr<PerfActor> create(DevToolsServer&, String name);
+    virtual ~PerfActor() override;
+
+    struct TabProfile {
+        String title;
+        JsonObject profile;
+    };
+
+private:
+    PerfActor(DevToolsServer&, String name);
+
+    virtual void handle_message(Message const&) override;
+
+    void received_profile(u64 message_id, String title, ErrorOr<JsonValue>);
+
+    Vector<TabDescription> m_profiled_tabs;
+
+    Vector<TabProfile> m_received_profiles;
+    size_t m_pending_profile_count { 0 };
+};
+
+}
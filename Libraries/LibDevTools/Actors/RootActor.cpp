@@ -6,6 +6,7 @@
 
 #include <AK/JsonObject.h>
 #include <LibDevTools/Actors/DeviceActor.h>
+#include <LibDevTools/Actors/PerfActor.h>
 #include <LibDevTools/Actors/PreferenceActor.h>
 #include <LibDevTools/Actors/ProcessActor.h>
 #include <LibDevTools/Actors/RootActor.h>
@@ -56,6 +57,8 @@ void RootActor::handle_message(Message const& message)
         for (auto const& actor : devtools().actor_registry()) {
             if (is<DeviceActor>(*actor.value))
                 response.set("deviceActor"sv, actor.key);
+            else if (is<PerfActor>(*actor.value))
+                response.set("perfActor"sv, actor.key);
             else if (is<PreferenceActor>(*actor.value))
                 response.set("preferenceActor"sv, actor.key);
         }
@@ -74,6 +74,10 @@ public:
     virtual void listen_for_console_messages(TabDescription const&, OnConsoleMessageAvailable, OnReceivedConsoleMessages) const { }
     virtual void stop_listening_for_console_messages(TabDescription const&) const { }
     virtual void request_console_messages(TabDescription const&, i32) const { }
+
+    using OnJavaScriptProfileReceived = Function<void(ErrorOr<JsonValue>)>;
+    virtual void start_javascript_profiler(TabDescription const&) const { }
+    virtual void stop_javascript_profiler(TabDescription const&, OnJavaScriptProfileReceived) const { }
 };
 
 }
@@ -11,6 +11,7 @@
 #include <LibCore/Socket.h>
 #include <LibCore/TCPServer.h>
 #include <LibDevTools/Actors/DeviceActor.h>
+#include <LibDevTools/Actors/PerfActor.h>
 #include <LibDevTools/Actors/PreferenceActor.h>
 #include <LibDevTools/Actors/ProcessActor.h>
 #include <LibDevTools/Actors/TabActor.h>
@@ -77,6 +78,7 @@ ErrorOr<void> DevToolsServer::on_new_client()
     m_root_actor = register_actor<RootActor>();
 
     register_actor<DeviceActor>();
+    register_actor<PerfActor>();
     register_actor<PreferenceActor>();
     register_actor<ProcessActor>(ProcessDescription { .is_parent = true });
 
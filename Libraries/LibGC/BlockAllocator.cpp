@@ -5,6 +5,7 @@
  */
 
 #include <AK/Platform.h>
+#include <AK/QuickSort.h>
 #include <AK/Random.h>
 #include <AK/Vector.h>
 #include <LibGC/BlockAllocator.h>
@@ -54,31 +55,58 @@ void BlockAllocator::deallocate_block(void* block)
 {
     VERIFY(block);
 
+    ASAN_POISON_MEMORY_REGION(block, HeapBlock::block_size);
+    LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::block_size);
+    m_blocks.append(block);
+}
+
+static void release_physical_memory_for_range(void* address, size_t size)
+{
 #if defined(USE_FALLBACK_BLOCK_DEALLOCATION)
-    // If we can't use any of the nicer techniques, unmap and remap the block to return the physical pages while keeping the VM.
-    if (munmap(block, HeapBlock::block_size) < 0) {
+    // If we can't use any of the nicer techniques, unmap and remap the range to return the physical pages while keeping the VM.
+    if (munmap(address, size) < 0) {
         perror("munmap");
         VERIFY_NOT_REACHED();
     }
-    if (mmap(block, HeapBlock::block_size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE | MAP_FIXED, -1, 0) != block) {
+    if (mmap(address, size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE | MAP_FIXED, -1, 0) != address) {
         perror("mmap");
         VERIFY_NOT_REACHED();
     }
 #elif defined(MADV_FREE)
-    if (madvise(block, HeapBlock::block_size, MADV_FREE) < 0) {
+    if (madvise(address, size, MADV_FREE) < 0) {
         perror("madvise(MADV_FREE)");
         VERIFY_NOT_REACHED();
     }
 #elif defined(MADV_DONTNEED)
-    if (madvise(block, HeapBlock::block_size, MADV_DONTNEED) < 0) {
+    if (madvise(address, size, MADV_DONTNEED) < 0) {
         perror("madvise(MADV_DONTNEED)");
         VERIFY_NOT_REACHED();
     }
 #endif
+}
 
-    ASAN_POISON_MEMORY_REGION(block, HeapBlock::block_size);
-    LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::block_size);
-    m_blocks.append(block);
+void BlockAllocator::release_physical_memory(Span<void*> blocks)
+{
+    if (blocks.is_empty())
+        return;
+
+    // Blocks are only a page large, and the kernel tends to hand out neighboring addresses for consecutive mappings.
+    // Sorting the blocks lets us release each run of adjacent blocks with a single system call.
+    quick_sort(blocks);
+
+    auto run_start = reinterpret_cast<FlatPtr>(blocks[0]);
+    auto run_end = run_start + HeapBlock::block_size;
+    for (size_t i = 1; i < blocks.size(); ++i) {
+        auto block = reinterpret_cast<FlatPtr>(blocks[i]);
+        if (block == run_end) {
+            run_end += HeapBlock::block_size;
+            continue;
+        }
+        release_physical_memory_for_range(reinterpret_cast<void*>(run_start), run_end - run_start);
+        run_start = block;
+        run_end = block + HeapBlock::block_size;
+    }
+    release_physical_memory_for_range(reinterpret_cast<void*>(run_start), run_end - run_start);
 }
 
 }
@@ -17,8 +17,13 @@ public:
     ~BlockAllocator();
 
     void* allocate_block(char const* name);
+
+    // NOTE: This only returns the block to the cache. The caller is expected to pass a batch of deallocated blocks
+    //       to release_physical_memory() afterwards, before any of them can be handed out again.
     void deallocate_block(void*);
 
+    static void release_physical_memory(Span<void*> blocks);
+
 private:
     Vector<void*> m_blocks;
 };
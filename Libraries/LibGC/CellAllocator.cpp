@@ -55,4 +55,12 @@ void CellAllocator::block_did_become_usable(Badge<Heap>, HeapBlock& block)
     m_usable_blocks.append(block);
 }
 
+void CellAllocator::block_did_become_sparse(Badge<Heap>, HeapBlock& block)
+{
+    VERIFY(!block.is_full());
+    // NOTE: We allocate from the back of the usable list, so moving sparse blocks to the front fills up denser
+    //       blocks first. That gives the few cells left in a sparse block a chance to die and the block to be freed.
+    m_usable_blocks.prepend(block);
+}
+
 }
@@ -17,6 +17,7 @@ class ForeignCell;
 class RootImpl;
 class Heap;
 class HeapBlock;
+class HeapSnapshot;
 class NanBoxedValue;
 class WeakContainer;
 
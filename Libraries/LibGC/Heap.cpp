@@ -33,13 +33,8 @@ Heap::Heap(void* private_data, AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)>
     , m_gather_embedder_roots(move(gather_embedder_roots))
 {
     static_assert(HeapBlock::min_possible_cell_size <= 32, "Heap Cell tracking uses too much data!");
-    m_size_based_cell_allocators.append(make<CellAllocator>(64));
-    m_size_based_cell_allocators.append(make<CellAllocator>(96));
-    m_size_based_cell_allocators.append(make<CellAllocator>(128));
-    m_size_based_cell_allocators.append(make<CellAllocator>(256));
-    m_size_based_cell_allocators.append(make<CellAllocator>(512));
-    m_size_based_cell_allocators.append(make<CellAllocator>(1024));
-    m_size_based_cell_allocators.append(make<CellAllocator>(3072));
+    for (auto cell_size : size_classes)
+        m_size_based_cell_allocators.append(make<CellAllocator>(cell_size));
 }
 
 Heap::~Heap()
@@ -60,17 +55,54 @@ void Heap::will_allocate(size_t size)
     m_allocated_bytes_since_last_gc += size;
 }
 
-static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
+void Heap::start_sampling_allocation_sites(size_t sample_interval_in_bytes, AK::Function<String()> capture_allocation_site)
+{
+    VERIFY(sample_interval_in_bytes > 0);
+
+    m_allocation_sampler = make<AllocationSampler>();
+    m_allocation_sampler->sample_interval_in_bytes = sample_interval_in_bytes;
+    m_allocation_sampler->bytes_until_next_sample = sample_interval_in_bytes;
+    m_allocation_sampler->capture_allocation_site = move(capture_allocation_site);
+}
+
+void Heap::stop_sampling_allocation_sites()
+{
+    m_allocation_sampler = nullptr;
+}
+
+void Heap::sample_allocation(Cell& cell, size_t size)
+{
+    auto& sampler = *m_allocation_sampler;
+    if (size < sampler.bytes_until_next_sample) {
+        sampler.bytes_until_next_sample -= size;
+        return;
+    }
+    sampler.bytes_until_next_sample = sampler.sample_interval_in_bytes;
+
+    auto allocation_site = sampler.capture_allocation_site();
+    auto index = sampler.allocation_site_indices.ensure(allocation_site, [&] {
+        sampler.allocation_sites.append(allocation_site);
+        return static_cast<u32>(sampler.allocation_sites.size() - 1);
+    });
+    sampler.sampled_cells.set(&cell, index);
+}
+
+static ALWAYS_INLINE FlatPtr canonicalize_possible_pointer(FlatPtr data)
 {
     if constexpr (sizeof(FlatPtr*) == sizeof(NanBoxedValue)) {
         // Because NanBoxedValue stores pointers in non-canonical form we have to check if the top bytes
         // match any pointer-backed tag, in that case we have to extract the pointer to its
         // canonical form and add that as a possible pointer.
-        FlatPtr possible_pointer;
         if ((data & SHIFTED_IS_CELL_PATTERN) == SHIFTED_IS_CELL_PATTERN)
-            possible_pointer = NanBoxedValue::extract_pointer_bits(data);
-        else
-            possible_pointer = data;
+            return NanBoxedValue::extract_pointer_bits(data);
+    }
+    return data;
+}
+
+static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
+{
+    if constexpr (sizeof(FlatPtr*) == sizeof(NanBoxedValue)) {
+        auto possible_pointer = canonicalize_possible_pointer(data);
         if (possible_pointer < min_block_address || possible_pointer > max_block_address)
             return;
         possible_pointers.set(possible_pointer, move(origin));
@@ -111,14 +143,11 @@ static void for_each_cell_among_possible_pointers(HashTable<HeapBlock*> const& a
 
 class GraphConstructorVisitor final : public Cell::Visitor {
 public:
-    explicit GraphConstructorVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
+    explicit GraphConstructorVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
         : m_heap(heap)
+        , m_all_live_heap_blocks(all_live_heap_blocks)
     {
         m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
         m_work_queue.ensure_capacity(roots.size());
 
         for (auto& [root, root_origin] : roots) {
@@ -223,16 +252,17 @@ private:
     HashMap<FlatPtr, GraphNode> m_graph;
 
     Heap& m_heap;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
+    HashTable<HeapBlock*> const& m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
 
 AK::JsonObject Heap::dump_graph()
 {
+    auto all_live_heap_blocks = gather_all_live_heap_blocks();
     HashMap<Cell*, HeapRoot> roots;
-    gather_roots(roots);
-    GraphConstructorVisitor visitor(*this, roots);
+    gather_roots(roots, all_live_heap_blocks);
+    GraphConstructorVisitor visitor(*this, roots, all_live_heap_blocks);
     visitor.visit_all_cells();
     return visitor.dump();
 }
@@ -253,9 +283,16 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
                 m_should_gc_when_deferral_ends = true;
                 return;
             }
+            // FIXME: Every collection marks the entire heap, even though most cells that die young are never
+            //        referenced from older ones. A nursery with minor collections would need a write barrier on
+            //        every Ptr/Ref store and a remembered set of old-to-young edges. We don't have either yet,
+            //        and many cells are also written through raw pointers today.
+            // NOTE: The set of live blocks doesn't change until we start sweeping, so we build it once for both
+            //       conservative root scanning and marking.
+            auto all_live_heap_blocks = gather_all_live_heap_blocks();
             HashMap<Cell*, HeapRoot> roots;
-            gather_roots(roots);
-            mark_live_cells(roots);
+            gather_roots(roots, all_live_heap_blocks);
+            mark_live_cells(roots, all_live_heap_blocks);
         }
         finalize_unmarked_cells();
         sweep_dead_cells(print_report, collection_measurement_timer);
@@ -271,10 +308,20 @@ void Heap::enqueue_post_gc_task(AK::Function<void()> task)
     m_post_gc_tasks.append(move(task));
 }
 
-void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots)
+HashTable<HeapBlock*> Heap::gather_all_live_heap_blocks()
+{
+    HashTable<HeapBlock*> all_live_heap_blocks;
+    for_each_block([&](auto& block) {
+        all_live_heap_blocks.set(&block);
+        return IterationDecision::Continue;
+    });
+    return all_live_heap_blocks;
+}
+
+void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
 {
     m_gather_embedder_roots(roots);
-    gather_conservative_roots(roots);
+    gather_conservative_roots(roots, all_live_heap_blocks);
 
     for (auto& root : m_roots)
         roots.set(root.cell(), HeapRoot { .type = HeapRoot::Type::Root, .location = &root.source_location() });
@@ -314,7 +361,7 @@ void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, Fl
 }
 #endif
 
-NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot>& roots)
+NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot>& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
 {
     FlatPtr dummy;
 
@@ -347,12 +394,6 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
         }
     }
 
-    HashTable<HeapBlock*> all_live_heap_blocks;
-    for_each_block([&](auto& block) {
-        all_live_heap_blocks.set(&block);
-        return IterationDecision::Continue;
-    });
-
     for_each_cell_among_possible_pointers(all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr possible_pointer) {
         if (cell->state() == Cell::State::Live) {
             dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
@@ -365,15 +406,13 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
 
 class MarkingVisitor final : public Cell::Visitor {
 public:
-    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
+    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
         : m_heap(heap)
+        , m_all_live_heap_blocks(all_live_heap_blocks)
     {
         m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
-        m_heap.for_each_block([&](auto& block) {
-            m_all_live_heap_blocks.set(&block);
-            return IterationDecision::Continue;
-        });
 
+        m_work_queue.ensure_capacity(roots.size());
         for (auto* root : roots.keys()) {
             visit(root);
         }
@@ -391,20 +430,22 @@ public:
 
     virtual void visit_possible_values(ReadonlyBytes bytes) override
     {
-        HashMap<FlatPtr, HeapRoot> possible_pointers;
-
+        // NOTE: Unlike when gathering roots, we don't need to know where a possible pointer came from here.
+        //       So we look each one up directly, instead of collecting them into a HashMap first.
         auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
-        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i)
-            add_possible_value(possible_pointers, raw_pointer_sized_values[i], HeapRoot { .type = HeapRoot::Type::HeapFunctionCapturedPointer }, m_min_block_address, m_max_block_address);
-
-        for_each_cell_among_possible_pointers(m_all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr) {
-            if (cell->is_marked())
-                return;
-            if (cell->state() != Cell::State::Live)
-                return;
+        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i) {
+            auto possible_pointer = canonicalize_possible_pointer(raw_pointer_sized_values[i]);
+            if (!possible_pointer || possible_pointer < m_min_block_address || possible_pointer > m_max_block_address)
+                continue;
+            auto* possible_heap_block = HeapBlock::from_cell(reinterpret_cast<Cell const*>(possible_pointer));
+            if (!m_all_live_heap_blocks.contains(possible_heap_block))
+                continue;
+            auto* cell = possible_heap_block->cell_from_possible_pointer(possible_pointer);
+            if (!cell || cell->is_marked() || cell->state() != Cell::State::Live)
+                continue;
             cell->set_marked(true);
             m_work_queue.append(*cell);
-        });
+        }
     }
 
     void mark_all_live_cells()
@@ -417,16 +458,16 @@ public:
 private:
     Heap& m_heap;
     Vector<Ref<Cell>> m_work_queue;
-    HashTable<HeapBlock*> m_all_live_heap_blocks;
+    HashTable<HeapBlock*> const& m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
 
-void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
+void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots, HashTable<HeapBlock*> const& all_live_heap_blocks)
 {
     dbgln_if(HEAP_DEBUG, "mark_live_cells:");
 
-    MarkingVisitor visitor(*this, roots);
+    MarkingVisitor visitor(*this, roots, all_live_heap_blocks);
 
     visitor.mark_all_live_cells();
 
@@ -467,6 +508,7 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     dbgln_if(HEAP_DEBUG, "sweep_dead_cells:");
     Vector<HeapBlock*, 32> empty_blocks;
     Vector<HeapBlock*, 32> full_blocks_that_became_usable;
+    Vector<HeapBlock*, 32> sparse_blocks;
 
     size_t collected_cells = 0;
     size_t live_cells = 0;
@@ -474,41 +516,54 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t live_cell_bytes = 0;
 
     for_each_block([&](auto& block) {
-        bool block_has_live_cells = false;
+        size_t block_live_cells = 0;
         bool block_was_full = block.is_full();
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked()) {
                 dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+                if (m_allocation_sampler) [[unlikely]]
+                    m_allocation_sampler->sampled_cells.remove(cell);
                 block.deallocate(cell);
                 ++collected_cells;
                 collected_cell_bytes += block.cell_size();
             } else {
                 cell->set_marked(false);
-                block_has_live_cells = true;
+                ++block_live_cells;
                 ++live_cells;
                 live_cell_bytes += block.cell_size();
             }
         });
-        if (!block_has_live_cells)
+        if (!block_live_cells) {
             empty_blocks.append(&block);
-        else if (block_was_full != block.is_full())
+            return IterationDecision::Continue;
+        }
+        if (block_was_full != block.is_full())
             full_blocks_that_became_usable.append(&block);
+        if (!block.has_lazy_freelist() && block_live_cells * sparse_block_live_cell_ratio_denominator < block.cell_count())
+            sparse_blocks.append(&block);
         return IterationDecision::Continue;
     });
 
     for (auto& weak_container : m_weak_containers)
         weak_container.remove_dead_cells({});
 
+    Vector<void*, 32> empty_block_addresses;
+    empty_block_addresses.ensure_capacity(empty_blocks.size());
     for (auto* block : empty_blocks) {
         dbgln_if(HEAP_DEBUG, " - HeapBlock empty @ {}: cell_size={}", block, block->cell_size());
+        empty_block_addresses.unchecked_append(block);
         block->cell_allocator().block_did_become_empty({}, *block);
     }
+    BlockAllocator::release_physical_memory(empty_block_addresses);
 
     for (auto* block : full_blocks_that_became_usable) {
         dbgln_if(HEAP_DEBUG, " - HeapBlock usable again @ {}: cell_size={}", block, block->cell_size());
         block->cell_allocator().block_did_become_usable({}, *block);
     }
 
+    for (auto* block : sparse_blocks)
+        block->cell_allocator().block_did_become_sparse({}, *block);
+
     if constexpr (HEAP_DEBUG) {
         for_each_block([&](auto& block) {
             dbgln(" > Live HeapBlock @ {}: cell_size={}", &block, block.cell_size());
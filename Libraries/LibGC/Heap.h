@@ -6,12 +6,14 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Badge.h>
 #include <AK/Function.h>
 #include <AK/HashTable.h>
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
 #include <AK/StackInfo.h>
 #include <AK/Swift.h>
 #include <AK/Types.h>
@@ -44,6 +46,8 @@ public:
         auto* memory = allocate_cell<T>();
         defer_gc();
         new (memory) T(forward<Args>(args)...);
+        if (m_allocation_sampler) [[unlikely]]
+            sample_allocation(*memory, sizeof(T));
         undefer_gc();
         return *static_cast<T*>(memory);
     }
@@ -82,11 +86,18 @@ public:
 
     void enqueue_post_gc_task(AK::Function<void()>);
 
+    // Once every sample_interval_in_bytes of allocations, the site returned by the callback is remembered for the cell
+    // being allocated, so that heap snapshots can show where their cells came from.
+    void start_sampling_allocation_sites(size_t sample_interval_in_bytes, AK::Function<String()> capture_allocation_site);
+    void stop_sampling_allocation_sites();
+    bool is_sampling_allocation_sites() const { return m_allocation_sampler; }
+
 private:
     friend class MarkingVisitor;
     friend class GraphConstructorVisitor;
     friend class DeferGC;
     friend class ForeignCell;
+    friend class HeapSnapshot;
 
     void defer_gc();
     void undefer_gc();
@@ -106,24 +117,38 @@ private:
     }
 
     void will_allocate(size_t);
+    void sample_allocation(Cell&, size_t);
 
     void find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address);
-    void gather_roots(HashMap<Cell*, HeapRoot>&);
-    void gather_conservative_roots(HashMap<Cell*, HeapRoot>&);
+    HashTable<HeapBlock*> gather_all_live_heap_blocks();
+    void gather_roots(HashMap<Cell*, HeapRoot>&, HashTable<HeapBlock*> const& all_live_heap_blocks);
+    void gather_conservative_roots(HashMap<Cell*, HeapRoot>&, HashTable<HeapBlock*> const& all_live_heap_blocks);
     void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
-    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells);
+    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells, HashTable<HeapBlock*> const& all_live_heap_blocks);
     void finalize_unmarked_cells();
     void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
 
+    static constexpr Array<size_t, 7> size_classes { 64, 96, 128, 256, 512, 1024, 3072 };
+
+    // Returns the index of the smallest size class that fits cell_size, or size_classes.size() if there is none.
+    // NOTE: This is constexpr so that allocate_cell<T>() resolves its allocator at compile time.
+    static constexpr size_t size_class_index_for(size_t cell_size)
+    {
+        for (size_t i = 0; i < size_classes.size(); ++i) {
+            if (size_classes[i] >= cell_size)
+                return i;
+        }
+        return size_classes.size();
+    }
+
     ALWAYS_INLINE CellAllocator& allocator_for_size(size_t cell_size)
     {
-        // FIXME: Use binary search?
-        for (auto& allocator : m_size_based_cell_allocators) {
-            if (allocator->cell_size() >= cell_size)
-                return *allocator;
+        auto size_class_index = size_class_index_for(cell_size);
+        if (size_class_index >= size_classes.size()) {
+            dbgln("Cannot get CellAllocator for cell size {}, largest available is {}!", cell_size, size_classes.last());
+            VERIFY_NOT_REACHED();
         }
-        dbgln("Cannot get CellAllocator for cell size {}, largest available is {}!", cell_size, m_size_based_cell_allocators.last()->cell_size());
-        VERIFY_NOT_REACHED();
+        return *m_size_based_cell_allocators[size_class_index];
     }
 
     template<typename Callback>
@@ -136,6 +161,9 @@ private:
     }
 
     static constexpr size_t GC_MIN_BYTES_THRESHOLD { 4 * 1024 * 1024 };
+
+    // Blocks where fewer than 1/N of the cells survived a collection are allocated from last.
+    static constexpr size_t sparse_block_live_cell_ratio_denominator { 4 };
     size_t m_gc_bytes_threshold { GC_MIN_BYTES_THRESHOLD };
     size_t m_allocated_bytes_since_last_gc { 0 };
 
@@ -160,6 +188,16 @@ private:
     AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> m_gather_embedder_roots;
 
     Vector<AK::Function<void()>> m_post_gc_tasks;
+
+    struct AllocationSampler {
+        size_t sample_interval_in_bytes { 0 };
+        size_t bytes_until_next_sample { 0 };
+        AK::Function<String()> capture_allocation_site;
+        Vector<String> allocation_sites;
+        HashMap<String, u32> allocation_site_indices;
+        HashMap<Cell const*, u32> sampled_cells;
+    };
+    OwnPtr<AllocationSampler> m_allocation_sampler;
 } SWIFT_IMMORTAL_REFERENCE;
 
 inline void Heap::did_create_root(Badge<RootImpl>, RootImpl& impl)
@@ -31,6 +31,7 @@ public:
     size_t cell_size() const { return m_cell_size; }
     size_t cell_count() const { return (block_size - sizeof(HeapBlock)) / m_cell_size; }
     bool is_full() const { return !has_lazy_freelist() && !m_freelist; }
+    bool has_lazy_freelist() const { return m_next_lazy_freelist_index < cell_count(); }
 
     ALWAYS_INLINE Cell* allocate()
     {
@@ -95,8 +96,6 @@ public:
 private:
     HeapBlock(Heap&, CellAllocator&, size_t cell_size);
 
-    bool has_lazy_freelist() const { return m_next_lazy_freelist_index < cell_count(); }
-
     struct FreelistEntry final : public Cell {
         GC_CELL(FreelistEntry, Cell);
 
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <AK/JsonArraySerializer.h>
+#include <AK/JsonObjectSerializer.h>
+#include <AK/QuickSort.h>
+#include <LibGC/Heap.h>
+#include <LibGC/HeapBlock.h>
+#include <LibGC/HeapSnapshot.h>
+#include <LibGC/NanBoxedValue.h>
+
+namespace GC {
+
+class SnapshotConstructorVisitor final : public Cell::Visitor {
+public:
+    SnapshotConstructorVisitor(Vector<HeapSnapshot::Node>& nodes, Vector<u32>& edges, HashTable<HeapBlock*> const& all_live_heap_blocks)
+        : m_nodes(nodes)
+        , m_edges(edges)
+        , m_all_live_heap_blocks(all_live_heap_blocks)
+    {
+    }
+
+    u32 index_for(Cell& cell)
+    {
+        auto index = m_indices.ensure(&cell, [&] {
+            m_nodes.append({
+                .address = bit_cast<FlatPtr>(&cell),
+                .class_name = cell.class_name(),
+                .shallow_size = static_cast<u32>(HeapBlock::from_cell(&cell)->cell_size()),
+            });
+            m_work_queue.append(&cell);
+            return static_cast<u32>(m_nodes.size() - 1);
+        });
+        return index;
+    }
+
+    virtual void visit_impl(Cell& cell) override
+    {
+        m_edges.append(index_for(cell));
+    }
+
+    virtual void visit_possible_values(ReadonlyBytes bytes) override
+    {
+        auto* raw_pointer_sized_values = reinterpret_cast<FlatPtr const*>(bytes.data());
+        for (size_t i = 0; i < (bytes.size() / sizeof(FlatPtr)); ++i) {
+            auto possible_pointer = raw_pointer_sized_values[i];
+            if constexpr (sizeof(FlatPtr*) == sizeof(NanBoxedValue)) {
+                if ((possible_pointer & SHIFTED_IS_CELL_PATTERN) == SHIFTED_IS_CELL_PATTERN)
+                    possible_pointer = NanBoxedValue::extract_pointer_bits(possible_pointer);
+            }
+            if (!possible_pointer)
+                continue;
+
+            auto* possible_heap_block = HeapBlock::from_cell(reinterpret_cast<Cell const*>(possible_pointer));
+            if (!m_all_live_heap_blocks.contains(possible_heap_block))
+                continue;
+            if (auto* cell = possible_heap_block->cell_from_possible_pointer(possible_pointer); cell && cell->state() == Cell::State::Live)
+                visit_impl(*cell);
+        }
+    }
+
+    void visit_all_cells()
+    {
+        // NOTE: Each cell's edges are appended while it is being visited, so they end up next to each other.
+        for (size_t i = 0; i < m_work_queue.size(); ++i) {
+            auto first_edge = m_edges.size();
+            m_work_queue[i]->visit_edges(*this);
+
+            // NOTE: Cells are queued as their nodes are created, after the synthetic root. m_nodes may have grown while
+            //       visiting, so we only look the node up afterwards.
+            auto& node = m_nodes[i + 1];
+            node.first_edge = first_edge;
+            node.edge_count = m_edges.size() - first_edge;
+        }
+    }
+
+private:
+    Vector<HeapSnapshot::Node>& m_nodes;
+    Vector<u32>& m_edges;
+    HashTable<HeapBlock*> const& m_all_live_heap_blocks;
+
+    HashMap<Cell*, u32> m_indices;
+    Vector<Cell*> m_work_queue;
+};
+
+HeapSnapshot HeapSnapshot::take(Heap& heap)
+{
+    HeapSnapshot snapshot;
+
+    auto all_live_heap_blocks = heap.gather_all_live_heap_blocks();
+    HashMap<Cell*, HeapRoot> roots;
+    heap.gather_roots(roots, all_live_heap_blocks);
+
+    snapshot.m_nodes.append({ .class_name = "(GC roots)"sv });
+
+    SnapshotConstructorVisitor visitor(snapshot.m_nodes, snapshot.m_edges, all_live_heap_blocks);
+    for (auto& [root, root_origin] : roots) {
+        auto index = visitor.index_for(*root);
+        snapshot.m_nodes[index].root_origin = root_origin;
+        snapshot.m_edges.append(index);
+    }
+    snapshot.m_nodes[0].edge_count = snapshot.m_edges.size();
+
+    visitor.visit_all_cells();
+
+    if (heap.m_allocation_sampler) {
+        auto const& sampler = *heap.m_allocation_sampler;
+        snapshot.m_allocation_sites = sampler.allocation_sites;
+
+        for (auto& node : snapshot.m_nodes.span().slice(1)) {
+            if (auto site = sampler.sampled_cells.get(bit_cast<Cell*>(node.address)); site.has_value())
+                node.allocation_site = *site;
+        }
+    }
+
+    snapshot.compute_dominators_and_retained_sizes();
+    return snapshot;
+}
+
+// This is the iterative algorithm from "A Simple, Fast Dominance Algorithm" by Cooper, Harvey and Kennedy. It is
+// quadratic in the worst case, but in practice heap graphs converge in a few passes, and it only needs a few arrays
+// indexed by node, which matters more for very large heaps than the better bound of Lengauer-Tarjan.
+void HeapSnapshot::compute_dominators_and_retained_sizes()
+{
+    auto node_count = m_nodes.size();
+
+    // 1. Number the nodes in reverse postorder of a depth-first search from the synthetic root.
+    Vector<u32> postorder;
+    postorder.ensure_capacity(node_count);
+    {
+        Vector<bool> visited;
+        visited.resize(node_count);
+
+        struct StackEntry {
+            u32 node { 0 };
+            u32 next_edge { 0 };
+        };
+        Vector<StackEntry> stack;
+        stack.append({ 0, 0 });
+        visited[0] = true;
+
+        while (!stack.is_empty()) {
+            auto& entry = stack.last();
+            auto edges = edges_of(m_nodes[entry.node]);
+            if (entry.next_edge < edges.size()) {
+                auto target = edges[entry.next_edge++];
+                if (!visited[target]) {
+                    visited[target] = true;
+                    stack.append({ target, 0 });
+                }
+                continue;
+            }
+            postorder.append(entry.node);
+            stack.take_last();
+        }
+    }
+
+    // NOTE: Every node was reached from the roots while taking the snapshot, so every node is numbered here.
+    VERIFY(postorder.size() == node_count);
+
+    Vector<u32> order_of_node;
+    order_of_node.resize(node_count);
+    Vector<u32> node_in_order;
+    node_in_order.resize(node_count);
+    for (size_t i = 0; i < node_count; ++i) {
+        auto order = node_count - 1 - i;
+        order_of_node[postorder[i]] = order;
+        node_in_order[order] = postorder[i];
+    }
+    postorder.clear_with_capacity();
+
+    // 2. Gather the predecessors of every node, in reverse postorder numbering.
+    Vector<u32> first_predecessor;
+    first_predecessor.resize(node_count + 1);
+    for (auto target : m_edges)
+        ++first_predecessor[order_of_node[target] + 1];
+    for (size_t i = 1; i <= node_count; ++i)
+        first_predecessor[i] += first_predecessor[i - 1];
+
+    Vector<u32> predecessors;
+    predecessors.resize(m_edges.size());
+    {
+        auto next_predecessor = first_predecessor;
+        for (size_t source = 0; source < node_count; ++source) {
+            for (auto target : edges_of(m_nodes[source]))
+                predecessors[next_predecessor[order_of_node[target]]++] = order_of_node[source];
+        }
+    }
+
+    // 3. Iterate until the immediate dominator of every node stops changing.
+    Vector<u32> dominator;
+    dominator.resize(node_count);
+    dominator.span().fill(invalid_index);
+    dominator[0] = 0;
+
+    auto intersect = [&](u32 a, u32 b) {
+        while (a != b) {
+            while (a > b)
+                a = dominator[a];
+            while (b > a)
+                b = dominator[b];
+        }
+        return a;
+    };
+
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (u32 node = 1; node < node_count; ++node) {
+            auto new_dominator = invalid_index;
+            for (auto i = first_predecessor[node]; i < first_predecessor[node + 1]; ++i) {
+                auto predecessor = predecessors[i];
+                if (dominator[predecessor] == invalid_index)
+                    continue;
+                new_dominator = new_dominator == invalid_index ? predecessor : intersect(predecessor, new_dominator);
+            }
+            if (dominator[node] != new_dominator) {
+                dominator[node] = new_dominator;
+                changed = true;
+            }
+        }
+    }
+
+    // 4. Every node's retained size is its own size plus the retained sizes of the nodes it immediately dominates.
+    //    Dominators come before the nodes they dominate in reverse postorder, so walking backwards sees children first.
+    for (size_t i = 0; i < node_count; ++i) {
+        auto& node = m_nodes[i];
+        node.dominator = node_in_order[dominator[order_of_node[i]]];
+        node.retained_size = node.shallow_size;
+    }
+    for (size_t order = node_count - 1; order > 0; --order) {
+        auto& node = m_nodes[node_in_order[order]];
+        m_nodes[node.dominator].retained_size += node.retained_size;
+    }
+}
+
+Vector<HeapSnapshot::ClassDifference> HeapSnapshot::difference_from(HeapSnapshot const& older) const
+{
+    HashMap<FlatPtr, u32> older_indices;
+    older_indices.ensure_capacity(older.m_nodes.size());
+    for (u32 i = 1; i < older.m_nodes.size(); ++i)
+        older_indices.set(older.m_nodes[i].address, i);
+
+    Vector<bool> older_node_survived;
+    older_node_survived.resize(older.m_nodes.size());
+
+    HashMap<StringView, ClassDifference> differences;
+    auto difference_for = [&](StringView class_name) -> ClassDifference& {
+        return differences.ensure(class_name, [&] { return ClassDifference { .class_name = class_name }; });
+    };
+
+    for (auto const& node : m_nodes.span().slice(1)) {
+        if (auto older_index = older_indices.get(node.address); older_index.has_value() && older.m_nodes[*older_index].class_name == node.class_name) {
+            older_node_survived[*older_index] = true;
+            continue;
+        }
+
+        auto& difference = difference_for(node.class_name);
+        ++difference.added_count;
+        difference.added_size += node.shallow_size;
+    }
+
+    for (u32 i = 1; i < older.m_nodes.size(); ++i) {
+        if (older_node_survived[i])
+            continue;
+
+        auto& difference = difference_for(older.m_nodes[i].class_name);
+        ++difference.removed_count;
+        difference.removed_size += older.m_nodes[i].shallow_size;
+    }
+
+    Vector<ClassDifference> result;
+    result.ensure_capacity(differences.size());
+    for (auto const& [class_name, difference] : differences)
+        result.unchecked_append(difference);
+
+    quick_sort(result, [](auto const& a, auto const& b) {
+        return static_cast<i64>(a.added_size - a.removed_size) > static_cast<i64>(b.added_size - b.removed_size);
+    });
+    return result;
+}
+
+static StringView root_description(HeapRoot const& root)
+{
+    switch (root.type) {
+    case HeapRoot::Type::HeapFunctionCapturedPointer:
+        return "HeapFunctionCapturedPointer"sv;
+    case HeapRoot::Type::Root:
+        return "Root"sv;
+    case HeapRoot::Type::RootVector:
+        return "RootVector"sv;
+    case HeapRoot::Type::RootHashMap:
+        return "RootHashMap"sv;
+    case HeapRoot::Type::ConservativeVector:
+        return "ConservativeVector"sv;
+    case HeapRoot::Type::RegisterPointer:
+        return "RegisterPointer"sv;
+    case HeapRoot::Type::StackPointer:
+        return "StackPointer"sv;
+    case HeapRoot::Type::VM:
+        return "VM"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// NOTE: Snapshots of large heaps have millions of nodes, so rather than one object per node, every node is written as
+//       a run of integers in "nodes" (laid out as described by "node_fields"), with its edges in "edges" and all of
+//       its strings in "strings". This is the same approach as V8's .heapsnapshot format.
+ErrorOr<void> HeapSnapshot::serialize(StringBuilder& builder, HeapSnapshot const* older) const
+{
+    Vector<String> strings;
+    HashMap<String, u32> string_indices;
+    auto index_for_string = [&](StringView string) -> ErrorOr<u32> {
+        auto owned_string = TRY(String::from_utf8(string));
+        if (auto index = string_indices.get(owned_string); index.has_value())
+            return *index;
+        strings.append(owned_string);
+        string_indices.set(move(owned_string), strings.size() - 1);
+        return strings.size() - 1;
+    };
+
+    auto object = TRY(JsonObjectSerializer<>::try_create(builder));
+
+    auto node_fields = TRY(object.add_array("node_fields"sv));
+    for (auto field : { "address"sv, "class_name"sv, "shallow_size"sv, "retained_size"sv, "dominator"sv, "edge_count"sv, "root"sv, "allocation_site"sv })
+        TRY(node_fields.add(field));
+    TRY(node_fields.finish());
+
+    auto nodes = TRY(object.add_array("nodes"sv));
+    for (auto const& node : m_nodes) {
+        TRY(nodes.add(static_cast<u64>(node.address)));
+        TRY(nodes.add(TRY(index_for_string(node.class_name))));
+        TRY(nodes.add(node.shallow_size));
+        TRY(nodes.add(node.retained_size));
+        TRY(nodes.add(node.dominator));
+        TRY(nodes.add(node.edge_count));
+
+        if (node.root_origin.has_value()) {
+            if (node.root_origin->type == HeapRoot::Type::Root && node.root_origin->location) {
+                auto const& location = *node.root_origin->location;
+                TRY(nodes.add(TRY(index_for_string(TRY(String::formatted("Root {} {}:{}", location.function_name(), location.filename(), location.line_number()))))));
+            } else {
+                TRY(nodes.add(TRY(index_for_string(root_description(*node.root_origin)))));
+            }
+        } else {
+            TRY(nodes.add(-1));
+        }
+
+        if (node.allocation_site != invalid_index)
+            TRY(nodes.add(TRY(index_for_string(m_allocation_sites[node.allocation_site]))));
+        else
+            TRY(nodes.add(-1));
+    }
+    TRY(nodes.finish());
+
+    auto edges = TRY(object.add_array("edges"sv));
+    for (auto target : m_edges)
+        TRY(edges.add(target));
+    TRY(edges.finish());
+
+    auto serialized_strings = TRY(object.add_array("strings"sv));
+    for (auto const& string : strings)
+        TRY(serialized_strings.add(string.bytes_as_string_view()));
+    TRY(serialized_strings.finish());
+
+    if (older) {
+        auto differences = TRY(object.add_array("difference_from_previous_snapshot"sv));
+        for (auto const& difference : difference_from(*older)) {
+            auto serialized_difference = TRY(differences.add_object());
+            TRY(serialized_difference.add("class_name"sv, difference.class_name));
+            TRY(serialized_difference.add("added_count"sv, difference.added_count));
+            TRY(serialized_difference.add("added_size"sv, difference.added_size));
+            TRY(serialized_difference.add("removed_count"sv, difference.removed_count));
+            TRY(serialized_difference.add("removed_size"sv, difference.removed_size));
+            TRY(serialized_difference.finish());
+        }
+        TRY(differences.finish());
+    }
+
+    return object.finish();
+}
+
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/StringBuilder.h>
+#include <AK/Vector.h>
+#include <LibGC/Forward.h>
+#include <LibGC/HeapRoot.h>
+
+namespace GC {
+
+// A copy of the heap graph at one point in time, with the shallow size of every live cell and the size it retains,
+// i.e. the memory that would be freed if nothing else referred to it. Retained sizes are computed from the dominator
+// tree of the graph, rooted at a synthetic node that refers to every GC root.
+class HeapSnapshot {
+public:
+    static constexpr u32 invalid_index = NumericLimits<u32>::max();
+
+    struct Node {
+        FlatPtr address { 0 };
+        StringView class_name;
+        u32 shallow_size { 0 };
+        u64 retained_size { 0 };
+
+        // The index of the node that dominates this one, i.e. the closest node that every path from the roots to this
+        // node goes through.
+        u32 dominator { 0 };
+
+        u32 first_edge { 0 };
+        u32 edge_count { 0 };
+
+        u32 allocation_site { invalid_index };
+        Optional<HeapRoot> root_origin;
+    };
+
+    // How the cells of one class changed between two snapshots. Cells are told apart by address and class name.
+    struct ClassDifference {
+        StringView class_name;
+        u64 added_count { 0 };
+        u64 added_size { 0 };
+        u64 removed_count { 0 };
+        u64 removed_size { 0 };
+    };
+
+    static HeapSnapshot take(Heap&);
+
+    // Node 0 is the synthetic root.
+    ReadonlySpan<Node> nodes() const { return m_nodes; }
+    ReadonlySpan<u32> edges_of(Node const& node) const { return m_edges.span().slice(node.first_edge, node.edge_count); }
+    ReadonlySpan<String> allocation_sites() const { return m_allocation_sites; }
+
+    // Returns the classes whose cells changed since the older snapshot, the ones that grew the most first.
+    Vector<ClassDifference> difference_from(HeapSnapshot const& older) const;
+
+    ErrorOr<void> serialize(StringBuilder&, HeapSnapshot const* older = nullptr) const;
+
+private:
+    HeapSnapshot() = default;
+
+    void compute_dominators_and_retained_sizes();
+
+    Vector<Node> m_nodes;
+    Vector<u32> m_edges;
+    Vector<String> m_allocation_sites;
+};
+
+}
@@ -11,6 +11,7 @@
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/Font/TypefaceSkia.h>
 #include <LibGfx/TextLayout.h>
+#include <LibGfx/TextShapingCache.h>
 
 #include <core/SkFont.h>
 #include <core/SkFontMetrics.h>
@@ -129,6 +130,13 @@ hb_font_t* Font::harfbuzz_font() const
     return m_harfbuzz_font;
 }
 
+TextShapingCache& Font::text_shaping_cache() const
+{
+    if (!m_text_shaping_cache)
+        m_text_shaping_cache = make<TextShapingCache>();
+    return *m_text_shaping_cache;
+}
+
 SkFont Font::skia_font(float scale) const
 {
     auto const& sk_typeface = as<TypefaceSkia>(*m_typeface).sk_typeface();
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <AK/FlyString.h>
+#include <AK/OwnPtr.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/Typeface.h>
 
@@ -50,6 +51,8 @@ enum FontWidth {
 
 constexpr float text_shaping_resolution = 64;
 
+class TextShapingCache;
+
 class Font : public RefCounted<Font> {
 public:
     Font(NonnullRefPtr<Typeface const>, float point_width, float point_height, unsigned dpi_x = DEFAULT_DPI, unsigned dpi_y = DEFAULT_DPI);
@@ -81,10 +84,12 @@ public:
 
     Font const& bold_variant() const;
     hb_font_t* harfbuzz_font() const;
+    TextShapingCache& text_shaping_cache() const;
 
 private:
     mutable RefPtr<Font const> m_bold_variant;
     mutable hb_font_t* m_harfbuzz_font { nullptr };
+    mutable OwnPtr<TextShapingCache> m_text_shaping_cache;
 
     NonnullRefPtr<Typeface const> m_typeface;
     float m_x_scale { 0.0f };
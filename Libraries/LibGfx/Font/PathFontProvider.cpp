@@ -4,18 +4,155 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
+#include <AK/Endian.h>
 #include <AK/Format.h>
 #include <AK/LexicalPath.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/MappedFile.h>
 #include <LibCore/Resource.h>
+#include <LibCore/System.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/PathFontProvider.h>
 #include <LibGfx/Font/WOFF/Loader.h>
 
 namespace Gfx {
 
+static constexpr u32 index_magic = 0x4C424649; // "LBFI"
+static constexpr u32 index_format_version = 1;
+
 PathFontProvider::PathFontProvider() = default;
 PathFontProvider::~PathFontProvider() = default;
 
+static bool is_woff_file(StringView uri)
+{
+    return LexicalPath { uri }.has_extension(".woff"sv);
+}
+
+static ErrorOr<String> read_string(Stream& stream)
+{
+    auto length = TRY(stream.read_value<LittleEndian<u32>>());
+    auto buffer = TRY(ByteBuffer::create_uninitialized(length));
+    TRY(stream.read_until_filled(buffer));
+    return String::from_utf8(StringView { buffer.bytes() });
+}
+
+template<typename T>
+static void append_value(ByteBuffer& buffer, T value)
+{
+    LittleEndian<T> little_endian_value { value };
+    buffer.append(&little_endian_value, sizeof(little_endian_value));
+}
+
+static void append_string(ByteBuffer& buffer, StringView string)
+{
+    append_value<u32>(buffer, string.length());
+    buffer.append(string.bytes());
+}
+
+void PathFontProvider::load_index(ByteString path)
+{
+    m_index_path = move(path);
+
+    auto index_file_or_error = Core::MappedFile::map(m_index_path);
+    if (index_file_or_error.is_error())
+        return;
+    auto& stream = *index_file_or_error.value();
+
+    auto result = [&]() -> ErrorOr<void> {
+        if (TRY(stream.read_value<LittleEndian<u32>>()) != index_magic || TRY(stream.read_value<LittleEndian<u32>>()) != index_format_version)
+            return Error::from_string_literal("Not a font index of this version");
+
+        auto entry_count = TRY(stream.read_value<LittleEndian<u32>>());
+        for (u32 i = 0; i < entry_count; ++i) {
+            auto uri = TRY(read_string(stream));
+            IndexEntry entry;
+            entry.modified_time = TRY(stream.read_value<LittleEndian<i64>>());
+            entry.size = TRY(stream.read_value<LittleEndian<u64>>());
+            entry.family = TRY(read_string(stream));
+            entry.weight = TRY(stream.read_value<LittleEndian<u16>>());
+            entry.width = TRY(stream.read_value<LittleEndian<u16>>());
+            entry.slope = TRY(stream.read_value<u8>());
+            m_loaded_index.set(move(uri), move(entry));
+        }
+        return {};
+    }();
+
+    if (result.is_error()) {
+        dbgln("PathFontProvider: Unable to read the font index {}: {}", m_index_path, result.error());
+        m_loaded_index.clear();
+    }
+}
+
+ErrorOr<void> PathFontProvider::save_index()
+{
+    if (m_index_path.is_empty())
+        return {};
+
+    auto index_has_changed = m_index.size() != m_loaded_index.size() || any_of(m_index, [&](auto const& it) {
+        return m_loaded_index.get(it.key) != it.value;
+    });
+    if (!index_has_changed)
+        return {};
+
+    ByteBuffer buffer;
+    append_value<u32>(buffer, index_magic);
+    append_value<u32>(buffer, index_format_version);
+    append_value<u32>(buffer, m_index.size());
+    for (auto const& [uri, entry] : m_index) {
+        append_string(buffer, uri);
+        append_value<i64>(buffer, entry.modified_time);
+        append_value<u64>(buffer, entry.size);
+        append_string(buffer, entry.family.bytes_as_string_view());
+        append_value<u16>(buffer, entry.weight);
+        append_value<u16>(buffer, entry.width);
+        append_value<u8>(buffer, entry.slope);
+    }
+
+    TRY(Core::Directory::create(LexicalPath { m_index_path }.parent(), Core::Directory::CreateDirectories::Yes));
+
+    // NOTE: Several processes may write the index at the same time, so each writes its own file and renames it into place.
+    auto temporary_path = ByteString::formatted("{}.{}.tmp", m_index_path, Core::System::getpid());
+    auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    TRY(file->write_until_depleted(buffer));
+    file->close();
+
+    TRY(Core::System::rename(temporary_path, m_index_path));
+    m_loaded_index = m_index;
+    return {};
+}
+
+void PathFontProvider::add_font_file(String uri, IndexEntry const& entry, RefPtr<Typeface> typeface)
+{
+    auto& font_files = m_font_files_by_family.ensure(entry.family, [] {
+        return Vector<FontFile> {};
+    });
+    font_files.append({ move(uri), entry.weight, entry.width, entry.slope, move(typeface) });
+}
+
+RefPtr<Typeface> PathFontProvider::typeface_for_font_file(FontFile& font_file)
+{
+    if (font_file.typeface || font_file.failed_to_load)
+        return font_file.typeface;
+
+    auto typeface_or_error = [&]() -> ErrorOr<NonnullRefPtr<Typeface>> {
+        auto resource = TRY(Core::Resource::load_from_uri(font_file.uri));
+        if (is_woff_file(font_file.uri))
+            return WOFF::try_load_from_resource(resource);
+        return Typeface::try_load_from_resource(resource);
+    }();
+
+    if (typeface_or_error.is_error()) {
+        dbgln("PathFontProvider: Unable to load font {}: {}", font_file.uri, typeface_or_error.error());
+        font_file.failed_to_load = true;
+        return nullptr;
+    }
+
+    font_file.typeface = typeface_or_error.release_value();
+    return font_file.typeface;
+}
+
 void PathFontProvider::load_all_fonts_from_uri(StringView uri)
 {
     auto root_or_error = Core::Resource::load_from_uri(uri);
@@ -31,47 +168,54 @@ void PathFontProvider::load_all_fonts_from_uri(StringView uri)
     root->for_each_descendant_file([this](Core::Resource const& resource) -> IterationDecision {
         auto uri = resource.uri();
         auto path = LexicalPath(uri.bytes_as_string_view());
-        if (path.has_extension(".ttf"sv) || path.has_extension(".ttc"sv)) {
-            // FIXME: What about .otf
-            if (auto font_or_error = Typeface::try_load_from_resource(resource); !font_or_error.is_error()) {
-                auto font = font_or_error.release_value();
-                auto& family = m_typeface_by_family.ensure(font->family(), [] {
-                    return Vector<NonnullRefPtr<Typeface>> {};
-                });
-                family.append(font);
-            }
-        } else if (path.has_extension(".woff"sv)) {
-            if (auto font_or_error = WOFF::try_load_from_resource(resource); !font_or_error.is_error()) {
-                auto font = font_or_error.release_value();
-                auto& family = m_typeface_by_family.ensure(font->family(), [] {
-                    return Vector<NonnullRefPtr<Typeface>> {};
-                });
-                family.append(font);
-            }
+        // FIXME: What about .otf
+        if (!path.has_extension(".ttf"sv) && !path.has_extension(".ttc"sv) && !path.has_extension(".woff"sv))
+            return IterationDecision::Continue;
+
+        auto modified_time = static_cast<i64>(resource.modified_time().value_or(0));
+        auto size = static_cast<u64>(resource.data().size());
+
+        // Fonts the index already knows about are only loaded once a font is requested from them.
+        if (auto entry = m_loaded_index.get(uri); entry.has_value() && entry->modified_time == modified_time && entry->size == size) {
+            m_index.set(uri, *entry);
+            add_font_file(move(uri), *entry, nullptr);
+            return IterationDecision::Continue;
         }
+
+        auto font_or_error = is_woff_file(uri) ? WOFF::try_load_from_resource(resource) : Typeface::try_load_from_resource(resource);
+        if (font_or_error.is_error())
+            return IterationDecision::Continue;
+        auto font = font_or_error.release_value();
+
+        IndexEntry entry { modified_time, size, font->family(), font->weight(), font->width(), font->slope() };
+        m_index.set(uri, entry);
+        add_font_file(move(uri), entry, move(font));
         return IterationDecision::Continue;
     });
 }
 
 RefPtr<Gfx::Font> PathFontProvider::get_font(FlyString const& family, float point_size, unsigned weight, unsigned width, unsigned slope)
 {
-    auto it = m_typeface_by_family.find(family);
-    if (it == m_typeface_by_family.end())
+    auto it = m_font_files_by_family.find(family);
+    if (it == m_font_files_by_family.end())
         return nullptr;
-    for (auto const& typeface : it->value) {
-        if (typeface->weight() == weight && typeface->width() == width && typeface->slope() == slope)
-            return typeface->font(point_size);
+    for (auto& font_file : it->value) {
+        if (font_file.weight == weight && font_file.width == width && font_file.slope == slope) {
+            if (auto typeface = typeface_for_font_file(font_file))
+                return typeface->font(point_size);
+        }
     }
     return nullptr;
 }
 
 void PathFontProvider::for_each_typeface_with_family_name(FlyString const& family_name, Function<void(Typeface const&)> callback)
 {
-    auto it = m_typeface_by_family.find(family_name);
-    if (it == m_typeface_by_family.end())
+    auto it = m_font_files_by_family.find(family_name);
+    if (it == m_font_files_by_family.end())
         return;
-    for (auto const& typeface : it->value) {
-        callback(*typeface);
+    for (auto& font_file : it->value) {
+        if (auto typeface = typeface_for_font_file(font_file))
+            callback(*typeface);
     }
 }
 
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/ByteString.h>
 #include <AK/FlyString.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
@@ -24,6 +25,11 @@ public:
 
     void set_name_but_fixme_should_create_custom_system_font_provider(String name) { m_name = move(name); }
 
+    // The index remembers the family and style of every font file we have seen, so that fonts loaded afterwards only
+    // have to be opened once a font is actually requested from them.
+    void load_index(ByteString path);
+    ErrorOr<void> save_index();
+
     void load_all_fonts_from_uri(StringView);
 
     virtual RefPtr<Gfx::Font> get_font(FlyString const& family, float point_size, unsigned weight, unsigned width, unsigned slope) override;
@@ -31,8 +37,35 @@ public:
     virtual StringView name() const override { return m_name.bytes_as_string_view(); }
 
 private:
-    HashMap<FlyString, Vector<NonnullRefPtr<Typeface>>, AK::ASCIICaseInsensitiveFlyStringTraits> m_typeface_by_family;
+    struct FontFile {
+        String uri;
+        u16 weight { 0 };
+        u16 width { 0 };
+        u8 slope { 0 };
+        RefPtr<Typeface> typeface;
+        bool failed_to_load { false };
+    };
+
+    struct IndexEntry {
+        i64 modified_time { 0 };
+        u64 size { 0 };
+        FlyString family;
+        u16 weight { 0 };
+        u16 width { 0 };
+        u8 slope { 0 };
+
+        bool operator==(IndexEntry const&) const = default;
+    };
+
+    void add_font_file(String uri, IndexEntry const&, RefPtr<Typeface>);
+    RefPtr<Typeface> typeface_for_font_file(FontFile&);
+
+    HashMap<FlyString, Vector<FontFile>, AK::ASCIICaseInsensitiveFlyStringTraits> m_font_files_by_family;
     String m_name { "Path"_string };
+
+    ByteString m_index_path;
+    HashMap<String, IndexEntry> m_loaded_index;
+    HashMap<String, IndexEntry> m_index;
 };
 
 }
@@ -53,8 +53,56 @@ private:
     ByteBuffer& m_buffer;
 };
 
+// Decoding WOFF2 is expensive, and sites load the same web fonts on every one of their pages, so the most recently
+// decoded fonts are kept around and handed out again when the same data is loaded.
+static constexpr size_t max_recently_decoded_fonts = 16;
+static constexpr size_t max_recently_decoded_fonts_size = 32 * MiB;
+
+struct RecentlyDecodedFont {
+    ByteBuffer input;
+    size_t decoded_size { 0 };
+    NonnullRefPtr<Gfx::Typeface> typeface;
+};
+
+static Vector<RecentlyDecodedFont>& recently_decoded_fonts()
+{
+    static thread_local Vector<RecentlyDecodedFont> fonts;
+    return fonts;
+}
+
+static void remember_decoded_font(ReadonlyBytes input, size_t decoded_size, NonnullRefPtr<Gfx::Typeface> typeface)
+{
+    if (decoded_size > max_recently_decoded_fonts_size)
+        return;
+    auto input_copy = ByteBuffer::copy(input);
+    if (input_copy.is_error())
+        return;
+
+    auto& fonts = recently_decoded_fonts();
+    fonts.append({ input_copy.release_value(), decoded_size, move(typeface) });
+
+    size_t total_decoded_size = 0;
+    for (auto const& font : fonts)
+        total_decoded_size += font.decoded_size;
+    while (fonts.size() > max_recently_decoded_fonts || total_decoded_size > max_recently_decoded_fonts_size) {
+        total_decoded_size -= fonts.first().decoded_size;
+        fonts.remove(0);
+    }
+}
+
 ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes bytes)
 {
+    auto& fonts = recently_decoded_fonts();
+    for (size_t i = 0; i < fonts.size(); ++i) {
+        if (fonts[i].input.bytes() != bytes)
+            continue;
+        // Move the font to the end, so that it's the last to be evicted.
+        auto font = fonts.take(i);
+        auto typeface = font.typeface;
+        fonts.append(move(font));
+        return typeface;
+    }
+
     auto ttf_buffer = TRY(ByteBuffer::create_uninitialized(0));
     auto output = WOFF2ByteBufferOut { ttf_buffer };
     auto result = woff2::ConvertWOFF2ToTTF(bytes.data(), bytes.size(), &output);
@@ -62,8 +110,10 @@ ErrorOr<NonnullRefPtr<Gfx::Typeface>> try_load_from_bytes(ReadonlyBytes bytes)
         return Error::from_string_literal("Failed to convert the WOFF2 font to TTF");
     }
 
+    auto decoded_size = ttf_buffer.size();
     auto font_data = Gfx::FontData::create_from_byte_buffer(move(ttf_buffer));
     auto input_font = TRY(Gfx::Typeface::try_load_from_font_data(move(font_data)));
+    remember_decoded_font(bytes, decoded_size, input_font);
     return input_font;
 }
 
@@ -7,6 +7,7 @@
 
 #include <AK/ByteBuffer.h>
 #include <AK/Error.h>
+#include <LibCore/System.h>
 #include <LibGfx/ImageFormats/AVIFLoader.h>
 
 #include <avif/avif.h>
@@ -73,6 +74,13 @@ static ErrorOr<void> decode_avif_header(AVIFLoadingContext& context)
         // Reason for this is that older versions of ImageMagick do not set this property, which leads to
         // broken web content if the error is not ignored.
         context.decoder->strictFlags &= ~AVIF_STRICT_PIXI_REQUIRED;
+
+        // AV1 decoding is expensive, so let dav1d spread it over all cores rather than the single thread libavif uses by default.
+        context.decoder->maxThreads = static_cast<int>(Core::System::hardware_concurrency());
+
+        // We never look at this metadata, so don't spend time and memory extracting it.
+        context.decoder->ignoreExif = AVIF_TRUE;
+        context.decoder->ignoreXMP = AVIF_TRUE;
     }
 
     avifResult result = avifDecoderSetIOMemory(context.decoder, context.data.data(), context.data.size());
@@ -114,6 +122,7 @@ static ErrorOr<void> decode_avif_image(AVIFLoadingContext& context)
         rgb.pixels = bitmap->scanline_u8(0);
         rgb.rowBytes = bitmap->pitch();
         rgb.format = avifRGBFormat::AVIF_RGB_FORMAT_BGRA;
+        rgb.maxThreads = context.decoder->maxThreads;
 
         avifResult result = avifImageYUVToRGB(context.decoder->image, &rgb);
         if (result != AVIF_RESULT_OK)
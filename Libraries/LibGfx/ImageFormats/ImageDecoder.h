@@ -85,6 +85,10 @@ public:
 
     virtual ErrorOr<ImageFrameDescriptor> frame(size_t index, Optional<IntSize> ideal_size = {}) = 0;
 
+    // Override this if the format can be displayed before all of its data has arrived. The plugin is created with
+    // whatever data is available, and this returns as much of the first frame as that data allows.
+    virtual ErrorOr<NonnullRefPtr<Bitmap>> partial_frame() { return Error::from_string_literal("Partial decoding is not supported"); }
+
     virtual Optional<Metadata const&> metadata() { return OptionalNone {}; }
 
     virtual ErrorOr<Optional<Media::CodingIndependentCodePoints>> cicp() { return OptionalNone {}; }
@@ -112,6 +116,7 @@ public:
     size_t first_animated_frame_index() const { return m_plugin->first_animated_frame_index(); }
 
     ErrorOr<ImageFrameDescriptor> frame(size_t index, Optional<IntSize> ideal_size = {}) const { return m_plugin->frame(index, ideal_size); }
+    ErrorOr<NonnullRefPtr<Bitmap>> partial_frame() const { return m_plugin->partial_frame(); }
 
     Optional<Metadata const&> metadata() const { return m_plugin->metadata(); }
     ErrorOr<ColorSpace> color_space();
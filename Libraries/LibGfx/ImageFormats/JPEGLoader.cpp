@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <LibGfx/CMYKBitmap.h>
 #include <LibGfx/ImageFormats/JPEGLoader.h>
 #include <jpeglib.h>
@@ -22,6 +23,11 @@ struct JPEGLoadingContext {
 
     RefPtr<Gfx::Bitmap> rgb_bitmap;
     RefPtr<Gfx::CMYKBitmap> cmyk_bitmap;
+    RefPtr<Gfx::Bitmap> partial_bitmap;
+
+    // The size of the image itself, and the factor by which the decoded bitmaps were scaled down from it.
+    IntSize image_size;
+    unsigned scale_denominator { 1 };
 
     ReadonlyBytes data;
     Vector<u8> icc_data;
@@ -31,35 +37,28 @@ struct JPEGLoadingContext {
     {
     }
 
-    ErrorOr<void> decode();
+    ErrorOr<IntSize> read_image_size();
+    ErrorOr<void> decode(unsigned requested_scale_denominator);
+    ErrorOr<void> decode_partially();
+
+    void initialize_source_manager(jpeg_source_mgr&) const;
 };
 
 struct JPEGErrorManager : jpeg_error_mgr {
     jmp_buf setjmp_buffer {};
 };
 
-ErrorOr<void> JPEGLoadingContext::decode()
+static void error_exit(j_common_ptr cinfo)
 {
-    struct jpeg_decompress_struct cinfo;
-    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
-
-    struct JPEGErrorManager jerr;
-    cinfo.err = jpeg_std_error(&jerr);
-
-    jpeg_source_mgr source_manager {};
-
-    if (setjmp(jerr.setjmp_buffer))
-        return Error::from_string_literal("Failed to decode JPEG");
-
-    jerr.error_exit = [](j_common_ptr cinfo) {
-        char buffer[JMSG_LENGTH_MAX];
-        (*cinfo->err->format_message)(cinfo, buffer);
-        dbgln("JPEG error: {}", buffer);
-        longjmp(static_cast<JPEGErrorManager*>(cinfo->err)->setjmp_buffer, 1);
-    };
-
-    jpeg_create_decompress(&cinfo);
+    char buffer[JMSG_LENGTH_MAX];
+    (*cinfo->err->format_message)(cinfo, buffer);
+    dbgln("JPEG error: {}", buffer);
+    longjmp(static_cast<JPEGErrorManager*>(cinfo->err)->setjmp_buffer, 1);
+}
 
+// NOTE: Running out of data suspends the decoder, rather than being treated as an error.
+void JPEGLoadingContext::initialize_source_manager(jpeg_source_mgr& source_manager) const
+{
     source_manager.next_input_byte = data.data();
     source_manager.bytes_in_buffer = data.size();
     source_manager.init_source = [](j_decompress_ptr) { };
@@ -74,13 +73,89 @@ ErrorOr<void> JPEGLoadingContext::decode()
     };
     source_manager.resync_to_restart = jpeg_resync_to_restart;
     source_manager.term_source = [](j_decompress_ptr) { };
+}
 
+// Reads the remaining scanlines straight into the rows of the output bitmap. libjpeg-turbo's SIMD upsampling and color
+// conversion routines process a whole row group at a time, so we always offer it as many rows as it may want to write,
+// rather than one row per call. Returns false if the data ran out before the last scanline.
+template<typename GetScanline>
+static bool read_scanlines(jpeg_decompress_struct& cinfo, GetScanline get_scanline)
+{
+    static constexpr size_t maximum_rows_per_call = 16;
+    Array<JSAMPROW, maximum_rows_per_call> rows;
+
+    while (cinfo.output_scanline < cinfo.output_height) {
+        auto row_count = min<size_t>(maximum_rows_per_call, cinfo.output_height - cinfo.output_scanline);
+        for (size_t i = 0; i < row_count; ++i)
+            rows[i] = get_scanline(static_cast<int>(cinfo.output_scanline + i));
+
+        if (jpeg_read_scanlines(&cinfo, rows.data(), row_count) == 0) {
+            dbgln("JPEG Warning: Decoding produced no more scanlines in scanline {}/{}.", cinfo.output_scanline, cinfo.output_height);
+            return false;
+        }
+    }
+    return true;
+}
+
+ErrorOr<IntSize> JPEGLoadingContext::read_image_size()
+{
+    if (!image_size.is_empty())
+        return image_size;
+
+    struct jpeg_decompress_struct cinfo;
+    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
+
+    struct JPEGErrorManager jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+
+    jpeg_source_mgr source_manager {};
+
+    if (setjmp(jerr.setjmp_buffer))
+        return Error::from_string_literal("Failed to decode JPEG");
+
+    jerr.error_exit = error_exit;
+
+    jpeg_create_decompress(&cinfo);
+
+    initialize_source_manager(source_manager);
+    cinfo.src = &source_manager;
+
+    if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
+        return Error::from_string_literal("Failed to read JPEG header");
+
+    image_size = { static_cast<int>(cinfo.image_width), static_cast<int>(cinfo.image_height) };
+    return image_size;
+}
+
+ErrorOr<void> JPEGLoadingContext::decode(unsigned requested_scale_denominator)
+{
+    rgb_bitmap = nullptr;
+    cmyk_bitmap = nullptr;
+
+    struct jpeg_decompress_struct cinfo;
+    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
+
+    struct JPEGErrorManager jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+
+    jpeg_source_mgr source_manager {};
+
+    if (setjmp(jerr.setjmp_buffer))
+        return Error::from_string_literal("Failed to decode JPEG");
+
+    jerr.error_exit = error_exit;
+
+    jpeg_create_decompress(&cinfo);
+
+    initialize_source_manager(source_manager);
     cinfo.src = &source_manager;
 
     jpeg_save_markers(&cinfo, JPEG_APP0 + 2, 0xFFFF);
     if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
         return Error::from_string_literal("Failed to read JPEG header");
 
+    image_size = { static_cast<int>(cinfo.image_width), static_cast<int>(cinfo.image_height) };
+
     if (cinfo.jpeg_color_space == JCS_CMYK) {
         cinfo.out_color_space = JCS_CMYK;
     } else if (cinfo.jpeg_color_space == JCS_YCCK) {
@@ -89,31 +164,20 @@ ErrorOr<void> JPEGLoadingContext::decode()
         cinfo.out_color_space = JCS_EXT_BGRX;
     }
 
+    // NOTE: Scaling the image down while decoding it lets libjpeg-turbo skip most of the IDCT work.
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = requested_scale_denominator;
+    scale_denominator = requested_scale_denominator;
+
     jpeg_start_decompress(&cinfo);
     bool could_read_all_scanlines = true;
 
     if (cinfo.out_color_space == JCS_EXT_BGRX) {
         rgb_bitmap = TRY(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRx8888, { static_cast<int>(cinfo.output_width), static_cast<int>(cinfo.output_height) }));
-        while (cinfo.output_scanline < cinfo.output_height) {
-            auto* row_ptr = (u8*)rgb_bitmap->scanline(cinfo.output_scanline);
-            auto out_size = jpeg_read_scanlines(&cinfo, &row_ptr, 1);
-            if (cinfo.output_scanline < cinfo.output_height && out_size == 0) {
-                dbgln("JPEG Warning: Decoding produced no more scanlines in scanline {}/{}.", cinfo.output_scanline, cinfo.output_height);
-                could_read_all_scanlines = false;
-                break;
-            }
-        }
+        could_read_all_scanlines = read_scanlines(cinfo, [&](int y) { return rgb_bitmap->scanline_u8(y); });
     } else {
         cmyk_bitmap = TRY(CMYKBitmap::create_with_size({ static_cast<int>(cinfo.output_width), static_cast<int>(cinfo.output_height) }));
-        while (cinfo.output_scanline < cinfo.output_height) {
-            auto* row_ptr = (u8*)cmyk_bitmap->scanline(cinfo.output_scanline);
-            auto out_size = jpeg_read_scanlines(&cinfo, &row_ptr, 1);
-            if (cinfo.output_scanline < cinfo.output_height && out_size == 0) {
-                dbgln("JPEG Warning: Decoding produced no more scanlines in scanline {}/{}.", cinfo.output_scanline, cinfo.output_height);
-                could_read_all_scanlines = false;
-                break;
-            }
-        }
+        could_read_all_scanlines = read_scanlines(cinfo, [&](int y) { return reinterpret_cast<u8*>(cmyk_bitmap->scanline(y)); });
 
         // If image is in YCCK color space, we convert it to CMYK
         // and then CMYK code path will handle the rest
@@ -166,6 +230,78 @@ ErrorOr<void> JPEGLoadingContext::decode()
     return {};
 }
 
+// Decodes as much of the image as the data allows. Baseline images are decoded from the top down, so the rows that have
+// not arrived yet are left transparent. Progressive images are decoded at the quality of the last complete scan.
+ErrorOr<void> JPEGLoadingContext::decode_partially()
+{
+    struct jpeg_decompress_struct cinfo;
+    ScopeGuard guard { [&]() { jpeg_destroy_decompress(&cinfo); } };
+
+    struct JPEGErrorManager jerr;
+    cinfo.err = jpeg_std_error(&jerr);
+
+    jpeg_source_mgr source_manager {};
+
+    if (setjmp(jerr.setjmp_buffer))
+        return Error::from_string_literal("Failed to decode JPEG");
+
+    jerr.error_exit = error_exit;
+
+    jpeg_create_decompress(&cinfo);
+
+    initialize_source_manager(source_manager);
+    cinfo.src = &source_manager;
+
+    if (jpeg_read_header(&cinfo, TRUE) != JPEG_HEADER_OK)
+        return Error::from_string_literal("Not enough data to read JPEG header");
+
+    if (cinfo.jpeg_color_space == JCS_CMYK || cinfo.jpeg_color_space == JCS_YCCK)
+        return Error::from_string_literal("Partially decoding CMYK JPEGs is not supported");
+
+    cinfo.out_color_space = JCS_EXT_BGRA;
+
+    auto is_progressive = jpeg_has_multiple_scans(&cinfo);
+    cinfo.buffered_image = is_progressive;
+
+    if (!jpeg_start_decompress(&cinfo))
+        return Error::from_string_literal("Not enough data to start decoding JPEG");
+
+    if (is_progressive) {
+        int status = 0;
+        do {
+            status = jpeg_consume_input(&cinfo);
+        } while (status != JPEG_SUSPENDED && status != JPEG_REACHED_EOI);
+
+        // The scan that is still arriving would make us wait for its data, so we display the one before it.
+        auto scan_number = cinfo.input_scan_number;
+        if (!jpeg_input_complete(&cinfo))
+            --scan_number;
+        if (scan_number < 1)
+            return Error::from_string_literal("Not enough data to decode a JPEG scan");
+
+        if (!jpeg_start_output(&cinfo, scan_number))
+            return Error::from_string_literal("Not enough data to decode a JPEG scan");
+    }
+
+    // NOTE: New bitmaps are zero-initialized, so every row that we don't decode stays transparent.
+    partial_bitmap = TRY(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, { static_cast<int>(cinfo.output_width), static_cast<int>(cinfo.output_height) }));
+
+    while (cinfo.output_scanline < cinfo.output_height) {
+        auto* row_ptr = (u8*)partial_bitmap->scanline(cinfo.output_scanline);
+        if (jpeg_read_scanlines(&cinfo, &row_ptr, 1) == 0)
+            break;
+    }
+
+    auto decoded_any_scanlines = cinfo.output_scanline > 0;
+    jpeg_abort_decompress(&cinfo);
+
+    if (!decoded_any_scanlines) {
+        partial_bitmap = nullptr;
+        return Error::from_string_literal("Not enough data to decode any JPEG scanlines");
+    }
+    return {};
+}
+
 JPEGImageDecoderPlugin::JPEGImageDecoderPlugin(NonnullOwnPtr<JPEGLoadingContext> context)
     : m_context(move(context))
 {
@@ -180,11 +316,7 @@ IntSize JPEGImageDecoderPlugin::size()
 
     if (m_context->state == JPEGLoadingContext::State::Error)
         return {};
-    if (m_context->rgb_bitmap)
-        return m_context->rgb_bitmap->size();
-    if (m_context->cmyk_bitmap)
-        return m_context->cmyk_bitmap->size();
-    return {};
+    return m_context->image_size;
 }
 
 bool JPEGImageDecoderPlugin::sniff(ReadonlyBytes data)
@@ -200,7 +332,25 @@ ErrorOr<NonnullOwnPtr<ImageDecoderPlugin>> JPEGImageDecoderPlugin::create(Readon
     return adopt_own(*new JPEGImageDecoderPlugin(make<JPEGLoadingContext>(data)));
 }
 
-ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize>)
+// libjpeg-turbo can scale images down by 1/2, 1/4 and 1/8 while decoding them. We pick the smallest of those scales that
+// still yields a bitmap at least as large as the ideal size, so that it only ever needs to be scaled down further.
+static unsigned scale_denominator_for_ideal_size(IntSize image_size, Optional<IntSize> ideal_size)
+{
+    if (!ideal_size.has_value() || ideal_size->is_empty() || image_size.is_empty())
+        return 1;
+
+    unsigned scale_denominator = 1;
+    for (unsigned candidate : { 2u, 4u, 8u }) {
+        auto scaled_width = ceil_div(static_cast<unsigned>(image_size.width()), candidate);
+        auto scaled_height = ceil_div(static_cast<unsigned>(image_size.height()), candidate);
+        if (scaled_width < static_cast<unsigned>(ideal_size->width()) || scaled_height < static_cast<unsigned>(ideal_size->height()))
+            break;
+        scale_denominator = candidate;
+    }
+    return scale_denominator;
+}
+
+ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Optional<IntSize> ideal_size)
 {
     if (index > 0)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Invalid frame index");
@@ -208,8 +358,15 @@ ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Option
     if (m_context->state == JPEGLoadingContext::State::Error)
         return Error::from_string_literal("JPEGImageDecoderPlugin: Decoding failed");
 
-    if (m_context->state < JPEGLoadingContext::State::Decoded) {
-        if (auto result = m_context->decode(); result.is_error()) {
+    // NOTE: The image size is only known once the header has been read, which happens as part of the first decode.
+    auto scale_denominator = 1u;
+    if (m_context->state == JPEGLoadingContext::State::Decoded)
+        scale_denominator = scale_denominator_for_ideal_size(m_context->image_size, ideal_size);
+    else if (ideal_size.has_value())
+        scale_denominator = scale_denominator_for_ideal_size(TRY(m_context->read_image_size()), ideal_size);
+
+    if (m_context->state < JPEGLoadingContext::State::Decoded || m_context->scale_denominator != scale_denominator) {
+        if (auto result = m_context->decode(scale_denominator); result.is_error()) {
             m_context->state = JPEGLoadingContext::State::Error;
             return result.release_error();
         }
@@ -220,6 +377,13 @@ ErrorOr<ImageFrameDescriptor> JPEGImageDecoderPlugin::frame(size_t index, Option
     return ImageFrameDescriptor { m_context->rgb_bitmap, 0 };
 }
 
+ErrorOr<NonnullRefPtr<Bitmap>> JPEGImageDecoderPlugin::partial_frame()
+{
+    if (!m_context->partial_bitmap)
+        TRY(m_context->decode_partially());
+    return *m_context->partial_bitmap;
+}
+
 Optional<Metadata const&> JPEGImageDecoderPlugin::metadata()
 {
     return OptionalNone {};
@@ -247,7 +411,7 @@ NaturalFrameFormat JPEGImageDecoderPlugin::natural_frame_format() const
 
 ErrorOr<NonnullRefPtr<CMYKBitmap>> JPEGImageDecoderPlugin::cmyk_frame()
 {
-    if (m_context->state == JPEGLoadingContext::State::NotDecoded)
+    if (m_context->state == JPEGLoadingContext::State::NotDecoded || m_context->scale_denominator != 1)
         (void)frame(0);
 
     if (m_context->state == JPEGLoadingContext::State::Error)
@@ -21,6 +21,7 @@ public:
     virtual IntSize size() override;
 
     virtual ErrorOr<ImageFrameDescriptor> frame(size_t index, Optional<IntSize> ideal_size = {}) override;
+    virtual ErrorOr<NonnullRefPtr<Bitmap>> partial_frame() override;
 
     virtual Optional<Metadata const&> metadata() override;
 
@@ -162,6 +162,17 @@ ErrorOr<void> PNGImageDecoderPlugin::initialize()
 
     png_set_error_fn(m_context->png_ptr, nullptr, log_png_error, log_png_warning);
 
+    // NOTE: Like other browsers, we don't verify the CRC of every chunk, nor the Adler-32 checksum of the compressed
+    //       image data. Corrupted data fails to decode anyway, and computing the checksums takes a noticeable share of
+    //       the decoding time of large images.
+    png_set_crc_action(m_context->png_ptr, PNG_CRC_QUIET_USE, PNG_CRC_QUIET_USE);
+#ifdef PNG_IGNORE_ADLER32
+    png_set_option(m_context->png_ptr, PNG_IGNORE_ADLER32, PNG_OPTION_ON);
+#endif
+
+    // Reading the compressed image data in larger pieces means fewer calls into zlib, each of which inflates more.
+    png_set_compression_buffer_size(m_context->png_ptr, 64 * KiB);
+
     png_read_info(m_context->png_ptr, m_context->info_ptr);
 
     u32 width = 0;
@@ -152,8 +152,22 @@ static ErrorOr<void> decode_webp_image(WebPLoadingContext& context)
         auto bitmap_format = context.has_alpha ? BitmapFormat::BGRA8888 : BitmapFormat::BGRx8888;
         auto bitmap = TRY(Bitmap::create(bitmap_format, Gfx::AlphaType::Unpremultiplied, context.size));
 
-        auto image_data = WebPDecodeBGRAInto(context.data.data(), context.data.size(), bitmap->scanline_u8(0), bitmap->data_size(), bitmap->pitch());
-        if (image_data == nullptr)
+        WebPDecoderConfig config;
+        if (!WebPInitDecoderConfig(&config))
+            return Error::from_string_literal("Failed to initialize webp decoder config");
+
+        // Lets libwebp apply the in-loop filter of lossy images on a second thread while it decodes the next rows.
+        config.options.use_threads = 1;
+
+        config.output.colorspace = MODE_BGRA;
+        config.output.is_external_memory = 1;
+        config.output.u.RGBA.rgba = bitmap->scanline_u8(0);
+        config.output.u.RGBA.stride = bitmap->pitch();
+        config.output.u.RGBA.size = bitmap->data_size();
+
+        auto status = WebPDecode(context.data.data(), context.data.size(), &config);
+        WebPFreeDecBuffer(&config.output);
+        if (status != VP8_STATUS_OK)
             return Error::from_string_literal("Failed to decode webp image into bitmap");
 
         auto duration = 0;
@@ -7,17 +7,22 @@
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibGfx/PaintingSurface.h>
 #include <LibGfx/SkiaUtils.h>
+#include <LibGfx/YUVData.h>
 
 #include <core/SkBitmap.h>
 #include <core/SkColorSpace.h>
 #include <core/SkImage.h>
+#include <core/SkImageGenerator.h>
+#include <core/SkPixmap.h>
+#include <core/SkYUVAInfo.h>
+#include <core/SkYUVAPixmaps.h>
 
 namespace Gfx {
 
 struct ImmutableBitmapImpl {
     sk_sp<SkImage> sk_image;
     SkBitmap sk_bitmap;
-    Variant<NonnullRefPtr<Gfx::Bitmap>, NonnullRefPtr<Gfx::PaintingSurface>, Empty> source;
+    Variant<NonnullRefPtr<Gfx::Bitmap>, NonnullRefPtr<Gfx::PaintingSurface>, NonnullRefPtr<Gfx::YUVData>, Empty> source;
     ColorSpace color_space;
 };
 
@@ -53,12 +58,30 @@ SkImage const* ImmutableBitmap::sk_image() const
 
 RefPtr<Gfx::Bitmap const> ImmutableBitmap::bitmap() const
 {
+    // NOTE: YUV data is only converted to RGB on the CPU when something asks for the pixels.
+    if (auto const* yuv_data = m_impl->source.get_pointer<NonnullRefPtr<Gfx::YUVData>>()) {
+        auto bitmap = (*yuv_data)->to_bitmap();
+        if (bitmap.is_error())
+            return nullptr;
+        return bitmap.release_value();
+    }
+
     // FIXME: Implement for PaintingSurface
     return m_impl->source.get<NonnullRefPtr<Gfx::Bitmap>>();
 }
 
 Color ImmutableBitmap::get_pixel(int x, int y) const
 {
+    if (m_impl->source.has<NonnullRefPtr<Gfx::YUVData>>()) {
+        // NOTE: Skia caches the pixels of lazily generated images, so reading single pixels does not convert the whole
+        //       image every time.
+        SkColor color = SK_ColorTRANSPARENT;
+        auto info = SkImageInfo::Make(1, 1, kBGRA_8888_SkColorType, kUnpremul_SkAlphaType);
+        if (!m_impl->sk_image->readPixels(nullptr, info, &color, sizeof(color), x, y))
+            return Color::Transparent;
+        return Color::from_argb(color);
+    }
+
     // FIXME: Implement for PaintingSurface
     return m_impl->source.get<NonnullRefPtr<Gfx::Bitmap>>()->get_pixel(x, y);
 }
@@ -108,6 +131,98 @@ NonnullRefPtr<ImmutableBitmap> ImmutableBitmap::create_snapshot_from_painting_su
     return adopt_ref(*new ImmutableBitmap(make<ImmutableBitmapImpl>(impl)));
 }
 
+// Generates the pixels of a YUV image on demand. When painting with a GPU, Skia asks for the planes instead, uploads them
+// as separate textures and converts them to RGB while drawing.
+class YUVImageGenerator final : public SkImageGenerator {
+public:
+    explicit YUVImageGenerator(NonnullRefPtr<YUVData> data)
+        : SkImageGenerator(SkImageInfo::Make(data->size().width(), data->size().height(), kBGRA_8888_SkColorType, kPremul_SkAlphaType))
+        , m_data(move(data))
+    {
+    }
+
+protected:
+    bool onGetPixels(SkImageInfo const& info, void* pixels, size_t row_bytes, Options const&) override
+    {
+        auto bitmap_or_error = m_data->to_bitmap();
+        if (bitmap_or_error.is_error())
+            return false;
+        auto bitmap = bitmap_or_error.release_value();
+
+        auto source_info = SkImageInfo::Make(bitmap->width(), bitmap->height(), to_skia_color_type(bitmap->format()), kPremul_SkAlphaType);
+        SkPixmap source { source_info, bitmap->scanline(0), bitmap->pitch() };
+        return source.readPixels(info, pixels, row_bytes);
+    }
+
+    bool onQueryYUVAInfo(SkYUVAPixmapInfo::SupportedDataTypes const& supported_data_types, SkYUVAPixmapInfo* pixmap_info) const override
+    {
+        static constexpr auto plane_config = SkYUVAInfo::PlaneConfig::kY_U_V;
+        static constexpr auto data_type = SkYUVAPixmapInfo::DataType::kUnorm8;
+        if (!supported_data_types.supported(plane_config, data_type))
+            return false;
+
+        auto subsampling = [&] {
+            switch (m_data->subsampling()) {
+            case YUVSubsampling::None:
+                return SkYUVAInfo::Subsampling::k444;
+            case YUVSubsampling::Horizontal:
+                return SkYUVAInfo::Subsampling::k422;
+            case YUVSubsampling::HorizontalAndVertical:
+                return SkYUVAInfo::Subsampling::k420;
+            }
+            VERIFY_NOT_REACHED();
+        }();
+
+        auto color_space = [&] {
+            auto is_full_range = m_data->range() == YUVRange::Full;
+            switch (m_data->matrix_coefficients()) {
+            case YUVMatrixCoefficients::BT601:
+                return is_full_range ? kJPEG_Full_SkYUVColorSpace : kRec601_Limited_SkYUVColorSpace;
+            case YUVMatrixCoefficients::BT709:
+                return is_full_range ? kRec709_Full_SkYUVColorSpace : kRec709_Limited_SkYUVColorSpace;
+            }
+            VERIFY_NOT_REACHED();
+        }();
+
+        SkYUVAInfo yuva_info { SkISize::Make(m_data->size().width(), m_data->size().height()), plane_config, subsampling, color_space };
+        size_t row_bytes[SkYUVAInfo::kMaxPlanes] {};
+        for (size_t plane = 0; plane < 3; ++plane)
+            row_bytes[plane] = static_cast<size_t>(m_data->plane_size(plane).width());
+
+        *pixmap_info = SkYUVAPixmapInfo { yuva_info, data_type, row_bytes };
+        return pixmap_info->isValid();
+    }
+
+    bool onGetYUVAPlanes(SkYUVAPixmaps const& pixmaps) override
+    {
+        for (size_t plane = 0; plane < 3; ++plane) {
+            auto const& destination = pixmaps.plane(static_cast<int>(plane));
+            auto source = m_data->plane(plane);
+            auto plane_size = m_data->plane_size(plane).to_type<size_t>();
+            VERIFY(source.size() >= plane_size.area());
+
+            auto* destination_row = static_cast<u8*>(destination.writable_addr());
+            for (size_t row = 0; row < plane_size.height(); ++row) {
+                memcpy(destination_row, source.offset_pointer(row * plane_size.width()), plane_size.width());
+                destination_row += destination.rowBytes();
+            }
+        }
+        return true;
+    }
+
+private:
+    NonnullRefPtr<YUVData> m_data;
+};
+
+NonnullRefPtr<ImmutableBitmap> ImmutableBitmap::create_from_yuv(NonnullRefPtr<YUVData> data)
+{
+    ImmutableBitmapImpl impl;
+    impl.sk_image = SkImages::DeferredFromGenerator(std::make_unique<YUVImageGenerator>(data));
+    VERIFY(impl.sk_image);
+    impl.source = move(data);
+    return adopt_ref(*new ImmutableBitmap(make<ImmutableBitmapImpl>(impl)));
+}
+
 ImmutableBitmap::ImmutableBitmap(NonnullOwnPtr<ImmutableBitmapImpl> impl)
     : m_impl(move(impl))
 {
@@ -142,6 +142,17 @@ void PainterSkia::fill_rect(Gfx::FloatRect const& rect, Color color)
     });
 }
 
+void PainterSkia::fill_rects(ReadonlySpan<Gfx::FloatRect> rects, Color color)
+{
+    SkPaint paint;
+    paint.setAntiAlias(true);
+    paint.setColor(to_skia_color(color));
+    impl().with_canvas([&](auto& canvas) {
+        for (auto const& rect : rects)
+            canvas.drawRect(to_skia_rect(rect), paint);
+    });
+}
+
 void PainterSkia::draw_bitmap(Gfx::FloatRect const& dst_rect, Gfx::ImmutableBitmap const& src_bitmap, Gfx::IntRect const& src_rect, Gfx::ScalingMode scaling_mode, ReadonlySpan<Gfx::Filter> filters, float global_alpha, Gfx::CompositingAndBlendingOperator compositing_and_blending_operator)
 {
     SkPaint paint;
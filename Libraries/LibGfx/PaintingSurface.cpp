@@ -108,6 +108,21 @@ void PaintingSurface::read_into_bitmap(Bitmap& bitmap)
     m_impl->surface->readPixels(pixmap, 0, 0);
 }
 
+void PaintingSurface::read_into_bitmap(Bitmap& bitmap, IntRect const& rect)
+{
+    auto rect_to_read = rect.intersected(bitmap.rect());
+    if (rect_to_read.is_empty())
+        return;
+    auto color_type = to_skia_color_type(bitmap.format());
+    auto alpha_type = to_skia_alpha_type(bitmap.format(), bitmap.alpha_type());
+    auto image_info = SkImageInfo::Make(bitmap.width(), bitmap.height(), color_type, alpha_type, SkColorSpace::MakeSRGB());
+    SkPixmap const pixmap(image_info, bitmap.begin(), bitmap.pitch());
+    SkPixmap subset;
+    if (!pixmap.extractSubset(&subset, SkIRect::MakeXYWH(rect_to_read.x(), rect_to_read.y(), rect_to_read.width(), rect_to_read.height())))
+        return;
+    m_impl->surface->readPixels(subset, rect_to_read.x(), rect_to_read.y());
+}
+
 void PaintingSurface::write_from_bitmap(Bitmap const& bitmap)
 {
     auto color_type = to_skia_color_type(bitmap.format());
@@ -117,6 +132,39 @@ void PaintingSurface::write_from_bitmap(Bitmap const& bitmap)
     m_impl->surface->writePixels(pixmap, 0, 0);
 }
 
+void PaintingSurface::read_pixels(Bitmap& bitmap, IntPoint source_position)
+{
+    auto color_type = to_skia_color_type(bitmap.format());
+    auto alpha_type = to_skia_alpha_type(bitmap.format(), bitmap.alpha_type());
+    auto image_info = SkImageInfo::Make(bitmap.width(), bitmap.height(), color_type, alpha_type, SkColorSpace::MakeSRGB());
+    SkPixmap const pixmap(image_info, bitmap.begin(), bitmap.pitch());
+
+    // NOTE: Skia swizzles and (un)premultiplies the pixels straight into the bitmap, and only copies the part of the
+    //       rect that overlaps the surface.
+    lock_context();
+    m_impl->surface->readPixels(pixmap, source_position.x(), source_position.y());
+    unlock_context();
+}
+
+void PaintingSurface::write_pixels(Bitmap const& bitmap, IntRect const& source_rect, IntPoint destination_position)
+{
+    auto rect_to_write = source_rect.intersected(bitmap.rect());
+    if (rect_to_write.is_empty())
+        return;
+
+    auto color_type = to_skia_color_type(bitmap.format());
+    auto alpha_type = to_skia_alpha_type(bitmap.format(), bitmap.alpha_type());
+    auto image_info = SkImageInfo::Make(bitmap.width(), bitmap.height(), color_type, alpha_type, SkColorSpace::MakeSRGB());
+    SkPixmap const pixmap(image_info, bitmap.begin(), bitmap.pitch());
+    SkPixmap subset;
+    if (!pixmap.extractSubset(&subset, SkIRect::MakeXYWH(rect_to_write.x(), rect_to_write.y(), rect_to_write.width(), rect_to_write.height())))
+        return;
+
+    lock_context();
+    m_impl->surface->writePixels(subset, destination_position.x(), destination_position.y());
+    unlock_context();
+}
+
 IntSize PaintingSurface::size() const
 {
     return m_impl->size;
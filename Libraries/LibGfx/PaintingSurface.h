@@ -40,8 +40,17 @@ public:
 #endif
 
     void read_into_bitmap(Bitmap&);
+    void read_into_bitmap(Bitmap&, IntRect const&);
     void write_from_bitmap(Bitmap const&);
 
+    // Reads the pixels of the surface starting at source_position into the bitmap, converting them to the format and
+    // alpha type of the bitmap. Pixels of the bitmap that fall outside of the surface are left untouched.
+    void read_pixels(Bitmap&, IntPoint source_position);
+
+    // Replaces the pixels of the surface starting at destination_position with the pixels in source_rect of the bitmap.
+    // Unlike drawing the bitmap, this does not blend, and ignores the transform and clip of the canvas.
+    void write_pixels(Bitmap const&, IntRect const& source_rect, IntPoint destination_position);
+
     void notify_content_will_change();
 
     IntSize size() const;
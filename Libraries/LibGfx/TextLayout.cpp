@@ -9,6 +9,7 @@
 #include "TextLayout.h"
 #include <AK/TypeCasts.h>
 #include <LibGfx/Point.h>
+#include <LibGfx/TextShapingCache.h>
 #include <harfbuzz/hb.h>
 
 namespace Gfx {
@@ -52,7 +53,7 @@ Vector<NonnullRefPtr<GlyphRun>> shape_text(FloatPoint baseline_start, Utf8View s
     return runs;
 }
 
-RefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf8View string, Gfx::Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+static TextShapingCache::ShapedText shape_text_with_harfbuzz(float letter_spacing, Utf8View string, Gfx::Font const& font, ShapeFeatures const& features)
 {
     static hb_buffer_t* buffer = hb_buffer_create();
     hb_buffer_add_utf8(buffer, reinterpret_cast<char const*>(string.bytes()), string.byte_length(), 0, -1);
@@ -84,13 +85,14 @@ RefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf
     auto* positions = hb_buffer_get_glyph_positions(buffer, &glyph_count);
 
     Vector<Gfx::DrawGlyph> glyph_run;
-    FloatPoint point = baseline_start;
+    glyph_run.ensure_capacity(glyph_count);
+    FloatPoint point;
     for (size_t i = 0; i < glyph_count; ++i) {
 
         auto position = point
             - FloatPoint { 0, font.pixel_metrics().ascent }
             + FloatPoint { positions[i].x_offset, positions[i].y_offset } / text_shaping_resolution;
-        glyph_run.append({ position, glyph_info[i].codepoint });
+        glyph_run.unchecked_append({ position, glyph_info[i].codepoint });
         point += FloatPoint { positions[i].x_advance, positions[i].y_advance } / text_shaping_resolution;
 
         // don't apply spacing to last glyph
@@ -99,9 +101,34 @@ RefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf
             point.translate_by(letter_spacing, 0);
     }
 
-    auto run = adopt_ref(*new Gfx::GlyphRun(move(glyph_run), font, text_type, point.x() - baseline_start.x()));
     hb_buffer_reset(buffer);
-    return run;
+    return { move(glyph_run), point.x() };
+}
+
+RefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf8View string, Gfx::Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+{
+    // NOTE: Glyphs are shaped relative to the origin and cached that way, then moved to the requested baseline.
+    auto make_glyph_run = [&](Vector<DrawGlyph> glyphs, float width) {
+        if (!baseline_start.is_zero()) {
+            for (auto& glyph : glyphs)
+                glyph.translate_by(baseline_start);
+        }
+        return adopt_ref(*new Gfx::GlyphRun(move(glyphs), font, text_type, width));
+    };
+
+    if (!TextShapingCache::can_cache(string)) {
+        auto shaped_text = shape_text_with_harfbuzz(letter_spacing, string, font, features);
+        return make_glyph_run(move(shaped_text.glyphs), shaped_text.width);
+    }
+
+    auto& cache = font.text_shaping_cache();
+    if (auto const* shaped_text = cache.get(string, letter_spacing, features))
+        return make_glyph_run(shaped_text->glyphs, shaped_text->width);
+
+    auto shaped_text = shape_text_with_harfbuzz(letter_spacing, string, font, features);
+    auto glyph_run = make_glyph_run(shaped_text.glyphs, shaped_text.width);
+    cache.set(string, letter_spacing, features, move(shaped_text));
+    return glyph_run;
 }
 
 float measure_text_width(Utf8View const& string, Gfx::Font const& font, ShapeFeatures const& features)
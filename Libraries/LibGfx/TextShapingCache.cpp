@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringHash.h>
+#include <LibGfx/TextShapingCache.h>
+
+namespace Gfx {
+
+TextShapingCache::~TextShapingCache()
+{
+    m_entries_by_recency.clear();
+}
+
+u32 TextShapingCache::compute_hash(Utf8View const& text, float letter_spacing, ShapeFeatures const& features)
+{
+    auto hash = text.as_string().hash();
+    hash = pair_int_hash(hash, bit_cast<u32>(letter_spacing));
+    for (auto const& feature : features) {
+        hash = pair_int_hash(hash, string_hash(feature.tag, sizeof(feature.tag)));
+        hash = pair_int_hash(hash, feature.value);
+    }
+    return hash;
+}
+
+bool TextShapingCache::Entry::matches(u32 other_hash, Utf8View const& other_text, float other_letter_spacing, ShapeFeatures const& other_features) const
+{
+    if (hash != other_hash || letter_spacing != other_letter_spacing || features.size() != other_features.size())
+        return false;
+    if (text.view() != other_text.as_string())
+        return false;
+    for (size_t i = 0; i < features.size(); ++i) {
+        if (features[i].value != other_features[i].value || __builtin_memcmp(features[i].tag, other_features[i].tag, sizeof(features[i].tag)) != 0)
+            return false;
+    }
+    return true;
+}
+
+TextShapingCache::ShapedText const* TextShapingCache::get(Utf8View const& text, float letter_spacing, ShapeFeatures const& features)
+{
+    auto hash = compute_hash(text, letter_spacing, features);
+    auto it = m_entries.find(hash, [&](auto const& entry) { return entry->matches(hash, text, letter_spacing, features); });
+    if (it == m_entries.end())
+        return nullptr;
+
+    auto& entry = **it;
+    m_entries_by_recency.prepend(entry);
+    return &entry.shaped_text;
+}
+
+void TextShapingCache::set(Utf8View const& text, float letter_spacing, ShapeFeatures const& features, ShapedText shaped_text)
+{
+    VERIFY(can_cache(text));
+
+    if (m_entries.size() >= max_number_of_entries) {
+        auto* least_recently_used = m_entries_by_recency.last();
+        m_entries_by_recency.remove(*least_recently_used);
+        auto it = m_entries.find(least_recently_used->hash, [&](auto const& entry) { return entry.ptr() == least_recently_used; });
+        VERIFY(it != m_entries.end());
+        m_entries.remove(it);
+    }
+
+    auto entry = make<Entry>();
+    entry->hash = compute_hash(text, letter_spacing, features);
+    entry->text = text.as_string();
+    entry->letter_spacing = letter_spacing;
+    entry->features = features;
+    entry->shaped_text = move(shaped_text);
+    m_entries_by_recency.prepend(*entry);
+    m_entries.set(move(entry));
+}
+
+}
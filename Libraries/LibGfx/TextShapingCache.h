@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashTable.h>
+#include <AK/IntrusiveList.h>
+#include <AK/NonnullOwnPtr.h>
+#include <LibGfx/TextLayout.h>
+
+namespace Gfx {
+
+// Remembers the result of shaping short runs of text with one font, so that text which is laid out again
+// (e.g. on every relayout of a page) doesn't have to go through HarfBuzz again.
+// Entries are evicted in least recently used order once the cache is full.
+class TextShapingCache {
+    AK_MAKE_NONCOPYABLE(TextShapingCache);
+    AK_MAKE_NONMOVABLE(TextShapingCache);
+
+public:
+    static constexpr size_t max_number_of_entries = 1024;
+    static constexpr size_t max_cached_text_length_in_bytes = 256;
+
+    // Glyphs are positioned relative to a baseline starting at the origin.
+    struct ShapedText {
+        Vector<DrawGlyph> glyphs;
+        float width { 0 };
+    };
+
+    TextShapingCache() = default;
+    ~TextShapingCache();
+
+    static bool can_cache(Utf8View const& text) { return text.byte_length() <= max_cached_text_length_in_bytes; }
+
+    ShapedText const* get(Utf8View const& text, float letter_spacing, ShapeFeatures const&);
+    void set(Utf8View const& text, float letter_spacing, ShapeFeatures const&, ShapedText);
+
+private:
+    struct Entry {
+        u32 hash { 0 };
+        ByteString text;
+        float letter_spacing { 0 };
+        ShapeFeatures features;
+        ShapedText shaped_text;
+
+        IntrusiveListNode<Entry> list_node;
+
+        bool matches(u32 hash, Utf8View const& text, float letter_spacing, ShapeFeatures const&) const;
+    };
+
+    struct EntryTraits : public DefaultTraits<NonnullOwnPtr<Entry>> {
+        static unsigned hash(NonnullOwnPtr<Entry> const& entry) { return entry->hash; }
+        static bool equals(NonnullOwnPtr<Entry> const& a, NonnullOwnPtr<Entry> const& b) { return a.ptr() == b.ptr(); }
+    };
+
+    static u32 compute_hash(Utf8View const& text, float letter_spacing, ShapeFeatures const&);
+
+    HashTable<NonnullOwnPtr<Entry>, EntryTraits> m_entries;
+
+    // Most recently used entries are at the front.
+    IntrusiveList<&Entry::list_node> m_entries_by_recency;
+};
+
+}
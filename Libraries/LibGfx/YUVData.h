@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/Error.h>
+#include <AK/Span.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Size.h>
+
+namespace Gfx {
+
+enum class YUVSubsampling {
+    None,
+    Horizontal,
+    HorizontalAndVertical,
+};
+
+enum class YUVMatrixCoefficients {
+    BT601,
+    BT709,
+};
+
+enum class YUVRange {
+    Studio,
+    Full,
+};
+
+// Three-plane, 8-bit YUV image data, as it comes out of a video decoder. Painting an ImmutableBitmap created from this
+// lets the GPU painter upload the planes as they are and convert them to RGB in a shader. Painting it without a GPU
+// falls back to to_bitmap().
+class YUVData : public AtomicRefCounted<YUVData> {
+public:
+    virtual ~YUVData() = default;
+
+    IntSize size() const { return m_size; }
+    YUVSubsampling subsampling() const { return m_subsampling; }
+    YUVMatrixCoefficients matrix_coefficients() const { return m_matrix_coefficients; }
+    YUVRange range() const { return m_range; }
+
+    IntSize plane_size(size_t plane) const
+    {
+        VERIFY(plane < 3);
+        if (plane == 0 || m_subsampling == YUVSubsampling::None)
+            return m_size;
+        auto chroma_width = (m_size.width() + 1) / 2;
+        if (m_subsampling == YUVSubsampling::Horizontal)
+            return { chroma_width, m_size.height() };
+        return { chroma_width, (m_size.height() + 1) / 2 };
+    }
+
+    // The rows of each plane are tightly packed, one byte per sample.
+    virtual ReadonlyBytes plane(size_t) const = 0;
+
+    virtual ErrorOr<NonnullRefPtr<Bitmap>> to_bitmap() const = 0;
+
+protected:
+    YUVData(IntSize size, YUVSubsampling subsampling, YUVMatrixCoefficients matrix_coefficients, YUVRange range)
+        : m_size(size)
+        , m_subsampling(subsampling)
+        , m_matrix_coefficients(matrix_coefficients)
+        , m_range(range)
+    {
+    }
+
+private:
+    IntSize m_size;
+    YUVSubsampling m_subsampling;
+    YUVMatrixCoefficients m_matrix_coefficients;
+    YUVRange m_range;
+};
+
+}
@@ -7,6 +7,7 @@
 #include <AK/HashMap.h>
 #include <AK/Optional.h>
 #include <AK/Span.h>
+#include <AK/Traits.h>
 #include <AK/Variant.h>
 #include <AK/Vector.h>
 #include <LibCore/SharedCircularQueue.h>
@@ -73,4 +74,9 @@ concept Optional = SpecializationOf<T, AK::Optional>;
 template<typename T>
 concept Variant = SpecializationOf<T, AK::Variant>;
 
+// Types whose in-memory representation is also their wire format. Containers of these are encoded
+// and decoded with a single copy rather than element by element.
+template<typename T>
+concept TriviallySerializable = AK::Traits<T>::is_trivially_serializable();
+
 }
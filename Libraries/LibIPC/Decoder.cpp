@@ -23,6 +23,13 @@ ErrorOr<size_t> Decoder::decode_size()
     return static_cast<size_t>(TRY(decode<u32>()));
 }
 
+ErrorOr<ReadonlyBytes> Decoder::decode_view(size_t size)
+{
+    if (!m_memory_stream)
+        return Error::from_string_literal("Views can only be decoded from memory");
+    return TRY(m_memory_stream->read_in_place<u8 const>(size));
+}
+
 template<>
 ErrorOr<String> decode(Decoder& decoder)
 {
@@ -57,6 +64,21 @@ ErrorOr<ByteBuffer> decode(Decoder& decoder)
     return buffer;
 }
 
+template<>
+ErrorOr<StringView> decode(Decoder& decoder)
+{
+    auto length = TRY(decoder.decode_size());
+    auto bytes = TRY(decoder.decode_view(length));
+    return StringView { bytes };
+}
+
+template<>
+ErrorOr<ReadonlyBytes> decode(Decoder& decoder)
+{
+    auto size = TRY(decoder.decode_size());
+    return decoder.decode_view(size);
+}
+
 template<>
 ErrorOr<JsonValue> decode(Decoder& decoder)
 {
@@ -8,8 +8,10 @@
 #pragma once
 
 #include <AK/ByteString.h>
+#include <AK/Checked.h>
 #include <AK/Concepts.h>
 #include <AK/Forward.h>
+#include <AK/MemoryStream.h>
 #include <AK/NumericLimits.h>
 #include <AK/Queue.h>
 #include <AK/StdLibExtras.h>
@@ -43,6 +45,16 @@ public:
     {
     }
 
+    // When decoding from memory, ReadonlyBytes and StringView values are decoded as views into the
+    // underlying buffer rather than being copied out of it. Such views are only valid for as long as
+    // that buffer is.
+    Decoder(FixedMemoryStream& stream, Queue<File>& files)
+        : m_stream(stream)
+        , m_memory_stream(&stream)
+        , m_files(files)
+    {
+    }
+
     template<typename T>
     ErrorOr<T> decode();
 
@@ -60,12 +72,14 @@ public:
     }
 
     ErrorOr<size_t> decode_size();
+    ErrorOr<ReadonlyBytes> decode_view(size_t size);
 
     Stream& stream() { return m_stream; }
     Queue<File>& files() { return m_files; }
 
 private:
     Stream& m_stream;
+    FixedMemoryStream* m_memory_stream { nullptr };
     Queue<File>& m_files;
 };
 
@@ -93,6 +107,12 @@ ErrorOr<ByteString> decode(Decoder&);
 template<>
 ErrorOr<ByteBuffer> decode(Decoder&);
 
+template<>
+ErrorOr<StringView> decode(Decoder&);
+
+template<>
+ErrorOr<ReadonlyBytes> decode(Decoder&);
+
 template<>
 ErrorOr<JsonValue> decode(Decoder&);
 
@@ -124,6 +144,12 @@ ErrorOr<T> decode(Decoder& decoder)
     auto size = TRY(decoder.decode_size());
     if (size != array.size())
         return Error::from_string_literal("Array size mismatch");
+
+    if constexpr (Concepts::TriviallySerializable<typename T::ValueType>) {
+        TRY(decoder.decode_into(Bytes { array.data(), array.size() * sizeof(typename T::ValueType) }));
+        return array;
+    }
+
     for (size_t i = 0; i < array.size(); ++i)
         array[i] = TRY(decoder.decode<typename T::ValueType>());
     return array;
@@ -135,6 +161,18 @@ ErrorOr<T> decode(Decoder& decoder)
     T vector;
 
     auto size = TRY(decoder.decode_size());
+
+    if constexpr (Concepts::TriviallySerializable<typename T::ValueType>) {
+        Checked<size_t> byte_count = size;
+        byte_count *= sizeof(typename T::ValueType);
+        if (byte_count.has_overflow())
+            return Error::from_string_literal("Vector size is too large");
+
+        TRY(vector.try_resize(size));
+        TRY(decoder.decode_into(Bytes { vector.data(), byte_count.value() }));
+        return vector;
+    }
+
     TRY(vector.try_ensure_capacity(size));
 
     for (size_t i = 0; i < size; ++i) {
@@ -119,8 +119,14 @@ ErrorOr<void> encode(Encoder&, Empty const&);
 template<Concepts::Span T>
 ErrorOr<void> encode(Encoder& encoder, T const& span)
 {
+    using ElementType = RemoveCVReference<decltype(*span.data())>;
     TRY(encoder.encode_size(span.size()));
 
+    if constexpr (Concepts::TriviallySerializable<ElementType>) {
+        TRY(encoder.append(reinterpret_cast<u8 const*>(span.data()), span.size() * sizeof(ElementType)));
+        return {};
+    }
+
     for (auto const& value : span)
         TRY(encoder.encode(value));
 
@@ -187,4 +193,32 @@ ErrorOr<void> Encoder::encode(T const& value)
     return IPC::encode(*this, value);
 }
 
+// Returns the number of bytes that encoding the given value is known to take, without encoding it.
+// Generated message encoders use this to size their buffer once up front. Values whose encoded size
+// is not cheaply known contribute nothing, and the buffer grows as they are encoded instead.
+template<typename T>
+size_t encoded_size_hint(T const& value)
+{
+    if constexpr (Concepts::TriviallySerializable<T>) {
+        return sizeof(T);
+    } else if constexpr (IsSame<T, StringView> || IsSame<T, ByteString>) {
+        return sizeof(u32) + value.length();
+    } else if constexpr (IsSame<T, String>) {
+        return sizeof(u32) + value.bytes_as_string_view().length();
+    } else if constexpr (IsSame<T, ByteBuffer>) {
+        return sizeof(u32) + value.size();
+    } else if constexpr (Concepts::Span<T>) {
+        using ElementType = RemoveCVReference<decltype(*value.data())>;
+        if constexpr (Concepts::TriviallySerializable<ElementType>)
+            return sizeof(u32) + value.size() * sizeof(ElementType);
+        return sizeof(u32);
+    } else if constexpr (Concepts::Vector<T> || Concepts::Array<T>) {
+        return encoded_size_hint(value.span());
+    } else if constexpr (Concepts::Optional<T>) {
+        return sizeof(bool) + (value.has_value() ? encoded_size_hint(value.value()) : 0);
+    } else {
+        return 0;
+    }
+}
+
 }
@@ -63,7 +63,8 @@ TransportSocket::TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket)
             if (send_queue->block_until_message_enqueued() == SendQueue::Running::No)
                 break;
 
-            auto [bytes, fds] = send_queue->peek(4096);
+            // Send everything that has been queued up in as few syscalls as possible, rather than one message at a time.
+            auto [bytes, fds] = send_queue->peek(SOCKET_BUFFER_SIZE);
             auto fds_count = fds.size();
             ReadonlyBytes remaining_to_send_bytes = bytes;
 
@@ -89,7 +90,8 @@ TransportSocket::TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket)
             if (!m_socket->is_open())
                 break;
 
-            {
+            // Only wait for the socket to become writable if the peer is not keeping up with us.
+            if (!remaining_to_send_bytes.is_empty()) {
                 Vector<struct pollfd, 1> pollfds;
                 pollfds.append({ .fd = m_socket->fd().value(), .events = POLLOUT, .revents = 0 });
 
@@ -149,14 +151,32 @@ struct MessageHeader {
     enum class Type : u8 {
         Payload = 0,
         FileDescriptorAcknowledgement = 1,
+        // The payload is in shared memory, whose fd is the last one of the message. No payload bytes follow the header.
+        LargePayload = 2,
+        // The peer is done with the shared memory of this many large payloads. Uses fd_count for the count.
+        LargePayloadAcknowledgement = 3,
     };
     Type type { Type::Payload };
     u32 payload_size { 0 };
     u32 fd_count { 0 };
+
+    size_t inline_payload_size() const { return type == Type::LargePayload ? 0 : payload_size; }
 };
 
+// Shared memory for large payloads is allocated in multiples of this, so that buffers are more likely to be reusable.
+static constexpr size_t LARGE_PAYLOAD_BUFFER_GRANULARITY = 256 * KiB;
+static constexpr size_t MAXIMUM_POOLED_LARGE_PAYLOAD_BUFFER_SIZE = 16 * MiB;
+static constexpr size_t MAXIMUM_POOLED_LARGE_PAYLOAD_BUFFER_COUNT = 4;
+
 void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<NonnullRefPtr<AutoCloseFileDescriptor>> const& fds)
 {
+    if (bytes_to_write.size() >= LARGE_PAYLOAD_THRESHOLD) {
+        auto result = post_large_payload(bytes_to_write, fds);
+        if (!result.is_error())
+            return;
+        dbgln("TransportSocket::post_message: Sending large payload through the socket: {}", result.error());
+    }
+
     Vector<u8> message_buffer;
     message_buffer.resize(sizeof(MessageHeader) + bytes_to_write.size());
     MessageHeader header;
@@ -181,6 +201,72 @@ void TransportSocket::post_message(Vector<u8> const& bytes_to_write, Vector<Nonn
     m_send_queue->enqueue_message(move(message_buffer), move(raw_fds));
 }
 
+ErrorOr<void> TransportSocket::post_large_payload(Vector<u8> const& bytes_to_write, Vector<NonnullRefPtr<AutoCloseFileDescriptor>> const& fds)
+{
+    auto buffer = TRY(take_large_payload_buffer(bytes_to_write.size()));
+    memcpy(buffer.data<u8>(), bytes_to_write.data(), bytes_to_write.size());
+
+    // The buffer keeps its own fd for reuse, so the peer is sent a duplicate, which we close once the peer has received it.
+    auto buffer_fd = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) AutoCloseFileDescriptor(TRY(Core::System::dup(buffer.fd())))));
+
+    Vector<u8> message_buffer;
+    message_buffer.resize(sizeof(MessageHeader));
+    MessageHeader header;
+    header.payload_size = bytes_to_write.size();
+    header.fd_count = fds.size() + 1;
+    header.type = MessageHeader::Type::LargePayload;
+    memcpy(message_buffer.data(), &header, sizeof(MessageHeader));
+
+    auto raw_fds = Vector<int, 1> {};
+    raw_fds.ensure_capacity(fds.size() + 1);
+    for (auto const& fd : fds) {
+        m_fds_retained_until_received_by_peer.enqueue(fd);
+        raw_fds.unchecked_append(fd->value());
+    }
+    m_fds_retained_until_received_by_peer.enqueue(buffer_fd);
+    raw_fds.unchecked_append(buffer_fd->value());
+
+    // The peer acknowledges large payloads in the order in which they were sent, so they have to be queued in that order.
+    Threading::MutexLocker locker(m_large_payload_buffers_mutex);
+    m_large_payload_buffers_in_flight.enqueue(move(buffer));
+    m_send_queue->enqueue_message(move(message_buffer), move(raw_fds));
+    return {};
+}
+
+ErrorOr<Core::AnonymousBuffer> TransportSocket::take_large_payload_buffer(size_t size)
+{
+    {
+        Threading::MutexLocker locker(m_large_payload_buffers_mutex);
+
+        Optional<size_t> best_fit_index;
+        for (size_t i = 0; i < m_free_large_payload_buffers.size(); ++i) {
+            auto buffer_size = m_free_large_payload_buffers[i].size();
+            if (buffer_size >= size && (!best_fit_index.has_value() || buffer_size < m_free_large_payload_buffers[*best_fit_index].size()))
+                best_fit_index = i;
+        }
+
+        if (best_fit_index.has_value())
+            return m_free_large_payload_buffers.take(*best_fit_index);
+    }
+
+    return Core::AnonymousBuffer::create_with_size(round_up_to_power_of_two(size, LARGE_PAYLOAD_BUFFER_GRANULARITY));
+}
+
+void TransportSocket::did_receive_large_payload_acknowledgement(u32 count)
+{
+    Threading::MutexLocker locker(m_large_payload_buffers_mutex);
+
+    for (u32 i = 0; i < count; ++i) {
+        auto buffer = m_large_payload_buffers_in_flight.dequeue();
+        if (buffer.size() > MAXIMUM_POOLED_LARGE_PAYLOAD_BUFFER_SIZE)
+            continue;
+
+        if (m_free_large_payload_buffers.size() == MAXIMUM_POOLED_LARGE_PAYLOAD_BUFFER_COUNT)
+            m_free_large_payload_buffers.take_first();
+        m_free_large_payload_buffers.append(move(buffer));
+    }
+}
+
 ErrorOr<void> TransportSocket::send_message(Core::LocalSocket& socket, ReadonlyBytes& bytes_to_write, Vector<int>& unowned_fds)
 {
     auto num_fds_to_transfer = unowned_fds.size();
@@ -213,9 +299,8 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
 
     bool should_shutdown = false;
     while (is_open()) {
-        u8 buffer[4096];
         auto received_fds = Vector<int> {};
-        auto maybe_bytes_read = m_socket->receive_message({ buffer, 4096 }, MSG_DONTWAIT, received_fds);
+        auto maybe_bytes_read = m_socket->receive_message(m_receive_buffer, MSG_DONTWAIT, received_fds);
         if (maybe_bytes_read.is_error()) {
             auto error = maybe_bytes_read.release_error();
 
@@ -246,6 +331,8 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
 
     u32 received_fd_count = 0;
     u32 acknowledged_fd_count = 0;
+    u32 received_large_payload_count = 0;
+    u32 acknowledged_large_payload_count = 0;
     size_t index = 0;
     while (index + sizeof(MessageHeader) <= m_unprocessed_bytes.size()) {
         MessageHeader header;
@@ -261,13 +348,35 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
                 message.fds.enqueue(m_unprocessed_fds.dequeue());
             message.bytes.append(m_unprocessed_bytes.data() + index + sizeof(MessageHeader), header.payload_size);
             callback(move(message));
+        } else if (header.type == MessageHeader::Type::LargePayload) {
+            if (header.fd_count > m_unprocessed_fds.size())
+                break;
+            VERIFY(header.fd_count > 0);
+            Message message;
+            received_fd_count += header.fd_count;
+            for (size_t i = 0; i < header.fd_count - 1; ++i)
+                message.fds.enqueue(m_unprocessed_fds.dequeue());
+
+            auto buffer_file = m_unprocessed_fds.dequeue();
+            auto buffer = Core::AnonymousBuffer::create_from_anon_fd(buffer_file.take_fd(), header.payload_size);
+            if (buffer.is_error()) {
+                dbgln("TransportSocket::read_as_much_as_possible_without_blocking: Failed to map large payload: {}", buffer.error());
+                warnln("TransportSocket::read_as_much_as_possible_without_blocking: Failed to map large payload: {}", buffer.error());
+                VERIFY_NOT_REACHED();
+            }
+            message.bytes.append(buffer.value().data<u8>(), header.payload_size);
+            ++received_large_payload_count;
+            callback(move(message));
         } else if (header.type == MessageHeader::Type::FileDescriptorAcknowledgement) {
             VERIFY(header.payload_size == 0);
             acknowledged_fd_count += header.fd_count;
+        } else if (header.type == MessageHeader::Type::LargePayloadAcknowledgement) {
+            VERIFY(header.payload_size == 0);
+            acknowledged_large_payload_count += header.fd_count;
         } else {
             VERIFY_NOT_REACHED();
         }
-        index += header.payload_size + sizeof(MessageHeader);
+        index += header.inline_payload_size() + sizeof(MessageHeader);
     }
 
     if (should_shutdown)
@@ -280,6 +389,20 @@ TransportSocket::ShouldShutdown TransportSocket::read_as_many_messages_as_possib
         }
     }
 
+    if (acknowledged_large_payload_count > 0)
+        did_receive_large_payload_acknowledgement(acknowledged_large_payload_count);
+
+    if (received_large_payload_count > 0) {
+        Vector<u8> message_buffer;
+        message_buffer.resize(sizeof(MessageHeader));
+        MessageHeader header;
+        header.payload_size = 0;
+        header.fd_count = received_large_payload_count;
+        header.type = MessageHeader::Type::LargePayloadAcknowledgement;
+        memcpy(message_buffer.data(), &header, sizeof(MessageHeader));
+        m_send_queue->enqueue_message(move(message_buffer), {});
+    }
+
     if (received_fd_count > 0) {
         Vector<u8> message_buffer;
         message_buffer.resize(sizeof(MessageHeader));
@@ -9,6 +9,7 @@
 
 #include <AK/MemoryStream.h>
 #include <AK/Queue.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibCore/Socket.h>
 #include <LibThreading/ConditionVariable.h>
 #include <LibThreading/MutexProtected.h>
@@ -75,6 +76,9 @@ class TransportSocket {
 public:
     static constexpr socklen_t SOCKET_BUFFER_SIZE = 128 * KiB;
 
+    // Payloads at least this large are handed to the peer in shared memory, rather than being copied through the socket.
+    static constexpr size_t LARGE_PAYLOAD_THRESHOLD = 64 * KiB;
+
     explicit TransportSocket(NonnullOwnPtr<Core::LocalSocket> socket);
     ~TransportSocket();
 
@@ -104,8 +108,15 @@ public:
 private:
     static ErrorOr<void> send_message(Core::LocalSocket&, ReadonlyBytes& bytes, Vector<int>& unowned_fds);
 
+    ErrorOr<void> post_large_payload(Vector<u8> const&, Vector<NonnullRefPtr<AutoCloseFileDescriptor>> const&);
+    ErrorOr<Core::AnonymousBuffer> take_large_payload_buffer(size_t size);
+    void did_receive_large_payload_acknowledgement(u32 count);
+
     NonnullOwnPtr<Core::LocalSocket> m_socket;
     mutable Threading::RWLock m_socket_rw_lock;
+
+    // Large enough to drain a batch of messages in one syscall.
+    Array<u8, 64 * KiB> m_receive_buffer;
     ByteBuffer m_unprocessed_bytes;
     Queue<File> m_unprocessed_fds;
 
@@ -114,6 +125,12 @@ private:
     // descriptor contained in the message before the peer receives it. https://openradar.me/9477351
     Queue<NonnullRefPtr<AutoCloseFileDescriptor>> m_fds_retained_until_received_by_peer;
 
+    // Shared memory for large payloads is reused once the peer has acknowledged copying the payload out of it. This saves
+    // creating, mapping and faulting in fresh memory for every large message.
+    Threading::Mutex m_large_payload_buffers_mutex;
+    Vector<Core::AnonymousBuffer> m_free_large_payload_buffers;
+    Queue<Core::AnonymousBuffer> m_large_payload_buffers_in_flight;
+
     RefPtr<Threading::Thread> m_send_thread;
     RefPtr<SendQueue> m_send_queue;
 };
@@ -20,6 +20,11 @@ void Client::die()
         promise->reject(Error::from_string_literal("ImageDecoder disconnected"));
     }
     m_pending_decoded_images.clear();
+    m_pending_partial_images.clear();
+
+    auto pending_decoded_frames = move(m_pending_decoded_frames);
+    for (auto& [_, on_frames_decoded] : pending_decoded_frames)
+        on_frames_decoded(0, {});
 }
 
 NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes encoded_data, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
@@ -57,7 +62,58 @@ NonnullRefPtr<Core::Promise<DecodedImage>> Client::decode_image(ReadonlyBytes en
     return promise;
 }
 
-void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space)
+Optional<i64> Client::start_incremental_decoding(Function<void(NonnullRefPtr<Gfx::Bitmap>)> on_partial_image, NonnullRefPtr<Core::Promise<DecodedImage>> promise, Optional<ByteString> mime_type)
+{
+    auto response = send_sync_but_allow_failure<Messages::ImageDecoderServer::StartIncrementalDecoding>(move(mime_type));
+    if (!response) {
+        dbgln("ImageDecoder disconnected trying to start decoding an image");
+        return {};
+    }
+
+    auto image_id = response->image_id();
+    m_pending_decoded_images.set(image_id, move(promise));
+    m_pending_partial_images.set(image_id, move(on_partial_image));
+    return image_id;
+}
+
+void Client::append_incremental_data(i64 image_id, ReadonlyBytes data)
+{
+    auto buffer = ByteBuffer::copy(data);
+    if (buffer.is_error()) {
+        dbgln("Could not allocate buffer for image data: {}", buffer.error());
+        cancel_incremental_decoding(image_id);
+        return;
+    }
+    async_append_incremental_data(image_id, buffer.release_value());
+}
+
+void Client::finish_incremental_decoding(i64 image_id)
+{
+    m_pending_partial_images.remove(image_id);
+    async_finish_incremental_decoding(image_id);
+}
+
+void Client::cancel_incremental_decoding(i64 image_id)
+{
+    m_pending_partial_images.remove(image_id);
+    m_pending_decoded_images.remove(image_id);
+    async_cancel_decoding(image_id);
+}
+
+void Client::request_frames(i64 image_id, u32 first_frame_index, u32 count, Function<void(u32 first_frame_index, Vector<Frame>)> on_frames_decoded)
+{
+    VERIFY(!m_pending_decoded_frames.contains(image_id));
+    m_pending_decoded_frames.set(image_id, move(on_frames_decoded));
+    async_request_frames(image_id, first_frame_index, count);
+}
+
+void Client::release_image(i64 image_id)
+{
+    m_pending_decoded_frames.remove(image_id);
+    async_release_image(image_id);
+}
+
+void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, u32 frame_count)
 {
     auto bitmaps = move(bitmap_sequence.bitmaps);
     VERIFY(!bitmaps.is_empty());
@@ -70,7 +126,9 @@ void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gf
     auto promise = maybe_promise.release_value();
 
     DecodedImage image;
+    image.image_id = image_id;
     image.is_animated = is_animated;
+    image.frame_count = frame_count;
     image.loop_count = loop_count;
     image.scale = scale;
     image.frames.ensure_capacity(bitmaps.size());
@@ -88,6 +146,35 @@ void Client::did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gf
     promise->resolve(move(image));
 }
 
+void Client::did_decode_frames(i64 image_id, u32 first_frame_index, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations)
+{
+    auto on_frames_decoded = m_pending_decoded_frames.take(image_id);
+    if (!on_frames_decoded.has_value()) {
+        dbgln("ImageDecoderClient: No pending frames for image with ID {}", image_id);
+        return;
+    }
+
+    // NOTE: Frames that failed to decode end the sequence, as frames that follow them have nothing to be drawn on.
+    Vector<Frame> frames;
+    frames.ensure_capacity(bitmap_sequence.bitmaps.size());
+    for (size_t i = 0; i < bitmap_sequence.bitmaps.size(); ++i) {
+        if (!bitmap_sequence.bitmaps[i])
+            break;
+        frames.empend(bitmap_sequence.bitmaps[i].release_nonnull(), durations[i]);
+    }
+
+    on_frames_decoded.release_value()(first_frame_index, move(frames));
+}
+
+void Client::did_decode_partial_image(i64 image_id, Gfx::ShareableBitmap bitmap)
+{
+    auto on_partial_image = m_pending_partial_images.get(image_id);
+    if (!on_partial_image.has_value() || !bitmap.is_valid())
+        return;
+
+    (*on_partial_image)(*bitmap.bitmap());
+}
+
 void Client::did_fail_to_decode_image(i64 image_id, String error_message)
 {
     auto maybe_promise = m_pending_decoded_images.take(image_id);
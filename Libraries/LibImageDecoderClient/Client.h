@@ -21,11 +21,16 @@ struct Frame {
 };
 
 struct DecodedImage {
+    i64 image_id { 0 };
     bool is_animated { false };
     Gfx::FloatPoint scale { 1, 1 };
     u32 loop_count { 0 };
     Vector<Frame> frames;
     Gfx::ColorSpace color_space;
+
+    // If this is larger than the number of frames, the remaining frames must be requested with Client::request_frames(),
+    // and the image must be released with Client::release_image() once it is no longer needed.
+    u32 frame_count { 0 };
 };
 
 class Client final
@@ -40,15 +45,30 @@ public:
 
     NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, Function<ErrorOr<void>(DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected, Optional<Gfx::IntSize> ideal_size = {}, Optional<ByteString> mime_type = {});
 
+    // Starts decoding an image whose data is still arriving, which must then be handed over with
+    // append_incremental_data() and finish_incremental_decoding(). Partially decoded images are passed to
+    // on_partial_image as the data allows, and the promise is resolved once the image has been decoded in full.
+    Optional<i64> start_incremental_decoding(Function<void(NonnullRefPtr<Gfx::Bitmap>)> on_partial_image, NonnullRefPtr<Core::Promise<DecodedImage>>, Optional<ByteString> mime_type = {});
+    void append_incremental_data(i64 image_id, ReadonlyBytes);
+    void finish_incremental_decoding(i64 image_id);
+    void cancel_incremental_decoding(i64 image_id);
+
+    void request_frames(i64 image_id, u32 first_frame_index, u32 count, Function<void(u32 first_frame_index, Vector<Frame>)> on_frames_decoded);
+    void release_image(i64 image_id);
+
     Function<void()> on_death;
 
 private:
     virtual void die() override;
 
-    virtual void did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space) override;
+    virtual void did_decode_image(i64 image_id, bool is_animated, u32 loop_count, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations, Gfx::FloatPoint scale, Gfx::ColorSpace color_space, u32 frame_count) override;
+    virtual void did_decode_frames(i64 image_id, u32 first_frame_index, Gfx::BitmapSequence bitmap_sequence, Vector<u32> durations) override;
+    virtual void did_decode_partial_image(i64 image_id, Gfx::ShareableBitmap bitmap) override;
     virtual void did_fail_to_decode_image(i64 image_id, String error_message) override;
 
     HashMap<i64, NonnullRefPtr<Core::Promise<DecodedImage>>> m_pending_decoded_images;
+    HashMap<i64, Function<void(u32, Vector<Frame>)>> m_pending_decoded_frames;
+    HashMap<i64, Function<void(NonnullRefPtr<Gfx::Bitmap>)>> m_pending_partial_images;
 };
 
 }
@@ -826,9 +826,16 @@ void BindingPattern::dump(int indent) const
     }
 }
 
-FunctionNode::FunctionNode(RefPtr<Identifier const> name, ByteString source_text, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, FunctionParsingInsights parsing_insights, bool is_arrow_function, Vector<LocalVariable> local_variables_names)
+static ByteString source_text_for_range(UnrealizedSourceRange const& range)
+{
+    if (!range.source_code)
+        return {};
+    return range.source_code->code().bytes_as_string_view().substring_view(range.start_offset, range.end_offset - range.start_offset);
+}
+
+FunctionNode::FunctionNode(RefPtr<Identifier const> name, UnrealizedSourceRange source_text_range, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, FunctionParsingInsights parsing_insights, bool is_arrow_function, Vector<LocalVariable> local_variables_names)
     : m_name(move(name))
-    , m_source_text(move(source_text))
+    , m_source_text_range(move(source_text_range))
     , m_body(move(body))
     , m_parameters(move(parameters))
     , m_function_length(function_length)
@@ -844,6 +851,20 @@ FunctionNode::FunctionNode(RefPtr<Identifier const> name, ByteString source_text
 
 FunctionNode::~FunctionNode() = default;
 
+ByteString const& FunctionNode::source_text() const
+{
+    if (!m_source_text.has_value())
+        m_source_text = source_text_for_range(m_source_text_range);
+    return *m_source_text;
+}
+
+ByteString const& ClassExpression::source_text() const
+{
+    if (!m_source_text.has_value())
+        m_source_text = source_text_for_range(m_source_text_range);
+    return *m_source_text;
+}
+
 void FunctionNode::set_shared_data(RefPtr<SharedFunctionInstanceData> shared_data) const
 {
     m_shared_data = move(shared_data);
@@ -1824,6 +1824,7 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> CallExpression::generat
                 callee,
                 this_value,
                 argument_operands,
+                generator.next_call_site_cache(),
                 expression_string_index);
         }
     }
@@ -4,10 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashFunctions.h>
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Instruction.h>
 #include <LibJS/Bytecode/RegexTable.h>
+#include <LibJS/Runtime/Shape.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/SourceCode.h>
 
@@ -24,6 +26,7 @@ Executable::Executable(
     NonnullRefPtr<SourceCode const> source_code,
     size_t number_of_property_lookup_caches,
     size_t number_of_global_variable_caches,
+    size_t number_of_call_site_caches,
     size_t number_of_registers,
     bool is_strict_mode)
     : bytecode(move(bytecode))
@@ -37,6 +40,7 @@ Executable::Executable(
 {
     property_lookup_caches.resize(number_of_property_lookup_caches);
     global_variable_caches.resize(number_of_global_variable_caches);
+    call_site_caches.resize(number_of_call_site_caches);
 }
 
 Executable::~Executable() = default;
@@ -115,4 +119,26 @@ UnrealizedSourceRange Executable::source_range_at(size_t offset) const
     };
 }
 
+size_t MegamorphicPropertyCache::index_for(Shape const& shape, FlyString const& property_name)
+{
+    static_assert(is_power_of_two(number_of_entries));
+    return pair_int_hash(ptr_hash(&shape), property_name.hash()) & (number_of_entries - 1);
+}
+
+MegamorphicPropertyCache::Entry const* MegamorphicPropertyCache::find(Shape const& shape, FlyString const& property_name) const
+{
+    auto const& entry = m_entries[index_for(shape, property_name)];
+    if (entry.shape.ptr() != &shape || entry.property_name != property_name)
+        return nullptr;
+    return &entry;
+}
+
+void MegamorphicPropertyCache::set(Shape& shape, FlyString const& property_name, u32 property_offset)
+{
+    auto& entry = m_entries[index_for(shape, property_name)];
+    entry.shape = shape;
+    entry.property_name = property_name;
+    entry.property_offset = property_offset;
+}
+
 }
@@ -26,6 +26,11 @@ namespace JS::Bytecode {
 // Represents one polymorphic inline cache used for property lookups.
 struct PropertyLookupCache {
     static constexpr size_t max_number_of_shapes_to_remember = 4;
+
+    // Once a site has missed this many times, we consider it megamorphic and stop evicting entries
+    // from it on every miss. Own property lookups at such sites go through the MegamorphicPropertyCache instead.
+    static constexpr u32 max_number_of_misses_before_megamorphic = 32;
+
     struct Entry {
         WeakPtr<Shape> shape;
         Optional<u32> property_offset;
@@ -33,6 +38,29 @@ struct PropertyLookupCache {
         WeakPtr<PrototypeChainValidity> prototype_chain_validity;
     };
     AK::Array<Entry, max_number_of_shapes_to_remember> entries;
+    u32 number_of_misses { 0 };
+
+    [[nodiscard]] bool is_megamorphic() const { return number_of_misses >= max_number_of_misses_before_megamorphic; }
+};
+
+// A direct-mapped cache of (shape, property name) -> property offset, shared by all megamorphic property lookup sites.
+class MegamorphicPropertyCache {
+public:
+    struct Entry {
+        WeakPtr<Shape> shape;
+        FlyString property_name;
+        u32 property_offset { 0 };
+    };
+
+    [[nodiscard]] Entry const* find(Shape const&, FlyString const& property_name) const;
+    void set(Shape&, FlyString const& property_name, u32 property_offset);
+
+private:
+    static constexpr size_t number_of_entries = 1024;
+
+    static size_t index_for(Shape const&, FlyString const& property_name);
+
+    AK::Array<Entry, number_of_entries> m_entries;
 };
 
 struct GlobalVariableCache : public PropertyLookupCache {
@@ -42,6 +70,14 @@ struct GlobalVariableCache : public PropertyLookupCache {
     bool in_module_environment { false };
 };
 
+// Remembers the last ECMAScript function called from a call site, along with the size of its stack frame.
+// This lets repeated calls to the same function skip the generic frame size query and call it directly.
+struct CallSiteCache {
+    WeakPtr<ECMAScriptFunctionObject> callee;
+    u32 registers_and_constants_and_locals_count { 0 };
+    u32 formal_parameter_count { 0 };
+};
+
 struct SourceRecord {
     u32 source_start_offset {};
     u32 source_end_offset {};
@@ -61,6 +97,7 @@ public:
         NonnullRefPtr<SourceCode const>,
         size_t number_of_property_lookup_caches,
         size_t number_of_global_variable_caches,
+        size_t number_of_call_site_caches,
         size_t number_of_registers,
         bool is_strict_mode);
 
@@ -70,6 +107,7 @@ public:
     Vector<u8> bytecode;
     Vector<PropertyLookupCache> property_lookup_caches;
     Vector<GlobalVariableCache> global_variable_caches;
+    Vector<CallSiteCache> call_site_caches;
     NonnullOwnPtr<StringTable> string_table;
     NonnullOwnPtr<IdentifierTable> identifier_table;
     NonnullOwnPtr<RegexTable> regex_table;
@@ -340,6 +340,35 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
     if (undefined_constant.has_value())
         undefined_constant.value().operand().offset_index_by(number_of_registers);
 
+    // Pass: Thread jumps through blocks that do nothing but jump somewhere else.
+    auto resolve_jump_chain = [&](size_t block_index) {
+        // NOTE: The number of hops is bounded so that cycles of empty blocks (e.g `for (;;) {}`) don't loop forever.
+        for (size_t hops = 0; hops < generator.m_root_basic_blocks.size(); ++hops) {
+            auto const& target_block = *generator.m_root_basic_blocks[block_index];
+            if (!target_block.is_terminated() || target_block.size() == 0)
+                break;
+            auto const& first_instruction = *InstructionStreamIterator { target_block.instruction_stream() };
+            if (first_instruction.type() != Instruction::Type::Jump)
+                break;
+            auto next_block_index = static_cast<Op::Jump const&>(first_instruction).target().basic_block_index();
+            if (next_block_index == block_index)
+                break;
+            block_index = next_block_index;
+        }
+        return block_index;
+    };
+
+    for (auto& block : generator.m_root_basic_blocks) {
+        Bytecode::InstructionStreamIterator it(block->instruction_stream());
+        while (!it.at_end()) {
+            auto& instruction = const_cast<Instruction&>(*it);
+            instruction.visit_labels([&](Label& label) {
+                label = Label { static_cast<u32>(resolve_jump_chain(label.basic_block_index())) };
+            });
+            ++it;
+        }
+    }
+
     for (auto& block : generator.m_root_basic_blocks) {
         basic_block_start_offsets.append(bytecode.size());
         if (block->handler() || block->finalizer()) {
@@ -452,6 +481,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         node.source_code(),
         generator.m_next_property_lookup_cache,
         generator.m_next_global_variable_cache,
+        generator.m_next_call_site_cache,
         generator.m_next_register,
         is_strict_mode);
 
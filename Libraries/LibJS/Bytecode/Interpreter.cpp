@@ -36,6 +36,7 @@
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/Reference.h>
 #include <LibJS/Runtime/RegExpObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
@@ -377,6 +378,9 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
     size_t& program_counter = running_execution_context.program_counter;
     program_counter = entry_point;
 
+    if (SamplingProfiler::is_sample_requested()) [[unlikely]]
+        SamplingProfiler::take_requested_sample();
+
     // Declare a lookup table for computed goto with each of the `handle_*` labels
     // to avoid the overhead of a switch statement.
     // This is a GCC extension, but it's also supported by Clang.
@@ -397,6 +401,14 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         goto* bytecode_dispatch_table[static_cast<size_t>(next_instruction.type())];                \
     } while (0)
 
+    // NOTE: Control flow handlers jump straight to the next handler instead of going through `start`,
+    //       so that each of them gets its own indirect branch and branch predictor history.
+#define DISPATCH_CURRENT()                                                                          \
+    do {                                                                                            \
+        auto& next_instruction = *reinterpret_cast<Instruction const*>(&bytecode[program_counter]); \
+        goto* bytecode_dispatch_table[static_cast<size_t>(next_instruction.type())];                \
+    } while (0)
+
     for (;;) {
     start:
         for (;;) {
@@ -417,7 +429,10 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         handle_Jump: {
             auto& instruction = *reinterpret_cast<Op::Jump const*>(&bytecode[program_counter]);
             program_counter = instruction.target().address();
-            goto start;
+            // NOTE: Loops jump backwards through here, so this is where long-running code gets sampled.
+            if (SamplingProfiler::is_sample_requested()) [[unlikely]]
+                SamplingProfiler::take_requested_sample();
+            DISPATCH_CURRENT();
         }
 
         handle_JumpIf: {
@@ -426,14 +441,14 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
                 program_counter = instruction.true_target().address();
             else
                 program_counter = instruction.false_target().address();
-            goto start;
+            DISPATCH_CURRENT();
         }
 
         handle_JumpTrue: {
             auto& instruction = *reinterpret_cast<Op::JumpTrue const*>(&bytecode[program_counter]);
             if (get(instruction.condition()).to_boolean()) {
                 program_counter = instruction.target().address();
-                goto start;
+                DISPATCH_CURRENT();
             }
             DISPATCH_NEXT(JumpTrue);
         }
@@ -442,7 +457,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             auto& instruction = *reinterpret_cast<Op::JumpFalse const*>(&bytecode[program_counter]);
             if (!get(instruction.condition()).to_boolean()) {
                 program_counter = instruction.target().address();
-                goto start;
+                DISPATCH_CURRENT();
             }
             DISPATCH_NEXT(JumpFalse);
         }
@@ -453,7 +468,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
                 program_counter = instruction.true_target().address();
             else
                 program_counter = instruction.false_target().address();
-            goto start;
+            DISPATCH_CURRENT();
         }
 
 #define HANDLE_COMPARISON_OP(op_TitleCase, op_snake_case, numeric_operator)                                             \
@@ -470,7 +485,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
                 result = lhs.as_double() numeric_operator rhs.as_double();                                              \
             }                                                                                                           \
             program_counter = result ? instruction.true_target().address() : instruction.false_target().address();      \
-            goto start;                                                                                                 \
+            DISPATCH_CURRENT();                                                                                         \
         }                                                                                                               \
         auto result = op_snake_case(vm(), get(instruction.lhs()), get(instruction.rhs()));                              \
         if (result.is_error()) [[unlikely]] {                                                                           \
@@ -482,7 +497,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             program_counter = instruction.true_target().address();                                                      \
         else                                                                                                            \
             program_counter = instruction.false_target().address();                                                     \
-        goto start;                                                                                                     \
+        DISPATCH_CURRENT();                                                                                             \
     }
 
             JS_ENUMERATE_COMPARISON_OPS(HANDLE_COMPARISON_OP)
@@ -494,7 +509,7 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
                 program_counter = instruction.true_target().address();
             else
                 program_counter = instruction.false_target().address();
-            goto start;
+            DISPATCH_CURRENT();
         }
 
         handle_EnterUnwindContext: {
@@ -572,7 +587,93 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
         DISPATCH_NEXT(name);                                                                \
     }
 
-            HANDLE_INSTRUCTION(Add);
+    // NOTE: These handlers try the Int32 case inline before falling back to execute_impl(),
+    //       which handles doubles, strings, BigInts and everything else.
+#define HANDLE_INSTRUCTION_SLOW_PATH(name)                                                                                  \
+    do {                                                                                                                    \
+        auto result = instruction.execute_impl(*this);                                                                      \
+        if (result.is_error()) [[unlikely]] {                                                                               \
+            if (handle_exception(program_counter, result.error_value()) == HandleExceptionResponse::ExitFromExecutable)     \
+                return;                                                                                                     \
+            goto start;                                                                                                     \
+        }                                                                                                                   \
+        DISPATCH_NEXT(name);                                                                                                \
+    } while (0)
+
+#define HANDLE_INT32_ARITHMETIC_OP(name, would_overflow, int32_operator)                          \
+    handle_##name:                                                                                \
+    {                                                                                             \
+        auto& instruction = *reinterpret_cast<Op::name const*>(&bytecode[program_counter]);       \
+        auto lhs = get(instruction.lhs());                                                        \
+        auto rhs = get(instruction.rhs());                                                        \
+        if (lhs.is_int32() && rhs.is_int32()                                                      \
+            && !Checked<i32>::would_overflow(lhs.as_i32(), rhs.as_i32())) [[likely]] {            \
+            set(instruction.dst(), Value(lhs.as_i32() int32_operator rhs.as_i32()));              \
+            DISPATCH_NEXT(name);                                                                  \
+        }                                                                                         \
+        HANDLE_INSTRUCTION_SLOW_PATH(name);                                                       \
+    }
+
+#define HANDLE_INT32_RELATIONAL_OP(name, int32_operator)                                    \
+    handle_##name:                                                                          \
+    {                                                                                       \
+        auto& instruction = *reinterpret_cast<Op::name const*>(&bytecode[program_counter]); \
+        auto lhs = get(instruction.lhs());                                                  \
+        auto rhs = get(instruction.rhs());                                                  \
+        if (lhs.is_int32() && rhs.is_int32()) [[likely]] {                                  \
+            set(instruction.dst(), Value(lhs.as_i32() int32_operator rhs.as_i32()));        \
+            DISPATCH_NEXT(name);                                                            \
+        }                                                                                   \
+        HANDLE_INSTRUCTION_SLOW_PATH(name);                                                 \
+    }
+
+            HANDLE_INT32_ARITHMETIC_OP(Add, addition_would_overflow, +);
+            HANDLE_INT32_ARITHMETIC_OP(Sub, subtraction_would_overflow, -);
+            HANDLE_INT32_RELATIONAL_OP(LessThan, <);
+            HANDLE_INT32_RELATIONAL_OP(LessThanEquals, <=);
+            HANDLE_INT32_RELATIONAL_OP(GreaterThan, >);
+            HANDLE_INT32_RELATIONAL_OP(GreaterThanEquals, >=);
+#undef HANDLE_INT32_ARITHMETIC_OP
+#undef HANDLE_INT32_RELATIONAL_OP
+
+        handle_Mul: {
+            auto& instruction = *reinterpret_cast<Op::Mul const*>(&bytecode[program_counter]);
+            auto lhs = get(instruction.lhs());
+            auto rhs = get(instruction.rhs());
+            if (lhs.is_int32() && rhs.is_int32()) [[likely]] {
+                Checked<i32> product = lhs.as_i32();
+                product *= rhs.as_i32();
+                // NOTE: A zero product with a negative operand is -0, which needs a double.
+                if (!product.has_overflow() && (product.value() != 0 || (lhs.as_i32() >= 0 && rhs.as_i32() >= 0))) {
+                    set(instruction.dst(), Value(product.value()));
+                    DISPATCH_NEXT(Mul);
+                }
+            }
+            HANDLE_INSTRUCTION_SLOW_PATH(Mul);
+        }
+
+        handle_Increment: {
+            auto& instruction = *reinterpret_cast<Op::Increment const*>(&bytecode[program_counter]);
+            auto value = get(instruction.dst());
+            if (value.is_int32() && value.as_i32() != NumericLimits<i32>::max()) [[likely]] {
+                set(instruction.dst(), Value(value.as_i32() + 1));
+                DISPATCH_NEXT(Increment);
+            }
+            HANDLE_INSTRUCTION_SLOW_PATH(Increment);
+        }
+
+        handle_Decrement: {
+            auto& instruction = *reinterpret_cast<Op::Decrement const*>(&bytecode[program_counter]);
+            auto value = get(instruction.dst());
+            if (value.is_int32() && value.as_i32() != NumericLimits<i32>::min()) [[likely]] {
+                set(instruction.dst(), Value(value.as_i32() - 1));
+                DISPATCH_NEXT(Decrement);
+            }
+            HANDLE_INSTRUCTION_SLOW_PATH(Decrement);
+        }
+
+#undef HANDLE_INSTRUCTION_SLOW_PATH
+
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(AddPrivateName);
             HANDLE_INSTRUCTION(ArrayAppend);
             HANDLE_INSTRUCTION(AsyncIteratorClose);
@@ -595,7 +696,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(CreateVariable);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(CreateRestParams);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(CreateArguments);
-            HANDLE_INSTRUCTION(Decrement);
             HANDLE_INSTRUCTION(DeleteById);
             HANDLE_INSTRUCTION(DeleteByIdWithThis);
             HANDLE_INSTRUCTION(DeleteByValue);
@@ -624,12 +724,9 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(GetPrivateById);
             HANDLE_INSTRUCTION(GetBinding);
             HANDLE_INSTRUCTION(GetInitializedBinding);
-            HANDLE_INSTRUCTION(GreaterThan);
-            HANDLE_INSTRUCTION(GreaterThanEquals);
             HANDLE_INSTRUCTION(HasPrivateId);
             HANDLE_INSTRUCTION(ImportCall);
             HANDLE_INSTRUCTION(In);
-            HANDLE_INSTRUCTION(Increment);
             HANDLE_INSTRUCTION(InitializeLexicalBinding);
             HANDLE_INSTRUCTION(InitializeVariableBinding);
             HANDLE_INSTRUCTION(InstanceOf);
@@ -642,12 +739,9 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(LeavePrivateEnvironment);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(LeaveUnwindContext);
             HANDLE_INSTRUCTION(LeftShift);
-            HANDLE_INSTRUCTION(LessThan);
-            HANDLE_INSTRUCTION(LessThanEquals);
             HANDLE_INSTRUCTION(LooselyEquals);
             HANDLE_INSTRUCTION(LooselyInequals);
             HANDLE_INSTRUCTION(Mod);
-            HANDLE_INSTRUCTION(Mul);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewArray);
             HANDLE_INSTRUCTION(NewClass);
             HANDLE_INSTRUCTION_WITHOUT_EXCEPTION_CHECK(NewFunction);
@@ -675,7 +769,6 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
             HANDLE_INSTRUCTION(SetVariableBinding);
             HANDLE_INSTRUCTION(StrictlyEquals);
             HANDLE_INSTRUCTION(StrictlyInequals);
-            HANDLE_INSTRUCTION(Sub);
             HANDLE_INSTRUCTION(SuperCallWithArgumentArray);
             HANDLE_INSTRUCTION(Throw);
             HANDLE_INSTRUCTION(ThrowIfNotObject);
@@ -1017,8 +1110,30 @@ inline ThrowCompletionOr<Value> get_by_id(VM& vm, Optional<IdentifierTableIndex>
         }
     }
 
+    auto const& property_name = executable.get_identifier(property);
+    auto& megamorphic_cache = vm.bytecode_interpreter().megamorphic_property_cache();
+
+    if (cache.is_megamorphic()) {
+        // OPTIMIZATION: Megamorphic sites share one cache of own property offsets instead of thrashing their own entries.
+        if (auto const* entry = megamorphic_cache.find(shape, property_name)) {
+            auto value = base_obj->get_direct(entry->property_offset);
+            if (value.is_accessor())
+                return TRY(call(vm, value.as_accessor().getter(), this_value));
+            return value;
+        }
+    }
+
     CacheablePropertyMetadata cacheable_metadata;
-    auto value = TRY(base_obj->internal_get(executable.get_identifier(property), this_value, &cacheable_metadata));
+    auto value = TRY(base_obj->internal_get(property_name, this_value, &cacheable_metadata));
+
+    if (cacheable_metadata.type == CacheablePropertyMetadata::Type::NotCacheable)
+        return value;
+
+    if (cache.is_megamorphic() && cacheable_metadata.type == CacheablePropertyMetadata::Type::OwnProperty) {
+        megamorphic_cache.set(shape, property_name, cacheable_metadata.property_offset.value());
+        return value;
+    }
+    ++cache.number_of_misses;
 
     auto get_cache_slot = [&] -> PropertyLookupCache::Entry& {
         for (size_t i = cache.entries.size() - 1; i >= 1; --i) {
@@ -1260,7 +1375,9 @@ inline ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value thi
         CacheablePropertyMetadata cacheable_metadata;
         bool succeeded = TRY(object->internal_set(name, value, this_value, &cacheable_metadata));
 
-        if (succeeded && caches) {
+        // NOTE: Megamorphic sites keep their current entries rather than evicting one on every miss.
+        if (succeeded && caches && !caches->is_megamorphic() && cacheable_metadata.type != CacheablePropertyMetadata::Type::NotCacheable) {
+            ++caches->number_of_misses;
             auto get_cache_slot = [&] -> PropertyLookupCache::Entry& {
                 for (size_t i = caches->entries.size() - 1; i >= 1; --i) {
                     caches->entries[i] = caches->entries[i - 1];
@@ -1770,6 +1887,7 @@ public:
     virtual ~PropertyNameIterator() override = default;
 
     BuiltinIterator* as_builtin_iterator() override { return this; }
+    BuiltinIterator* as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const&) override { return this; }
     ThrowCompletionOr<void> next(VM&, bool& done, Value& value) override
     {
         while (true) {
@@ -1944,8 +2062,8 @@ JS_ENUMERATE_COMMON_BINARY_OPS_WITH_FAST_PATH(JS_DEFINE_TO_BYTE_STRING_FOR_COMMO
 ThrowCompletionOr<void> Add::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    auto const lhs = interpreter.get(m_lhs);
-    auto const rhs = interpreter.get(m_rhs);
+    auto lhs = interpreter.get(m_lhs);
+    auto rhs = interpreter.get(m_rhs);
 
     if (lhs.is_number() && rhs.is_number()) {
         if (lhs.is_int32() && rhs.is_int32()) {
@@ -1958,10 +2076,61 @@ ThrowCompletionOr<void> Add::execute_impl(Bytecode::Interpreter& interpreter) co
         return {};
     }
 
+    // OPTIMIZATION: Two strings can be concatenated into a rope right away, there's nothing to convert.
+    if (lhs.is_string() && rhs.is_string()) {
+        interpreter.set(m_dst, PrimitiveString::create(vm, lhs.as_string(), rhs.as_string()));
+        return {};
+    }
+
     interpreter.set(m_dst, TRY(add(vm, lhs, rhs)));
     return {};
 }
 
+ThrowCompletionOr<void> Div::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto const lhs = interpreter.get(m_lhs);
+    auto const rhs = interpreter.get(m_rhs);
+
+    if (lhs.is_int32() && rhs.is_int32()) {
+        auto const dividend = lhs.as_i32();
+        auto const divisor = rhs.as_i32();
+        // NOTE: Only exact divisions stay in Int32 range. 0 / -n is -0, and INT32_MIN / -1 overflows.
+        if (divisor != 0 && !(dividend == NumericLimits<i32>::min() && divisor == -1) && !(dividend == 0 && divisor < 0) && dividend % divisor == 0) {
+            interpreter.set(m_dst, Value(dividend / divisor));
+            return {};
+        }
+    }
+
+    if (lhs.is_number() && rhs.is_number()) {
+        interpreter.set(m_dst, Value(lhs.as_double() / rhs.as_double()));
+        return {};
+    }
+
+    interpreter.set(m_dst, TRY(div(vm, lhs, rhs)));
+    return {};
+}
+
+ThrowCompletionOr<void> Mod::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto const lhs = interpreter.get(m_lhs);
+    auto const rhs = interpreter.get(m_rhs);
+
+    if (lhs.is_int32() && rhs.is_int32()) {
+        auto const dividend = lhs.as_i32();
+        auto const divisor = rhs.as_i32();
+        // NOTE: A negative dividend may produce -0, and a zero divisor produces NaN, so those take the slow path.
+        if (dividend >= 0 && divisor != 0) {
+            interpreter.set(m_dst, Value(dividend % divisor));
+            return {};
+        }
+    }
+
+    interpreter.set(m_dst, TRY(mod(vm, lhs, rhs)));
+    return {};
+}
+
 ThrowCompletionOr<void> Mul::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
@@ -1971,8 +2140,12 @@ ThrowCompletionOr<void> Mul::execute_impl(Bytecode::Interpreter& interpreter) co
     if (lhs.is_number() && rhs.is_number()) {
         if (lhs.is_int32() && rhs.is_int32()) {
             if (!Checked<i32>::multiplication_would_overflow(lhs.as_i32(), rhs.as_i32())) {
-                interpreter.set(m_dst, Value(lhs.as_i32() * rhs.as_i32()));
-                return {};
+                auto product = lhs.as_i32() * rhs.as_i32();
+                // NOTE: A zero product with a negative operand is -0, which needs a double.
+                if (product != 0 || (lhs.as_i32() >= 0 && rhs.as_i32() >= 0)) {
+                    interpreter.set(m_dst, Value(product));
+                    return {};
+                }
             }
         }
         interpreter.set(m_dst, Value(lhs.as_double() * rhs.as_double()));
@@ -2806,10 +2979,27 @@ ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) c
 
     auto& function = callee.as_function();
 
+    // NOTE: If this site called the same ECMAScript function last time, we already know its frame size,
+    //       and can call it directly instead of dispatching through FunctionObject.
+    auto& cache = interpreter.current_executable().call_site_caches[m_cache_index];
+    ECMAScriptFunctionObject* cached_callee = nullptr;
+
     ExecutionContext* callee_context = nullptr;
     size_t registers_and_constants_and_locals_count = 0;
     size_t argument_count = m_argument_count;
-    TRY(function.get_stack_frame_size(registers_and_constants_and_locals_count, argument_count));
+    if (cache.callee.ptr() == &function) [[likely]] {
+        cached_callee = cache.callee.ptr();
+        registers_and_constants_and_locals_count = cache.registers_and_constants_and_locals_count;
+        argument_count = max(argument_count, static_cast<size_t>(cache.formal_parameter_count));
+    } else {
+        TRY(function.get_stack_frame_size(registers_and_constants_and_locals_count, argument_count));
+        if (function.is_ecmascript_function_object()) {
+            auto& ecmascript_function = static_cast<ECMAScriptFunctionObject&>(function);
+            cache.callee = ecmascript_function;
+            cache.registers_and_constants_and_locals_count = registers_and_constants_and_locals_count;
+            cache.formal_parameter_count = ecmascript_function.formal_parameters().size();
+        }
+    }
     ALLOCATE_EXECUTION_CONTEXT_ON_NATIVE_STACK_WITHOUT_CLEARING_ARGS(callee_context, registers_and_constants_and_locals_count, max(m_argument_count, argument_count));
 
     auto* callee_context_argument_values = callee_context->arguments.data();
@@ -2822,7 +3012,8 @@ ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) c
         callee_context_argument_values[i] = js_undefined();
     callee_context->passed_argument_count = insn_argument_count;
 
-    auto retval = TRY(function.internal_call(*callee_context, interpreter.get(m_this_value)));
+    auto this_value = interpreter.get(m_this_value);
+    auto retval = TRY(cached_callee ? cached_callee->internal_call(*callee_context, this_value) : function.internal_call(*callee_context, this_value));
     interpreter.set(m_dst, retval);
     return {};
 }
@@ -3175,7 +3366,7 @@ ThrowCompletionOr<void> IteratorNextUnpack::execute_impl(Bytecode::Interpreter&
 
     Value value;
     bool done = false;
-    if (auto* builtin_iterator = iterator_record.iterator->as_builtin_iterator()) {
+    if (auto* builtin_iterator = iterator_record.iterator->as_builtin_iterator_if_next_is_not_redefined(iterator_record)) {
         TRY(builtin_iterator->next(vm, done, value));
     } else {
         auto result = TRY(iterator_next(vm, iterator_record));
@@ -84,6 +84,8 @@ public:
 
     ExecutionContext& running_execution_context() { return *m_running_execution_context; }
 
+    MegamorphicPropertyCache& megamorphic_property_cache() { return m_megamorphic_property_cache; }
+
 private:
     void run_bytecode(size_t entry_point);
 
@@ -102,6 +104,7 @@ private:
     Span<Value> m_registers_and_constants_and_locals_arguments;
     Vector<Value> m_argument_values_buffer;
     ExecutionContext* m_running_execution_context { nullptr };
+    MegamorphicPropertyCache m_megamorphic_property_cache;
 };
 
 extern bool g_dump_bytecode;
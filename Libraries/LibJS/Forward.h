@@ -117,6 +117,19 @@
     __JS_ENUMERATE(SetIterator, set_iterator)                    \
     __JS_ENUMERATE(StringIterator, string_iterator)
 
+#define JS_ENUMERATE_GLOBAL_OBJECT_FUNCTIONS                      \
+    __JS_ENUMERATE(eval, eval, 1)                                 \
+    __JS_ENUMERATE(is_finite, isFinite, 1)                        \
+    __JS_ENUMERATE(is_nan, isNaN, 1)                              \
+    __JS_ENUMERATE(parse_float, parseFloat, 1)                    \
+    __JS_ENUMERATE(parse_int, parseInt, 2)                        \
+    __JS_ENUMERATE(decode_uri, decodeURI, 1)                      \
+    __JS_ENUMERATE(decode_uri_component, decodeURIComponent, 1)   \
+    __JS_ENUMERATE(encode_uri, encodeURI, 1)                      \
+    __JS_ENUMERATE(encode_uri_component, encodeURIComponent, 1)   \
+    __JS_ENUMERATE(escape, escape, 1)                             \
+    __JS_ENUMERATE(unescape, unescape, 1)
+
 #define JS_ENUMERATE_BUILTIN_TYPES \
     JS_ENUMERATE_NATIVE_OBJECTS    \
     JS_ENUMERATE_NATIVE_ERRORS     \
@@ -208,6 +221,7 @@ class PropertyDescriptor;
 class PropertyKey;
 class Realm;
 class Reference;
+class SamplingProfiler;
 class ScopeNode;
 class Script;
 class Shape;
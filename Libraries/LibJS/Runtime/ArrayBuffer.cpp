@@ -32,6 +32,14 @@ GC::Ref<ArrayBuffer> ArrayBuffer::create(Realm& realm, ByteBuffer* buffer)
     return realm.create<ArrayBuffer>(buffer, realm.intrinsics().array_buffer_prototype());
 }
 
+// Creates a SharedArrayBuffer referring to a Shared Data Block that may already be referred to by other agents.
+GC::Ref<ArrayBuffer> ArrayBuffer::create_shared(Realm& realm, NonnullRefPtr<SharedDataBlock> block)
+{
+    auto buffer = realm.create<ArrayBuffer>(ByteBuffer {}, realm.intrinsics().shared_array_buffer_prototype());
+    buffer->set_data_block(DataBlock { move(block), DataBlock::Shared::Yes });
+    return buffer;
+}
+
 ArrayBuffer::ArrayBuffer(ByteBuffer buffer, Object& prototype)
     : Object(ConstructWithPrototypeTag::Tag, prototype)
     , m_data_block(DataBlock { move(buffer), DataBlock::Shared::No })
@@ -74,7 +82,7 @@ ThrowCompletionOr<DataBlock> create_byte_data_block(VM& vm, size_t size)
 static ThrowCompletionOr<DataBlock> create_shared_byte_data_block(VM& vm, size_t size)
 {
     // 1. Let db be a new Shared Data Block value consisting of size bytes. If it is impossible to create such a Shared Data Block, throw a RangeError exception.
-    auto data_block = ByteBuffer::create_zeroed(size);
+    auto data_block = SharedDataBlock::create(size);
     if (data_block.is_error())
         return vm.throw_completion<RangeError>(ErrorType::NotEnoughMemoryToAllocate, size);
 
@@ -259,6 +267,19 @@ ThrowCompletionOr<void> detach_array_buffer(VM& vm, ArrayBuffer& array_buffer, O
     return {};
 }
 
+// OPTIMIZATION: A variant of DetachArrayBuffer that hands over arrayBuffer's data block rather than discarding it, so
+//               that transferring an ArrayBuffer to another realm does not have to copy its bytes.
+ThrowCompletionOr<ByteBuffer> detach_array_buffer_and_take_data_block(VM& vm, ArrayBuffer& array_buffer)
+{
+    VERIFY(!array_buffer.is_shared_array_buffer());
+
+    // NOTE: This is DetachArrayBuffer without a key.
+    if (!array_buffer.detach_key().is_undefined())
+        return vm.throw_completion<TypeError>(ErrorType::DetachKeyMismatch, js_undefined(), array_buffer.detach_key());
+
+    return TRY_OR_THROW_OOM(vm, array_buffer.take_buffer());
+}
+
 // 25.1.3.6 CloneArrayBuffer ( srcBuffer, srcByteOffset, srcLength, cloneConstructor ), https://tc39.es/ecma262/#sec-clonearraybuffer
 ThrowCompletionOr<ArrayBuffer*> clone_array_buffer(VM& vm, ArrayBuffer& source_buffer, size_t source_byte_offset, size_t source_length)
 {
@@ -13,6 +13,7 @@
 #include <LibJS/Runtime/Completion.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/SharedDataBlock.h>
 
 namespace JS {
 
@@ -36,9 +37,11 @@ struct DataBlock {
 
     ByteBuffer& buffer()
     {
-        ByteBuffer* ptr { nullptr };
-        byte_buffer.visit([&](Empty) { VERIFY_NOT_REACHED(); }, [&](auto* pointer) { ptr = pointer; }, [&](auto& value) { ptr = &value; });
-        return *ptr;
+        return *byte_buffer.visit(
+            [](Empty) -> ByteBuffer* { VERIFY_NOT_REACHED(); },
+            [](ByteBuffer& buffer) { return &buffer; },
+            [](ByteBuffer* buffer) { return buffer; },
+            [](NonnullRefPtr<SharedDataBlock>& block) { return &block->buffer(); });
     }
     ByteBuffer const& buffer() const { return const_cast<DataBlock*>(this)->buffer(); }
 
@@ -47,10 +50,11 @@ struct DataBlock {
         return byte_buffer.visit(
             [](Empty) -> size_t { return 0u; },
             [](ByteBuffer const& buffer) { return buffer.size(); },
-            [](ByteBuffer const* buffer) { return buffer->size(); });
+            [](ByteBuffer const* buffer) { return buffer->size(); },
+            [](NonnullRefPtr<SharedDataBlock> const& block) { return block->buffer().size(); });
     }
 
-    Variant<Empty, ByteBuffer, ByteBuffer*> byte_buffer;
+    Variant<Empty, ByteBuffer, ByteBuffer*, NonnullRefPtr<SharedDataBlock>> byte_buffer;
     Shared is_shared = { Shared::No };
 };
 
@@ -62,6 +66,7 @@ public:
     static ThrowCompletionOr<GC::Ref<ArrayBuffer>> create(Realm&, size_t);
     static GC::Ref<ArrayBuffer> create(Realm&, ByteBuffer);
     static GC::Ref<ArrayBuffer> create(Realm&, ByteBuffer*);
+    static GC::Ref<ArrayBuffer> create_shared(Realm&, NonnullRefPtr<SharedDataBlock>);
 
     virtual ~ArrayBuffer() override = default;
 
@@ -71,6 +76,14 @@ public:
     ByteBuffer& buffer() { return m_data_block.buffer(); }
     ByteBuffer const& buffer() const { return m_data_block.buffer(); }
 
+    // The Shared Data Block of a SharedArrayBuffer, if it may be shared with other agents.
+    RefPtr<SharedDataBlock> shared_data_block() const
+    {
+        if (auto const* block = m_data_block.byte_buffer.get_pointer<NonnullRefPtr<SharedDataBlock>>())
+            return *block;
+        return {};
+    }
+
     // [[ArrayBufferMaxByteLength]]
     size_t max_byte_length() const { return m_max_byte_length.value(); }
     void set_max_byte_length(size_t max_byte_length) { m_max_byte_length = max_byte_length; }
@@ -83,6 +96,18 @@ public:
 
     void detach_buffer() { m_data_block.byte_buffer = Empty {}; }
 
+    // Detaches the buffer, handing over its data block. Buffers viewing memory they do not own hand over a copy of it.
+    ErrorOr<ByteBuffer> take_buffer()
+    {
+        auto buffer = TRY(m_data_block.byte_buffer.visit(
+            [](Empty) -> ErrorOr<ByteBuffer> { return ByteBuffer {}; },
+            [](ByteBuffer& buffer) -> ErrorOr<ByteBuffer> { return move(buffer); },
+            [](ByteBuffer* buffer) { return ByteBuffer::copy(*buffer); },
+            [](NonnullRefPtr<SharedDataBlock> const&) -> ErrorOr<ByteBuffer> { VERIFY_NOT_REACHED(); }));
+        detach_buffer();
+        return buffer;
+    }
+
     // 25.1.3.4 IsDetachedBuffer ( arrayBuffer ), https://tc39.es/ecma262/#sec-isdetachedbuffer
     bool is_detached() const
     {
@@ -150,6 +175,7 @@ void copy_data_block_bytes(ByteBuffer& to_block, u64 to_index, ByteBuffer const&
 ThrowCompletionOr<ArrayBuffer*> allocate_array_buffer(VM&, FunctionObject& constructor, size_t byte_length, Optional<size_t> const& max_byte_length = {});
 ThrowCompletionOr<ArrayBuffer*> array_buffer_copy_and_detach(VM&, ArrayBuffer& array_buffer, Value new_length, PreserveResizability preserve_resizability);
 ThrowCompletionOr<void> detach_array_buffer(VM&, ArrayBuffer& array_buffer, Optional<Value> key = {});
+ThrowCompletionOr<ByteBuffer> detach_array_buffer_and_take_data_block(VM&, ArrayBuffer& array_buffer);
 ThrowCompletionOr<Optional<size_t>> get_array_buffer_max_byte_length_option(VM&, Value options);
 ThrowCompletionOr<ArrayBuffer*> clone_array_buffer(VM&, ArrayBuffer& source_buffer, size_t source_byte_offset, size_t source_length);
 ThrowCompletionOr<GC::Ref<ArrayBuffer>> allocate_shared_array_buffer(VM&, FunctionObject& constructor, size_t byte_length);
@@ -36,6 +36,13 @@ void ArrayIterator::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_array);
 }
 
+BuiltinIterator* ArrayIterator::as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const& iterator_record)
+{
+    if (iterator_record.next_method != shape().realm().intrinsics().array_iterator_prototype_next_function())
+        return nullptr;
+    return this;
+}
+
 ThrowCompletionOr<void> ArrayIterator::next(VM& vm, bool& done, Value& value)
 {
     // 1. Let O be the this value.
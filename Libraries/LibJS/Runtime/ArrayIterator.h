@@ -22,6 +22,7 @@ public:
     virtual ~ArrayIterator() override = default;
 
     BuiltinIterator* as_builtin_iterator() override { return this; }
+    BuiltinIterator* as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const&) override;
     ThrowCompletionOr<void> next(VM&, bool& done, Value& value) override;
 
 private:
@@ -31,6 +31,19 @@ GC_DEFINE_ALLOCATOR(ArrayPrototype);
 
 static HashTable<GC::Ref<Object>> s_array_join_seen_objects;
 
+// OPTIMIZATION: If an object keeps its elements in simple storage and nothing can intercept indexed property access,
+//               then HasProperty and Get for an index that holds a plain value cannot run any user code. Searches can
+//               then scan the packed elements directly, and only fall back to the generic path at the first hole.
+static SimpleIndexedPropertyStorage const* packed_element_storage_for_search(Object const& object)
+{
+    if (object.may_interfere_with_indexed_property_access())
+        return nullptr;
+    auto const* storage = object.indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return nullptr;
+    return static_cast<SimpleIndexedPropertyStorage const*>(storage);
+}
+
 ArrayPrototype::ArrayPrototype(Realm& realm)
     : Array(realm.intrinsics().object_prototype())
 {
@@ -742,6 +755,19 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    if (auto const* storage = packed_element_storage_for_search(*this_object)) {
+        auto const* elements = storage->elements().data();
+        auto end = min(length, storage->array_like_size());
+        for (; from_index < end; ++from_index) {
+            auto element = elements[from_index];
+            if (element.is_special_empty_value() || element.is_accessor())
+                break;
+            if (same_value_zero(element, value_to_find))
+                return Value(true);
+        }
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -795,6 +821,18 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    if (auto const* storage = packed_element_storage_for_search(*object)) {
+        auto const* elements = storage->elements().data();
+        auto end = min(length, storage->array_like_size());
+        for (; k < end; ++k) {
+            auto element = elements[k];
+            if (element.is_special_empty_value() || element.is_accessor())
+                break;
+            if (is_strictly_equal(search_element, element))
+                return Value(k);
+        }
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -15,6 +15,7 @@
 #include <AK/Atomic.h>
 #include <AK/ByteBuffer.h>
 #include <AK/Endian.h>
+#include <AK/HashMap.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/Agent.h>
 #include <LibJS/Runtime/AtomicsObject.h>
@@ -22,6 +23,8 @@
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
 
 namespace JS {
 
@@ -146,6 +149,61 @@ enum class WaitMode {
     Async,
 };
 
+// 25.4.3.1 WaiterList Records, https://tc39.es/ecma262/#sec-waiterlist-records
+// NOTE: Shared Data Blocks may be shared by agents running on different threads of this process, so there is a single
+//       critical section for all WaiterLists, and a WaiterList is identified by the address of its block's bytes and
+//       the byte index into them. A SharedDataBlock outlives any agent waiting on it, so the address is stable.
+struct Waiter {
+    explicit Waiter(Threading::Mutex& critical_section)
+        : condition(critical_section)
+    {
+    }
+
+    Threading::ConditionVariable condition;
+    bool notified { false };
+};
+
+struct WaiterListKey {
+    ByteBuffer const* block { nullptr };
+    size_t byte_index { 0 };
+
+    bool operator==(WaiterListKey const&) const = default;
+};
+
+}
+
+template<>
+struct AK::Traits<JS::WaiterListKey> : public DefaultTraits<JS::WaiterListKey> {
+    static unsigned hash(JS::WaiterListKey const& key) { return pair_int_hash(ptr_hash(key.block), u64_hash(key.byte_index)); }
+};
+
+namespace JS {
+
+static Threading::Mutex& waiter_list_critical_section()
+{
+    static Threading::Mutex critical_section;
+    return critical_section;
+}
+
+// NOTE: Only accessed while in the critical section.
+static HashMap<WaiterListKey, Vector<Waiter*>>& waiter_lists()
+{
+    static HashMap<WaiterListKey, Vector<Waiter*>> waiter_lists;
+    return waiter_lists;
+}
+
+// 25.4.3.13 RemoveWaiter ( WL, waiterRecord ), https://tc39.es/ecma262/#sec-removewaiter
+static void remove_waiter(WaiterListKey const& key, Waiter& waiter)
+{
+    auto it = waiter_lists().find(key);
+    if (it == waiter_lists().end())
+        return;
+
+    it->value.remove_first_matching([&](auto const* entry) { return entry == &waiter; });
+    if (it->value.is_empty())
+        waiter_lists().remove(it);
+}
+
 // 25.4.3.14 DoWait ( mode, typedArray, index, value, timeout ), https://tc39.es/ecma262/#sec-dowait
 static ThrowCompletionOr<Value> do_wait(VM& vm, WaitMode mode, TypedArrayBase& typed_array, Value index_value, Value expected_value, Value timeout_value)
 {
@@ -189,12 +247,78 @@ static ThrowCompletionOr<Value> do_wait(VM& vm, WaitMode mode, TypedArrayBase& t
     if (mode == WaitMode::Sync && !agent_can_suspend(vm))
         return vm.throw_completion<TypeError>(ErrorType::AgentCannotSuspend);
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)index;
-    (void)value;
-    (void)timeout;
+    // FIXME: Implement the async mode, which requires resolving a promise from another agent's notify.
+    if (mode == WaitMode::Async)
+        return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "Atomics.waitAsync"sv);
+
+    // 11. Let block be buffer.[[ArrayBufferData]].
+    auto& block = buffer->buffer();
+
+    // 12. Let offset be typedArray.[[ByteOffset]].
+    auto offset = typed_array.byte_offset();
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+    // 13. Let byteIndexInBuffer be (i × 4) + offset.
+    // 14. Else, let byteIndexInBuffer be (i × 8) + offset.
+    auto byte_index_in_buffer = (index * typed_array.element_size()) + offset;
+
+    // 15. Let WL be GetWaiterList(block, byteIndexInBuffer).
+    WaiterListKey waiter_list { &block, byte_index_in_buffer };
+
+    // 16. If mode is sync, then
+    //     a. Let promiseCapability be blocking.
+    //     b. Let resultObject be undefined.
+
+    // 18. Perform EnterCriticalSection(WL).
+    Threading::MutexLocker locker { waiter_list_critical_section() };
+
+    // 19. Let elementType be TypedArrayElementType(typedArray).
+    // 20. Let w be GetValueFromBuffer(buffer, byteIndexInBuffer, elementType, true, seq-cst).
+    // 21. If v ≠ w, then
+    //     a. Perform LeaveCriticalSection(WL).
+    //     b. If mode is sync, return "not-equal".
+    // NOTE: Reading the raw element avoids allocating a BigInt while holding the critical section.
+    auto* element = block.data() + byte_index_in_buffer;
+    auto current_value = typed_array.element_size() == sizeof(i64)
+        ? AK::atomic_load(reinterpret_cast<i64*>(element))
+        : static_cast<i64>(AK::atomic_load(reinterpret_cast<i32*>(element)));
+    if (value != current_value)
+        return PrimitiveString::create(vm, "not-equal"_string);
+
+    // 22. Let thisAgent be AgentSignifier().
+    // 23. Let now be the time value (UTC) identifying the current time.
+    // 24. Let additionalTimeout be an implementation-defined non-negative mathematical value.
+    // 25. Let timeoutTime be ℝ(now) + t + additionalTimeout.
+    // 26. NOTE: When t is +∞, timeoutTime will also be +∞.
+    // 27. Let waiterRecord be a new Waiter Record { [[AgentSignifier]]: thisAgent, [[PromiseCapability]]: promiseCapability, [[TimeoutTime]]: timeoutTime, [[Result]]: "ok" }.
+    Waiter waiter { waiter_list_critical_section() };
+
+    // 28. Perform AddWaiter(WL, waiterRecord).
+    waiter_lists().ensure(waiter_list).append(&waiter);
+
+    // 29. If mode is sync, then
+    //     a. Perform SuspendThisAgent(WL, waiterRecord).
+    bool timed_out = false;
+    if (isinf(timeout)) {
+        while (!waiter.notified)
+            waiter.condition.wait();
+    } else {
+        auto deadline = MonotonicTime::now() + AK::Duration::from_milliseconds(static_cast<i64>(timeout));
+        while (!waiter.notified) {
+            auto now = MonotonicTime::now();
+            if (now >= deadline || !waiter.condition.wait_for(deadline - now)) {
+                timed_out = !waiter.notified;
+                break;
+            }
+        }
+    }
+
+    // NOTE: A waiter that was notified has already been removed from WL by the notifying agent.
+    if (timed_out)
+        remove_waiter(waiter_list, waiter);
+
+    // 31. Perform LeaveCriticalSection(WL).
+    // 32. If mode is sync, return waiterRecord.[[Result]].
+    return PrimitiveString::create(vm, timed_out ? "timed-out"_string : "ok"_string);
 }
 
 template<typename T, typename AtomicFunction>
@@ -582,12 +706,34 @@ JS_DEFINE_NATIVE_FUNCTION(AtomicsObject::notify)
     if (!buffer->is_shared_array_buffer())
         return Value { 0 };
 
-    // FIXME: Implement the remaining steps when we support SharedArrayBuffer.
-    (void)byte_index_in_buffer;
-    (void)count;
-    (void)block;
+    // 7. Let WL be GetWaiterList(block, byteIndexInBuffer).
+    WaiterListKey waiter_list { &block, byte_index_in_buffer };
+
+    // 8. Perform EnterCriticalSection(WL).
+    Threading::MutexLocker locker { waiter_list_critical_section() };
+
+    // 9. Let S be RemoveWaiters(WL, c).
+    // 10. For each element W of S, do
+    //     a. Perform NotifyWaiter(WL, W).
+    size_t notified = 0;
+    if (auto it = waiter_lists().find(waiter_list); it != waiter_lists().end()) {
+        auto& waiters = it->value;
+
+        while (!waiters.is_empty() && static_cast<double>(notified) < count) {
+            auto* waiter = waiters.take_first();
+            waiter->notified = true;
+            waiter->condition.signal();
+            ++notified;
+        }
+
+        if (waiters.is_empty())
+            waiter_lists().remove(it);
+    }
 
-    return vm.throw_completion<InternalError>(ErrorType::NotImplemented, "SharedArrayBuffer"sv);
+    // 11. Perform LeaveCriticalSection(WL).
+    // 12. Let n be the number of elements in S.
+    // 13. Return 𝔽(n).
+    return Value { notified };
 }
 
 // 25.4.16 Atomics.xor ( typedArray, index, value ), https://tc39.es/ecma262/#sec-atomics.xor
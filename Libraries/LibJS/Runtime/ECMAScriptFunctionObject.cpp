@@ -429,11 +429,18 @@ ECMAScriptFunctionObject::ECMAScriptFunctionObject(
 {
     if (!is_arrow_function() && kind() == FunctionKind::Normal)
         unsafe_set_shape(realm()->intrinsics().normal_function_shape());
+    else if (has_premade_arrow_function_shape())
+        unsafe_set_shape(realm()->intrinsics().arrow_function_shape());
 
     // 15. Set F.[[ScriptOrModule]] to GetActiveScriptOrModule().
     m_script_or_module = vm().get_active_script_or_module();
 }
 
+bool ECMAScriptFunctionObject::has_premade_arrow_function_shape() const
+{
+    return is_arrow_function() && kind() == FunctionKind::Normal && shape().prototype() == realm()->intrinsics().function_prototype();
+}
+
 void ECMAScriptFunctionObject::initialize(Realm& realm)
 {
     auto& vm = this->vm();
@@ -453,6 +460,10 @@ void ECMAScriptFunctionObject::initialize(Realm& realm)
         auto prototype = Object::create_with_premade_shape(realm.intrinsics().normal_function_prototype_shape());
         prototype->put_direct(realm.intrinsics().normal_function_prototype_constructor_offset(), this);
         put_direct(realm.intrinsics().normal_function_prototype_offset(), prototype);
+    } else if (has_premade_arrow_function_shape()) {
+        // OPTIMIZATION: Arrow functions are created often (e.g. as callbacks), so we give the common ones a premade shape too.
+        put_direct(realm.intrinsics().arrow_function_length_offset(), Value(function_length()));
+        put_direct(realm.intrinsics().arrow_function_name_offset(), m_name_string);
     } else {
         MUST(define_property_or_throw(vm.names.length, { .value = Value(function_length()), .writable = false, .enumerable = false, .configurable = true }));
         MUST(define_property_or_throw(vm.names.name, { .value = m_name_string, .writable = false, .enumerable = false, .configurable = true }));
@@ -192,6 +192,8 @@ private:
 
     ThrowCompletionOr<Value> ordinary_call_evaluate_body(VM&);
 
+    [[nodiscard]] bool has_premade_arrow_function_shape() const;
+
     [[nodiscard]] bool function_environment_needed() const { return shared_data().m_function_environment_needed; }
     SharedFunctionInstanceData const& shared_data() const { return m_shared_data; }
 
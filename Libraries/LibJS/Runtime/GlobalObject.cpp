@@ -104,15 +104,15 @@ void set_default_global_bindings(Realm& realm)
     u8 attr = Attribute::Writable | Attribute::Configurable;
 
     // 19.2 Function Properties of the Global Object, https://tc39.es/ecma262/#sec-function-properties-of-the-global-object
-    global.define_direct_property(vm.names.eval, realm.intrinsics().eval_function(), attr);
-    global.define_direct_property(vm.names.isFinite, realm.intrinsics().is_finite_function(), attr);
-    global.define_direct_property(vm.names.isNaN, realm.intrinsics().is_nan_function(), attr);
-    global.define_direct_property(vm.names.parseFloat, realm.intrinsics().parse_float_function(), attr);
-    global.define_direct_property(vm.names.parseInt, realm.intrinsics().parse_int_function(), attr);
-    global.define_direct_property(vm.names.decodeURI, realm.intrinsics().decode_uri_function(), attr);
-    global.define_direct_property(vm.names.decodeURIComponent, realm.intrinsics().decode_uri_component_function(), attr);
-    global.define_direct_property(vm.names.encodeURI, realm.intrinsics().encode_uri_function(), attr);
-    global.define_direct_property(vm.names.encodeURIComponent, realm.intrinsics().encode_uri_component_function(), attr);
+    global.define_intrinsic_accessor(vm.names.eval, attr, [](auto& realm) -> Value { return realm.intrinsics().eval_function(); });
+    global.define_intrinsic_accessor(vm.names.isFinite, attr, [](auto& realm) -> Value { return realm.intrinsics().is_finite_function(); });
+    global.define_intrinsic_accessor(vm.names.isNaN, attr, [](auto& realm) -> Value { return realm.intrinsics().is_nan_function(); });
+    global.define_intrinsic_accessor(vm.names.parseFloat, attr, [](auto& realm) -> Value { return realm.intrinsics().parse_float_function(); });
+    global.define_intrinsic_accessor(vm.names.parseInt, attr, [](auto& realm) -> Value { return realm.intrinsics().parse_int_function(); });
+    global.define_intrinsic_accessor(vm.names.decodeURI, attr, [](auto& realm) -> Value { return realm.intrinsics().decode_uri_function(); });
+    global.define_intrinsic_accessor(vm.names.decodeURIComponent, attr, [](auto& realm) -> Value { return realm.intrinsics().decode_uri_component_function(); });
+    global.define_intrinsic_accessor(vm.names.encodeURI, attr, [](auto& realm) -> Value { return realm.intrinsics().encode_uri_function(); });
+    global.define_intrinsic_accessor(vm.names.encodeURIComponent, attr, [](auto& realm) -> Value { return realm.intrinsics().encode_uri_component_function(); });
 
     // 19.1 Value Properties of the Global Object, https://tc39.es/ecma262/#sec-value-properties-of-the-global-object
     global.define_direct_property(vm.names.globalThis, &global, attr);
@@ -177,8 +177,8 @@ void set_default_global_bindings(Realm& realm)
     global.define_intrinsic_accessor(vm.names.Temporal, attr, [](auto& realm) -> Value { return realm.intrinsics().temporal_object(); });
 
     // B.2.1 Additional Properties of the Global Object, https://tc39.es/ecma262/#sec-additional-properties-of-the-global-object
-    global.define_direct_property(vm.names.escape, realm.intrinsics().escape_function(), attr);
-    global.define_direct_property(vm.names.unescape, realm.intrinsics().unescape_function(), attr);
+    global.define_intrinsic_accessor(vm.names.escape, attr, [](auto& realm) -> Value { return realm.intrinsics().escape_function(); });
+    global.define_intrinsic_accessor(vm.names.unescape, attr, [](auto& realm) -> Value { return realm.intrinsics().unescape_function(); });
 
     // Non-standard
     global.define_direct_property(vm.names.InternalError, realm.intrinsics().internal_error_constructor(), attr);
@@ -213,6 +213,13 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
     m_normal_function_name_offset = m_normal_function_shape->lookup(vm.names.name.to_string_or_symbol()).value().offset;
     m_normal_function_prototype_offset = m_normal_function_shape->lookup(vm.names.prototype.to_string_or_symbol()).value().offset;
 
+    m_arrow_function_shape = heap().allocate<Shape>(realm);
+    m_arrow_function_shape->set_prototype_without_transition(m_function_prototype);
+    m_arrow_function_shape->add_property_without_transition(vm.names.length, Attribute::Configurable);
+    m_arrow_function_shape->add_property_without_transition(vm.names.name, Attribute::Configurable);
+    m_arrow_function_length_offset = m_arrow_function_shape->lookup(vm.names.length.to_string_or_symbol()).value().offset;
+    m_arrow_function_name_offset = m_arrow_function_shape->lookup(vm.names.name.to_string_or_symbol()).value().offset;
+
     m_native_function_shape = heap().allocate<Shape>(realm);
     m_native_function_shape->set_prototype_without_transition(m_function_prototype);
     m_native_function_shape->add_property_without_transition(vm.names.length, Attribute::Configurable);
@@ -242,18 +249,12 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
     m_function_prototype->initialize(realm);
     m_object_prototype->initialize(realm);
 
-#define __JS_ENUMERATE(ClassName, snake_name) \
-    VERIFY(!m_##snake_name##_prototype);      \
-    m_##snake_name##_prototype = realm.create<ClassName##Prototype>(realm);
-    JS_ENUMERATE_ITERATOR_PROTOTYPES
-#undef __JS_ENUMERATE
+    // OPTIMIZATION: Iterator prototypes, the global object functions and most constructors are only created once they
+    //               are first used, as most realms (e.g. those of iframes) only ever use a few of them.
 
     // These must be initialized separately as they have no companion constructor
-    m_async_from_sync_iterator_prototype = realm.create<AsyncFromSyncIteratorPrototype>(realm);
     m_async_generator_prototype = realm.create<AsyncGeneratorPrototype>(realm);
     m_generator_prototype = realm.create<GeneratorPrototype>(realm);
-    m_intl_segments_prototype = realm.create<Intl::SegmentsPrototype>(realm);
-    m_wrap_for_valid_iterator_prototype = realm.create<WrapForValidIteratorPrototype>(realm);
 
     // These must be initialized before allocating...
     // - AggregateErrorPrototype, which uses ErrorPrototype as its prototype
@@ -266,19 +267,6 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
     // Not included in JS_ENUMERATE_NATIVE_OBJECTS due to missing distinct prototype
     m_proxy_constructor = realm.create<ProxyConstructor>(realm);
 
-    // Global object functions
-    m_eval_function = NativeFunction::create(realm, GlobalObject::eval, 1, vm.names.eval, &realm);
-    m_is_finite_function = NativeFunction::create(realm, GlobalObject::is_finite, 1, vm.names.isFinite, &realm);
-    m_is_nan_function = NativeFunction::create(realm, GlobalObject::is_nan, 1, vm.names.isNaN, &realm);
-    m_parse_float_function = NativeFunction::create(realm, GlobalObject::parse_float, 1, vm.names.parseFloat, &realm);
-    m_parse_int_function = NativeFunction::create(realm, GlobalObject::parse_int, 2, vm.names.parseInt, &realm);
-    m_decode_uri_function = NativeFunction::create(realm, GlobalObject::decode_uri, 1, vm.names.decodeURI, &realm);
-    m_decode_uri_component_function = NativeFunction::create(realm, GlobalObject::decode_uri_component, 1, vm.names.decodeURIComponent, &realm);
-    m_encode_uri_function = NativeFunction::create(realm, GlobalObject::encode_uri, 1, vm.names.encodeURI, &realm);
-    m_encode_uri_component_function = NativeFunction::create(realm, GlobalObject::encode_uri_component, 1, vm.names.encodeURIComponent, &realm);
-    m_escape_function = NativeFunction::create(realm, GlobalObject::escape, 1, vm.names.escape, &realm);
-    m_unescape_function = NativeFunction::create(realm, GlobalObject::unescape, 1, vm.names.unescape, &realm);
-
     m_object_constructor = realm.create<ObjectConstructor>(realm);
 
     // 10.2.4.1 %ThrowTypeError% ( ), https://tc39.es/ecma262/#sec-%throwtypeerror%
@@ -311,10 +299,6 @@ void Intrinsics::initialize_intrinsics(Realm& realm)
     // 27.6.1.1 AsyncGenerator.prototype.constructor, https://tc39.es/ecma262/#sec-asyncgenerator-prototype-constructor
     m_async_generator_prototype->define_direct_property(vm.names.constructor, m_async_generator_function_prototype, Attribute::Configurable);
 
-    m_array_prototype_values_function = &array_prototype()->get_without_side_effects(vm.names.values).as_function();
-    m_date_constructor_now_function = &date_constructor()->get_without_side_effects(vm.names.now).as_function();
-    m_json_parse_function = &json_object()->get_without_side_effects(vm.names.parse).as_function();
-    m_json_stringify_function = &json_object()->get_without_side_effects(vm.names.stringify).as_function();
     m_object_prototype_to_string_function = &object_prototype()->get_without_side_effects(vm.names.toString).as_function();
 }
 
@@ -342,6 +326,11 @@ JS_ENUMERATE_TYPED_ARRAYS
             m_##snake_namespace##snake_name##_constructor = m_realm->create<Namespace::ConstructorName>(m_realm);                                        \
         }                                                                                                                                                \
                                                                                                                                                          \
+        if constexpr (IsSame<Namespace::ConstructorName, ArrayConstructor>)                                                                              \
+            m_array_prototype_values_function = &m_array_prototype->get_without_side_effects(vm.names.values).as_function();                            \
+        else if constexpr (IsSame<Namespace::ConstructorName, DateConstructor>)                                                                          \
+            m_date_constructor_now_function = &m_date_constructor->get_without_side_effects(vm.names.now).as_function();                                 \
+                                                                                                                                                         \
         /* FIXME: Add these special cases to JS_ENUMERATE_NATIVE_OBJECTS */                                                                              \
         if constexpr (IsSame<Namespace::ConstructorName, BigIntConstructor>)                                                                             \
             initialize_constructor(vm, vm.names.BigInt, *m_##snake_namespace##snake_name##_constructor, m_##snake_namespace##snake_name##_prototype);    \
@@ -394,16 +383,125 @@ JS_ENUMERATE_TEMPORAL_OBJECTS
 
 #undef __JS_ENUMERATE_INNER
 
-#define __JS_ENUMERATE(ClassName, snake_name)                              \
-    GC::Ref<ClassName> Intrinsics::snake_name##_object()                   \
-    {                                                                      \
-        if (!m_##snake_name##_object)                                      \
-            m_##snake_name##_object = m_realm->create<ClassName>(m_realm); \
-        return *m_##snake_name##_object;                                   \
+#define __JS_ENUMERATE(ClassName, snake_name)                                                                                  \
+    GC::Ref<ClassName> Intrinsics::snake_name##_object()                                                                       \
+    {                                                                                                                          \
+        if (!m_##snake_name##_object) {                                                                                        \
+            m_##snake_name##_object = m_realm->create<ClassName>(m_realm);                                                     \
+            if constexpr (IsSame<ClassName, JSONObject>) {                                                                     \
+                m_json_parse_function = &m_json_object->get_without_side_effects(vm().names.parse).as_function();              \
+                m_json_stringify_function = &m_json_object->get_without_side_effects(vm().names.stringify).as_function();      \
+            }                                                                                                                  \
+        }                                                                                                                      \
+        return *m_##snake_name##_object;                                                                                       \
     }
 JS_ENUMERATE_BUILTIN_NAMESPACE_OBJECTS
 #undef __JS_ENUMERATE
 
+template<typename T>
+static GC::Ref<FunctionObject> next_function_of(T& prototype)
+{
+    return prototype.get_without_side_effects(prototype.vm().names.next).as_function();
+}
+
+#define __JS_ENUMERATE(ClassName, snake_name)                                                                   \
+    GC::Ref<Object> Intrinsics::snake_name##_prototype()                                                        \
+    {                                                                                                           \
+        if (!m_##snake_name##_prototype) {                                                                      \
+            m_##snake_name##_prototype = m_realm->create<ClassName##Prototype>(m_realm);                        \
+            if constexpr (IsSame<ClassName##Prototype, ArrayIteratorPrototype>)                                 \
+                m_array_iterator_prototype_next_function = next_function_of(*m_##snake_name##_prototype);       \
+            else if constexpr (IsSame<ClassName##Prototype, MapIteratorPrototype>)                              \
+                m_map_iterator_prototype_next_function = next_function_of(*m_##snake_name##_prototype);         \
+            else if constexpr (IsSame<ClassName##Prototype, SetIteratorPrototype>)                              \
+                m_set_iterator_prototype_next_function = next_function_of(*m_##snake_name##_prototype);         \
+            else if constexpr (IsSame<ClassName##Prototype, StringIteratorPrototype>)                           \
+                m_string_iterator_prototype_next_function = next_function_of(*m_##snake_name##_prototype);      \
+        }                                                                                                       \
+        return *m_##snake_name##_prototype;                                                                     \
+    }
+JS_ENUMERATE_ITERATOR_PROTOTYPES
+#undef __JS_ENUMERATE
+
+GC::Ref<Object> Intrinsics::async_from_sync_iterator_prototype()
+{
+    if (!m_async_from_sync_iterator_prototype)
+        m_async_from_sync_iterator_prototype = m_realm->create<AsyncFromSyncIteratorPrototype>(m_realm);
+    return *m_async_from_sync_iterator_prototype;
+}
+
+GC::Ref<Object> Intrinsics::wrap_for_valid_iterator_prototype()
+{
+    if (!m_wrap_for_valid_iterator_prototype)
+        m_wrap_for_valid_iterator_prototype = m_realm->create<WrapForValidIteratorPrototype>(m_realm);
+    return *m_wrap_for_valid_iterator_prototype;
+}
+
+GC::Ref<Object> Intrinsics::intl_segments_prototype()
+{
+    if (!m_intl_segments_prototype)
+        m_intl_segments_prototype = m_realm->create<Intl::SegmentsPrototype>(m_realm);
+    return *m_intl_segments_prototype;
+}
+
+#define __JS_ENUMERATE(snake_name, name, length)                                                                                \
+    GC::Ref<FunctionObject> Intrinsics::snake_name##_function()                                                                 \
+    {                                                                                                                           \
+        if (!m_##snake_name##_function)                                                                                         \
+            m_##snake_name##_function = NativeFunction::create(m_realm, GlobalObject::snake_name, length, vm().names.name, m_realm); \
+        return *m_##snake_name##_function;                                                                                      \
+    }
+JS_ENUMERATE_GLOBAL_OBJECT_FUNCTIONS
+#undef __JS_ENUMERATE
+
+GC::Ref<FunctionObject> Intrinsics::array_prototype_values_function()
+{
+    (void)array_prototype();
+    return *m_array_prototype_values_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::array_iterator_prototype_next_function()
+{
+    (void)array_iterator_prototype();
+    return *m_array_iterator_prototype_next_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::date_constructor_now_function()
+{
+    (void)date_constructor();
+    return *m_date_constructor_now_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::json_parse_function()
+{
+    (void)json_object();
+    return *m_json_parse_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::json_stringify_function()
+{
+    (void)json_object();
+    return *m_json_stringify_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::map_iterator_prototype_next_function()
+{
+    (void)map_iterator_prototype();
+    return *m_map_iterator_prototype_next_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::set_iterator_prototype_next_function()
+{
+    (void)set_iterator_prototype();
+    return *m_set_iterator_prototype_next_function;
+}
+
+GC::Ref<FunctionObject> Intrinsics::string_iterator_prototype_next_function()
+{
+    (void)string_iterator_prototype();
+    return *m_string_iterator_prototype_next_function;
+}
+
 void Intrinsics::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -413,6 +511,7 @@ void Intrinsics::visit_edges(Visitor& visitor)
     visitor.visit(m_iterator_result_object_shape);
     visitor.visit(m_normal_function_prototype_shape);
     visitor.visit(m_normal_function_shape);
+    visitor.visit(m_arrow_function_shape);
     visitor.visit(m_native_function_shape);
     visitor.visit(m_unmapped_arguments_object_shape);
     visitor.visit(m_mapped_arguments_object_shape);
@@ -422,23 +521,15 @@ void Intrinsics::visit_edges(Visitor& visitor)
     visitor.visit(m_generator_prototype);
     visitor.visit(m_intl_segments_prototype);
     visitor.visit(m_wrap_for_valid_iterator_prototype);
-    visitor.visit(m_eval_function);
-    visitor.visit(m_is_finite_function);
-    visitor.visit(m_is_nan_function);
-    visitor.visit(m_parse_float_function);
-    visitor.visit(m_parse_int_function);
-    visitor.visit(m_decode_uri_function);
-    visitor.visit(m_decode_uri_component_function);
-    visitor.visit(m_encode_uri_function);
-    visitor.visit(m_encode_uri_component_function);
-    visitor.visit(m_escape_function);
-    visitor.visit(m_unescape_function);
     visitor.visit(m_array_prototype_values_function);
+    visitor.visit(m_array_iterator_prototype_next_function);
     visitor.visit(m_date_constructor_now_function);
-    visitor.visit(m_eval_function);
     visitor.visit(m_json_parse_function);
     visitor.visit(m_json_stringify_function);
+    visitor.visit(m_map_iterator_prototype_next_function);
     visitor.visit(m_object_prototype_to_string_function);
+    visitor.visit(m_set_iterator_prototype_next_function);
+    visitor.visit(m_string_iterator_prototype_next_function);
     visitor.visit(m_throw_type_error_function);
     visitor.visit(m_throw_type_error_accessor);
 
@@ -470,6 +561,11 @@ void Intrinsics::visit_edges(Visitor& visitor)
     JS_ENUMERATE_ITERATOR_PROTOTYPES
 #undef __JS_ENUMERATE
 
+#define __JS_ENUMERATE(snake_name, name, length) \
+    visitor.visit(m_##snake_name##_function);
+    JS_ENUMERATE_GLOBAL_OBJECT_FUNCTIONS
+#undef __JS_ENUMERATE
+
     visitor.visit(m_default_collator);
 }
 
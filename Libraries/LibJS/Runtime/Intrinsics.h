@@ -36,6 +36,10 @@ public:
     [[nodiscard]] u32 normal_function_name_offset() const { return m_normal_function_name_offset; }
     [[nodiscard]] u32 normal_function_prototype_offset() const { return m_normal_function_prototype_offset; }
 
+    [[nodiscard]] GC::Ref<Shape> arrow_function_shape() { return *m_arrow_function_shape; }
+    [[nodiscard]] u32 arrow_function_length_offset() const { return m_arrow_function_length_offset; }
+    [[nodiscard]] u32 arrow_function_name_offset() const { return m_arrow_function_name_offset; }
+
     [[nodiscard]] GC::Ref<Shape> native_function_shape() { return *m_native_function_shape; }
     [[nodiscard]] u32 native_function_length_offset() const { return m_native_function_length_offset; }
     [[nodiscard]] u32 native_function_name_offset() const { return m_native_function_name_offset; }
@@ -56,10 +60,10 @@ public:
     GC::Ref<ProxyConstructor> proxy_constructor() { return *m_proxy_constructor; }
 
     // Not included in JS_ENUMERATE_NATIVE_OBJECTS due to missing distinct constructor
-    GC::Ref<Object> async_from_sync_iterator_prototype() { return *m_async_from_sync_iterator_prototype; }
+    GC::Ref<Object> async_from_sync_iterator_prototype();
     GC::Ref<Object> async_generator_prototype() { return *m_async_generator_prototype; }
     GC::Ref<Object> generator_prototype() { return *m_generator_prototype; }
-    GC::Ref<Object> wrap_for_valid_iterator_prototype() { return *m_wrap_for_valid_iterator_prototype; }
+    GC::Ref<Object> wrap_for_valid_iterator_prototype();
 
     // Alias for the AsyncGenerator Prototype Object used by the spec (%AsyncGeneratorFunction.prototype.prototype%)
     GC::Ref<Object> async_generator_function_prototype_prototype() { return *m_async_generator_prototype; }
@@ -67,27 +71,26 @@ public:
     GC::Ref<Object> generator_function_prototype_prototype() { return *m_generator_prototype; }
 
     // Not included in JS_ENUMERATE_INTL_OBJECTS due to missing distinct constructor
-    GC::Ref<Object> intl_segments_prototype() { return *m_intl_segments_prototype; }
+    GC::Ref<Object> intl_segments_prototype();
 
     // Global object functions
-    GC::Ref<FunctionObject> eval_function() const { return *m_eval_function; }
-    GC::Ref<FunctionObject> is_finite_function() const { return *m_is_finite_function; }
-    GC::Ref<FunctionObject> is_nan_function() const { return *m_is_nan_function; }
-    GC::Ref<FunctionObject> parse_float_function() const { return *m_parse_float_function; }
-    GC::Ref<FunctionObject> parse_int_function() const { return *m_parse_int_function; }
-    GC::Ref<FunctionObject> decode_uri_function() const { return *m_decode_uri_function; }
-    GC::Ref<FunctionObject> decode_uri_component_function() const { return *m_decode_uri_component_function; }
-    GC::Ref<FunctionObject> encode_uri_function() const { return *m_encode_uri_function; }
-    GC::Ref<FunctionObject> encode_uri_component_function() const { return *m_encode_uri_component_function; }
-    GC::Ref<FunctionObject> escape_function() const { return *m_escape_function; }
-    GC::Ref<FunctionObject> unescape_function() const { return *m_unescape_function; }
+#define __JS_ENUMERATE(snake_name, name, length) \
+    GC::Ref<FunctionObject> snake_name##_function();
+    JS_ENUMERATE_GLOBAL_OBJECT_FUNCTIONS
+#undef __JS_ENUMERATE
 
     // Namespace/constructor object functions
-    GC::Ref<FunctionObject> array_prototype_values_function() const { return *m_array_prototype_values_function; }
-    GC::Ref<FunctionObject> date_constructor_now_function() const { return *m_date_constructor_now_function; }
-    GC::Ref<FunctionObject> json_parse_function() const { return *m_json_parse_function; }
-    GC::Ref<FunctionObject> json_stringify_function() const { return *m_json_stringify_function; }
+    // NOTE: These are remembered when the object they belong to is created, so creating it on first use here still
+    //       returns the original function even if script has replaced the property since.
+    GC::Ref<FunctionObject> array_prototype_values_function();
+    GC::Ref<FunctionObject> array_iterator_prototype_next_function();
+    GC::Ref<FunctionObject> date_constructor_now_function();
+    GC::Ref<FunctionObject> json_parse_function();
+    GC::Ref<FunctionObject> json_stringify_function();
+    GC::Ref<FunctionObject> map_iterator_prototype_next_function();
     GC::Ref<FunctionObject> object_prototype_to_string_function() const { return *m_object_prototype_to_string_function; }
+    GC::Ref<FunctionObject> set_iterator_prototype_next_function();
+    GC::Ref<FunctionObject> string_iterator_prototype_next_function();
     GC::Ref<FunctionObject> throw_type_error_function() const { return *m_throw_type_error_function; }
 
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, ArrayType) \
@@ -114,10 +117,7 @@ public:
 #undef __JS_ENUMERATE
 
 #define __JS_ENUMERATE(ClassName, snake_name) \
-    GC::Ref<Object> snake_name##_prototype()  \
-    {                                         \
-        return *m_##snake_name##_prototype;   \
-    }
+    GC::Ref<Object> snake_name##_prototype();
     JS_ENUMERATE_ITERATOR_PROTOTYPES
 #undef __JS_ENUMERATE
 
@@ -165,6 +165,10 @@ private:
     u32 m_normal_function_name_offset { 0 };
     u32 m_normal_function_prototype_offset { 0 };
 
+    GC::Ptr<Shape> m_arrow_function_shape;
+    u32 m_arrow_function_length_offset { 0 };
+    u32 m_arrow_function_name_offset { 0 };
+
     GC::Ptr<Shape> m_native_function_shape;
     u32 m_native_function_length_offset { 0 };
     u32 m_native_function_name_offset { 0 };
@@ -194,24 +198,21 @@ private:
     GC::Ptr<Object> m_intl_segments_prototype;
 
     // Global object functions
-    GC::Ptr<FunctionObject> m_eval_function;
-    GC::Ptr<FunctionObject> m_is_finite_function;
-    GC::Ptr<FunctionObject> m_is_nan_function;
-    GC::Ptr<FunctionObject> m_parse_float_function;
-    GC::Ptr<FunctionObject> m_parse_int_function;
-    GC::Ptr<FunctionObject> m_decode_uri_function;
-    GC::Ptr<FunctionObject> m_decode_uri_component_function;
-    GC::Ptr<FunctionObject> m_encode_uri_function;
-    GC::Ptr<FunctionObject> m_encode_uri_component_function;
-    GC::Ptr<FunctionObject> m_escape_function;
-    GC::Ptr<FunctionObject> m_unescape_function;
+#define __JS_ENUMERATE(snake_name, name, length) \
+    GC::Ptr<FunctionObject> m_##snake_name##_function;
+    JS_ENUMERATE_GLOBAL_OBJECT_FUNCTIONS
+#undef __JS_ENUMERATE
 
     // Namespace/constructor object functions
     GC::Ptr<FunctionObject> m_array_prototype_values_function;
+    GC::Ptr<FunctionObject> m_array_iterator_prototype_next_function;
     GC::Ptr<FunctionObject> m_date_constructor_now_function;
     GC::Ptr<FunctionObject> m_json_parse_function;
     GC::Ptr<FunctionObject> m_json_stringify_function;
+    GC::Ptr<FunctionObject> m_map_iterator_prototype_next_function;
     GC::Ptr<FunctionObject> m_object_prototype_to_string_function;
+    GC::Ptr<FunctionObject> m_set_iterator_prototype_next_function;
+    GC::Ptr<FunctionObject> m_string_iterator_prototype_next_function;
     GC::Ptr<FunctionObject> m_throw_type_error_function;
 
 #define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, ArrayType) \
@@ -239,6 +239,19 @@ ThrowCompletionOr<GC::Ptr<Object>> iterator_step(VM& vm, IteratorRecord& iterato
 // 7.4.10 IteratorStepValue ( iteratorRecord ), https://tc39.es/ecma262/#sec-iteratorstepvalue
 ThrowCompletionOr<Optional<Value>> iterator_step_value(VM& vm, IteratorRecord& iterator_record)
 {
+    // OPTIMIZATION: Built-in iterators with their original next method can be stepped without creating result objects.
+    if (auto* builtin_iterator = iterator_record.iterator->as_builtin_iterator_if_next_is_not_redefined(iterator_record)) {
+        Value value;
+        bool done = false;
+        auto result = builtin_iterator->next(vm, done, value);
+        if (result.is_error() || done) {
+            iterator_record.done = true;
+            TRY(result);
+            return OptionalNone {};
+        }
+        return value;
+    }
+
     // 1. Let result be ? IteratorStep(iteratorRecord).
     auto result = TRY(iterator_step(vm, iterator_record));
 
@@ -8,6 +8,8 @@
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
+#include <AK/JsonStructuralIndex.h>
+#include <AK/SIMDExtras.h>
 #include <AK/StringBuilder.h>
 #include <AK/TypeCasts.h>
 #include <AK/Utf16View.h>
@@ -23,6 +25,7 @@
 #include <LibJS/Runtime/NumberObject.h>
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/RawJSONObject.h>
+#include <LibJS/Runtime/Shape.h>
 #include <LibJS/Runtime/StringObject.h>
 #include <LibJS/Runtime/ValueInlines.h>
 
@@ -49,6 +52,310 @@ void JSONObject::initialize(Realm& realm)
     define_direct_property(vm.well_known_symbol_to_string_tag(), PrimitiveString::create(vm, "JSON"_string), Attribute::Configurable);
 }
 
+// Finds the first byte that QuoteJSONString may have to escape: a quotation mark, a reverse solidus, a control character,
+// or 0xED, which is how encoded surrogates (and a few other code points) start.
+static size_t find_first_byte_to_escape(ReadonlyBytes bytes)
+{
+    using AK::SIMD::u8x16;
+
+    size_t i = 0;
+    for (; i + 16 <= bytes.size(); i += 16) {
+        auto chunk = AK::SIMD::load_unaligned<u8x16>(bytes.data() + i);
+        auto mask = AK::SIMD::maskbits(static_cast<AK::SIMD::i8x16>((chunk < 0x20) | (chunk == '"') | (chunk == '\\') | (chunk == 0xED)));
+        if (mask != 0)
+            return i + count_trailing_zeroes(mask);
+    }
+    for (; i < bytes.size(); ++i) {
+        if (bytes[i] < 0x20 || bytes[i] == '"' || bytes[i] == '\\' || bytes[i] == 0xED)
+            return i;
+    }
+    return bytes.size();
+}
+
+// 25.5.2.2 QuoteJSONString ( value ), https://tc39.es/ecma262/#sec-quotejsonstring
+static void append_quoted_json_string(StringBuilder& builder, StringView string)
+{
+    // 1. Let product be the String value consisting solely of the code unit 0x0022 (QUOTATION MARK).
+    builder.append('"');
+
+    // 2. For each code point C of StringToCodePoints(value), do
+    while (!string.is_empty()) {
+        // OPTIMIZATION: Code points that are appended as they are make up most strings, so we append runs of them at once.
+        auto index = find_first_byte_to_escape(string.bytes());
+        builder.append(string.substring_view(0, index));
+        if (index == string.length())
+            break;
+        string = string.substring_view(index);
+
+        u32 code_point = static_cast<u8>(string[0]);
+        size_t code_point_length = 1;
+        if (code_point == 0xED && string.length() >= 3) {
+            code_point = ((string[0] & 0x0F) << 12) | ((string[1] & 0x3F) << 6) | (string[2] & 0x3F);
+            code_point_length = 3;
+        }
+        string = string.substring_view(code_point_length);
+
+        // a. If C is listed in the “Code Point” column of Table 70, then
+        // i. Set product to the string-concatenation of product and the escape sequence for C as specified in the “Escape Sequence” column of the corresponding row.
+        switch (code_point) {
+        case '\b':
+            builder.append("\\b"sv);
+            break;
+        case '\t':
+            builder.append("\\t"sv);
+            break;
+        case '\n':
+            builder.append("\\n"sv);
+            break;
+        case '\f':
+            builder.append("\\f"sv);
+            break;
+        case '\r':
+            builder.append("\\r"sv);
+            break;
+        case '"':
+            builder.append("\\\""sv);
+            break;
+        case '\\':
+            builder.append("\\\\"sv);
+            break;
+        default:
+            // b. Else if C has a numeric value less than 0x0020 (SPACE), or if C has the same numeric value as a leading surrogate or trailing surrogate, then
+            if (code_point < 0x20 || is_unicode_surrogate(code_point)) {
+                // i. Let unit be the code unit whose numeric value is that of C.
+                // ii. Set product to the string-concatenation of product and UnicodeEscape(unit).
+                builder.appendff("\\u{:04x}", code_point);
+            }
+            // c. Else,
+            else {
+                // i. Set product to the string-concatenation of product and UTF16EncodeCodePoint(C).
+                builder.append_code_point(code_point);
+            }
+        }
+    }
+
+    // 3. Set product to the string-concatenation of product and the code unit 0x0022 (QUOTATION MARK).
+    builder.append('"');
+}
+
+// OPTIMIZATION: Serializes values without a replacer function or property list by reading the properties of plain
+//               objects and arrays straight from their storage. This gives up, without any observable side effects, as
+//               soon as it finds something whose serialization could involve user code or exotic behavior, such as an
+//               accessor, a toJSON method, a proxy or a wrapper object. The caller then starts over on the slow path.
+class JSONFastSerializer {
+public:
+    JSONFastSerializer(Realm& realm, String const& gap)
+        : m_realm(realm)
+        , m_gap(gap)
+    {
+    }
+
+    Optional<String> serialize(Value value)
+    {
+        if (!prototypes_are_unmodified())
+            return {};
+        if (!serialize_value(value))
+            return {};
+        return m_builder.to_string_without_validation();
+    }
+
+private:
+    struct SerializedProperty {
+        u32 offset { 0 };
+        String quoted_key;
+    };
+
+    // Both toJSON methods and the elements in array holes are looked up on the prototype chain, so we need to know that
+    // the prototypes of plain objects and arrays don't have either.
+    bool prototypes_are_unmodified() const
+    {
+        auto& vm = m_realm.vm();
+        auto is_unmodified = [&](Object const& prototype, Object const* expected_prototype) {
+            return prototype.shape().prototype() == expected_prototype
+                && prototype.indexed_properties().is_empty()
+                && !prototype.shape().lookup(vm.names.toJSON.as_string()).has_value();
+        };
+
+        auto const& object_prototype = *m_realm.intrinsics().object_prototype();
+        auto const& array_prototype = *m_realm.intrinsics().array_prototype();
+        return is_unmodified(object_prototype, nullptr) && is_unmodified(array_prototype, &object_prototype);
+    }
+
+    bool serialize_value(Value value)
+    {
+        if (value.is_null()) {
+            m_builder.append("null"sv);
+            return true;
+        }
+        if (value.is_boolean()) {
+            m_builder.append(value.as_bool() ? "true"sv : "false"sv);
+            return true;
+        }
+        if (value.is_string()) {
+            append_quoted_json_string(m_builder, value.as_string().utf8_string_view());
+            return true;
+        }
+        if (value.is_number()) {
+            if (value.is_finite_number())
+                number_to_string(m_builder, value.as_double());
+            else
+                m_builder.append("null"sv);
+            return true;
+        }
+
+        // NOTE: Undefined and symbols are only valid inside of objects and arrays, and BigInts throw.
+        if (!value.is_object())
+            return false;
+
+        auto& object = value.as_object();
+        if (is<Array>(object))
+            return serialize_array(static_cast<Array&>(object));
+        return serialize_object(object);
+    }
+
+    bool serialize_object(Object& object)
+    {
+        if (object.shape().prototype() != m_realm.intrinsics().object_prototype())
+            return false;
+        if (object.is_function() || object.is_proxy_object() || object.is_raw_json_object() || object.is_number_object()
+            || object.is_string_object() || object.is_boolean_object() || object.is_bigint_object()
+            || object.is_html_window_proxy() || object.has_parameter_map() || object.has_intrinsic_accessors())
+            return false;
+        if (!object.indexed_properties().is_empty())
+            return false;
+
+        auto const* properties = properties_for_shape(object.shape());
+        if (!properties)
+            return false;
+
+        if (m_objects_being_serialized.set(&object) != AK::HashSetResult::InsertedNewEntry)
+            return false;
+
+        m_builder.append('{');
+        ++m_depth;
+        bool first = true;
+        for (auto const& property : *properties) {
+            auto value = object.get_direct(property.offset);
+            if (value.is_accessor())
+                return false;
+            if (value.is_undefined() || value.is_symbol())
+                continue;
+
+            if (!first)
+                m_builder.append(',');
+            first = false;
+
+            append_line_break();
+            m_builder.append(property.quoted_key);
+            if (!serialize_value(value))
+                return false;
+        }
+        --m_depth;
+        if (!first)
+            append_line_break();
+        m_builder.append('}');
+
+        m_objects_being_serialized.remove(&object);
+        return true;
+    }
+
+    bool serialize_array(Array& array)
+    {
+        if (array.shape().prototype() != m_realm.intrinsics().array_prototype())
+            return false;
+        // NOTE: Any named own property could be a toJSON method.
+        if (array.shape().property_count() != 0 || array.has_intrinsic_accessors())
+            return false;
+
+        if (m_objects_being_serialized.set(&array) != AK::HashSetResult::InsertedNewEntry)
+            return false;
+
+        auto const& elements = array.indexed_properties();
+        auto length = elements.array_like_size();
+
+        m_builder.append('[');
+        ++m_depth;
+        for (size_t i = 0; i < length; ++i) {
+            if (i != 0)
+                m_builder.append(',');
+            append_line_break();
+
+            auto element = elements.get(i);
+            if (!element.has_value() || element->value.is_undefined() || element->value.is_symbol()) {
+                m_builder.append("null"sv);
+                continue;
+            }
+            if (element->value.is_accessor())
+                return false;
+
+            auto length_before_element = m_builder.length();
+            if (!serialize_value(element->value))
+                return false;
+
+            // OPTIMIZATION: The elements of an array tend to be alike, so we make room for the remaining ones based on
+            //               the size of the first.
+            if (i == 0 && length > 1) {
+                auto estimated_length = (m_builder.length() - length_before_element + 1) * (length - 1);
+                (void)m_builder.try_ensure_capacity(m_builder.length() + estimated_length);
+            }
+        }
+        --m_depth;
+        if (length != 0)
+            append_line_break();
+        m_builder.append(']');
+
+        m_objects_being_serialized.remove(&array);
+        return true;
+    }
+
+    // OPTIMIZATION: Objects with the same shape have the same keys in the same order, so we only quote them once.
+    Vector<SerializedProperty> const* properties_for_shape(Shape const& shape)
+    {
+        if (auto it = m_properties_by_shape.find(&shape); it != m_properties_by_shape.end())
+            return it->value.has_value() ? &it->value.value() : nullptr;
+
+        auto& vm = m_realm.vm();
+        Optional<Vector<SerializedProperty>> properties;
+        properties.emplace();
+
+        for (auto const& [key, metadata] : shape.property_table()) {
+            if (key.is_symbol())
+                continue;
+            if (key.as_string() == vm.names.toJSON.as_string()) {
+                properties.clear();
+                break;
+            }
+            if (!metadata.attributes.is_enumerable())
+                continue;
+
+            StringBuilder builder;
+            append_quoted_json_string(builder, key.as_string());
+            builder.append(m_gap.is_empty() ? ":"sv : ": "sv);
+            properties->append({ metadata.offset, builder.to_string_without_validation() });
+        }
+
+        auto& entry = m_properties_by_shape.ensure(&shape, [&] { return move(properties); });
+        return entry.has_value() ? &entry.value() : nullptr;
+    }
+
+    void append_line_break()
+    {
+        if (m_gap.is_empty())
+            return;
+        m_builder.append('\n');
+        for (size_t i = 0; i < m_depth; ++i)
+            m_builder.append(m_gap);
+    }
+
+    Realm& m_realm;
+    String const& m_gap;
+    StringBuilder m_builder;
+    size_t m_depth { 0 };
+
+    HashTable<Object const*> m_objects_being_serialized;
+    HashMap<Shape const*, Optional<Vector<SerializedProperty>>> m_properties_by_shape;
+};
+
 // 25.5.2 JSON.stringify ( value [ , replacer [ , space ] ] ), https://tc39.es/ecma262/#sec-json.stringify
 ThrowCompletionOr<Optional<String>> JSONObject::stringify_impl(VM& vm, Value value, Value replacer, Value space)
 {
@@ -108,6 +415,11 @@ ThrowCompletionOr<Optional<String>> JSONObject::stringify_impl(VM& vm, Value val
         state.gap = String {};
     }
 
+    if (!state.replacer_function && !state.property_list.has_value()) {
+        if (auto result = JSONFastSerializer(realm, state.gap).serialize(value); result.has_value())
+            return result.release_value();
+    }
+
     auto wrapper = Object::create(realm, realm.intrinsics().object_prototype());
     MUST(wrapper->create_data_property_or_throw(String {}, value));
     return serialize_json_property(vm, state, String {}, wrapper);
@@ -362,55 +674,8 @@ ThrowCompletionOr<String> JSONObject::serialize_json_array(VM& vm, StringifyStat
 // 25.5.2.2 QuoteJSONString ( value ), https://tc39.es/ecma262/#sec-quotejsonstring
 String JSONObject::quote_json_string(String string)
 {
-    // 1. Let product be the String value consisting solely of the code unit 0x0022 (QUOTATION MARK).
-    StringBuilder builder;
-    builder.append('"');
-
-    // 2. For each code point C of StringToCodePoints(value), do
-    auto utf_view = Utf8View(string);
-    for (auto code_point : utf_view) {
-        // a. If C is listed in the “Code Point” column of Table 70, then
-        // i. Set product to the string-concatenation of product and the escape sequence for C as specified in the “Escape Sequence” column of the corresponding row.
-        switch (code_point) {
-        case '\b':
-            builder.append("\\b"sv);
-            break;
-        case '\t':
-            builder.append("\\t"sv);
-            break;
-        case '\n':
-            builder.append("\\n"sv);
-            break;
-        case '\f':
-            builder.append("\\f"sv);
-            break;
-        case '\r':
-            builder.append("\\r"sv);
-            break;
-        case '"':
-            builder.append("\\\""sv);
-            break;
-        case '\\':
-            builder.append("\\\\"sv);
-            break;
-        default:
-            // b. Else if C has a numeric value less than 0x0020 (SPACE), or if C has the same numeric value as a leading surrogate or trailing surrogate, then
-            if (code_point < 0x20 || is_unicode_surrogate(code_point)) {
-                // i. Let unit be the code unit whose numeric value is that of C.
-                // ii. Set product to the string-concatenation of product and UnicodeEscape(unit).
-                builder.appendff("\\u{:04x}", code_point);
-            }
-            // c. Else,
-            else {
-                // i. Set product to the string-concatenation of product and UTF16EncodeCodePoint(C).
-                builder.append_code_point(code_point);
-            }
-        }
-    }
-    // 3. Set product to the string-concatenation of product and the code unit 0x0022 (QUOTATION MARK).
-    builder.append('"');
-
-    // 4. Return product.
+    StringBuilder builder(string.bytes().size() + 2);
+    append_quoted_json_string(builder, string);
     return builder.to_string_without_validation();
 }
 
@@ -447,27 +712,196 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
     return unfiltered;
 }
 
+// Builds JS values straight from the tokens of a JSON text, without going through an intermediate JsonValue.
+class JSONTextParser {
+public:
+    JSONTextParser(VM& vm, JsonStructuralIndex const& index)
+        : m_vm(vm)
+        , m_realm(*vm.current_realm())
+        , m_reader(index)
+        , m_values(vm.heap())
+    {
+    }
+
+    ErrorOr<Value> parse()
+    {
+        auto value = TRY(parse_value());
+        if (!m_reader.is_eof())
+            return AK::Error::from_string_literal("JSON: Didn't consume all input");
+        return value;
+    }
+
+private:
+    ErrorOr<Value> parse_value()
+    {
+        switch (m_reader.peek()) {
+        case '{':
+            return parse_object();
+        case '[':
+            return parse_array();
+        case '"': {
+            auto string = TRY(m_reader.consume_string(m_string_builder));
+            return PrimitiveString::create(m_vm, TRY(String::from_utf8(string.value)));
+        }
+        case 't':
+            TRY(m_reader.consume_literal("true"sv));
+            return Value(true);
+        case 'f':
+            TRY(m_reader.consume_literal("false"sv));
+            return Value(false);
+        case 'n':
+            TRY(m_reader.consume_literal("null"sv));
+            return js_null();
+        default:
+            break;
+        }
+
+        auto number = TRY(m_reader.consume_number());
+        return number.visit([](auto value) { return Value(static_cast<double>(value)); });
+    }
+
+    ErrorOr<Value> parse_object()
+    {
+        auto first_key = m_keys.size();
+        auto first_value = m_values.size();
+
+        bool starts_with_open_brace = m_reader.consume_specific('{');
+        VERIFY(starts_with_open_brace);
+        if (!m_reader.consume_specific('}')) {
+            for (;;) {
+                auto key = TRY(parse_property_key());
+                if (!m_reader.consume_specific(':'))
+                    return AK::Error::from_string_literal("JSON: Expected ':'");
+                auto value = TRY(parse_value());
+
+                m_keys.append(move(key));
+                m_values.append(value);
+
+                if (m_reader.consume_specific('}'))
+                    break;
+                if (!m_reader.consume_specific(','))
+                    return AK::Error::from_string_literal("JSON: Expected ','");
+            }
+        }
+
+        auto object = create_object(m_keys.span().slice(first_key), m_values.span().slice(first_value));
+        m_keys.shrink(first_key);
+        m_values.shrink(first_value);
+        return object;
+    }
+
+    ErrorOr<Value> parse_array()
+    {
+        auto first_value = m_values.size();
+
+        bool starts_with_open_bracket = m_reader.consume_specific('[');
+        VERIFY(starts_with_open_bracket);
+        if (!m_reader.consume_specific(']')) {
+            for (;;) {
+                auto value = TRY(parse_value());
+                m_values.append(value);
+
+                if (m_reader.consume_specific(']'))
+                    break;
+                if (!m_reader.consume_specific(','))
+                    return AK::Error::from_string_literal("JSON: Expected ','");
+            }
+        }
+
+        auto array = Array::create_from(m_realm, m_values.span().slice(first_value));
+        m_values.shrink(first_value);
+        return array;
+    }
+
+    // OPTIMIZATION: The same keys tend to appear over and over in a JSON text, so we only create each key once.
+    ErrorOr<PropertyKey> parse_property_key()
+    {
+        auto key = TRY(m_reader.consume_string(m_string_builder));
+        if (key.had_escapes)
+            return PropertyKey { TRY(FlyString::from_utf8(key.value)) };
+
+        if (auto property_key = m_property_keys.get(key.value); property_key.has_value())
+            return property_key.release_value();
+
+        PropertyKey property_key { TRY(FlyString::from_utf8(key.value)) };
+        m_property_keys.set(key.value, property_key);
+        return property_key;
+    }
+
+    GC::Ref<Object> create_object(ReadonlySpan<PropertyKey> keys, ReadonlySpan<Value> values)
+    {
+        // OPTIMIZATION: Objects in a JSON text tend to share the same keys in the same order. Rather than adding the
+        //               properties one at a time, we walk the shape transitions up front (which the first of those
+        //               objects has created) and fill in the property storage directly.
+        if (auto shape = shape_for_keys(keys)) {
+            auto object = Object::create_with_premade_shape(*shape);
+            for (size_t i = 0; i < values.size(); ++i)
+                object->put_direct(i, values[i]);
+            return object;
+        }
+
+        auto object = Object::create(m_realm, m_realm.intrinsics().object_prototype());
+        for (size_t i = 0; i < keys.size(); ++i)
+            object->define_direct_property(keys[i], values[i], default_attributes);
+        return object;
+    }
+
+    GC::Ptr<Shape> shape_for_keys(ReadonlySpan<PropertyKey> keys)
+    {
+        // Objects with more properties than this use dictionary shapes instead.
+        static constexpr size_t max_property_count = 64;
+        if (keys.size() > max_property_count)
+            return {};
+
+        GC::Ref<Shape> shape = m_realm.intrinsics().new_object_shape();
+        for (size_t i = 0; i < keys.size(); ++i) {
+            // Integer keys become indexed properties, and a repeated key only replaces the value of the first one.
+            if (!keys[i].is_string())
+                return {};
+            for (size_t j = 0; j < i; ++j) {
+                if (keys[j] == keys[i])
+                    return {};
+            }
+            shape = shape->create_put_transition(keys[i].to_string_or_symbol(), default_attributes);
+        }
+        return shape;
+    }
+
+    VM& m_vm;
+    Realm& m_realm;
+    JsonTokenReader m_reader;
+    StringBuilder m_string_builder;
+
+    // The keys and values of the objects and arrays that are still being parsed.
+    Vector<PropertyKey> m_keys;
+    GC::RootVector<Value> m_values;
+
+    HashMap<StringView, PropertyKey> m_property_keys;
+};
+
 // 25.5.1.1 ParseJSON ( text ), https://tc39.es/ecma262/#sec-ParseJSON
 ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
 {
-    auto json = JsonValue::from_string(text);
+    auto index = JsonStructuralIndex::create(text);
 
     // 1. If StringToCodePoints(text) is not a valid JSON text as specified in ECMA-404, throw a SyntaxError exception.
-    if (json.is_error())
-        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-
     // 2. Let scriptString be the string-concatenation of "(", text, and ");".
     // 3. Let script be ParseText(scriptString, Script).
     // 4. NOTE: The early error rules defined in 13.2.5.1 have special handling for the above invocation of ParseText.
     // 5. Assert: script is a Parse Node.
     // 6. Let result be ! Evaluation of script.
-    auto result = JSONObject::parse_json_value(vm, json.value());
+    // NOTE: We validate the text while building the result, and throw as soon as we find it to be invalid.
+    if (index.is_error())
+        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+    auto result = JSONTextParser(vm, index.value()).parse();
+    if (result.is_error())
+        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
 
     // 7. NOTE: The PropertyDefinitionEvaluation semantics defined in 13.2.5.5 have special handling for the above evaluation.
     // 8. Assert: result is either a String, a Number, a Boolean, an Object that is defined by either an ArrayLiteral or an ObjectLiteral, or null.
 
     // 9. Return result.
-    return result;
+    return result.release_value();
 }
 
 Value JSONObject::parse_json_value(VM& vm, JsonValue const& value)
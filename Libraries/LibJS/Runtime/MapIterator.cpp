@@ -30,6 +30,13 @@ void MapIterator::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_map);
 }
 
+BuiltinIterator* MapIterator::as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const& iterator_record)
+{
+    if (iterator_record.next_method != shape().realm().intrinsics().map_iterator_prototype_next_function())
+        return nullptr;
+    return this;
+}
+
 ThrowCompletionOr<void> MapIterator::next(VM& vm, bool& done, Value& value)
 {
     if (m_done) {
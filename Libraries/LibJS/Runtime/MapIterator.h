@@ -23,6 +23,7 @@ public:
     virtual ~MapIterator() override = default;
 
     BuiltinIterator* as_builtin_iterator() override { return this; }
+    BuiltinIterator* as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const&) override;
     ThrowCompletionOr<void> next(VM&, bool& done, Value& value) override;
 
 private:
@@ -214,12 +214,18 @@ public:
 
     virtual BuiltinIterator* as_builtin_iterator() { return nullptr; }
 
+    // Like as_builtin_iterator(), but only succeeds if the record's [[NextMethod]] is still the iterator's original
+    // native next function. Otherwise, calling it is observable and we must go through the generic protocol.
+    virtual BuiltinIterator* as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const&) { return nullptr; }
+
     // B.3.7 The [[IsHTMLDDA]] Internal Slot, https://tc39.es/ecma262/#sec-IsHTMLDDA-internal-slot
     virtual bool is_htmldda() const { return false; }
 
     bool has_parameter_map() const { return m_has_parameter_map; }
     void set_has_parameter_map() { m_has_parameter_map = true; }
 
+    bool has_intrinsic_accessors() const { return m_has_intrinsic_accessors; }
+
     virtual void visit_edges(Cell::Visitor&) override;
 
     Value get_direct(size_t index) const { return m_storage[index]; }
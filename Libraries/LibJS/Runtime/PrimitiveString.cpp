@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
 #include <AK/CharacterTypes.h>
 #include <AK/FlyString.h>
 #include <AK/StringBuilder.h>
@@ -106,11 +107,43 @@ Utf16View PrimitiveString::utf16_string_view() const
     return m_utf16_string->view();
 }
 
+bool PrimitiveString::has_ascii_utf8_string() const
+{
+    resolve_rope_if_needed(EncodingPreference::UTF16);
+
+    if (!has_utf8_string())
+        return false;
+
+    if (m_ascii_state == ASCIIState::Unknown)
+        m_ascii_state = m_utf8_string->is_ascii() ? ASCIIState::ASCII : ASCIIState::NotASCII;
+    return m_ascii_state == ASCIIState::ASCII;
+}
+
 size_t PrimitiveString::length_in_utf16_code_units() const
 {
+    if (has_ascii_utf8_string())
+        return m_utf8_string->bytes_as_string_view().length();
     return utf16_string_view().length_in_code_units();
 }
 
+u16 PrimitiveString::code_unit_at(size_t index) const
+{
+    if (has_ascii_utf8_string())
+        return static_cast<u8>(m_utf8_string->bytes_as_string_view()[index]);
+    return utf16_string_view().code_unit_at(index);
+}
+
+GC::Ref<PrimitiveString> PrimitiveString::substring(VM& vm, size_t code_unit_offset, size_t code_unit_length) const
+{
+    if (has_ascii_utf8_string()) {
+        auto bytes = m_utf8_string->bytes().slice(code_unit_offset, code_unit_length);
+        auto result = create(vm, String::from_utf8_without_validation(bytes));
+        result->m_ascii_state = ASCIIState::ASCII;
+        return result;
+    }
+    return create(vm, Utf16String::create(utf16_string_view().substring_view(code_unit_offset, code_unit_length)));
+}
+
 bool PrimitiveString::operator==(PrimitiveString const& other) const
 {
     if (this == &other)
@@ -134,11 +167,9 @@ ThrowCompletionOr<Optional<Value>> PrimitiveString::get(VM& vm, PropertyKey cons
     auto index = canonical_numeric_index_string(property_key, CanonicalIndexMode::IgnoreNumericRoundtrip);
     if (!index.is_index())
         return Optional<Value> {};
-    auto str = utf16_string_view();
-    auto length = str.length_in_code_units();
-    if (length <= index.as_index())
+    if (length_in_utf16_code_units() <= index.as_index())
         return Optional<Value> {};
-    return create(vm, Utf16String::create(str.substring_view(index.as_index(), 1)));
+    return substring(vm, index.as_index(), 1);
 }
 
 GC::Ref<PrimitiveString> PrimitiveString::create(VM& vm, Utf16String string)
@@ -243,17 +274,32 @@ void RopeString::resolve(EncodingPreference preference) const
         }
 
         if (current->has_utf8_string())
-            approximate_length += current->utf8_string_view().length();
+            approximate_length += current->m_utf8_string->bytes_as_string_view().length();
+        else if (current->has_utf16_string())
+            approximate_length += current->m_utf16_string->length_in_code_units();
         pieces.append(current);
     }
 
-    if (preference == EncodingPreference::UTF16) {
+    // NOTE: A rope of ASCII pieces is resolved to UTF-8 even if the caller prefers UTF-16, as ASCII strings can be
+    //       indexed by their UTF-8 bytes and would only double in size as UTF-16.
+    bool all_pieces_are_ascii = all_of(pieces, [](auto const* piece) { return piece->has_ascii_utf8_string(); });
+
+    if (preference == EncodingPreference::UTF16 && !all_pieces_are_ascii) {
         // The caller wants a UTF-16 string, so we can simply concatenate all the pieces
         // into a UTF-16 code unit buffer and create a Utf16String from it.
 
+        // NOTE: Pieces that only have a UTF-8 string are transcoded straight into the buffer, rather than through
+        //       utf16_string(), so that we don't keep a UTF-16 copy of every piece alive next to the result.
         Utf16Data code_units;
-        for (auto const* current : pieces)
-            code_units.extend(current->utf16_string().string());
+        code_units.ensure_capacity(approximate_length);
+        for (auto const* current : pieces) {
+            if (current->has_utf16_string()) {
+                code_units.extend(current->m_utf16_string->string());
+                continue;
+            }
+            for (auto code_point : Utf8View { current->m_utf8_string->bytes_as_string_view() })
+                MUST(code_point_to_utf16(code_units, code_point));
+        }
 
         m_utf16_string = Utf16String::create(move(code_units));
         m_is_rope = false;
@@ -325,6 +371,8 @@ void RopeString::resolve(EncodingPreference preference) const
 
     // NOTE: We've already produced valid UTF-8 above, so there's no need for additional validation.
     m_utf8_string = builder.to_string_without_validation();
+    if (all_pieces_are_ascii)
+        m_ascii_state = ASCIIState::ASCII;
     m_is_rope = false;
     m_lhs = nullptr;
     m_rhs = nullptr;
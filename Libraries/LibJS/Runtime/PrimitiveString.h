@@ -45,7 +45,11 @@ public:
     [[nodiscard]] Utf16View utf16_string_view() const;
     bool has_utf16_string() const { return m_utf16_string.has_value(); }
 
+    // Strings that only contain ASCII have the same code units in UTF-8 as in UTF-16, so these index the UTF-8 string of
+    // such a string directly instead of converting it to UTF-16 first.
     size_t length_in_utf16_code_units() const;
+    u16 code_unit_at(size_t index) const;
+    [[nodiscard]] GC::Ref<PrimitiveString> substring(VM&, size_t code_unit_offset, size_t code_unit_length) const;
 
     ThrowCompletionOr<Optional<Value>> get(VM&, PropertyKey const&) const;
 
@@ -60,6 +64,13 @@ protected:
 
     mutable bool m_is_rope { false };
 
+    enum class ASCIIState : u8 {
+        Unknown,
+        ASCII,
+        NotASCII,
+    };
+    mutable ASCIIState m_ascii_state { ASCIIState::Unknown };
+
     mutable Optional<String> m_utf8_string;
     mutable Optional<Utf16String> m_utf16_string;
 
@@ -75,6 +86,7 @@ private:
     explicit PrimitiveString(Utf16String);
 
     void resolve_rope_if_needed(EncodingPreference) const;
+    bool has_ascii_utf8_string() const;
 };
 
 class RopeString final : public PrimitiveString {
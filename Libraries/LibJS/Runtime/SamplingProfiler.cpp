@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <LibJS/AST.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Runtime/ECMAScriptFunctionObject.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/NativeFunction.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+
+#if !defined(AK_OS_WINDOWS)
+#    include <signal.h>
+#    include <sys/time.h>
+#endif
+
+namespace JS {
+
+Atomic<bool> SamplingProfiler::s_sample_requested { false };
+Atomic<i64> SamplingProfiler::s_sample_requested_at_ns { 0 };
+SamplingProfiler* SamplingProfiler::s_running_profiler { nullptr };
+
+ErrorOr<NonnullOwnPtr<SamplingProfiler>> SamplingProfiler::start(VM& vm, AK::Duration sampling_interval)
+{
+#if defined(AK_OS_WINDOWS)
+    (void)vm;
+    (void)sampling_interval;
+    return AK::Error::from_string_literal("Sampling the JavaScript call stack is not supported on this platform");
+#else
+    if (s_running_profiler)
+        return AK::Error::from_string_literal("A JavaScript profiler is already running");
+
+    auto profiler = adopt_own(*new SamplingProfiler(vm, sampling_interval));
+
+    struct sigaction action {};
+    action.sa_handler = request_sample;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, nullptr) < 0)
+        return AK::Error::from_syscall("sigaction"sv, errno);
+
+    // NOTE: The profiling timer counts the CPU time of the process, so time spent waiting for events isn't sampled.
+    struct itimerval timer {};
+    timer.it_interval = sampling_interval.to_timeval();
+    timer.it_value = timer.it_interval;
+    if (setitimer(ITIMER_PROF, &timer, nullptr) < 0)
+        return AK::Error::from_syscall("setitimer"sv, errno);
+
+    s_running_profiler = profiler.ptr();
+    return profiler;
+#endif
+}
+
+SamplingProfiler::SamplingProfiler(VM& vm, AK::Duration sampling_interval)
+    : m_vm(vm)
+    , m_sampling_interval(sampling_interval)
+    , m_start_time(MonotonicTime::now())
+    , m_last_sample_time(m_start_time)
+{
+    m_nodes.append({ .function_name = "(root)"_string });
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    stop_sampling();
+}
+
+void SamplingProfiler::stop_sampling()
+{
+    if (s_running_profiler != this)
+        return;
+
+#if !defined(AK_OS_WINDOWS)
+    struct itimerval timer {};
+    setitimer(ITIMER_PROF, &timer, nullptr);
+    signal(SIGPROF, SIG_IGN);
+#endif
+
+    s_running_profiler = nullptr;
+    s_sample_requested.store(false, AK::memory_order_relaxed);
+}
+
+void SamplingProfiler::request_sample(int)
+{
+    // NOTE: This runs in a signal handler, so it may only record that a sample is due.
+    s_sample_requested_at_ns.store(MonotonicTime::now().nanoseconds(), AK::memory_order_relaxed);
+    s_sample_requested.store(true, AK::memory_order_relaxed);
+}
+
+void SamplingProfiler::take_requested_sample()
+{
+    s_sample_requested.store(false, AK::memory_order_relaxed);
+
+    auto* profiler = s_running_profiler;
+    if (!profiler)
+        return;
+
+    // If the timer fired while we were busy outside of JavaScript (e.g. in layout), the current stack doesn't deserve
+    // the blame for it.
+    auto now = MonotonicTime::now();
+    auto requested_at = s_sample_requested_at_ns.load(AK::memory_order_relaxed);
+    if (now.nanoseconds() - requested_at > 2 * profiler->m_sampling_interval.to_nanoseconds())
+        return;
+
+    profiler->take_sample(now);
+}
+
+void SamplingProfiler::take_sample(MonotonicTime now)
+{
+    u32 node_id = 1;
+    for (auto const* context : m_vm.execution_context_stack())
+        node_id = child_node_for(node_id, *context);
+
+    ++m_nodes[node_id - 1].hit_count;
+    m_samples.append(node_id);
+    m_time_deltas_in_microseconds.append((now - m_last_sample_time).to_microseconds());
+    m_last_sample_time = now;
+}
+
+u32 SamplingProfiler::child_node_for(u32 parent_id, ExecutionContext const& context)
+{
+    auto code = context.executable ? bit_cast<FlatPtr>(context.executable.ptr()) : bit_cast<FlatPtr>(context.function.ptr());
+    if (auto child_id = m_nodes[parent_id - 1].children.get(code); child_id.has_value())
+        return *child_id;
+
+    Node node;
+
+    if (context.executable) {
+        node.function_name = context.function_name ? context.function_name->utf8_string() : String {};
+        node.url = context.executable->source_code->filename();
+
+        if (auto const* function = as_if<ECMAScriptFunctionObject>(context.function.ptr())) {
+            // NOTE: Call frames point at the start of their function, with zero-based lines and columns.
+            auto source_range = function->ecmascript_code().source_range();
+            node.line_number = static_cast<i64>(source_range.start.line) - 1;
+            node.column_number = static_cast<i64>(source_range.start.column) - 1;
+        } else {
+            node.line_number = 0;
+            node.column_number = 0;
+        }
+    } else if (auto const* function = as_if<NativeFunction>(context.function.ptr())) {
+        node.function_name = function->name().to_string();
+    } else {
+        node.function_name = "(native)"_string;
+    }
+
+    u32 child_id = m_nodes.size() + 1;
+    m_nodes.append(move(node));
+    m_nodes[parent_id - 1].children.set(code, child_id);
+    return child_id;
+}
+
+JsonObject SamplingProfiler::stop()
+{
+    stop_sampling();
+
+    JsonArray nodes;
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+        auto const& node = m_nodes[i];
+
+        JsonObject call_frame;
+        call_frame.set("functionName"sv, node.function_name);
+        call_frame.set("scriptId"sv, "0"sv);
+        call_frame.set("url"sv, node.url);
+        call_frame.set("lineNumber"sv, node.line_number);
+        call_frame.set("columnNumber"sv, node.column_number);
+
+        JsonArray children;
+        for (auto const& [code, child_id] : node.children)
+            children.must_append(child_id);
+
+        JsonObject object;
+        object.set("id"sv, i + 1);
+        object.set("callFrame"sv, move(call_frame));
+        object.set("hitCount"sv, node.hit_count);
+        object.set("children"sv, move(children));
+        nodes.must_append(move(object));
+    }
+
+    JsonArray samples;
+    for (auto sample : m_samples)
+        samples.must_append(sample);
+
+    JsonArray time_deltas;
+    for (auto time_delta : m_time_deltas_in_microseconds)
+        time_deltas.must_append(time_delta);
+
+    JsonObject profile;
+    profile.set("nodes"sv, move(nodes));
+    profile.set("startTime"sv, m_start_time.nanoseconds() / 1000);
+    profile.set("endTime"sv, MonotonicTime::now().nanoseconds() / 1000);
+    profile.set("samples"sv, move(samples));
+    profile.set("timeDeltas"sv, move(time_deltas));
+    return profile;
+}
+
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/HashMap.h>
+#include <AK/JsonObject.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibJS/Forward.h>
+
+namespace JS {
+
+// Periodically records the JavaScript call stack of a VM, and reports where the time went in the .cpuprofile format
+// that both the Chrome and the Firefox profilers can load.
+//
+// A CPU time timer requests each sample, but the stack can only be walked safely from the bytecode interpreter, so the
+// sample is taken at the next function entry or backward jump.
+class SamplingProfiler {
+    AK_MAKE_NONCOPYABLE(SamplingProfiler);
+    AK_MAKE_NONMOVABLE(SamplingProfiler);
+
+public:
+    static constexpr AK::Duration default_sampling_interval = AK::Duration::from_milliseconds(1);
+
+    // Only one profiler can run in a process at a time.
+    static ErrorOr<NonnullOwnPtr<SamplingProfiler>> start(VM&, AK::Duration sampling_interval = default_sampling_interval);
+    ~SamplingProfiler();
+
+    // Stops sampling, and returns the recorded profile.
+    JsonObject stop();
+
+    [[nodiscard]] ALWAYS_INLINE static bool is_sample_requested() { return s_sample_requested.load(AK::memory_order_relaxed); }
+    static void take_requested_sample();
+
+private:
+    SamplingProfiler(VM&, AK::Duration sampling_interval);
+
+    static void request_sample(int);
+
+    struct Node {
+        String function_name;
+        String url;
+        i64 line_number { -1 };
+        i64 column_number { -1 };
+        u32 hit_count { 0 };
+
+        // Children by the identity of the code they run, i.e. their executable or native function.
+        HashMap<FlatPtr, u32> children;
+    };
+
+    void take_sample(MonotonicTime now);
+    u32 child_node_for(u32 parent_id, ExecutionContext const&);
+    void stop_sampling();
+
+    static Atomic<bool> s_sample_requested;
+    static Atomic<i64> s_sample_requested_at_ns;
+    static SamplingProfiler* s_running_profiler;
+
+    VM& m_vm;
+    AK::Duration m_sampling_interval;
+
+    MonotonicTime m_start_time;
+    MonotonicTime m_last_sample_time;
+
+    // Node IDs are their index in this list plus one, and the first node is the root of the call tree.
+    Vector<Node> m_nodes;
+    Vector<u32> m_samples;
+    Vector<i64> m_time_deltas_in_microseconds;
+};
+
+}
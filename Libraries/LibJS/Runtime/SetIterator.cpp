@@ -30,6 +30,13 @@ void SetIterator::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_set);
 }
 
+BuiltinIterator* SetIterator::as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const& iterator_record)
+{
+    if (iterator_record.next_method != shape().realm().intrinsics().set_iterator_prototype_next_function())
+        return nullptr;
+    return this;
+}
+
 ThrowCompletionOr<void> SetIterator::next(VM& vm, bool& done, Value& value)
 {
     if (m_done) {
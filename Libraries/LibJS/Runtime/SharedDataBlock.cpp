@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashMap.h>
+#include <AK/Random.h>
+#include <LibJS/Runtime/SharedDataBlock.h>
+#include <LibThreading/Mutex.h>
+
+namespace JS {
+
+// NOTE: Blocks may be created, found, and destroyed by agents running on different threads.
+static Threading::Mutex& shared_data_blocks_lock()
+{
+    static Threading::Mutex lock;
+    return lock;
+}
+
+static HashMap<SharedDataBlock::Token, SharedDataBlock*>& shared_data_blocks()
+{
+    static HashMap<SharedDataBlock::Token, SharedDataBlock*> blocks;
+    return blocks;
+}
+
+ErrorOr<NonnullRefPtr<SharedDataBlock>> SharedDataBlock::create(size_t size)
+{
+    auto buffer = TRY(ByteBuffer::create_zeroed(size));
+
+    Threading::MutexLocker locker { shared_data_blocks_lock() };
+    auto& blocks = shared_data_blocks();
+
+    Token token = 0;
+    do {
+        token = get_random<Token>();
+    } while (token == 0 || blocks.contains(token));
+
+    auto block = adopt_ref(*new SharedDataBlock(move(buffer), token));
+    blocks.set(token, block.ptr());
+
+    return block;
+}
+
+RefPtr<SharedDataBlock> SharedDataBlock::find(Token token)
+{
+    Threading::MutexLocker locker { shared_data_blocks_lock() };
+
+    auto block = shared_data_blocks().get(token);
+    if (!block.has_value())
+        return {};
+
+    // NOTE: The block may be in the middle of being destroyed by another thread, which is waiting on the lock to remove it.
+    if (!(*block)->try_ref())
+        return {};
+    return adopt_ref(**block);
+}
+
+SharedDataBlock::SharedDataBlock(ByteBuffer buffer, Token token)
+    : m_buffer(move(buffer))
+    , m_token(token)
+{
+}
+
+SharedDataBlock::~SharedDataBlock()
+{
+    Threading::MutexLocker locker { shared_data_blocks_lock() };
+    shared_data_blocks().remove(m_token);
+}
+
+}
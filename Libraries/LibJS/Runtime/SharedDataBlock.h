@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/ByteBuffer.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefPtr.h>
+
+namespace JS {
+
+// 6.2.9 Data Blocks, https://tc39.es/ecma262/#sec-data-blocks
+// A Shared Data Block may be referred to by the SharedArrayBuffers of several agents at once, so it is reference-counted.
+// When a SharedArrayBuffer is passed to another agent, the block is identified by an unguessable token, which the
+// receiving agent can use to find the same block again if it lives in the same process.
+class SharedDataBlock final : public AtomicRefCounted<SharedDataBlock> {
+public:
+    using Token = u64;
+
+    static ErrorOr<NonnullRefPtr<SharedDataBlock>> create(size_t size);
+    static RefPtr<SharedDataBlock> find(Token);
+
+    ~SharedDataBlock();
+
+    ByteBuffer& buffer() { return m_buffer; }
+    ByteBuffer const& buffer() const { return m_buffer; }
+
+    Token token() const { return m_token; }
+
+private:
+    SharedDataBlock(ByteBuffer, Token);
+
+    ByteBuffer m_buffer;
+    Token m_token { 0 };
+};
+
+}
@@ -24,6 +24,13 @@ StringIterator::StringIterator(String string, Object& prototype)
 {
 }
 
+BuiltinIterator* StringIterator::as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const& iterator_record)
+{
+    if (iterator_record.next_method != shape().realm().intrinsics().string_iterator_prototype_next_function())
+        return nullptr;
+    return this;
+}
+
 ThrowCompletionOr<void> StringIterator::next(VM& vm, bool& done, Value& value)
 {
     if (m_done) {
@@ -24,6 +24,7 @@ public:
     virtual ~StringIterator() override = default;
 
     BuiltinIterator* as_builtin_iterator() override { return this; }
+    BuiltinIterator* as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const&) override;
     ThrowCompletionOr<void> next(VM&, bool& done, Value& value) override;
 
 private:
@@ -73,17 +73,17 @@ static ThrowCompletionOr<Optional<PropertyDescriptor>> string_get_own_property(S
 
     // 6. Let str be S.[[StringData]].
     // 7. Assert: Type(str) is String.
-    auto str = string.primitive_string().utf16_string_view();
+    auto const& str = string.primitive_string();
 
     // 8. Let len be the length of str.
-    auto length = str.length_in_code_units();
+    auto length = str.length_in_utf16_code_units();
 
     // 9. If ℝ(index) < 0 or len ≤ ℝ(index), return undefined.
     if (length <= index.as_index())
         return Optional<PropertyDescriptor> {};
 
     // 10. Let resultStr be the substring of str from ℝ(index) to ℝ(index) + 1.
-    auto result_str = PrimitiveString::create(vm, Utf16String::create(str.substring_view(index.as_index(), 1)));
+    auto result_str = str.substring(vm, index.as_index(), 1);
 
     // 11. Return the PropertyDescriptor { [[Value]]: resultStr, [[Writable]]: false, [[Enumerable]]: true, [[Configurable]]: false }.
     return PropertyDescriptor {
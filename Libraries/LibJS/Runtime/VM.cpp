@@ -538,6 +538,34 @@ VM::StoredModule* VM::get_stored_module(ImportedModuleReferrer const&, ByteStrin
     return &(*end_or_module);
 }
 
+RefPtr<Program> VM::find_cached_script_program(StringView source_text, StringView filename, size_t line_number_offset)
+{
+    for (size_t i = 0; i < m_script_program_cache.size(); ++i) {
+        auto const& entry = m_script_program_cache[i];
+        auto const& source_code = entry.program->source_code();
+        if (entry.line_number_offset != line_number_offset)
+            continue;
+        if (source_code.filename().bytes_as_string_view() != filename || source_code.code().bytes_as_string_view() != source_text)
+            continue;
+
+        // Keep the most recently used program at the front.
+        auto cached_program = m_script_program_cache.take(i);
+        auto program = cached_program.program;
+        m_script_program_cache.prepend(move(cached_program));
+        return program;
+    }
+    return nullptr;
+}
+
+void VM::cache_script_program(NonnullRefPtr<Program> program, size_t line_number_offset)
+{
+    static constexpr size_t max_number_of_cached_script_programs = 16;
+
+    if (m_script_program_cache.size() >= max_number_of_cached_script_programs)
+        m_script_program_cache.take_last();
+    m_script_program_cache.prepend({ move(program), line_number_offset });
+}
+
 ThrowCompletionOr<void> VM::link_and_eval_module(Badge<Bytecode::Interpreter>, SourceTextModule& module)
 {
     return link_and_eval_module(module);
@@ -266,6 +266,9 @@ public:
 
     ScriptOrModule get_active_script_or_module() const;
 
+    RefPtr<Program> find_cached_script_program(StringView source_text, StringView filename, size_t line_number_offset);
+    void cache_script_program(NonnullRefPtr<Program>, size_t line_number_offset);
+
     // 16.2.1.10 HostLoadImportedModule ( referrer, moduleRequest, hostDefined, payload ), https://tc39.es/ecma262/#sec-HostLoadImportedModule
     Function<void(ImportedModuleReferrer, ModuleRequest const&, GC::Ptr<GraphLoadingState::HostDefined>, ImportedModulePayload)> host_load_imported_module;
 
@@ -343,6 +346,13 @@ private:
 
     Vector<StoredModule> m_loaded_modules;
 
+    // NOTE: Programs keep GC roots to the bytecode generated for their functions, so this must be destroyed before the heap.
+    struct CachedScriptProgram {
+        NonnullRefPtr<Program> program;
+        size_t line_number_offset { 0 };
+    };
+    Vector<CachedScriptProgram> m_script_program_cache;
+
     WellKnownSymbols m_well_known_symbols;
 
     u32 m_execution_generation { 0 };
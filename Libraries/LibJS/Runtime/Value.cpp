@@ -212,6 +212,11 @@ String number_to_string(double d, NumberToStringMode mode)
     return builder.to_string().release_value();
 }
 
+void number_to_string(StringBuilder& builder, double d, NumberToStringMode mode)
+{
+    number_to_string_impl(builder, d, mode);
+}
+
 ByteString number_to_byte_string(double d, NumberToStringMode mode)
 {
     StringBuilder builder;
@@ -536,6 +536,7 @@ enum class NumberToStringMode {
     WithoutExponent,
 };
 [[nodiscard]] String number_to_string(double, NumberToStringMode = NumberToStringMode::WithExponent);
+void number_to_string(StringBuilder&, double, NumberToStringMode = NumberToStringMode::WithExponent);
 [[nodiscard]] ByteString number_to_byte_string(double, NumberToStringMode = NumberToStringMode::WithExponent);
 double string_to_number(StringView);
 
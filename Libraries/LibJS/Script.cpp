@@ -17,6 +17,17 @@ GC_DEFINE_ALLOCATOR(Script);
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
+    // OPTIMIZATION: Navigations within the same process often evaluate the exact same large scripts again.
+    //               Re-using the parsed program also re-uses any bytecode already generated for its functions.
+    static constexpr size_t minimum_source_length_for_program_cache = 4 * KiB;
+    bool const should_cache_program = source_text.length() >= minimum_source_length_for_program_cache;
+
+    auto& vm = realm.vm();
+    if (should_cache_program) {
+        if (auto program = vm.find_cached_script_program(source_text, filename, line_number_offset))
+            return realm.heap().allocate<Script>(realm, filename, program.release_nonnull(), host_defined);
+    }
+
     // 1. Let script be ParseText(sourceText, Script).
     auto parser = Parser(Lexer(source_text, filename, line_number_offset));
     auto script = parser.parse_program();
@@ -25,6 +36,9 @@ Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_tex
     if (parser.has_errors())
         return parser.errors();
 
+    if (should_cache_program)
+        vm.cache_script_program(script, line_number_offset);
+
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
     return realm.heap().allocate<Script>(realm, filename, move(script), host_defined);
 }
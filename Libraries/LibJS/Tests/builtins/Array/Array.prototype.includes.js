@@ -17,6 +17,19 @@ test("basic functionality", () => {
     expect(array.includes("friends", 100)).toBeFalse();
 });
 
+test("holes are looked up on the prototype chain", () => {
+    var array = [1, , 3];
+    expect(array.includes(undefined)).toBeTrue();
+
+    Array.prototype[1] = "from prototype";
+    try {
+        expect(array.includes("from prototype")).toBeTrue();
+        expect(array.includes(undefined)).toBeFalse();
+    } finally {
+        delete Array.prototype[1];
+    }
+});
+
 test("is unscopable", () => {
     expect(Array.prototype[Symbol.unscopables].includes).toBeTrue();
     const array = [];
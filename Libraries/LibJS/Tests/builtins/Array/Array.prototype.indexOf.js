@@ -23,3 +23,29 @@ test("basic functionality", () => {
     expect([].indexOf()).toBe(-1);
     expect([undefined].indexOf()).toBe(0);
 });
+
+test("holes are looked up on the prototype chain", () => {
+    var array = [1, , 3];
+    expect(array.indexOf(undefined)).toBe(-1);
+
+    Array.prototype[1] = "from prototype";
+    try {
+        expect(array.indexOf("from prototype")).toBe(1);
+        expect(array.indexOf(3)).toBe(2);
+    } finally {
+        delete Array.prototype[1];
+    }
+});
+
+test("getters are invoked", () => {
+    var array = [1, 2, 3];
+    var getterCalls = 0;
+    Object.defineProperty(array, 1, {
+        get() {
+            ++getterCalls;
+            return "from getter";
+        },
+    });
+    expect(array.indexOf("from getter")).toBe(1);
+    expect(getterCalls).toBe(1);
+});
@@ -73,4 +73,23 @@ test("basic functionality", () => {
     test("invariants", () => {
         expect(Atomics.wait).toHaveLength(4);
     });
+
+    test("value not equal", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+        typedArray[1] = 42;
+
+        expect(Atomics.wait(typedArray, 1, 0, 0)).toBe("not-equal");
+        expect(Atomics.wait(new BigInt64Array(new SharedArrayBuffer(8)), 0, 1n, 0)).toBe("not-equal");
+    });
+
+    test("timed out", () => {
+        const buffer = new SharedArrayBuffer(4 * Int32Array.BYTES_PER_ELEMENT);
+        const typedArray = new Int32Array(buffer);
+        typedArray[1] = 42;
+
+        expect(Atomics.wait(typedArray, 1, 42, 0)).toBe("timed-out");
+        expect(Atomics.wait(typedArray, 1, 42, 10)).toBe("timed-out");
+        expect(Atomics.wait(new BigInt64Array(new SharedArrayBuffer(8)), 0, 0n, 0)).toBe("timed-out");
+    });
 });
@@ -74,3 +74,57 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("objects with the same keys", () => {
+    const objects = JSON.parse('[{"a":1,"b":"x"},{"a":2,"b":"y"},{"b":"z","a":3}]');
+    expect(objects).toEqual([
+        { a: 1, b: "x" },
+        { a: 2, b: "y" },
+        { b: "z", a: 3 },
+    ]);
+    expect(Object.keys(objects[1])).toEqual(["a", "b"]);
+    expect(Object.keys(objects[2])).toEqual(["b", "a"]);
+
+    objects[0].c = true;
+    expect(objects[1].c).toBeUndefined();
+});
+
+test("duplicate and integer keys", () => {
+    const object = JSON.parse('{"a":1,"2":"two","b":2,"a":3,"1":"one"}');
+    expect(object.a).toBe(3);
+    expect(object[2]).toBe("two");
+    expect(Object.keys(object)).toEqual(["1", "2", "a", "b"]);
+});
+
+test("objects with many keys", () => {
+    const source = {};
+    for (let i = 0; i < 100; ++i) source[`key${i}`] = i;
+    const object = JSON.parse(JSON.stringify(source));
+    expect(Object.keys(object)).toHaveLength(100);
+    expect(object.key0).toBe(0);
+    expect(object.key99).toBe(99);
+});
+
+test("escapes in keys and strings", () => {
+    const object = JSON.parse('{"a\\nb":"\\"q\\" \\\\ \\u00e9 \\ud83e\\udd13","a\\u0062":1}');
+    expect(object["a\nb"]).toBe('"q" \\ é 🤓');
+    expect(object.ab).toBe(1);
+    expect(JSON.parse('"\\ud83e"')).toBe("\ud83e");
+});
+
+test("strings spanning many blocks", () => {
+    const long = "a\\\"".repeat(100) + "x".repeat(1000);
+    expect(JSON.parse(`["${long}", 1]`)).toEqual([long.replaceAll('\\"', '"'), 1]);
+});
+
+test("numbers", () => {
+    expect(JSON.parse("0.1")).toBe(0.1);
+    expect(JSON.parse("-1.5e-3")).toBe(-1.5e-3);
+    expect(JSON.parse("1e308")).toBe(1e308);
+    expect(JSON.parse("2.2250738585072014e-308")).toBe(2.2250738585072014e-308);
+    expect(JSON.parse("123456789012345678e-30")).toBe(123456789012345678e-30);
+    expect(JSON.parse("1e400")).toBe(Infinity);
+    ["01", "1.", ".1", "1e", "+1", "1x", "truex", "[1 2]", '"\t"'].forEach(test => {
+        expect(() => JSON.parse(test)).toThrow(SyntaxError);
+    });
+});
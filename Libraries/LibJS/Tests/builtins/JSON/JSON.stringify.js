@@ -97,3 +97,60 @@ describe("errors", () => {
         });
     });
 });
+
+describe("plain objects and arrays", () => {
+    test("objects with the same shape", () => {
+        const objects = [];
+        for (let i = 0; i < 3; ++i) objects.push({ id: i, "needs\nescape": "a\u0001", hidden: undefined });
+        Object.defineProperty(objects[1], "invisible", { value: 1, enumerable: false });
+        expect(JSON.stringify(objects)).toBe(
+            '[{"id":0,"needs\\nescape":"a\\u0001"},{"id":1,"needs\\nescape":"a\\u0001"},{"id":2,"needs\\nescape":"a\\u0001"}]'
+        );
+        expect(JSON.stringify(objects[0], null, 2)).toBe('{\n  "id": 0,\n  "needs\\nescape": "a\\u0001"\n}');
+    });
+
+    test("arrays with holes and skipped values", () => {
+        expect(JSON.stringify([1, , undefined, Symbol(), -0, NaN, "x"])).toBe('[1,null,null,null,0,null,"x"]');
+        expect(JSON.stringify([[], {}, [[1]]], null, "--")).toBe("[\n--[],\n--{},\n--[\n----[\n------1\n----]\n--]\n]");
+    });
+
+    test("long strings", () => {
+        const string = "x".repeat(100) + '"' + "y".repeat(100) + "\ud800" + "z".repeat(20);
+        expect(JSON.stringify(string)).toBe('"' + "x".repeat(100) + '\\"' + "y".repeat(100) + "\\ud800" + "z".repeat(20) + '"');
+    });
+
+    test("getters, toJSON methods and wrapper objects", () => {
+        let calls = 0;
+        const object = {
+            a: 1,
+            get b() {
+                ++calls;
+                return 2;
+            },
+        };
+        expect(JSON.stringify([object, object])).toBe('[{"a":1,"b":2},{"a":1,"b":2}]');
+        expect(calls).toBe(2);
+
+        expect(JSON.stringify({ a: { toJSON: () => "x" } })).toBe('{"a":"x"}');
+        expect(JSON.stringify({ a: new Number(3), b: new String("s"), c: Object(false) })).toBe('{"a":3,"b":"s","c":false}');
+        expect(JSON.stringify({ a: new Proxy({ b: 1 }, {}) })).toBe('{"a":{"b":1}}');
+    });
+
+    test("modified prototypes", () => {
+        Object.prototype.toJSON = function () {
+            return "object";
+        };
+        try {
+            expect(JSON.stringify({ a: 1 })).toBe('"object"');
+        } finally {
+            delete Object.prototype.toJSON;
+        }
+
+        Array.prototype[1] = "inherited";
+        try {
+            expect(JSON.stringify([1, , 3])).toBe('[1,"inherited",3]');
+        } finally {
+            delete Array.prototype[1];
+        }
+    });
+});
@@ -27,3 +27,22 @@ test("UTF-16", () => {
     expect(s.charCodeAt(1)).toBe(0xde00);
     expect(s.charCodeAt(2)).toBe(NaN);
 });
+
+test("strings concatenated from ASCII and non-ASCII pieces", () => {
+    var ascii = "abc";
+    for (var i = 0; i < 3; ++i) ascii += String.fromCharCode(100 + i);
+    expect(ascii).toHaveLength(6);
+    expect(ascii.charCodeAt(5)).toBe(102);
+    expect(ascii[3]).toBe("d");
+    expect(ascii.substring(2, 4)).toBe("cd");
+    expect(ascii.slice(-2)).toBe("ef");
+    expect(ascii.codePointAt(4)).toBe(101);
+
+    var mixed = ascii + "é😀";
+    expect(mixed).toHaveLength(9);
+    expect(mixed.charCodeAt(6)).toBe(0xe9);
+    expect(mixed.charCodeAt(7)).toBe(0xd83d);
+    expect(mixed[8]).toBe("\ude00");
+    expect(mixed.substring(5, 8)).toBe("fé\ud83d");
+    expect(mixed.codePointAt(7)).toBe(0x1f600);
+});
@@ -37,3 +37,16 @@ test("UTF-16", () => {
     expect(s.localeCompare("\ud83d") > 0);
     expect(s.localeCompare("😀😀s") < 0);
 });
+
+test("options are not shared between calls", () => {
+    expect("a".localeCompare("A", "en", { sensitivity: "base" })).toBe(0);
+    expect("a".localeCompare("A", "en")).toBe(-1);
+    expect("a".localeCompare("A", "en", { caseFirst: "upper" })).toBe(1);
+    expect("a".localeCompare("A", "en", { sensitivity: "base" })).toBe(0);
+
+    expect("2".localeCompare("10", "en", { numeric: true })).toBe(-1);
+    expect("2".localeCompare("10", "en")).toBe(1);
+
+    expect("ä".localeCompare("z", "de")).toBe(-1);
+    expect("ä".localeCompare("z", "sv")).toBe(1);
+});
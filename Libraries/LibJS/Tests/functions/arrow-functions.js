@@ -142,6 +142,30 @@ test("no prototype", () => {
     expect(foo).not.toHaveProperty("prototype");
 });
 
+test("length and name properties", () => {
+    const make = () => (a, b) => {};
+    const first = make();
+    const second = make();
+
+    expect(Object.getOwnPropertyNames(first)).toEqual(["length", "name"]);
+    expect(Object.getOwnPropertyDescriptor(first, "length")).toEqual({
+        value: 2,
+        writable: false,
+        enumerable: false,
+        configurable: true,
+    });
+    expect(Object.getOwnPropertyDescriptor(first, "name")).toEqual({
+        value: "",
+        writable: false,
+        enumerable: false,
+        configurable: true,
+    });
+
+    delete first.name;
+    expect(Object.hasOwn(first, "name")).toBeFalse();
+    expect(second.name).toBe("");
+});
+
 test("cannot be constructed", () => {
     let foo = () => {};
     expect(() => {
@@ -16,3 +16,27 @@ test("Inline cache invalidated by deleting property from unique shape", () => {
     expect(first).toBe(2);
     expect(second).toBeUndefined();
 });
+
+test("Repeatedly deleting properties from a dictionary shape", () => {
+    let o = {};
+    for (let x = 0; x < 1000; ++x) {
+        o["prop" + x] = x;
+    }
+
+    function ic(o) {
+        return o.prop500;
+    }
+
+    for (let x = 0; x < 500; ++x) {
+        delete o["prop" + x];
+        expect(ic(o)).toBe(500);
+    }
+
+    expect(Object.keys(o).length).toBe(500);
+    expect(o.prop0).toBeUndefined();
+    expect(o.prop999).toBe(999);
+
+    o.prop0 = "back";
+    expect(o.prop0).toBe("back");
+    expect(ic(o)).toBe(500);
+});
@@ -81,6 +81,35 @@ describe("correct behavior", () => {
             expect(a).toEqual([1, 2, 3]);
         }
     });
+
+    test("redefined next method of built-in iterators", () => {
+        const iteratorPrototypes = [
+            Object.getPrototypeOf([][Symbol.iterator]()),
+            Object.getPrototypeOf(new Map()[Symbol.iterator]()),
+            Object.getPrototypeOf(new Set()[Symbol.iterator]()),
+            Object.getPrototypeOf(""[Symbol.iterator]()),
+        ];
+        const iterables = [[1, 2], new Map([[1, 2]]), new Set([1, 2]), "12"];
+
+        iteratorPrototypes.forEach((prototype, index) => {
+            const originalNext = prototype.next;
+            let calls = 0;
+            prototype.next = function () {
+                ++calls;
+                return originalNext.call(this);
+            };
+
+            try {
+                const a = [];
+                for (const value of iterables[index]) a.push(value);
+                const spread = [...iterables[index]];
+                expect(spread).toEqual(a);
+                expect(calls).toBe(2 * (a.length + 1));
+            } finally {
+                prototype.next = originalNext;
+            }
+        });
+    });
 });
 
 describe("errors", () => {
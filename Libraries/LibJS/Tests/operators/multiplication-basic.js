@@ -0,0 +1,22 @@
+test("basic functionality", () => {
+    expect(6 * 7).toBe(42);
+    expect(-6 * 7).toBe(-42);
+    expect(1.5 * 2).toBe(3);
+    expect(NaN * 2).toBeNaN();
+    expect(Infinity * 0).toBeNaN();
+});
+
+test("integer overflow produces a double", () => {
+    const large = 2 ** 30;
+    expect(large * 4).toBe(4294967296);
+    expect(-large * 4).toBe(-4294967296);
+});
+
+test("zero product with a negative operand is negative zero", () => {
+    let zero = 0;
+    let minusOne = -1;
+    expect(zero * minusOne).toBe(-0);
+    expect(minusOne * zero).toBe(-0);
+    expect(zero * zero).toBe(0);
+    expect(minusOne * minusOne).toBe(1);
+});
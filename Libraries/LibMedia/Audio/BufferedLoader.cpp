@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include "BufferedLoader.h"
+
+namespace Audio {
+
+// The number of samples decoded at a time. The ring always has room for at least two of these.
+static constexpr size_t decode_chunk_size = 4 * KiB;
+
+// How long the decoding thread sleeps while the ring is full. The reading side never wakes it up, since signalling a
+// condition variable from a real-time thread could block that thread.
+static constexpr AK::Duration refill_interval = AK::Duration::from_milliseconds(10);
+
+ErrorOr<NonnullRefPtr<BufferedLoader>> BufferedLoader::create(NonnullRefPtr<Loader> loader, AK::Duration buffer_duration)
+{
+    auto capacity = max(decode_chunk_size * 2, static_cast<size_t>(buffer_duration.to_milliseconds() * loader->sample_rate() / 1000));
+    auto ring = TRY(SampleRingBuffer::create(capacity));
+    auto buffered_loader = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) BufferedLoader(move(loader), move(ring))));
+
+    buffered_loader->m_decode_thread = TRY(Threading::Thread::try_create([&self = *buffered_loader] {
+        self.decode_until_stopped();
+        return 0;
+    },
+        "Audio Decoder"sv));
+    buffered_loader->m_decode_thread->start();
+
+    return buffered_loader;
+}
+
+BufferedLoader::BufferedLoader(NonnullRefPtr<Loader> loader, NonnullOwnPtr<SampleRingBuffer> ring)
+    : m_loader(move(loader))
+    , m_sample_rate(m_loader->sample_rate())
+    , m_total_samples(m_loader->total_samples())
+    , m_ring(move(ring))
+    , m_position(m_loader->loaded_samples())
+{
+}
+
+BufferedLoader::~BufferedLoader()
+{
+    {
+        Threading::MutexLocker locker(m_mutex);
+        m_stop_decoding = true;
+        m_condition.broadcast();
+    }
+
+    if (m_decode_thread->needs_to_be_joined())
+        (void)m_decode_thread->join();
+}
+
+ErrorOr<size_t> BufferedLoader::read_samples(Span<Sample> buffer)
+{
+    // NOTE: The failure has to be observed before reading, so that samples decoded right before it aren't dropped.
+    auto decoder_failed = m_decoder_failed.load(AK::memory_order_acquire);
+
+    auto count = m_ring->read(buffer);
+    m_position.fetch_add(static_cast<int>(count), AK::memory_order_relaxed);
+
+    if (count == 0 && decoder_failed)
+        return Error::copy(*m_decoder_error);
+    return count;
+}
+
+ErrorOr<void> BufferedLoader::seek(int sample_index)
+{
+    Threading::MutexLocker locker(m_mutex);
+    m_seek_target = sample_index;
+    m_seek_result.clear();
+    m_condition.broadcast();
+
+    while (!m_seek_result.has_value())
+        m_condition.wait();
+    return m_seek_result.release_value();
+}
+
+bool BufferedLoader::is_at_end_of_stream() const
+{
+    return m_decoder_at_end_of_stream.load(AK::memory_order_acquire) && m_ring->available_to_read() == 0;
+}
+
+void BufferedLoader::decode_until_stopped()
+{
+    while (true) {
+        {
+            Threading::MutexLocker locker(m_mutex);
+            while (true) {
+                if (m_stop_decoding)
+                    return;
+
+                if (m_seek_target.has_value()) {
+                    auto target = m_seek_target.release_value();
+                    m_seek_result = m_loader->seek(target);
+                    m_ring->clear();
+                    m_position.store(target, AK::memory_order_relaxed);
+                    m_decoder_error.clear();
+                    m_decoder_failed.store(false, AK::memory_order_release);
+                    m_decoder_at_end_of_stream.store(false, AK::memory_order_release);
+                    m_condition.broadcast();
+                    continue;
+                }
+
+                // There is nothing more to decode until we are told to seek.
+                if (m_decoder_failed.load(AK::memory_order_relaxed) || m_decoder_at_end_of_stream.load(AK::memory_order_relaxed)) {
+                    m_condition.wait();
+                    continue;
+                }
+
+                if (m_ring->available_to_write() >= decode_chunk_size)
+                    break;
+                m_condition.wait_for(refill_interval);
+            }
+        }
+
+        auto samples_or_error = m_loader->get_more_samples(decode_chunk_size);
+        if (samples_or_error.is_error()) {
+            m_decoder_error = samples_or_error.release_error();
+            m_decoder_failed.store(true, AK::memory_order_release);
+            continue;
+        }
+
+        auto samples = samples_or_error.release_value();
+        if (samples.is_empty()) {
+            m_decoder_at_end_of_stream.store(true, AK::memory_order_release);
+            continue;
+        }
+
+        auto written = m_ring->write(samples.span());
+        VERIFY(written == samples.size());
+    }
+}
+
+}
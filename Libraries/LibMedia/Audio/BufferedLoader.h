@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include "Loader.h"
+#include "SampleRingBuffer.h"
+#include <AK/AtomicRefCounted.h>
+#include <AK/Optional.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
+
+namespace Audio {
+
+// Decodes samples from a Loader ahead of playback on a thread of its own, so that reading them never has to wait for
+// the decoder. Samples are read on a single consumer thread, usually the real-time callback of a PlaybackStream.
+class BufferedLoader final : public AtomicRefCounted<BufferedLoader> {
+public:
+    static ErrorOr<NonnullRefPtr<BufferedLoader>> create(NonnullRefPtr<Loader>, AK::Duration buffer_duration);
+    ~BufferedLoader();
+
+    // Copies as many decoded samples as are available into the buffer, and returns how many were copied. This never
+    // blocks or allocates. Once the decoder has failed and all samples decoded before the failure have been read, the
+    // error is returned instead.
+    ErrorOr<size_t> read_samples(Span<Sample>);
+
+    // Moves decoding to the given sample and drops the samples that were decoded ahead. This blocks until the decoding
+    // thread has seeked, and must not be called while another thread is inside read_samples().
+    ErrorOr<void> seek(int sample_index);
+
+    // The index of the next sample that read_samples() will return.
+    int position() const { return m_position.load(AK::memory_order_relaxed); }
+
+    // True once every sample of the stream has been decoded and read.
+    bool is_at_end_of_stream() const;
+
+    u32 sample_rate() const { return m_sample_rate; }
+    int total_samples() const { return m_total_samples; }
+
+private:
+    BufferedLoader(NonnullRefPtr<Loader>, NonnullOwnPtr<SampleRingBuffer>);
+
+    void decode_until_stopped();
+
+    NonnullRefPtr<Loader> m_loader;
+    u32 m_sample_rate { 0 };
+    int m_total_samples { 0 };
+
+    NonnullOwnPtr<SampleRingBuffer> m_ring;
+    Atomic<int> m_position { 0 };
+
+    RefPtr<Threading::Thread> m_decode_thread;
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_condition { m_mutex };
+
+    // These are protected by m_mutex.
+    bool m_stop_decoding { false };
+    Optional<int> m_seek_target;
+    Optional<ErrorOr<void>> m_seek_result;
+
+    // These are only written by the decoding thread, and m_decoder_error is only read once m_decoder_failed is set.
+    Atomic<bool> m_decoder_at_end_of_stream { false };
+    Atomic<bool> m_decoder_failed { false };
+    Optional<Error> m_decoder_error;
+};
+
+}
@@ -5,7 +5,6 @@
  */
 
 #include "FFmpegLoader.h"
-#include <AK/NumericLimits.h>
 #include <LibCore/System.h>
 
 #if LIBAVCODEC_VERSION_INT >= AV_VERSION_INT(59, 24, 100)
@@ -135,7 +134,7 @@ bool FFmpegLoaderPlugin::sniff(SeekableStream& stream)
     return score > 0;
 }
 
-static ErrorOr<FixedArray<Sample>> extract_samples_from_frame(AVFrame& frame)
+static ErrorOr<FixedArray<Sample>> extract_samples_from_frame(AVFrame& frame, Vector<float>& conversion_buffer)
 {
     size_t number_of_samples = frame.nb_samples;
     VERIFY(number_of_samples > 0);
@@ -153,8 +152,8 @@ static ErrorOr<FixedArray<Sample>> extract_samples_from_frame(AVFrame& frame)
     if (number_of_channels != 1 && number_of_channels != 2)
         return Error::from_string_view("Unsupported number of channels"sv);
 
-    switch (format) {
-    case AV_SAMPLE_FMT_FLTP:
+    switch (packed_format) {
+    case AV_SAMPLE_FMT_FLT:
     case AV_SAMPLE_FMT_S16:
     case AV_SAMPLE_FMT_S32:
         break;
@@ -163,38 +162,41 @@ static ErrorOr<FixedArray<Sample>> extract_samples_from_frame(AVFrame& frame)
         return Error::from_string_view("Unsupported sample format"sv);
     }
 
-    auto get_plane_pointer = [&](size_t channel_index) -> uint8_t* {
-        return is_planar ? frame.extended_data[channel_index] : frame.extended_data[0];
-    };
-    auto index_in_plane = [&](size_t sample_index, size_t channel_index) {
-        if (is_planar)
-            return sample_index;
-        return sample_index * number_of_channels + channel_index;
-    };
-    auto read_sample = [&](uint8_t* data, size_t index) -> float {
+    auto samples = TRY(FixedArray<Sample>::create(number_of_samples));
+    auto values_per_plane = is_planar ? number_of_samples : number_of_samples * number_of_channels;
+
+    // Converts a plane to floats, using the given part of the destination if the samples aren't floats already.
+    auto plane_as_floats = [&](size_t plane_index, Span<float> destination) -> ReadonlySpan<float> {
+        auto const* plane = frame.extended_data[plane_index];
         switch (packed_format) {
         case AV_SAMPLE_FMT_FLT:
-            return reinterpret_cast<float*>(data)[index];
+            return { reinterpret_cast<float const*>(plane), values_per_plane };
         case AV_SAMPLE_FMT_S16:
-            return reinterpret_cast<i16*>(data)[index] / static_cast<float>(NumericLimits<i16>::max());
+            convert_to_float({ reinterpret_cast<i16 const*>(plane), values_per_plane }, destination);
+            return destination.trim(values_per_plane);
         case AV_SAMPLE_FMT_S32:
-            return reinterpret_cast<i32*>(data)[index] / static_cast<float>(NumericLimits<i32>::max());
+            convert_to_float({ reinterpret_cast<i32 const*>(plane), values_per_plane }, destination);
+            return destination.trim(values_per_plane);
         default:
             VERIFY_NOT_REACHED();
         }
     };
 
-    auto samples = TRY(FixedArray<Sample>::create(number_of_samples));
-    for (size_t sample = 0; sample < number_of_samples; ++sample) {
-        if (number_of_channels == 1) {
-            samples.unchecked_at(sample) = Sample { read_sample(get_plane_pointer(0), index_in_plane(sample, 0)) };
-        } else {
-            samples.unchecked_at(sample) = Sample {
-                read_sample(get_plane_pointer(0), index_in_plane(sample, 0)),
-                read_sample(get_plane_pointer(1), index_in_plane(sample, 1)),
-            };
-        }
+    // Interleaved stereo already has the memory layout of our samples, so it can be converted in place.
+    if (!is_planar && number_of_channels == 2) {
+        Span<float> sample_values { reinterpret_cast<float*>(samples.data()), values_per_plane };
+        auto values = plane_as_floats(0, sample_values);
+        if (values.data() != sample_values.data())
+            values.copy_to(sample_values);
+        return samples;
     }
+
+    TRY(conversion_buffer.try_resize(values_per_plane * number_of_channels));
+    auto left = plane_as_floats(0, conversion_buffer.span().trim(values_per_plane));
+    auto right = left;
+    if (number_of_channels == 2)
+        right = plane_as_floats(1, conversion_buffer.span().slice(values_per_plane));
+    interleave_to_samples(left, right, samples.span());
     return samples;
 }
 
@@ -230,7 +232,7 @@ ErrorOr<Vector<FixedArray<Sample>>> FFmpegLoaderPlugin::load_chunks(size_t sampl
             return Error::from_string_literal("Failed to receive frame");
         }
 
-        chunks.append(TRY(extract_samples_from_frame(*m_frame)));
+        chunks.append(TRY(extract_samples_from_frame(*m_frame, m_conversion_buffer)));
 
         // Use the frame's presentation timestamp to set the number of loaded samples
         m_loaded_samples = static_cast<int>(m_frame->pts * sample_rate() * time_base());
@@ -50,6 +50,8 @@ private:
     int m_loaded_samples { 0 };
     AVPacket* m_packet { nullptr };
     int m_total_samples { 0 };
+    // Holds decoded samples that need to be converted before they can be interleaved, reused between frames.
+    Vector<float> m_conversion_buffer;
 };
 
 }
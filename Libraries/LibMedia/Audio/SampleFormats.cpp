@@ -5,10 +5,23 @@
  */
 
 #include "SampleFormats.h"
+#include "Sample.h"
 #include <AK/Assertions.h>
+#include <AK/NumericLimits.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+
+// See the comment in SIMDMath.h on why this is safe to ignore.
+#pragma GCC diagnostic ignored "-Wpsabi"
 
 namespace Audio {
 
+using AK::SIMD::f32x4;
+using AK::SIMD::load_unaligned;
+using AK::SIMD::store_unaligned;
+
+static constexpr size_t LANES = 4;
+
 u16 pcm_bits_per_sample(PcmSampleFormat format)
 {
     switch (format) {
@@ -28,4 +41,48 @@ u16 pcm_bits_per_sample(PcmSampleFormat format)
     }
 }
 
+template<typename T, typename VectorType>
+static void convert_signed_to_float(ReadonlySpan<T> source, Span<float> destination)
+{
+    VERIFY(destination.size() >= source.size());
+
+    constexpr float scale = 1.0f / static_cast<float>(NumericLimits<T>::max());
+    auto scales = AK::SIMD::expand4(scale);
+    size_t i = 0;
+    for (; i + LANES <= source.size(); i += LANES) {
+        auto values = __builtin_convertvector(load_unaligned<VectorType>(&source[i]), f32x4);
+        store_unaligned(&destination[i], values * scales);
+    }
+    for (; i < source.size(); ++i)
+        destination[i] = static_cast<float>(source[i]) * scale;
+}
+
+void convert_to_float(ReadonlySpan<i16> source, Span<float> destination)
+{
+    convert_signed_to_float<i16, AK::SIMD::i16x4>(source, destination);
+}
+
+void convert_to_float(ReadonlySpan<i32> source, Span<float> destination)
+{
+    convert_signed_to_float<i32, AK::SIMD::i32x4>(source, destination);
+}
+
+void interleave_to_samples(ReadonlySpan<float> left, ReadonlySpan<float> right, Span<Sample> destination)
+{
+    VERIFY(left.size() >= destination.size());
+    VERIFY(right.size() >= destination.size());
+    static_assert(sizeof(Sample) == 2 * sizeof(float));
+
+    auto* output = reinterpret_cast<float*>(destination.data());
+    size_t i = 0;
+    for (; i + LANES <= destination.size(); i += LANES) {
+        auto left_values = load_unaligned<f32x4>(&left[i]);
+        auto right_values = load_unaligned<f32x4>(&right[i]);
+        store_unaligned(&output[i * 2], __builtin_shufflevector(left_values, right_values, 0, 4, 1, 5));
+        store_unaligned(&output[i * 2 + LANES], __builtin_shufflevector(left_values, right_values, 2, 6, 3, 7));
+    }
+    for (; i < destination.size(); ++i)
+        destination[i] = Sample { left[i], right[i] };
+}
+
 }
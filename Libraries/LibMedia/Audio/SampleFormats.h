@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include "Forward.h"
+#include <AK/Span.h>
 #include <AK/Types.h>
 
 namespace Audio {
@@ -23,4 +25,12 @@ enum class PcmSampleFormat : u8 {
 // Most of the read code only cares about how many bits to read or write
 u16 pcm_bits_per_sample(PcmSampleFormat format);
 
+// Converts signed integer PCM to floats in the range [-1, 1]. The destination must be at least as large as the source.
+void convert_to_float(ReadonlySpan<i16> source, Span<float> destination);
+void convert_to_float(ReadonlySpan<i32> source, Span<float> destination);
+
+// Interleaves two planar channels into stereo samples. Passing the same channel twice spreads mono audio over both
+// sides. Both channels must have at least as many values as there are samples.
+void interleave_to_samples(ReadonlySpan<float> left, ReadonlySpan<float> right, Span<Sample> destination);
+
 }
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include "Sample.h"
+#include <AK/Atomic.h>
+#include <AK/FixedArray.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Noncopyable.h>
+#include <AK/TypedTransfer.h>
+
+namespace Audio {
+
+// A fixed-size, lock-free ring of samples that is written by exactly one producer thread and read by exactly one
+// consumer thread. Neither side ever blocks or allocates, so the consumer may be a real-time audio callback.
+class SampleRingBuffer {
+    AK_MAKE_NONCOPYABLE(SampleRingBuffer);
+    AK_MAKE_NONMOVABLE(SampleRingBuffer);
+
+public:
+    static ErrorOr<NonnullOwnPtr<SampleRingBuffer>> create(size_t capacity)
+    {
+        VERIFY(capacity > 0);
+        auto samples = TRY(FixedArray<Sample>::create(capacity));
+        return adopt_nonnull_own_or_enomem(new (nothrow) SampleRingBuffer(move(samples)));
+    }
+
+    size_t capacity() const { return m_samples.size(); }
+
+    // May only be called from the consumer thread.
+    size_t available_to_read() const
+    {
+        return m_tail.load(AK::memory_order_acquire) - m_head.load(AK::memory_order_relaxed);
+    }
+
+    // May only be called from the producer thread.
+    size_t available_to_write() const
+    {
+        return capacity() - (m_tail.load(AK::memory_order_relaxed) - m_head.load(AK::memory_order_acquire));
+    }
+
+    // May only be called from the producer thread. Returns the number of samples that fit into the ring.
+    size_t write(ReadonlySpan<Sample> samples)
+    {
+        auto tail = m_tail.load(AK::memory_order_relaxed);
+        auto count = min(samples.size(), capacity() - (tail - m_head.load(AK::memory_order_acquire)));
+
+        auto start = tail % capacity();
+        auto first_part = min(count, capacity() - start);
+        AK::TypedTransfer<Sample>::copy(&m_samples[start], samples.data(), first_part);
+        AK::TypedTransfer<Sample>::copy(m_samples.data(), samples.data() + first_part, count - first_part);
+
+        m_tail.store(tail + count, AK::memory_order_release);
+        return count;
+    }
+
+    // May only be called from the consumer thread. Returns the number of samples that were read.
+    size_t read(Span<Sample> samples)
+    {
+        auto head = m_head.load(AK::memory_order_relaxed);
+        auto count = min(samples.size(), m_tail.load(AK::memory_order_acquire) - head);
+
+        auto start = head % capacity();
+        auto first_part = min(count, capacity() - start);
+        AK::TypedTransfer<Sample>::copy(samples.data(), &m_samples[start], first_part);
+        AK::TypedTransfer<Sample>::copy(samples.data() + first_part, m_samples.data(), count - first_part);
+
+        m_head.store(head + count, AK::memory_order_release);
+        return count;
+    }
+
+    // Drops all samples that have not been read yet. Neither the producer nor the consumer may be using the ring while
+    // this runs.
+    void clear()
+    {
+        m_head.store(m_tail.load(AK::memory_order_relaxed), AK::memory_order_release);
+    }
+
+private:
+    explicit SampleRingBuffer(FixedArray<Sample> samples)
+        : m_samples(move(samples))
+    {
+    }
+
+    FixedArray<Sample> m_samples;
+
+    // NOTE: These only ever increase, and are reduced modulo the capacity when indexing. The head and tail live on
+    //       separate cache lines so that the producer and consumer don't keep stealing each other's cache line.
+    alignas(64) Atomic<size_t> m_head { 0 };
+    alignas(64) Atomic<size_t> m_tail { 0 };
+};
+
+}
@@ -934,6 +934,170 @@ DecoderErrorOr<Optional<Vector<CuePoint> const&>> Reader::cue_points_for_track(u
     return m_cues.get(track_number);
 }
 
+struct VariableSizeInteger {
+    u64 value { 0 };
+    size_t length { 0 };
+    bool is_unknown { false };
+};
+
+// Returns an empty Optional if the integer has not been received completely yet.
+static DecoderErrorOr<Optional<VariableSizeInteger>> peek_variable_size_integer(ReadonlyBytes data, bool mask_length)
+{
+    if (data.is_empty())
+        return OptionalNone {};
+
+    auto length_descriptor = data[0];
+    if (length_descriptor == 0)
+        return DecoderError::corrupted("Length descriptor has no terminating set bit"sv);
+
+    size_t length = count_leading_zeroes(length_descriptor) + 1;
+    if (data.size() < length)
+        return OptionalNone {};
+
+    u8 value_mask = 0xFF >> length;
+    VariableSizeInteger result;
+    result.value = mask_length ? length_descriptor & value_mask : length_descriptor;
+    result.length = length;
+    // An element size with all value bits set means that the size is unknown.
+    result.is_unknown = (length_descriptor & value_mask) == value_mask;
+    for (size_t i = 1; i < length; i++) {
+        result.value = (result.value << 8u) | data[i];
+        result.is_unknown = result.is_unknown && data[i] == 0xFF;
+    }
+    return result;
+}
+
+DecoderErrorOr<void> IncrementalReader::append(ReadonlyBytes data)
+{
+    if (m_pending_data.is_empty()) {
+        auto consumed = TRY(parse(data));
+        DECODER_TRY_ALLOC(m_pending_data.try_append(data.slice(consumed)));
+        return {};
+    }
+
+    DECODER_TRY_ALLOC(m_pending_data.try_append(data));
+    auto consumed = TRY(parse(m_pending_data));
+    auto remaining = m_pending_data.size() - consumed;
+    if (consumed > 0 && remaining > 0)
+        memmove(m_pending_data.data(), m_pending_data.data() + consumed, remaining);
+    m_pending_data.trim(remaining, false);
+    return {};
+}
+
+void IncrementalReader::reset()
+{
+    m_pending_data.clear();
+    m_bytes_to_skip = 0;
+}
+
+DecoderErrorOr<size_t> IncrementalReader::parse(ReadonlyBytes data)
+{
+    size_t position = 0;
+
+    while (position < data.size()) {
+        if (m_bytes_to_skip > 0) {
+            auto skipped = min<u64>(m_bytes_to_skip, data.size() - position);
+            position += skipped;
+            m_bytes_to_skip -= skipped;
+            continue;
+        }
+
+        auto remaining = data.slice(position);
+        auto element_id = TRY(peek_variable_size_integer(remaining, false));
+        if (!element_id.has_value())
+            break;
+        auto element_size = TRY(peek_variable_size_integer(remaining.slice(element_id->length), true));
+        if (!element_size.has_value())
+            break;
+        auto header_size = element_id->length + element_size->length;
+
+        if (element_id->value == SEGMENT_ELEMENT_ID || element_id->value == CLUSTER_ELEMENT_ID) {
+            // We read the children of these as they arrive. Their sizes are often unknown in live streams, so we rely on
+            // the IDs of the elements that follow to find out where a Cluster has ended.
+            if (element_id->value == CLUSTER_ELEMENT_ID)
+                m_cluster_timestamp.clear();
+            position += header_size;
+            continue;
+        }
+
+        bool needs_whole_element = false;
+        switch (element_id->value) {
+        case EBML_MASTER_ELEMENT_ID:
+        case SEGMENT_INFORMATION_ELEMENT_ID:
+        case TRACK_ELEMENT_ID:
+        case TIMESTAMP_ID:
+        case SIMPLE_BLOCK_ID:
+            needs_whole_element = true;
+            break;
+        default:
+            break;
+        }
+
+        if (element_size->is_unknown)
+            return DecoderError::format(DecoderErrorCategory::NotImplemented, "Element {:#x} of unknown size is not supported", element_id->value);
+
+        if (!needs_whole_element) {
+            position += header_size;
+            m_bytes_to_skip = element_size->value;
+            continue;
+        }
+
+        if (remaining.size() - header_size < element_size->value)
+            break;
+
+        // The parsing functions expect to read the element size themselves.
+        Streamer streamer { remaining.slice(element_id->length, element_size->length + element_size->value) };
+
+        switch (element_id->value) {
+        case EBML_MASTER_ELEMENT_ID:
+            TRY(parse_ebml_header(streamer));
+            break;
+        case SEGMENT_INFORMATION_ELEMENT_ID:
+            m_segment_information = TRY(parse_information(streamer));
+            break;
+        case TRACK_ELEMENT_ID:
+            m_tracks.clear();
+            TRY(parse_master_element(streamer, "Tracks"sv, [&](u64 child_element_id) -> DecoderErrorOr<IterationDecision> {
+                if (child_element_id == TRACK_ENTRY_ID) {
+                    auto track_entry = TRY(parse_track_entry(streamer));
+                    DECODER_TRY_ALLOC(m_tracks.try_set(track_entry->track_number(), track_entry));
+                } else {
+                    TRY_READ(streamer.read_unknown_element());
+                }
+                return IterationDecision::Continue;
+            }));
+            if (on_initialization_segment)
+                TRY(on_initialization_segment(m_segment_information, m_tracks));
+            break;
+        case TIMESTAMP_ID:
+            m_cluster_timestamp = AK::Duration::from_nanoseconds(TRY_READ(streamer.read_u64()) * m_segment_information.timestamp_scale());
+            break;
+        case SIMPLE_BLOCK_ID: {
+            if (!m_cluster_timestamp.has_value())
+                return DecoderError::corrupted("Block was not preceded by a Cluster timestamp"sv);
+
+            auto track_number = TRY(peek_variable_size_integer(remaining.slice(header_size), true));
+            if (!track_number.has_value())
+                return DecoderError::corrupted("Block is missing its track number"sv);
+            auto track = m_tracks.get(track_number->value);
+            if (!track.has_value())
+                return DecoderError::format(DecoderErrorCategory::Corrupted, "Block refers to unknown track {}", track_number->value);
+
+            auto block = TRY(parse_simple_block(streamer, m_cluster_timestamp.value(), m_segment_information.timestamp_scale(), *track.value()));
+            if (on_block)
+                TRY(on_block(*track.value(), block));
+            break;
+        }
+        default:
+            VERIFY_NOT_REACHED();
+        }
+
+        position += header_size + element_size->value;
+    }
+
+    return position;
+}
+
 DecoderErrorOr<Block> SampleIterator::next_block()
 {
     if (m_position >= m_data.size())
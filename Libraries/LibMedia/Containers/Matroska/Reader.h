@@ -114,6 +114,35 @@ private:
     Optional<Cluster> m_current_cluster;
 };
 
+// Parses a Matroska byte stream as it arrives, such as the one appended to a Media Source Extensions SourceBuffer.
+// Only an element that has not been received completely is held on to. The Segment and its Clusters are entered
+// without waiting for them to end, since they may be as long as the stream, and elements we don't use are skipped
+// without being buffered at all.
+class IncrementalReader {
+public:
+    Function<DecoderErrorOr<void>(SegmentInformation const&, OrderedHashMap<u64, NonnullRefPtr<TrackEntry>> const&)> on_initialization_segment;
+    // The frames of the block point into data that is only valid for the duration of the callback.
+    Function<DecoderErrorOr<void>(TrackEntry const&, Block const&)> on_block;
+
+    DecoderErrorOr<void> append(ReadonlyBytes);
+
+    // Drops the data of any element that is still incomplete, so that the next appended data starts with a new element.
+    void reset();
+
+    bool has_received_initialization_segment() const { return !m_tracks.is_empty(); }
+    size_t pending_data_size() const { return m_pending_data.size(); }
+
+private:
+    DecoderErrorOr<size_t> parse(ReadonlyBytes);
+
+    ByteBuffer m_pending_data;
+    u64 m_bytes_to_skip { 0 };
+
+    SegmentInformation m_segment_information;
+    OrderedHashMap<u64, NonnullRefPtr<TrackEntry>> m_tracks;
+    Optional<AK::Duration> m_cluster_timestamp;
+};
+
 class Streamer {
 public:
     Streamer(ReadonlyBytes data)
@@ -4,16 +4,49 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Debug.h>
+#include <AK/ScopeGuard.h>
 #include <LibCore/System.h>
 #include <LibMedia/VideoFrame.h>
 
 #include "FFmpegHelpers.h"
 #include "FFmpegVideoDecoder.h"
 
+extern "C" {
+#include <libavutil/hwcontext.h>
+#include <libavutil/pixdesc.h>
+}
+
 namespace Media::FFmpeg {
 
-static AVPixelFormat negotiate_output_format(AVCodecContext*, AVPixelFormat const* formats)
+// The platform's video acceleration API, which FFmpeg decodes into GPU surfaces with when the codec supports it.
+static constexpr AVHWDeviceType hardware_device_type =
+#if defined(AK_OS_MACOS)
+    AV_HWDEVICE_TYPE_VIDEOTOOLBOX;
+#elif defined(AK_OS_WINDOWS)
+    AV_HWDEVICE_TYPE_D3D11VA;
+#elif defined(AK_OS_LINUX)
+    AV_HWDEVICE_TYPE_VAAPI;
+#else
+    AV_HWDEVICE_TYPE_NONE;
+#endif
+
+static AVPixelFormat hardware_pixel_format(AVCodecContext const* codec_context)
+{
+    return static_cast<AVPixelFormat>(reinterpret_cast<intptr_t>(codec_context->opaque));
+}
+
+static AVPixelFormat negotiate_output_format(AVCodecContext* codec_context, AVPixelFormat const* formats)
 {
+    // If FFmpeg offers to decode into surfaces of the hardware device we opened, take that. If initializing the hardware
+    // decoder then fails, FFmpeg asks again without offering it, and we fall back to software decoding.
+    if (codec_context->hw_device_ctx != nullptr) {
+        for (auto const* format = formats; *format >= 0; format++) {
+            if (*format == hardware_pixel_format(codec_context))
+                return *format;
+        }
+    }
+
     while (*formats >= 0) {
         switch (*formats) {
         case AV_PIX_FMT_YUV420P:
@@ -34,16 +67,43 @@ static AVPixelFormat negotiate_output_format(AVCodecContext*, AVPixelFormat cons
     return AV_PIX_FMT_NONE;
 }
 
+static void try_attach_hardware_device(AVCodecContext* codec_context, AVCodec const* codec)
+{
+    if constexpr (hardware_device_type == AV_HWDEVICE_TYPE_NONE)
+        return;
+
+    for (int i = 0;; i++) {
+        auto const* config = avcodec_get_hw_config(codec, i);
+        if (config == nullptr)
+            return;
+        if ((config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX) == 0 || config->device_type != hardware_device_type)
+            continue;
+
+        AVBufferRef* device_context = nullptr;
+        if (av_hwdevice_ctx_create(&device_context, hardware_device_type, nullptr, nullptr, 0) < 0) {
+            dbgln_if(PLAYBACK_MANAGER_DEBUG, "FFmpegVideoDecoder: Failed to open {} device, decoding in software", av_hwdevice_get_type_name(hardware_device_type));
+            return;
+        }
+
+        // NOTE: The codec context takes ownership of the device context, and frees it along with itself.
+        codec_context->hw_device_ctx = device_context;
+        codec_context->opaque = reinterpret_cast<void*>(static_cast<intptr_t>(config->pix_fmt));
+        return;
+    }
+}
+
 DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create(CodecID codec_id, ReadonlyBytes codec_initialization_data)
 {
     AVCodecContext* codec_context = nullptr;
     AVPacket* packet = nullptr;
     AVFrame* frame = nullptr;
+    AVFrame* transfer_frame = nullptr;
     ArmedScopeGuard memory_guard {
         [&] {
             avcodec_free_context(&codec_context);
             av_packet_free(&packet);
             av_frame_free(&frame);
+            av_frame_free(&transfer_frame);
         }
     };
 
@@ -57,6 +117,7 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
         return DecoderError::format(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg codec context for codec {}", codec_id);
 
     codec_context->get_format = negotiate_output_format;
+    try_attach_hardware_device(codec_context, codec);
 
     codec_context->thread_count = static_cast<int>(min(Core::System::hardware_concurrency(), 4));
 
@@ -83,14 +144,19 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
     if (!frame)
         return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg frame"sv);
 
+    transfer_frame = av_frame_alloc();
+    if (!transfer_frame)
+        return DecoderError::with_description(DecoderErrorCategory::Memory, "Failed to allocate FFmpeg frame"sv);
+
     memory_guard.disarm();
-    return DECODER_TRY_ALLOC(try_make<FFmpegVideoDecoder>(codec_context, packet, frame));
+    return DECODER_TRY_ALLOC(try_make<FFmpegVideoDecoder>(codec_context, packet, frame, transfer_frame));
 }
 
-FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame)
+FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame, AVFrame* transfer_frame)
     : m_codec_context(codec_context)
     , m_packet(packet)
     , m_frame(frame)
+    , m_transfer_frame(transfer_frame)
 {
 }
 
@@ -98,6 +164,7 @@ FFmpegVideoDecoder::~FFmpegVideoDecoder()
 {
     av_packet_free(&m_packet);
     av_frame_free(&m_frame);
+    av_frame_free(&m_transfer_frame);
     avcodec_free_context(&m_codec_context);
 }
 
@@ -148,30 +215,53 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         }();
         auto cicp = CodingIndependentCodePoints { color_primaries, transfer_characteristics, matrix_coefficients, color_range };
 
-        size_t bit_depth = [&] {
-            switch (m_frame->format) {
+        // Frames decoded in hardware live in GPU surfaces, so they have to be downloaded before we can read them.
+        // FIXME: Import the surfaces into the painter directly instead (as DMA-BUFs, IOSurfaces or shared D3D11
+        //        textures), so that hardware decoded frames never leave the GPU.
+        auto const* source_frame = m_frame;
+        ScopeGuard transfer_frame_guard { [&] { av_frame_unref(m_transfer_frame); } };
+        if (m_frame->hw_frames_ctx != nullptr) {
+            if (av_hwframe_transfer_data(m_transfer_frame, m_frame, 0) < 0)
+                return DecoderError::with_description(DecoderErrorCategory::Unknown, "Failed to download a frame from the hardware video decoder"sv);
+            source_frame = m_transfer_frame;
+        }
+
+        Optional<size_t> bit_depth = [&]() -> Optional<size_t> {
+            switch (source_frame->format) {
             case AV_PIX_FMT_YUV420P:
             case AV_PIX_FMT_YUV422P:
             case AV_PIX_FMT_YUV444P:
+            case AV_PIX_FMT_NV12:
                 return 8;
             case AV_PIX_FMT_YUV420P10:
             case AV_PIX_FMT_YUV422P10:
             case AV_PIX_FMT_YUV444P10:
+            case AV_PIX_FMT_P010:
                 return 10;
             case AV_PIX_FMT_YUV420P12:
             case AV_PIX_FMT_YUV422P12:
             case AV_PIX_FMT_YUV444P12:
                 return 12;
+            default:
+                return {};
             }
-            VERIFY_NOT_REACHED();
         }();
-        size_t component_size = (bit_depth + 7) / 8;
+        // NOTE: Software decoding only ever produces the formats we negotiated, so only downloaded frames can end up here.
+        if (!bit_depth.has_value())
+            return DecoderError::format(DecoderErrorCategory::NotImplemented, "Hardware video decoder produced unsupported pixel format {}", av_get_pix_fmt_name(static_cast<AVPixelFormat>(source_frame->format)));
+        size_t component_size = (bit_depth.value() + 7) / 8;
+
+        // NV12 and P010 store U and V interleaved in a single plane. P010 also stores its samples in the high bits.
+        bool const chroma_is_interleaved = source_frame->format == AV_PIX_FMT_NV12 || source_frame->format == AV_PIX_FMT_P010;
+        u32 const sample_shift = source_frame->format == AV_PIX_FMT_P010 ? 16 - bit_depth.value() : 0;
 
         auto subsampling = [&]() -> Subsampling {
-            switch (m_frame->format) {
+            switch (source_frame->format) {
             case AV_PIX_FMT_YUV420P:
             case AV_PIX_FMT_YUV420P10:
             case AV_PIX_FMT_YUV420P12:
+            case AV_PIX_FMT_NV12:
+            case AV_PIX_FMT_P010:
                 return { true, true };
             case AV_PIX_FMT_YUV422P:
             case AV_PIX_FMT_YUV422P10:
@@ -190,27 +280,77 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
         auto size = Gfx::Size<u32> { m_frame->width, m_frame->height };
 
         auto timestamp = AK::Duration::from_microseconds(m_frame->pts);
-        auto frame = DECODER_TRY_ALLOC(SubsampledYUVFrame::try_create(timestamp, size, bit_depth, cicp, subsampling));
+        auto frame = DECODER_TRY_ALLOC(SubsampledYUVFrame::try_create(timestamp, size, bit_depth.value(), cicp, subsampling));
 
-        for (u32 plane = 0; plane < 3; plane++) {
-            VERIFY(m_frame->linesize[plane] != 0);
-            if (m_frame->linesize[plane] < 0)
+        auto source_planes = chroma_is_interleaved ? 2 : 3;
+        for (int plane = 0; plane < source_planes; plane++) {
+            VERIFY(source_frame->linesize[plane] != 0);
+            if (source_frame->linesize[plane] < 0)
                 return DecoderError::with_description(DecoderErrorCategory::NotImplemented, "Reversed scanlines are not supported"sv);
+        }
 
+        auto copy_row = [&](u8* destination, u8 const* source, size_t sample_count) {
+            if (sample_shift == 0) {
+                memcpy(destination, source, sample_count * component_size);
+                return;
+            }
+            auto* destination_samples = reinterpret_cast<u16*>(destination);
+            auto const* source_samples = reinterpret_cast<u16 const*>(source);
+            for (size_t i = 0; i < sample_count; i++)
+                destination_samples[i] = source_samples[i] >> sample_shift;
+        };
+
+        auto deinterleave_row = [&](u8* u_destination, u8* v_destination, u8 const* source, size_t sample_count) {
+            if (component_size == 1) {
+                for (size_t i = 0; i < sample_count; i++) {
+                    u_destination[i] = source[i * 2];
+                    v_destination[i] = source[i * 2 + 1];
+                }
+                return;
+            }
+            auto* u_samples = reinterpret_cast<u16*>(u_destination);
+            auto* v_samples = reinterpret_cast<u16*>(v_destination);
+            auto const* source_samples = reinterpret_cast<u16 const*>(source);
+            for (size_t i = 0; i < sample_count; i++) {
+                u_samples[i] = source_samples[i * 2] >> sample_shift;
+                v_samples[i] = source_samples[i * 2 + 1] >> sample_shift;
+            }
+        };
+
+        for (u32 plane = 0; plane < 3; plane++) {
             bool const use_subsampling = plane > 0;
             auto plane_size = (use_subsampling ? subsampling.subsampled_size(size) : size).to_type<size_t>();
-
             auto output_line_size = plane_size.width() * component_size;
-            VERIFY(output_line_size <= static_cast<size_t>(m_frame->linesize[plane]));
 
-            auto const* source = m_frame->data[plane];
-            VERIFY(source != nullptr);
             auto* destination = frame->get_raw_plane_data(plane);
             VERIFY(destination != nullptr);
 
+            if (chroma_is_interleaved && plane > 0) {
+                // Both chroma planes are filled from the interleaved plane at once.
+                if (plane == 2)
+                    break;
+
+                VERIFY(output_line_size * 2 <= static_cast<size_t>(source_frame->linesize[1]));
+                auto const* source = source_frame->data[1];
+                VERIFY(source != nullptr);
+                auto* v_destination = frame->get_raw_plane_data(2);
+
+                for (size_t row = 0; row < plane_size.height(); row++) {
+                    deinterleave_row(destination, v_destination, source, plane_size.width());
+                    source += source_frame->linesize[1];
+                    destination += output_line_size;
+                    v_destination += output_line_size;
+                }
+                continue;
+            }
+
+            VERIFY(output_line_size <= static_cast<size_t>(source_frame->linesize[plane]));
+            auto const* source = source_frame->data[plane];
+            VERIFY(source != nullptr);
+
             for (size_t row = 0; row < plane_size.height(); row++) {
-                memcpy(destination, source, output_line_size);
-                source += m_frame->linesize[plane];
+                copy_row(destination, source, plane_size.width());
+                source += source_frame->linesize[plane];
                 destination += output_line_size;
             }
         }
@@ -228,6 +368,15 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
     }
 }
 
+DecoderErrorOr<void> FFmpegVideoDecoder::signal_end_of_stream()
+{
+    // NOTE: Sending a null packet puts the decoder into draining mode.
+    auto result = avcodec_send_packet(m_codec_context, nullptr);
+    if (result < 0 && result != AVERROR_EOF)
+        return DecoderError::format(DecoderErrorCategory::Unknown, "FFmpeg codec failed to enter draining mode with code {:x}", result);
+    return {};
+}
+
 void FFmpegVideoDecoder::flush()
 {
     avcodec_flush_buffers(m_codec_context);
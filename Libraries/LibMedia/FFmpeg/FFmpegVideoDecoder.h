@@ -16,12 +16,14 @@ namespace Media::FFmpeg {
 class FFmpegVideoDecoder final : public VideoDecoder {
 public:
     static DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> try_create(CodecID, ReadonlyBytes codec_initialization_data);
-    FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame);
+    FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame, AVFrame* transfer_frame);
     ~FFmpegVideoDecoder();
 
     DecoderErrorOr<void> receive_sample(AK::Duration timestamp, ReadonlyBytes sample) override;
     DecoderErrorOr<NonnullOwnPtr<VideoFrame>> get_decoded_frame() override;
 
+    DecoderErrorOr<void> signal_end_of_stream() override;
+
     void flush() override;
 
 private:
@@ -30,6 +32,8 @@ private:
     AVCodecContext* m_codec_context;
     AVPacket* m_packet;
     AVFrame* m_frame;
+    // Receives frames downloaded from the GPU surfaces of the hardware decoder.
+    AVFrame* m_transfer_frame;
 };
 
 }
@@ -19,10 +19,11 @@ DecoderErrorOr<NonnullOwnPtr<FFmpegVideoDecoder>> FFmpegVideoDecoder::try_create
     return DecoderError::format(DecoderErrorCategory::NotImplemented, "FFmpeg not available on this platform");
 }
 
-FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame)
+FFmpegVideoDecoder::FFmpegVideoDecoder(AVCodecContext* codec_context, AVPacket* packet, AVFrame* frame, AVFrame* transfer_frame)
     : m_codec_context(codec_context)
     , m_packet(packet)
     , m_frame(frame)
+    , m_transfer_frame(transfer_frame)
 {
 }
 
@@ -42,6 +43,11 @@ DecoderErrorOr<NonnullOwnPtr<VideoFrame>> FFmpegVideoDecoder::get_decoded_frame(
     return DecoderError::format(DecoderErrorCategory::NotImplemented, "FFmpeg not available on this platform");
 }
 
+DecoderErrorOr<void> FFmpegVideoDecoder::signal_end_of_stream()
+{
+    return DecoderError::format(DecoderErrorCategory::NotImplemented, "FFmpeg not available on this platform");
+}
+
 void FFmpegVideoDecoder::flush()
 {
 }
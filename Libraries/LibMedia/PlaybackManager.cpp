@@ -129,7 +129,7 @@ void PlaybackManager::dispatch_decoder_error(DecoderError error)
     }
 }
 
-void PlaybackManager::dispatch_new_frame(RefPtr<Gfx::Bitmap> frame)
+void PlaybackManager::dispatch_new_frame(RefPtr<Gfx::ImmutableBitmap> frame)
 {
     if (on_video_frame)
         on_video_frame(move(frame));
@@ -264,12 +264,13 @@ void PlaybackManager::decode_and_queue_one_sample()
                 break;
             }
 
-            auto bitmap_result = decoded_frame->to_bitmap();
+            auto timestamp = decoded_frame->timestamp();
+            auto bitmap_result = VideoFrame::to_immutable_bitmap(decoded_frame.release_nonnull());
 
             if (bitmap_result.is_error())
-                item_to_enqueue = FrameQueueItem::error_marker(bitmap_result.release_error(), decoded_frame->timestamp());
+                item_to_enqueue = FrameQueueItem::error_marker(bitmap_result.release_error(), timestamp);
             else
-                item_to_enqueue = FrameQueueItem::frame(bitmap_result.release_value(), decoded_frame->timestamp());
+                item_to_enqueue = FrameQueueItem::frame(bitmap_result.release_value(), timestamp);
             break;
         }
     }
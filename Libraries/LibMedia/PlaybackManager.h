@@ -12,7 +12,7 @@
 #include <AK/Queue.h>
 #include <AK/Time.h>
 #include <LibCore/SharedCircularQueue.h>
-#include <LibGfx/Bitmap.h>
+#include <LibGfx/ImmutableBitmap.h>
 #include <LibMedia/Demuxer.h>
 #include <LibThreading/ConditionVariable.h>
 #include <LibThreading/Mutex.h>
@@ -37,7 +37,7 @@ public:
         Error,
     };
 
-    static FrameQueueItem frame(RefPtr<Gfx::Bitmap> bitmap, AK::Duration timestamp)
+    static FrameQueueItem frame(RefPtr<Gfx::ImmutableBitmap> bitmap, AK::Duration timestamp)
     {
         return FrameQueueItem(move(bitmap), timestamp);
     }
@@ -47,8 +47,8 @@ public:
         return FrameQueueItem(move(error), timestamp);
     }
 
-    bool is_frame() const { return m_data.has<RefPtr<Gfx::Bitmap>>(); }
-    RefPtr<Gfx::Bitmap> bitmap() const { return m_data.get<RefPtr<Gfx::Bitmap>>(); }
+    bool is_frame() const { return m_data.has<RefPtr<Gfx::ImmutableBitmap>>(); }
+    RefPtr<Gfx::ImmutableBitmap> bitmap() const { return m_data.get<RefPtr<Gfx::ImmutableBitmap>>(); }
     AK::Duration timestamp() const { return m_timestamp; }
 
     bool is_error() const { return m_data.has<DecoderError>(); }
@@ -70,7 +70,7 @@ public:
     }
 
 private:
-    FrameQueueItem(RefPtr<Gfx::Bitmap> bitmap, AK::Duration timestamp)
+    FrameQueueItem(RefPtr<Gfx::ImmutableBitmap> bitmap, AK::Duration timestamp)
         : m_data(move(bitmap))
         , m_timestamp(timestamp)
     {
@@ -83,7 +83,7 @@ private:
     {
     }
 
-    Variant<Empty, RefPtr<Gfx::Bitmap>, DecoderError> m_data { Empty() };
+    Variant<Empty, RefPtr<Gfx::ImmutableBitmap>, DecoderError> m_data { Empty() };
     AK::Duration m_timestamp { no_timestamp };
 };
 
@@ -135,7 +135,7 @@ public:
     AK::Duration current_playback_time();
     AK::Duration duration();
 
-    Function<void(RefPtr<Gfx::Bitmap>)> on_video_frame;
+    Function<void(RefPtr<Gfx::ImmutableBitmap>)> on_video_frame;
     Function<void()> on_playback_state_change;
     Function<void(DecoderError)> on_decoder_error;
     Function<void(Error)> on_fatal_playback_error;
@@ -164,7 +164,7 @@ private:
     void decode_and_queue_one_sample();
 
     void dispatch_decoder_error(DecoderError error);
-    void dispatch_new_frame(RefPtr<Gfx::Bitmap> frame);
+    void dispatch_new_frame(RefPtr<Gfx::ImmutableBitmap> frame);
     // Returns whether we changed playback states. If so, any PlaybackStateHandler processing must cease.
     [[nodiscard]] bool dispatch_frame_queue_item(FrameQueueItem&&);
     void dispatch_state_change();
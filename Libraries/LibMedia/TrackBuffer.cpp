@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <LibMedia/TrackBuffer.h>
+
+namespace Media {
+
+TrackBuffer::TrackBuffer(size_t capacity_in_bytes)
+    : m_capacity_in_bytes(capacity_in_bytes)
+{
+}
+
+ErrorOr<void> TrackBuffer::append(AK::Duration timestamp, bool is_keyframe, ReadonlyBytes data)
+{
+    // Containers don't always store frame durations, so we infer them from the timestamp of the following frame. The
+    // newest frame is assumed to last as long as the one before it.
+    auto duration = AK::Duration::zero();
+    if (frame_count() > 0) {
+        auto& previous_frame = m_frames.last();
+        if (timestamp > previous_frame.timestamp)
+            previous_frame.duration = timestamp - previous_frame.timestamp;
+        duration = previous_frame.duration;
+    }
+
+    auto data_offset = m_data.size();
+    TRY(m_data.try_append(data));
+    TRY(m_frames.try_append({ timestamp, duration, is_keyframe, data_offset, data.size() }));
+    m_size_in_bytes += data.size();
+    return {};
+}
+
+Optional<size_t> TrackBuffer::random_access_point_for(AK::Duration timestamp) const
+{
+    Optional<size_t> random_access_point;
+    for (size_t i = 0; i < frame_count(); i++) {
+        auto const& coded_frame = frame(i);
+        if (coded_frame.timestamp > timestamp)
+            break;
+        if (coded_frame.is_keyframe)
+            random_access_point = i;
+    }
+    return random_access_point;
+}
+
+size_t TrackBuffer::evict_before(AK::Duration timestamp)
+{
+    auto random_access_point = random_access_point_for(timestamp);
+    if (!random_access_point.has_value())
+        return 0;
+
+    size_t freed_bytes = 0;
+    for (size_t i = 0; i < random_access_point.value(); i++)
+        freed_bytes += frame(i).data_size;
+
+    m_first_frame += random_access_point.value();
+    m_size_in_bytes -= freed_bytes;
+
+    if (m_data.size() - m_size_in_bytes > m_size_in_bytes)
+        compact();
+    return freed_bytes;
+}
+
+void TrackBuffer::remove(AK::Duration start, AK::Duration end)
+{
+    Vector<CodedFrame> remaining_frames;
+    remaining_frames.ensure_capacity(frame_count());
+
+    bool removing_dependent_frames = false;
+    for (size_t i = 0; i < frame_count(); i++) {
+        auto const& coded_frame = frame(i);
+
+        // Remove all media data, from this track buffer, that contain starting timestamps greater than or equal to start
+        // and less than the remove end timestamp.
+        // Remove all possible decoding dependencies on the coded frames removed in the previous step by removing all
+        // coded frames from this track buffer between those frames removed in the previous step and the next random
+        // access point after those removed frames.
+        auto is_in_range = coded_frame.timestamp >= start && coded_frame.timestamp < end;
+        if (is_in_range || (removing_dependent_frames && !coded_frame.is_keyframe)) {
+            removing_dependent_frames = true;
+            m_size_in_bytes -= coded_frame.data_size;
+            continue;
+        }
+
+        removing_dependent_frames = false;
+        remaining_frames.unchecked_append(coded_frame);
+    }
+
+    m_frames = move(remaining_frames);
+    m_first_frame = 0;
+
+    if (m_data.size() - m_size_in_bytes > m_size_in_bytes)
+        compact();
+}
+
+void TrackBuffer::clear()
+{
+    m_frames.clear();
+    m_first_frame = 0;
+    m_data.clear();
+    m_size_in_bytes = 0;
+}
+
+void TrackBuffer::compact()
+{
+    auto data_or_error = ByteBuffer::create_uninitialized(m_size_in_bytes);
+    if (data_or_error.is_error())
+        return;
+    auto data = data_or_error.release_value();
+
+    Vector<CodedFrame> frames;
+    if (frames.try_ensure_capacity(frame_count()).is_error())
+        return;
+
+    size_t data_offset = 0;
+    for (size_t i = 0; i < frame_count(); i++) {
+        auto coded_frame = frame(i);
+        m_data.span().slice(coded_frame.data_offset, coded_frame.data_size).copy_to(data.span().slice(data_offset));
+        coded_frame.data_offset = data_offset;
+        data_offset += coded_frame.data_size;
+        frames.unchecked_append(coded_frame);
+    }
+    VERIFY(data_offset == m_size_in_bytes);
+
+    m_data = move(data);
+    m_frames = move(frames);
+    m_first_frame = 0;
+}
+
+Vector<TrackBuffer::TimeRange> TrackBuffer::buffered_ranges() const
+{
+    Vector<TimeRange> frame_ranges;
+    frame_ranges.ensure_capacity(frame_count());
+    for (size_t i = 0; i < frame_count(); i++) {
+        auto const& coded_frame = frame(i);
+        frame_ranges.unchecked_append({ coded_frame.timestamp, coded_frame.timestamp + coded_frame.duration });
+    }
+
+    // Frames are stored in decode order, which may differ from presentation order.
+    quick_sort(frame_ranges, [](auto const& a, auto const& b) { return a.start < b.start; });
+
+    Vector<TimeRange> ranges;
+    for (auto const& range : frame_ranges) {
+        if (!ranges.is_empty() && range.start <= ranges.last().end) {
+            ranges.last().end = max(ranges.last().end, range.end);
+            continue;
+        }
+        ranges.append(range);
+    }
+    return ranges;
+}
+
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/Error.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+
+namespace Media {
+
+// Holds the coded frames of one track of a stream that is being buffered in pieces, as for Media Source Extensions.
+// The frame data is packed into a single buffer, and only a small index entry is kept for each frame. The buffer is
+// bounded: once it is full, frames that have already been played have to be evicted before more can be appended.
+class TrackBuffer {
+public:
+    struct CodedFrame {
+        AK::Duration timestamp;
+        AK::Duration duration;
+        bool is_keyframe { false };
+        size_t data_offset { 0 };
+        size_t data_size { 0 };
+    };
+
+    struct TimeRange {
+        AK::Duration start;
+        AK::Duration end;
+    };
+
+    explicit TrackBuffer(size_t capacity_in_bytes);
+
+    // Frames must be appended in decode order.
+    ErrorOr<void> append(AK::Duration timestamp, bool is_keyframe, ReadonlyBytes data);
+
+    size_t capacity_in_bytes() const { return m_capacity_in_bytes; }
+    size_t size_in_bytes() const { return m_size_in_bytes; }
+    bool is_full() const { return m_size_in_bytes >= m_capacity_in_bytes; }
+
+    size_t frame_count() const { return m_frames.size() - m_first_frame; }
+    CodedFrame const& frame(size_t index) const { return m_frames[m_first_frame + index]; }
+    ReadonlyBytes data(CodedFrame const& frame) const { return m_data.span().slice(frame.data_offset, frame.data_size); }
+
+    // Returns the index of the last keyframe at or before the timestamp, which decoding has to start from to present it.
+    Optional<size_t> random_access_point_for(AK::Duration timestamp) const;
+
+    // Evicts every frame that is not needed to decode the frames from the timestamp onward, and returns the number of
+    // bytes that were freed.
+    size_t evict_before(AK::Duration timestamp);
+
+    // https://w3c.github.io/media-source/#dfn-coded-frame-removal
+    // Removes the frames that are presented in [start, end), along with the frames that depend on them up until the
+    // next keyframe.
+    void remove(AK::Duration start, AK::Duration end);
+
+    void clear();
+
+    // The presentation time ranges that are covered by the buffered frames.
+    Vector<TimeRange> buffered_ranges() const;
+
+private:
+    void compact();
+
+    size_t m_capacity_in_bytes { 0 };
+    size_t m_size_in_bytes { 0 };
+
+    // Frames are removed from the front as they are evicted. Rather than shifting the remaining frames and their data
+    // down every time, we keep track of where the live frames begin, and compact once most of the data is dead.
+    Vector<CodedFrame> m_frames;
+    size_t m_first_frame { 0 };
+    ByteBuffer m_data;
+};
+
+}
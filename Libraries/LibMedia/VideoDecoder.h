@@ -22,6 +22,10 @@ public:
     DecoderErrorOr<void> receive_sample(AK::Duration timestamp, ByteBuffer const& sample) { return receive_sample(timestamp, sample.span()); }
     virtual DecoderErrorOr<NonnullOwnPtr<VideoFrame>> get_decoded_frame() = 0;
 
+    // Tells the decoder that no more samples will be received, so that get_decoded_frame() returns every frame that
+    // is still held back for reordering before it reports the end of the stream.
+    virtual DecoderErrorOr<void> signal_end_of_stream() = 0;
+    // Discards all samples and frames that are held by the decoder, and allows it to receive samples again.
     virtual void flush() = 0;
 };
 
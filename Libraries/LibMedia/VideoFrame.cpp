@@ -6,6 +6,8 @@
 
 #include <AK/FixedArray.h>
 #include <AK/NonnullOwnPtr.h>
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibGfx/YUVData.h>
 #include <LibMedia/Color/ColorConverter.h>
 
 #include "VideoFrame.h"
@@ -237,4 +239,88 @@ DecoderErrorOr<void> SubsampledYUVFrame::output_to_bitmap(Gfx::Bitmap& bitmap)
     return convert_to_bitmap_selecting_subsampling(m_subsampling, cicp(), bit_depth(), width(), height(), m_y_buffer, m_u_buffer, m_v_buffer, bitmap);
 }
 
+class SubsampledYUVFrameData final : public Gfx::YUVData {
+public:
+    SubsampledYUVFrameData(NonnullOwnPtr<SubsampledYUVFrame> frame, Gfx::YUVSubsampling subsampling, Gfx::YUVMatrixCoefficients matrix_coefficients, Gfx::YUVRange range)
+        : YUVData(frame->size().to_type<int>(), subsampling, matrix_coefficients, range)
+        , m_frame(move(frame))
+    {
+    }
+
+    virtual ReadonlyBytes plane(size_t plane) const override
+    {
+        return { m_frame->get_raw_plane_data(plane), plane_size(plane).to_type<size_t>().area() };
+    }
+
+    virtual ErrorOr<NonnullRefPtr<Gfx::Bitmap>> to_bitmap() const override
+    {
+        auto bitmap = m_frame->to_bitmap();
+        if (bitmap.is_error())
+            return Error::from_string_literal("Failed to convert video frame to RGB");
+        return bitmap.release_value();
+    }
+
+private:
+    NonnullOwnPtr<SubsampledYUVFrame> m_frame;
+};
+
+static RefPtr<Gfx::YUVData> yuv_data_for_gpu_conversion(NonnullOwnPtr<VideoFrame>& frame)
+{
+    if (!frame->is_subsampled_yuv())
+        return nullptr;
+
+    // The GPU painter converts with a matrix alone, so the frame must already be in the output's primaries and transfer
+    // characteristics. This matches the fast path of output_to_bitmap().
+    // FIXME: Upload frames with a higher bit depth as 16-bit planes.
+    auto const& cicp = frame->cicp();
+    if (frame->bit_depth() != 8 || cicp.color_primaries() != ColorPrimaries::BT709 || cicp.transfer_characteristics() != TransferCharacteristics::SRGB)
+        return nullptr;
+
+    Gfx::YUVMatrixCoefficients matrix_coefficients;
+    switch (cicp.matrix_coefficients()) {
+    case MatrixCoefficients::BT470BG:
+    case MatrixCoefficients::BT601:
+        matrix_coefficients = Gfx::YUVMatrixCoefficients::BT601;
+        break;
+    case MatrixCoefficients::BT709:
+        matrix_coefficients = Gfx::YUVMatrixCoefficients::BT709;
+        break;
+    default:
+        return nullptr;
+    }
+
+    Gfx::YUVRange range;
+    switch (cicp.video_full_range_flag()) {
+    case VideoFullRangeFlag::Studio:
+        range = Gfx::YUVRange::Studio;
+        break;
+    case VideoFullRangeFlag::Full:
+        range = Gfx::YUVRange::Full;
+        break;
+    default:
+        return nullptr;
+    }
+
+    auto subsampling = static_cast<SubsampledYUVFrame&>(*frame).subsampling();
+    Gfx::YUVSubsampling yuv_subsampling;
+    if (subsampling.x() && subsampling.y())
+        yuv_subsampling = Gfx::YUVSubsampling::HorizontalAndVertical;
+    else if (subsampling.x())
+        yuv_subsampling = Gfx::YUVSubsampling::Horizontal;
+    else if (!subsampling.y())
+        yuv_subsampling = Gfx::YUVSubsampling::None;
+    else
+        return nullptr;
+
+    return adopt_ref(*new SubsampledYUVFrameData(frame.release_nonnull<SubsampledYUVFrame>(), yuv_subsampling, matrix_coefficients, range));
+}
+
+DecoderErrorOr<NonnullRefPtr<Gfx::ImmutableBitmap>> VideoFrame::to_immutable_bitmap(NonnullOwnPtr<VideoFrame> frame)
+{
+    if (auto yuv_data = yuv_data_for_gpu_conversion(frame))
+        return Gfx::ImmutableBitmap::create_from_yuv(yuv_data.release_nonnull());
+
+    return Gfx::ImmutableBitmap::create(TRY(frame->to_bitmap()));
+}
+
 }
@@ -8,6 +8,7 @@
 
 #include <AK/Time.h>
 #include <LibGfx/Bitmap.h>
+#include <LibGfx/Forward.h>
 #include <LibGfx/Size.h>
 #include <LibMedia/Color/CodingIndependentCodePoints.h>
 
@@ -29,6 +30,12 @@ public:
         return bitmap;
     }
 
+    // Consumes the frame to create an image to paint. When the planes of the frame can be converted to RGB by the GPU
+    // painter, they are handed over as they are, instead of being converted here.
+    static DecoderErrorOr<NonnullRefPtr<Gfx::ImmutableBitmap>> to_immutable_bitmap(NonnullOwnPtr<VideoFrame>);
+
+    virtual bool is_subsampled_yuv() const { return false; }
+
     inline AK::Duration timestamp() const { return m_timestamp; }
 
     inline Gfx::Size<u32> size() const { return m_size; }
@@ -92,6 +99,10 @@ public:
 
     DecoderErrorOr<void> output_to_bitmap(Gfx::Bitmap& bitmap) override;
 
+    virtual bool is_subsampled_yuv() const override { return true; }
+
+    Subsampling subsampling() const { return m_subsampling; }
+
     u8* get_raw_plane_data(u32 plane)
     {
         switch (plane) {
@@ -49,6 +49,18 @@ static size_t s_cached_bytecode_size = 0;
 
 static constexpr auto MaxRegexCachedBytecodeSize = 1 * MiB;
 
+// The cache is kept in least-recently-used order, so looking up an entry moves it to the back.
+template<class Parser>
+static Optional<regex::Parser::Result> find_cached_parse_result(CacheKey<Parser> const& key)
+{
+    auto cache_entry = s_parser_cache<Parser>.take(key);
+    if (!cache_entry.has_value())
+        return {};
+
+    s_parser_cache<Parser>.set(key, *cache_entry);
+    return cache_entry;
+}
+
 template<class Parser>
 static void cache_parse_result(regex::Parser::Result const& result, CacheKey<Parser> const& key)
 {
@@ -67,8 +79,8 @@ template<class Parser>
 Regex<Parser>::Regex(ByteString pattern, typename ParserTraits<Parser>::OptionsType regex_options)
     : pattern_value(move(pattern))
 {
-    if (auto cache_entry = s_parser_cache<Parser>.get({ pattern_value, regex_options }); cache_entry.has_value()) {
-        parser_result = cache_entry.value();
+    if (auto cache_entry = find_cached_parse_result<Parser>({ pattern_value, regex_options }); cache_entry.has_value()) {
+        parser_result = cache_entry.release_value();
     } else {
         regex::Lexer lexer(pattern_value);
 
@@ -88,9 +100,18 @@ Regex<Parser>::Regex(ByteString pattern, typename ParserTraits<Parser>::OptionsT
 template<class Parser>
 Regex<Parser>::Regex(regex::Parser::Result parse_result, ByteString pattern, typename ParserTraits<Parser>::OptionsType regex_options)
     : pattern_value(move(pattern))
-    , parser_result(move(parse_result))
 {
-    run_optimization_passes();
+    // NOTE: The parse result is the unoptimized output of parse_pattern(), so an optimized copy from the cache can stand in for it.
+    if (auto cache_entry = find_cached_parse_result<Parser>({ pattern_value, regex_options }); cache_entry.has_value()) {
+        parser_result = cache_entry.release_value();
+    } else {
+        parser_result = move(parse_result);
+        run_optimization_passes();
+
+        if (parser_result.error == regex::Error::NoError)
+            cache_parse_result<Parser>(parser_result, { pattern_value, regex_options });
+    }
+
     if (parser_result.error == regex::Error::NoError)
         matcher = make<Matcher<Parser>>(this, regex_options | static_cast<decltype(regex_options.value())>(parser_result.options.value()));
 }
@@ -166,6 +187,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
 
     MatchInput input;
     MatchState state { m_pattern->parser_result.capture_groups_count };
+    Detail::SeenStateHashes seen_state_hashes;
     size_t operations = 0;
 
     input.regex_options = m_regex_options | regex_options.value_or({}).value();
@@ -253,7 +275,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.instruction_position = 0;
             state.repetition_marks.clear();
 
-            auto success = execute(input, state, temp_operations);
+            auto success = execute(input, state, temp_operations, seen_state_hashes);
             // This success is acceptable only if it doesn't read anything from the input (input length is 0).
             if (success && (state.string_position <= view_index)) {
                 operations = temp_operations;
@@ -287,8 +309,18 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
                 break;
 
             if (auto& starting_ranges = m_pattern->parser_result.optimization_data.starting_ranges; !starting_ranges.is_empty()) {
-                if (!binary_search(starting_ranges, input.view.code_unit_at(view_index), nullptr, compare_range))
+                auto can_start_match_at = [&](size_t index) {
+                    return binary_search(starting_ranges, input.view.code_unit_at(index), nullptr, compare_range) != nullptr;
+                };
+                if (!can_start_match_at(view_index)) {
+                    // OPTIMIZATION: Scan ahead to the last position before the next possible match start in a tight loop,
+                    //               instead of going through the whole loop body for every position in between.
+                    if (continue_search && !only_start_of_line) {
+                        while (view_index + 1 < view_length && !can_start_match_at(view_index + 1))
+                            ++view_index;
+                    }
                     goto done_matching;
+                }
             }
 
             input.column = match_count;
@@ -299,7 +331,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.instruction_position = 0;
             state.repetition_marks.clear();
 
-            if (execute(input, state, operations)) {
+            if (execute(input, state, operations, seen_state_hashes)) {
                 succeeded = true;
 
                 if (input.regex_options.has_flag_set(AllFlags::MatchNotEndOfLine) && state.string_position == input.view.length()) {
@@ -467,18 +499,12 @@ private:
     Node* m_last { nullptr };
 };
 
-struct SufficientlyUniformValueTraits : DefaultTraits<u64> {
-    static constexpr unsigned hash(u64 value)
-    {
-        return (value >> 32) ^ value;
-    }
-};
-
 template<class Parser>
-bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t& operations) const
+bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t& operations, Detail::SeenStateHashes& seen_state_hashes) const
 {
     BumpAllocatedLinkedList<MatchState> states_to_try_next;
-    HashTable<u64, SufficientlyUniformValueTraits> seen_state_hashes;
+    if (!seen_state_hashes.is_empty())
+        seen_state_hashes.clear_with_capacity();
 #if REGEX_DEBUG
     size_t recursion_level = 0;
 #endif
@@ -13,6 +13,7 @@
 
 #include <AK/Forward.h>
 #include <AK/GenericLexer.h>
+#include <AK/HashTable.h>
 #include <AK/Vector.h>
 #include <ctype.h>
 
@@ -28,6 +29,17 @@ struct Block {
     StringView comment { "N/A"sv };
 };
 
+struct SufficientlyUniformValueTraits : DefaultTraits<u64> {
+    static constexpr unsigned hash(u64 value)
+    {
+        return (value >> 32) ^ value;
+    }
+};
+
+// Hashes of the backtracking states that have already been tried.
+// This is reused across all starting positions of a single match to avoid reallocating it for each one.
+using SeenStateHashes = HashTable<u64, SufficientlyUniformValueTraits>;
+
 }
 
 static constexpr size_t const c_max_recursion = 5000;
@@ -71,7 +83,7 @@ public:
     }
 
 private:
-    bool execute(MatchInput const& input, MatchState& state, size_t& operations) const;
+    bool execute(MatchInput const& input, MatchState& state, size_t& operations, Detail::SeenStateHashes&) const;
 
     Regex<Parser> const* m_pattern;
     typename ParserTraits<Parser>::OptionsType const m_regex_options;
@@ -28,11 +28,16 @@ void Regex<Parser>::run_optimization_passes()
 {
     parser_result.bytecode.flatten();
 
+    // FIXME: Patterns without backreferences or lookarounds could be compiled to an automaton (e.g. a Pike VM)
+    //        and matched in linear time, instead of going through the backtracking VM.
     rewrite_with_useless_jumps_removed();
 
     auto blocks = split_basic_blocks(parser_result.bytecode);
-    if (attempt_rewrite_entire_match_as_substring_search(blocks))
+    if (attempt_rewrite_entire_match_as_substring_search(blocks)) {
+        // Even a plain literal benefits from knowing its first character, as that lets the matcher skip ahead.
+        fill_optimization_data(blocks);
         return;
+    }
 
     // Rewrite fork loops as atomic groups
     // e.g. a*b -> (ATOMIC a*)b
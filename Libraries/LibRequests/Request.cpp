@@ -100,6 +100,18 @@ void Request::did_receive_headers(Badge<RequestClient>, HTTP::HeaderMap const& r
         on_headers_received(response_headers, response_code, reason_phrase);
 }
 
+void Request::did_receive_body_in_shared_memory(Badge<RequestClient>, Core::AnonymousBuffer const& body)
+{
+    // If the request was stopped while this IPC was in-flight, just bail.
+    if (!m_internal_stream_data)
+        return;
+
+    // NOTE: The whole body is handed to us at once, and no response pipe is ever opened for this request.
+    VERIFY(m_fd == -1);
+    if (body.size() != 0)
+        m_internal_stream_data->on_data_available({ body.data<u8>(), body.size() });
+}
+
 void Request::did_request_certificates(Badge<RequestClient>)
 {
     if (on_certificate_requested) {
@@ -115,6 +127,7 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
     VERIFY(!m_internal_stream_data);
 
     m_internal_stream_data = make<InternalStreamData>();
+    m_internal_stream_data->on_data_available = move(on_data_available);
     m_internal_stream_data->read_notifier = Core::Notifier::construct(fd(), Core::Notifier::Type::Read);
     if (fd() != -1)
         m_internal_stream_data->read_stream = MUST(Core::File::adopt_fd(fd(), Core::File::OpenMode::Read));
@@ -143,7 +156,7 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
         }
     };
 
-    m_internal_stream_data->read_notifier->on_activation = [this, on_data_available = move(on_data_available)]() {
+    m_internal_stream_data->read_notifier->on_activation = [this]() {
         static constexpr size_t buffer_size = 256 * KiB;
         static char buffer[buffer_size];
 
@@ -162,7 +175,7 @@ void Request::set_up_internal_stream_data(DataReceived on_data_available)
             if (read_bytes.is_empty())
                 break;
 
-            on_data_available(read_bytes);
+            m_internal_stream_data->on_data_available(read_bytes);
         } while (true);
 
         if (m_internal_stream_data->read_stream->is_eof())
@@ -12,6 +12,7 @@
 #include <AK/MemoryStream.h>
 #include <AK/RefCounted.h>
 #include <AK/WeakPtr.h>
+#include <LibCore/AnonymousBuffer.h>
 #include <LibCore/Notifier.h>
 #include <LibHTTP/HeaderMap.h>
 #include <LibRequests/NetworkError.h>
@@ -55,6 +56,7 @@ public:
 
     void did_finish(Badge<RequestClient>, u64 total_size, RequestTimingInfo const& timing_info, Optional<NetworkError> const& network_error);
     void did_receive_headers(Badge<RequestClient>, HTTP::HeaderMap const& response_headers, Optional<u32> response_code, Optional<String> const& reason_phrase);
+    void did_receive_body_in_shared_memory(Badge<RequestClient>, Core::AnonymousBuffer const& body);
     void did_request_certificates(Badge<RequestClient>);
 
     RefPtr<Core::Notifier>& write_notifier(Badge<RequestClient>) { return m_write_notifier; }
@@ -92,6 +94,7 @@ private:
 
         OwnPtr<Stream> read_stream;
         RefPtr<Core::Notifier> read_notifier;
+        DataReceived on_data_available;
         u32 total_size { 0 };
         Optional<NetworkError> network_error;
         bool request_done { false };
@@ -28,7 +28,7 @@ void RequestClient::ensure_connection(URL::URL const& url, ::RequestServer::Cach
     async_ensure_connection(url, cache_level);
 }
 
-RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ReadonlyBytes request_body, Core::ProxyData const& proxy_data)
+RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL const& url, HTTP::HeaderMap const& request_headers, ReadonlyBytes request_body, Core::ProxyData const& proxy_data, RequestPriority priority)
 {
     auto body_result = ByteBuffer::copy(request_body);
     if (body_result.is_error())
@@ -37,7 +37,7 @@ RefPtr<Request> RequestClient::start_request(ByteString const& method, URL::URL
     static i32 s_next_request_id = 0;
     auto request_id = s_next_request_id++;
 
-    IPCProxy::async_start_request(request_id, method, url, request_headers, body_result.release_value(), proxy_data);
+    IPCProxy::async_start_request(request_id, method, url, request_headers, body_result.release_value(), proxy_data, priority);
     auto request = Request::create_from_id({}, *this, request_id);
     m_requests.set(request_id, request);
     return request;
@@ -69,7 +69,20 @@ bool RequestClient::set_certificate(Badge<Request>, Request& request, ByteString
     return IPCProxy::set_certificate(request.id(), move(certificate), move(key));
 }
 
-void RequestClient::request_finished(i32 request_id, u64 total_size, RequestTimingInfo timing_info, Optional<NetworkError> network_error)
+void RequestClient::request_lifecycle_events(Vector<RequestLifecycleEvent> events)
+{
+    for (auto& event : events) {
+        event.event.visit(
+            [&](RequestLifecycleEvent::HeadersReceived const& headers_received) {
+                headers_became_available(event.request_id, headers_received.response_headers, headers_received.status_code, headers_received.reason_phrase);
+            },
+            [&](RequestLifecycleEvent::Finished const& finished) {
+                request_finished(event.request_id, finished.total_size, finished.timing_info, finished.network_error);
+            });
+    }
+}
+
+void RequestClient::request_finished(i32 request_id, u64 total_size, RequestTimingInfo const& timing_info, Optional<NetworkError> const& network_error)
 {
     RefPtr<Request> request;
     if ((request = m_requests.get(request_id).value_or(nullptr))) {
@@ -78,7 +91,7 @@ void RequestClient::request_finished(i32 request_id, u64 total_size, RequestTimi
     m_requests.remove(request_id);
 }
 
-void RequestClient::headers_became_available(i32 request_id, HTTP::HeaderMap response_headers, Optional<u32> status_code, Optional<String> reason_phrase)
+void RequestClient::headers_became_available(i32 request_id, HTTP::HeaderMap const& response_headers, Optional<u32> status_code, Optional<String> const& reason_phrase)
 {
     auto request = const_cast<Request*>(m_requests.get(request_id).value_or(nullptr));
     if (!request) {
@@ -88,6 +101,16 @@ void RequestClient::headers_became_available(i32 request_id, HTTP::HeaderMap res
     request->did_receive_headers({}, response_headers, status_code, reason_phrase);
 }
 
+void RequestClient::request_body_available_in_shared_memory(i32 request_id, Core::AnonymousBuffer body)
+{
+    auto request = const_cast<Request*>(m_requests.get(request_id).value_or(nullptr));
+    if (!request) {
+        warnln("Received body for non-existent request {}", request_id);
+        return;
+    }
+    request->did_receive_body_in_shared_memory({}, body);
+}
+
 void RequestClient::certificate_requested(i32 request_id)
 {
     if (auto request = const_cast<Request*>(m_requests.get(request_id).value_or(nullptr))) {
@@ -111,11 +134,15 @@ void RequestClient::websocket_connected(i64 websocket_id)
         maybe_connection.value()->did_open({});
 }
 
-void RequestClient::websocket_received(i64 websocket_id, bool is_text, ByteBuffer data)
+void RequestClient::websocket_received(i64 websocket_id, Vector<WebSocket::Message> messages)
 {
     auto maybe_connection = m_websockets.get(websocket_id);
-    if (maybe_connection.has_value())
-        maybe_connection.value()->did_receive({}, move(data), is_text);
+    if (!maybe_connection.has_value())
+        return;
+
+    NonnullRefPtr connection = *maybe_connection.value();
+    for (auto& message : messages)
+        connection->did_receive({}, move(message));
 }
 
 void RequestClient::websocket_errored(i64 websocket_id, i32 message)
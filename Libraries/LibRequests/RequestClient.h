@@ -9,6 +9,8 @@
 #include <AK/HashMap.h>
 #include <LibHTTP/HeaderMap.h>
 #include <LibIPC/ConnectionToServer.h>
+#include <LibRequests/RequestLifecycleEvent.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibRequests/RequestTimingInfo.h>
 #include <LibRequests/WebSocket.h>
 #include <LibWebSocket/WebSocket.h>
@@ -30,7 +32,7 @@ public:
     explicit RequestClient(NonnullOwnPtr<IPC::Transport>);
     virtual ~RequestClient() override;
 
-    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, HTTP::HeaderMap const& request_headers = {}, ReadonlyBytes request_body = {}, Core::ProxyData const& = {});
+    RefPtr<Request> start_request(ByteString const& method, URL::URL const&, HTTP::HeaderMap const& request_headers = {}, ReadonlyBytes request_body = {}, Core::ProxyData const& = {}, RequestPriority = RequestPriority::Normal);
 
     RefPtr<WebSocket> websocket_connect(const URL::URL&, ByteString const& origin = {}, Vector<ByteString> const& protocols = {}, Vector<ByteString> const& extensions = {}, HTTP::HeaderMap const& request_headers = {});
 
@@ -43,18 +45,21 @@ private:
     virtual void die() override;
 
     virtual void request_started(i32, IPC::File) override;
-    virtual void request_finished(i32, u64, RequestTimingInfo, Optional<NetworkError>) override;
+    virtual void request_lifecycle_events(Vector<RequestLifecycleEvent>) override;
     virtual void certificate_requested(i32) override;
-    virtual void headers_became_available(i32, HTTP::HeaderMap, Optional<u32>, Optional<String>) override;
+    virtual void request_body_available_in_shared_memory(i32, Core::AnonymousBuffer) override;
 
     virtual void websocket_connected(i64 websocket_id) override;
-    virtual void websocket_received(i64 websocket_id, bool, ByteBuffer) override;
+    virtual void websocket_received(i64 websocket_id, Vector<WebSocket::Message>) override;
     virtual void websocket_errored(i64 websocket_id, i32) override;
     virtual void websocket_closed(i64 websocket_id, u16, ByteString, bool) override;
     virtual void websocket_ready_state_changed(i64 websocket_id, u32 ready_state) override;
     virtual void websocket_subprotocol(i64 websocket_id, ByteString subprotocol) override;
     virtual void websocket_certificate_requested(i64 websocket_id) override;
 
+    void headers_became_available(i32, HTTP::HeaderMap const&, Optional<u32>, Optional<String> const&);
+    void request_finished(i32, u64, RequestTimingInfo const&, Optional<NetworkError> const&);
+
     HashMap<i32, RefPtr<Request>> m_requests;
     HashMap<i64, NonnullRefPtr<WebSocket>> m_websockets;
 
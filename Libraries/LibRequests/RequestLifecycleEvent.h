@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Variant.h>
+#include <LibHTTP/HeaderMap.h>
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+#include <LibRequests/NetworkError.h>
+#include <LibRequests/RequestTimingInfo.h>
+
+namespace Requests {
+
+// RequestServer sends these in batches, so that pages issuing hundreds of requests don't cost hundreds of IPC
+// messages every time a few of them make progress.
+struct RequestLifecycleEvent {
+    struct HeadersReceived {
+        HTTP::HeaderMap response_headers;
+        Optional<u32> status_code;
+        Optional<String> reason_phrase;
+    };
+
+    struct Finished {
+        u64 total_size { 0 };
+        RequestTimingInfo timing_info;
+        Optional<NetworkError> network_error;
+    };
+
+    i32 request_id { 0 };
+    Variant<HeadersReceived, Finished> event;
+};
+
+}
+
+namespace IPC {
+
+template<>
+inline ErrorOr<void> encode(Encoder& encoder, Requests::RequestLifecycleEvent const& event)
+{
+    TRY(encoder.encode(event.request_id));
+    TRY(encoder.encode(event.event.has<Requests::RequestLifecycleEvent::Finished>()));
+
+    return event.event.visit(
+        [&](Requests::RequestLifecycleEvent::HeadersReceived const& headers_received) -> ErrorOr<void> {
+            TRY(encoder.encode(headers_received.response_headers));
+            TRY(encoder.encode(headers_received.status_code));
+            TRY(encoder.encode(headers_received.reason_phrase));
+            return {};
+        },
+        [&](Requests::RequestLifecycleEvent::Finished const& finished) -> ErrorOr<void> {
+            TRY(encoder.encode(finished.total_size));
+            TRY(encoder.encode(finished.timing_info));
+            TRY(encoder.encode(finished.network_error));
+            return {};
+        });
+}
+
+template<>
+inline ErrorOr<Requests::RequestLifecycleEvent> decode(Decoder& decoder)
+{
+    auto request_id = TRY(decoder.decode<i32>());
+    auto is_finished = TRY(decoder.decode<bool>());
+
+    if (is_finished) {
+        auto total_size = TRY(decoder.decode<u64>());
+        auto timing_info = TRY(decoder.decode<Requests::RequestTimingInfo>());
+        auto network_error = TRY(decoder.decode<Optional<Requests::NetworkError>>());
+        return Requests::RequestLifecycleEvent { request_id, Requests::RequestLifecycleEvent::Finished { total_size, timing_info, network_error } };
+    }
+
+    auto response_headers = TRY(decoder.decode<HTTP::HeaderMap>());
+    auto status_code = TRY(decoder.decode<Optional<u32>>());
+    auto reason_phrase = TRY(decoder.decode<Optional<String>>());
+    return Requests::RequestLifecycleEvent { request_id, Requests::RequestLifecycleEvent::HeadersReceived { move(response_headers), status_code, move(reason_phrase) } };
+}
+
+}
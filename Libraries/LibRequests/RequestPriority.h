@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+namespace Requests {
+
+// A hint for how soon the response to a request is needed. RequestServer uses this to hold back low priority requests
+// while high priority ones are in flight, and to tell the server the order in which to deliver responses.
+enum class RequestPriority {
+    High,
+    Normal,
+    Low,
+};
+
+}
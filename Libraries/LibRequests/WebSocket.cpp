@@ -56,10 +56,10 @@ void WebSocket::did_open(Badge<RequestClient>)
         on_open();
 }
 
-void WebSocket::did_receive(Badge<RequestClient>, ByteBuffer data, bool is_text)
+void WebSocket::did_receive(Badge<RequestClient>, Message message)
 {
     if (on_message)
-        on_message(WebSocket::Message { move(data), is_text });
+        on_message(move(message));
 }
 
 void WebSocket::did_error(Badge<RequestClient>, i32 error_code)
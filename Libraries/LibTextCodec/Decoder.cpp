@@ -347,10 +347,15 @@ bool Decoder::validate(StringView input)
 ErrorOr<String> Decoder::to_utf8(StringView input)
 {
     StringBuilder builder(input.length());
-    TRY(process(input, [&builder](u32 c) { return builder.try_append_code_point(c); }));
+    TRY(append_utf8(input, builder));
     return builder.to_string_without_validation();
 }
 
+ErrorOr<void> Decoder::append_utf8(StringView input, StringBuilder& builder)
+{
+    return process(input, [&builder](u32 c) { return builder.try_append_code_point(c); });
+}
+
 ErrorOr<void> UTF8Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     for (auto c : Utf8View(input)) {
@@ -369,9 +374,17 @@ ErrorOr<String> UTF8Decoder::to_utf8(StringView input)
     return String::from_utf8_with_replacement_character(input);
 }
 
+ErrorOr<void> UTF8Decoder::append_utf8(StringView input, StringBuilder& builder)
+{
+    // Valid input, which almost all input is, can be appended as it is.
+    if (Utf8View(input).validate())
+        return builder.try_append(input);
+    return builder.try_append(String::from_utf8_with_replacement_character(input, String::WithBOMHandling::No));
+}
+
 bool UTF16BEDecoder::validate(StringView input)
 {
-    return AK::validate_utf16_be(input.bytes());
+    return input.length() % 2 == 0 && AK::validate_utf16_be(input.bytes());
 }
 
 ErrorOr<String> UTF16BEDecoder::to_utf8(StringView input)
@@ -380,12 +393,17 @@ ErrorOr<String> UTF16BEDecoder::to_utf8(StringView input)
     if (auto bytes = input.bytes(); bytes.size() >= 2 && bytes[0] == 0xFE && bytes[1] == 0xFF)
         input = input.substring_view(2);
 
-    return String::from_utf16_be(input.bytes());
+    return String::from_utf16_be_with_replacement_character(input.bytes());
+}
+
+ErrorOr<void> UTF16BEDecoder::append_utf8(StringView input, StringBuilder& builder)
+{
+    return builder.try_append(TRY(String::from_utf16_be_with_replacement_character(input.bytes())));
 }
 
 bool UTF16LEDecoder::validate(StringView input)
 {
-    return AK::validate_utf16_le(input.bytes());
+    return input.length() % 2 == 0 && AK::validate_utf16_le(input.bytes());
 }
 
 ErrorOr<String> UTF16LEDecoder::to_utf8(StringView input)
@@ -394,7 +412,12 @@ ErrorOr<String> UTF16LEDecoder::to_utf8(StringView input)
     if (auto bytes = input.bytes(); bytes.size() >= 2 && bytes[0] == 0xFF && bytes[1] == 0xFE)
         input = input.substring_view(2);
 
-    return String::from_utf16_le(input.bytes());
+    return String::from_utf16_le_with_replacement_character(input.bytes());
+}
+
+ErrorOr<void> UTF16LEDecoder::append_utf8(StringView input, StringBuilder& builder)
+{
+    return builder.try_append(TRY(String::from_utf16_le_with_replacement_character(input.bytes())));
 }
 
 ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
@@ -407,6 +430,11 @@ ErrorOr<void> Latin1Decoder::process(StringView input, Function<ErrorOr<void>(u3
     return {};
 }
 
+ErrorOr<String> Latin1Decoder::to_utf8(StringView input)
+{
+    return String::from_latin1(input.bytes());
+}
+
 ErrorOr<void> PDFDocEncodingDecoder::process(StringView input, Function<ErrorOr<void>(u32)> on_code_point)
 {
     // PDF 1.7 spec, Appendix D.2 "PDFDocEncoding Character Set"
@@ -501,6 +529,25 @@ ErrorOr<void> SingleByteDecoder<ArrayType>::process(StringView input, Function<E
     return {};
 }
 
+template<Integral ArrayType>
+ErrorOr<void> SingleByteDecoder<ArrayType>::append_utf8(StringView input, StringBuilder& builder)
+{
+    auto bytes = input.bytes();
+    while (!bytes.is_empty()) {
+        // ASCII bytes decode to themselves, so runs of them are appended as they are.
+        size_t ascii_length = 0;
+        while (ascii_length < bytes.size() && bytes[ascii_length] < 0x80)
+            ++ascii_length;
+        TRY(builder.try_append(StringView { bytes.trim(ascii_length) }));
+        bytes = bytes.slice(ascii_length);
+
+        for (; !bytes.is_empty() && bytes[0] >= 0x80; bytes = bytes.slice(1))
+            TRY(builder.try_append_code_point(m_translation_table[bytes[0] - 0x80]));
+    }
+
+    return {};
+}
+
 // https://encoding.spec.whatwg.org/#index-gb18030-ranges-code-point
 static Optional<u32> index_gb18030_ranges_code_point(u32 pointer)
 {
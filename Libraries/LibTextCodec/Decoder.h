@@ -20,6 +20,10 @@ public:
     virtual bool validate(StringView);
     virtual ErrorOr<String> to_utf8(StringView);
 
+    // Decodes the input and appends it to the builder as UTF-8. This allows decoding a stream of input chunk by chunk
+    // into one buffer, without creating a String for every chunk. Unlike to_utf8(), this leaves byte order marks alone.
+    virtual ErrorOr<void> append_utf8(StringView, StringBuilder&);
+
 protected:
     virtual ~Decoder() = default;
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) = 0;
@@ -30,12 +34,14 @@ public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual bool validate(StringView) override;
     virtual ErrorOr<String> to_utf8(StringView) override;
+    virtual ErrorOr<void> append_utf8(StringView, StringBuilder&) override;
 };
 
 class UTF16BEDecoder final : public Decoder {
 public:
     virtual bool validate(StringView) override;
     virtual ErrorOr<String> to_utf8(StringView) override;
+    virtual ErrorOr<void> append_utf8(StringView, StringBuilder&) override;
 
 private:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)>) override { VERIFY_NOT_REACHED(); }
@@ -45,6 +51,7 @@ class UTF16LEDecoder final : public Decoder {
 public:
     virtual bool validate(StringView) override;
     virtual ErrorOr<String> to_utf8(StringView) override;
+    virtual ErrorOr<void> append_utf8(StringView, StringBuilder&) override;
 
 private:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)>) override { VERIFY_NOT_REACHED(); }
@@ -59,6 +66,7 @@ public:
     }
 
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
+    virtual ErrorOr<void> append_utf8(StringView, StringBuilder&) override;
 
 private:
     Array<ArrayType, 128> m_translation_table;
@@ -68,6 +76,7 @@ class Latin1Decoder final : public Decoder {
 public:
     virtual ErrorOr<void> process(StringView, Function<ErrorOr<void>(u32)> on_code_point) override;
     virtual bool validate(StringView) override { return true; }
+    virtual ErrorOr<String> to_utf8(StringView) override;
 };
 
 class PDFDocEncodingDecoder final : public Decoder {
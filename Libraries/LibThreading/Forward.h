@@ -9,6 +9,9 @@
 
 namespace Threading {
 
+class TaskGroup;
+class ThreadPool;
+
 template<typename ErrorType>
 class WorkerThread;
 
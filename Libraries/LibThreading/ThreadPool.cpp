@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/System.h>
+#include <LibThreading/ThreadPool.h>
+
+namespace Threading {
+
+struct CurrentWorker {
+    ThreadPool* pool { nullptr };
+    size_t index { 0 };
+};
+
+static thread_local CurrentWorker s_current_worker;
+
+ThreadPool& ThreadPool::the()
+{
+    static ThreadPool* s_the = new ThreadPool(max(Core::System::hardware_concurrency(), 1u));
+    return *s_the;
+}
+
+ThreadPool::ThreadPool(size_t thread_count)
+{
+    VERIFY(thread_count > 0);
+
+    m_workers.ensure_capacity(thread_count);
+    for (size_t i = 0; i < thread_count; ++i)
+        m_workers.unchecked_append(make<Worker>());
+
+    for (size_t i = 0; i < thread_count; ++i) {
+        auto& worker = *m_workers[i];
+        worker.thread = Thread::construct([this, i] { return worker_loop(i); }, ByteString::formatted("Pool Worker {}", i));
+        worker.thread->start();
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        MutexLocker locker(m_sleep_mutex);
+        m_exiting = true;
+        m_sleep_condition.broadcast();
+    }
+
+    for (auto& worker : m_workers)
+        (void)worker->thread->join();
+}
+
+void ThreadPool::submit(Task task, TaskPriority priority)
+{
+    size_t index = 0;
+    if (s_current_worker.pool == this)
+        index = s_current_worker.index;
+    else
+        index = m_next_worker.fetch_add(1, AK::MemoryOrder::memory_order_relaxed) % m_workers.size();
+
+    auto& worker = *m_workers[index];
+    {
+        MutexLocker locker(worker.mutex);
+        worker.deques[to_underlying(priority)].append(move(task));
+    }
+
+    m_queued_task_count.fetch_add(1, AK::MemoryOrder::memory_order_release);
+
+    MutexLocker locker(m_sleep_mutex);
+    m_sleep_condition.signal();
+}
+
+void ThreadPool::submit_with_completion(Task task, Function<void()> on_complete, TaskPriority priority)
+{
+    submit([task = move(task), on_complete = move(on_complete), origin_event_loop = &Core::EventLoop::current()]() mutable {
+        task();
+
+        origin_event_loop->deferred_invoke(move(on_complete));
+        origin_event_loop->wake();
+    },
+        priority);
+}
+
+bool ThreadPool::run_pending_task()
+{
+    Optional<size_t> own_index;
+    if (s_current_worker.pool == this)
+        own_index = s_current_worker.index;
+
+    auto task = take_task(own_index);
+    if (!task.has_value())
+        return false;
+
+    (*task)();
+    return true;
+}
+
+Optional<ThreadPool::Task> ThreadPool::take_task(Optional<size_t> own_index)
+{
+    if (m_queued_task_count.load(AK::MemoryOrder::memory_order_acquire) == 0)
+        return {};
+
+    for (size_t priority = 0; priority < priority_count; ++priority) {
+        if (own_index.has_value()) {
+            auto& worker = *m_workers[*own_index];
+            MutexLocker locker(worker.mutex);
+
+            if (auto& deque = worker.deques[priority]; !deque.is_empty()) {
+                m_queued_task_count.fetch_sub(1, AK::MemoryOrder::memory_order_relaxed);
+                return deque.take_last();
+            }
+        }
+
+        // Start looking at the next worker over, so that thieves spread out over their victims.
+        auto start = own_index.value_or(0) + 1;
+
+        for (size_t i = 0; i < m_workers.size(); ++i) {
+            auto index = (start + i) % m_workers.size();
+            if (own_index.has_value() && index == *own_index)
+                continue;
+
+            auto& worker = *m_workers[index];
+            MutexLocker locker(worker.mutex);
+
+            if (auto& deque = worker.deques[priority]; !deque.is_empty()) {
+                m_queued_task_count.fetch_sub(1, AK::MemoryOrder::memory_order_relaxed);
+                return deque.take_first();
+            }
+        }
+    }
+
+    return {};
+}
+
+intptr_t ThreadPool::worker_loop(size_t index)
+{
+    s_current_worker = { this, index };
+
+    while (true) {
+        if (auto task = take_task(index); task.has_value()) {
+            (*task)();
+            continue;
+        }
+
+        MutexLocker locker(m_sleep_mutex);
+        if (m_exiting)
+            break;
+        if (m_queued_task_count.load(AK::MemoryOrder::memory_order_acquire) == 0)
+            m_sleep_condition.wait();
+    }
+
+    return 0;
+}
+
+void TaskGroup::spawn(ThreadPool::Task task, TaskPriority priority)
+{
+    m_pending_task_count.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+
+    m_pool.submit([this, task = move(task)] {
+        task();
+
+        MutexLocker locker(m_mutex);
+        if (m_pending_task_count.fetch_sub(1, AK::MemoryOrder::memory_order_acq_rel) == 1)
+            m_condition.broadcast();
+    },
+        priority);
+}
+
+void TaskGroup::wait()
+{
+    while (m_pending_task_count.load(AK::MemoryOrder::memory_order_acquire) != 0) {
+        // Help out rather than block, so that waiting from within a pool task cannot starve the pool.
+        if (m_pool.run_pending_task())
+            continue;
+
+        MutexLocker locker(m_mutex);
+        if (m_pending_task_count.load(AK::MemoryOrder::memory_order_acquire) != 0)
+            m_condition.wait();
+    }
+
+    // The last task may still be holding the mutex after it has finished counting down. Make sure it
+    // has let go before the group can be destroyed.
+    MutexLocker locker(m_mutex);
+}
+
+}
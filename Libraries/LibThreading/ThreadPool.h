@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/Function.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Vector.h>
+#include <LibCore/Forward.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
+
+namespace Threading {
+
+enum class TaskPriority : u8 {
+    High,
+    Normal,
+    Low,
+};
+
+// A pool of worker threads, one per core by default, that run short CPU-bound tasks.
+//
+// Every worker owns a deque of tasks per priority. Tasks submitted from a worker go to the back of
+// that worker's own deque, and the worker runs its most recently submitted task first. Idle workers
+// steal the oldest tasks from the front of other workers' deques. Higher priority tasks are always
+// taken before lower priority ones.
+class ThreadPool {
+    AK_MAKE_NONCOPYABLE(ThreadPool);
+    AK_MAKE_NONMOVABLE(ThreadPool);
+
+public:
+    using Task = Function<void()>;
+
+    // The process-wide pool. It is created on first use and lives until the process exits.
+    static ThreadPool& the();
+
+    explicit ThreadPool(size_t thread_count);
+    ~ThreadPool();
+
+    size_t thread_count() const { return m_workers.size(); }
+
+    void submit(ESCAPING Task, TaskPriority = TaskPriority::Normal);
+
+    // Runs the task on the pool, then invokes the completion callback on the calling thread's event loop.
+    void submit_with_completion(ESCAPING Task, ESCAPING Function<void()> on_complete, TaskPriority = TaskPriority::Normal);
+
+    // Runs one queued task on the calling thread, if there is one. Returns whether a task was run.
+    bool run_pending_task();
+
+private:
+    static constexpr size_t priority_count = 3;
+
+    struct Worker {
+        Mutex mutex;
+        Array<Vector<Task>, priority_count> deques;
+        RefPtr<Thread> thread;
+    };
+
+    intptr_t worker_loop(size_t index);
+    Optional<Task> take_task(Optional<size_t> own_index);
+
+    Vector<NonnullOwnPtr<Worker>> m_workers;
+    Atomic<size_t> m_next_worker { 0 };
+    Atomic<size_t> m_queued_task_count { 0 };
+
+    Mutex m_sleep_mutex;
+    ConditionVariable m_sleep_condition { m_sleep_mutex };
+    bool m_exiting { false };
+};
+
+// Tracks a set of tasks spawned on a thread pool so that they can be joined. While waiting, the
+// calling thread runs queued tasks itself, so groups may be waited on from within pool tasks.
+class TaskGroup {
+    AK_MAKE_NONCOPYABLE(TaskGroup);
+    AK_MAKE_NONMOVABLE(TaskGroup);
+
+public:
+    explicit TaskGroup(ThreadPool& pool = ThreadPool::the())
+        : m_pool(pool)
+    {
+    }
+
+    ~TaskGroup() { wait(); }
+
+    void spawn(ESCAPING ThreadPool::Task, TaskPriority = TaskPriority::Normal);
+    void wait();
+
+private:
+    ThreadPool& m_pool;
+    Atomic<size_t> m_pending_task_count { 0 };
+    Mutex m_mutex;
+    ConditionVariable m_condition { m_mutex };
+};
+
+// Invokes the callback for every index in [begin, end), split into chunks of at least grain_size
+// indices that run in parallel on the pool. Returns once every index has been visited.
+template<typename Callback>
+void parallel_for(size_t begin, size_t end, Callback const& callback, size_t grain_size = 1, ThreadPool& pool = ThreadPool::the())
+{
+    if (begin >= end)
+        return;
+
+    auto count = end - begin;
+
+    // Use a few chunks per thread so that stealing can balance out uneven chunks.
+    auto target_chunk_count = pool.thread_count() * 4;
+    auto chunk_size = max(max(grain_size, static_cast<size_t>(1)), (count + target_chunk_count - 1) / target_chunk_count);
+
+    if (chunk_size >= count || pool.thread_count() <= 1) {
+        for (auto i = begin; i < end; ++i)
+            callback(i);
+        return;
+    }
+
+    TaskGroup group { pool };
+    for (auto chunk_begin = begin; chunk_begin < end; chunk_begin += chunk_size) {
+        auto chunk_end = min(chunk_begin + chunk_size, end);
+        group.spawn([&callback, chunk_begin, chunk_end] {
+            for (auto i = chunk_begin; i < chunk_end; ++i)
+                callback(i);
+        });
+    }
+    group.wait();
+}
+
+}
@@ -9,6 +9,7 @@
 namespace URL {
 class Host;
 class Origin;
+class ParsedURLCache;
 class Parser;
 class Site;
 class URL;
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashFunctions.h>
+#include <LibURL/ParsedURLCache.h>
+
+namespace URL {
+
+ParsedURLCache& ParsedURLCache::the()
+{
+    static thread_local ParsedURLCache cache;
+    return cache;
+}
+
+ParsedURLCache::~ParsedURLCache()
+{
+    m_entries_by_recency.clear();
+}
+
+u32 ParsedURLCache::compute_hash(StringView input, Optional<URL const&> base_url, Optional<StringView> encoding)
+{
+    auto hash = input.hash();
+    if (base_url.has_value())
+        hash = pair_int_hash(hash, ptr_hash(base_url->m_data.ptr()));
+    if (encoding.has_value())
+        hash = pair_int_hash(hash, encoding->hash());
+    return hash;
+}
+
+bool ParsedURLCache::Entry::matches(u32 other_hash, StringView other_input, Optional<URL const&> other_base_url, Optional<StringView> other_encoding) const
+{
+    if (hash != other_hash || input != other_input)
+        return false;
+    if (base_url.has_value() != other_base_url.has_value() || encoding.has_value() != other_encoding.has_value())
+        return false;
+    if (base_url.has_value() && base_url->m_data.ptr() != other_base_url->m_data.ptr())
+        return false;
+    if (encoding.has_value() && *encoding != *other_encoding)
+        return false;
+    return true;
+}
+
+Optional<URL> const* ParsedURLCache::get(StringView input, Optional<URL const&> base_url, Optional<StringView> encoding)
+{
+    auto hash = compute_hash(input, base_url, encoding);
+    auto it = m_entries.find(hash, [&](auto const& entry) { return entry->matches(hash, input, base_url, encoding); });
+    if (it == m_entries.end())
+        return nullptr;
+
+    auto& entry = **it;
+    m_entries_by_recency.prepend(entry);
+    return &entry.result;
+}
+
+void ParsedURLCache::set(StringView input, Optional<URL const&> base_url, Optional<StringView> encoding, Optional<URL> result)
+{
+    VERIFY(can_cache(input));
+
+    if (m_entries.size() >= max_number_of_entries) {
+        auto* least_recently_used = m_entries_by_recency.last();
+        m_entries_by_recency.remove(*least_recently_used);
+        auto it = m_entries.find(least_recently_used->hash, [&](auto const& entry) { return entry.ptr() == least_recently_used; });
+        VERIFY(it != m_entries.end());
+        m_entries.remove(it);
+    }
+
+    auto entry = make<Entry>();
+    entry->hash = compute_hash(input, base_url, encoding);
+    entry->input = input;
+    if (base_url.has_value())
+        entry->base_url = *base_url;
+    if (encoding.has_value())
+        entry->encoding = *encoding;
+    entry->result = move(result);
+    m_entries_by_recency.prepend(*entry);
+    m_entries.set(move(entry));
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashTable.h>
+#include <AK/IntrusiveList.h>
+#include <AK/NonnullOwnPtr.h>
+#include <LibURL/URL.h>
+
+namespace URL {
+
+// Remembers the results of recently parsed (base URL, input) pairs, so that the same URLs showing up over and over
+// (e.g. in links, stylesheets and resource requests) aren't run through the basic URL parser every time.
+// Base URLs are told apart by the identity of their data, which entries keep alive, so a base URL that is modified
+// after it was used doesn't match its old entries. Entries are evicted in least recently used order once the cache is full.
+class ParsedURLCache {
+    AK_MAKE_NONCOPYABLE(ParsedURLCache);
+    AK_MAKE_NONMOVABLE(ParsedURLCache);
+
+public:
+    static constexpr size_t max_number_of_entries = 512;
+    static constexpr size_t max_cached_input_length_in_bytes = 2048;
+
+    ParsedURLCache() = default;
+    ~ParsedURLCache();
+
+    // Each thread has its own cache, as URLs don't share their data across threads.
+    static ParsedURLCache& the();
+
+    static bool can_cache(StringView input) { return input.length() <= max_cached_input_length_in_bytes; }
+
+    // Returns null if there is no entry for the input, and otherwise the cached result, which may be failure.
+    Optional<URL> const* get(StringView input, Optional<URL const&> base_url, Optional<StringView> encoding);
+    void set(StringView input, Optional<URL const&> base_url, Optional<StringView> encoding, Optional<URL>);
+
+private:
+    struct Entry {
+        u32 hash { 0 };
+        ByteString input;
+        Optional<URL> base_url;
+        Optional<ByteString> encoding;
+        Optional<URL> result;
+
+        IntrusiveListNode<Entry> list_node;
+
+        bool matches(u32 hash, StringView input, Optional<URL const&> base_url, Optional<StringView> encoding) const;
+    };
+
+    struct EntryTraits : public DefaultTraits<NonnullOwnPtr<Entry>> {
+        static unsigned hash(NonnullOwnPtr<Entry> const& entry) { return entry->hash; }
+        static bool equals(NonnullOwnPtr<Entry> const& a, NonnullOwnPtr<Entry> const& b) { return a.ptr() == b.ptr(); }
+    };
+
+    static u32 compute_hash(StringView input, Optional<URL const&> base_url, Optional<StringView> encoding);
+
+    HashTable<NonnullOwnPtr<Entry>, EntryTraits> m_entries;
+
+    // Most recently used entries are at the front.
+    IntrusiveList<&Entry::list_node> m_entries_by_recency;
+};
+
+}
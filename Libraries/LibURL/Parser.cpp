@@ -16,6 +16,7 @@
 #include <AK/Utf8View.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibTextCodec/Encoder.h>
+#include <LibURL/ParsedURLCache.h>
 #include <LibURL/Parser.h>
 #include <LibUnicode/IDNA.h>
 
@@ -705,8 +706,136 @@ String Parser::percent_encode_after_encoding(TextCodec::Encoder& encoder, String
     return MUST(output.to_string());
 }
 
+// Parses an absolute http(s), ws(s) or ftp URL in one pass, as long as the basic URL parser would not have to change
+// anything about it other than splitting it into its components: its scheme and host are in lowercase ASCII, it has no
+// credentials, and its path, query and fragment contain nothing that would be percent-encoded or dot segments that
+// would be removed. Returns nothing for any other input, which has to go through the basic URL parser instead.
+Optional<URL> Parser::parse_canonical_special_url(StringView input)
+{
+    auto scheme_end = input.find("://"sv);
+    if (!scheme_end.has_value())
+        return {};
+    auto scheme = input.substring_view(0, *scheme_end);
+    if (!scheme.is_one_of("https"sv, "http"sv, "wss"sv, "ws"sv, "ftp"sv))
+        return {};
+
+    // The authority ends at the first U+002F (/), U+003F (?) or U+0023 (#). It must be a lowercase domain made up of
+    // non-empty labels, optionally followed by a port. Anything else, including credentials, IP addresses and labels
+    // that IDNA would have to check, is left to the host parser.
+    size_t position = *scheme_end + 3;
+    auto host_start = position;
+    bool label_is_empty = true;
+    bool label_starts_with_digit = false;
+    for (; position < input.length(); ++position) {
+        auto ch = input[position];
+        if (ch == '.') {
+            if (label_is_empty)
+                return {};
+            label_is_empty = true;
+            continue;
+        }
+        if (!is_ascii_lower_alpha(ch) && !is_ascii_digit(ch) && ch != '-')
+            break;
+        if (label_is_empty) {
+            if (input.substring_view(position).starts_with("xn--"sv))
+                return {};
+            label_starts_with_digit = is_ascii_digit(ch);
+        }
+        label_is_empty = false;
+    }
+    // NOTE: A host whose last label starts with a digit might end in a number, and would have to be parsed as an IPv4 address.
+    if (label_is_empty || label_starts_with_digit)
+        return {};
+    auto host = input.substring_view(host_start, position - host_start);
+
+    Optional<u16> port;
+    if (position < input.length() && input[position] == ':') {
+        auto port_start = ++position;
+        while (position < input.length() && is_ascii_digit(input[position]))
+            ++position;
+        if (position != port_start) {
+            auto port_number = input.substring_view(port_start, position - port_start).to_number<u16>(TrimWhitespace::No);
+            if (!port_number.has_value())
+                return {};
+            if (*port_number != default_port_for_scheme(scheme))
+                port = *port_number;
+        }
+    }
+    if (position < input.length() && !"/?#"sv.contains(input[position]))
+        return {};
+
+    URL url;
+    url.m_data->scheme = String::from_utf8_without_validation(scheme.bytes());
+    url.m_data->host = Host { String::from_utf8_without_validation(host.bytes()) };
+    url.m_data->port = port;
+
+    // A special URL always has a path, which is a single empty segment if the input has none.
+    if (position == input.length() || input[position] != '/') {
+        url.m_data->paths.append(String {});
+    } else {
+        auto segment_start = ++position;
+        for (;; ++position) {
+            if (position == input.length() || "/?#"sv.contains(input[position])) {
+                auto segment = input.substring_view(segment_start, position - segment_start);
+                if (is_single_dot_path_segment(segment) || is_double_dot_path_segment(segment))
+                    return {};
+                url.m_data->paths.append(String::from_utf8_without_validation(segment.bytes()));
+                if (position == input.length() || input[position] != '/')
+                    break;
+                segment_start = position + 1;
+                continue;
+            }
+            if (input[position] == '\\' || code_point_is_in_percent_encode_set(static_cast<u8>(input[position]), PercentEncodeSet::Path))
+                return {};
+        }
+    }
+
+    if (position < input.length() && input[position] == '?') {
+        auto query_start = ++position;
+        for (; position < input.length() && input[position] != '#'; ++position) {
+            if (code_point_is_in_percent_encode_set(static_cast<u8>(input[position]), PercentEncodeSet::SpecialQuery))
+                return {};
+        }
+        url.m_data->query = String::from_utf8_without_validation(input.substring_view(query_start, position - query_start).bytes());
+    }
+
+    if (position < input.length() && input[position] == '#') {
+        auto fragment_start = ++position;
+        for (; position < input.length(); ++position) {
+            if (code_point_is_in_percent_encode_set(static_cast<u8>(input[position]), PercentEncodeSet::Fragment))
+                return {};
+        }
+        url.m_data->fragment = String::from_utf8_without_validation(input.substring_view(fragment_start).bytes());
+    }
+
+    return url;
+}
+
 // https://url.spec.whatwg.org/#concept-basic-url-parser
 Optional<URL> Parser::basic_parse(StringView raw_input, Optional<URL const&> base_url, URL* url, Optional<State> state_override, Optional<StringView> encoding)
+{
+    // NOTE: Most URLs that pages use are already in canonical form, and the same ones tend to be parsed over and over
+    //       (e.g. by links, stylesheets and resource requests). So unless an existing URL is being modified, we first
+    //       look for a recent result, and then try to take the input apart in one pass before running the state machine.
+    if (url || state_override.has_value())
+        return run_state_machine(raw_input, base_url, url, state_override, encoding);
+
+    auto can_cache = ParsedURLCache::can_cache(raw_input);
+    if (can_cache) {
+        if (auto const* cached_result = ParsedURLCache::the().get(raw_input, base_url, encoding))
+            return *cached_result;
+    }
+
+    auto result = parse_canonical_special_url(raw_input);
+    if (!result.has_value())
+        result = run_state_machine(raw_input, base_url, url, state_override, encoding);
+
+    if (can_cache)
+        ParsedURLCache::the().set(raw_input, base_url, encoding, result);
+    return result;
+}
+
+Optional<URL> Parser::run_state_machine(StringView raw_input, Optional<URL const&> base_url, URL* url, Optional<State> state_override, Optional<StringView> encoding)
 {
     dbgln_if(URL_PARSER_DEBUG, "URL::Parser::basic_parse: Parsing '{}'", raw_input);
 
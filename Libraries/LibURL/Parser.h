@@ -65,6 +65,10 @@ public:
 
     // https://url.spec.whatwg.org/#shorten-a-urls-path
     static void shorten_urls_path(URL&);
+
+private:
+    static Optional<URL> parse_canonical_special_url(StringView input);
+    static Optional<URL> run_state_machine(StringView input, Optional<URL const&> base_url, URL* url, Optional<State> state_override, Optional<StringView> encoding);
 };
 
 #undef ENUMERATE_STATES
@@ -75,6 +75,7 @@ ByteString percent_decode(StringView input);
 // A URL is a struct that represents a universal identifier. To disambiguate from a valid URL string it can also be referred to as a URL record.
 class URL {
     friend class Parser;
+    friend class ParsedURLCache;
 
 public:
     // FIXME: We should get rid of the default constructor, all URLs should be constructed through the Parser.
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/HashMap.h>
 #include <LibUnicode/Collator.h>
 #include <LibUnicode/ICU.h>
 
@@ -161,10 +162,36 @@ static bool ignore_punctuation_for_collator(icu::Collator const& collator)
     return attribute == UCOL_SHIFTED;
 }
 
+struct CollatorCacheKey {
+    LocaleData const* locale_data { nullptr };
+    Usage usage { Usage::Sort };
+    String collation;
+    Optional<Sensitivity> sensitivity;
+    CaseFirst case_first { CaseFirst::False };
+    bool numeric { false };
+    Optional<bool> ignore_punctuation;
+
+    bool operator==(CollatorCacheKey const&) const = default;
+};
+
+struct CollatorCacheKeyTraits : public DefaultTraits<CollatorCacheKey> {
+    static unsigned hash(CollatorCacheKey const& key)
+    {
+        auto hash = pair_int_hash(ptr_hash(key.locale_data), key.collation.hash());
+        hash = pair_int_hash(hash, to_underlying(key.usage) | (to_underlying(key.case_first) << 2) | (key.numeric << 4));
+        hash = pair_int_hash(hash, key.sensitivity.has_value() ? to_underlying(*key.sensitivity) + 1 : 0);
+        return pair_int_hash(hash, key.ignore_punctuation.has_value() ? *key.ignore_punctuation + 1 : 0);
+    }
+};
+
+// Configured ICU collators are never modified after creation, so Collators created with the same locale and options
+// (e.g. by repeated calls to String.prototype.localeCompare) share one, rather than each opening and configuring their own.
+static HashMap<CollatorCacheKey, NonnullOwnPtr<icu::Collator>, CollatorCacheKeyTraits> s_collator_cache;
+
 class CollatorImpl : public Collator {
 public:
-    explicit CollatorImpl(NonnullOwnPtr<icu::Collator> collator)
-        : m_collator(move(collator))
+    explicit CollatorImpl(icu::Collator const& collator)
+        : m_collator(collator)
     {
     }
 
@@ -172,7 +199,7 @@ public:
     {
         UErrorCode status = U_ZERO_ERROR;
 
-        auto result = m_collator->compareUTF8(icu_string_piece(lhs), icu_string_piece(rhs), status);
+        auto result = m_collator.compareUTF8(icu_string_piece(lhs), icu_string_piece(rhs), status);
         VERIFY(icu_success(status));
 
         switch (result) {
@@ -189,16 +216,16 @@ public:
 
     virtual Sensitivity sensitivity() const override
     {
-        return sensitivity_for_collator(*m_collator);
+        return sensitivity_for_collator(m_collator);
     }
 
     virtual bool ignore_punctuation() const override
     {
-        return ignore_punctuation_for_collator(*m_collator);
+        return ignore_punctuation_for_collator(m_collator);
     }
 
 private:
-    NonnullOwnPtr<icu::Collator> m_collator;
+    icu::Collator const& m_collator;
 };
 
 NonnullOwnPtr<Collator> Collator::create(
@@ -210,35 +237,41 @@ NonnullOwnPtr<Collator> Collator::create(
     bool numeric,
     Optional<bool> ignore_punctuation)
 {
-    UErrorCode status = U_ZERO_ERROR;
-
     auto locale_data = LocaleData::for_locale(locale);
     VERIFY(locale_data.has_value());
 
-    auto locale_with_usage = apply_usage_to_locale(locale_data->locale(), usage, collation);
+    CollatorCacheKey key { &locale_data.value(), usage, MUST(String::from_utf8(collation)), sensitivity, case_first, numeric, ignore_punctuation };
 
-    auto collator = adopt_own(*icu::Collator::createInstance(*locale_with_usage, status));
-    VERIFY(icu_success(status));
+    auto& cached_collator = s_collator_cache.ensure(move(key), [&]() {
+        UErrorCode status = U_ZERO_ERROR;
 
-    auto set_attribute = [&](UColAttribute attribute, UColAttributeValue value) {
-        collator->setAttribute(attribute, value, status);
+        auto locale_with_usage = apply_usage_to_locale(locale_data->locale(), usage, collation);
+
+        auto collator = adopt_own(*icu::Collator::createInstance(*locale_with_usage, status));
         VERIFY(icu_success(status));
-    };
 
-    if (!sensitivity.has_value())
-        sensitivity = sensitivity_for_collator(*collator);
+        auto set_attribute = [&](UColAttribute attribute, UColAttributeValue value) {
+            collator->setAttribute(attribute, value, status);
+            VERIFY(icu_success(status));
+        };
+
+        if (!sensitivity.has_value())
+            sensitivity = sensitivity_for_collator(*collator);
+
+        if (!ignore_punctuation.has_value())
+            ignore_punctuation = ignore_punctuation_for_collator(*collator);
 
-    if (!ignore_punctuation.has_value())
-        ignore_punctuation = ignore_punctuation_for_collator(*collator);
+        set_attribute(UCOL_STRENGTH, icu_sensitivity(*sensitivity));
+        set_attribute(UCOL_CASE_LEVEL, sensitivity == Sensitivity::Case ? UCOL_ON : UCOL_OFF);
+        set_attribute(UCOL_CASE_FIRST, icu_case_first(case_first));
+        set_attribute(UCOL_NUMERIC_COLLATION, numeric ? UCOL_ON : UCOL_OFF);
+        set_attribute(UCOL_ALTERNATE_HANDLING, *ignore_punctuation ? UCOL_SHIFTED : UCOL_NON_IGNORABLE);
+        set_attribute(UCOL_NORMALIZATION_MODE, UCOL_ON);
 
-    set_attribute(UCOL_STRENGTH, icu_sensitivity(*sensitivity));
-    set_attribute(UCOL_CASE_LEVEL, sensitivity == Sensitivity::Case ? UCOL_ON : UCOL_OFF);
-    set_attribute(UCOL_CASE_FIRST, icu_case_first(case_first));
-    set_attribute(UCOL_NUMERIC_COLLATION, numeric ? UCOL_ON : UCOL_OFF);
-    set_attribute(UCOL_ALTERNATE_HANDLING, *ignore_punctuation ? UCOL_SHIFTED : UCOL_NON_IGNORABLE);
-    set_attribute(UCOL_NORMALIZATION_MODE, UCOL_ON);
+        return collator;
+    });
 
-    return adopt_own(*new CollatorImpl(move(collator)));
+    return adopt_own(*new CollatorImpl(*cached_collator));
 }
 
 }
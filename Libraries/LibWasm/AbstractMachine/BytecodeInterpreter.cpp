@@ -8,7 +8,6 @@
 #include <AK/ByteReader.h>
 #include <AK/Debug.h>
 #include <AK/Endian.h>
-#include <AK/MemoryStream.h>
 #include <AK/NumericLimits.h>
 #include <AK/SIMDExtras.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
@@ -228,6 +227,27 @@ void BytecodeInterpreter::call_address(Configuration& configuration, FunctionAdd
     TRAP_IF_NOT(m_stack_info.size_free() >= Constants::minimum_stack_space_to_keep_free);
 
     auto instance = configuration.store().get(address);
+
+    if (auto* wasm_function = instance->get_pointer<WasmFunction>()) {
+        // OPTIMIZATION: Calls between Wasm functions set up the callee's locals straight from the value stack,
+        //               and leave its results where they end up on the value stack, instead of going through
+        //               argument and result vectors like calls from the host do.
+        auto& value_stack = configuration.value_stack();
+        auto parameter_count = wasm_function->type().parameters().size();
+        auto locals = Configuration::create_locals(*wasm_function, value_stack.span().slice_from_end(parameter_count));
+        value_stack.shrink(value_stack.size() - parameter_count, true);
+
+        CallFrameHandle handle { *this, configuration };
+        configuration.enter_wasm_function(*wasm_function, move(locals));
+
+        interpret(configuration);
+        if (did_trap())
+            return;
+
+        configuration.label_stack().take_last();
+        return;
+    }
+
     FunctionType const* type { nullptr };
     instance->visit([&](auto const& function) { type = &function.type(); });
     Vector<Value> args;
@@ -238,13 +258,7 @@ void BytecodeInterpreter::call_address(Configuration& configuration, FunctionAdd
 
     configuration.value_stack().remove(configuration.value_stack().size() - span.size(), span.size());
 
-    Result result { Trap::from_string("") };
-    if (instance->has<WasmFunction>()) {
-        CallFrameHandle handle { *this, configuration };
-        result = configuration.call(*this, address, move(args));
-    } else {
-        result = configuration.call(*this, address, move(args));
-    }
+    auto result = configuration.call(*this, address, move(args));
 
     if (result.is_trap()) {
         m_trap = move(result.trap());
@@ -309,10 +323,7 @@ template<>
 struct ConvertToRaw<float> {
     u32 operator()(float value)
     {
-        ReadonlyBytes bytes { &value, sizeof(float) };
-        FixedMemoryStream stream { bytes };
-        auto res = stream.read_value<LittleEndian<u32>>().release_value_but_fixme_should_propagate_errors();
-        return static_cast<u32>(res);
+        return LittleEndian<u32>(bit_cast<u32>(value));
     }
 };
 
@@ -320,10 +331,7 @@ template<>
 struct ConvertToRaw<double> {
     u64 operator()(double value)
     {
-        ReadonlyBytes bytes { &value, sizeof(double) };
-        FixedMemoryStream stream { bytes };
-        auto res = stream.read_value<LittleEndian<u64>>().release_value_but_fixme_should_propagate_errors();
-        return static_cast<u64>(res);
+        return LittleEndian<u64>(bit_cast<u64>(value));
     }
 };
 
@@ -367,35 +375,28 @@ void BytecodeInterpreter::store_to_memory(Configuration& configuration, Instruct
 template<typename T>
 T BytecodeInterpreter::read_value(ReadonlyBytes data)
 {
-    FixedMemoryStream stream { data };
-    auto value_or_error = stream.read_value<LittleEndian<T>>();
-    if (value_or_error.is_error()) {
+    // NOTE: Callers have already bounds-checked the access against the memory, so read the value directly
+    //       instead of going through a stream.
+    if (data.size() < sizeof(T)) [[unlikely]] {
         dbgln("Read from {} failed", data.data());
         m_trap = Trap::from_string("Read from memory failed");
+        return {};
     }
-    return value_or_error.release_value();
+    T value;
+    ByteReader::load(data.data(), value);
+    return AK::convert_between_host_and_little_endian(value);
 }
 
 template<>
 float BytecodeInterpreter::read_value<float>(ReadonlyBytes data)
 {
-    FixedMemoryStream stream { data };
-    auto raw_value_or_error = stream.read_value<LittleEndian<u32>>();
-    if (raw_value_or_error.is_error())
-        m_trap = Trap::from_string("Read from memory failed");
-    auto raw_value = raw_value_or_error.release_value();
-    return bit_cast<float>(static_cast<u32>(raw_value));
+    return bit_cast<float>(read_value<u32>(data));
 }
 
 template<>
 double BytecodeInterpreter::read_value<double>(ReadonlyBytes data)
 {
-    FixedMemoryStream stream { data };
-    auto raw_value_or_error = stream.read_value<LittleEndian<u64>>();
-    if (raw_value_or_error.is_error())
-        m_trap = Trap::from_string("Read from memory failed");
-    auto raw_value = raw_value_or_error.release_value();
-    return bit_cast<double>(static_cast<u64>(raw_value));
+    return bit_cast<double>(read_value<u64>(data));
 }
 
 ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& configuration, InstructionPointer& ip, Instruction const& instruction)
@@ -408,9 +409,32 @@ ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& con
         return;
     case Instructions::nop.value():
         return;
-    case Instructions::local_get.value():
-        configuration.value_stack().append(Value(configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()]));
+    case Instructions::local_get.value(): {
+        auto& locals = configuration.frame().locals();
+        auto& lhs = locals[instruction.arguments().get<LocalIndex>().value()];
+
+        // OPTIMIZATION: `local.get; local.get; i32.add` and `local.get; i32.const; i32.add` make up much of the
+        //               address arithmetic in compiled code, so evaluate them in one go instead of pushing both
+        //               operands onto the value stack only to pop them again right away.
+        auto& instructions = configuration.frame().expression().instructions();
+        if (ip.value() + 2 < instructions.size() && instructions[ip.value() + 2].opcode() == Instructions::i32_add) {
+            auto& rhs_instruction = instructions[ip.value() + 1];
+            Optional<u32> rhs;
+            if (rhs_instruction.opcode() == Instructions::local_get)
+                rhs = locals[rhs_instruction.arguments().get<LocalIndex>().value()].to<u32>();
+            else if (rhs_instruction.opcode() == Instructions::i32_const)
+                rhs = bit_cast<u32>(rhs_instruction.arguments().get<i32>());
+
+            if (rhs.has_value()) {
+                configuration.value_stack().append(Value(bit_cast<i32>(lhs.to<u32>() + *rhs)));
+                ip = ip.value() + 3;
+                return;
+            }
+        }
+
+        configuration.value_stack().append(Value(lhs));
         return;
+    }
     case Instructions::local_set.value(): {
         auto value = configuration.value_stack().take_last();
         configuration.frame().locals()[instruction.arguments().get<LocalIndex>().value()] = value;
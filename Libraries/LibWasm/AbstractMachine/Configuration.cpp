@@ -24,20 +24,10 @@ Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Ve
     if (!function)
         return Trap::from_string("Attempt to call nonexistent function by address");
     if (auto* wasm_function = function->get_pointer<WasmFunction>()) {
-        Vector<Value> locals = move(arguments);
-        locals.ensure_capacity(locals.size() + wasm_function->code().func().locals().size());
-        for (auto& local : wasm_function->code().func().locals()) {
-            for (size_t i = 0; i < local.n(); ++i)
-                locals.append(Value(local.type()));
-        }
-
-        set_frame(Frame {
-            wasm_function->module(),
-            move(locals),
-            wasm_function->code().func().body(),
-            wasm_function->type().results().size(),
-        });
-        m_ip = 0;
+        // The arguments make up the first locals, so extend the vector we were given instead of copying it.
+        arguments.ensure_capacity(arguments.size() + declared_locals_count(*wasm_function));
+        append_declared_locals(*wasm_function, arguments);
+        enter_wasm_function(*wasm_function, move(arguments));
         return execute(interpreter);
     }
 
@@ -46,6 +36,42 @@ Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Ve
     return host_function.function()(*this, arguments);
 }
 
+size_t Configuration::declared_locals_count(WasmFunction const& function)
+{
+    size_t count = 0;
+    for (auto& local : function.code().func().locals())
+        count += local.n();
+    return count;
+}
+
+void Configuration::append_declared_locals(WasmFunction const& function, Vector<Value>& locals)
+{
+    for (auto& local : function.code().func().locals()) {
+        for (size_t i = 0; i < local.n(); ++i)
+            locals.unchecked_append(Value(local.type()));
+    }
+}
+
+Vector<Value> Configuration::create_locals(WasmFunction const& function, ReadonlySpan<Value> arguments)
+{
+    Vector<Value> locals;
+    locals.ensure_capacity(arguments.size() + declared_locals_count(function));
+    locals.unchecked_append(arguments.data(), arguments.size());
+    append_declared_locals(function, locals);
+    return locals;
+}
+
+void Configuration::enter_wasm_function(WasmFunction const& function, Vector<Value> locals)
+{
+    set_frame(Frame {
+        function.module(),
+        move(locals),
+        function.code().func().body(),
+        function.type().results().size(),
+    });
+    m_ip = 0;
+}
+
 Result Configuration::execute(Interpreter& interpreter)
 {
     interpreter.interpret(*this);
@@ -56,6 +56,8 @@ public:
 
     void unwind(Badge<CallFrameHandle>, CallFrameHandle const&);
     Result call(Interpreter&, FunctionAddress, Vector<Value> arguments);
+    static Vector<Value> create_locals(WasmFunction const&, ReadonlySpan<Value> arguments);
+    void enter_wasm_function(WasmFunction const&, Vector<Value> locals);
     Result execute(Interpreter&);
 
     void enable_instruction_count_limit() { m_should_limit_instruction_count = true; }
@@ -64,6 +66,9 @@ public:
     void dump_stack();
 
 private:
+    static size_t declared_locals_count(WasmFunction const&);
+    static void append_declared_locals(WasmFunction const&, Vector<Value>& locals);
+
     Store& m_store;
     Vector<Value> m_value_stack;
     Vector<Label> m_label_stack;
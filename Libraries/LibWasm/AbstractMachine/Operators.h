@@ -689,6 +689,12 @@ template<size_t VectorSize, typename Op, template<typename> typename SetSign = M
 struct VectorIntegerBinaryOp {
     auto operator()(u128 lhs, u128 rhs) const
     {
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply>) {
+            // These map directly onto the native vector operators. Use unsigned lanes so that overflow wraps like Wasm expects.
+            using UnsignedVectorType = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
+            return bit_cast<u128>(Op {}(bit_cast<UnsignedVectorType>(lhs), bit_cast<UnsignedVectorType>(rhs)));
+        }
+
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
@@ -834,6 +840,13 @@ struct VectorFloatBinaryOp {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
+
+        // These map directly onto the native vector operators.
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply>)
+            return bit_cast<u128>(Op {}(first, second));
+        else if constexpr (IsSame<Op, Divide>)
+            return bit_cast<u128>(first / second);
+
         VectorType result;
         Op op;
         for (size_t i = 0; i < VectorSize; ++i) {
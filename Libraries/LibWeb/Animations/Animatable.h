@@ -47,6 +47,12 @@ public:
 
     void associate_with_animation(GC::Ref<Animation>);
     void disassociate_with_animation(GC::Ref<Animation>);
+    ReadonlySpan<GC::Ref<Animation>> associated_animations() const
+    {
+        if (!m_impl)
+            return {};
+        return m_impl->associated_animations;
+    }
 
     GC::Ptr<CSS::CSSStyleDeclaration const> cached_animation_name_source(Optional<CSS::PseudoElement>) const;
     void set_cached_animation_name_source(GC::Ptr<CSS::CSSStyleDeclaration const> value, Optional<CSS::PseudoElement>);
@@ -917,6 +917,27 @@ static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation(H
     return invalidation;
 }
 
+// Opacity and transforms of compositor layers are applied when playing back the display list.
+static bool only_compositor_layer_properties_changed(HashMap<CSS::PropertyID, NonnullRefPtr<CSS::CSSStyleValue const>> const& old_properties, HashMap<CSS::PropertyID, NonnullRefPtr<CSS::CSSStyleValue const>> const& new_properties)
+{
+    auto is_compositor_layer_property = [](CSS::PropertyID property_id) {
+        return first_is_one_of(property_id, CSS::PropertyID::Opacity, CSS::PropertyID::Transform, CSS::PropertyID::Rotate, CSS::PropertyID::Scale, CSS::PropertyID::Translate);
+    };
+
+    for (auto const& [property_id, new_value] : new_properties) {
+        if (is_compositor_layer_property(property_id))
+            continue;
+        auto old_value = old_properties.get(property_id);
+        if (!old_value.has_value() || *old_value.value() != *new_value)
+            return false;
+    }
+    for (auto const& [property_id, _] : old_properties) {
+        if (!is_compositor_layer_property(property_id) && !new_properties.contains(property_id))
+            return false;
+    }
+    return true;
+}
+
 void KeyframeEffect::update_computed_properties()
 {
     auto target = this->target();
@@ -954,6 +975,8 @@ void KeyframeEffect::update_computed_properties()
         auto element_invalidation = element.recompute_inherited_style();
         if (element_invalidation.is_none())
             return TraversalDecision::SkipChildrenAndContinue;
+        if (auto* paintable = element.paintable())
+            paintable->invalidate_cached_stacking_context_commands();
         invalidation |= element_invalidation;
         return TraversalDecision::Continue;
     });
@@ -980,7 +1003,22 @@ void KeyframeEffect::update_computed_properties()
         }
     }
     if (invalidation.repaint) {
-        document.set_needs_display();
+        // OPTIMIZATION: If only the opacity or transform of a compositor layer changed, the display list we already
+        //               have stays valid, and the new values are picked up when it's played back.
+        auto const* paintable_box = !pseudo_element_type().has_value() ? target->paintable_box() : nullptr;
+        bool can_update_compositor_layer = !invalidation.relayout
+            && !invalidation.rebuild_layout_tree
+            && !invalidation.rebuild_stacking_context_tree
+            && paintable_box
+            && document.is_compositor_layer(*paintable_box)
+            && only_compositor_layer_properties_changed(animated_properties_before_update, style->animated_property_values());
+
+        if (can_update_compositor_layer)
+            document.set_needs_display(InvalidateDisplayList::No);
+        else if (paintable_box)
+            target->paintable_box()->set_needs_display();
+        else
+            document.set_needs_display();
         document.set_needs_to_resolve_paint_only_properties();
     }
     if (invalidation.rebuild_stacking_context_tree)
@@ -32,6 +32,11 @@ namespace Web::CSS {
 
 GC_DEFINE_ALLOCATOR(CSSStyleProperties);
 
+struct CSSStyleProperties::UnparsedDeclarations {
+    Parser::ParsingParams parsing_params;
+    Vector<Parser::Declaration> declarations;
+};
+
 GC::Ref<CSSStyleProperties> CSSStyleProperties::create(JS::Realm& realm, Vector<StyleProperty> properties, HashMap<FlyString, StyleProperty> custom_properties)
 {
     // https://drafts.csswg.org/cssom/#dom-cssstylerule-style
@@ -44,6 +49,14 @@ GC::Ref<CSSStyleProperties> CSSStyleProperties::create(JS::Realm& realm, Vector<
     return realm.create<CSSStyleProperties>(realm, Computed::No, Readonly::No, move(properties), move(custom_properties), OptionalNone {});
 }
 
+GC::Ref<CSSStyleProperties> CSSStyleProperties::create_with_unparsed_declarations(JS::Realm& realm, Parser::ParsingParams const& parsing_params, Vector<Parser::Declaration> declarations)
+{
+    auto style = create(realm, {}, {});
+    if (!declarations.is_empty())
+        style->m_unparsed_declarations = adopt_own(*new UnparsedDeclarations { parsing_params, move(declarations) });
+    return style;
+}
+
 GC::Ref<CSSStyleProperties> CSSStyleProperties::create_resolved_style(DOM::ElementReference element_reference)
 {
     // https://drafts.csswg.org/cssom/#dom-window-getcomputedstyle
@@ -75,6 +88,8 @@ CSSStyleProperties::CSSStyleProperties(JS::Realm& realm, Computed computed, Read
     set_owner_node(move(owner_node));
 }
 
+CSSStyleProperties::~CSSStyleProperties() = default;
+
 void CSSStyleProperties::initialize(JS::Realm& realm)
 {
     WEB_SET_PROTOTYPE_FOR_INTERFACE(CSSStyleProperties);
@@ -87,6 +102,19 @@ void CSSStyleProperties::visit_edges(Visitor& visitor)
     for (auto& property : m_properties) {
         property.value->visit_edges(visitor);
     }
+    if (m_unparsed_declarations) {
+        visitor.visit(m_unparsed_declarations->parsing_params.realm);
+        visitor.visit(m_unparsed_declarations->parsing_params.document);
+    }
+}
+
+void CSSStyleProperties::parse_unparsed_declarations() const
+{
+    // NB: Take the declarations out first, so that nothing parsed below sees them as still pending.
+    auto unparsed_declarations = m_unparsed_declarations.release_nonnull();
+    auto style = Parser::Parser::convert_to_properties(unparsed_declarations->parsing_params, unparsed_declarations->declarations);
+    m_properties = move(style.properties);
+    m_custom_properties = move(style.custom_properties);
 }
 
 // https://drafts.csswg.org/cssom/#dom-cssstyledeclaration-length
@@ -98,6 +126,7 @@ size_t CSSStyleProperties::length() const
     if (is_computed())
         return to_underlying(last_longhand_property_id) - to_underlying(first_longhand_property_id) + 1;
 
+    ensure_declarations_are_parsed();
     return m_properties.size();
 }
 
@@ -171,6 +200,7 @@ Optional<StyleProperty> CSSStyleProperties::property(PropertyID property_id) con
         };
     }
 
+    ensure_declarations_are_parsed();
     for (auto& property : m_properties) {
         if (property.property_id == property_id)
             return property;
@@ -197,6 +227,7 @@ Optional<StyleProperty const&> CSSStyleProperties::custom_property(FlyString con
         return {};
     }
 
+    ensure_declarations_are_parsed();
     return m_custom_properties.get(custom_property_name);
 }
 
@@ -259,6 +290,7 @@ WebIDL::ExceptionOr<void> CSSStyleProperties::set_property(StringView property_n
                 .value = component_value_list.release_nonnull(),
                 .custom_name = custom_name,
             };
+            ensure_declarations_are_parsed();
             m_custom_properties.set(custom_name, style_property);
             updated = true;
         } else {
@@ -1045,6 +1077,7 @@ WebIDL::ExceptionOr<String> CSSStyleProperties::remove_property(StringView prope
     //           2. Remove that CSS declaration and let removed be true.
 
     // 6. Otherwise, if property is a case-sensitive match for a property name of a CSS declaration in the declarations, remove that CSS declaration and let removed be true.
+    ensure_declarations_are_parsed();
     if (property_id == PropertyID::Custom) {
         auto custom_name = FlyString::from_utf8_without_validation(property_name.bytes());
         removed = m_custom_properties.remove(custom_name);
@@ -1086,6 +1119,8 @@ WebIDL::ExceptionOr<void> CSSStyleProperties::set_css_float(StringView value)
 // https://www.w3.org/TR/cssom/#serialize-a-css-declaration-block
 String CSSStyleProperties::serialized() const
 {
+    ensure_declarations_are_parsed();
+
     // 1. Let list be an empty array.
     Vector<String> list;
 
@@ -1193,6 +1228,7 @@ bool CSSStyleProperties::set_a_css_declaration(PropertyID property_id, NonnullRe
 
     // FIXME: Handle logical property groups.
 
+    ensure_declarations_are_parsed();
     for (auto& property : m_properties) {
         if (property.property_id == property_id) {
             if (property.important == important && *property.value == *value)
@@ -1215,12 +1251,14 @@ void CSSStyleProperties::empty_the_declarations()
 {
     m_properties.clear();
     m_custom_properties.clear();
+    m_unparsed_declarations = nullptr;
 }
 
 void CSSStyleProperties::set_the_declarations(Vector<StyleProperty> properties, HashMap<FlyString, StyleProperty> custom_properties)
 {
     m_properties = move(properties);
     m_custom_properties = move(custom_properties);
+    m_unparsed_declarations = nullptr;
 }
 
 void CSSStyleProperties::set_declarations_from_text(StringView css_text)
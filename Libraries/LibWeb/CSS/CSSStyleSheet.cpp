@@ -157,7 +157,10 @@ WebIDL::ExceptionOr<unsigned> CSSStyleSheet::insert_rule(StringView rule, unsign
         // NOTE: The spec doesn't say where to set the parent style sheet, so we'll do it here.
         parsed_rule->set_parent_style_sheet(this);
 
-        invalidate_owners(DOM::StyleInvalidationReason::StyleSheetInsertRule);
+        if (result.value() == m_rules->length() - 1)
+            invalidate_owners_after_appending_rule(*parsed_rule);
+        else
+            invalidate_owners(DOM::StyleInvalidationReason::StyleSheetInsertRule);
     }
 
     return result;
@@ -336,6 +339,19 @@ void CSSStyleSheet::invalidate_owners(DOM::StyleInvalidationReason reason)
     }
 }
 
+// OPTIMIZATION: Scripts often build up a style sheet one rule at a time by appending to it. Where possible, we add the
+//               new rule to the owners' existing rule caches instead of making them rebuild the caches from scratch.
+void CSSStyleSheet::invalidate_owners_after_appending_rule(CSSRule const& rule)
+{
+    m_did_match = {};
+    for (auto& document_or_shadow_root : m_owning_documents_or_shadow_roots) {
+        document_or_shadow_root->invalidate_style(DOM::StyleInvalidationReason::StyleSheetInsertRule);
+        auto& style_computer = document_or_shadow_root->document().style_computer();
+        if (!style_computer.add_rule_appended_to_style_sheet_to_rule_cache(*this, rule))
+            style_computer.invalidate_rule_cache();
+    }
+}
+
 GC::Ptr<DOM::Document> CSSStyleSheet::owning_document() const
 {
     if (!m_owning_documents_or_shadow_roots.is_empty())
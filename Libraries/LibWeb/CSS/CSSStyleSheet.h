@@ -68,6 +68,7 @@ public:
     void add_owning_document_or_shadow_root(DOM::Node& document_or_shadow_root);
     void remove_owning_document_or_shadow_root(DOM::Node& document_or_shadow_root);
     void invalidate_owners(DOM::StyleInvalidationReason);
+    void invalidate_owners_after_appending_rule(CSSRule const&);
     GC::Ptr<DOM::Document> owning_document() const;
 
     Optional<FlyString> default_namespace() const;
@@ -393,7 +393,9 @@ public:
 
     bool operator==(CSSStyleValue const& other) const
     {
-        return this->equals(other);
+        // OPTIMIZATION: Computed styles share values with their parent (when inherited) and with each other (when
+        //               initial), so identical values are very often the same object.
+        return this == &other || this->equals(other);
     }
 
 protected:
@@ -124,9 +124,14 @@ GC::Ref<CSS::CSSStyleSheet> Parser::parse_as_css_stylesheet(Optional<::URL::URL>
     // To parse a CSS stylesheet, first parse a stylesheet.
     auto const& style_sheet = parse_a_stylesheet(m_token_stream, location);
 
+    return convert_to_style_sheet(style_sheet.rules, move(location), move(media_query_list));
+}
+
+GC::Ref<CSS::CSSStyleSheet> Parser::convert_to_style_sheet(Vector<Rule> const& raw_rules, Optional<::URL::URL> location, Vector<NonnullRefPtr<MediaQuery>> media_query_list)
+{
     // Interpret all of the resulting top-level qualified rules as style rules, defined below.
     GC::RootVector<GC::Ref<CSSRule>> rules(realm().heap());
-    for (auto const& raw_rule : style_sheet.rules) {
+    for (auto const& raw_rule : raw_rules) {
         auto rule = convert_to_rule(raw_rule, Nested::No);
         // If any style rule is invalid, or any at-rule is not recognized or is invalid according to its grammar or context, it’s a parse error.
         // Discard that rule.
@@ -142,6 +147,63 @@ GC::Ref<CSS::CSSStyleSheet> Parser::parse_as_css_stylesheet(Optional<::URL::URL>
     return CSSStyleSheet::create(realm(), rule_list, media_list, move(location));
 }
 
+struct SharedParsedStyleSheet : public RefCounted<SharedParsedStyleSheet> {
+    SharedParsedStyleSheet(String source_text, Vector<Rule> rules)
+        : source_text(move(source_text))
+        , rules(move(rules))
+    {
+    }
+
+    String source_text;
+    Vector<Rule> rules;
+};
+
+// NOTE: Below this size, tokenizing and parsing again is cheap enough that holding on to the rules isn't worth it.
+static constexpr size_t minimum_length_of_shared_style_sheet = 16 * KiB;
+static constexpr size_t max_number_of_shared_style_sheets = 8;
+
+// Most recently used last.
+static Vector<NonnullRefPtr<SharedParsedStyleSheet>>& shared_parsed_style_sheets()
+{
+    static Vector<NonnullRefPtr<SharedParsedStyleSheet>> style_sheets;
+    return style_sheets;
+}
+
+GC::Ref<CSS::CSSStyleSheet> Parser::parse_css_stylesheet_with_shared_rules(ParsingParams const& context, StringView input, Optional<::URL::URL> location, Vector<NonnullRefPtr<MediaQuery>> media_query_list)
+{
+    if (input.length() < minimum_length_of_shared_style_sheet) {
+        auto style_sheet = create(context, input).parse_as_css_stylesheet(move(location), move(media_query_list));
+        style_sheet->set_source_text(MUST(String::from_utf8(input)));
+        return style_sheet;
+    }
+
+    // NOTE: The generic rules only depend on the source text, not on the document or the location, since resolving
+    //       URLs and interpreting rules happens when converting them to CSSOM rules below.
+    auto& shared_style_sheets = shared_parsed_style_sheets();
+    RefPtr<SharedParsedStyleSheet> shared_style_sheet;
+    for (size_t i = 0; i < shared_style_sheets.size(); ++i) {
+        if (shared_style_sheets[i]->source_text.bytes_as_string_view() == input) {
+            shared_style_sheet = shared_style_sheets.take(i);
+            break;
+        }
+    }
+
+    if (!shared_style_sheet) {
+        auto parser = create(context, input);
+        auto parsed_style_sheet = parser.parse_a_stylesheet(parser.m_token_stream, {});
+        shared_style_sheet = adopt_ref(*new SharedParsedStyleSheet(MUST(String::from_utf8(input)), move(parsed_style_sheet.rules)));
+        if (shared_style_sheets.size() >= max_number_of_shared_style_sheets)
+            shared_style_sheets.take_first();
+    }
+    shared_style_sheets.append(*shared_style_sheet);
+
+    // NOTE: Converting the rules doesn't need any tokens.
+    Parser parser { context, {} };
+    auto style_sheet = parser.convert_to_style_sheet(shared_style_sheet->rules, move(location), move(media_query_list));
+    style_sheet->set_source_text(shared_style_sheet->source_text);
+    return style_sheet;
+}
+
 RefPtr<Supports> Parser::parse_as_supports()
 {
     return parse_a_supports(m_token_stream);
@@ -1553,6 +1615,24 @@ GC::Ref<CSSStyleProperties> Parser::convert_to_style_declaration(Vector<Declarat
     return CSSStyleProperties::create(realm(), move(properties.properties), move(properties.custom_properties));
 }
 
+Parser::PropertiesAndCustomProperties Parser::convert_to_properties(ParsingParams const& context, Vector<Declaration> const& declarations)
+{
+    Parser parser { context, {} };
+    PropertiesAndCustomProperties properties;
+    for (auto const& declaration : declarations)
+        parser.extract_property(declaration, properties);
+    return properties;
+}
+
+ParsingParams Parser::parsing_params() const
+{
+    ParsingParams context { m_parsing_mode };
+    context.realm = m_realm;
+    context.document = m_document;
+    context.rule_context = m_rule_context;
+    return context;
+}
+
 Optional<StyleProperty> Parser::convert_to_style_property(Declaration const& declaration)
 {
     auto const& property_name = declaration.name;
@@ -92,11 +92,17 @@ public:
 
     GC::Ref<CSS::CSSStyleSheet> parse_as_css_stylesheet(Optional<::URL::URL> location, Vector<NonnullRefPtr<MediaQuery>> media_query_list = {});
 
+    // Parses a whole style sheet and sets its source text. The generic rules of large style sheets are kept in a cache
+    // shared by all documents, so that loading the same style sheet again skips tokenizing and parsing it.
+    static GC::Ref<CSS::CSSStyleSheet> parse_css_stylesheet_with_shared_rules(ParsingParams const&, StringView input, Optional<::URL::URL> location, Vector<NonnullRefPtr<MediaQuery>> media_query_list = {});
+
     struct PropertiesAndCustomProperties {
         Vector<StyleProperty> properties;
         HashMap<FlyString, StyleProperty> custom_properties;
     };
     PropertiesAndCustomProperties parse_as_property_declaration_block();
+    // Converts declarations that were consumed earlier into style properties, as if they were part of the rule being parsed.
+    static PropertiesAndCustomProperties convert_to_properties(ParsingParams const&, Vector<Declaration> const&);
     Vector<Descriptor> parse_as_descriptor_declaration_block(AtRuleID);
     CSSRule* parse_as_css_rule();
     Optional<StyleProperty> parse_as_supports_condition();
@@ -149,6 +155,7 @@ private:
     };
     template<typename T>
     ParsedStyleSheet parse_a_stylesheet(TokenStream<T>&, Optional<::URL::URL> location);
+    GC::Ref<CSS::CSSStyleSheet> convert_to_style_sheet(Vector<Rule> const&, Optional<::URL::URL> location, Vector<NonnullRefPtr<MediaQuery>> media_query_list);
 
     // "Parse a stylesheet’s contents" is intended for use by the CSSStyleSheet replace() method, and similar, which parse text into the contents of an existing stylesheet.
     template<typename T>
@@ -247,6 +254,7 @@ private:
     GC::Ptr<CSSPropertyRule> convert_to_property_rule(AtRule const& rule);
 
     GC::Ref<CSSStyleProperties> convert_to_style_declaration(Vector<Declaration> const&);
+    ParsingParams parsing_params() const;
     Optional<StyleProperty> convert_to_style_property(Declaration const&);
 
     Optional<Descriptor> convert_to_descriptor(AtRuleID, Declaration const&);
@@ -566,8 +566,27 @@ FlyString Tokenizer::consume_an_ident_sequence()
     // If that is the intended use, ensure that the stream starts with an ident sequence before
     // calling this algorithm.
 
+    // OPTIMIZATION: Most ident sequences are plain ASCII without any escapes. Find the end of such a run by looking at
+    //               the bytes directly, and if it's the whole ident sequence, make the result straight from the input.
+    auto const* bytes = m_utf8_view.bytes();
+    auto byte_length = m_utf8_view.byte_length();
+    auto start_byte_offset = current_byte_offset();
+    auto end_byte_offset = start_byte_offset;
+    while (end_byte_offset < byte_length && is_ascii(bytes[end_byte_offset]) && is_ident_code_point(bytes[end_byte_offset]))
+        ++end_byte_offset;
+    ReadonlyBytes ascii_prefix { bytes + start_byte_offset, end_byte_offset - start_byte_offset };
+    skip_to_byte_offset(end_byte_offset);
+
+    if (end_byte_offset == byte_length || (is_ascii(bytes[end_byte_offset]) && bytes[end_byte_offset] != '\\')) {
+        // NOTE: This leaves us in the same state as reconsuming the code point after the ident sequence below.
+        m_prev_utf8_iterator = m_utf8_iterator;
+        m_prev_position = m_position;
+        return FlyString::from_utf8_without_validation(ascii_prefix);
+    }
+
     // Let result initially be an empty string.
     StringBuilder result;
+    result.append(ascii_prefix);
 
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
@@ -740,9 +759,13 @@ void Tokenizer::consume_the_remnants_of_a_bad_url()
 
 void Tokenizer::consume_as_much_whitespace_as_possible()
 {
-    while (is_whitespace(peek_code_point())) {
-        (void)next_code_point();
-    }
+    // OPTIMIZATION: Whitespace is always ASCII, so we can find the end of it by looking at the bytes directly.
+    auto const* bytes = m_utf8_view.bytes();
+    auto byte_length = m_utf8_view.byte_length();
+    auto byte_offset = current_byte_offset();
+    while (byte_offset < byte_length && is_whitespace(bytes[byte_offset]))
+        ++byte_offset;
+    skip_to_byte_offset(byte_offset);
 }
 
 void Tokenizer::reconsume_current_input_code_point()
@@ -929,8 +952,22 @@ Token Tokenizer::consume_string_token(u32 ending_code_point)
         return token;
     };
 
+    auto const* bytes = m_utf8_view.bytes();
+    auto byte_length = m_utf8_view.byte_length();
+
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
+        // OPTIMIZATION: Everything up to the next ending code point, newline or reverse solidus (all of which are ASCII)
+        //               goes into the string as-is, so we can append it in one go instead of code point by code point.
+        auto run_start_byte_offset = current_byte_offset();
+        auto run_end_byte_offset = run_start_byte_offset;
+        while (run_end_byte_offset < byte_length && bytes[run_end_byte_offset] != ending_code_point && !is_newline(bytes[run_end_byte_offset]) && !is_reverse_solidus(bytes[run_end_byte_offset]))
+            ++run_end_byte_offset;
+        if (run_end_byte_offset != run_start_byte_offset) {
+            builder.append(StringView { bytes + run_start_byte_offset, run_end_byte_offset - run_start_byte_offset });
+            skip_to_byte_offset(run_end_byte_offset);
+        }
+
         auto input = next_code_point();
 
         // ending code point
@@ -1001,21 +1038,18 @@ start:
     (void)next_code_point();
     (void)next_code_point();
 
-    for (;;) {
-        auto twin_inner = peek_twin();
-        if (is_eof(twin_inner.first) || is_eof(twin_inner.second)) {
-            log_parse_error();
-            return;
-        }
-
-        if (is_asterisk(twin_inner.first) && is_solidus(twin_inner.second)) {
-            (void)next_code_point();
-            (void)next_code_point();
-            goto start;
-        }
-
-        (void)next_code_point();
+    // OPTIMIZATION: Find the end of the comment with a substring search, instead of decoding every code point in it.
+    auto byte_offset = current_byte_offset();
+    StringView remaining_input { m_utf8_view.bytes() + byte_offset, m_utf8_view.byte_length() - byte_offset };
+    auto end_of_comment = remaining_input.find("*/"sv);
+    if (!end_of_comment.has_value()) {
+        skip_to_byte_offset(m_utf8_view.byte_length());
+        log_parse_error();
+        return;
     }
+
+    skip_to_byte_offset(byte_offset + end_of_comment.value() + 2);
+    goto start;
 }
 
 // https://www.w3.org/TR/css-syntax-3/#consume-token
@@ -1325,4 +1359,33 @@ String Tokenizer::input_since(size_t offset) const
     return MUST(m_decoded_input.substring_from_byte_offset_with_shared_superstring(offset, current_byte_offset() - offset));
 }
 
+// Moves forward to the given byte offset, which must be at a code point boundary, as if we had consumed every code point
+// up to it. This lets fast paths that scan the input bytes directly skip over them without decoding each code point.
+void Tokenizer::skip_to_byte_offset(size_t byte_offset)
+{
+    auto const* bytes = m_utf8_view.bytes();
+    auto current_offset = current_byte_offset();
+    VERIFY(byte_offset >= current_offset && byte_offset <= m_utf8_view.byte_length());
+    if (byte_offset == current_offset)
+        return;
+
+    auto last_code_point_offset = current_offset;
+    for (auto offset = current_offset; offset < byte_offset; ++offset) {
+        // Skip UTF-8 continuation bytes, we only care about where code points start.
+        if ((bytes[offset] & 0xC0) == 0x80)
+            continue;
+        last_code_point_offset = offset;
+        m_prev_position = m_position;
+        if (is_newline(bytes[offset])) {
+            m_position.line++;
+            m_position.column = 0;
+        } else {
+            m_position.column++;
+        }
+    }
+
+    m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(last_code_point_offset);
+    m_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(byte_offset);
+}
+
 }
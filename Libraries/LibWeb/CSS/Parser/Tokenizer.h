@@ -70,6 +70,7 @@ private:
 
     size_t current_byte_offset() const;
     String input_since(size_t offset) const;
+    void skip_to_byte_offset(size_t);
 
     [[nodiscard]] u32 next_code_point();
     [[nodiscard]] u32 peek_code_point(size_t offset = 0) const;
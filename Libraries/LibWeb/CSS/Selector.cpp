@@ -38,7 +38,9 @@ static bool can_selector_use_fast_matches(CSS::Selector const& selector)
     for (auto const& compound_selector : selector.compound_selectors()) {
         if (compound_selector.combinator != CSS::Selector::Combinator::None
             && compound_selector.combinator != CSS::Selector::Combinator::Descendant
-            && compound_selector.combinator != CSS::Selector::Combinator::ImmediateChild) {
+            && compound_selector.combinator != CSS::Selector::Combinator::ImmediateChild
+            && compound_selector.combinator != CSS::Selector::Combinator::NextSibling
+            && compound_selector.combinator != CSS::Selector::Combinator::SubsequentSibling) {
             return false;
         }
 
@@ -1168,6 +1168,38 @@ bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_
                 return false;
             }
             break;
+        case CSS::Selector::Combinator::NextSibling:
+        case CSS::Selector::Combinator::SubsequentSibling: {
+            if (context.collect_per_element_selector_involvement_metadata) {
+                auto& mutable_current = const_cast<DOM::Element&>(*current);
+                if (compound_selector->combinator == CSS::Selector::Combinator::NextSibling) {
+                    mutable_current.set_affected_by_direct_sibling_combinator(true);
+                    mutable_current.set_sibling_invalidation_distance(max(selector.sibling_invalidation_distance(), current->sibling_invalidation_distance()));
+                } else {
+                    mutable_current.set_affected_by_indirect_sibling_combinator(true);
+                }
+            }
+
+            // NOTE: Sibling combinators leave the ancestor chain, so we can't backtrack through them with the state
+            //       above. Instead, we let the generic matcher exhaustively match everything to the left of this
+            //       combinator. If that fails, we may still backtrack to the last matched descendant.
+            bool matched = false;
+            if (compound_selector->combinator == CSS::Selector::Combinator::NextSibling) {
+                if (auto const* sibling = current->previous_element_sibling())
+                    matched = matches(selector, compound_selector_index - 1, *sibling, shadow_host, context, nullptr, SelectorKind::Normal);
+            } else {
+                for (auto const* sibling = current->previous_element_sibling(); sibling && !matched; sibling = sibling->previous_element_sibling())
+                    matched = matches(selector, compound_selector_index - 1, *sibling, shadow_host, context, nullptr, SelectorKind::Normal);
+            }
+            if (matched)
+                return true;
+            if (backtrack_state.element) {
+                current = backtrack_state.element;
+                compound_selector_index = backtrack_state.compound_selector_index;
+                continue;
+            }
+            return false;
+        }
         default:
             VERIFY_NOT_REACHED();
         }
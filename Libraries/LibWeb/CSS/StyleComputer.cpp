@@ -366,6 +366,12 @@ static CSSStyleSheet& svg_stylesheet()
     return *sheet;
 }
 
+void StyleComputer::preload_user_agent_style_sheets()
+{
+    (void)shared_user_agent_rule_caches(false);
+    (void)shared_user_agent_rule_caches(true);
+}
+
 Optional<String> StyleComputer::user_agent_style_sheet_source(StringView name)
 {
     extern String default_stylesheet_source;
@@ -384,15 +390,23 @@ Optional<String> StyleComputer::user_agent_style_sheet_source(StringView name)
     return {};
 }
 
+template<typename Callback>
+void StyleComputer::for_each_user_agent_style_sheet(bool in_quirks_mode, Callback callback)
+{
+    callback(default_stylesheet());
+    if (in_quirks_mode)
+        callback(quirks_mode_stylesheet());
+    callback(mathml_stylesheet());
+    callback(svg_stylesheet());
+}
+
 template<typename Callback>
 void StyleComputer::for_each_stylesheet(CascadeOrigin cascade_origin, Callback callback) const
 {
     if (cascade_origin == CascadeOrigin::UserAgent) {
-        callback(default_stylesheet(), {});
-        if (document().in_quirks_mode())
-            callback(quirks_mode_stylesheet(), {});
-        callback(mathml_stylesheet(), {});
-        callback(svg_stylesheet(), {});
+        for_each_user_agent_style_sheet(document().in_quirks_mode(), [&](auto& sheet) {
+            callback(sheet, {});
+        });
     }
     if (cascade_origin == CascadeOrigin::User) {
         if (m_user_style_sheet)
@@ -489,6 +503,17 @@ bool StyleComputer::invalidation_property_used_in_has_selector(InvalidationSet::
     return false;
 }
 
+InvalidationSet StyleComputer::has_anchor_invalidation_set_for_property(InvalidationSet::Property const& property) const
+{
+    if (m_style_invalidation_data) {
+        if (auto it = m_style_invalidation_data->has_anchor_invalidation_sets.find(property); it != m_style_invalidation_data->has_anchor_invalidation_sets.end())
+            return it->value;
+    }
+    InvalidationSet any_anchor;
+    any_anchor.set_needs_invalidate_self();
+    return any_anchor;
+}
+
 Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::Element const& element, CascadeOrigin cascade_origin, Optional<CSS::PseudoElement> pseudo_element, PseudoClassBitmap& attempted_pseudo_class_matches, FlyString const& qualified_layer_name) const
 {
     auto const& root_node = element.root();
@@ -564,6 +589,8 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::Element c
             add_rules_from_cache(*rule_cache);
     }
 
+    m_document->frame_statistics().number_of_rule_candidates_tested += rules_to_run.size();
+
     Vector<MatchingRule const*> matching_rules;
     matching_rules.ensure_capacity(rules_to_run.size());
 
@@ -1592,6 +1619,88 @@ void StyleComputer::start_needed_transitions(ComputedProperties const& previous_
     }
 }
 
+// Whether the rules matched by this element could be shared with (or taken from) an identical sibling.
+static bool can_share_matching_rules(DOM::Element const& element)
+{
+    return !element.is_shadow_host()
+        && !element.style_affected_by_structural_changes()
+        && !element.affected_by_has_pseudo_class_in_subject_position()
+        && !element.affected_by_has_pseudo_class_in_non_subject_position()
+        && !element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator();
+}
+
+static bool have_same_selector_matching_inputs(DOM::Element const& a, DOM::Element const& b)
+{
+    if (a.local_name() != b.local_name() || a.namespace_uri() != b.namespace_uri())
+        return false;
+
+    auto attribute_count = a.attribute_list_size();
+    if (attribute_count != b.attribute_list_size())
+        return false;
+    if (attribute_count == 0)
+        return true;
+
+    auto const& a_attributes = *a.attributes();
+    auto const& b_attributes = *b.attributes();
+    for (size_t i = 0; i < attribute_count; ++i) {
+        auto const& a_attribute = *a_attributes.item(i);
+        auto const& b_attribute = *b_attributes.item(i);
+        if (a_attribute.local_name() != b_attribute.local_name()
+            || a_attribute.namespace_uri() != b_attribute.namespace_uri()
+            || a_attribute.value() != b_attribute.value())
+            return false;
+    }
+    return true;
+}
+
+Optional<StyleComputer::MatchingRuleSet> StyleComputer::find_shareable_matching_rules(DOM::Element const& element) const
+{
+    if (m_style_sharing_candidates_dom_tree_version != m_document->dom_tree_version()) {
+        m_style_sharing_candidates.clear();
+        m_next_style_sharing_candidate_to_replace = 0;
+        m_style_sharing_candidates_dom_tree_version = m_document->dom_tree_version();
+        return {};
+    }
+
+    auto const* previous_sibling = element.previous_element_sibling();
+    if (!previous_sibling)
+        return {};
+
+    for (auto const& candidate : m_style_sharing_candidates) {
+        if (candidate.element.ptr() != previous_sibling)
+            continue;
+        if (!can_share_matching_rules(*previous_sibling) || !have_same_selector_matching_inputs(*previous_sibling, element))
+            return {};
+        return candidate.matching_rule_set;
+    }
+    return {};
+}
+
+void StyleComputer::remember_matching_rules_for_sharing(DOM::Element& element, MatchingRuleSet matching_rule_set) const
+{
+    if (m_style_sharing_candidates_dom_tree_version != m_document->dom_tree_version()) {
+        m_style_sharing_candidates.clear();
+        m_next_style_sharing_candidate_to_replace = 0;
+        m_style_sharing_candidates_dom_tree_version = m_document->dom_tree_version();
+    }
+
+    // Only the most recently styled child of each parent can be the previous sibling of the next one to be styled.
+    for (auto& candidate : m_style_sharing_candidates) {
+        if (candidate.element->parent() == element.parent()) {
+            candidate = { GC::make_root(element), move(matching_rule_set) };
+            return;
+        }
+    }
+
+    if (m_style_sharing_candidates.size() < max_number_of_style_sharing_candidates) {
+        m_style_sharing_candidates.append({ GC::make_root(element), move(matching_rule_set) });
+        return;
+    }
+
+    m_style_sharing_candidates[m_next_style_sharing_candidate_to_replace] = { GC::make_root(element), move(matching_rule_set) };
+    m_next_style_sharing_candidate_to_replace = (m_next_style_sharing_candidate_to_replace + 1) % max_number_of_style_sharing_candidates;
+}
+
 // https://www.w3.org/TR/css-cascade/#cascading
 // https://drafts.csswg.org/css-cascade-5/#layering
 GC::Ref<CascadedProperties> StyleComputer::compute_cascaded_values(DOM::Element& element, Optional<CSS::PseudoElement> pseudo_element, bool& did_match_any_pseudo_element_rules, PseudoClassBitmap& attempted_pseudo_class_matches, ComputeStyleMode mode) const
@@ -1600,20 +1709,37 @@ GC::Ref<CascadedProperties> StyleComputer::compute_cascaded_values(DOM::Element&
 
     // First, we collect all the CSS rules whose selectors match `element`:
     MatchingRuleSet matching_rule_set;
-    matching_rule_set.user_agent_rules = collect_matching_rules(element, CascadeOrigin::UserAgent, pseudo_element, attempted_pseudo_class_matches);
-    sort_matching_rules(matching_rule_set.user_agent_rules);
-    matching_rule_set.user_rules = collect_matching_rules(element, CascadeOrigin::User, pseudo_element, attempted_pseudo_class_matches);
-    sort_matching_rules(matching_rule_set.user_rules);
-    // @layer-ed author rules
-    for (auto const& layer_name : m_qualified_layer_names_in_order) {
-        auto layer_rules = collect_matching_rules(element, CascadeOrigin::Author, pseudo_element, attempted_pseudo_class_matches, layer_name);
-        sort_matching_rules(layer_rules);
-        matching_rule_set.author_rules.append({ layer_name, layer_rules });
-    }
-    // Un-@layer-ed author rules
-    auto unlayered_author_rules = collect_matching_rules(element, CascadeOrigin::Author, pseudo_element, attempted_pseudo_class_matches);
-    sort_matching_rules(unlayered_author_rules);
-    matching_rule_set.author_rules.append({ {}, unlayered_author_rules });
+
+    // OPTIMIZATION: If the previous sibling has the same tag and attributes, and matching its rules didn't depend on
+    //               anything but those and its ancestors, we can take its matched rules instead of matching again.
+    bool can_share_rules = !pseudo_element.has_value() && can_share_matching_rules(element);
+    Optional<MatchingRuleSet> shared_matching_rule_set;
+    if (can_share_rules)
+        shared_matching_rule_set = find_shareable_matching_rules(element);
+
+    if (shared_matching_rule_set.has_value()) {
+        ++m_document->frame_statistics().number_of_elements_with_shared_matching_rules;
+        matching_rule_set = shared_matching_rule_set.release_value();
+    } else {
+        matching_rule_set.user_agent_rules = collect_matching_rules(element, CascadeOrigin::UserAgent, pseudo_element, attempted_pseudo_class_matches);
+        sort_matching_rules(matching_rule_set.user_agent_rules);
+        matching_rule_set.user_rules = collect_matching_rules(element, CascadeOrigin::User, pseudo_element, attempted_pseudo_class_matches);
+        sort_matching_rules(matching_rule_set.user_rules);
+        // @layer-ed author rules
+        for (auto const& layer_name : m_qualified_layer_names_in_order) {
+            auto layer_rules = collect_matching_rules(element, CascadeOrigin::Author, pseudo_element, attempted_pseudo_class_matches, layer_name);
+            sort_matching_rules(layer_rules);
+            matching_rule_set.author_rules.append({ layer_name, layer_rules });
+        }
+        // Un-@layer-ed author rules
+        auto unlayered_author_rules = collect_matching_rules(element, CascadeOrigin::Author, pseudo_element, attempted_pseudo_class_matches);
+        sort_matching_rules(unlayered_author_rules);
+        matching_rule_set.author_rules.append({ {}, unlayered_author_rules });
+
+        // NOTE: If we attempted to match any pseudo-class, the rules may depend on the state of this element,
+        //       or on its position among its siblings.
+        can_share_rules = can_share_rules && attempted_pseudo_class_matches.is_empty() && can_share_matching_rules(element);
+    }
 
     if (mode == ComputeStyleMode::CreatePseudoElementStyleIfNeeded) {
         VERIFY(pseudo_element.has_value());
@@ -1682,6 +1808,9 @@ GC::Ref<CascadedProperties> StyleComputer::compute_cascaded_values(DOM::Element&
     // Note that we have to do these after finishing computing the style,
     // so they're not done here, but as the final step in compute_style_impl()
 
+    if (can_share_rules)
+        remember_matching_rules_for_sharing(element, move(matching_rule_set));
+
     return cascaded_properties;
 }
 
@@ -2785,9 +2914,114 @@ void StyleComputer::collect_selector_insights(Selector const& selector, Selector
     }
 }
 
+void StyleComputer::add_style_producing_rule_to_rule_caches(CSSRule const& rule, CSSStyleSheet const& sheet, GC::Ptr<DOM::ShadowRoot> shadow_root, RuleCaches& rule_caches, CascadeOrigin cascade_origin, size_t style_sheet_index, size_t rule_index, SelectorInsights& insights, StyleInvalidationData& style_invalidation_data, PseudoClassRuleCaches& pseudo_class_rule_caches)
+{
+    SelectorList const& absolutized_selectors = [&]() {
+        if (rule.type() == CSSRule::Type::Style)
+            return static_cast<CSSStyleRule const&>(rule).absolutized_selectors();
+        if (rule.type() == CSSRule::Type::NestedDeclarations)
+            return static_cast<CSSNestedDeclarations const&>(rule).parent_style_rule().absolutized_selectors();
+        VERIFY_NOT_REACHED();
+    }();
+
+    for (auto const& selector : absolutized_selectors) {
+        style_invalidation_data.build_invalidation_sets_for_selector(selector);
+    }
+
+    for (CSS::Selector const& selector : absolutized_selectors) {
+        MatchingRule matching_rule {
+            shadow_root,
+            &rule,
+            sheet,
+            sheet.default_namespace(),
+            selector,
+            style_sheet_index,
+            rule_index,
+            selector.specificity(),
+            cascade_origin,
+            false,
+        };
+
+        auto const& qualified_layer_name = matching_rule.qualified_layer_name();
+        auto& rule_cache = qualified_layer_name.is_empty() ? rule_caches.main : *rule_caches.by_layer.ensure(qualified_layer_name, [] { return make<RuleCache>(); });
+
+        bool contains_root_pseudo_class = false;
+        Optional<CSS::PseudoElement> pseudo_element;
+
+        collect_selector_insights(selector, insights);
+
+        for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
+            if (!matching_rule.contains_pseudo_element) {
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement) {
+                    matching_rule.contains_pseudo_element = true;
+                    pseudo_element = simple_selector.pseudo_element().type();
+                }
+            }
+            if (!contains_root_pseudo_class) {
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
+                    && simple_selector.pseudo_class().type == CSS::PseudoClass::Root) {
+                    contains_root_pseudo_class = true;
+                }
+            }
+        }
+
+        for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
+            auto pseudo_class = static_cast<PseudoClass>(i);
+            // If we're not building a rule cache for this pseudo class, just ignore it.
+            if (!pseudo_class_rule_caches[i])
+                continue;
+            if (selector.contains_pseudo_class(pseudo_class)) {
+                // For pseudo class rule caches we intentionally pass no pseudo-element, because we don't want to bucket pseudo class rules by pseudo-element type.
+                pseudo_class_rule_caches[i]->add_rule(matching_rule, {}, contains_root_pseudo_class);
+            }
+        }
+
+        rule_cache.add_rule(matching_rule, pseudo_element, contains_root_pseudo_class);
+    }
+}
+
+void StyleComputer::add_keyframes_rules_to_rule_caches(CSSStyleSheet const& sheet, RuleCaches& rule_caches)
+{
+    // Loosely based on https://drafts.csswg.org/css-animations-2/#keyframe-processing
+    sheet.for_each_effective_keyframes_at_rule([&](CSSKeyframesRule const& rule) {
+        auto keyframe_set = adopt_ref(*new Animations::KeyframeEffect::KeyFrameSet);
+        HashTable<PropertyID> animated_properties;
+
+        // Forwards pass, resolve all the user-specified keyframe properties.
+        for (auto const& keyframe_rule : *rule.css_rules()) {
+            auto const& keyframe = as<CSSKeyframeRule>(*keyframe_rule);
+            Animations::KeyframeEffect::KeyFrameSet::ResolvedKeyFrame resolved_keyframe;
+
+            auto key = static_cast<u64>(keyframe.key().value() * Animations::KeyframeEffect::AnimationKeyFrameKeyScaleFactor);
+            auto const& keyframe_style = *keyframe.style();
+            for (auto const& it : keyframe_style.properties()) {
+                // Unresolved properties will be resolved in collect_animation_into()
+                for_each_property_expanding_shorthands(it.property_id, it.value, AllowUnresolved::Yes, [&](PropertyID shorthand_id, CSSStyleValue const& shorthand_value) {
+                    animated_properties.set(shorthand_id);
+                    resolved_keyframe.properties.set(shorthand_id, NonnullRefPtr<CSSStyleValue const> { shorthand_value });
+                });
+            }
+
+            keyframe_set->keyframes_by_key.insert(key, resolved_keyframe);
+        }
+
+        Animations::KeyframeEffect::generate_initial_and_final_frames(keyframe_set, animated_properties);
+
+        if constexpr (LIBWEB_CSS_DEBUG) {
+            dbgln("Resolved keyframe set '{}' into {} keyframes:", rule.name(), keyframe_set->keyframes_by_key.size());
+            for (auto it = keyframe_set->keyframes_by_key.begin(); it != keyframe_set->keyframes_by_key.end(); ++it)
+                dbgln("    - keyframe {}: {} properties", it.key(), it->properties.size());
+        }
+
+        rule_caches.main.rules_by_animation_keyframes.set(rule.name(), move(keyframe_set));
+    });
+}
+
 void StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin, SelectorInsights& insights)
 {
-    Vector<MatchingRule> matching_rules;
+    // NOTE: The user agent rule cache is shared between documents, see shared_user_agent_rule_caches().
+    VERIFY(cascade_origin != CascadeOrigin::UserAgent);
+
     size_t style_sheet_index = 0;
     for_each_stylesheet(cascade_origin, [&](auto& sheet, GC::Ptr<DOM::ShadowRoot> shadow_root) {
         auto& rule_caches = [&] -> RuleCaches& {
@@ -2799,9 +3033,6 @@ void StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_ori
             case CascadeOrigin::User:
                 rule_caches_for_document_or_shadow_root = m_user_rule_cache;
                 break;
-            case CascadeOrigin::UserAgent:
-                rule_caches_for_document_or_shadow_root = m_user_agent_rule_cache;
-                break;
             default:
                 VERIFY_NOT_REACHED();
             }
@@ -2812,104 +3043,19 @@ void StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_ori
 
         size_t rule_index = 0;
         sheet.for_each_effective_style_producing_rule([&](auto const& rule) {
-            SelectorList const& absolutized_selectors = [&]() {
-                if (rule.type() == CSSRule::Type::Style)
-                    return static_cast<CSSStyleRule const&>(rule).absolutized_selectors();
-                if (rule.type() == CSSRule::Type::NestedDeclarations)
-                    return static_cast<CSSNestedDeclarations const&>(rule).parent_style_rule().absolutized_selectors();
-                VERIFY_NOT_REACHED();
-            }();
-
-            for (auto const& selector : absolutized_selectors) {
-                m_style_invalidation_data->build_invalidation_sets_for_selector(selector);
-            }
-
-            for (CSS::Selector const& selector : absolutized_selectors) {
-                MatchingRule matching_rule {
-                    shadow_root,
-                    &rule,
-                    sheet,
-                    sheet.default_namespace(),
-                    selector,
-                    style_sheet_index,
-                    rule_index,
-                    selector.specificity(),
-                    cascade_origin,
-                    false,
-                };
-
-                auto const& qualified_layer_name = matching_rule.qualified_layer_name();
-                auto& rule_cache = qualified_layer_name.is_empty() ? rule_caches.main : *rule_caches.by_layer.ensure(qualified_layer_name, [] { return make<RuleCache>(); });
-
-                bool contains_root_pseudo_class = false;
-                Optional<CSS::PseudoElement> pseudo_element;
-
-                collect_selector_insights(selector, insights);
-
-                for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
-                    if (!matching_rule.contains_pseudo_element) {
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement) {
-                            matching_rule.contains_pseudo_element = true;
-                            pseudo_element = simple_selector.pseudo_element().type();
-                        }
-                    }
-                    if (!contains_root_pseudo_class) {
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
-                            && simple_selector.pseudo_class().type == CSS::PseudoClass::Root) {
-                            contains_root_pseudo_class = true;
-                        }
-                    }
-                }
-
-                for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
-                    auto pseudo_class = static_cast<PseudoClass>(i);
-                    // If we're not building a rule cache for this pseudo class, just ignore it.
-                    if (!m_pseudo_class_rule_cache[i])
-                        continue;
-                    if (selector.contains_pseudo_class(pseudo_class)) {
-                        // For pseudo class rule caches we intentionally pass no pseudo-element, because we don't want to bucket pseudo class rules by pseudo-element type.
-                        m_pseudo_class_rule_cache[i]->add_rule(matching_rule, {}, contains_root_pseudo_class);
-                    }
-                }
-
-                rule_cache.add_rule(matching_rule, pseudo_element, contains_root_pseudo_class);
-            }
+            add_style_producing_rule_to_rule_caches(rule, sheet, shadow_root, rule_caches, cascade_origin, style_sheet_index, rule_index, insights, *m_style_invalidation_data, m_pseudo_class_rule_cache);
             ++rule_index;
         });
 
-        // Loosely based on https://drafts.csswg.org/css-animations-2/#keyframe-processing
-        sheet.for_each_effective_keyframes_at_rule([&](CSSKeyframesRule const& rule) {
-            auto keyframe_set = adopt_ref(*new Animations::KeyframeEffect::KeyFrameSet);
-            HashTable<PropertyID> animated_properties;
-
-            // Forwards pass, resolve all the user-specified keyframe properties.
-            for (auto const& keyframe_rule : *rule.css_rules()) {
-                auto const& keyframe = as<CSSKeyframeRule>(*keyframe_rule);
-                Animations::KeyframeEffect::KeyFrameSet::ResolvedKeyFrame resolved_keyframe;
-
-                auto key = static_cast<u64>(keyframe.key().value() * Animations::KeyframeEffect::AnimationKeyFrameKeyScaleFactor);
-                auto const& keyframe_style = *keyframe.style();
-                for (auto const& it : keyframe_style.properties()) {
-                    // Unresolved properties will be resolved in collect_animation_into()
-                    for_each_property_expanding_shorthands(it.property_id, it.value, AllowUnresolved::Yes, [&](PropertyID shorthand_id, CSSStyleValue const& shorthand_value) {
-                        animated_properties.set(shorthand_id);
-                        resolved_keyframe.properties.set(shorthand_id, NonnullRefPtr<CSSStyleValue const> { shorthand_value });
-                    });
-                }
-
-                keyframe_set->keyframes_by_key.insert(key, resolved_keyframe);
-            }
-
-            Animations::KeyframeEffect::generate_initial_and_final_frames(keyframe_set, animated_properties);
-
-            if constexpr (LIBWEB_CSS_DEBUG) {
-                dbgln("Resolved keyframe set '{}' into {} keyframes:", rule.name(), keyframe_set->keyframes_by_key.size());
-                for (auto it = keyframe_set->keyframes_by_key.begin(); it != keyframe_set->keyframes_by_key.end(); ++it)
-                    dbgln("    - keyframe {}: {} properties", it.key(), it->properties.size());
-            }
+        if (cascade_origin == CascadeOrigin::Author) {
+            auto& style_sheet_in_rule_cache = m_author_rule_cache->style_sheets.ensure(sheet, [&] {
+                return StyleSheetInRuleCache { shadow_root, style_sheet_index, rule_index, false };
+            });
+            if (style_sheet_in_rule_cache.style_sheet_index != style_sheet_index)
+                style_sheet_in_rule_cache.appears_more_than_once = true;
+        }
 
-            rule_caches.main.rules_by_animation_keyframes.set(rule.name(), move(keyframe_set));
-        });
+        add_keyframes_rules_to_rule_caches(sheet, rule_caches);
         ++style_sheet_index;
     });
 }
@@ -2984,11 +3130,57 @@ void StyleComputer::build_qualified_layer_names_cache()
     flatten_layer_names_tree(m_qualified_layer_names_in_order, ""sv, {}, root);
 }
 
+struct StyleComputer::SharedUserAgentRuleCaches {
+    RuleCachesForDocumentAndShadowRoots rule_caches;
+    PseudoClassRuleCaches pseudo_class_rule_caches;
+    StyleInvalidationData style_invalidation_data;
+    SelectorInsights insights;
+};
+
+void StyleComputer::create_pseudo_class_rule_caches(PseudoClassRuleCaches& pseudo_class_rule_caches)
+{
+    pseudo_class_rule_caches[to_underlying(PseudoClass::Hover)] = make<RuleCache>();
+    pseudo_class_rule_caches[to_underlying(PseudoClass::Active)] = make<RuleCache>();
+    pseudo_class_rule_caches[to_underlying(PseudoClass::Focus)] = make<RuleCache>();
+    pseudo_class_rule_caches[to_underlying(PseudoClass::FocusWithin)] = make<RuleCache>();
+    pseudo_class_rule_caches[to_underlying(PseudoClass::FocusVisible)] = make<RuleCache>();
+    pseudo_class_rule_caches[to_underlying(PseudoClass::Target)] = make<RuleCache>();
+    pseudo_class_rule_caches[to_underlying(PseudoClass::TargetWithin)] = make<RuleCache>();
+}
+
+// OPTIMIZATION: The user agent style sheets are the same for every document in the process, and which of them apply
+//               only depends on whether the document is in quirks mode. So instead of rebuilding their rule cache
+//               whenever a document's style sheets change, we build it once per mode and share it between documents.
+StyleComputer::SharedUserAgentRuleCaches const& StyleComputer::shared_user_agent_rule_caches(bool in_quirks_mode)
+{
+    static OwnPtr<SharedUserAgentRuleCaches> s_shared_rule_caches[2];
+
+    auto& shared_rule_caches = s_shared_rule_caches[in_quirks_mode ? 1 : 0];
+    if (shared_rule_caches)
+        return *shared_rule_caches;
+
+    shared_rule_caches = make<SharedUserAgentRuleCaches>();
+    create_pseudo_class_rule_caches(shared_rule_caches->pseudo_class_rule_caches);
+
+    auto& rule_caches = shared_rule_caches->rule_caches.for_document;
+    size_t style_sheet_index = 0;
+    for_each_user_agent_style_sheet(in_quirks_mode, [&](CSSStyleSheet const& sheet) {
+        size_t rule_index = 0;
+        sheet.for_each_effective_style_producing_rule([&](auto const& rule) {
+            add_style_producing_rule_to_rule_caches(rule, sheet, {}, rule_caches, CascadeOrigin::UserAgent, style_sheet_index, rule_index, shared_rule_caches->insights, shared_rule_caches->style_invalidation_data, shared_rule_caches->pseudo_class_rule_caches);
+            ++rule_index;
+        });
+        add_keyframes_rules_to_rule_caches(sheet, rule_caches);
+        ++style_sheet_index;
+    });
+
+    return *shared_rule_caches;
+}
+
 void StyleComputer::build_rule_cache()
 {
     m_author_rule_cache = make<RuleCachesForDocumentAndShadowRoots>();
     m_user_rule_cache = make<RuleCachesForDocumentAndShadowRoots>();
-    m_user_agent_rule_cache = make<RuleCachesForDocumentAndShadowRoots>();
 
     m_selector_insights = make<SelectorInsights>();
     m_style_invalidation_data = make<StyleInvalidationData>();
@@ -2999,17 +3191,20 @@ void StyleComputer::build_rule_cache()
 
     build_qualified_layer_names_cache();
 
-    m_pseudo_class_rule_cache[to_underlying(PseudoClass::Hover)] = make<RuleCache>();
-    m_pseudo_class_rule_cache[to_underlying(PseudoClass::Active)] = make<RuleCache>();
-    m_pseudo_class_rule_cache[to_underlying(PseudoClass::Focus)] = make<RuleCache>();
-    m_pseudo_class_rule_cache[to_underlying(PseudoClass::FocusWithin)] = make<RuleCache>();
-    m_pseudo_class_rule_cache[to_underlying(PseudoClass::FocusVisible)] = make<RuleCache>();
-    m_pseudo_class_rule_cache[to_underlying(PseudoClass::Target)] = make<RuleCache>();
-    m_pseudo_class_rule_cache[to_underlying(PseudoClass::TargetWithin)] = make<RuleCache>();
+    create_pseudo_class_rule_caches(m_pseudo_class_rule_cache);
 
     make_rule_cache_for_cascade_origin(CascadeOrigin::Author, *m_selector_insights);
     make_rule_cache_for_cascade_origin(CascadeOrigin::User, *m_selector_insights);
-    make_rule_cache_for_cascade_origin(CascadeOrigin::UserAgent, *m_selector_insights);
+
+    auto const& shared_user_agent_caches = shared_user_agent_rule_caches(document().in_quirks_mode());
+    m_user_agent_rule_cache = &shared_user_agent_caches.rule_caches;
+    m_style_invalidation_data->include_all_from(shared_user_agent_caches.style_invalidation_data);
+    if (shared_user_agent_caches.insights.has_has_selectors)
+        m_selector_insights->has_has_selectors = true;
+    for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
+        if (m_pseudo_class_rule_cache[i])
+            m_pseudo_class_rule_cache[i]->add_rules_from(*shared_user_agent_caches.pseudo_class_rule_caches[i]);
+    }
 }
 
 void StyleComputer::invalidate_rule_cache()
@@ -3022,12 +3217,49 @@ void StyleComputer::invalidate_rule_cache()
     m_user_rule_cache = nullptr;
     m_user_style_sheet = nullptr;
 
-    // NOTE: It might not be necessary to throw away the UA rule cache.
-    //       If we are sure that it's safe, we could keep it as an optimization.
+    // NOTE: The UA rule cache itself is shared between documents and kept alive, we only let go of our reference to it.
     m_user_agent_rule_cache = nullptr;
 
     m_pseudo_class_rule_cache = {};
     m_style_invalidation_data = nullptr;
+
+    // NOTE: These point into the rule caches we just threw away.
+    reset_style_sharing_candidates();
+}
+
+bool StyleComputer::add_rule_appended_to_style_sheet_to_rule_cache(CSSStyleSheet const& sheet, CSSRule const& rule)
+{
+    if (!m_author_rule_cache)
+        return false;
+
+    // NOTE: We only handle plain style rules without nested rules, at the top level of a style sheet that isn't
+    //       imported. Such a rule is never in a cascade layer, so the set of layers stays the same.
+    if (rule.type() != CSSRule::Type::Style || rule.parent_rule() || sheet.owner_rule())
+        return false;
+    if (static_cast<CSSStyleRule const&>(rule).css_rules().length() != 0)
+        return false;
+    if (!sheet.media()->matches())
+        return false;
+
+    auto it = m_author_rule_cache->style_sheets.find(sheet);
+    if (it == m_author_rule_cache->style_sheets.end() || it->value.appears_more_than_once)
+        return false;
+    auto& style_sheet_in_rule_cache = it->value;
+
+    auto& rule_caches = [&] -> RuleCaches& {
+        if (!style_sheet_in_rule_cache.shadow_root)
+            return m_author_rule_cache->for_document;
+        return *m_author_rule_cache->for_shadow_roots.ensure(*style_sheet_in_rule_cache.shadow_root, [] { return make<RuleCaches>(); });
+    }();
+
+    // NOTE: Since the rule is the last one in its style sheet, it comes after every other rule from the same sheet,
+    //       and the rules of all other sheets keep their place in the cascade order.
+    add_style_producing_rule_to_rule_caches(rule, sheet, style_sheet_in_rule_cache.shadow_root, rule_caches, CascadeOrigin::Author, style_sheet_in_rule_cache.style_sheet_index, style_sheet_in_rule_cache.number_of_rules, *m_selector_insights, *m_style_invalidation_data, m_pseudo_class_rule_cache);
+    ++style_sheet_in_rule_cache.number_of_rules;
+
+    // NOTE: Adding to the rule caches may have moved the rules these point to.
+    reset_style_sharing_candidates();
+    return true;
 }
 
 void StyleComputer::did_load_font(FlyString const&)
@@ -3170,6 +3402,12 @@ void StyleComputer::reset_ancestor_filter()
     m_ancestor_filter.clear();
 }
 
+void StyleComputer::reset_style_sharing_candidates()
+{
+    m_style_sharing_candidates.clear();
+    m_next_style_sharing_candidate_to_replace = 0;
+}
+
 void StyleComputer::push_ancestor(DOM::Element const& element)
 {
     for_each_element_hash(element, [&](u32 hash) {
@@ -3276,6 +3514,24 @@ void RuleCache::add_rule(MatchingRule const& matching_rule, Optional<PseudoEleme
     }
 }
 
+void RuleCache::add_rules_from(RuleCache const& other)
+{
+    auto add_rules_from_buckets = [](auto& buckets, auto const& other_buckets) {
+        for (auto const& [name, rules] : other_buckets)
+            buckets.ensure(name).extend(rules);
+    };
+    add_rules_from_buckets(rules_by_id, other.rules_by_id);
+    add_rules_from_buckets(rules_by_class, other.rules_by_class);
+    add_rules_from_buckets(rules_by_tag_name, other.rules_by_tag_name);
+    add_rules_from_buckets(rules_by_attribute_name, other.rules_by_attribute_name);
+    for (size_t i = 0; i < rules_by_pseudo_element.size(); ++i)
+        rules_by_pseudo_element[i].extend(other.rules_by_pseudo_element[i]);
+    root_rules.extend(other.root_rules);
+    other_rules.extend(other.other_rules);
+    for (auto const& [name, keyframe_set] : other.rules_by_animation_keyframes)
+        rules_by_animation_keyframes.set(name, keyframe_set);
+}
+
 void RuleCache::for_each_matching_rules(DOM::Element const& element, Optional<PseudoElement> pseudo_element, Function<IterationDecision(Vector<MatchingRule> const&)> callback) const
 {
     for (auto const& class_name : element.class_names()) {
@@ -121,6 +121,7 @@ struct RuleCache {
     HashMap<FlyString, NonnullRefPtr<Animations::KeyframeEffect::KeyFrameSet>> rules_by_animation_keyframes;
 
     void add_rule(MatchingRule const&, Optional<PseudoElement>, bool contains_root_pseudo_class);
+    void add_rules_from(RuleCache const&);
     void for_each_matching_rules(DOM::Element const&, Optional<PseudoElement>, Function<IterationDecision(Vector<MatchingRule> const&)> callback) const;
 };
 
@@ -145,6 +146,9 @@ public:
 
     static Optional<String> user_agent_style_sheet_source(StringView name);
 
+    // Parses the user agent style sheets, and builds their rule caches, ahead of their first use.
+    static void preload_user_agent_style_sheets();
+
     explicit StyleComputer(DOM::Document&);
     ~StyleComputer();
 
@@ -155,6 +159,8 @@ public:
     void push_ancestor(DOM::Element const&);
     void pop_ancestor(DOM::Element const&);
 
+    void reset_style_sharing_candidates();
+
     [[nodiscard]] GC::Ref<ComputedProperties> create_document_style() const;
 
     [[nodiscard]] GC::Ref<ComputedProperties> compute_style(DOM::Element&, Optional<CSS::PseudoElement> = {}) const;
@@ -166,10 +172,15 @@ public:
 
     InvalidationSet invalidation_set_for_properties(Vector<InvalidationSet::Property> const&) const;
     bool invalidation_property_used_in_has_selector(InvalidationSet::Property const&) const;
+    InvalidationSet has_anchor_invalidation_set_for_property(InvalidationSet::Property const&) const;
 
     [[nodiscard]] bool has_valid_rule_cache() const { return m_author_rule_cache; }
     void invalidate_rule_cache();
 
+    // Adds a style rule that was just appended to the end of an author style sheet to the existing rule cache.
+    // Returns false if that's not possible, in which case the caller must invalidate the rule cache instead.
+    [[nodiscard]] bool add_rule_appended_to_style_sheet_to_rule_cache(CSSStyleSheet const&, CSSRule const&);
+
     Gfx::Font const& initial_font() const;
 
     void did_load_font(FlyString const& family_name);
@@ -258,6 +269,17 @@ private:
         Vector<LayerMatchingRules> author_rules;
     };
 
+    // Siblings with the same tag and attributes match the same rules, unless a rule depends on their position among
+    // their siblings or on their state. We remember the rules matched by recently styled elements, so that their next
+    // sibling can skip selector matching altogether if it turns out to be such a twin.
+    struct StyleSharingCandidate {
+        GC::Root<DOM::Element> element;
+        MatchingRuleSet matching_rule_set;
+    };
+
+    [[nodiscard]] Optional<MatchingRuleSet> find_shareable_matching_rules(DOM::Element const&) const;
+    void remember_matching_rules_for_sharing(DOM::Element&, MatchingRuleSet) const;
+
     void cascade_declarations(
         CascadedProperties&,
         DOM::Element&,
@@ -281,23 +303,44 @@ private:
         HashMap<FlyString, NonnullOwnPtr<RuleCache>> by_layer;
     };
 
+    struct StyleSheetInRuleCache {
+        GC::Ptr<DOM::ShadowRoot> shadow_root;
+        size_t style_sheet_index { 0 };
+        size_t number_of_rules { 0 };
+        bool appears_more_than_once { false };
+    };
+
     struct RuleCachesForDocumentAndShadowRoots {
         RuleCaches for_document;
         HashMap<GC::Ref<DOM::ShadowRoot const>, NonnullOwnPtr<RuleCaches>> for_shadow_roots;
+        HashMap<GC::Ref<CSSStyleSheet const>, StyleSheetInRuleCache> style_sheets;
     };
 
+    using PseudoClassRuleCaches = Array<OwnPtr<RuleCache>, to_underlying(PseudoClass::__Count)>;
+
+    // The rule caches of the user agent style sheets only depend on whether the document is in quirks mode, so they are
+    // built once per process and shared by every document.
+    struct SharedUserAgentRuleCaches;
+    static SharedUserAgentRuleCaches const& shared_user_agent_rule_caches(bool in_quirks_mode);
+
+    template<typename Callback>
+    static void for_each_user_agent_style_sheet(bool in_quirks_mode, Callback);
+
+    static void create_pseudo_class_rule_caches(PseudoClassRuleCaches&);
     void make_rule_cache_for_cascade_origin(CascadeOrigin, SelectorInsights&);
+    static void add_style_producing_rule_to_rule_caches(CSSRule const&, CSSStyleSheet const&, GC::Ptr<DOM::ShadowRoot>, RuleCaches&, CascadeOrigin, size_t style_sheet_index, size_t rule_index, SelectorInsights&, StyleInvalidationData&, PseudoClassRuleCaches&);
+    static void add_keyframes_rules_to_rule_caches(CSSStyleSheet const&, RuleCaches&);
 
     [[nodiscard]] RuleCache const* rule_cache_for_cascade_origin(CascadeOrigin, FlyString const& qualified_layer_name, GC::Ptr<DOM::ShadowRoot const>) const;
 
     static void collect_selector_insights(Selector const&, SelectorInsights&);
 
     OwnPtr<SelectorInsights> m_selector_insights;
-    Array<OwnPtr<RuleCache>, to_underlying(PseudoClass::__Count)> m_pseudo_class_rule_cache;
+    PseudoClassRuleCaches m_pseudo_class_rule_cache;
     OwnPtr<StyleInvalidationData> m_style_invalidation_data;
     OwnPtr<RuleCachesForDocumentAndShadowRoots> m_author_rule_cache;
     OwnPtr<RuleCachesForDocumentAndShadowRoots> m_user_rule_cache;
-    OwnPtr<RuleCachesForDocumentAndShadowRoots> m_user_agent_rule_cache;
+    RuleCachesForDocumentAndShadowRoots const* m_user_agent_rule_cache { nullptr };
     GC::Root<CSSStyleSheet> m_user_style_sheet;
 
     using FontLoaderList = Vector<NonnullOwnPtr<FontLoader>>;
@@ -311,6 +354,11 @@ private:
     CSSPixelRect m_viewport_rect;
 
     CountingBloomFilter<u8, 14> m_ancestor_filter;
+
+    static constexpr size_t max_number_of_style_sharing_candidates = 8;
+    mutable Vector<StyleSharingCandidate, max_number_of_style_sharing_candidates> m_style_sharing_candidates;
+    mutable size_t m_next_style_sharing_candidate_to_replace { 0 };
+    mutable u64 m_style_sharing_candidates_dom_tree_version { 0 };
 };
 
 class FontLoader : public Weakable<FontLoader> {
@@ -41,27 +41,66 @@ static void for_each_consecutive_simple_selector_group(Selector const& selector,
     }
 }
 
-static void collect_properties_used_in_has(Selector::SimpleSelector const& selector, StyleInvalidationData& style_invalidation_data, bool in_has)
+// Every anchor of a :has() has to match all the other simple selectors in its compound selector, so an id or class
+// required there is enough to tell the candidates apart from elements that could never be anchors.
+template<typename SimpleSelectors>
+static InvalidationSet invalidation_set_for_has_anchors_of_compound_selector(SimpleSelectors const& simple_selectors)
 {
+    InvalidationSet invalidation_set;
+    for (auto const& simple_selector : simple_selectors) {
+        if (simple_selector.type == Selector::SimpleSelector::Type::Id) {
+            invalidation_set.set_needs_invalidate_id(simple_selector.name());
+            return invalidation_set;
+        }
+    }
+    for (auto const& simple_selector : simple_selectors) {
+        if (simple_selector.type == Selector::SimpleSelector::Type::Class) {
+            invalidation_set.set_needs_invalidate_class(simple_selector.name());
+            return invalidation_set;
+        }
+    }
+    invalidation_set.set_needs_invalidate_self();
+    return invalidation_set;
+}
+
+template<typename SimpleSelectors>
+static void collect_properties_used_in_has_in_compound_selector(SimpleSelectors const& compound_selector, StyleInvalidationData&, InvalidationSet const* has_anchors);
+
+static void collect_properties_used_in_has(Selector::SimpleSelector const& selector, StyleInvalidationData& style_invalidation_data, InvalidationSet const* has_anchors)
+{
+    bool in_has = has_anchors != nullptr;
+    auto add_has_anchors_for_property = [&](InvalidationSet::Property property) {
+        auto& invalidation_set = style_invalidation_data.has_anchor_invalidation_sets.ensure(property, [] { return InvalidationSet {}; });
+        invalidation_set.include_all_from(*has_anchors);
+    };
+
     switch (selector.type) {
     case Selector::SimpleSelector::Type::Id: {
-        if (in_has)
+        if (in_has) {
             style_invalidation_data.ids_used_in_has_selectors.set(selector.name());
+            add_has_anchors_for_property({ InvalidationSet::Property::Type::Id, selector.name() });
+        }
         break;
     }
     case Selector::SimpleSelector::Type::Class: {
-        if (in_has)
+        if (in_has) {
             style_invalidation_data.class_names_used_in_has_selectors.set(selector.name());
+            add_has_anchors_for_property({ InvalidationSet::Property::Type::Class, selector.name() });
+        }
         break;
     }
     case Selector::SimpleSelector::Type::Attribute: {
-        if (in_has)
+        if (in_has) {
             style_invalidation_data.attribute_names_used_in_has_selectors.set(selector.attribute().qualified_name.name.lowercase_name);
+            add_has_anchors_for_property({ InvalidationSet::Property::Type::Attribute, selector.attribute().qualified_name.name.lowercase_name });
+        }
         break;
     }
     case Selector::SimpleSelector::Type::TagName: {
-        if (in_has)
+        if (in_has) {
             style_invalidation_data.tag_names_used_in_has_selectors.set(selector.qualified_name().name.lowercase_name);
+            add_has_anchors_for_property({ InvalidationSet::Property::Type::TagName, selector.qualified_name().name.lowercase_name });
+        }
         break;
     }
     case Selector::SimpleSelector::Type::PseudoClass: {
@@ -75,17 +114,17 @@ static void collect_properties_used_in_has(Selector::SimpleSelector const& selec
         case PseudoClass::Link:
         case PseudoClass::AnyLink:
         case PseudoClass::LocalLink:
-            if (in_has)
+            if (in_has) {
                 style_invalidation_data.pseudo_classes_used_in_has_selectors.set(pseudo_class.type);
+                add_has_anchors_for_property({ InvalidationSet::Property::Type::PseudoClass, pseudo_class.type });
+            }
             break;
         default:
             break;
         }
         for (auto const& child_selector : pseudo_class.argument_selector_list) {
             for (auto const& compound_selector : child_selector->compound_selectors()) {
-                for (auto const& simple_selector : compound_selector.simple_selectors) {
-                    collect_properties_used_in_has(simple_selector, style_invalidation_data, in_has || pseudo_class.type == PseudoClass::Has);
-                }
+                collect_properties_used_in_has_in_compound_selector(compound_selector.simple_selectors, style_invalidation_data, has_anchors);
             }
         }
         break;
@@ -95,6 +134,21 @@ static void collect_properties_used_in_has(Selector::SimpleSelector const& selec
     }
 }
 
+template<typename SimpleSelectors>
+static void collect_properties_used_in_has_in_compound_selector(SimpleSelectors const& compound_selector, StyleInvalidationData& style_invalidation_data, InvalidationSet const* has_anchors)
+{
+    Optional<InvalidationSet> anchors_of_compound_selector;
+    for (auto const& simple_selector : compound_selector) {
+        auto const* has_anchors_for_simple_selector = has_anchors;
+        if (!has_anchors && simple_selector.type == Selector::SimpleSelector::Type::PseudoClass && simple_selector.pseudo_class().type == PseudoClass::Has) {
+            if (!anchors_of_compound_selector.has_value())
+                anchors_of_compound_selector = invalidation_set_for_has_anchors_of_compound_selector(compound_selector);
+            has_anchors_for_simple_selector = &anchors_of_compound_selector.value();
+        }
+        collect_properties_used_in_has(simple_selector, style_invalidation_data, has_anchors_for_simple_selector);
+    }
+}
+
 enum class ExcludePropertiesNestedInNotPseudoClass : bool {
     No,
     Yes,
@@ -217,15 +271,7 @@ static InvalidationSet build_invalidation_sets_for_selector_impl(StyleInvalidati
     for_each_consecutive_simple_selector_group(selector, [&](Vector<Selector::SimpleSelector const&> const& simple_selectors, Selector::Combinator combinator, bool is_rightmost) {
         // Collect properties used in :has() so we can decide if only specific properties
         // trigger descendant invalidation or if the entire document must be invalidated.
-        for (auto const& simple_selector : simple_selectors) {
-            bool in_has = false;
-            if (simple_selector.type == Selector::SimpleSelector::Type::PseudoClass) {
-                auto const& pseudo_class = simple_selector.pseudo_class();
-                if (pseudo_class.type == PseudoClass::Has)
-                    in_has = true;
-            }
-            collect_properties_used_in_has(simple_selector, style_invalidation_data, in_has);
-        }
+        collect_properties_used_in_has_in_compound_selector(simple_selectors, style_invalidation_data, nullptr);
 
         if (is_rightmost) {
             // The rightmost selector is handled twice:
@@ -291,4 +337,22 @@ void StyleInvalidationData::build_invalidation_sets_for_selector(Selector const&
     (void)build_invalidation_sets_for_selector_impl(*this, selector, InsideNthChildPseudoClass::No);
 }
 
+void StyleInvalidationData::include_all_from(StyleInvalidationData const& other)
+{
+    for (auto const& [property, invalidation_set] : other.descendant_invalidation_sets)
+        descendant_invalidation_sets.ensure(property).include_all_from(invalidation_set);
+    for (auto const& id : other.ids_used_in_has_selectors)
+        ids_used_in_has_selectors.set(id);
+    for (auto const& class_name : other.class_names_used_in_has_selectors)
+        class_names_used_in_has_selectors.set(class_name);
+    for (auto const& attribute_name : other.attribute_names_used_in_has_selectors)
+        attribute_names_used_in_has_selectors.set(attribute_name);
+    for (auto const& tag_name : other.tag_names_used_in_has_selectors)
+        tag_names_used_in_has_selectors.set(tag_name);
+    for (auto pseudo_class : other.pseudo_classes_used_in_has_selectors)
+        pseudo_classes_used_in_has_selectors.set(pseudo_class);
+    for (auto const& [property, invalidation_set] : other.has_anchor_invalidation_sets)
+        has_anchor_invalidation_sets.ensure(property).include_all_from(invalidation_set);
+}
+
 }
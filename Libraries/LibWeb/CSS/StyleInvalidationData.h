@@ -20,7 +20,12 @@ struct StyleInvalidationData {
     HashTable<FlyString> tag_names_used_in_has_selectors;
     HashTable<PseudoClass> pseudo_classes_used_in_has_selectors;
 
+    // Maps each property used inside a :has() argument to the anchors whose :has() could start or stop matching when
+    // that property changes. A set that needs to invalidate self means that any element could be such an anchor.
+    HashMap<InvalidationSet::Property, InvalidationSet> has_anchor_invalidation_sets;
+
     void build_invalidation_sets_for_selector(Selector const& selector);
+    void include_all_from(StyleInvalidationData const&);
 };
 
 }
@@ -3665,30 +3665,39 @@ WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> SHA::digest(AlgorithmParams const&
 {
     auto& algorithm_name = algorithm.name;
 
-    ::Crypto::Hash::HashKind hash_kind;
-    if (algorithm_name == "SHA-1") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA1;
-    } else if (algorithm_name == "SHA-256") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA256;
-    } else if (algorithm_name == "SHA-384") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA384;
-    } else if (algorithm_name == "SHA-512") {
-        hash_kind = ::Crypto::Hash::HashKind::SHA512;
-    } else {
+    auto hash_kind = hash_kind_for_algorithm_name(algorithm_name);
+    if (!hash_kind.has_value())
         return WebIDL::NotSupportedError::create(m_realm, MUST(String::formatted("Invalid hash function '{}'", algorithm_name)));
-    }
 
-    ::Crypto::Hash::Manager hash { hash_kind };
-    hash.update(data);
-
-    auto digest = hash.digest();
-    auto result_buffer = ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
+    auto result_buffer = digest_bytes(*hash_kind, data);
     if (result_buffer.is_error())
         return WebIDL::OperationError::create(m_realm, "Failed to create result buffer"_string);
 
     return JS::ArrayBuffer::create(m_realm, result_buffer.release_value());
 }
 
+Optional<::Crypto::Hash::HashKind> SHA::hash_kind_for_algorithm_name(StringView algorithm_name)
+{
+    if (algorithm_name == "SHA-1"sv)
+        return ::Crypto::Hash::HashKind::SHA1;
+    if (algorithm_name == "SHA-256"sv)
+        return ::Crypto::Hash::HashKind::SHA256;
+    if (algorithm_name == "SHA-384"sv)
+        return ::Crypto::Hash::HashKind::SHA384;
+    if (algorithm_name == "SHA-512"sv)
+        return ::Crypto::Hash::HashKind::SHA512;
+    return {};
+}
+
+ErrorOr<ByteBuffer> SHA::digest_bytes(::Crypto::Hash::HashKind hash_kind, ReadonlyBytes data)
+{
+    ::Crypto::Hash::Manager hash { hash_kind };
+    hash.update(data);
+
+    auto digest = hash.digest();
+    return ByteBuffer::copy(digest.immutable_data(), hash.digest_size());
+}
+
 // https://w3c.github.io/webcrypto/#ecdsa-operations
 WebIDL::ExceptionOr<Variant<GC::Ref<CryptoKey>, GC::Ref<CryptoKeyPair>>> ECDSA::generate_key(AlgorithmParams const& params, bool extractable, Vector<Bindings::KeyUsage> const& key_usages)
 {
@@ -11,6 +11,7 @@
 #include <AK/EnumBits.h>
 #include <AK/String.h>
 #include <LibCrypto/BigInt/UnsignedBigInteger.h>
+#include <LibCrypto/Hash/HashManager.h>
 #include <LibGC/Ptr.h>
 #include <LibJS/Forward.h>
 #include <LibWeb/Bindings/SubtleCryptoPrototype.h>
@@ -535,6 +536,10 @@ class SHA : public AlgorithmMethods {
 public:
     virtual WebIDL::ExceptionOr<GC::Ref<JS::ArrayBuffer>> digest(AlgorithmParams const&, ByteBuffer const&) override;
 
+    // These don't touch the realm, so digests may be computed on a worker thread.
+    static Optional<::Crypto::Hash::HashKind> hash_kind_for_algorithm_name(StringView);
+    static ErrorOr<ByteBuffer> digest_bytes(::Crypto::Hash::HashKind, ReadonlyBytes);
+
     static NonnullOwnPtr<AlgorithmMethods> create(JS::Realm& realm) { return adopt_own(*new SHA(realm)); }
 
 private:
@@ -6,12 +6,14 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/ByteBuffer.h>
 #include <AK/QuickSort.h>
 #include <LibCrypto/Hash/HashManager.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/JSONObject.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibThreading/ThreadPool.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/SubtleCryptoPrototype.h>
@@ -275,6 +277,39 @@ GC::Ref<WebIDL::Promise> SubtleCrypto::digest(AlgorithmIdentifier const& algorit
     auto promise = WebIDL::create_promise(realm);
 
     // 6. Return promise and perform the remaining steps in parallel.
+
+    // OPTIMIZATION: Hashing large buffers is CPU-bound and needs nothing but the copied bytes, so we compute the digest
+    //               on the thread pool and only settle the promise back on this thread. This also lets several pending
+    //               digests run concurrently.
+    if (auto hash_kind = SHA::hash_kind_for_algorithm_name(normalized_algorithm.value().parameter->name); hash_kind.has_value()) {
+        struct DigestJob : public AtomicRefCounted<DigestJob> {
+            ByteBuffer data;
+            ErrorOr<ByteBuffer> result { ByteBuffer {} };
+        };
+        auto job = adopt_ref(*new DigestJob);
+        job->data = move(data_buffer);
+
+        Threading::ThreadPool::the().submit_with_completion(
+            [job, hash_kind = *hash_kind] {
+                job->result = SHA::digest_bytes(hash_kind, job->data);
+                job->data.clear();
+            },
+            [job, realm = GC::make_root(realm), promise = GC::make_root(promise)] {
+                HTML::TemporaryExecutionContext context(*realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+                // 8. Let result be the result of performing the digest operation specified by normalizedAlgorithm using algorithm, with data as message.
+                if (job->result.is_error()) {
+                    WebIDL::reject_promise(*realm, *promise, WebIDL::OperationError::create(*realm, "Failed to create result buffer"_string));
+                    return;
+                }
+
+                // 9. Resolve promise with result.
+                WebIDL::resolve_promise(*realm, *promise, JS::ArrayBuffer::create(*realm, job->result.release_value()));
+            });
+
+        return promise;
+    }
+
     Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, algorithm_object = normalized_algorithm.release_value(), promise, data_buffer = move(data_buffer)]() -> void {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
         // 7. If the following steps or referenced procedures say to throw an error, reject promise with the returned error and then terminate the algorithm.
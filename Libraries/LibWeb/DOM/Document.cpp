@@ -116,6 +116,7 @@
 #include <LibWeb/HTML/HTMLTitleElement.h>
 #include <LibWeb/HTML/HashChangeEvent.h>
 #include <LibWeb/HTML/ListOfAvailableImages.h>
+#include <LibWeb/HTML/MapOfPreloadedResources.h>
 #include <LibWeb/HTML/Location.h>
 #include <LibWeb/HTML/MessageEvent.h>
 #include <LibWeb/HTML/MessagePort.h>
@@ -145,6 +146,7 @@
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Namespace.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Painting/CompositorLayerState.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
 #include <LibWeb/ResizeObserver/ResizeObserver.h>
@@ -489,6 +491,7 @@ void Document::initialize(JS::Realm& realm)
     m_selection = realm.create<Selection::Selection>(realm, *this);
 
     m_list_of_available_images = realm.create<HTML::ListOfAvailableImages>();
+    m_map_of_preloaded_resources = realm.create<HTML::MapOfPreloadedResources>();
 
     page().client().page_did_create_new_document(*this);
 }
@@ -571,6 +574,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
 
     visitor.visit(m_associated_animation_timelines);
     visitor.visit(m_list_of_available_images);
+    visitor.visit(m_map_of_preloaded_resources);
 
     for (auto* form_associated_element : m_form_associated_elements_with_form_attribute)
         visitor.visit(form_associated_element->form_associated_element_to_html_element());
@@ -602,6 +606,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_session_storage_holder);
     visitor.visit(m_render_blocking_elements);
     visitor.visit(m_policy_container);
+    visitor.visit(m_compositor_layers);
 }
 
 // https://w3c.github.io/selection-api/#dom-document-getselection
@@ -1310,6 +1315,10 @@ void Document::update_layout(UpdateLayoutReason reason)
     auto viewport_rect = navigable->viewport_rect();
 
     auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    ScopeGuard record_frame_statistics_guard = [&] {
+        ++m_frame_statistics.number_of_layout_updates;
+        m_frame_statistics.time_spent_updating_layout += timer.elapsed_time();
+    };
 
     if (!m_layout_root || needs_layout_tree_update() || child_needs_layout_tree_update() || needs_full_layout_tree_update()) {
         Layout::TreeBuilder tree_builder;
@@ -1336,7 +1345,7 @@ void Document::update_layout(UpdateLayoutReason reason)
         if (auto dom_node = child.dom_node(); dom_node && dom_node->is_element()) {
             child.set_has_size_containment(as<Element>(*dom_node).has_size_containment());
         }
-        if (child.needs_layout_update()) {
+        if (child.needs_intrinsic_sizes_update()) {
             child.reset_cached_intrinsic_sizes();
         }
         child.clear_contained_abspos_children();
@@ -1421,14 +1430,32 @@ void Document::update_layout(UpdateLayoutReason reason)
     }
 }
 
+// Returns whether the layout subtree of an element whose style change requires a layout tree rebuild can be
+// rebuilt in place, instead of rebuilding the layout subtree of its parent (and thereby of all its siblings).
+// This is the case when the element's box stays block-level, so the structure of the parent's layout subtree
+// (anonymous wrappers, inline continuations, table fixups) doesn't depend on what changed.
+static bool can_rebuild_layout_tree_in_place(Element const& element)
+{
+    auto const* layout_node = element.layout_node();
+    if (!layout_node || !layout_node->parent() || element.rendered_in_top_layer() || element.is_svg_element())
+        return false;
+
+    // NOTE: The root element and body propagate some of their style to the viewport.
+    if (element.is_document_element() || element.is_html_body_element())
+        return false;
+
+    auto is_simple_block_level_display = [](CSS::Display const& display) {
+        return display.is_block_outside() && !display.is_table_inside() && !display.is_internal_table();
+    };
+    return is_simple_block_level_display(layout_node->display())
+        && is_simple_block_level_display(element.computed_properties()->display());
+}
+
 [[nodiscard]] static CSS::RequiredInvalidationAfterStyleChange update_style_recursively(Node& node, CSS::StyleComputer& style_computer, bool needs_inherited_style_update)
 {
     bool const needs_full_style_update = node.document().needs_full_style_update();
     CSS::RequiredInvalidationAfterStyleChange invalidation;
 
-    if (node.is_element())
-        style_computer.push_ancestor(static_cast<Element const&>(node));
-
     // NOTE: If the current node has `display:none`, we can disregard all invalidation
     //       caused by its children, as they will not be rendered anyway.
     //       We will still recompute style for the children, though.
@@ -1437,19 +1464,25 @@ void Document::update_layout(UpdateLayoutReason reason)
     CSS::RequiredInvalidationAfterStyleChange node_invalidation;
     if (is<Element>(node)) {
         if (needs_full_style_update || node.needs_style_update()) {
+            ++node.document().frame_statistics().number_of_elements_with_recomputed_style;
             node_invalidation = static_cast<Element&>(node).recompute_style();
         } else if (needs_inherited_style_update) {
             node_invalidation = static_cast<Element&>(node).recompute_inherited_style();
         }
         is_display_none = static_cast<Element&>(node).computed_properties()->display().is_none();
     }
+    if (!node_invalidation.is_none() && node.paintable())
+        node.paintable()->invalidate_cached_stacking_context_commands();
     if (node_invalidation.relayout && node.layout_node()) {
         node.layout_node()->set_needs_layout_update(SetNeedsLayoutReason::StyleChange);
     }
     if (node_invalidation.rebuild_layout_tree) {
         // We mark layout tree for rebuild starting from parent element to correctly invalidate
         // "display" property change to/from "contents" value.
-        if (auto parent_element = node.parent_element()) {
+        // OPTIMIZATION: Block-level boxes that stay block-level can be replaced without touching their siblings.
+        if (node.is_element() && can_rebuild_layout_tree_in_place(static_cast<Element&>(node))) {
+            node.set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::StyleChange);
+        } else if (auto parent_element = node.parent_element()) {
             parent_element->set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::StyleChange);
         } else {
             node.set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::StyleChange);
@@ -1460,6 +1493,12 @@ void Document::update_layout(UpdateLayoutReason reason)
 
     bool children_need_inherited_style_update = !invalidation.is_none();
     if (needs_full_style_update || node.child_needs_style_update() || children_need_inherited_style_update) {
+        // NOTE: The ancestor filter only ever has to describe the ancestors of the element whose style is being computed,
+        //       so we only push this element once we're about to descend into its subtree. This keeps the work off of
+        //       leaf elements, and their own hashes out of the filter while their style is computed.
+        if (node.is_element())
+            style_computer.push_ancestor(static_cast<Element const&>(node));
+
         if (node.is_element()) {
             if (auto shadow_root = static_cast<DOM::Element&>(node).shadow_root()) {
                 if (needs_full_style_update || shadow_root->needs_style_update() || shadow_root->child_needs_style_update()) {
@@ -1478,13 +1517,13 @@ void Document::update_layout(UpdateLayoutReason reason)
             }
             return IterationDecision::Continue;
         });
+
+        if (node.is_element())
+            style_computer.pop_ancestor(static_cast<Element const&>(node));
     }
 
     node.set_child_needs_style_update(false);
 
-    if (node.is_element())
-        style_computer.pop_ancestor(static_cast<Element const&>(node));
-
     return invalidation;
 }
 
@@ -1538,6 +1577,12 @@ void Document::update_style()
     if (m_created_for_appropriate_template_contents)
         return;
 
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    ScopeGuard record_frame_statistics_guard = [&] {
+        ++m_frame_statistics.number_of_style_updates;
+        m_frame_statistics.time_spent_updating_style += timer.elapsed_time();
+    };
+
     // Fetch the viewport rect once, instead of repeatedly, during style computation.
     style_computer().set_viewport_rect({}, viewport_rect());
 
@@ -1545,9 +1590,13 @@ void Document::update_style()
 
     style_computer().reset_ancestor_filter();
 
+    // NOTE: Element state (hover, focus, etc.) may have changed since the last style update, so rules matched back
+    //       then can't be shared with anyone now.
+    style_computer().reset_style_sharing_candidates();
+
     auto invalidation = update_style_recursively(*this, style_computer(), false);
     if (!invalidation.is_none())
-        invalidate_display_list();
+        invalidate_display_list(DiscardCachedStackingContextCommands::No);
     if (invalidation.rebuild_stacking_context_tree)
         invalidate_stacking_context_tree();
     m_needs_full_style_update = false;
@@ -1763,24 +1812,32 @@ void Document::invalidate_style_of_elements_affected_by_has()
         return;
     }
 
-    for (auto const& node : m_pending_nodes_for_style_invalidation_due_to_presence_of_has) {
+    for (auto const& [node, anchors] : m_pending_nodes_for_style_invalidation_due_to_presence_of_has) {
         if (node.is_null())
             continue;
+
+        // NB: Ids and classes match case-insensitively in quirks mode, so the anchors can't be told apart by them there.
+        bool any_element_can_be_anchor = anchors.needs_invalidate_self() || in_quirks_mode();
+        auto invalidate_style_if_anchor_affected_by_has = [&](Element& element) {
+            if (any_element_can_be_anchor || element.includes_properties_from_invalidation_set(anchors))
+                element.invalidate_style_if_affected_by_has();
+        };
+
         for (auto* ancestor = node.ptr(); ancestor; ancestor = ancestor->parent_or_shadow_host()) {
             if (!ancestor->is_element())
                 continue;
             auto& element = static_cast<Element&>(*ancestor);
-            element.invalidate_style_if_affected_by_has();
+            invalidate_style_if_anchor_affected_by_has(element);
 
             auto* parent = ancestor->parent_or_shadow_host();
             if (!parent)
-                return;
+                break;
 
             // If any ancestor's sibling was tested against selectors like ".a:has(+ .b)" or ".a:has(~ .b)"
             // its style might be affected by the change in descendant node.
             parent->for_each_child_of_type<Element>([&](auto& ancestor_sibling_element) {
                 if (ancestor_sibling_element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator())
-                    ancestor_sibling_element.invalidate_style_if_affected_by_has();
+                    invalidate_style_if_anchor_affected_by_has(ancestor_sibling_element);
                 return IterationDecision::Continue;
             });
         }
@@ -1842,12 +1899,17 @@ void Document::invalidate_style_for_elements_affected_by_pseudo_class_change(CSS
     Function<void(Node&)> invalidate_affected_elements_recursively = [&](Node& node) -> void {
         if (node.is_element()) {
             auto& element = static_cast<Element&>(node);
-            style_computer.push_ancestor(element);
             if (element.affected_by_pseudo_class(pseudo_class) && matches_different_set_of_rules_after_state_change(element)) {
                 element.set_needs_style_update(true);
             }
         }
 
+        if (!node.has_child_nodes())
+            return;
+
+        if (node.is_element())
+            style_computer.push_ancestor(static_cast<Element&>(node));
+
         node.for_each_child([&](auto& child) {
             invalidate_affected_elements_recursively(child);
             return IterationDecision::Continue;
@@ -4250,7 +4312,7 @@ void Document::unload(GC::Ptr<Document>)
     //           set unloadTimingInfo to null.
 
     // 5. Let intendToStoreInBfcache be true if the user agent intends to keep oldDocument alive in a session history entry, such that it can later be used for history traversal.
-    auto intend_to_store_in_bfcache = false;
+    auto intend_to_store_in_bfcache = new_document && is_eligible_for_back_forward_cache();
 
     // 6. Let eventLoop be oldDocument's relevant agent's event loop.
     auto& event_loop = *HTML::relevant_agent(*this).event_loop;
@@ -4371,9 +4433,77 @@ void Document::unload_a_document_and_its_descendants(GC::Ptr<Document> new_docum
         return number_unloaded == unloaded_documents_count;
     }));
 
+    // AD-HOC: A document that is still salvageable was kept for the back/forward cache, so it stays alive in its session
+    //         history entry instead of being destroyed. Traversing back to it then reactivates it.
+    if (m_salvageable) {
+        m_needs_to_call_page_did_load = true;
+        navigable->traversable_navigable()->store_document_in_back_forward_cache(*this);
+
+        if (after_all_unloads) {
+            HTML::queue_global_task(HTML::Task::Source::NavigationAndTraversal, relevant_global_object(*this), GC::create_function(heap(), [after_all_unloads] {
+                after_all_unloads->function()();
+            }));
+        }
+        return;
+    }
+
     destroy_a_document_and_its_descendants(move(after_all_unloads));
 }
 
+bool Document::is_eligible_for_back_forward_cache()
+{
+    if (!m_salvageable || is_initial_about_blank() || m_readiness != HTML::DocumentReadyState::Complete)
+        return false;
+
+    // NOTE: Only documents without child navigables are kept, so that the active documents of other navigables are never
+    //       kept alive along with them.
+    auto navigable = this->navigable();
+    if (!navigable || !navigable->is_top_level_traversable() || !document_tree_child_navigables().is_empty())
+        return false;
+
+    // Pages listening for unload expect it to fire, and pages with open connections would keep receiving data while hidden.
+    auto& window = as<HTML::Window>(HTML::relevant_global_object(*this));
+    if (window.has_event_listener(HTML::EventNames::unload) || window.has_open_network_connections())
+        return false;
+
+    return true;
+}
+
+// https://html.spec.whatwg.org/multipage/browsing-the-web.html#reactivate-a-document
+void Document::reactivate()
+{
+    // FIXME: 1. For each formControl of form controls in document with an autofill field name of "off", invoke the reset algorithm for formControl.
+
+    // FIXME: 2. If document's suspended timer handles is not empty:
+    //           1. Assert: document's suspension time is not zero.
+    //           2. Let suspendDuration be the current high resolution time minus document's suspension time.
+    //           3. Let activeTimers be document's relevant global object's map of active timers.
+    //           4. For each handle in document's suspended timer handles, if activeTimers[handle] exists, then increase activeTimers[handle] by suspendDuration.
+
+    // FIXME: 3. Update the navigation API entries for reactivation given document's relevant global object's navigation API, entriesForNavigationAPI, and reactivatedEntry.
+
+    // 4. If document's current document readiness is "complete", and document's page showing is false:
+    if (m_readiness != HTML::DocumentReadyState::Complete || m_page_showing)
+        return;
+
+    if (auto navigable = this->navigable())
+        navigable->traversable_navigable()->did_restore_document_from_back_forward_cache(*this);
+
+    // NOTE: The layout tree was torn down when the document stopped being active.
+    invalidate_layout_tree(InvalidateLayoutTreeReason::DocumentReactivate);
+
+    // 1. Set document's page showing to true.
+    m_page_showing = true;
+
+    // FIXME: 2. Set document's has been revealed to false.
+
+    // 3. Update the visibility state of document to "visible".
+    update_the_visibility_state(HTML::VisibilityState::Visible);
+
+    // 4. Fire a page transition event named pageshow at document's relevant global object with true.
+    as<HTML::Window>(relevant_global_object(*this)).fire_a_page_transition_event(HTML::EventNames::pageshow, true);
+}
+
 // https://html.spec.whatwg.org/multipage/iframe-embed-object.html#allowed-to-use
 bool Document::is_allowed_to_use_feature(PolicyControlledFeature feature) const
 {
@@ -4537,6 +4667,11 @@ HTML::ListOfAvailableImages const& Document::list_of_available_images() const
     return *m_list_of_available_images;
 }
 
+HTML::MapOfPreloadedResources& Document::map_of_preloaded_resources()
+{
+    return *m_map_of_preloaded_resources;
+}
+
 CSSPixelRect Document::viewport_rect() const
 {
     if (auto const navigable = this->navigable())
@@ -4707,7 +4842,16 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
     for (auto& observer : m_intersection_observers)
         intersection_observers.append(observer);
 
+    auto geometry_generation = page().geometry_generation();
+
     for (auto& observer : intersection_observers) {
+        // OPTIMIZATION: The results of the steps below only depend on the geometry of boxes on the page. If nothing
+        //               has been laid out, scrolled or transformed since all of this observer's targets were last
+        //               evaluated, every target would end up with its previous threshold index and intersection
+        //               state, and no entries would be queued.
+        if (observer->geometry_generation_of_last_update() == geometry_generation)
+            continue;
+
         // 1. Let rootBounds be observer’s root intersection rectangle.
         auto root_bounds = observer->root_intersection_rectangle();
 
@@ -4801,6 +4945,8 @@ void Document::run_the_update_intersection_observations_steps(HighResolutionTime
             // 16. Assign isIntersecting to intersectionObserverRegistration’s previousIsIntersecting property.
             intersection_observer_registration.previous_is_intersecting = is_intersecting;
         }
+
+        observer->set_geometry_generation_of_last_update({}, geometry_generation);
     }
 }
 
@@ -5188,7 +5334,8 @@ void Document::update_for_history_step_application(GC::Ref<HTML::SessionHistoryE
     // NOTE: This is for bfcache restoration
     if (!documents_entry_changed && !do_not_reactivate) {
         // FIXME: 1. Assert: entriesForNavigationAPI is given.
-        // FIXME: 2. Reactivate document given entry and entriesForNavigationAPI.
+        // 2. Reactivate document given entry and entriesForNavigationAPI.
+        reactivate();
     }
 }
 
@@ -5785,12 +5932,19 @@ void Document::gather_active_observations_at_depth(size_t depth)
 {
     // 1. Let depth be the depth passed in.
 
+    auto geometry_generation = page().geometry_generation();
+
     // 2. For each observer in [[resizeObservers]] run these steps:
     for (auto const& observer : m_resize_observers) {
         // 1. Clear observer’s [[activeTargets]], and [[skippedTargets]].
         observer->active_targets().clear();
         observer->skipped_targets().clear();
 
+        // OPTIMIZATION: Observed box sizes only change with layout. If none of this observer's observations were
+        //               active, and nothing has been laid out since, none of them can be active now either.
+        if (observer->geometry_generation_without_active_observations() == geometry_generation)
+            continue;
+
         // 2. For each observation in observer.[[observationTargets]] run this step:
         for (auto const& observation : observer->observation_targets()) {
             // 1. If observation.isActive() is true
@@ -5807,6 +5961,9 @@ void Document::gather_active_observations_at_depth(size_t depth)
                 }
             }
         }
+
+        if (observer->active_targets().is_empty() && observer->skipped_targets().is_empty())
+            observer->set_geometry_generation_without_active_observations({}, geometry_generation);
     }
 }
 
@@ -6142,6 +6299,14 @@ void Document::set_needs_to_refresh_scroll_state(bool b)
 {
     if (auto* paintable = this->paintable())
         paintable->set_needs_to_refresh_scroll_state(b);
+    if (b)
+        page().did_change_geometry();
+}
+
+void Document::set_needs_to_resolve_paint_only_properties()
+{
+    m_needs_to_resolve_paint_only_properties = true;
+    page().did_change_geometry();
 }
 
 Vector<GC::Root<DOM::Range>> Document::find_matching_text(String const& query, CaseSensitivity case_sensitivity)
@@ -6346,52 +6511,87 @@ void Document::set_cached_navigable(GC::Ptr<HTML::Navigable> navigable)
 
 void Document::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
-    set_needs_display(viewport_rect(), should_invalidate_display_list);
+    if (should_invalidate_display_list == InvalidateDisplayList::Yes)
+        invalidate_display_list();
+
+    schedule_repaint({});
 }
 
-void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList should_invalidate_display_list)
+void Document::set_needs_display(CSSPixelRect const& viewport_damage_rect, InvalidateDisplayList should_invalidate_display_list)
 {
     // FIXME: Ignore updates outside the visible viewport rect.
-    //        This requires accounting for fixed-position elements in the input rect, which we don't do yet.
 
-    if (should_invalidate_display_list == InvalidateDisplayList::Yes) {
+    if (should_invalidate_display_list == InvalidateDisplayList::Yes)
         invalidate_display_list();
-    }
 
+    schedule_repaint(viewport_damage_rect);
+}
+
+void Document::schedule_repaint(Optional<CSSPixelRect> const& viewport_damage_rect)
+{
     auto navigable = this->navigable();
     if (!navigable)
         return;
 
     if (navigable->is_traversable()) {
-        navigable->traversable_navigable()->set_needs_repaint();
+        auto traversable = navigable->traversable_navigable();
+        if (viewport_damage_rect.has_value())
+            traversable->add_damage_rect(*viewport_damage_rect);
+        else
+            traversable->set_entire_viewport_damaged();
+        traversable->set_needs_repaint();
         Web::HTML::main_thread_event_loop().schedule();
         return;
     }
 
+    // FIXME: Map damage in nested navigables into the viewport of their container instead of repainting all of it.
     if (auto container = navigable->container()) {
-        container->document().set_needs_display(should_invalidate_display_list);
+        container->document().set_needs_display(InvalidateDisplayList::No);
     }
 }
 
-void Document::invalidate_display_list()
+void Document::invalidate_display_list(DiscardCachedStackingContextCommands discard_cached_stacking_context_commands)
 {
     m_cached_display_list.clear();
+    if (discard_cached_stacking_context_commands == DiscardCachedStackingContextCommands::Yes)
+        ++m_display_list_generation;
 
     auto navigable = this->navigable();
     if (!navigable)
         return;
 
+    // We can't tell which pixels a newly recorded display list will change, so assume all of them do.
+    if (navigable->is_traversable())
+        navigable->traversable_navigable()->set_entire_viewport_damaged();
+
     if (auto container = navigable->container()) {
         container->document().invalidate_display_list();
     }
 }
 
+void Document::invalidate_display_list_within(CSSPixelRect const& viewport_damage_rect)
+{
+    auto navigable = this->navigable();
+    if (!navigable || !navigable->is_traversable()) {
+        invalidate_display_list();
+        return;
+    }
+
+    m_cached_display_list.clear();
+    navigable->traversable_navigable()->add_damage_rect(viewport_damage_rect);
+}
+
 RefPtr<Painting::DisplayList> Document::record_display_list(PaintConfig config)
 {
     if (m_cached_display_list && m_cached_display_list_paint_config == config) {
         return m_cached_display_list;
     }
 
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+
+    if (m_cached_display_list_paint_config != config)
+        ++m_display_list_generation;
+
     auto display_list = Painting::DisplayList::create();
     Painting::DisplayListRecorder display_list_recorder(display_list);
 
@@ -6437,6 +6637,7 @@ RefPtr<Painting::DisplayList> Document::record_display_list(PaintConfig config)
     context.set_should_show_line_box_borders(config.should_show_line_box_borders);
     context.set_should_paint_overlay(config.paint_overlay);
     context.set_has_focus(config.has_focus);
+    context.set_display_list_generation(m_display_list_generation);
 
     update_paint_and_hit_testing_properties_if_needed();
 
@@ -6444,6 +6645,7 @@ RefPtr<Painting::DisplayList> Document::record_display_list(PaintConfig config)
 
     viewport_paintable.refresh_scroll_state();
 
+    m_compositor_layers.clear();
     viewport_paintable.paint_all_phases(context);
 
     display_list->set_device_pixels_per_css_pixel(page().client().device_pixels_per_css_pixel());
@@ -6451,9 +6653,37 @@ RefPtr<Painting::DisplayList> Document::record_display_list(PaintConfig config)
     m_cached_display_list = display_list;
     m_cached_display_list_paint_config = config;
 
+    ++m_frame_statistics.number_of_display_lists_recorded;
+    m_frame_statistics.number_of_display_list_commands += display_list->commands().size();
+    m_frame_statistics.time_spent_recording_display_list += timer.elapsed_time();
+
     return display_list;
 }
 
+size_t Document::register_compositor_layer(Painting::PaintableBox const& paintable_box)
+{
+    m_compositor_layers.append(paintable_box);
+    return m_compositor_layers.size() - 1;
+}
+
+bool Document::is_compositor_layer(Painting::PaintableBox const& paintable_box) const
+{
+    return m_cached_display_list && m_compositor_layers.contains_slow(paintable_box);
+}
+
+Painting::CompositorLayerStateSnapshot Document::compositor_layer_state_snapshot()
+{
+    // NOTE: Animations of compositor layers only ask for their paint-only properties to be resolved again,
+    //       which would normally happen while recording the display list we've skipped.
+    update_paint_and_hit_testing_properties_if_needed();
+    return Painting::CompositorLayerStateSnapshot::create(m_compositor_layers, page().client().device_pixels_per_css_pixel());
+}
+
+void Document::finish_frame_statistics()
+{
+    m_last_frame_statistics = exchange(m_frame_statistics, {});
+}
+
 Unicode::Segmenter& Document::grapheme_segmenter() const
 {
     if (!m_grapheme_segmenter)
@@ -6559,6 +6789,22 @@ ElementByIdMap& Document::element_by_id() const
     return *m_element_by_id;
 }
 
+Optional<CSS::SelectorList> Document::parse_selector_for_scripting(StringView selector_text) const
+{
+    auto key = MUST(String::from_utf8(selector_text));
+    if (auto it = m_parsed_selectors_for_scripting.find(key); it != m_parsed_selectors_for_scripting.end())
+        return it->value;
+
+    // NOTE: Don't let scripts that generate lots of different selectors grow the cache without bound.
+    static constexpr size_t max_parsed_selectors_for_scripting = 256;
+    if (m_parsed_selectors_for_scripting.size() >= max_parsed_selectors_for_scripting)
+        m_parsed_selectors_for_scripting.clear();
+
+    auto selectors = parse_selector(CSS::Parser::ParsingParams { *this }, selector_text);
+    m_parsed_selectors_for_scripting.set(move(key), selectors);
+    return selectors;
+}
+
 GC::Ptr<Element> ElementByIdMap::get(FlyString const& element_id) const
 {
     if (auto elements = m_map.get(element_id); elements.has_value() && !elements->is_empty()) {
@@ -23,8 +23,11 @@
 #include <LibURL/URL.h>
 #include <LibUnicode/Forward.h>
 #include <LibWeb/CSS/CSSStyleSheet.h>
+#include <LibWeb/CSS/InvalidationSet.h>
+#include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/StyleSheetList.h>
 #include <LibWeb/Cookie/Cookie.h>
+#include <LibWeb/DOM/FrameStatistics.h>
 #include <LibWeb/DOM/ParentNode.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/HTML/BrowsingContext.h>
@@ -36,6 +39,7 @@
 #include <LibWeb/HTML/NavigationType.h>
 #include <LibWeb/HTML/SandboxingFlagSet.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/SpeculativeLoading.h>
 #include <LibWeb/HTML/VisibilityState.h>
 #include <LibWeb/InvalidateDisplayList.h>
 #include <LibWeb/TrustedTypes/InjectionSink.h>
@@ -52,6 +56,7 @@ enum class QuirksMode {
 
 #define ENUMERATE_INVALIDATE_LAYOUT_TREE_REASONS(X)       \
     X(DocumentAddAnElementToTheTopLayer)                  \
+    X(DocumentReactivate)                                 \
     X(DocumentRequestAnElementToBeRemovedFromTheTopLayer) \
     X(ShadowRootSetInnerHTML)
 
@@ -182,14 +187,30 @@ public:
 
     // AD-HOC: This number increments whenever a node is added or removed from the document, or an element attribute changes.
     //         It can be used as a crude invalidation mechanism for caches that depend on the DOM structure.
+    //         The mutated node is the parent of added or removed nodes, or the element whose attribute changed.
     u64 dom_tree_version() const { return m_dom_tree_version; }
-    void bump_dom_tree_version() { ++m_dom_tree_version; }
+    void bump_dom_tree_version(Node& mutated_node)
+    {
+        ++m_dom_tree_version;
+        ParentNode::bump_subtree_version_of_inclusive_ancestors(mutated_node);
+    }
 
     // AD-HOC: This number increments whenever CharacterData is modified in the document. It is used together with
     //         dom_tree_version() to understand whether either the DOM tree structure or contents were changed.
     u64 character_data_version() const { return m_character_data_version; }
     void bump_character_data_version() { ++m_character_data_version; }
 
+    // AD-HOC: Set once any node in this document has been given a registered observer. Until then, queueing a mutation
+    //         record can bail out before walking the target's ancestors.
+    bool may_have_registered_mutation_observers() const { return m_may_have_registered_mutation_observers; }
+    void set_may_have_registered_mutation_observers() { m_may_have_registered_mutation_observers = true; }
+
+    // AD-HOC: Remembers every event type that a listener has ever been added for on a node in this document or on its
+    //         window. If a type is absent, dispatching a UA-generated event of that type to this document cannot run
+    //         any script, so high-frequency input events can skip creating and dispatching the event entirely.
+    bool may_have_event_listeners_for(FlyString const& type) const { return m_event_types_with_listeners.contains(type); }
+    void did_add_event_listener(FlyString const& type) { m_event_types_with_listeners.set(type); }
+
     WebIDL::ExceptionOr<void> populate_with_html_head_and_body();
 
     GC::Ptr<Selection::Selection> get_selection() const;
@@ -402,6 +423,12 @@ public:
     Vector<GC::Root<HTML::HTMLScriptElement>> take_scripts_to_execute_in_order_as_soon_as_possible(Badge<HTML::HTMLParser>);
     Vector<GC::Ref<HTML::HTMLScriptElement>>& scripts_to_execute_in_order_as_soon_as_possible() { return m_scripts_to_execute_in_order_as_soon_as_possible; }
 
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#document-sr-sets
+    Vector<HTML::SpeculationRuleSet>& speculation_rule_sets() { return m_speculation_rule_sets; }
+    Vector<HTML::SpeculationRuleSet> const& speculation_rule_sets() const { return m_speculation_rule_sets; }
+
+    HashTable<URL::URL>& prefetched_urls() { return m_prefetched_urls; }
+
     QuirksMode mode() const { return m_quirks_mode; }
     bool in_quirks_mode() const { return m_quirks_mode == QuirksMode::Yes; }
     bool in_limited_quirks_mode() const { return m_quirks_mode == QuirksMode::Limited; }
@@ -649,6 +676,8 @@ public:
 
     // https://html.spec.whatwg.org/multipage/document-lifecycle.html#unload-a-document
     void unload(GC::Ptr<Document> new_document = nullptr);
+    bool is_eligible_for_back_forward_cache();
+    void reactivate();
     // https://html.spec.whatwg.org/multipage/document-lifecycle.html#unload-a-document-and-its-descendants
     void unload_a_document_and_its_descendants(GC::Ptr<Document> new_document, GC::Ptr<GC::Function<void()>> after_all_unloads = {});
 
@@ -692,6 +721,8 @@ public:
     HTML::ListOfAvailableImages& list_of_available_images();
     HTML::ListOfAvailableImages const& list_of_available_images() const;
 
+    HTML::MapOfPreloadedResources& map_of_preloaded_resources();
+
     void register_intersection_observer(Badge<IntersectionObserver::IntersectionObserver>, IntersectionObserver::IntersectionObserver&);
     void unregister_intersection_observer(Badge<IntersectionObserver::IntersectionObserver>, IntersectionObserver::IntersectionObserver&);
 
@@ -762,7 +793,7 @@ public:
     GC::RootVector<GC::Ref<Element>> elements_from_point(double x, double y);
     GC::Ptr<Element const> scrolling_element() const;
 
-    void set_needs_to_resolve_paint_only_properties() { m_needs_to_resolve_paint_only_properties = true; }
+    void set_needs_to_resolve_paint_only_properties();
     void set_needs_animated_style_update() { m_needs_animated_style_update = true; }
 
     virtual JS::Value named_item_value(FlyString const& name) const override;
@@ -830,7 +861,7 @@ public:
     void set_cached_navigable(GC::Ptr<HTML::Navigable>);
 
     void set_needs_display(InvalidateDisplayList = InvalidateDisplayList::Yes);
-    void set_needs_display(CSSPixelRect const&, InvalidateDisplayList = InvalidateDisplayList::Yes);
+    void set_needs_display(CSSPixelRect const& viewport_damage_rect, InvalidateDisplayList = InvalidateDisplayList::Yes);
 
     struct PaintConfig {
         bool paint_overlay { false };
@@ -842,7 +873,26 @@ public:
     };
     RefPtr<Painting::DisplayList> record_display_list(PaintConfig);
 
-    void invalidate_display_list();
+    // Callers that have invalidated the cached commands of the stacking contexts affected by their change can keep
+    // the ones of all other stacking contexts.
+    enum class DiscardCachedStackingContextCommands {
+        No,
+        Yes,
+    };
+    void invalidate_display_list(DiscardCachedStackingContextCommands = DiscardCachedStackingContextCommands::Yes);
+
+    size_t register_compositor_layer(Painting::PaintableBox const&);
+    size_t number_of_compositor_layers() const { return m_compositor_layers.size(); }
+    [[nodiscard]] bool is_compositor_layer(Painting::PaintableBox const&) const;
+    Painting::CompositorLayerStateSnapshot compositor_layer_state_snapshot();
+
+    // Like invalidate_display_list(), for callers that know the new display list only differs within the given part of the viewport.
+    void invalidate_display_list_within(CSSPixelRect const& viewport_damage_rect);
+
+    // Statistics of the rendering update in progress, and of the last one that finished.
+    FrameStatistics& frame_statistics() { return m_frame_statistics; }
+    FrameStatistics const& last_frame_statistics() const { return m_last_frame_statistics; }
+    void finish_frame_statistics();
 
     Unicode::Segmenter& grapheme_segmenter() const;
     Unicode::Segmenter& word_segmenter() const;
@@ -903,11 +953,23 @@ public:
 
     void schedule_ancestors_style_invalidation_due_to_presence_of_has(Node& node)
     {
-        m_pending_nodes_for_style_invalidation_due_to_presence_of_has.set(node.make_weak_ptr<Node>());
+        CSS::InvalidationSet any_anchor;
+        any_anchor.set_needs_invalidate_self();
+        schedule_ancestors_style_invalidation_due_to_presence_of_has(node, any_anchor);
+    }
+
+    // Only invalidates the ancestors that include properties from the given set, or all of them if it needs to invalidate self.
+    void schedule_ancestors_style_invalidation_due_to_presence_of_has(Node& node, CSS::InvalidationSet const& anchors)
+    {
+        m_pending_nodes_for_style_invalidation_due_to_presence_of_has.ensure(node.make_weak_ptr<Node>(), [] { return CSS::InvalidationSet {}; }).include_all_from(anchors);
     }
 
     ElementByIdMap& element_by_id() const;
 
+    // Parses a selector string passed to querySelector(), matches(), closest() and friends. Scripts tend to use the same
+    // handful of selectors over and over, so the results are cached.
+    Optional<CSS::SelectorList> parse_selector_for_scripting(StringView) const;
+
     auto& script_blocking_style_sheet_set() { return m_script_blocking_style_sheet_set; }
     auto const& script_blocking_style_sheet_set() const { return m_script_blocking_style_sheet_set; }
 
@@ -927,6 +989,8 @@ private:
 
     void update_active_element();
 
+    void schedule_repaint(Optional<CSSPixelRect> const& viewport_damage_rect);
+
     void run_unloading_cleanup_steps();
 
     void evaluate_media_rules();
@@ -969,6 +1033,7 @@ private:
     WeakPtr<HTML::BrowsingContext> m_browsing_context;
     URL::URL m_url;
     mutable OwnPtr<ElementByIdMap> m_element_by_id;
+    mutable HashMap<String, Optional<CSS::SelectorList>> m_parsed_selectors_for_scripting;
 
     GC::Ptr<HTML::Window> m_window;
 
@@ -1002,6 +1067,12 @@ private:
     // https://html.spec.whatwg.org/multipage/scripting.html#set-of-scripts-that-will-execute-as-soon-as-possible
     Vector<GC::Ref<HTML::HTMLScriptElement>> m_scripts_to_execute_as_soon_as_possible;
 
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#document-sr-sets
+    Vector<HTML::SpeculationRuleSet> m_speculation_rule_sets;
+
+    // The URLs that speculation rules have already prefetched, so that each is only fetched once.
+    HashTable<URL::URL> m_prefetched_urls;
+
     QuirksMode m_quirks_mode { QuirksMode::No };
 
     // https://dom.spec.whatwg.org/#concept-document-type
@@ -1139,6 +1210,9 @@ private:
     // https://html.spec.whatwg.org/multipage/images.html#list-of-available-images
     GC::Ptr<HTML::ListOfAvailableImages> m_list_of_available_images;
 
+    // https://html.spec.whatwg.org/multipage/links.html#map-of-preloaded-resources
+    GC::Ptr<HTML::MapOfPreloadedResources> m_map_of_preloaded_resources;
+
     GC::Ptr<CSS::VisualViewport> m_visual_viewport;
 
     // NOTE: Not in the spec per se, but Document must be able to access all IntersectionObservers whose root is in the document.
@@ -1203,6 +1277,10 @@ private:
     u64 m_dom_tree_version { 0 };
     u64 m_character_data_version { 0 };
 
+    bool m_may_have_registered_mutation_observers { false };
+
+    HashTable<FlyString> m_event_types_with_listeners;
+
     // https://drafts.csswg.org/css-position-4/#document-top-layer
     // Documents have a top layer, an ordered set containing elements from the document.
     // Elements in the top layer do not lay out normally based on their position in the document;
@@ -1237,6 +1315,15 @@ private:
     Optional<PaintConfig> m_cached_display_list_paint_config;
     RefPtr<Painting::DisplayList> m_cached_display_list;
 
+    // Commands cached by stacking contexts are only reused while this stays the same.
+    u64 m_display_list_generation { 0 };
+
+    // Stacking contexts promoted to compositor layers in the cached display list, indexed by layer ID.
+    Vector<GC::Ref<Painting::PaintableBox const>> m_compositor_layers;
+
+    FrameStatistics m_frame_statistics;
+    FrameStatistics m_last_frame_statistics;
+
     mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
     mutable OwnPtr<Unicode::Segmenter> m_word_segmenter;
 
@@ -1267,7 +1354,7 @@ private:
     // https://html.spec.whatwg.org/multipage/dom.html#render-blocking-element-set
     HashTable<GC::Ref<Element>> m_render_blocking_elements;
 
-    HashTable<WeakPtr<Node>> m_pending_nodes_for_style_invalidation_due_to_presence_of_has;
+    HashMap<WeakPtr<Node>, CSS::InvalidationSet> m_pending_nodes_for_style_invalidation_due_to_presence_of_has;
 };
 
 template<>
@@ -91,12 +91,14 @@ static WebIDL::ExceptionOr<GC::Ref<DOM::Document>> load_html_document(HTML::Navi
     //    document's relevant global object to have the parser to process the implied EOF character, which eventually
     //    causes a load event to be fired.
     else {
-        // FIXME: Parse as we receive the document data, instead of waiting for the whole document to be fetched first.
-        auto process_body = GC::create_function(document->heap(), [document, url = navigation_params.response->url().value(), mime_type = navigation_params.response->header_list()->extract_mime_type()](ByteBuffer data) {
-            Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(document->heap(), [document = document, data = move(data), url = url, mime_type] {
-                auto parser = HTML::HTMLParser::create_with_uncertain_encoding(document, data, mime_type);
-                parser->run(url);
-            }));
+        auto parser = HTML::HTMLParser::create_for_network_input(document, navigation_params.response->url().value(), navigation_params.response->header_list()->extract_mime_type());
+
+        auto process_body_chunk = GC::create_function(document->heap(), [parser](ByteBuffer bytes) {
+            parser->append_to_input_byte_stream(bytes);
+        });
+
+        auto process_end_of_body = GC::create_function(document->heap(), [parser] {
+            parser->finish_input_byte_stream();
         });
 
         auto process_body_error = GC::create_function(document->heap(), [](JS::Value) {
@@ -104,7 +106,7 @@ static WebIDL::ExceptionOr<GC::Ref<DOM::Document>> load_html_document(HTML::Navi
         });
 
         auto& realm = document->realm();
-        navigation_params.response->body()->fully_read(realm, process_body, process_body_error, GC::Ref { realm.global_object() });
+        navigation_params.response->body()->incrementally_read(process_body_chunk, process_end_of_body, process_body_error, GC::Ref { realm.global_object() });
     }
 
     // 4. Return document.
@@ -7,6 +7,7 @@
 
 #include <AK/AnyOf.h>
 #include <AK/Debug.h>
+#include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibUnicode/CharacterTypes.h>
@@ -588,7 +589,7 @@ void Element::run_attribute_change_steps(FlyString const& local_name, Optional<S
 
     if (old_value != value) {
         invalidate_style_after_attribute_change(local_name, old_value, value);
-        document().bump_dom_tree_version();
+        document().bump_dom_tree_version(*this);
     }
 }
 
@@ -601,9 +602,11 @@ static CSS::RequiredInvalidationAfterStyleChange compute_required_invalidation(C
 
     for (auto i = to_underlying(CSS::first_property_id); i <= to_underlying(CSS::last_property_id); ++i) {
         auto property_id = static_cast<CSS::PropertyID>(i);
-        auto old_value = old_style.maybe_null_property(property_id);
-        auto new_value = new_style.maybe_null_property(property_id);
-        if (!old_value && !new_value)
+        auto const* old_value = old_style.maybe_null_property(property_id);
+        auto const* new_value = new_style.maybe_null_property(property_id);
+        // OPTIMIZATION: Most properties of a restyled element end up with the very same inherited or initial value
+        //               object as before, so we can skip them without comparing or even ref'ing the values.
+        if (old_value == new_value)
             continue;
 
         invalidation |= CSS::compute_property_invalidation(property_id, old_value, new_value);
@@ -812,9 +815,10 @@ WebIDL::ExceptionOr<void> Element::attach_a_shadow_root(Bindings::ShadowRootMode
         return WebIDL::NotSupportedError::create(realm(), "Element's local name is not a valid shadow host name"_string);
 
     // 3. If element’s local name is a valid custom element name, or element’s is value is not null, then:
-    if (HTML::is_valid_custom_element_name(local_name()) || m_is_value.has_value()) {
+    auto is_value = this->is_value();
+    if (HTML::is_valid_custom_element_name(local_name()) || is_value.has_value()) {
         // 1. Let definition be the result of looking up a custom element definition given element’s node document, its namespace, its local name, and its is value.
-        auto definition = document().lookup_custom_element_definition(namespace_uri(), local_name(), m_is_value);
+        auto definition = document().lookup_custom_element_definition(namespace_uri(), local_name(), is_value);
 
         // 2. If definition is not null and definition’s disable shadow is true, then throw a "NotSupportedError" DOMException.
         if (definition && definition->disable_shadow())
@@ -900,7 +904,7 @@ GC::Ptr<ShadowRoot> Element::shadow_root_for_bindings() const
 WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 {
     // 1. Let s be the result of parse a selector from selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams(document()), selectors);
+    auto maybe_selectors = document().parse_selector_for_scripting(selectors);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -920,7 +924,7 @@ WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 WebIDL::ExceptionOr<DOM::Element const*> Element::closest(StringView selectors) const
 {
     // 1. Let s be the result of parse a selector from selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams(document()), selectors);
+    auto maybe_selectors = document().parse_selector_for_scripting(selectors);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -2705,7 +2709,7 @@ JS::ThrowCompletionOr<void> Element::upgrade_element(GC::Ref<HTML::CustomElement
 void Element::try_to_upgrade()
 {
     // 1. Let definition be the result of looking up a custom element definition given element's node document, element's namespace, element's local name, and element's is value.
-    auto definition = document().lookup_custom_element_definition(namespace_uri(), local_name(), m_is_value);
+    auto definition = document().lookup_custom_element_definition(namespace_uri(), local_name(), is_value());
 
     // 2. If definition is not null, then enqueue a custom element upgrade reaction given element and definition.
     if (definition)
@@ -2747,7 +2751,28 @@ void Element::setup_custom_element_from_constructor(HTML::CustomElementDefinitio
     m_custom_element_definition = custom_element_definition;
 
     // 7.8. Set element's is value to is value.
-    m_is_value = is_value;
+    set_is_value(is_value);
+}
+
+void Element::set_is_value(Optional<String> const& is)
+{
+    if (!is.has_value() && !m_rare_data)
+        return;
+    ensure_rare_data().is_value = is;
+}
+
+void Element::set_scroll_offset(ScrollOffsetFor type, CSSPixelPoint offset)
+{
+    if (offset.is_zero() && !m_rare_data)
+        return;
+    ensure_rare_data().scroll_offset[to_underlying(type)] = offset;
+}
+
+Element::RareData& Element::ensure_rare_data()
+{
+    if (!m_rare_data)
+        m_rare_data = make<RareData>();
+    return *m_rare_data;
 }
 
 void Element::set_prefix(Optional<FlyString> value)
@@ -3034,9 +3059,20 @@ bool Element::check_visibility(Optional<CheckVisibilityOptions> options)
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
     document().update_layout(UpdateLayoutReason::ElementCheckVisibility);
 
-    // 1. If this does not have an associated box, return false.
-    if (!paintable_box())
+    auto skipped_contents_due_to_content_visibility_auto = [&] {
+        for (auto* element = parent_element(); element; element = element->parent_element()) {
+            if (element->computed_properties()->content_visibility() == CSS::ContentVisibility::Auto && element->skips_its_contents())
+                return true;
+        }
         return false;
+    }();
+
+    // 1. If this does not have an associated box, return false.
+    // AD-HOC: Contents skipped due to content-visibility: auto don't get layout boxes, but they would have one otherwise.
+    if (!paintable_box()) {
+        if (!skipped_contents_due_to_content_visibility_auto || !computed_properties() || computed_properties()->display().is_none())
+            return false;
+    }
 
     // 2. If an ancestor of this in the flat tree has content-visibility: hidden, return false.
     for (auto element = parent_element(); element; element = element->parent_element()) {
@@ -3063,14 +3099,8 @@ bool Element::check_visibility(Optional<CheckVisibilityOptions> options)
     }
 
     // 5. If the contentVisibilityAuto dictionary member of options is true and an ancestor of this in the flat tree skips its contents due to content-visibility: auto, return false.
-    // FIXME: Currently we do not skip any content if content-visibility is auto: https://drafts.csswg.org/css-contain-2/#proximity-to-the-viewport
-    auto const skipped_contents_due_to_content_visibility_auto = false;
-    if (options->content_visibility_auto && skipped_contents_due_to_content_visibility_auto) {
-        for (auto* element = this; element; element = element->parent_element()) {
-            if (element->computed_properties()->content_visibility() == CSS::ContentVisibility::Auto)
-                return false;
-        }
-    }
+    if (options->content_visibility_auto && skipped_contents_due_to_content_visibility_auto)
+        return false;
 
     // 6. Return true.
     return true;
@@ -3079,6 +3109,14 @@ bool Element::check_visibility(Optional<CheckVisibilityOptions> options)
 // https://drafts.csswg.org/css-contain/#proximity-to-the-viewport
 void Element::determine_proximity_to_the_viewport()
 {
+    bool skipped_its_contents = skips_its_contents();
+    ScopeGuard update_layout_tree_if_skipping_changed = [&] {
+        // NOTE: Skipped contents don't get layout nodes at all, so the layout tree below this element has to be
+        //       built (or torn down) whenever it starts (or stops) skipping its contents.
+        if (skips_its_contents() != skipped_its_contents)
+            set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::ContentVisibilityRelevanceChange);
+    };
+
     // An element that has content-visibility: auto is in one of three states when it comes to its proximity to the viewport:
 
     // - The element is close to the viewport: In this state, the element is considered "on-screen": its paint
@@ -3089,8 +3127,10 @@ void Element::determine_proximity_to_the_viewport()
     // viewport soon. A margin of 50% is suggested as a reasonable default.
     viewport_rect.inflate(viewport_rect.width(), viewport_rect.height());
     // FIXME: We don't have paint containment or the overflow clip edge yet, so this is just using the absolute rect for now.
-    if (paintable_box()->absolute_rect().intersects(viewport_rect))
+    if (paintable_box()->absolute_rect().intersects(viewport_rect)) {
         m_proximity_to_the_viewport = ProximityToTheViewport::CloseToTheViewport;
+        return;
+    }
 
     // FIXME: If a filter (see [FILTER-EFFECTS-1]) with non local effects includes the element as part of its input, the user
     //        agent should also treat the element as relevant to the user when the filter’s output can affect the rendering
@@ -3183,6 +3223,11 @@ bool Element::has_size_containment() const
     if (computed_properties()->contain().size_containment)
         return true;
 
+    // https://drafts.csswg.org/css-contain-2/#skips-its-contents
+    // An element that skips its contents also has size containment.
+    if (const_cast<Element&>(*this).skips_its_contents())
+        return true;
+
     return false;
 }
 // https://drafts.csswg.org/css-contain-2/#containment-inline-size
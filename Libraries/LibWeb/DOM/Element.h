@@ -199,8 +199,8 @@ public:
     CSS::RequiredInvalidationAfterStyleChange recompute_style();
     CSS::RequiredInvalidationAfterStyleChange recompute_inherited_style();
 
-    Optional<CSS::PseudoElement> use_pseudo_element() const { return m_use_pseudo_element; }
-    void set_use_pseudo_element(Optional<CSS::PseudoElement> use_pseudo_element) { m_use_pseudo_element = move(use_pseudo_element); }
+    Optional<CSS::PseudoElement> use_pseudo_element() const { return m_rare_data ? m_rare_data->use_pseudo_element : Optional<CSS::PseudoElement> {}; }
+    void set_use_pseudo_element(Optional<CSS::PseudoElement> use_pseudo_element) { ensure_rare_data().use_pseudo_element = move(use_pseudo_element); }
 
     GC::Ptr<Layout::NodeWithStyle> layout_node();
     GC::Ptr<Layout::NodeWithStyle const> layout_node() const;
@@ -353,8 +353,8 @@ public:
     bool is_defined() const;
     bool is_custom() const;
 
-    Optional<String> const& is_value() const { return m_is_value; }
-    void set_is_value(Optional<String> const& is) { m_is_value = is; }
+    Optional<String> is_value() const { return m_rare_data ? m_rare_data->is_value : Optional<String> {}; }
+    void set_is_value(Optional<String> const& is);
 
     void set_custom_element_state(CustomElementState);
     void setup_custom_element_from_constructor(HTML::CustomElementDefinition& custom_element_definition, Optional<String> const& is_value);
@@ -375,8 +375,8 @@ public:
         PseudoBefore,
         PseudoAfter
     };
-    CSSPixelPoint scroll_offset(ScrollOffsetFor type) const { return m_scroll_offset[to_underlying(type)]; }
-    void set_scroll_offset(ScrollOffsetFor type, CSSPixelPoint offset) { m_scroll_offset[to_underlying(type)] = offset; }
+    CSSPixelPoint scroll_offset(ScrollOffsetFor type) const { return m_rare_data ? m_rare_data->scroll_offset[to_underlying(type)] : CSSPixelPoint {}; }
+    void set_scroll_offset(ScrollOffsetFor type, CSSPixelPoint offset);
 
     enum class Dir {
         Ltr,
@@ -538,7 +538,18 @@ private:
     Optional<PseudoElement&> get_pseudo_element(CSS::PseudoElement) const;
     PseudoElement& ensure_pseudo_element(CSS::PseudoElement) const;
 
-    Optional<CSS::PseudoElement> m_use_pseudo_element;
+    // State that only a small fraction of elements ever have. Keeping it out of line makes every other element
+    // smaller, which matters for documents with hundreds of thousands of nodes.
+    struct RareData {
+        Optional<CSS::PseudoElement> use_pseudo_element;
+
+        // https://dom.spec.whatwg.org/#concept-element-is-value
+        Optional<String> is_value;
+
+        Array<CSSPixelPoint, 3> scroll_offset;
+    };
+    OwnPtr<RareData> m_rare_data;
+    RareData& ensure_rare_data();
 
     Vector<FlyString> m_classes;
     Optional<Dir> m_dir;
@@ -557,15 +568,10 @@ private:
     // https://dom.spec.whatwg.org/#concept-element-custom-element-definition
     GC::Ptr<HTML::CustomElementDefinition> m_custom_element_definition;
 
-    // https://dom.spec.whatwg.org/#concept-element-is-value
-    Optional<String> m_is_value;
-
     // https://www.w3.org/TR/intersection-observer/#dom-element-registeredintersectionobservers-slot
     // Element objects have an internal [[RegisteredIntersectionObservers]] slot, which is initialized to an empty list.
     OwnPtr<Vector<IntersectionObserver::IntersectionObserverRegistration>> m_registered_intersection_observers;
 
-    Array<CSSPixelPoint, 3> m_scroll_offset;
-
     bool m_in_top_layer : 1 { false };
     bool m_rendered_in_top_layer : 1 { false };
     bool m_style_uses_css_custom_properties : 1 { false };
@@ -227,9 +227,15 @@ void EventTarget::add_an_event_listener(DOMEventListener& listener)
             && entry->callback->callback().callback == listener.callback->callback().callback
             && entry->capture == listener.capture;
     });
-    if (it == event_listener_list.end())
+    if (it == event_listener_list.end()) {
         event_listener_list.append(listener);
 
+        if (is<Node>(*this))
+            static_cast<Node&>(*this).document().did_add_event_listener(listener.type);
+        else if (is<HTML::Window>(*this))
+            static_cast<HTML::Window&>(*this).associated_document().did_add_event_listener(listener.type);
+    }
+
     // 6. If listener’s signal is not null, then add the following abort steps to it:
     if (listener.signal) {
         // NOTE: `this` and `listener` are protected by AbortSignal using GC::HeapFunction.
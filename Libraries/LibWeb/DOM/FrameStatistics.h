@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Time.h>
+#include <AK/Types.h>
+
+namespace Web::DOM {
+
+// Where the time of one rendering update of a document went, and how much work it did.
+// These are collected for every frame, so only cheap counters and coarse timings belong here.
+struct FrameStatistics {
+    AK::Duration time_spent_updating_style;
+    AK::Duration time_spent_updating_layout;
+    AK::Duration time_spent_recording_display_list;
+
+    size_t number_of_style_updates { 0 };
+    size_t number_of_elements_with_recomputed_style { 0 };
+    size_t number_of_elements_with_shared_matching_rules { 0 };
+    size_t number_of_rule_candidates_tested { 0 };
+
+    size_t number_of_layout_updates { 0 };
+    size_t number_of_layout_nodes_built { 0 };
+    size_t number_of_intrinsic_size_cache_hits { 0 };
+    size_t number_of_intrinsic_size_cache_misses { 0 };
+
+    size_t number_of_display_lists_recorded { 0 };
+    size_t number_of_display_list_commands { 0 };
+};
+
+}
@@ -76,8 +76,8 @@ void HTMLCollection::update_name_to_element_mappings_if_needed() const
 
 void HTMLCollection::update_cache_if_needed() const
 {
-    // Nothing to do, the DOM hasn't updated since we last built the cache.
-    if (m_cached_dom_tree_version == root()->document().dom_tree_version())
+    // Nothing to do, our subtree hasn't changed since we last built the cache.
+    if (m_cached_subtree_version == root()->subtree_version())
         return;
 
     m_cached_elements.clear();
@@ -95,7 +95,7 @@ void HTMLCollection::update_cache_if_needed() const
             return IterationDecision::Continue;
         });
     }
-    m_cached_dom_tree_version = root()->document().dom_tree_version();
+    m_cached_subtree_version = root()->subtree_version();
 }
 
 GC::RootVector<GC::Ref<Element>> HTMLCollection::collect_matching_elements() const
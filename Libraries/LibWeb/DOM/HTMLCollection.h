@@ -59,7 +59,7 @@ private:
     void update_cache_if_needed() const;
     void update_name_to_element_mappings_if_needed() const;
 
-    mutable u64 m_cached_dom_tree_version { 0 };
+    mutable Optional<u64> m_cached_subtree_version;
     mutable Vector<GC::Ref<Element>> m_cached_elements;
     mutable OwnPtr<OrderedHashMap<FlyString, GC::Ref<Element>>> m_cached_name_to_element_mappings;
 
@@ -233,7 +233,7 @@ void Node::set_text_content(Optional<String> const& maybe_content)
         set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeSetTextContent);
     }
 
-    document().bump_dom_tree_version();
+    document().bump_dom_tree_version(*this);
 }
 
 // https://dom.spec.whatwg.org/#dom-node-normalize
@@ -454,28 +454,32 @@ void Node::invalidate_style(StyleInvalidationReason reason)
 
     set_entire_subtree_needs_style_update(true);
 
-    if (reason == StyleInvalidationReason::NodeInsertBefore || reason == StyleInvalidationReason::NodeRemove) {
-        for (auto* sibling = previous_sibling(); sibling; sibling = sibling->previous_sibling()) {
-            if (auto* element = as_if<Element>(sibling); element && element->style_affected_by_structural_changes())
-                element->set_entire_subtree_needs_style_update(true);
+    // NOTE: When several nodes are inserted next to each other at once, the siblings have already been invalidated
+    //       along with the first of them, since they're the same siblings at the same distances.
+    if (reason != StyleInvalidationReason::NodeInsertBeforeFollowingInsertedSibling) {
+        if (reason == StyleInvalidationReason::NodeInsertBefore || reason == StyleInvalidationReason::NodeRemove) {
+            for (auto* sibling = previous_sibling(); sibling; sibling = sibling->previous_sibling()) {
+                if (auto* element = as_if<Element>(sibling); element && element->style_affected_by_structural_changes())
+                    element->set_entire_subtree_needs_style_update(true);
+            }
         }
-    }
 
-    size_t current_sibling_distance = 1;
-    for (auto* sibling = next_sibling(); sibling; sibling = sibling->next_sibling()) {
-        if (auto* element = as_if<Element>(sibling)) {
-            bool needs_to_invalidate = false;
-            if (reason == StyleInvalidationReason::NodeInsertBefore || reason == StyleInvalidationReason::NodeRemove) {
-                needs_to_invalidate = element->style_affected_by_structural_changes();
-            } else if (element->affected_by_indirect_sibling_combinator() || element->affected_by_nth_child_pseudo_class()) {
-                needs_to_invalidate = true;
-            } else if (element->affected_by_direct_sibling_combinator() && current_sibling_distance <= element->sibling_invalidation_distance()) {
-                needs_to_invalidate = true;
-            }
-            if (needs_to_invalidate) {
-                element->set_entire_subtree_needs_style_update(true);
+        size_t current_sibling_distance = 1;
+        for (auto* sibling = next_sibling(); sibling; sibling = sibling->next_sibling()) {
+            if (auto* element = as_if<Element>(sibling)) {
+                bool needs_to_invalidate = false;
+                if (reason == StyleInvalidationReason::NodeInsertBefore || reason == StyleInvalidationReason::NodeRemove) {
+                    needs_to_invalidate = element->style_affected_by_structural_changes();
+                } else if (element->affected_by_indirect_sibling_combinator() || element->affected_by_nth_child_pseudo_class()) {
+                    needs_to_invalidate = true;
+                } else if (element->affected_by_direct_sibling_combinator() && current_sibling_distance <= element->sibling_invalidation_distance()) {
+                    needs_to_invalidate = true;
+                }
+                if (needs_to_invalidate) {
+                    element->set_entire_subtree_needs_style_update(true);
+                }
+                current_sibling_distance++;
             }
-            current_sibling_distance++;
         }
     }
 
@@ -490,12 +494,17 @@ void Node::invalidate_style(StyleInvalidationReason reason, Vector<CSS::Invalida
     if (is_character_data())
         return;
 
+    // Only the anchors of :has() selectors whose arguments use one of the changed properties need to be invalidated.
     bool properties_used_in_has_selectors = false;
+    CSS::InvalidationSet has_anchors;
     for (auto const& property : properties) {
-        properties_used_in_has_selectors |= document().style_computer().invalidation_property_used_in_has_selector(property);
+        if (!document().style_computer().invalidation_property_used_in_has_selector(property))
+            continue;
+        properties_used_in_has_selectors = true;
+        has_anchors.include_all_from(document().style_computer().has_anchor_invalidation_set_for_property(property));
     }
     if (properties_used_in_has_selectors) {
-        document().schedule_ancestors_style_invalidation_due_to_presence_of_has(*this);
+        document().schedule_ancestors_style_invalidation_due_to_presence_of_has(*this, has_anchors);
     }
 
     auto invalidation_set = document().style_computer().invalidation_set_for_properties(properties);
@@ -734,7 +743,14 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
         // 6. Run assign slottables for a tree with node’s root.
         assign_slottables_for_a_tree(node_to_insert->root());
 
-        node_to_insert->invalidate_style(StyleInvalidationReason::NodeInsertBefore);
+        // NOTE: Nodes that aren't connected have no style to invalidate. Their entire subtree gets invalidated once they
+        //       are inserted into a document.
+        // OPTIMIZATION: All of nodes end up next to each other, so only the first one needs to invalidate its siblings.
+        //               Doing that for every node would be quadratic in the number of nodes inserted.
+        if (node_to_insert->is_connected()) {
+            auto is_first_node_to_insert = node_to_insert.ptr() == nodes.first().ptr();
+            node_to_insert->invalidate_style(is_first_node_to_insert ? StyleInvalidationReason::NodeInsertBefore : StyleInvalidationReason::NodeInsertBeforeFollowingInsertedSibling);
+        }
 
         // 7. For each shadow-including inclusive descendant inclusiveDescendant of node, in shadow-including tree order:
         node_to_insert->for_each_shadow_including_inclusive_descendant([&](Node& inclusive_descendant) {
@@ -802,7 +818,7 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
         set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeInsertBefore);
     }
 
-    document().bump_dom_tree_version();
+    document().bump_dom_tree_version(*this);
 }
 
 // https://dom.spec.whatwg.org/#concept-node-pre-insert
@@ -1012,7 +1028,7 @@ void Node::remove(bool suppress_observers)
     // 17. Run the children changed steps for parent.
     parent->children_changed(nullptr);
 
-    document().bump_dom_tree_version();
+    document().bump_dom_tree_version(*parent);
 }
 
 // https://dom.spec.whatwg.org/#concept-node-replace
@@ -1339,7 +1355,8 @@ WebIDL::ExceptionOr<void> Node::move_node(Node& new_parent, Node* child)
     // 26. Queue a tree mutation record for newParent with « node », « », newPreviousSibling, and child.
     new_parent.queue_tree_mutation_record({ *this }, {}, new_previous_sibling, child);
 
-    document().bump_dom_tree_version();
+    document().bump_dom_tree_version(*old_parent);
+    document().bump_dom_tree_version(new_parent);
 
     return {};
 }
@@ -1502,6 +1519,14 @@ void Node::set_document(Document& document)
 
     m_document = &document;
 
+    if (m_registered_observer_list && !m_registered_observer_list->is_empty())
+        document.set_may_have_registered_mutation_observers();
+
+    if (has_event_listeners()) {
+        for (auto& listener : event_listener_list())
+            document.did_add_event_listener(listener->type);
+    }
+
     if (needs_style_update() || child_needs_style_update()) {
         // NOTE: We unset and reset the "needs style update" flag here.
         //       This ensures that there's a pending style update in the new document
@@ -2456,6 +2481,10 @@ void Node::queue_mutation_record(FlyString const& type, Optional<FlyString> cons
     auto& document = this->document();
     auto& page = document.page();
 
+    // OPTIMIZATION: No node in this document has ever been observed, so there cannot be any interested observers.
+    if (!document.may_have_registered_mutation_observers() && !page.listen_for_dom_mutations())
+        return;
+
     // NOTE: We defer garbage collection until the end of the scope, since we can't safely use MutationObserver* as a hashmap key otherwise.
     // FIXME: This is a total hack.
     GC::DeferGC defer_gc(heap());
@@ -3104,6 +3133,7 @@ void Node::add_registered_observer(RegisteredObserver& registered_observer)
     if (!m_registered_observer_list)
         m_registered_observer_list = make<Vector<GC::Ref<RegisteredObserver>>>();
     m_registered_observer_list->append(registered_observer);
+    document().set_may_have_registered_mutation_observers();
 }
 
 bool Node::has_inclusive_ancestor_with_display_none()
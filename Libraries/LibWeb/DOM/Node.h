@@ -74,6 +74,7 @@ enum class ShouldComputeRole {
     X(MediaQueryChangedMatchState)                  \
     X(NavigableSetViewportSize)                     \
     X(NodeInsertBefore)                             \
+    X(NodeInsertBeforeFollowingInsertedSibling)     \
     X(NodeRemove)                                   \
     X(NodeSetTextContent)                           \
     X(Other)                                        \
@@ -111,6 +112,7 @@ enum class SetNeedsLayoutReason {
 [[nodiscard]] StringView to_string(SetNeedsLayoutReason);
 
 #define ENUMERATE_SET_NEEDS_LAYOUT_TREE_UPDATE_REASONS(X) \
+    X(ContentVisibilityRelevanceChange)                   \
     X(ElementSetInnerHTML)                                \
     X(DetailsElementOpenedOrClosed)                       \
     X(HTMLInputElementSrcAttribute)                       \
@@ -52,7 +52,7 @@ static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_m
 {
     // To scope-match a selectors string selectors against a node, run these steps:
     // 1. Let s be the result of parse a selector selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams { node.document() }, selector_text);
+    auto maybe_selectors = node.document().parse_selector_for_scripting(selector_text);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -104,6 +104,17 @@ WebIDL::ExceptionOr<GC::Ref<NodeList>> ParentNode::query_selector_all(StringView
     return TRY(scope_match_a_selectors_string(*this, selector_text, ReturnMatches::All)).get<GC::Ref<NodeList>>();
 }
 
+// NOTE: This counter is shared by all documents, so that a node adopted into another document can never end up with a
+//       version that a cache has already seen.
+static u64 s_last_subtree_version = 0;
+
+void ParentNode::bump_subtree_version_of_inclusive_ancestors(Node& node)
+{
+    auto version = ++s_last_subtree_version;
+    for (auto* ancestor = node.is_parent_node() ? &node : node.parent(); ancestor; ancestor = ancestor->parent())
+        static_cast<ParentNode&>(*ancestor).m_subtree_version = version;
+}
+
 GC::Ptr<Element> ParentNode::first_element_child()
 {
     return first_child_of_type<Element>();
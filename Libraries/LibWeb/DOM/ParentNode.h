@@ -41,6 +41,12 @@ public:
 
     GC::Ptr<Element> get_element_by_id(FlyString const& id) const;
 
+    // AD-HOC: This changes whenever a node is added to or removed from this node's subtree, or an element attribute in it
+    //         changes. Caches that only depend on this subtree can use it instead of the document's dom_tree_version(),
+    //         so that they aren't invalidated by mutations elsewhere in the document.
+    u64 subtree_version() const { return m_subtree_version; }
+    static void bump_subtree_version_of_inclusive_ancestors(Node&);
+
 protected:
     ParentNode(JS::Realm& realm, Document& document, NodeType type)
         : Node(realm, document, type)
@@ -56,6 +62,7 @@ protected:
 
 private:
     GC::Ptr<HTMLCollection> m_children;
+    u64 m_subtree_version { 0 };
 };
 
 template<>
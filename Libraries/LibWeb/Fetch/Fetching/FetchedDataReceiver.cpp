@@ -36,13 +36,11 @@ void FetchedDataReceiver::visit_edges(Visitor& visitor)
 
 void FetchedDataReceiver::set_pending_promise(GC::Ref<WebIDL::Promise> promise)
 {
-    auto had_pending_promise = m_pending_promise != nullptr;
     m_pending_promise = promise;
 
-    if (!had_pending_promise && !m_buffer.is_empty()) {
-        on_data_received(m_buffer);
-        m_buffer.clear();
-    }
+    // Pull whatever has been buffered so far, e.g. data that arrived before the stream first asked for it.
+    if (!m_buffer.is_empty() && !m_has_queued_pull_task)
+        queue_pull_task();
 }
 
 // This implements the parallel steps of the pullAlgorithm in HTTP-network-fetch.
@@ -53,22 +51,37 @@ void FetchedDataReceiver::on_data_received(ReadonlyBytes bytes)
     //           is suspended, resume the fetch.
     // FIXME: 2. Wait until buffer is not empty.
 
+    m_buffer.append(bytes);
+
     // If the remote end sends data immediately after we receive headers, we will often get that data here before the
     // stream tasks have all been queued internally. Just hold onto that data.
-    if (!m_pending_promise) {
-        m_buffer.append(bytes);
+    if (!m_pending_promise)
+        return;
+
+    // OPTIMIZATION: The queued task pulls everything that has been buffered by the time it runs. So data arriving in
+    //               many small pieces is coalesced into fewer, larger chunks, each of which costs a task and a
+    //               Uint8Array to enqueue and read.
+    if (m_has_queued_pull_task)
         return;
-    }
+
+    queue_pull_task();
+}
+
+void FetchedDataReceiver::queue_pull_task()
+{
+    m_has_queued_pull_task = true;
 
     // 3. Queue a fetch task to run the following steps, with fetchParams’s task destination.
     Infrastructure::queue_fetch_task(
         m_fetch_params->controller(),
         m_fetch_params->task_destination().get<GC::Ref<JS::Object>>(),
-        GC::create_function(heap(), [this, bytes = MUST(ByteBuffer::copy(bytes))]() mutable {
+        GC::create_function(heap(), [this]() {
+            m_has_queued_pull_task = false;
+
             HTML::TemporaryExecutionContext execution_context { m_stream->realm(), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
 
             // 1. Pull from bytes buffer into stream.
-            if (auto result = m_stream->pull_from_bytes(move(bytes)); result.is_error()) {
+            if (auto result = m_stream->pull_from_bytes(m_buffer); result.is_error()) {
                 auto throw_completion = Bindings::exception_to_throw_completion(m_stream->vm(), result.release_error());
 
                 dbgln("FetchedDataReceiver: Stream error pulling bytes");
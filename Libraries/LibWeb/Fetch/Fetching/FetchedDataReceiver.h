@@ -28,10 +28,13 @@ private:
 
     virtual void visit_edges(Visitor& visitor) override;
 
+    void queue_pull_task();
+
     GC::Ref<Infrastructure::FetchParams const> m_fetch_params;
     GC::Ref<Streams::ReadableStream> m_stream;
     GC::Ptr<WebIDL::Promise> m_pending_promise;
     ByteBuffer m_buffer;
+    bool m_has_queued_pull_task { false };
 };
 
 }
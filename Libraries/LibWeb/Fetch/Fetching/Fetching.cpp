@@ -44,6 +44,7 @@
 #include <LibWeb/FileAPI/Blob.h>
 #include <LibWeb/FileAPI/BlobURLStore.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/MapOfPreloadedResources.h>
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/Window.h>
@@ -77,6 +78,49 @@ bool g_http_cache_enabled;
         _temporary_result.release_value();                                                           \
     })
 
+// AD-HOC: Resources that block rendering are needed first, and media that is not needed to display the page (or a
+//         beacon, that nobody is waiting for) can wait until everything else has been fetched.
+static Infrastructure::Request::InternalPriority determine_the_internal_priority(Infrastructure::Request const& request)
+{
+    auto network_priority = [&] {
+        switch (request.priority()) {
+        case Infrastructure::Request::Priority::High:
+            return Requests::RequestPriority::High;
+        case Infrastructure::Request::Priority::Low:
+            return Requests::RequestPriority::Low;
+        case Infrastructure::Request::Priority::Auto:
+            break;
+        }
+
+        if (request.render_blocking())
+            return Requests::RequestPriority::High;
+
+        if (request.keepalive())
+            return Requests::RequestPriority::Low;
+
+        if (!request.destination().has_value())
+            return Requests::RequestPriority::Normal;
+
+        switch (*request.destination()) {
+        case Infrastructure::Request::Destination::Document:
+        case Infrastructure::Request::Destination::Font:
+        case Infrastructure::Request::Destination::Frame:
+        case Infrastructure::Request::Destination::IFrame:
+        case Infrastructure::Request::Destination::Style:
+            return Requests::RequestPriority::High;
+        case Infrastructure::Request::Destination::Audio:
+        case Infrastructure::Request::Destination::Image:
+        case Infrastructure::Request::Destination::Track:
+        case Infrastructure::Request::Destination::Video:
+            return Requests::RequestPriority::Low;
+        default:
+            return Requests::RequestPriority::Normal;
+        }
+    }();
+
+    return { .network_priority = network_priority };
+}
+
 // https://fetch.spec.whatwg.org/#concept-fetch
 WebIDL::ExceptionOr<GC::Ref<Infrastructure::FetchController>> fetch(JS::Realm& realm, Infrastructure::Request& request, Infrastructure::FetchAlgorithms const& algorithms, UseParallelQueue use_parallel_queue)
 {
@@ -165,13 +209,15 @@ WebIDL::ExceptionOr<GC::Ref<Infrastructure::FetchController>> fetch(JS::Realm& r
         //    response: set fetchParams’s preloaded response candidate to response.
         auto on_preloaded_response_available = GC::create_function(realm.heap(), [fetch_params](GC::Ref<Infrastructure::Response> response) {
             fetch_params->set_preloaded_response_candidate(response);
+            if (auto pending_response = fetch_params->pending_preloaded_response())
+                pending_response->resolve(response);
         });
 
-        // FIXME: 3. Let foundPreloadedResource be the result of invoking consume a preloaded resource for request’s
+        // 3. Let foundPreloadedResource be the result of invoking consume a preloaded resource for request’s
         //    window, given request’s URL, request’s destination, request’s mode, request’s credentials mode,
         //    request’s integrity metadata, and onPreloadedResponseAvailable.
-        auto found_preloaded_resource = false;
-        (void)on_preloaded_response_available;
+        auto& window = as<HTML::Window>(request.window().get<GC::Ptr<HTML::EnvironmentSettingsObject>>()->global_object());
+        auto found_preloaded_resource = window.associated_document().map_of_preloaded_resources().consume(HTML::MapOfPreloadedResources::Key::for_request(request), request.integrity_metadata(), on_preloaded_response_available);
 
         // 4. If foundPreloadedResource is true and fetchParams’s preloaded response candidate is null, then set
         //    fetchParams’s preloaded response candidate to "pending".
@@ -253,6 +299,8 @@ WebIDL::ExceptionOr<GC::Ref<Infrastructure::FetchController>> fetch(JS::Realm& r
     //     in setting request’s priority to a user-agent-defined object.
     // NOTE: The user-agent-defined object could encompass stream weight and dependency for HTTP/2, and equivalent
     //       information used to prioritize dispatch and processing of HTTP/1 fetches.
+    if (!request.internal_priority().has_value())
+        request.set_internal_priority(determine_the_internal_priority(request));
 
     // 16. If request is a subresource request, then:
     if (request.is_subresource_request()) {
@@ -345,9 +393,13 @@ WebIDL::ExceptionOr<GC::Ptr<PendingResponse>> main_fetch(JS::Realm& realm, Infra
         // -> fetchParams’s preloaded response candidate is not null
         if (!fetch_params.preloaded_response_candidate().has<Empty>()) {
             // 1. Wait until fetchParams’s preloaded response candidate is not "pending".
-            HTML::main_thread_event_loop().spin_until(GC::create_function(vm.heap(), [&] {
-                return !fetch_params.preloaded_response_candidate().has<Infrastructure::FetchParams::PreloadedResponseCandidatePendingTag>();
-            }));
+            // NOTE: Rather than spinning the event loop, we return a pending response that onPreloadedResponseAvailable
+            //       resolves once the preload has a response.
+            if (fetch_params.preloaded_response_candidate().has<Infrastructure::FetchParams::PreloadedResponseCandidatePendingTag>()) {
+                auto pending_response = PendingResponse::create(vm, request);
+                fetch_params.set_pending_preloaded_response(pending_response);
+                return pending_response;
+            }
 
             // 2. Assert: fetchParams’s preloaded response candidate is a response.
             VERIFY(fetch_params.preloaded_response_candidate().has<GC::Ref<Infrastructure::Response>>());
@@ -1843,8 +1895,10 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> http_network_or_cache_fetch(JS::Re
         // 13. Append the Fetch metadata headers for httpRequest.
         append_fetch_metadata_headers_for_request(*http_request);
 
-        // 14. FIXME If httpRequest’s initiator is "prefetch", then set a structured field value
+        // 14. If httpRequest’s initiator is "prefetch", then set a structured field value
         //     given (`Sec-Purpose`, the token prefetch) in httpRequest’s header list.
+        if (http_request->initiator() == Infrastructure::Request::Initiator::Prefetch)
+            http_request->header_list()->set(Infrastructure::Header::from_string_pair("Sec-Purpose"sv, "prefetch"sv));
 
         // 15. If httpRequest’s header list does not contain `User-Agent`, then user agents should append
         //     (`User-Agent`, default `User-Agent` value) to httpRequest’s header list.
@@ -2298,6 +2352,8 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
     load_request.set_url(request->current_url());
     load_request.set_page(page);
     load_request.set_method(ByteString::copy(request->method()));
+    if (request->internal_priority().has_value())
+        load_request.set_priority(request->internal_priority()->network_priority);
 
     for (auto const& header : *request->header_list())
         load_request.set_header(ByteString::copy(header.name), ByteString::copy(header.value));
@@ -2385,7 +2441,10 @@ WebIDL::ExceptionOr<GC::Ref<PendingResponse>> nonstandard_resource_loader_file_o
             }
 
             // 14. Set response’s body to a new body whose stream is stream.
-            response->set_body(Infrastructure::Body::create(vm, stream));
+            auto body = Infrastructure::Body::create(vm, stream);
+            if (auto length = response->header_list()->extract_length(); length.has<u64>())
+                body->set_expected_length(length.get<u64>());
+            response->set_body(body);
 
             // 17. Return response.
             // NOTE: Typically response’s body’s stream is still being enqueued to after returning.
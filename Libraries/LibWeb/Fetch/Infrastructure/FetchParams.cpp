@@ -6,6 +6,7 @@
 
 #include <LibGC/Heap.h>
 #include <LibJS/Runtime/VM.h>
+#include <LibWeb/Fetch/Fetching/PendingResponse.h>
 #include <LibWeb/Fetch/Infrastructure/FetchParams.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
 
@@ -40,6 +41,7 @@ void FetchParams::visit_edges(JS::Cell::Visitor& visitor)
         visitor.visit(m_task_destination.get<GC::Ref<JS::Object>>());
     if (m_preloaded_response_candidate.has<GC::Ref<Response>>())
         visitor.visit(m_preloaded_response_candidate.get<GC::Ref<Response>>());
+    visitor.visit(m_pending_preloaded_response);
 }
 
 // https://fetch.spec.whatwg.org/#fetch-params-aborted
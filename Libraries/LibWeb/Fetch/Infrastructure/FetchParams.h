@@ -15,6 +15,7 @@
 #include <LibWeb/Fetch/Infrastructure/FetchTimingInfo.h>
 #include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
 #include <LibWeb/Fetch/Infrastructure/Task.h>
+#include <LibWeb/Forward.h>
 
 namespace Web::Fetch::Infrastructure {
 
@@ -47,6 +48,9 @@ public:
     [[nodiscard]] PreloadedResponseCandidate const& preloaded_response_candidate() const { return m_preloaded_response_candidate; }
     void set_preloaded_response_candidate(PreloadedResponseCandidate preloaded_response_candidate) { m_preloaded_response_candidate = move(preloaded_response_candidate); }
 
+    [[nodiscard]] GC::Ptr<Fetching::PendingResponse> pending_preloaded_response() const { return m_pending_preloaded_response; }
+    void set_pending_preloaded_response(GC::Ptr<Fetching::PendingResponse> pending_response) { m_pending_preloaded_response = pending_response; }
+
     [[nodiscard]] bool is_aborted() const;
     [[nodiscard]] bool is_canceled() const;
 
@@ -99,6 +103,10 @@ private:
     // preloaded response candidate (default null)
     //     Null, "pending", or a response.
     PreloadedResponseCandidate m_preloaded_response_candidate;
+
+    // AD-HOC: The pending response main fetch returned while the preloaded response candidate was "pending". It is
+    //         resolved with the preloaded response once that is available, instead of spinning the event loop.
+    GC::Ptr<Fetching::PendingResponse> m_pending_preloaded_response;
 };
 
 }
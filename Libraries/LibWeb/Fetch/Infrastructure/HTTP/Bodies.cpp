@@ -60,7 +60,9 @@ GC::Ref<Body> Body::clone(JS::Realm& realm)
     m_stream = out1;
 
     // 3. Return a body whose stream is out2 and other members are copied from body.
-    return Body::create(realm.vm(), *out2, m_source, m_length);
+    auto body = Body::create(realm.vm(), *out2, m_source, m_length);
+    body->set_expected_length(m_expected_length);
+    return body;
 }
 
 // https://fetch.spec.whatwg.org/#body-fully-read
@@ -99,7 +101,7 @@ void Body::fully_read(JS::Realm& realm, Web::Fetch::Infrastructure::Body::Proces
     }
 
     // 5. Read all bytes from reader, given successSteps and errorSteps.
-    reader.value()->read_all_bytes(GC::create_function(realm.heap(), move(success_steps)), GC::create_function(realm.heap(), move(error_steps)));
+    reader.value()->read_all_bytes(GC::create_function(realm.heap(), move(success_steps)), GC::create_function(realm.heap(), move(error_steps)), m_length.has_value() ? m_length : m_expected_length);
 }
 
 // https://fetch.spec.whatwg.org/#body-incrementally-read
@@ -44,6 +44,11 @@ public:
     [[nodiscard]] SourceType const& source() const { return m_source; }
     [[nodiscard]] Optional<u64> const& length() const { return m_length; }
 
+    // AD-HOC: The number of bytes the body is expected to have, e.g. from a Content-Length header. This is only used
+    //         to size buffers when reading the body, and may be wrong.
+    [[nodiscard]] Optional<u64> const& expected_length() const { return m_expected_length; }
+    void set_expected_length(Optional<u64> expected_length) { m_expected_length = expected_length; }
+
     [[nodiscard]] GC::Ref<Body> clone(JS::Realm&);
 
     void fully_read(JS::Realm&, ProcessBodyCallback process_body, ProcessBodyErrorCallback process_body_error, TaskDestination task_destination) const;
@@ -67,6 +72,8 @@ private:
     // https://fetch.spec.whatwg.org/#concept-body-total-bytes
     // A length (null or an integer), initially null.
     Optional<u64> m_length;
+
+    Optional<u64> m_expected_length;
 };
 
 // https://fetch.spec.whatwg.org/#body-with-type
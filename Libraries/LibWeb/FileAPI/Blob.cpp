@@ -28,9 +28,16 @@ namespace Web::FileAPI {
 
 GC_DEFINE_ALLOCATOR(Blob);
 
+static constexpr size_t BLOB_STREAM_CHUNK_SIZE = 64 * KiB;
+
 GC::Ref<Blob> Blob::create(JS::Realm& realm, ByteBuffer byte_buffer, String type)
 {
-    return realm.create<Blob>(realm, move(byte_buffer), move(type));
+    return realm.create<Blob>(realm, BlobByteSequence::create(move(byte_buffer)), move(type));
+}
+
+GC::Ref<Blob> Blob::create(JS::Realm& realm, BlobByteSequence byte_sequence, String type)
+{
+    return realm.create<Blob>(realm, move(byte_sequence), move(type));
 }
 
 // https://w3c.github.io/FileAPI/#convert-line-endings-to-native
@@ -81,8 +88,13 @@ ErrorOr<String> convert_line_endings_to_native(StringView string)
 }
 
 // https://w3c.github.io/FileAPI/#process-blob-parts
-ErrorOr<ByteBuffer> process_blob_parts(Vector<BlobPart> const& blob_parts, Optional<BlobPropertyBag> const& options)
+ErrorOr<BlobByteSequence> process_blob_parts(Vector<BlobPart> const& blob_parts, Optional<BlobPropertyBag> const& options)
 {
+    // NOTE: A Blob made out of nothing but another Blob refers to the same bytes, so there is no need to copy them. This
+    //       is notably the case for every File created from the contents of a selected file.
+    if (blob_parts.size() == 1 && blob_parts.first().has<GC::Root<Blob>>())
+        return blob_parts.first().get<GC::Root<Blob>>()->byte_sequence();
+
     // 1. Let bytes be an empty sequence of bytes.
     ByteBuffer bytes {};
 
@@ -113,7 +125,7 @@ ErrorOr<ByteBuffer> process_blob_parts(Vector<BlobPart> const& blob_parts, Optio
             }));
     }
     // 3. Return bytes.
-    return bytes;
+    return BlobByteSequence::create(move(bytes));
 }
 
 bool is_basic_latin(StringView view)
@@ -130,16 +142,16 @@ Blob::Blob(JS::Realm& realm)
 {
 }
 
-Blob::Blob(JS::Realm& realm, ByteBuffer byte_buffer, String type)
+Blob::Blob(JS::Realm& realm, BlobByteSequence byte_sequence, String type)
     : PlatformObject(realm)
-    , m_byte_buffer(move(byte_buffer))
+    , m_byte_sequence(move(byte_sequence))
     , m_type(move(type))
 {
 }
 
-Blob::Blob(JS::Realm& realm, ByteBuffer byte_buffer)
+Blob::Blob(JS::Realm& realm, BlobByteSequence byte_sequence)
     : PlatformObject(realm)
-    , m_byte_buffer(move(byte_buffer))
+    , m_byte_sequence(move(byte_sequence))
 {
 }
 
@@ -162,7 +174,7 @@ WebIDL::ExceptionOr<void> Blob::serialization_steps(HTML::SerializationRecord& r
     TRY(HTML::serialize_string(vm, record, m_type));
 
     // 2. Set serialized.[[ByteSequence]] to value’s underlying byte sequence.
-    TRY(HTML::serialize_bytes(vm, record, m_byte_buffer.bytes()));
+    TRY(HTML::serialize_bytes(vm, record, m_byte_sequence.bytes()));
 
     return {};
 }
@@ -178,7 +190,7 @@ WebIDL::ExceptionOr<void> Blob::deserialization_steps(ReadonlySpan<u32> const& r
     m_type = TRY(HTML::deserialize_string(vm, record, position));
 
     // 2. Set value’s underlying byte sequence to serialized.[[ByteSequence]].
-    m_byte_buffer = TRY(HTML::deserialize_bytes(vm, record, position));
+    m_byte_sequence = BlobByteSequence::create(TRY(HTML::deserialize_bytes(vm, record, position)));
 
     return {};
 }
@@ -190,10 +202,10 @@ GC::Ref<Blob> Blob::create(JS::Realm& realm, Optional<Vector<BlobPart>> const& b
     if (!blob_parts.has_value() && !options.has_value())
         return realm.create<Blob>(realm);
 
-    ByteBuffer byte_buffer {};
+    BlobByteSequence byte_sequence;
     // 2. Let bytes be the result of processing blob parts given blobParts and options.
     if (blob_parts.has_value()) {
-        byte_buffer = MUST(process_blob_parts(blob_parts.value(), options));
+        byte_sequence = MUST(process_blob_parts(blob_parts.value(), options));
     }
 
     auto type = String {};
@@ -213,7 +225,7 @@ GC::Ref<Blob> Blob::create(JS::Realm& realm, Optional<Vector<BlobPart>> const& b
     }
 
     // 4. Return a Blob object referring to bytes as its associated byte sequence, with its size set to the length of bytes, and its type set to the value of t from the substeps above.
-    return realm.create<Blob>(realm, move(byte_buffer), move(type));
+    return realm.create<Blob>(realm, move(byte_sequence), move(type));
 }
 
 WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::construct_impl(JS::Realm& realm, Optional<Vector<BlobPart>> const& blob_parts, Optional<BlobPropertyBag> const& options)
@@ -235,8 +247,6 @@ WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::slice(Optional<i64> start, Optional<i64
 // https://w3c.github.io/FileAPI/#slice-blob
 WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::slice_blob(Optional<i64> start, Optional<i64> end, Optional<String> const& content_type)
 {
-    auto& vm = realm().vm();
-
     // 1. Let originalSize be blob’s size.
     auto original_size = size();
 
@@ -304,8 +314,9 @@ WebIDL::ExceptionOr<GC::Ref<Blob>> Blob::slice_blob(Optional<i64> start, Optiona
     // a. S refers to span consecutive bytes from blob’s associated byte sequence, beginning with the byte at byte-order position relativeStart.
     // b. S.size = span.
     // c. S.type = relativeContentType.
-    auto byte_buffer = TRY_OR_THROW_OOM(vm, m_byte_buffer.slice(relative_start, span));
-    return realm().create<Blob>(realm(), move(byte_buffer), move(relative_content_type));
+    // NOTE: S shares blob's bytes rather than copying them.
+    auto byte_sequence = m_byte_sequence.slice(relative_start, span);
+    return realm().create<Blob>(realm(), move(byte_sequence), move(relative_content_type));
 }
 
 // https://w3c.github.io/FileAPI/#dom-blob-stream
@@ -323,44 +334,51 @@ GC::Ref<Streams::ReadableStream> Blob::get_stream()
     // 1. Let stream be a new ReadableStream created in blob’s relevant Realm.
     auto stream = realm.create<Streams::ReadableStream>(realm);
 
-    // 2. Set up stream with byte reading support.
-    stream->set_up_with_byte_reading_support();
-
-    // FIXME: 3. Run the following steps in parallel:
-    {
-        // 1. While not all bytes of blob have been read:
-        //    NOTE: for simplicity the chunk is the entire buffer for now.
-        {
+    // NOTE: Rather than reading every chunk of blob up front, we read the next chunk whenever the stream pulls. This way
+    //       only the chunks that have not been consumed yet are held in memory, no matter how large blob is.
+    auto pull_algorithm = GC::create_function(realm.heap(), [&realm, stream, byte_sequence = m_byte_sequence, position = static_cast<size_t>(0)]() mutable {
+        // 3. Run the following steps in parallel:
+        //     1. While not all bytes of blob have been read:
+        if (position < byte_sequence.size()) {
             // 1. Let bytes be the byte sequence that results from reading a chunk from blob, or failure if a chunk cannot be read.
-            auto bytes = m_byte_buffer;
+            auto chunk_size = min(byte_sequence.size() - position, BLOB_STREAM_CHUNK_SIZE);
+            auto bytes = byte_sequence.bytes().slice(position, chunk_size);
+            position += chunk_size;
 
             // 2. Queue a global task on the file reading task source given blob’s relevant global object to perform the following steps:
-            HTML::queue_global_task(HTML::Task::Source::FileReading, realm.global_object(), GC::create_function(heap(), [stream, bytes = move(bytes)]() {
-                auto& realm = stream->realm();
-                HTML::TemporaryExecutionContext const execution_context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
-
+            // NOTE: The pull algorithm already runs on the event loop, so we perform these steps right away.
+            {
                 // 1. If bytes is failure, then error stream with a failure reason and abort these steps.
                 // 2. Let chunk be a new Uint8Array wrapping an ArrayBuffer containing bytes. If creating the ArrayBuffer throws an exception, then error stream with that exception and abort these steps.
-                auto array_buffer = JS::ArrayBuffer::create(realm, bytes);
-                auto chunk = JS::Uint8Array::create(realm, bytes.size(), *array_buffer);
+                auto array_buffer = JS::ArrayBuffer::create(realm, bytes.size());
+                if (array_buffer.is_error()) {
+                    Streams::readable_stream_error(*stream, array_buffer.release_error().value());
+                    return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+                }
+                bytes.copy_to(array_buffer.value()->buffer());
+                auto chunk = JS::Uint8Array::create(realm, bytes.size(), *array_buffer.value());
 
                 // 3. Enqueue chunk in stream.
                 auto maybe_error = Bindings::throw_dom_exception_if_needed(realm.vm(), [&]() {
                     return stream->enqueue(chunk);
                 });
 
-                if (maybe_error.is_error()) {
+                if (maybe_error.is_error())
                     Streams::readable_stream_error(*stream, maybe_error.release_error().value());
-                    return;
-                }
-
-                // FIXME: Spec bug: https://github.com/w3c/FileAPI/issues/206
-                //
-                // We need to close the stream so that the stream will finish reading.
-                Streams::readable_stream_close(*stream);
-            }));
+            }
         }
-    }
+
+        // FIXME: Spec bug: https://github.com/w3c/FileAPI/issues/206
+        //
+        // We need to close the stream so that the stream will finish reading.
+        if (position == byte_sequence.size() && stream->is_readable())
+            Streams::readable_stream_close(*stream);
+
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    });
+
+    // 2. Set up stream with byte reading support.
+    stream->set_up_with_byte_reading_support(pull_algorithm);
 
     // 4. Return stream.
     return stream;
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/System.h>
+#include <LibWeb/FileAPI/BlobByteSequence.h>
+
+namespace Web::FileAPI {
+
+ReadonlyBytes BlobByteSequence::Storage::bytes() const
+{
+    return m_bytes.visit(
+        [](ByteBuffer const& buffer) { return buffer.bytes(); },
+        [](Core::AnonymousBuffer const& buffer) { return ReadonlyBytes { buffer.data<u8>(), buffer.size() }; },
+        [](NonnullOwnPtr<Core::MappedFile> const& file) { return file->bytes(); });
+}
+
+BlobByteSequence::BlobByteSequence(NonnullRefPtr<Storage> storage, size_t offset, size_t size)
+    : m_storage(move(storage))
+    , m_offset(offset)
+    , m_size(size)
+{
+}
+
+BlobByteSequence BlobByteSequence::create(ByteBuffer buffer)
+{
+    if (buffer.is_empty())
+        return {};
+
+    auto size = buffer.size();
+    return { adopt_ref(*new Storage(move(buffer))), 0, size };
+}
+
+BlobByteSequence BlobByteSequence::create(Core::AnonymousBuffer buffer)
+{
+    if (buffer.size() == 0)
+        return {};
+
+    auto size = buffer.size();
+    return { adopt_ref(*new Storage(move(buffer))), 0, size };
+}
+
+BlobByteSequence BlobByteSequence::create(NonnullOwnPtr<Core::MappedFile> file)
+{
+    auto size = file->bytes().size();
+    return { adopt_ref(*new Storage(move(file))), 0, size };
+}
+
+ErrorOr<BlobByteSequence> BlobByteSequence::create_from_file(int fd)
+{
+    auto stat = Core::System::fstat(fd);
+    if (stat.is_error()) {
+        (void)Core::System::close(fd);
+        return stat.release_error();
+    }
+
+    // NOTE: Empty files cannot be mapped into memory.
+    if (stat.value().st_size == 0) {
+        TRY(Core::System::close(fd));
+        return BlobByteSequence {};
+    }
+
+    return create(TRY(Core::MappedFile::map_from_fd_and_close(fd, {})));
+}
+
+ReadonlyBytes BlobByteSequence::bytes() const
+{
+    if (!m_storage)
+        return {};
+    return m_storage->bytes().slice(m_offset, m_size);
+}
+
+BlobByteSequence BlobByteSequence::slice(size_t offset, size_t size) const
+{
+    VERIFY(offset + size <= m_size);
+
+    if (size == 0)
+        return {};
+    return { *m_storage, m_offset + offset, size };
+}
+
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
+#include <AK/Variant.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibCore/MappedFile.h>
+
+namespace Web::FileAPI {
+
+// The underlying byte sequence of a Blob. The bytes live in immutable, reference-counted storage: an in-memory buffer,
+// a shared memory buffer, or a file mapped into memory. A byte sequence refers to a range of that storage, so slicing a
+// Blob (or building a Blob out of a single other Blob) shares the bytes rather than copying them.
+class BlobByteSequence {
+public:
+    BlobByteSequence() = default;
+
+    static BlobByteSequence create(ByteBuffer);
+    static BlobByteSequence create(Core::AnonymousBuffer);
+    static BlobByteSequence create(NonnullOwnPtr<Core::MappedFile>);
+
+    // Maps the file referred to by fd into memory, taking ownership of fd.
+    static ErrorOr<BlobByteSequence> create_from_file(int fd);
+
+    size_t size() const { return m_size; }
+    bool is_empty() const { return m_size == 0; }
+
+    ReadonlyBytes bytes() const;
+
+    BlobByteSequence slice(size_t offset, size_t size) const;
+
+private:
+    class Storage : public RefCounted<Storage> {
+    public:
+        using Bytes = Variant<ByteBuffer, Core::AnonymousBuffer, NonnullOwnPtr<Core::MappedFile>>;
+
+        explicit Storage(Bytes bytes)
+            : m_bytes(move(bytes))
+        {
+        }
+
+        ReadonlyBytes bytes() const;
+
+    private:
+        Bytes m_bytes;
+    };
+
+    BlobByteSequence(NonnullRefPtr<Storage>, size_t offset, size_t size);
+
+    RefPtr<Storage> m_storage;
+    size_t m_offset { 0 };
+    size_t m_size { 0 };
+};
+
+}
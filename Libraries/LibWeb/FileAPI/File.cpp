@@ -17,8 +17,8 @@ namespace Web::FileAPI {
 
 GC_DEFINE_ALLOCATOR(File);
 
-File::File(JS::Realm& realm, ByteBuffer byte_buffer, String file_name, String type, i64 last_modified)
-    : Blob(realm, move(byte_buffer), move(type))
+File::File(JS::Realm& realm, BlobByteSequence byte_sequence, String file_name, String type, i64 last_modified)
+    : Blob(realm, move(byte_sequence), move(type))
     , m_name(move(file_name))
     , m_last_modified(last_modified)
 {
@@ -99,7 +99,7 @@ WebIDL::ExceptionOr<void> File::serialization_steps(HTML::SerializationRecord& r
     TRY(HTML::serialize_string(vm, record, m_type));
 
     // 2. Set serialized.[[ByteSequence]] to value’s underlying byte sequence.
-    TRY(HTML::serialize_bytes(vm, record, m_byte_buffer.bytes()));
+    TRY(HTML::serialize_bytes(vm, record, m_byte_sequence.bytes()));
 
     // 3. Set serialized.[[Name]] to the value of value’s name attribute.
     TRY(HTML::serialize_string(vm, record, m_name));
@@ -121,7 +121,7 @@ WebIDL::ExceptionOr<void> File::deserialization_steps(ReadonlySpan<u32> const& r
     m_type = TRY(HTML::deserialize_string(vm, record, position));
 
     // 2. Set value’s underlying byte sequence to serialized.[[ByteSequence]].
-    m_byte_buffer = TRY(HTML::deserialize_bytes(vm, record, position));
+    m_byte_sequence = BlobByteSequence::create(TRY(HTML::deserialize_bytes(vm, record, position)));
 
     // 3. Initialize the value of value’s name attribute to serialized.[[Name]].
     m_name = TRY(HTML::deserialize_string(vm, record, position));
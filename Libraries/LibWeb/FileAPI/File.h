@@ -36,7 +36,7 @@ public:
     virtual WebIDL::ExceptionOr<void> deserialization_steps(ReadonlySpan<u32> const&, size_t& position, HTML::DeserializationMemory&) override;
 
 private:
-    File(JS::Realm&, ByteBuffer, String file_name, String type, i64 last_modified);
+    File(JS::Realm&, BlobByteSequence, String file_name, String type, i64 last_modified);
     explicit File(JS::Realm&);
 
     virtual void initialize(JS::Realm&) override;
@@ -297,6 +297,7 @@ class Tokenizer;
 struct AtRule;
 struct Declaration;
 struct Function;
+struct ParsingParams;
 struct QualifiedRule;
 struct SimpleBlock;
 }
@@ -537,6 +538,7 @@ class ImageData;
 class ImageRequest;
 class ListOfAvailableImages;
 class Location;
+class MapOfPreloadedResources;
 class MediaError;
 class MessageChannel;
 class MessageEvent;
@@ -554,11 +556,15 @@ class NavigationHistoryEntry;
 class NavigationObserver;
 class NavigationTransition;
 class Navigator;
+class OffscreenCanvas;
+class OffscreenCanvasRenderingContext2D;
 class PageTransitionEvent;
 class Path2D;
 class Plugin;
 class PluginArray;
 class PopoverInvokerElement;
+class PreloadEntry;
+class PreloadScanner;
 class PromiseRejectionEvent;
 class RadioNodeList;
 class SelectedFile;
@@ -728,6 +734,7 @@ namespace Web::Painting {
 class AudioPaintable;
 class ButtonPaintable;
 class CheckBoxPaintable;
+class CompositorLayerStateSnapshot;
 class FieldSetPaintable;
 class LabelablePaintable;
 class MediaPaintable;
@@ -760,7 +767,10 @@ class AutoplayAllowlist;
 
 namespace Web::Platform {
 class AudioCodecPlugin;
+class IncrementalImageDecoder;
 class Timer;
+
+struct DecodedImage;
 }
 
 namespace Web::ReferrerPolicy {
@@ -784,9 +794,15 @@ class Selection;
 }
 
 namespace Web::ServiceWorker {
+class Cache;
+class CacheStorage;
+class RequestResponseList;
 class ServiceWorker;
 class ServiceWorkerContainer;
 class ServiceWorkerRegistration;
+
+struct CacheQueryOptions;
+struct MultiCacheQueryOptions;
 }
 
 namespace Web::Streams {
@@ -824,7 +840,9 @@ class StorageShed;
 
 struct StorageBottle;
 struct StorageBucket;
+struct StorageChange;
 struct StorageEndpoint;
+struct StorageEstimate;
 struct StorageShelf;
 }
 
@@ -914,6 +932,12 @@ struct DynamicsCompressorOptions;
 struct OscillatorOptions;
 }
 
+namespace Web::WebCodecs {
+class EncodedVideoChunk;
+class VideoDecoder;
+class VideoFrame;
+}
+
 namespace Web::WebGL {
 class OpenGLContext;
 class WebGL2RenderingContext;
@@ -7,53 +7,223 @@
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
 #include <LibJS/Runtime/Realm.h>
+#include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
+#include <LibWeb/HTML/DecodedImageCache.h>
 
 namespace Web::HTML {
 
 GC_DEFINE_ALLOCATOR(AnimatedBitmapDecodedImageData);
 
+// How many frames of an animation that is decoded on demand are kept decoded ahead of the frame being displayed.
+static constexpr size_t decoded_frame_window = 8;
+
 ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData::create(JS::Realm& realm, Vector<Frame>&& frames, size_t loop_count, bool animated)
 {
     return realm.create<AnimatedBitmapDecodedImageData>(move(frames), loop_count, animated);
 }
 
+ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> AnimatedBitmapDecodedImageData::create(JS::Realm& realm, Vector<Frame>&& frames, size_t loop_count, size_t frame_count, NonnullRefPtr<Platform::AnimationFrameSource> frame_source, Gfx::ColorSpace color_space)
+{
+    VERIFY(!frames.is_empty());
+    VERIFY(frames.size() < frame_count);
+
+    // Until we know better, we assume that the frames which have not been decoded yet last as long as the last one that has.
+    auto assumed_duration = frames.last().duration;
+    TRY(frames.try_resize(frame_count));
+    for (auto& frame : frames) {
+        if (!frame.bitmap)
+            frame.duration = assumed_duration;
+    }
+
+    auto image_data = realm.create<AnimatedBitmapDecodedImageData>(move(frames), loop_count, true);
+    image_data->m_frame_source = move(frame_source);
+    image_data->m_color_space = move(color_space);
+    return image_data;
+}
+
 AnimatedBitmapDecodedImageData::AnimatedBitmapDecodedImageData(Vector<Frame>&& frames, size_t loop_count, bool animated)
     : m_frames(move(frames))
     , m_loop_count(loop_count)
     , m_animated(animated)
+    , m_natural_size(m_frames.first().bitmap->size())
 {
 }
 
 AnimatedBitmapDecodedImageData::~AnimatedBitmapDecodedImageData() = default;
 
+void AnimatedBitmapDecodedImageData::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_document);
+}
+
+void AnimatedBitmapDecodedImageData::finalize()
+{
+    Base::finalize();
+    DecodedImageCache::the().did_destroy_image(*this);
+}
+
+void AnimatedBitmapDecodedImageData::make_discardable(DOM::Document& document, ByteBuffer encoded_data)
+{
+    VERIFY(m_frames.size() == 1);
+    VERIFY(!m_frame_source);
+
+    m_document = document;
+    m_encoded_data = move(encoded_data);
+    DecodedImageCache::the().did_decode_image(*this);
+}
+
+u64 AnimatedBitmapDecodedImageData::decoded_size_in_bytes() const
+{
+    u64 size = 0;
+    for (auto const& frame : m_frames) {
+        if (frame.bitmap)
+            size += static_cast<u64>(frame.bitmap->width()) * static_cast<u64>(frame.bitmap->height()) * sizeof(Gfx::ARGB32);
+    }
+    return size;
+}
+
+void AnimatedBitmapDecodedImageData::discard_bitmap()
+{
+    m_frames.first().bitmap = nullptr;
+}
+
+void AnimatedBitmapDecodedImageData::decode_discarded_bitmap() const
+{
+    if (m_is_decoding_discarded_bitmap)
+        return;
+    m_is_decoding_discarded_bitmap = true;
+
+    auto on_decoded = [strong_this = GC::Root(const_cast<AnimatedBitmapDecodedImageData&>(*this))](Platform::DecodedImage& result) -> ErrorOr<void> {
+        strong_this->m_is_decoding_discarded_bitmap = false;
+        if (result.frames.is_empty() || !result.frames.first().bitmap)
+            return {};
+
+        strong_this->m_frames.first().bitmap = Gfx::ImmutableBitmap::create(*result.frames.first().bitmap, Gfx::AlphaType::Premultiplied, result.color_space);
+        DecodedImageCache::the().did_decode_image(*strong_this);
+        strong_this->m_document->set_needs_display();
+        return {};
+    };
+    auto on_failed = [strong_this = GC::Root(const_cast<AnimatedBitmapDecodedImageData&>(*this))](Error&) {
+        // NOTE: The image decoded fine before, so this only happens if the decoder has gone away. We keep the encoded
+        //       data around to try again the next time the image is painted.
+        strong_this->m_is_decoding_discarded_bitmap = false;
+    };
+    (void)Platform::ImageCodecPlugin::the().decode_image(m_encoded_data.bytes(), move(on_decoded), move(on_failed));
+}
+
 RefPtr<Gfx::ImmutableBitmap> AnimatedBitmapDecodedImageData::bitmap(size_t frame_index, Gfx::IntSize) const
 {
     if (frame_index >= m_frames.size())
         return nullptr;
-    return m_frames[frame_index].bitmap;
+
+    if (m_document) {
+        if (!m_frames[frame_index].bitmap)
+            decode_discarded_bitmap();
+        else
+            DecodedImageCache::the().did_use_image(const_cast<AnimatedBitmapDecodedImageData&>(*this));
+        return m_frames[frame_index].bitmap;
+    }
+
+    if (m_frames[frame_index].bitmap || !m_frame_source)
+        return m_frames[frame_index].bitmap;
+
+    request_frames_following(frame_index);
+
+    // The frame has not been decoded yet, so we keep showing the closest one before it that has.
+    for (size_t i = 1; i < m_frames.size(); ++i) {
+        auto const& frame = m_frames[(frame_index + m_frames.size() - i) % m_frames.size()];
+        if (frame.bitmap)
+            return frame.bitmap;
+    }
+    return nullptr;
 }
 
 int AnimatedBitmapDecodedImageData::frame_duration(size_t frame_index) const
 {
     if (frame_index >= m_frames.size())
         return 0;
+
+    // NOTE: Animations ask for the duration of a frame as soon as they advance to it, which makes this the right moment
+    //       to start decoding the frames that follow.
+    if (m_frame_source)
+        request_frames_following(frame_index);
+
     return m_frames[frame_index].duration;
 }
 
+void AnimatedBitmapDecodedImageData::request_frames_following(size_t frame_index) const
+{
+    m_most_recent_frame_index = frame_index;
+    if (m_has_pending_frame_request)
+        return;
+
+    Optional<size_t> first_missing_frame_index;
+    for (size_t i = 0; i < decoded_frame_window; ++i) {
+        auto index = (frame_index + i) % m_frames.size();
+        if (!m_frames[index].bitmap) {
+            first_missing_frame_index = index;
+            break;
+        }
+    }
+    if (!first_missing_frame_index.has_value())
+        return;
+
+    m_has_pending_frame_request = true;
+
+    // NOTE: The frame source is released along with us, and never calls back once it has been released.
+    m_frame_source->request_frames(*first_missing_frame_index, decoded_frame_window, [this](size_t first_frame_index, Vector<Platform::Frame> frames) {
+        const_cast<AnimatedBitmapDecodedImageData&>(*this).did_decode_frames(first_frame_index, move(frames));
+    });
+}
+
+void AnimatedBitmapDecodedImageData::did_decode_frames(size_t first_frame_index, Vector<Platform::Frame> frames)
+{
+    m_has_pending_frame_request = false;
+
+    // If no frames could be decoded, we stop trying and keep showing the ones we have.
+    if (frames.is_empty()) {
+        m_frame_source = nullptr;
+        return;
+    }
+
+    for (size_t i = 0; i < frames.size() && first_frame_index + i < m_frames.size(); ++i) {
+        auto& frame = m_frames[first_frame_index + i];
+        frame.bitmap = Gfx::ImmutableBitmap::create(*frames[i].bitmap, Gfx::AlphaType::Premultiplied, m_color_space);
+        frame.duration = static_cast<int>(frames[i].duration);
+    }
+
+    for (size_t i = 0; i < m_frames.size(); ++i) {
+        if (!should_keep_frame(i))
+            m_frames[i].bitmap = nullptr;
+    }
+}
+
+bool AnimatedBitmapDecodedImageData::should_keep_frame(size_t frame_index) const
+{
+    // The first frame is always kept, as it determines our intrinsic size and is shown while no other frame is.
+    if (frame_index == 0)
+        return true;
+
+    // Otherwise, we keep the frame that was displayed before the most recent one, and the window of frames after it.
+    auto distance = (frame_index + m_frames.size() - m_most_recent_frame_index) % m_frames.size();
+    return distance < decoded_frame_window || distance == m_frames.size() - 1;
+}
+
 Optional<CSSPixels> AnimatedBitmapDecodedImageData::intrinsic_width() const
 {
-    return m_frames.first().bitmap->width();
+    return m_natural_size.width();
 }
 
 Optional<CSSPixels> AnimatedBitmapDecodedImageData::intrinsic_height() const
 {
-    return m_frames.first().bitmap->height();
+    return m_natural_size.height();
 }
 
 Optional<CSSPixelFraction> AnimatedBitmapDecodedImageData::intrinsic_aspect_ratio() const
 {
-    return CSSPixels(m_frames.first().bitmap->width()) / CSSPixels(m_frames.first().bitmap->height());
+    return CSSPixels(m_natural_size.width()) / CSSPixels(m_natural_size.height());
 }
 
 }
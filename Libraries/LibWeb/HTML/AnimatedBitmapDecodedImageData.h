@@ -6,8 +6,13 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
+#include <AK/IntrusiveList.h>
+#include <AK/Time.h>
+#include <LibGfx/ColorSpace.h>
 #include <LibGfx/ImmutableBitmap.h>
 #include <LibWeb/HTML/DecodedImageData.h>
+#include <LibWeb/Platform/ImageCodecPlugin.h>
 
 namespace Web::HTML {
 
@@ -22,8 +27,16 @@ public:
     };
 
     static ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> create(JS::Realm&, Vector<Frame>&&, size_t loop_count, bool animated);
+
+    // Creates an animation of which only the given leading frames have been decoded. The others are decoded by the
+    // frame source just before they are needed, and only a few of them are kept in memory at a time.
+    static ErrorOr<GC::Ref<AnimatedBitmapDecodedImageData>> create(JS::Realm&, Vector<Frame>&&, size_t loop_count, size_t frame_count, NonnullRefPtr<Platform::AnimationFrameSource>, Gfx::ColorSpace);
     virtual ~AnimatedBitmapDecodedImageData() override;
 
+    // Lets the decoded image cache discard the bitmap of this still image while it is not being painted. It is
+    // decoded again from the given encoded data when it is needed, after which the document is repainted.
+    void make_discardable(DOM::Document&, ByteBuffer encoded_data);
+
     virtual RefPtr<Gfx::ImmutableBitmap> bitmap(size_t frame_index, Gfx::IntSize = {}) const override;
     virtual int frame_duration(size_t frame_index) const override;
 
@@ -36,11 +49,40 @@ public:
     virtual Optional<CSSPixelFraction> intrinsic_aspect_ratio() const override;
 
 private:
+    friend class DecodedImageCache;
+
     AnimatedBitmapDecodedImageData(Vector<Frame>&&, size_t loop_count, bool animated);
 
+    virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
+
+    u64 decoded_size_in_bytes() const;
+    void discard_bitmap();
+    void decode_discarded_bitmap() const;
+
+    void request_frames_following(size_t frame_index) const;
+    void did_decode_frames(size_t first_frame_index, Vector<Platform::Frame>);
+    bool should_keep_frame(size_t frame_index) const;
+
     Vector<Frame> m_frames;
     size_t m_loop_count { 0 };
     bool m_animated { false };
+
+    RefPtr<Platform::AnimationFrameSource> m_frame_source;
+    Gfx::ColorSpace m_color_space;
+    mutable size_t m_most_recent_frame_index { 0 };
+    mutable bool m_has_pending_frame_request { false };
+
+    Gfx::IntSize m_natural_size;
+
+    GC::Ptr<DOM::Document> m_document;
+    ByteBuffer m_encoded_data;
+    mutable bool m_is_decoding_discarded_bitmap { false };
+    MonotonicTime m_last_use_time { MonotonicTime::now_coarse() };
+    IntrusiveListNode<AnimatedBitmapDecodedImageData> m_decoded_image_cache_list_node;
+
+public:
+    using DecodedImageCacheList = IntrusiveList<&AnimatedBitmapDecodedImageData::m_decoded_image_cache_list_node>;
 };
 
 }
@@ -7,6 +7,7 @@
 #include <LibWeb/HTML/Canvas/CanvasDrawImage.h>
 #include <LibWeb/HTML/ImageBitmap.h>
 #include <LibWeb/SVG/SVGImageElement.h>
+#include <LibWeb/WebCodecs/VideoFrame.h>
 
 namespace Web::HTML {
 
@@ -42,6 +43,10 @@ static void default_source_size(CanvasImageSource const& image, float& source_wi
                 source_height = source->video_height();
             }
         },
+        [&source_width, &source_height](GC::Root<WebCodecs::VideoFrame> const& source) {
+            source_width = source->display_width();
+            source_height = source->display_height();
+        },
         [&source_width, &source_height](GC::Root<HTMLCanvasElement> const& source) {
             if (source->surface()) {
                 source_width = source->surface()->size().width();
@@ -18,7 +18,8 @@ public:
     virtual WebIDL::ExceptionOr<GC::Ref<ImageData>> create_image_data(int width, int height, Optional<ImageDataSettings> const& settings = {}) const = 0;
     virtual WebIDL::ExceptionOr<GC::Ref<ImageData>> create_image_data(ImageData const&) const = 0;
     virtual WebIDL::ExceptionOr<GC::Ptr<ImageData>> get_image_data(int x, int y, int width, int height, Optional<ImageDataSettings> const& settings = {}) const = 0;
-    virtual void put_image_data(ImageData&, float x, float y) = 0;
+    virtual WebIDL::ExceptionOr<void> put_image_data(ImageData&, int x, int y) = 0;
+    virtual WebIDL::ExceptionOr<void> put_image_data(ImageData&, int x, int y, int dirty_x, int dirty_y, int dirty_width, int dirty_height) = 0;
 
 protected:
     CanvasImageData() = default;
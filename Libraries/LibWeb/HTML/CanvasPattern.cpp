@@ -12,6 +12,7 @@
 #include <LibWeb/HTML/CanvasRenderingContext2D.h>
 #include <LibWeb/HTML/ImageBitmap.h>
 #include <LibWeb/SVG/SVGImageElement.h>
+#include <LibWeb/WebCodecs/VideoFrame.h>
 
 namespace Web::HTML {
 
@@ -51,9 +52,13 @@ void CanvasPatternPaintStyle::paint(Gfx::IntRect physical_bounding_box, PaintFun
         [](GC::Root<HTMLImageElement> const& source) -> RefPtr<Gfx::ImmutableBitmap> { return source->immutable_bitmap(); },
         [](GC::Root<SVG::SVGImageElement> const& source) -> RefPtr<Gfx::ImmutableBitmap> { return source->current_image_bitmap(); },
         [](GC::Root<HTMLCanvasElement> const& source) -> RefPtr<Gfx::ImmutableBitmap> { return Gfx::ImmutableBitmap::create_snapshot_from_painting_surface(*source->surface()); },
-        [](GC::Root<HTMLVideoElement> const& source) -> RefPtr<Gfx::ImmutableBitmap> { return Gfx::ImmutableBitmap::create(*source->bitmap()); },
-        [](GC::Root<ImageBitmap> const& source) -> RefPtr<Gfx::ImmutableBitmap> { return Gfx::ImmutableBitmap::create(*source->bitmap()); });
-    VERIFY(bitmap);
+        [](GC::Root<HTMLVideoElement> const& source) -> RefPtr<Gfx::ImmutableBitmap> { return source->bitmap(); },
+        [](GC::Root<ImageBitmap> const& source) -> RefPtr<Gfx::ImmutableBitmap> { return Gfx::ImmutableBitmap::create(*source->bitmap()); },
+        [](GC::Root<WebCodecs::VideoFrame> const& source) -> RefPtr<Gfx::ImmutableBitmap> { return source->bitmap(); });
+
+    // NOTE: A VideoFrame may have been closed since the pattern was created, which leaves nothing to paint.
+    if (!bitmap)
+        return;
 
     auto const bitmap_width = bitmap->width();
     auto const bitmap_height = bitmap->height();
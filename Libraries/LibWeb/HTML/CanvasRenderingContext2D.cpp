@@ -13,6 +13,7 @@
 #include <LibGfx/CompositingAndBlendingOperator.h>
 #include <LibGfx/PainterSkia.h>
 #include <LibGfx/Rect.h>
+#include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibUnicode/Segmenter.h>
 #include <LibWeb/Bindings/CanvasRenderingContext2DPrototype.h>
@@ -29,6 +30,7 @@
 #include <LibWeb/Layout/TextNode.h>
 #include <LibWeb/Painting/Paintable.h>
 #include <LibWeb/SVG/SVGImageElement.h>
+#include <LibWeb/WebCodecs/VideoFrame.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
 namespace Web::HTML {
@@ -42,10 +44,15 @@ JS::ThrowCompletionOr<GC::Ref<CanvasRenderingContext2D>> CanvasRenderingContext2
 }
 
 CanvasRenderingContext2D::CanvasRenderingContext2D(JS::Realm& realm, HTMLCanvasElement& element, CanvasRenderingContext2DSettings context_attributes)
+    : CanvasRenderingContext2D(realm, element.bitmap_size_for_canvas(), move(context_attributes))
+{
+    m_element = element;
+}
+
+CanvasRenderingContext2D::CanvasRenderingContext2D(JS::Realm& realm, Gfx::IntSize size, CanvasRenderingContext2DSettings context_attributes)
     : PlatformObject(realm)
     , CanvasPath(static_cast<Bindings::PlatformObject&>(*this), *this)
-    , m_element(element)
-    , m_size(element.bitmap_size_for_canvas())
+    , m_size(size)
     , m_context_attributes(move(context_attributes))
 {
 }
@@ -141,9 +148,51 @@ Gfx::Path CanvasRenderingContext2D::rect_path(float x, float y, float width, flo
     return path;
 }
 
+// Recording more rects than this does not make drawing them any faster, it only delays the drawing.
+static constexpr size_t max_pending_fill_rects = 4096;
+
 void CanvasRenderingContext2D::fill_rect(float x, float y, float width, float height)
 {
-    fill_internal(rect_path(x, y, width, height), Gfx::WindingRule::EvenOdd);
+    auto& state = drawing_state();
+    auto color = state.fill_style.as_color();
+
+    // OPTIMIZATION: A solid color rect that casts no shadow, is not filtered and is composited normally can be drawn as
+    //               a plain rect. Such rects are recorded, so that runs of them are drawn together.
+    bool has_shadow = state.shadow_color.alpha() > 0 && (state.shadow_blur != 0 || state.shadow_offset_x != 0 || state.shadow_offset_y != 0);
+    bool can_record = color.has_value()
+        && !has_shadow
+        && state.filters.is_empty()
+        && state.current_compositing_and_blending_operator == Gfx::CompositingAndBlendingOperator::SourceOver
+        && isfinite(x) && isfinite(y) && isfinite(width) && isfinite(height);
+
+    if (!can_record) {
+        fill_internal(rect_path(x, y, width, height), Gfx::WindingRule::EvenOdd);
+        return;
+    }
+
+    if (!ensure_painter())
+        return;
+
+    auto fill_color = color->with_opacity(state.global_alpha);
+    if (m_pending_fill_rects.has_value() && (m_pending_fill_rects->color != fill_color || m_pending_fill_rects->rects.size() >= max_pending_fill_rects))
+        flush_pending_fill_rects();
+
+    if (!m_pending_fill_rects.has_value())
+        m_pending_fill_rects = PendingFillRects { .color = fill_color, .rects = {} };
+
+    auto rect = Gfx::FloatRect(x, y, width, height);
+    m_pending_fill_rects->rects.append(rect);
+    did_draw(rect);
+}
+
+void CanvasRenderingContext2D::flush_pending_fill_rects()
+{
+    if (!m_pending_fill_rects.has_value())
+        return;
+
+    auto pending_fill_rects = m_pending_fill_rects.release_value();
+    if (auto* painter = ensure_painter())
+        painter->fill_rects(pending_fill_rects.rects, pending_fill_rects.color);
 }
 
 void CanvasRenderingContext2D::clear_rect(float x, float y, float width, float height)
@@ -187,10 +236,12 @@ WebIDL::ExceptionOr<void> CanvasRenderingContext2D::draw_image_internal(CanvasIm
                 return {};
             return Gfx::ImmutableBitmap::create_snapshot_from_painting_surface(*surface);
         },
-        [](GC::Root<HTMLVideoElement> const& source) -> RefPtr<Gfx::ImmutableBitmap> { return Gfx::ImmutableBitmap::create(*source->bitmap()); },
+        [](GC::Root<HTMLVideoElement> const& source) -> RefPtr<Gfx::ImmutableBitmap> { return source->bitmap(); },
         [](GC::Root<ImageBitmap> const& source) -> RefPtr<Gfx::ImmutableBitmap> {
             return Gfx::ImmutableBitmap::create(*source->bitmap());
-        });
+        },
+        // NOTE: Decoded frames are drawn straight from the planes the decoder produced, without copying them.
+        [](GC::Root<WebCodecs::VideoFrame> const& source) -> RefPtr<Gfx::ImmutableBitmap> { return source->bitmap(); });
     if (!bitmap)
         return {};
 
@@ -247,23 +298,51 @@ void CanvasRenderingContext2D::did_draw(Gfx::FloatRect const&)
     canvas_element().paintable()->set_needs_display(InvalidateDisplayList::No);
 }
 
+RefPtr<Gfx::SkiaBackendContext> CanvasRenderingContext2D::skia_backend_context() const
+{
+    return canvas_element().navigable()->traversable_navigable()->skia_backend_context();
+}
+
+RefPtr<Gfx::FontCascadeList const> CanvasRenderingContext2D::compute_font_for_style_values(CSS::CSSStyleValue const& font_family, CSS::CSSStyleValue const& font_size, CSS::CSSStyleValue const& font_style, CSS::CSSStyleValue const& font_weight, CSS::CSSStyleValue const& font_width)
+{
+    auto& canvas_element = this->canvas_element();
+    return canvas_element.document().style_computer().compute_font_for_style_values(&canvas_element, {}, font_family, font_size, font_style, font_weight, font_width);
+}
+
 Gfx::Painter* CanvasRenderingContext2D::painter()
+{
+    // NOTE: Anything that draws, or changes the transform or the clip, goes through here, so recorded rects have to be
+    //       drawn first to keep everything in order.
+    flush_pending_fill_rects();
+    return ensure_painter();
+}
+
+Gfx::Painter* CanvasRenderingContext2D::ensure_painter()
 {
     allocate_painting_surface_if_needed();
-    auto surface = canvas_element().surface();
-    if (!m_painter && surface) {
-        canvas_element().document().invalidate_display_list();
-        m_painter = make<Gfx::PainterSkia>(*canvas_element().surface());
+    if (!m_painter && m_surface) {
+        if (m_element)
+            m_element->document().invalidate_display_list();
+        m_painter = make<Gfx::PainterSkia>(*m_surface);
     }
     return m_painter.ptr();
 }
 
+RefPtr<Gfx::PaintingSurface> CanvasRenderingContext2D::surface()
+{
+    // NOTE: The surface is about to be read, be it to paint the canvas or to read its pixels back.
+    flush_pending_fill_rects();
+    return m_surface;
+}
+
 void CanvasRenderingContext2D::set_size(Gfx::IntSize const& size)
 {
     if (m_size == size)
         return;
     m_size = size;
     m_surface = nullptr;
+    m_painter = nullptr;
+    m_pending_fill_rects.clear();
 }
 
 void CanvasRenderingContext2D::allocate_painting_surface_if_needed()
@@ -274,12 +353,15 @@ void CanvasRenderingContext2D::allocate_painting_surface_if_needed()
     // FIXME: implement context attribute .color_space
     // FIXME: implement context attribute .color_type
     // FIXME: implement context attribute .desynchronized
-    // FIXME: implement context attribute .will_read_frequently
 
     auto color_type = m_context_attributes.alpha ? Gfx::BitmapFormat::BGRA8888 : Gfx::BitmapFormat::BGRx8888;
 
-    auto skia_backend_context = canvas_element().navigable()->traversable_navigable()->skia_backend_context();
-    m_surface = Gfx::PaintingSurface::create_with_size(skia_backend_context, canvas_element().bitmap_size_for_canvas(), color_type, Gfx::AlphaType::Premultiplied);
+    // https://html.spec.whatwg.org/multipage/canvas.html#concept-canvas-will-read-frequently
+    // NOTE: Reading pixels back from the GPU stalls until everything drawn so far has been rendered, so a context that
+    //       will be read from frequently is rasterized on the CPU instead.
+    auto skia_backend_context = m_context_attributes.will_read_frequently ? nullptr : this->skia_backend_context();
+
+    m_surface = Gfx::PaintingSurface::create_with_size(skia_backend_context, m_size, color_type, Gfx::AlphaType::Premultiplied);
 
     // https://html.spec.whatwg.org/multipage/canvas.html#the-canvas-settings:concept-canvas-alpha
     // Thus, the bitmap of such a context starts off as opaque black instead of transparent black;
@@ -517,9 +599,9 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     auto image_data = TRY(ImageData::create(realm(), abs_width, abs_height, settings));
 
     // NOTE: We don't attempt to create the underlying bitmap here; if it doesn't exist, it's like copying only transparent black pixels (which is a no-op).
-    if (!canvas_element().surface())
+    auto surface = const_cast<CanvasRenderingContext2D&>(*this).surface();
+    if (!surface)
         return image_data;
-    auto const snapshot = Gfx::ImmutableBitmap::create_snapshot_from_painting_surface(*canvas_element().surface());
 
     // 5. Let the source rectangle be the rectangle whose corners are the four points (sx, sy), (sx+sw, sy), (sx+sw, sy+sh), (sx, sy+sh).
     auto source_rect = Gfx::Rect { x, y, abs_width, abs_height };
@@ -530,50 +612,109 @@ WebIDL::ExceptionOr<GC::Ptr<ImageData>> CanvasRenderingContext2D::get_image_data
     if (width < 0 || height < 0) {
         source_rect = source_rect.translated(min(width, 0), min(height, 0));
     }
-    auto source_rect_intersected = source_rect.intersected(snapshot->rect());
 
     // 6. Set the pixel values of imageData to be the pixels of this's output bitmap in the area specified by the source rectangle in the bitmap's coordinate space units, converted from this's color space to imageData's colorSpace using 'relative-colorimetric' rendering intent.
     // NOTE: Internally we must use premultiplied alpha, but ImageData should hold unpremultiplied alpha. This conversion
     //       might result in a loss of precision, but is according to spec.
     //       See: https://html.spec.whatwg.org/multipage/canvas.html#premultiplied-alpha-and-the-2d-rendering-context
-    VERIFY(snapshot->alpha_type() == Gfx::AlphaType::Premultiplied);
+    // OPTIMIZATION: The pixels are converted straight into the ImageData's buffer, instead of drawing a snapshot of the
+    //               surface onto it.
     VERIFY(image_data->bitmap().alpha_type() == Gfx::AlphaType::Unpremultiplied);
-
-    auto painter = Gfx::Painter::create(image_data->bitmap());
-    painter->draw_bitmap(image_data->bitmap().rect().to_type<float>(), *snapshot, source_rect_intersected, Gfx::ScalingMode::NearestNeighbor, {}, 1, Gfx::CompositingAndBlendingOperator::SourceOver);
+    surface->read_pixels(image_data->bitmap(), source_rect.location());
 
     // 7. Set the pixels values of imageData for areas of the source rectangle that are outside of the output bitmap to transparent black.
-    // NOTE: No-op, already done during creation.
+    // NOTE: No-op, already done during creation, and read_pixels() leaves these pixels untouched.
 
     // 8. Return imageData.
     return image_data;
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-putimagedata-short
-void CanvasRenderingContext2D::put_image_data(ImageData& image_data, float x, float y)
+WebIDL::ExceptionOr<void> CanvasRenderingContext2D::put_image_data(ImageData& image_data, int x, int y)
 {
     // The putImageData(imageData, dx, dy) method steps are to put pixels from an ImageData onto a bitmap,
     // given imageData, this's output bitmap, dx, dy, 0, 0, imageData's width, and imageData's height.
-    // FIXME: "put pixels from an ImageData onto a bitmap" is a spec algorithm.
-    //        https://html.spec.whatwg.org/multipage/canvas.html#dom-context2d-putimagedata-common
-    if (auto* painter = this->painter()) {
-        auto dst_rect = Gfx::FloatRect(x, y, image_data.width(), image_data.height());
-        painter->draw_bitmap(
-            dst_rect,
-            Gfx::ImmutableBitmap::create(image_data.bitmap(), Gfx::AlphaType::Unpremultiplied),
-            image_data.bitmap().rect(),
-            Gfx::ScalingMode::NearestNeighbor,
-            drawing_state().filters,
-            1.0f,
-            Gfx::CompositingAndBlendingOperator::SourceOver);
-        did_draw(dst_rect);
+    return put_pixels_from_image_data(image_data, x, y, 0, 0, image_data.width(), image_data.height());
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-context-2d-putimagedata
+WebIDL::ExceptionOr<void> CanvasRenderingContext2D::put_image_data(ImageData& image_data, int x, int y, int dirty_x, int dirty_y, int dirty_width, int dirty_height)
+{
+    // The putImageData(imageData, dx, dy, dirtyX, dirtyY, dirtyWidth, dirtyHeight) method steps are to put pixels from
+    // an ImageData onto a bitmap, given imageData, this's output bitmap, dx, dy, dirtyX, dirtyY, dirtyWidth, and dirtyHeight.
+    return put_pixels_from_image_data(image_data, x, y, dirty_x, dirty_y, dirty_width, dirty_height);
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-context2d-putimagedata-common
+WebIDL::ExceptionOr<void> CanvasRenderingContext2D::put_pixels_from_image_data(ImageData& image_data, int dx, int dy, i64 dirty_x, i64 dirty_y, i64 dirty_width, i64 dirty_height)
+{
+    // 1. Let buffer be imageData's data attribute value's [[ViewedArrayBuffer]] internal slot.
+    auto& buffer = *image_data.data()->viewed_array_buffer();
+
+    // 2. If IsDetachedBuffer(buffer) is true, then throw an "InvalidStateError" DOMException.
+    if (buffer.is_detached())
+        return WebIDL::InvalidStateError::create(realm(), "ImageData's buffer has been detached"_string);
+
+    // 3. If dirtyWidth is negative, then let dirtyX be dirtyX+dirtyWidth, and let dirtyWidth be equal to the absolute magnitude of dirtyWidth.
+    if (dirty_width < 0) {
+        dirty_x += dirty_width;
+        dirty_width = -dirty_width;
+    }
+
+    //    If dirtyHeight is negative, then let dirtyY be dirtyY+dirtyHeight, and let dirtyHeight be equal to the absolute magnitude of dirtyHeight.
+    if (dirty_height < 0) {
+        dirty_y += dirty_height;
+        dirty_height = -dirty_height;
+    }
+
+    // 4. If dirtyX is negative, then let dirtyWidth be dirtyWidth+dirtyX, and let dirtyX be 0.
+    if (dirty_x < 0) {
+        dirty_width += dirty_x;
+        dirty_x = 0;
     }
+
+    //    If dirtyY is negative, then let dirtyHeight be dirtyHeight+dirtyY, and let dirtyY be 0.
+    if (dirty_y < 0) {
+        dirty_height += dirty_y;
+        dirty_y = 0;
+    }
+
+    // 5. If dirtyX+dirtyWidth is greater than the width attribute of the imageData argument, then let dirtyWidth be the
+    //    value of that width attribute, minus the value of dirtyX.
+    if (dirty_x + dirty_width > image_data.width())
+        dirty_width = image_data.width() - dirty_x;
+
+    //    If dirtyY+dirtyHeight is greater than the height attribute of the imageData argument, then let dirtyHeight be
+    //    the value of that height attribute, minus the value of dirtyY.
+    if (dirty_y + dirty_height > image_data.height())
+        dirty_height = image_data.height() - dirty_y;
+
+    // 6. If, after those changes, either dirtyWidth or dirtyHeight are negative or zero, then return without affecting any bitmaps.
+    if (dirty_width <= 0 || dirty_height <= 0)
+        return {};
+
+    allocate_painting_surface_if_needed();
+    auto surface = this->surface();
+    if (!surface)
+        return {};
+
+    // 7. For all integer values of x and y where dirtyX ≤ x < dirtyX+dirtyWidth and dirtyY ≤ y < dirtyY+dirtyHeight, set
+    //    the pixel with coordinate (dx+x, dy+y) in bitmap to the color of the pixel at coordinate (x, y) in the imageData
+    //    data structure's bitmap, converted from imageData's colorSpace to the color space of bitmap using
+    //    'relative-colorimetric' rendering intent.
+    // OPTIMIZATION: The pixels are converted straight from the ImageData's buffer into the surface, instead of being
+    //               drawn through the painter. This also keeps them from being affected by the drawing state.
+    auto dirty_rect = Gfx::IntRect(static_cast<int>(dirty_x), static_cast<int>(dirty_y), static_cast<int>(dirty_width), static_cast<int>(dirty_height));
+    auto destination_rect = dirty_rect.translated(dx, dy);
+    surface->write_pixels(image_data.bitmap(), dirty_rect, destination_rect.location());
+    did_draw(destination_rect.to_type<float>());
+    return {};
 }
 
 // https://html.spec.whatwg.org/multipage/canvas.html#reset-the-rendering-context-to-its-default-state
 void CanvasRenderingContext2D::reset_to_default_state()
 {
-    auto surface = canvas_element().surface();
+    auto surface = this->surface();
 
     // 1. Clear canvas's bitmap to transparent black.
     if (surface) {
@@ -793,11 +934,18 @@ WebIDL::ExceptionOr<CanvasImageSourceUsability> check_usability_of_image(CanvasI
         },
 
         // ImageBitmap
-        // FIXME: VideoFrame
+        // VideoFrame
         [](GC::Root<ImageBitmap> const& image_bitmap) -> WebIDL::ExceptionOr<Optional<CanvasImageSourceUsability>> {
+            // If image has its [[Detached]] internal slot value set to true, then throw an "InvalidStateError" DOMException.
             if (image_bitmap->is_detached())
                 return WebIDL::InvalidStateError::create(image_bitmap->realm(), "Image bitmap is detached"_string);
             return Optional<CanvasImageSourceUsability> {};
+        },
+        [](GC::Root<WebCodecs::VideoFrame> const& video_frame) -> WebIDL::ExceptionOr<Optional<CanvasImageSourceUsability>> {
+            // If image has its [[Detached]] internal slot value set to true, then throw an "InvalidStateError" DOMException.
+            if (video_frame->is_detached())
+                return WebIDL::InvalidStateError::create(video_frame->realm(), "Video frame is closed"_string);
+            return Optional<CanvasImageSourceUsability> {};
         }));
     if (usability.has_value())
         return usability.release_value();
@@ -828,6 +976,12 @@ bool image_is_not_origin_clean(CanvasImageSource const& image)
         [](OneOf<GC::Root<HTMLCanvasElement>, GC::Root<ImageBitmap>> auto const&) {
             // FIXME: image's bitmap's origin-clean flag is false.
             return false;
+        },
+        // VideoFrame
+        [](GC::Root<WebCodecs::VideoFrame> const&) {
+            // NOTE: Frames only ever come from a decoder that script fed with its own data, so they are always
+            //       origin-clean.
+            return false;
         });
 }
 
@@ -1071,6 +1225,10 @@ void CanvasRenderingContext2D::set_filter(String filter)
 
         drawing_state().filters.grow_capacity(filter_value_list.size());
 
+        // FIXME: Resolve the filters of contexts that draw onto an OffscreenCanvas, which has no layout node to resolve them against.
+        if (!m_element)
+            return;
+
         // Note: The layout must be updated to make sure the canvas's layout node isn't null.
         canvas_element().document().update_layout(DOM::UpdateLayoutReason::CanvasRenderingContext2DSetFilter);
         auto layout_node = canvas_element().layout_node();
@@ -85,7 +85,8 @@ public:
     virtual WebIDL::ExceptionOr<GC::Ref<ImageData>> create_image_data(int width, int height, Optional<ImageDataSettings> const& settings = {}) const override;
     virtual WebIDL::ExceptionOr<GC::Ref<ImageData>> create_image_data(ImageData const& image_data) const override;
     virtual WebIDL::ExceptionOr<GC::Ptr<ImageData>> get_image_data(int x, int y, int width, int height, Optional<ImageDataSettings> const& settings = {}) const override;
-    virtual void put_image_data(ImageData&, float x, float y) override;
+    virtual WebIDL::ExceptionOr<void> put_image_data(ImageData&, int x, int y) override;
+    virtual WebIDL::ExceptionOr<void> put_image_data(ImageData&, int x, int y, int dirty_x, int dirty_y, int dirty_width, int dirty_height) override;
 
     virtual void reset_to_default_state() override;
 
@@ -127,21 +128,30 @@ public:
     HTMLCanvasElement& canvas_element();
     HTMLCanvasElement const& canvas_element() const;
 
+    virtual RefPtr<Gfx::FontCascadeList const> compute_font_for_style_values(CSS::CSSStyleValue const& font_family, CSS::CSSStyleValue const& font_size, CSS::CSSStyleValue const& font_style, CSS::CSSStyleValue const& font_weight, CSS::CSSStyleValue const& font_width);
+
     [[nodiscard]] Gfx::Painter* painter();
 
     void set_size(Gfx::IntSize const&);
 
-    RefPtr<Gfx::PaintingSurface> surface() { return m_surface; }
+    RefPtr<Gfx::PaintingSurface> surface();
     void allocate_painting_surface_if_needed();
 
-private:
-    CanvasRenderingContext2D(JS::Realm&, HTMLCanvasElement&, CanvasRenderingContext2DSettings);
+protected:
+    // NOTE: Used by OffscreenCanvasRenderingContext2D, which draws onto an OffscreenCanvas rather than onto a canvas element.
+    CanvasRenderingContext2D(JS::Realm&, Gfx::IntSize, CanvasRenderingContext2DSettings);
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
     static JS::ThrowCompletionOr<CanvasRenderingContext2DSettings> context_attributes_from_options(JS::VM&, JS::Value);
 
+    virtual RefPtr<Gfx::SkiaBackendContext> skia_backend_context() const;
+    virtual void did_draw(Gfx::FloatRect const&);
+
+private:
+    CanvasRenderingContext2D(JS::Realm&, HTMLCanvasElement&, CanvasRenderingContext2DSettings);
+
     virtual Gfx::Painter* painter_for_canvas_state() override { return painter(); }
     virtual Gfx::Path& path_for_canvas_state() override { return path(); }
 
@@ -151,7 +161,10 @@ private:
         Gfx::FloatRect bounding_box;
     };
 
-    void did_draw(Gfx::FloatRect const&);
+    Gfx::Painter* ensure_painter();
+    void flush_pending_fill_rects();
+
+    WebIDL::ExceptionOr<void> put_pixels_from_image_data(ImageData&, int dx, int dy, i64 dirty_x, i64 dirty_y, i64 dirty_width, i64 dirty_height);
 
     RefPtr<Gfx::FontCascadeList const> font_cascade_list();
 
@@ -168,9 +181,17 @@ private:
     void paint_shadow_for_fill_internal(Gfx::Path const&, Gfx::WindingRule);
     void paint_shadow_for_stroke_internal(Gfx::Path const&);
 
-    GC::Ref<HTMLCanvasElement> m_element;
+    GC::Ptr<HTMLCanvasElement> m_element;
     OwnPtr<Gfx::Painter> m_painter;
 
+    // OPTIMIZATION: Consecutive fillRect() calls with the same solid color are recorded instead of drawn right away, and
+    //               drawn together once the painter or the surface is needed for anything else.
+    struct PendingFillRects {
+        Gfx::Color color;
+        Vector<Gfx::FloatRect> rects;
+    };
+    Optional<PendingFillRects> m_pending_fill_rects;
+
     // https://html.spec.whatwg.org/multipage/canvas.html#concept-canvas-origin-clean
     bool m_origin_clean { true };
 
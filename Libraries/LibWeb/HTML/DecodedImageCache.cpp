@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/HTML/DecodedImageCache.h>
+
+namespace Web::HTML {
+
+static constexpr u64 decoded_image_budget = 256 * MiB;
+
+// Images that were painted this recently are likely to be in or near the viewport, and are never discarded, even if
+// that means going over budget.
+static constexpr AK::Duration minimum_age_for_discarding = AK::Duration::from_seconds(5);
+
+DecodedImageCache& DecodedImageCache::the()
+{
+    static DecodedImageCache s_the;
+    return s_the;
+}
+
+void DecodedImageCache::did_decode_image(AnimatedBitmapDecodedImageData& image)
+{
+    VERIFY(!image.m_decoded_image_cache_list_node.is_in_list());
+
+    image.m_last_use_time = MonotonicTime::now_coarse();
+    m_images.append(image);
+    m_decoded_size += image.decoded_size_in_bytes();
+
+    discard_images_if_needed();
+}
+
+void DecodedImageCache::did_use_image(AnimatedBitmapDecodedImageData& image)
+{
+    if (!image.m_decoded_image_cache_list_node.is_in_list())
+        return;
+
+    image.m_last_use_time = MonotonicTime::now_coarse();
+    m_images.remove(image);
+    m_images.append(image);
+
+    discard_images_if_needed();
+}
+
+void DecodedImageCache::did_destroy_image(AnimatedBitmapDecodedImageData& image)
+{
+    if (!image.m_decoded_image_cache_list_node.is_in_list())
+        return;
+
+    m_images.remove(image);
+    m_decoded_size -= image.decoded_size_in_bytes();
+}
+
+void DecodedImageCache::discard_all_images()
+{
+    auto now = MonotonicTime::now_coarse();
+
+    // Images that were painted very recently are likely still on screen, and would only be decoded again right away.
+    while (!m_images.is_empty()) {
+        auto& image = *m_images.first();
+        if (now - image.m_last_use_time < minimum_age_for_discarding)
+            break;
+
+        did_destroy_image(image);
+        image.discard_bitmap();
+    }
+}
+
+void DecodedImageCache::discard_images_if_needed()
+{
+    auto now = MonotonicTime::now_coarse();
+
+    while (m_decoded_size > decoded_image_budget && !m_images.is_empty()) {
+        auto& image = *m_images.first();
+        if (now - image.m_last_use_time < minimum_age_for_discarding)
+            break;
+
+        did_destroy_image(image);
+        image.discard_bitmap();
+    }
+}
+
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/Time.h>
+#include <LibWeb/HTML/AnimatedBitmapDecodedImageData.h>
+
+namespace Web::HTML {
+
+// Keeps track of the decoded bitmaps of every image in this process that can be decoded again from its encoded data.
+// Once they take up more memory than the budget allows, the bitmaps of the least recently painted images are discarded.
+// Images that are painted again after that are transparently decoded again.
+class DecodedImageCache {
+    AK_MAKE_NONCOPYABLE(DecodedImageCache);
+    AK_MAKE_NONMOVABLE(DecodedImageCache);
+
+public:
+    static DecodedImageCache& the();
+
+    void did_decode_image(AnimatedBitmapDecodedImageData&);
+    void did_use_image(AnimatedBitmapDecodedImageData&);
+    void did_destroy_image(AnimatedBitmapDecodedImageData&);
+
+    // Discards the decoded bitmaps of all images that are not in use, regardless of the budget.
+    void discard_all_images();
+
+private:
+    DecodedImageCache() = default;
+
+    void discard_images_if_needed();
+
+    // Least recently used first.
+    AnimatedBitmapDecodedImageData::DecodedImageCacheList m_images;
+    u64 m_decoded_size { 0 };
+};
+
+}
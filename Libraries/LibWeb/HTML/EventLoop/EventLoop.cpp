@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/ElapsedTimer.h>
 #include <LibCore/EventLoop.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -239,8 +240,13 @@ void EventLoop::queue_task_to_update_the_rendering()
     for (auto& navigable : all_navigables()) {
         if (!navigable->is_traversable())
             continue;
-        if (!navigable->has_a_rendering_opportunity())
+        if (!navigable->has_a_rendering_opportunity()) {
+            // NOTE: The previous frame is still being rasterized or presented, so we drop this one instead of letting
+            //       frames queue up behind it.
+            if (navigable->active_browsing_context())
+                as<TraversableNavigable>(*navigable).frame_timings().number_of_skipped_frames++;
             continue;
+        }
 
         auto document = navigable->active_document();
         if (!document)
@@ -318,6 +324,8 @@ void EventLoop::update_the_rendering()
         m_running_rendering_task = false;
     };
 
+    auto main_thread_timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+
     process_input_events();
 
     // 1. Let frameTimestamp be eventLoop's last render opportunity time.
@@ -480,6 +488,7 @@ void EventLoop::update_the_rendering()
             auto& page = traversable->page();
             VERIFY(page.client().is_ready_to_paint());
             page.client().paint_next_frame();
+            traversable->frame_timings().main_thread_time.record(main_thread_timer.elapsed_time());
         }
     }
 
@@ -488,6 +497,9 @@ void EventLoop::update_the_rendering()
         document->process_top_layer_removals();
     }
 
+    for (auto& document : docs)
+        document->finish_frame_statistics();
+
     for (auto& document : docs) {
         if (document->readiness() == HTML::DocumentReadyState::Complete && document->style_computer().number_of_css_font_faces_with_loading_in_progress() == 0) {
             HTML::TemporaryExecutionContext context(document->realm(), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
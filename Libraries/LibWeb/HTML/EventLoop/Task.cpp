@@ -7,6 +7,7 @@
 #include <AK/IDAllocator.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/EventLoop/Task.h>
+#include <LibWeb/Page/Page.h>
 
 namespace Web::HTML {
 
@@ -59,6 +60,10 @@ bool Task::is_runnable() const
     if (m_document->has_been_destroyed())
         return true;
 
+    // AD-HOC: Tasks of documents in a frozen page are held back until the page is unfrozen.
+    if (m_document->page().is_frozen())
+        return false;
+
     return m_document->is_fully_active();
 }
 
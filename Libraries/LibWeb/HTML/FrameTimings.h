@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Time.h>
+
+namespace Web::HTML {
+
+// Counts frames by how long one stage of producing them took.
+class FrameTimeHistogram {
+public:
+    // Each bucket but the last holds the frames faster than its bound. The last one holds all others.
+    static constexpr Array<i64, 7> bucket_upper_bounds_in_milliseconds { 1, 2, 4, 8, 16, 32, 64 };
+    static constexpr size_t bucket_count = bucket_upper_bounds_in_milliseconds.size() + 1;
+
+    void record(AK::Duration duration)
+    {
+        size_t bucket = 0;
+        while (bucket < bucket_upper_bounds_in_milliseconds.size() && duration.to_milliseconds() >= bucket_upper_bounds_in_milliseconds[bucket])
+            ++bucket;
+        ++m_buckets[bucket];
+        ++m_count;
+        m_total += duration;
+        if (duration > m_max)
+            m_max = duration;
+    }
+
+    Array<u64, bucket_count> const& buckets() const { return m_buckets; }
+    u64 count() const { return m_count; }
+    AK::Duration total() const { return m_total; }
+    AK::Duration max() const { return m_max; }
+
+private:
+    Array<u64, bucket_count> m_buckets {};
+    u64 m_count { 0 };
+    AK::Duration m_total;
+    AK::Duration m_max;
+};
+
+// How long producing the frames of a traversable took, from running the rendering update on the main thread to
+// the UI process being done presenting them.
+struct FrameTimings {
+    FrameTimeHistogram main_thread_time;
+    FrameTimeHistogram rasterization_time;
+    FrameTimeHistogram presentation_latency;
+
+    // Rendering opportunities that were skipped because earlier frames were still being rasterized or presented.
+    u64 number_of_skipped_frames { 0 };
+};
+
+}
@@ -10,6 +10,8 @@
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/JPEGWriter.h>
 #include <LibGfx/ImageFormats/PNGWriter.h>
+#include <LibGfx/ShareableBitmap.h>
+#include <LibIPC/Decoder.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/HTMLCanvasElementPrototype.h>
 #include <LibWeb/CSS/ComputedProperties.h>
@@ -22,9 +24,11 @@
 #include <LibWeb/HTML/CanvasRenderingContext2D.h>
 #include <LibWeb/HTML/HTMLCanvasElement.h>
 #include <LibWeb/HTML/Numbers.h>
+#include <LibWeb/HTML/OffscreenCanvas.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/Layout/CanvasBox.h>
+#include <LibWeb/Painting/Paintable.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/WebGL/WebGL2RenderingContext.h>
 #include <LibWeb/WebGL/WebGLRenderingContext.h>
@@ -166,6 +170,10 @@ void HTMLCanvasElement::notify_context_about_canvas_size_change()
 
 WebIDL::ExceptionOr<void> HTMLCanvasElement::set_width(unsigned value)
 {
+    // When its canvas context mode is placeholder, the canvas element's width can not be changed.
+    if (m_is_placeholder)
+        return WebIDL::InvalidStateError::create(realm(), "Cannot set the width of a canvas that has transferred its control to an OffscreenCanvas"_string);
+
     if (value > 2147483647)
         value = 300;
 
@@ -177,6 +185,10 @@ WebIDL::ExceptionOr<void> HTMLCanvasElement::set_width(unsigned value)
 
 WebIDL::ExceptionOr<void> HTMLCanvasElement::set_height(WebIDL::UnsignedLong value)
 {
+    // When its canvas context mode is placeholder, the canvas element's height can not be changed.
+    if (m_is_placeholder)
+        return WebIDL::InvalidStateError::create(realm(), "Cannot set the height of a canvas that has transferred its control to an OffscreenCanvas"_string);
+
     if (value > 2147483647)
         value = 150;
 
@@ -243,6 +255,9 @@ JS::ThrowCompletionOr<HTMLCanvasElement::RenderingContext> HTMLCanvasElement::ge
 
     // 3. Run the steps in the cell of the following table whose column header matches this canvas element's canvas context mode and whose row header matches contextId:
     // NOTE: See the spec for the full table.
+    if (m_is_placeholder)
+        return JS::throw_completion(WebIDL::InvalidStateError::create(realm(), "Cannot get a context of a canvas that has transferred its control to an OffscreenCanvas"_string));
+
     if (type == "2d"sv) {
         if (TRY(create_2d_context(options)) == HasOrCreatedContext::Yes)
             return GC::make_root(*m_context.get<GC::Ref<HTML::CanvasRenderingContext2D>>());
@@ -287,13 +302,8 @@ Gfx::IntSize HTMLCanvasElement::bitmap_size_for_canvas(size_t minimum_width, siz
     return Gfx::IntSize(width, height);
 }
 
-struct SerializeBitmapResult {
-    ByteBuffer buffer;
-    StringView mime_type;
-};
-
 // https://html.spec.whatwg.org/multipage/canvas.html#a-serialisation-of-the-bitmap-as-a-file
-static ErrorOr<SerializeBitmapResult> serialize_bitmap(Gfx::Bitmap const& bitmap, StringView type, JS::Value quality)
+ErrorOr<SerializeBitmapResult> serialize_bitmap(Gfx::Bitmap const& bitmap, StringView type, JS::Value quality)
 {
     // If type is an image format that supports variable quality (such as "image/jpeg"), quality is given, and type is not "image/png", then,
     // if quality is a Number in the range 0.0 to 1.0 inclusive, the user agent must treat quality as the desired quality level.
@@ -407,6 +417,79 @@ WebIDL::ExceptionOr<void> HTMLCanvasElement::to_blob(GC::Ref<WebIDL::CallbackTyp
     return {};
 }
 
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-canvas-transfercontroltooffscreen
+WebIDL::ExceptionOr<GC::Ref<OffscreenCanvas>> HTMLCanvasElement::transfer_control_to_offscreen()
+{
+    // 1. If this canvas element's context mode is not set to none, throw an "InvalidStateError" DOMException.
+    if (!m_context.has<Empty>() || m_is_placeholder)
+        return WebIDL::InvalidStateError::create(realm(), "Canvas already has a rendering context"_string);
+
+    // 2. Let offscreenCanvas be a new OffscreenCanvas object with its width and height equal to the values of the width
+    //    and height content attributes of this canvas element.
+    auto offscreen_canvas = OffscreenCanvas::create(realm(), width(), height());
+
+    // 3. Set the placeholder canvas element of offscreenCanvas to a weak reference to this canvas element.
+    offscreen_canvas->set_placeholder_canvas_element(*this);
+
+    // 4. Set this canvas element's context mode to placeholder.
+    m_is_placeholder = true;
+
+    // 5. Return offscreenCanvas.
+    return offscreen_canvas;
+}
+
+void HTMLCanvasElement::set_placeholder_frame(Gfx::Bitmap const& frame)
+{
+    VERIFY(m_is_placeholder);
+
+    if (!m_placeholder_surface || m_placeholder_surface->size() != frame.size()) {
+        auto skia_backend_context = navigable() ? navigable()->traversable_navigable()->skia_backend_context() : nullptr;
+        m_placeholder_surface = Gfx::PaintingSurface::create_with_size(skia_backend_context, frame.size(), Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied);
+        document().invalidate_display_list();
+    }
+
+    m_placeholder_surface->write_from_bitmap(frame);
+
+    if (paintable())
+        paintable()->set_needs_display(InvalidateDisplayList::No);
+}
+
+void HTMLCanvasElement::set_up_placeholder_transport(NonnullOwnPtr<IPC::Transport> transport)
+{
+    m_placeholder_transport = move(transport);
+    m_placeholder_transport->set_up_read_hook([weak_this = make_weak_ptr<HTMLCanvasElement>()] {
+        if (weak_this)
+            weak_this->read_placeholder_frames_from_transport();
+    });
+}
+
+void HTMLCanvasElement::read_placeholder_frames_from_transport()
+{
+    RefPtr<Gfx::Bitmap> latest_frame;
+
+    auto should_shutdown = m_placeholder_transport->read_as_many_messages_as_possible_without_blocking([&](auto&& raw_message) {
+        FixedMemoryStream stream { raw_message.bytes.span(), FixedMemoryStream::Mode::ReadOnly };
+        IPC::Decoder decoder { stream, raw_message.fds };
+
+        auto frame = decoder.decode<Gfx::ShareableBitmap>();
+        if (frame.is_error() || !frame.value().is_valid()) {
+            dbgln("Received an invalid frame for placeholder canvas element");
+            return;
+        }
+        latest_frame = frame.value().bitmap();
+    });
+
+    // NOTE: Frames that were pushed before the latest one would be replaced right away, so they are not shown at all.
+    if (latest_frame)
+        set_placeholder_frame(*latest_frame);
+
+    if (should_shutdown == IPC::Transport::ShouldShutdown::Yes) {
+        Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [this] {
+            m_placeholder_transport.clear();
+        }));
+    }
+}
+
 void HTMLCanvasElement::present()
 {
     if (auto surface = this->surface())
@@ -439,8 +522,8 @@ RefPtr<Gfx::PaintingSurface> HTMLCanvasElement::surface() const
         [&](GC::Ref<WebGL::WebGL2RenderingContext> const& context) -> RefPtr<Gfx::PaintingSurface> {
             return context->surface();
         },
-        [](Empty) -> RefPtr<Gfx::PaintingSurface> {
-            return {};
+        [&](Empty) -> RefPtr<Gfx::PaintingSurface> {
+            return m_placeholder_surface;
         });
 }
 
@@ -8,11 +8,20 @@
 
 #include <LibGfx/Forward.h>
 #include <LibGfx/PaintingSurface.h>
+#include <LibIPC/Transport.h>
 #include <LibWeb/HTML/HTMLElement.h>
 #include <LibWeb/WebIDL/Types.h>
 
 namespace Web::HTML {
 
+struct SerializeBitmapResult {
+    ByteBuffer buffer;
+    StringView mime_type;
+};
+
+// https://html.spec.whatwg.org/multipage/canvas.html#a-serialisation-of-the-bitmap-as-a-file
+ErrorOr<SerializeBitmapResult> serialize_bitmap(Gfx::Bitmap const&, StringView type, JS::Value quality);
+
 class HTMLCanvasElement final : public HTMLElement {
     WEB_PLATFORM_OBJECT(HTMLCanvasElement, HTMLElement);
     GC_DECLARE_ALLOCATOR(HTMLCanvasElement);
@@ -42,6 +51,12 @@ public:
     String to_data_url(StringView type, JS::Value quality);
     WebIDL::ExceptionOr<void> to_blob(GC::Ref<WebIDL::CallbackType> callback, StringView type, JS::Value quality);
 
+    WebIDL::ExceptionOr<GC::Ref<OffscreenCanvas>> transfer_control_to_offscreen();
+
+    // Shows a frame pushed by the OffscreenCanvas that this canvas element is the placeholder canvas element of.
+    void set_placeholder_frame(Gfx::Bitmap const&);
+    void set_up_placeholder_transport(NonnullOwnPtr<IPC::Transport>);
+
     void present();
 
     RefPtr<Gfx::PaintingSurface> surface() const;
@@ -64,7 +79,16 @@ private:
     void reset_context_to_default_state();
     void notify_context_about_canvas_size_change();
 
+    void read_placeholder_frames_from_transport();
+
     Variant<GC::Ref<HTML::CanvasRenderingContext2D>, GC::Ref<WebGL::WebGLRenderingContext>, GC::Ref<WebGL::WebGL2RenderingContext>, Empty> m_context;
+
+    // https://html.spec.whatwg.org/multipage/canvas.html#concept-canvas-placeholder
+    // NOTE: While the context mode is "placeholder", the canvas element shows the frames pushed by its OffscreenCanvas,
+    //       which arrive over the placeholder transport once the OffscreenCanvas has been transferred.
+    bool m_is_placeholder { false };
+    RefPtr<Gfx::PaintingSurface> m_placeholder_surface;
+    OwnPtr<IPC::Transport> m_placeholder_transport;
 };
 
 }
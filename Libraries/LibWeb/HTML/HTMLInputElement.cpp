@@ -590,10 +590,14 @@ void HTMLInputElement::did_select_files(Span<SelectedFile> selected_files, Multi
     auto files = FileAPI::FileList::create(realm());
 
     for (auto& selected_file : selected_files) {
-        auto contents = selected_file.take_contents();
+        auto contents = selected_file.take_byte_sequence();
+        if (contents.is_error()) {
+            dbgln("Unable to read selected file '{}': {}", selected_file.name(), contents.error());
+            continue;
+        }
 
-        auto mime_type = MimeSniff::Resource::sniff(contents);
-        auto blob = FileAPI::Blob::create(realm(), move(contents), mime_type.essence());
+        auto mime_type = MimeSniff::Resource::sniff(contents.value().bytes());
+        auto blob = FileAPI::Blob::create(realm(), contents.release_value(), mime_type.essence());
 
         // FIXME: The FileAPI should use ByteString for file names.
         auto file_name = MUST(String::from_byte_string(selected_file.name()));
@@ -80,9 +80,13 @@ void HTMLOptionElement::set_selected(bool selected)
 
 void HTMLOptionElement::set_selected_internal(bool selected)
 {
-    if (m_selected != selected)
+    if (m_selected != selected) {
         invalidate_style(DOM::StyleInvalidationReason::HTMLOptionElementSelectedChange);
 
+        // NOTE: The select element's selectedOptions collection filters on selectedness.
+        DOM::ParentNode::bump_subtree_version_of_inclusive_ancestors(*this);
+    }
+
     m_selected = selected;
     if (selected)
         m_selectedness_update_index = m_next_selectedness_update_index++;
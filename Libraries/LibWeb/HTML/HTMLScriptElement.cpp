@@ -8,6 +8,7 @@
 #include <AK/Debug.h>
 #include <AK/StringBuilder.h>
 #include <LibTextCodec/Decoder.h>
+#include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/HTMLScriptElementPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/DOM/Document.h>
@@ -17,8 +18,11 @@
 #include <LibWeb/HTML/EventNames.h>
 #include <LibWeb/HTML/HTMLScriptElement.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
+#include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/Scripting/Fetching.h>
 #include <LibWeb/HTML/Scripting/ImportMapParseResult.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/SpeculativeLoading.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Infra/CharacterTypes.h>
 #include <LibWeb/Infra/Strings.h>
@@ -238,37 +242,42 @@ void HTMLScriptElement::prepare_script()
         // then set el's type to "importmap".
         m_script_type = ScriptType::ImportMap;
     }
-    // 12. Otherwise, return. (No script is executed, and el's type is left as null.)
+    // 12. Otherwise, if the script block's type string is an ASCII case-insensitive match for the string "speculationrules",
+    else if (Infra::is_ascii_case_insensitive_match(script_block_type, "speculationrules"sv)) {
+        // then set el's type to "speculationrules".
+        m_script_type = ScriptType::SpeculationRules;
+    }
+    // 13. Otherwise, return. (No script is executed, and el's type is left as null.)
     else {
         VERIFY(m_script_type == ScriptType::Null);
         return;
     }
 
-    // 13. If parser document is non-null, then set el's parser document back to parser document and set el's force async to false.
+    // 14. If parser document is non-null, then set el's parser document back to parser document and set el's force async to false.
     if (parser_document) {
         m_parser_document = parser_document;
         m_force_async = false;
     }
 
-    // 14. Set el's already started to true.
+    // 15. Set el's already started to true.
     m_already_started = true;
 
-    // 15. Set el's preparation-time document to its node document.
+    // 16. Set el's preparation-time document to its node document.
     m_preparation_time_document = &document();
 
-    // 16. If parser document is non-null, and parser document is not equal to el's preparation-time document, then return.
+    // 17. If parser document is non-null, and parser document is not equal to el's preparation-time document, then return.
     if (parser_document != nullptr && parser_document != m_preparation_time_document) {
         dbgln("HTMLScriptElement: Refusing to run script because the parser document is not the same as the preparation time document.");
         return;
     }
 
-    // 17. If scripting is disabled for el, then return.
+    // 18. If scripting is disabled for el, then return.
     if (is_scripting_disabled()) {
         dbgln("HTMLScriptElement: Refusing to run script because scripting is disabled.");
         return;
     }
 
-    // 18. If el has a nomodule content attribute and its type is "classic", then return.
+    // 19. If el has a nomodule content attribute and its type is "classic", then return.
     if (m_script_type == ScriptType::Classic && has_attribute(HTML::AttributeNames::nomodule)) {
         dbgln("HTMLScriptElement: Refusing to run classic script because it has the nomodule attribute.");
         return;
@@ -277,7 +286,7 @@ void HTMLScriptElement::prepare_script()
     // FIXME: 19. If el does not have a src content attribute, and the Should element's inline behavior be blocked by Content Security Policy?
     //            algorithm returns "Blocked" when given el, "script", and source text, then return. [CSP]
 
-    // 20. If el has an event attribute and a for attribute, and el's type is "classic", then:
+    // 21. If el has an event attribute and a for attribute, and el's type is "classic", then:
     if (m_script_type == ScriptType::Classic && has_attribute(HTML::AttributeNames::event) && has_attribute(HTML::AttributeNames::for_)) {
         // 1. Let for be the value of el's' for attribute.
         auto for_ = get_attribute_value(HTML::AttributeNames::for_);
@@ -303,7 +312,7 @@ void HTMLScriptElement::prepare_script()
         }
     }
 
-    // 21. If el has a charset attribute, then let encoding be the result of getting an encoding from the value of the charset attribute.
+    // 22. If el has a charset attribute, then let encoding be the result of getting an encoding from the value of the charset attribute.
     //     If el does not have a charset attribute, or if getting an encoding failed, then let encoding be el's node document's the encoding.
     Optional<String> encoding;
 
@@ -319,33 +328,33 @@ void HTMLScriptElement::prepare_script()
 
     VERIFY(encoding.has_value());
 
-    // 22. Let classic script CORS setting be the current state of el's crossorigin content attribute.
+    // 23. Let classic script CORS setting be the current state of el's crossorigin content attribute.
     auto classic_script_cors_setting = m_crossorigin;
 
-    // 23. Let module script credentials mode be the CORS settings attribute credentials mode for el's crossorigin content attribute.
+    // 24. Let module script credentials mode be the CORS settings attribute credentials mode for el's crossorigin content attribute.
     auto module_script_credential_mode = cors_settings_attribute_credentials_mode(m_crossorigin);
 
     // FIXME: 24. Let cryptographic nonce be el's [[CryptographicNonce]] internal slot's value.
 
-    // 25. If el has an integrity attribute, then let integrity metadata be that attribute's value.
+    // 26. If el has an integrity attribute, then let integrity metadata be that attribute's value.
     //     Otherwise, let integrity metadata be the empty string.
     String integrity_metadata;
     if (auto maybe_integrity = attribute(HTML::AttributeNames::integrity); maybe_integrity.has_value()) {
         integrity_metadata = *maybe_integrity;
     }
 
-    // 26. Let referrer policy be the current state of el's referrerpolicy content attribute.
+    // 27. Let referrer policy be the current state of el's referrerpolicy content attribute.
     auto referrer_policy = m_referrer_policy;
 
-    // 27. Let fetch priority be the current state of el's fetchpriority content attribute.
+    // 28. Let fetch priority be the current state of el's fetchpriority content attribute.
     auto fetch_priority = Fetch::Infrastructure::request_priority_from_string(get_attribute_value(HTML::AttributeNames::fetchpriority)).value_or(Fetch::Infrastructure::Request::Priority::Auto);
 
-    // 28. Let parser metadata be "parser-inserted" if el is parser-inserted, and "not-parser-inserted" otherwise.
+    // 29. Let parser metadata be "parser-inserted" if el is parser-inserted, and "not-parser-inserted" otherwise.
     auto parser_metadata = is_parser_inserted()
         ? Fetch::Infrastructure::Request::ParserMetadata::ParserInserted
         : Fetch::Infrastructure::Request::ParserMetadata::NotParserInserted;
 
-    // 29. Let options be a script fetch options whose cryptographic nonce is cryptographic nonce,
+    // 30. Let options be a script fetch options whose cryptographic nonce is cryptographic nonce,
     //     integrity metadata is integrity metadata, parser metadata is parser metadata,
     //     credentials mode is module script credentials mode, referrer policy is referrer policy,
     //     and fetch priority is fetch priority.
@@ -358,13 +367,13 @@ void HTMLScriptElement::prepare_script()
         .fetch_priority = move(fetch_priority),
     };
 
-    // 30. Let settings object be el's node document's relevant settings object.
+    // 31. Let settings object be el's node document's relevant settings object.
     auto& settings_object = document().relevant_settings_object();
 
-    // 31. If el has a src content attribute, then:
+    // 32. If el has a src content attribute, then:
     if (has_attribute(HTML::AttributeNames::src)) {
-        // 1. If el's type is "importmap",
-        if (m_script_type == ScriptType::ImportMap) {
+        // 1. If el's type is "importmap" or "speculationrules",
+        if (m_script_type == ScriptType::ImportMap || m_script_type == ScriptType::SpeculationRules) {
             // then queue an element task on the DOM manipulation task source given el to fire an event named error at el, and return.
             queue_an_element_task(HTML::Task::Source::DOMManipulation, [this] {
                 dispatch_event(DOM::Event::create(realm(), HTML::EventNames::error));
@@ -435,7 +444,7 @@ void HTMLScriptElement::prepare_script()
         }
     }
 
-    // 32. If el does not have a src content attribute:
+    // 33. If el does not have a src content attribute:
     if (!has_attribute(HTML::AttributeNames::src)) {
         // Let base URL be el's node document's document base URL.
         auto base_url = document().base_url();
@@ -475,9 +484,32 @@ void HTMLScriptElement::prepare_script()
             // 2. Mark as ready el given result.
             mark_as_ready(Result(move(result)));
         }
+        // -> "speculationrules"
+        else if (m_script_type == ScriptType::SpeculationRules) {
+            // 1. Let result be the result of parsing a speculation rule set string given source text, el's node
+            //    document, and el's node document's document base URL.
+            auto result = parse_a_speculation_rule_set_string(source_text, document(), base_url);
+
+            // 2. If this threw an exception, then report the exception for el's relevant global object, and return.
+            if (result.is_exception()) {
+                HTML::TemporaryExecutionContext execution_context { realm() };
+                auto completion = Bindings::exception_to_throw_completion(vm(), result.release_error());
+                HTML::report_exception(completion, realm());
+                return;
+            }
+
+            // 3. Append result to el's node document's speculation rule sets.
+            document().speculation_rule_sets().append(result.release_value());
+
+            // 4. Consider speculative loads for el's node document.
+            consider_speculative_loads(document());
+
+            // NOTE: Speculation rules don't execute, so there is nothing left to do for el.
+            return;
+        }
     }
 
-    // 33. If el's type is "classic" and el has a src attribute, or el's type is "module":
+    // 34. If el's type is "classic" and el has a src attribute, or el's type is "module":
     if ((m_script_type == ScriptType::Classic && has_attribute(HTML::AttributeNames::src)) || m_script_type == ScriptType::Module) {
         // 1. Assert: el's result is "uninitialized".
         // FIXME: I believe this step to be a spec bug, and it should be removed: https://github.com/whatwg/html/issues/8534
@@ -551,7 +583,7 @@ void HTMLScriptElement::prepare_script()
         }
     }
 
-    // 34. Otherwise:
+    // 35. Otherwise:
     else {
         // 1. Assert: el's result is not "uninitialized".
         VERIFY(!m_result.has<ResultState::Uninitialized>());
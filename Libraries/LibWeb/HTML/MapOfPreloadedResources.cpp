@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/HTML/MapOfPreloadedResources.h>
+
+namespace Web::HTML {
+
+GC_DEFINE_ALLOCATOR(PreloadEntry);
+GC_DEFINE_ALLOCATOR(MapOfPreloadedResources);
+
+PreloadEntry::PreloadEntry(String integrity_metadata)
+    : m_integrity_metadata(move(integrity_metadata))
+{
+}
+
+void PreloadEntry::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_response);
+    visitor.visit(m_on_response_available);
+}
+
+void PreloadEntry::set_response(GC::Ref<Fetch::Infrastructure::Response> response)
+{
+    // If entry's on response available is null, then set entry's response to response;
+    // otherwise call entry's on response available given response.
+    if (!m_on_response_available) {
+        m_response = response;
+        return;
+    }
+    m_on_response_available->function()(response);
+}
+
+void PreloadEntry::set_consumer(GC::Ref<OnResponseAvailable> on_response_available)
+{
+    // If entry's response is null, then set entry's on response available to onResponseAvailable.
+    if (!m_response) {
+        m_on_response_available = on_response_available;
+        return;
+    }
+
+    // Otherwise, call onResponseAvailable with entry's response.
+    on_response_available->function()(*m_response);
+}
+
+MapOfPreloadedResources::Key MapOfPreloadedResources::Key::for_request(Fetch::Infrastructure::Request const& request)
+{
+    return {
+        .url = request.url(),
+        .destination = request.destination(),
+        .mode = request.mode(),
+        .credentials_mode = request.credentials_mode(),
+    };
+}
+
+u32 MapOfPreloadedResources::Key::hash() const
+{
+    u32 url_hash = Traits<URL::URL>::hash(url);
+    u32 destination_hash = destination.has_value() ? static_cast<u32>(*destination) + 1 : 0;
+    return pair_int_hash(url_hash, pair_int_hash(destination_hash, pair_int_hash(static_cast<u32>(mode), static_cast<u32>(credentials_mode))));
+}
+
+MapOfPreloadedResources::MapOfPreloadedResources() = default;
+MapOfPreloadedResources::~MapOfPreloadedResources() = default;
+
+void MapOfPreloadedResources::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    for (auto& it : m_entries)
+        visitor.visit(it.value);
+}
+
+GC::Ref<PreloadEntry> MapOfPreloadedResources::create_entry(Key const& key, String integrity_metadata)
+{
+    auto entry = heap().allocate<PreloadEntry>(move(integrity_metadata));
+    m_entries.set(key, entry);
+    return entry;
+}
+
+// https://html.spec.whatwg.org/multipage/links.html#consume-a-preloaded-resource
+bool MapOfPreloadedResources::consume(Key const& key, StringView integrity_metadata, GC::Ref<PreloadEntry::OnResponseAvailable> on_response_available)
+{
+    // 1. Let key be a preload key whose URL is url, destination is destination, mode is mode, and credentials mode is
+    //    credentialsMode.
+    // 2. Let preloads be window's associated Document's map of preloaded resources.
+
+    // 3. If key does not exist in preloads, then return false.
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return false;
+
+    // 4. Let entry be preloads[key].
+    auto entry = it->value;
+
+    // 5. Let consumerIntegrityMetadata be the result of parsing integrityMetadata.
+    // 6. Let preloadIntegrityMetadata be the result of parsing entry's integrity metadata.
+    // 7. If none of the following conditions apply:
+    //    - consumerIntegrityMetadata is no metadata;
+    //    - consumerIntegrityMetadata is equal to preloadIntegrityMetadata,
+    //    then return false.
+    // FIXME: Compare the parsed metadata instead, so that equivalent metadata written differently matches too.
+    if (!integrity_metadata.is_empty() && integrity_metadata != entry->integrity_metadata())
+        return false;
+
+    // 8. Remove preloads[key].
+    m_entries.remove(it);
+
+    // 9. If entry's response is null, then set entry's on response available to onResponseAvailable.
+    // 10. Otherwise, call onResponseAvailable with entry's response.
+    entry->set_consumer(on_response_available);
+
+    // 11. Return true.
+    return true;
+}
+
+}
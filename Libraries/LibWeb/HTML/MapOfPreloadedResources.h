@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <LibGC/Function.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/links.html#preload-entry
+class PreloadEntry final : public JS::Cell {
+    GC_CELL(PreloadEntry, JS::Cell);
+    GC_DECLARE_ALLOCATOR(PreloadEntry);
+
+public:
+    using OnResponseAvailable = GC::Function<void(GC::Ref<Fetch::Infrastructure::Response>)>;
+
+    String const& integrity_metadata() const { return m_integrity_metadata; }
+
+    // Called by the preload fetch once it has a response.
+    void set_response(GC::Ref<Fetch::Infrastructure::Response>);
+
+    // Called when a fetch consumes this entry.
+    void set_consumer(GC::Ref<OnResponseAvailable>);
+
+private:
+    explicit PreloadEntry(String integrity_metadata);
+
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    // https://html.spec.whatwg.org/multipage/links.html#preload-integrity-metadata
+    String m_integrity_metadata;
+
+    // https://html.spec.whatwg.org/multipage/links.html#preload-response
+    GC::Ptr<Fetch::Infrastructure::Response> m_response;
+
+    // https://html.spec.whatwg.org/multipage/links.html#preload-on-response-available
+    GC::Ptr<OnResponseAvailable> m_on_response_available;
+};
+
+// https://html.spec.whatwg.org/multipage/links.html#map-of-preloaded-resources
+class MapOfPreloadedResources final : public JS::Cell {
+    GC_CELL(MapOfPreloadedResources, JS::Cell);
+    GC_DECLARE_ALLOCATOR(MapOfPreloadedResources);
+
+public:
+    // https://html.spec.whatwg.org/multipage/links.html#preload-key
+    struct Key {
+        URL::URL url;
+        Optional<Fetch::Infrastructure::Request::Destination> destination;
+        Fetch::Infrastructure::Request::Mode mode;
+        Fetch::Infrastructure::Request::CredentialsMode credentials_mode;
+
+        [[nodiscard]] static Key for_request(Fetch::Infrastructure::Request const&);
+
+        [[nodiscard]] bool operator==(Key const& other) const = default;
+        [[nodiscard]] u32 hash() const;
+    };
+
+    MapOfPreloadedResources();
+    virtual ~MapOfPreloadedResources() override;
+
+    [[nodiscard]] bool contains(Key const& key) const { return m_entries.contains(key); }
+    GC::Ref<PreloadEntry> create_entry(Key const&, String integrity_metadata);
+
+    bool consume(Key const&, StringView integrity_metadata, GC::Ref<PreloadEntry::OnResponseAvailable>);
+
+private:
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    HashMap<Key, GC::Ref<PreloadEntry>> m_entries;
+};
+
+}
+
+namespace AK {
+
+template<>
+struct Traits<Web::HTML::MapOfPreloadedResources::Key> : public DefaultTraits<Web::HTML::MapOfPreloadedResources::Key> {
+    static unsigned hash(Web::HTML::MapOfPreloadedResources::Key const& key)
+    {
+        return key.hash();
+    }
+    static bool equals(Web::HTML::MapOfPreloadedResources::Key const& a, Web::HTML::MapOfPreloadedResources::Key const& b)
+    {
+        return a == b;
+    }
+};
+
+}
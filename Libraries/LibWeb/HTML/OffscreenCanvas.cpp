@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Checked.h>
+#include <LibCore/Socket.h>
+#include <LibCore/System.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/Painter.h>
+#include <LibGfx/PaintingSurface.h>
+#include <LibGfx/ShareableBitmap.h>
+#include <LibIPC/Encoder.h>
+#include <LibIPC/File.h>
+#include <LibIPC/Message.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/FileAPI/Blob.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/HTMLCanvasElement.h>
+#include <LibWeb/HTML/ImageBitmap.h>
+#include <LibWeb/HTML/OffscreenCanvas.h>
+#include <LibWeb/HTML/OffscreenCanvasRenderingContext2D.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/HTML/StructuredSerialize.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/WebIDL/DOMException.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::HTML {
+
+GC_DEFINE_ALLOCATOR(OffscreenCanvas);
+
+constexpr u8 IPC_FILE_TAG = 0xA5;
+
+static constexpr auto max_canvas_area = 16384 * 16384;
+
+GC::Ref<OffscreenCanvas> OffscreenCanvas::create(JS::Realm& realm, WebIDL::UnsignedLongLong width, WebIDL::UnsignedLongLong height)
+{
+    return realm.create<OffscreenCanvas>(realm, width, height);
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-offscreencanvas
+WebIDL::ExceptionOr<GC::Ref<OffscreenCanvas>> OffscreenCanvas::construct_impl(JS::Realm& realm, WebIDL::UnsignedLongLong width, WebIDL::UnsignedLongLong height)
+{
+    // The new OffscreenCanvas(width, height) constructor steps are:
+    // 1. Initialize the bitmap of this to a rectangular array of transparent black pixels of the dimensions specified by width and height.
+    // 2. Initialize the width of this to width.
+    // 3. Initialize the height of this to height.
+    // NOTE: The bitmap is allocated by the rendering context once something is drawn.
+    return create(realm, width, height);
+}
+
+OffscreenCanvas::OffscreenCanvas(JS::Realm& realm, WebIDL::UnsignedLongLong width, WebIDL::UnsignedLongLong height)
+    : DOM::EventTarget(realm)
+    , m_width(width)
+    , m_height(height)
+{
+}
+
+OffscreenCanvas::~OffscreenCanvas() = default;
+
+void OffscreenCanvas::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(OffscreenCanvas);
+    Base::initialize(realm);
+}
+
+void OffscreenCanvas::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_context);
+}
+
+Gfx::IntSize OffscreenCanvas::bitmap_size() const
+{
+    Checked<u64> area = m_width;
+    area *= m_height;
+
+    if (area.has_overflow() || area.value() > max_canvas_area) {
+        dbgln("Refusing to create {}x{} OffscreenCanvas (exceeds maximum size)", m_width, m_height);
+        return {};
+    }
+    return Gfx::IntSize(m_width, m_height);
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-offscreencanvas-width
+WebIDL::ExceptionOr<void> OffscreenCanvas::set_width(WebIDL::UnsignedLongLong width)
+{
+    if (is_detached())
+        return WebIDL::InvalidStateError::create(realm(), "OffscreenCanvas is detached"_string);
+
+    m_width = width;
+    did_change_size();
+    return {};
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-offscreencanvas-height
+WebIDL::ExceptionOr<void> OffscreenCanvas::set_height(WebIDL::UnsignedLongLong height)
+{
+    if (is_detached())
+        return WebIDL::InvalidStateError::create(realm(), "OffscreenCanvas is detached"_string);
+
+    m_height = height;
+    did_change_size();
+    return {};
+}
+
+void OffscreenCanvas::did_change_size()
+{
+    // On setting the width or height attributes, if the OffscreenCanvas object's context mode is 2d, then reset the
+    // rendering context to its default state and resize the OffscreenCanvas object's bitmap to the new values of the
+    // width and height attributes.
+    if (!m_context)
+        return;
+
+    m_context->set_size(bitmap_size());
+    m_context->reset_to_default_state();
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-offscreencanvas-getcontext
+WebIDL::ExceptionOr<GC::Ptr<OffscreenCanvasRenderingContext2D>> OffscreenCanvas::get_context(Bindings::OffscreenRenderingContextId context_id, JS::Value options)
+{
+    // 1. If options is not an object, then set options to null.
+    if (!options.is_object())
+        options = JS::js_null();
+
+    // 2. Set options to the result of converting options to a JavaScript value.
+    // NOTE: No-op.
+
+    // 3. If the value of this's [[Detached]] internal slot is true, then throw an "InvalidStateError" DOMException.
+    if (is_detached())
+        return WebIDL::InvalidStateError::create(realm(), "OffscreenCanvas is detached"_string);
+
+    // 4. Run the steps in the cell of the following table whose column header matches this's context mode and whose
+    //    row header matches contextId:
+    // NOTE: See the spec for the full table.
+    if (context_id == Bindings::OffscreenRenderingContextId::_2d) {
+        // none: Let context be the result of running the offscreen 2D context creation algorithm given this and options.
+        //       Set this's context mode to 2d. Return context.
+        if (!m_context)
+            m_context = TRY(OffscreenCanvasRenderingContext2D::create(realm(), *this, options));
+
+        // 2d: Return the same object as was returned the last time the method was invoked with this same first argument.
+        return m_context;
+    }
+
+    // FIXME: Support the "bitmaprenderer", "webgl", "webgl2" and "webgpu" contexts.
+    return nullptr;
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-offscreencanvas-transfertoimagebitmap
+WebIDL::ExceptionOr<GC::Ref<ImageBitmap>> OffscreenCanvas::transfer_to_image_bitmap()
+{
+    // 1. If the value of this OffscreenCanvas object's [[Detached]] internal slot is set to true, then throw an
+    //    "InvalidStateError" DOMException.
+    if (is_detached())
+        return WebIDL::InvalidStateError::create(realm(), "OffscreenCanvas is detached"_string);
+
+    // 2. If this OffscreenCanvas object's context mode is set to none, then throw an "InvalidStateError" DOMException.
+    if (!m_context)
+        return WebIDL::InvalidStateError::create(realm(), "OffscreenCanvas has no rendering context"_string);
+
+    // 3. Let image be a newly created ImageBitmap object that references the same underlying bitmap data as this
+    //    OffscreenCanvas object's bitmap.
+    auto image = ImageBitmap::create(realm());
+    m_context->allocate_painting_surface_if_needed();
+    auto surface = m_context->surface();
+    if (!surface)
+        return image;
+
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, surface->size()));
+    surface->read_into_bitmap(*bitmap);
+    image->set_bitmap(bitmap);
+
+    // 4. Set this OffscreenCanvas object's bitmap to reference a newly created bitmap of the same dimensions and color
+    //    space as the previous bitmap, and with its pixels initialized to transparent black, or opaque black if the
+    //    rendering context's alpha is false.
+    // NOTE: The pixels are written rather than cleared by the painter, so that they are not subject to the current
+    //       transform and clipping region of the rendering context.
+    auto new_bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, surface->size()));
+    Gfx::Painter::create(new_bitmap)->clear_rect(new_bitmap->rect().to_type<float>(), m_context->get_context_attributes().alpha ? Gfx::Color::Transparent : Gfx::Color::Black);
+    surface->write_from_bitmap(*new_bitmap);
+    did_draw();
+
+    // 5. Return image.
+    return image;
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#dom-offscreencanvas-converttoblob
+GC::Ref<WebIDL::Promise> OffscreenCanvas::convert_to_blob(ImageEncodeOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. If the value of this's [[Detached]] internal slot is true, then return a promise rejected with an
+    //    "InvalidStateError" DOMException.
+    if (is_detached())
+        return WebIDL::create_rejected_promise_from_exception(realm, WebIDL::InvalidStateError::create(realm, "OffscreenCanvas is detached"_string));
+
+    // FIXME: 2. If this's context mode is 2d and the rendering context's output bitmap's origin-clean flag is set to
+    //           false, then return a promise rejected with a "SecurityError" DOMException.
+
+    // 3. If this's bitmap has no pixels (i.e., either its horizontal dimension or its vertical dimension is zero) then
+    //    return a promise rejected with an "IndexSizeError" DOMException.
+    auto size = bitmap_size();
+    if (size.is_empty())
+        return WebIDL::create_rejected_promise_from_exception(realm, WebIDL::IndexSizeError::create(realm, "OffscreenCanvas has no pixels"_string));
+
+    // 4. Let bitmap be a copy of this's bitmap.
+    auto bitmap = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, size));
+    if (auto surface = m_context ? m_context->surface() : nullptr)
+        surface->read_into_bitmap(*bitmap);
+
+    // 5. Let result be a new promise object.
+    auto result = WebIDL::create_promise(realm);
+
+    // 6. Run these steps in parallel:
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [this, result, bitmap = move(bitmap), type = options.type, quality = options.quality] {
+        // 1. Let file be a serialization of bitmap as a file, with options's type and quality if present.
+        auto file = serialize_bitmap(*bitmap, type, quality.has_value() ? JS::Value(*quality) : JS::js_undefined());
+
+        // 2. Queue a global task on the canvas blob serialization task source given this's relevant global object to
+        //    run these steps:
+        queue_global_task(Task::Source::CanvasBlobSerializationTask, relevant_global_object(*this), GC::create_function(heap(), [this, result, file = move(file)]() mutable {
+            auto& realm = this->realm();
+            HTML::TemporaryExecutionContext context(realm);
+
+            // 1. If file is null, then reject result with an "EncodingError" DOMException.
+            if (file.is_error()) {
+                WebIDL::reject_promise(realm, result, WebIDL::EncodingError::create(realm, MUST(String::formatted("Failed to encode OffscreenCanvas: {}", file.error()))));
+                return;
+            }
+
+            // 2. Otherwise, resolve result with a new Blob object, created in this's relevant realm, representing file.
+            auto blob = FileAPI::Blob::create(realm, move(file.value().buffer), MUST(String::from_utf8(file.value().mime_type)));
+            WebIDL::resolve_promise(realm, result, blob);
+        }));
+    }));
+
+    // 7. Return result.
+    return result;
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#offscreencanvas-placeholder
+void OffscreenCanvas::set_placeholder_canvas_element(HTMLCanvasElement& placeholder_canvas_element)
+{
+    m_placeholder_canvas_element = placeholder_canvas_element;
+}
+
+void OffscreenCanvas::did_draw()
+{
+    if (!m_placeholder_canvas_element && !m_placeholder_transport)
+        return;
+    if (m_has_pending_frame)
+        return;
+    m_has_pending_frame = true;
+
+    // NOTE: The bitmap is pushed to the placeholder canvas element once the current task is done, so that everything
+    //       drawn by a task shows up in the same frame, without waiting for the event loop of the placeholder canvas
+    //       element to be free.
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(heap(), [this] {
+        m_has_pending_frame = false;
+        push_frame_to_placeholder_canvas_element();
+    }));
+}
+
+void OffscreenCanvas::push_frame_to_placeholder_canvas_element()
+{
+    if (!m_context)
+        return;
+    auto surface = m_context->surface();
+    if (!surface)
+        return;
+
+    if (m_placeholder_canvas_element) {
+        auto frame = MUST(Gfx::Bitmap::create(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, surface->size()));
+        surface->read_into_bitmap(*frame);
+        m_placeholder_canvas_element->set_placeholder_frame(*frame);
+        return;
+    }
+
+    if (!m_placeholder_transport || !m_placeholder_transport->is_open())
+        return;
+
+    auto frame_or_error = Gfx::Bitmap::create_shareable(Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied, surface->size());
+    if (frame_or_error.is_error()) {
+        dbgln("Failed to allocate OffscreenCanvas frame: {}", frame_or_error.error());
+        return;
+    }
+    auto frame = frame_or_error.release_value();
+    surface->read_into_bitmap(*frame);
+
+    IPC::MessageBuffer buffer;
+    IPC::Encoder encoder(buffer);
+    MUST(encoder.encode(frame->to_shareable_bitmap()));
+
+    if (auto result = buffer.transfer_message(*m_placeholder_transport); result.is_error()) {
+        dbgln("Failed to push OffscreenCanvas frame to its placeholder canvas element: {}", result.error());
+        m_placeholder_transport.clear();
+    }
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#the-offscreencanvas-interface:transfer-steps
+WebIDL::ExceptionOr<void> OffscreenCanvas::transfer_steps(HTML::TransferDataHolder& data_holder)
+{
+    // 1. If value's context mode is not equal to none, then throw an "InvalidStateError" DOMException.
+    if (m_context)
+        return WebIDL::InvalidStateError::create(realm(), "Cannot transfer an OffscreenCanvas that has a rendering context"_string);
+
+    // 2. Set value's context mode to detached.
+    // NOTE: Our caller sets [[Detached]] to true, which is what we use to represent the detached context mode.
+
+    // 3. Let width and height be the dimensions of value's bitmap.
+    // 4. Unset value's bitmap.
+    // 5. Set dataHolder.[[Width]] to width and dataHolder.[[Height]] to height.
+    serialize_primitive_type(data_holder.data, m_width);
+    serialize_primitive_type(data_holder.data, m_height);
+
+    // 6. Set dataHolder.[[PlaceholderCanvas]] to be a weak reference to value's placeholder canvas element, if value
+    //    has one, or null if it does not.
+    // NOTE: The OffscreenCanvas may be transferred to another process, so the placeholder canvas element is referred to
+    //       by a transport that frames are sent over. The placeholder canvas element holds the other end of it.
+    if (m_placeholder_canvas_element) {
+        int fds[2] = {};
+        MUST(Core::System::socketpair(AF_LOCAL, SOCK_STREAM, 0, fds));
+
+        auto socket = MUST(Core::LocalSocket::adopt_fd(fds[0]));
+        MUST(socket->set_blocking(false));
+        MUST(socket->set_close_on_exec(true));
+        m_placeholder_canvas_element->set_up_placeholder_transport(make<IPC::Transport>(move(socket)));
+        m_placeholder_canvas_element = nullptr;
+
+        data_holder.fds.append(IPC::File::adopt_fd(fds[1]));
+        data_holder.data.append(IPC_FILE_TAG);
+    } else if (m_placeholder_transport) {
+        // TODO: Mach IPC
+        auto fd = MUST(m_placeholder_transport->release_underlying_transport_for_transfer());
+        m_placeholder_transport.clear();
+
+        data_holder.fds.append(IPC::File::adopt_fd(fd));
+        data_holder.data.append(IPC_FILE_TAG);
+    } else {
+        data_holder.data.append(0);
+    }
+
+    return {};
+}
+
+// https://html.spec.whatwg.org/multipage/canvas.html#the-offscreencanvas-interface:transfer-receiving-steps
+WebIDL::ExceptionOr<void> OffscreenCanvas::transfer_receiving_steps(HTML::TransferDataHolder& data_holder)
+{
+    size_t position = 0;
+
+    // 1. Initialize value's bitmap to a rectangular array of transparent black pixels with width given by
+    //    dataHolder.[[Width]] and height given by dataHolder.[[Height]].
+    m_width = deserialize_primitive_type<WebIDL::UnsignedLongLong>(data_holder.data, position);
+    m_height = deserialize_primitive_type<WebIDL::UnsignedLongLong>(data_holder.data, position);
+
+    // 2. If dataHolder.[[PlaceholderCanvas]] is not null, set value's placeholder canvas element to
+    //    dataHolder.[[PlaceholderCanvas]] (while maintaining the weak reference semantics).
+    auto fd_tag = data_holder.data[position];
+    if (fd_tag == IPC_FILE_TAG) {
+        // TODO: Mach IPC
+        auto fd = data_holder.fds.take_first();
+        auto socket = MUST(Core::LocalSocket::adopt_fd(fd.take_fd()));
+        MUST(socket->set_blocking(false));
+        m_placeholder_transport = make<IPC::Transport>(move(socket));
+    } else if (fd_tag != 0) {
+        dbgln("Unexpected byte {:x} in OffscreenCanvas transfer data", fd_tag);
+        VERIFY_NOT_REACHED();
+    }
+
+    return {};
+}
+
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/WeakPtr.h>
+#include <LibGfx/Size.h>
+#include <LibIPC/Transport.h>
+#include <LibWeb/Bindings/OffscreenCanvasPrototype.h>
+#include <LibWeb/Bindings/Transferable.h>
+#include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/canvas.html#imageencodeoptions
+struct ImageEncodeOptions {
+    String type;
+    Optional<double> quality;
+};
+
+// https://html.spec.whatwg.org/multipage/canvas.html#offscreencanvas
+class OffscreenCanvas final
+    : public DOM::EventTarget
+    , public Bindings::Transferable {
+    WEB_PLATFORM_OBJECT(OffscreenCanvas, DOM::EventTarget);
+    GC_DECLARE_ALLOCATOR(OffscreenCanvas);
+
+public:
+    [[nodiscard]] static GC::Ref<OffscreenCanvas> create(JS::Realm&, WebIDL::UnsignedLongLong width, WebIDL::UnsignedLongLong height);
+    static WebIDL::ExceptionOr<GC::Ref<OffscreenCanvas>> construct_impl(JS::Realm&, WebIDL::UnsignedLongLong width, WebIDL::UnsignedLongLong height);
+
+    virtual ~OffscreenCanvas() override;
+
+    WebIDL::UnsignedLongLong width() const { return m_width; }
+    WebIDL::UnsignedLongLong height() const { return m_height; }
+
+    WebIDL::ExceptionOr<void> set_width(WebIDL::UnsignedLongLong);
+    WebIDL::ExceptionOr<void> set_height(WebIDL::UnsignedLongLong);
+
+    WebIDL::ExceptionOr<GC::Ptr<OffscreenCanvasRenderingContext2D>> get_context(Bindings::OffscreenRenderingContextId, JS::Value options);
+    WebIDL::ExceptionOr<GC::Ref<ImageBitmap>> transfer_to_image_bitmap();
+    GC::Ref<WebIDL::Promise> convert_to_blob(ImageEncodeOptions const&);
+
+    Gfx::IntSize bitmap_size() const;
+
+    // https://html.spec.whatwg.org/multipage/canvas.html#offscreencanvas-placeholder
+    void set_placeholder_canvas_element(HTMLCanvasElement&);
+
+    // Called by the rendering context whenever it draws onto the bitmap.
+    void did_draw();
+
+    // ^Web::Bindings::Transferable
+    virtual WebIDL::ExceptionOr<void> transfer_steps(HTML::TransferDataHolder&) override;
+    virtual WebIDL::ExceptionOr<void> transfer_receiving_steps(HTML::TransferDataHolder&) override;
+    virtual HTML::TransferType primary_interface() const override { return HTML::TransferType::OffscreenCanvas; }
+
+private:
+    OffscreenCanvas(JS::Realm&, WebIDL::UnsignedLongLong width, WebIDL::UnsignedLongLong height);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    void did_change_size();
+    void push_frame_to_placeholder_canvas_element();
+
+    WebIDL::UnsignedLongLong m_width { 0 };
+    WebIDL::UnsignedLongLong m_height { 0 };
+
+    // https://html.spec.whatwg.org/multipage/canvas.html#offscreencanvas-context-mode
+    // NOTE: The context mode is "none" while there is no context, and "detached" once the OffscreenCanvas has been transferred.
+    GC::Ptr<OffscreenCanvasRenderingContext2D> m_context;
+
+    // While the OffscreenCanvas lives on the same event loop as its placeholder canvas element, frames are handed to the
+    // element directly. Once it has been transferred (e.g. to a worker), frames are sent to the element over a transport.
+    WeakPtr<HTMLCanvasElement> m_placeholder_canvas_element;
+    OwnPtr<IPC::Transport> m_placeholder_transport;
+
+    bool m_has_pending_frame { false };
+};
+
+}
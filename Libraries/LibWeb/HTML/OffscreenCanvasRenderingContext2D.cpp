@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/FontCascadeList.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/OffscreenCanvasRenderingContext2DPrototype.h>
+#include <LibWeb/CSS/StyleComputer.h>
+#include <LibWeb/CSS/StyleValues/LengthStyleValue.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/OffscreenCanvas.h>
+#include <LibWeb/HTML/OffscreenCanvasRenderingContext2D.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/TraversableNavigable.h>
+#include <LibWeb/HTML/Window.h>
+#include <LibWeb/Platform/FontPlugin.h>
+
+namespace Web::HTML {
+
+GC_DEFINE_ALLOCATOR(OffscreenCanvasRenderingContext2D);
+
+// https://html.spec.whatwg.org/multipage/canvas.html#offscreen-2d-context-creation-algorithm
+JS::ThrowCompletionOr<GC::Ref<OffscreenCanvasRenderingContext2D>> OffscreenCanvasRenderingContext2D::create(JS::Realm& realm, OffscreenCanvas& canvas, JS::Value options)
+{
+    // 1. Let settings be the result of converting options to a CanvasRenderingContext2DSettings dictionary.
+    auto settings = TRY(context_attributes_from_options(realm.vm(), options));
+
+    // 2. Let context be a new OffscreenCanvasRenderingContext2D object.
+    // 3. Set context's associated OffscreenCanvas object to offscreenCanvas.
+    // 4. Run the canvas settings output bitmap initialization algorithm, given context and settings.
+    // 5. Set context's output bitmap to a newly created bitmap with the dimensions specified by the width and height
+    //    attributes of offscreenCanvas, and set offscreenCanvas's bitmap to the same bitmap (so that they are shared).
+    // 6. If context's alpha flag is set to true, initialize all the pixels of context's bitmap to transparent black.
+    //    Otherwise, initialize the pixels to opaque black.
+    // NOTE: The bitmap is allocated once something is drawn, at which point its pixels are initialized.
+    // 7. Return context.
+    return realm.create<OffscreenCanvasRenderingContext2D>(realm, canvas, move(settings));
+}
+
+OffscreenCanvasRenderingContext2D::OffscreenCanvasRenderingContext2D(JS::Realm& realm, OffscreenCanvas& canvas, CanvasRenderingContext2DSettings settings)
+    : CanvasRenderingContext2D(realm, canvas.bitmap_size(), move(settings))
+    , m_canvas(canvas)
+{
+}
+
+OffscreenCanvasRenderingContext2D::~OffscreenCanvasRenderingContext2D() = default;
+
+void OffscreenCanvasRenderingContext2D::initialize(JS::Realm& realm)
+{
+    Base::initialize(realm);
+    set_prototype(&Bindings::ensure_web_prototype<Bindings::OffscreenCanvasRenderingContext2DPrototype>(realm, "OffscreenCanvasRenderingContext2D"_string));
+}
+
+void OffscreenCanvasRenderingContext2D::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_canvas);
+}
+
+RefPtr<Gfx::SkiaBackendContext> OffscreenCanvasRenderingContext2D::skia_backend_context() const
+{
+    // NOTE: Workers have no navigable to get a GPU backend from, so the bitmap is rasterized on the CPU there.
+    auto* window = as_if<Window>(relevant_global_object(*this));
+    if (!window || !window->navigable())
+        return nullptr;
+    return window->navigable()->traversable_navigable()->skia_backend_context();
+}
+
+void OffscreenCanvasRenderingContext2D::did_draw(Gfx::FloatRect const&)
+{
+    m_canvas->did_draw();
+}
+
+RefPtr<Gfx::FontCascadeList const> OffscreenCanvasRenderingContext2D::compute_font_for_style_values(CSS::CSSStyleValue const& font_family, CSS::CSSStyleValue const& font_size, CSS::CSSStyleValue const& font_style, CSS::CSSStyleValue const& font_weight, CSS::CSSStyleValue const& font_width)
+{
+    // NOTE: There is no canvas element to inherit the font from, so relative font sizes resolve against the default font size.
+    if (auto* window = as_if<Window>(relevant_global_object(*this)))
+        return window->associated_document().style_computer().compute_font_for_style_values(nullptr, {}, font_family, font_size, font_style, font_weight, font_width);
+
+    // FIXME: Workers have no style computer to match fonts with, so only the size of the font is honored there.
+    float font_size_in_px = 10;
+    if (font_size.is_length() && font_size.as_length().length().is_absolute())
+        font_size_in_px = font_size.as_length().length().absolute_length_to_px().to_float();
+
+    auto font_list = Gfx::FontCascadeList::create();
+    if (auto font = Platform::FontPlugin::the().default_font(font_size_in_px))
+        font_list->add(font.release_nonnull());
+    return font_list;
+}
+
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibWeb/HTML/CanvasRenderingContext2D.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/canvas.html#offscreencanvasrenderingcontext2d
+// NOTE: This draws exactly like a CanvasRenderingContext2D, except that it draws onto an OffscreenCanvas. As the
+//       OffscreenCanvas may live in a worker, it can not rely on a document to resolve fonts, or on a navigable to
+//       provide a GPU backend.
+class OffscreenCanvasRenderingContext2D final : public CanvasRenderingContext2D {
+    WEB_PLATFORM_OBJECT(OffscreenCanvasRenderingContext2D, CanvasRenderingContext2D);
+    GC_DECLARE_ALLOCATOR(OffscreenCanvasRenderingContext2D);
+
+public:
+    static JS::ThrowCompletionOr<GC::Ref<OffscreenCanvasRenderingContext2D>> create(JS::Realm&, OffscreenCanvas&, JS::Value options);
+    virtual ~OffscreenCanvasRenderingContext2D() override;
+
+    GC::Ref<OffscreenCanvas> offscreen_canvas_for_binding() const { return m_canvas; }
+
+    virtual RefPtr<Gfx::FontCascadeList const> compute_font_for_style_values(CSS::CSSStyleValue const& font_family, CSS::CSSStyleValue const& font_size, CSS::CSSStyleValue const& font_style, CSS::CSSStyleValue const& font_weight, CSS::CSSStyleValue const& font_width) override;
+
+private:
+    OffscreenCanvasRenderingContext2D(JS::Realm&, OffscreenCanvas&, CanvasRenderingContext2DSettings);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+
+    virtual RefPtr<Gfx::SkiaBackendContext> skia_backend_context() const override;
+    virtual void did_draw(Gfx::FloatRect const&) override;
+
+    GC::Ref<OffscreenCanvas> m_canvas;
+};
+
+}
@@ -8,6 +8,7 @@
 
 #include <AK/Debug.h>
 #include <AK/SourceLocation.h>
+#include <AK/TemporaryChange.h>
 #include <AK/Utf32View.h>
 #include <LibTextCodec/Decoder.h>
 #include <LibWeb/Bindings/ExceptionOrUtils.h>
@@ -38,6 +39,7 @@
 #include <LibWeb/HTML/Parser/HTMLEncodingDetection.h>
 #include <LibWeb/HTML/Parser/HTMLParser.h>
 #include <LibWeb/HTML/Parser/HTMLToken.h>
+#include <LibWeb/HTML/Parser/PreloadScanner.h>
 #include <LibWeb/HTML/Scripting/ExceptionReporter.h>
 #include <LibWeb/HTML/Scripting/SimilarOriginWindowAgent.h>
 #include <LibWeb/HTML/Window.h>
@@ -202,6 +204,15 @@ void HTMLParser::initialize(JS::Realm& realm)
 #endif
 }
 
+// FIXME: Tokenize on a background thread and hand batches of tokens to the tree construction stage, so that the two can
+//        overlap on large documents. This requires the tokenizer to run ahead speculatively, since it currently depends
+//        on the tree construction stage after every token:
+//        - Start tags for elements like <script>, <style>, <textarea> and <plaintext> switch the tokenizer state.
+//        - Whether a CDATA section is allowed depends on the adjusted current node.
+//        - Scripts may insert input at the insertion point through document.write(), or abort the parser.
+//        The background tokenizer would need to checkpoint its state after each such token, and the tree construction
+//        stage would have to discard the tokens after a checkpoint whenever it switches the tokenizer into a different
+//        state, or whenever input is inserted before the tokenizer's position.
 void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point)
 {
     m_stop_parsing = false;
@@ -260,11 +271,34 @@ void HTMLParser::run(HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point
             dbgln_if(HTML_PARSER_DEBUG, "Stop parsing{}! :^)", m_parsing_fragment ? " fragment" : "");
             break;
         }
+
+        // NOTE: Invocations of the parser from within a script (e.g. through document.write()) have to run to completion.
+        if (m_time_slice_deadline.has_value() && script_nesting_level() == 0 && MonotonicTime::now_coarse() >= *m_time_slice_deadline) {
+            dbgln_if(HTML_PARSER_DEBUG, "Yielding to the event loop");
+            break;
+        }
     }
 
     flush_character_insertions();
 }
 
+// https://html.spec.whatwg.org/multipage/parsing.html#start-the-speculative-html-parser
+void HTMLParser::start_the_speculative_html_parser()
+{
+    // NOTE: Rather than building a speculative mock tree in parallel, we run over the rest of the input once, right
+    //       now, and only look for resources to fetch. It never affects the document or the actual parser.
+    if (!m_document->browsing_context())
+        return;
+
+    auto unparsed_input_length = m_tokenizer.unparsed_input_length();
+    if (unparsed_input_length <= m_unparsed_input_length_when_last_scanned_speculatively)
+        return;
+    m_unparsed_input_length_when_last_scanned_speculatively = unparsed_input_length;
+
+    PreloadScanner scanner { *m_document };
+    scanner.scan(m_tokenizer.unparsed_input());
+}
+
 void HTMLParser::run(const URL::URL& url, HTMLTokenizer::StopAtInsertionPoint stop_at_insertion_point)
 {
     m_document->set_url(url);
@@ -3083,7 +3117,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     // 2. Set the pending parsing-blocking script to null.
                     auto the_script = document().take_pending_parsing_blocking_script({});
 
-                    // FIXME: 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    // 3. Start the speculative HTML parser for this instance of the HTML parser.
+                    start_the_speculative_html_parser();
 
                     // 4. Block the tokenizer for this instance of the HTML parser, such that the event loop will not run tasks that invoke the tokenizer.
                     m_tokenizer.set_blocked(true);
@@ -3102,7 +3137,8 @@ void HTMLParser::handle_text(HTMLToken& token)
                     if (m_aborted)
                         return;
 
-                    // FIXME: 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // 7. Stop the speculative HTML parser for this instance of the HTML parser.
+                    // NOTE: Ours ran to completion when it was started, so there is nothing to stop.
 
                     // 8. Unblock the tokenizer for this instance of the HTML parser, such that tasks that invoke the tokenizer can again be run.
                     m_tokenizer.set_blocked(false);
@@ -4682,6 +4718,172 @@ GC::Ref<HTMLParser> HTMLParser::create(DOM::Document& document, StringView input
     return document.realm().create<HTMLParser>(document, input, encoding);
 }
 
+GC::Ref<HTMLParser> HTMLParser::create_for_network_input(DOM::Document& document, URL::URL const& url, Optional<MimeSniff::MimeType> maybe_mime_type)
+{
+    auto parser = document.realm().create<HTMLParser>(document);
+    parser->m_input_byte_stream_mime_type = move(maybe_mime_type);
+    parser->m_tokenizer.set_more_input_expected(true);
+    document.set_url(url);
+    return parser;
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#the-input-byte-stream
+void HTMLParser::append_to_input_byte_stream(ReadonlyBytes bytes)
+{
+    if (m_aborted || m_input_byte_stream_is_complete)
+        return;
+
+    if (!m_input_byte_stream_decoder.has_value()) {
+        m_undecoded_input_bytes.append(bytes);
+
+        // NOTE: Wait until the encoding sniffing algorithm has enough bytes to prescan for a character encoding
+        //       declaration, so that the encoding does not have to be changed once parsing has started.
+        if (m_undecoded_input_bytes.size() < 1024)
+            return;
+        determine_the_input_byte_stream_encoding();
+        bytes = {};
+    }
+
+    decode_the_input_byte_stream(bytes);
+    queue_a_task_to_process_the_input_byte_stream();
+}
+
+void HTMLParser::finish_input_byte_stream()
+{
+    if (m_aborted || m_input_byte_stream_is_complete)
+        return;
+
+    m_input_byte_stream_is_complete = true;
+
+    if (!m_input_byte_stream_decoder.has_value())
+        determine_the_input_byte_stream_encoding();
+
+    decode_the_input_byte_stream({});
+    m_document->set_source(MUST(m_decoded_source.to_string()));
+
+    // When no more bytes are available, the user agent must queue a global task on the networking task source given
+    // document's relevant global object to have the parser to process the implied EOF character.
+    m_tokenizer.set_more_input_expected(false);
+    queue_a_task_to_process_the_input_byte_stream();
+}
+
+void HTMLParser::determine_the_input_byte_stream_encoding()
+{
+    VERIFY(!m_input_byte_stream_decoder.has_value());
+
+    auto encoding = m_document->has_encoding()
+        ? m_document->encoding()->to_byte_string()
+        : run_encoding_sniffing_algorithm(*m_document, m_undecoded_input_bytes, m_input_byte_stream_mime_type);
+    dbgln_if(HTML_PARSER_DEBUG, "The encoding sniffing algorithm returned encoding '{}'", encoding);
+
+    m_input_byte_stream_decoder = TextCodec::decoder_for(encoding);
+    VERIFY(m_input_byte_stream_decoder.has_value());
+    auto standardized_encoding = TextCodec::get_standardized_encoding(encoding);
+    VERIFY(standardized_encoding.has_value());
+    m_document->set_encoding(MUST(String::from_utf8(standardized_encoding.value())));
+
+    // NOTE: In all other encodings we support, the bytes for '>' and '\n' are never part of a multi-byte sequence, and
+    //       the decoder does not carry any state past them.
+    m_input_byte_stream_can_be_decoded_incrementally = !standardized_encoding->is_one_of("UTF-16BE"sv, "UTF-16LE"sv, "ISO-2022-JP"sv);
+}
+
+void HTMLParser::decode_the_input_byte_stream(ReadonlyBytes new_bytes)
+{
+    // NOTE: As long as everything received so far has been decoded, new bytes are decoded straight from the network
+    //       buffer, and only a trailing partial line or tag is held back.
+    auto bytes = new_bytes;
+    if (!m_undecoded_input_bytes.is_empty() || !m_input_byte_stream_can_be_decoded_incrementally) {
+        m_undecoded_input_bytes.append(new_bytes);
+        bytes = m_undecoded_input_bytes.bytes();
+    }
+    auto length_to_decode = bytes.size();
+
+    if (!m_input_byte_stream_is_complete) {
+        if (!m_input_byte_stream_can_be_decoded_incrementally)
+            return;
+
+        // NOTE: Only hand whole lines and tags to the tokenizer, so that a chunk never ends in the middle of a multi-byte
+        //       sequence, a CRLF pair or a character reference.
+        length_to_decode = 0;
+        for (auto i = bytes.size(); i > 0; --i) {
+            if (bytes[i - 1] == '>' || bytes[i - 1] == '\n') {
+                length_to_decode = i;
+                break;
+            }
+        }
+    }
+
+    auto bytes_to_decode = bytes.trim(length_to_decode);
+
+    // NOTE: Decoders leave byte order marks alone, so skip the one the encoding was sniffed from at the start of the stream.
+    if (m_decoded_source.is_empty()) {
+        if (auto decoder = TextCodec::bom_sniff_to_decoder(StringView { bytes_to_decode }); decoder.has_value() && &decoder.value() == &m_input_byte_stream_decoder.value())
+            bytes_to_decode = bytes_to_decode.slice(bytes_to_decode.starts_with("\xEF\xBB\xBF"sv.bytes()) ? 3 : 2);
+    }
+
+    // The decoded input is appended to the document's source, which the tokenizer then reads the new part of. For
+    // ASCII and valid UTF-8 input, both of these are plain copies.
+    auto decoded_source_length = m_decoded_source.length();
+    MUST(m_input_byte_stream_decoder->append_utf8(StringView { bytes_to_decode }, m_decoded_source));
+    m_tokenizer.append_input(m_decoded_source.string_view().substring_view(decoded_source_length));
+
+    auto remaining_bytes = bytes.slice(length_to_decode);
+    if (remaining_bytes.data() == m_undecoded_input_bytes.data())
+        return;
+    if (remaining_bytes.is_empty())
+        m_undecoded_input_bytes.clear();
+    else
+        m_undecoded_input_bytes = MUST(ByteBuffer::copy(remaining_bytes));
+}
+
+void HTMLParser::queue_a_task_to_process_the_input_byte_stream()
+{
+    if (m_has_queued_a_task_to_process_the_input_byte_stream)
+        return;
+    m_has_queued_a_task_to_process_the_input_byte_stream = true;
+
+    // NOTE: We don't process the input right away, since the fetch task that delivered it runs with a temporary
+    //       execution context on the stack, which would prevent scripts from performing microtask checkpoints.
+    queue_global_task(Task::Source::Networking, *m_document, GC::create_function(heap(), [parser = GC::Ref { *this }] {
+        parser->m_has_queued_a_task_to_process_the_input_byte_stream = false;
+        parser->process_the_input_byte_stream();
+    }));
+}
+
+void HTMLParser::process_the_input_byte_stream()
+{
+    if (m_aborted || m_has_finished_processing_the_input_byte_stream)
+        return;
+
+    // If the tokenizer is blocked on a parser-blocking script, or the parser is already running further up the stack
+    // (e.g. while a script spins the event loop), that invocation of the parser will pick up the new input.
+    if (m_tokenizer.is_blocked()) {
+        start_the_speculative_html_parser();
+        return;
+    }
+    if (m_is_processing_the_input_byte_stream || script_nesting_level() > 0)
+        return;
+
+    {
+        TemporaryChange is_processing { m_is_processing_the_input_byte_stream, true };
+        TemporaryChange time_slice_deadline { m_time_slice_deadline, Optional<MonotonicTime> { MonotonicTime::now_coarse() + AK::Duration::from_milliseconds(8) } };
+        run();
+    }
+
+    if (m_aborted)
+        return;
+
+    if (m_tokenizer.has_emitted_eof()) {
+        m_has_finished_processing_the_input_byte_stream = true;
+        the_end(*m_document, this);
+        return;
+    }
+
+    // If we yielded before running out of input, continue in a later task.
+    if (!m_tokenizer.is_waiting_for_more_input())
+        queue_a_task_to_process_the_input_byte_stream();
+}
+
 enum class AttributeMode {
     No,
     Yes,
@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <AK/Time.h>
 #include <LibGfx/Color.h>
 #include <LibJS/Heap/Cell.h>
+#include <LibTextCodec/Decoder.h>
 #include <LibWeb/DOM/Node.h>
 #include <LibWeb/HTML/Parser/HTMLTokenizer.h>
 #include <LibWeb/HTML/Parser/ListOfActiveFormattingElements.h>
@@ -62,6 +64,12 @@ public:
     static GC::Ref<HTMLParser> create_with_uncertain_encoding(DOM::Document&, ByteBuffer const& input, Optional<MimeSniff::MimeType> maybe_mime_type = {});
     static GC::Ref<HTMLParser> create(DOM::Document&, StringView input, StringView encoding);
 
+    // Creates a parser that is fed the document's bytes as they arrive from the network, and that parses them in time
+    // slices so that the event loop can render partial documents and handle input in between.
+    static GC::Ref<HTMLParser> create_for_network_input(DOM::Document&, URL::URL const&, Optional<MimeSniff::MimeType> maybe_mime_type = {});
+    void append_to_input_byte_stream(ReadonlyBytes);
+    void finish_input_byte_stream();
+
     void run(HTMLTokenizer::StopAtInsertionPoint = HTMLTokenizer::StopAtInsertionPoint::No);
     void run(const URL::URL&, HTMLTokenizer::StopAtInsertionPoint = HTMLTokenizer::StopAtInsertionPoint::No);
 
@@ -212,6 +220,31 @@ private:
     bool m_stop_parsing { false };
     size_t m_script_nesting_level { 0 };
 
+    // How much input was left when we last started the speculative HTML parser. Input only gets inserted before the
+    // part we have scanned or appended after it, so there is nothing new to find as long as less than this is left.
+    size_t m_unparsed_input_length_when_last_scanned_speculatively { 0 };
+
+    void start_the_speculative_html_parser();
+
+    void determine_the_input_byte_stream_encoding();
+    void decode_the_input_byte_stream(ReadonlyBytes new_bytes);
+    void queue_a_task_to_process_the_input_byte_stream();
+    void process_the_input_byte_stream();
+
+    // State for parsers created with create_for_network_input().
+    Optional<MimeSniff::MimeType> m_input_byte_stream_mime_type;
+    ByteBuffer m_undecoded_input_bytes;
+    Optional<TextCodec::Decoder&> m_input_byte_stream_decoder;
+    bool m_input_byte_stream_can_be_decoded_incrementally { false };
+    bool m_input_byte_stream_is_complete { false };
+    bool m_has_queued_a_task_to_process_the_input_byte_stream { false };
+    bool m_is_processing_the_input_byte_stream { false };
+    bool m_has_finished_processing_the_input_byte_stream { false };
+    StringBuilder m_decoded_source;
+
+    // While set, top-level (i.e. not re-entered from a script) invocations of run() yield once this time has passed.
+    Optional<MonotonicTime> m_time_slice_deadline;
+
     JS::Realm& realm();
 
     GC::Ptr<DOM::Document> m_document;
@@ -36,6 +36,8 @@ namespace Web::HTML {
         m_state = State::new_state;                                                               \
         if (stop_at_insertion_point == StopAtInsertionPoint::Yes && is_insertion_point_reached()) \
             return {};                                                                            \
+        if (has_consumed_all_received_input())                                                    \
+            return {};                                                                            \
         CONSUME_NEXT_INPUT_CHARACTER;                                                             \
         goto new_state;                                                                           \
     } while (0)
@@ -195,23 +197,23 @@ static inline void log_parse_error(SourceLocation const& location = SourceLocati
 
 Optional<u32> HTMLTokenizer::next_code_point(StopAtInsertionPoint stop_at_insertion_point)
 {
-    if (m_current_offset >= static_cast<ssize_t>(m_decoded_input.size()))
+    if (m_current_offset >= static_cast<ssize_t>(input_length()))
         return {};
 
     u32 code_point;
     // https://html.spec.whatwg.org/multipage/parsing.html#preprocessing-the-input-stream:tokenization
     // https://infra.spec.whatwg.org/#normalize-newlines
-    if (peek_code_point(0, stop_at_insertion_point).value_or(0) == '\r' && peek_code_point(1, stop_at_insertion_point).value_or(0) == '\n') {
+    if (peek_code_point(0, stop_at_insertion_point).value_or(0) != '\r') {
+        skip(1);
+        code_point = input_code_point_at(m_prev_offset);
+    } else if (peek_code_point(1, stop_at_insertion_point).value_or(0) == '\n') {
         // replace every U+000D CR U+000A LF code point pair with a single U+000A LF code point,
         skip(2);
         code_point = '\n';
-    } else if (peek_code_point(0, stop_at_insertion_point).value_or(0) == '\r') {
+    } else {
         // replace every remaining U+000D CR code point with a U+000A LF code point.
         skip(1);
         code_point = '\n';
-    } else {
-        skip(1);
-        code_point = m_decoded_input[m_prev_offset];
     }
 
     dbgln_if(TOKENIZER_TRACE_DEBUG, "(Tokenizer) Next code_point: {}", code_point);
@@ -224,7 +226,7 @@ void HTMLTokenizer::skip(size_t count)
         m_source_positions.append(m_source_positions.last());
     for (size_t i = 0; i < count; ++i) {
         m_prev_offset = m_current_offset;
-        auto code_point = m_decoded_input[m_current_offset];
+        auto code_point = input_code_point_at(m_current_offset);
         if (!m_source_positions.is_empty()) {
             if (code_point == '\n') {
                 m_source_positions.last().column = 0;
@@ -240,14 +242,14 @@ void HTMLTokenizer::skip(size_t count)
 Optional<u32> HTMLTokenizer::peek_code_point(ssize_t offset, StopAtInsertionPoint stop_at_insertion_point) const
 {
     auto it = m_current_offset + offset;
-    if (it >= static_cast<ssize_t>(m_decoded_input.size()))
+    if (it >= static_cast<ssize_t>(input_length()))
         return {};
     if (stop_at_insertion_point == StopAtInsertionPoint::Yes
         && m_insertion_point.defined
         && it >= m_insertion_point.position) {
         return {};
     }
-    return m_decoded_input[it];
+    return input_code_point_at(it);
 }
 
 HTMLToken::Position HTMLTokenizer::nth_last_position(size_t n)
@@ -276,6 +278,8 @@ _StartOfFunction:
     for (;;) {
         if (stop_at_insertion_point == StopAtInsertionPoint::Yes && is_insertion_point_reached())
             return {};
+        if (has_consumed_all_received_input())
+            return {};
 
         auto current_input_character = next_code_point(stop_at_insertion_point);
         switch (m_state) {
@@ -2822,7 +2826,7 @@ HTMLTokenizer::ConsumeNextResult HTMLTokenizer::consume_next_if_match(StringView
     for (size_t i = 0; i < string.length(); ++i) {
         auto code_point = peek_code_point(i, stop_at_insertion_point);
         if (!code_point.has_value()) {
-            if (StopAtInsertionPoint::Yes == stop_at_insertion_point) {
+            if (StopAtInsertionPoint::Yes == stop_at_insertion_point || m_more_input_expected) {
                 return ConsumeNextResult::RanOutOfCharacters;
             }
             return ConsumeNextResult::NotConsumed;
@@ -2852,7 +2856,6 @@ void HTMLTokenizer::create_new_token(HTMLToken::Type type)
 
 HTMLTokenizer::HTMLTokenizer()
 {
-    m_decoded_input = {};
     m_current_offset = 0;
     m_prev_offset = 0;
     m_source_positions.empend(0u, 0u);
@@ -2863,34 +2866,92 @@ HTMLTokenizer::HTMLTokenizer(StringView input, ByteString const& encoding)
     auto decoder = TextCodec::decoder_for(encoding);
     VERIFY(decoder.has_value());
     m_source = MUST(decoder->to_utf8(input));
-    m_decoded_input.ensure_capacity(m_source.bytes().size());
-    for (auto code_point : m_source.code_points())
-        m_decoded_input.append(code_point);
+    append_to_decoded_input(m_source.code_points());
     m_current_offset = 0;
     m_prev_offset = 0;
     m_source_positions.empend(0u, 0u);
 }
 
-void HTMLTokenizer::insert_input_at_insertion_point(StringView input)
+void HTMLTokenizer::append_to_decoded_input(Utf8View const& code_points)
+{
+    if (m_input_is_latin1) {
+        // ASCII input, which most input is, can be copied over as it is, since its UTF-8 bytes are its code points.
+        if (auto input = code_points.as_string(); input.is_ascii()) {
+            m_latin1_input.append(input.bytes().data(), input.length());
+            return;
+        }
+
+        m_latin1_input.grow_capacity(m_latin1_input.size() + code_points.byte_length());
+        for (auto it = code_points.begin(); it != code_points.end(); ++it) {
+            if (*it > 0xff) {
+                convert_decoded_input_to_utf32();
+                append_to_decoded_input(code_points.substring_view(code_points.byte_offset_of(it)));
+                return;
+            }
+            m_latin1_input.unchecked_append(static_cast<u8>(*it));
+        }
+        return;
+    }
+
+    m_decoded_input.grow_capacity(m_decoded_input.size() + code_points.byte_length());
+    for (auto code_point : code_points)
+        m_decoded_input.unchecked_append(code_point);
+}
+
+void HTMLTokenizer::convert_decoded_input_to_utf32()
 {
-    Vector<u32> new_decoded_input;
-    new_decoded_input.ensure_capacity(m_decoded_input.size() + input.length());
+    VERIFY(m_input_is_latin1);
+    m_decoded_input.ensure_capacity(m_latin1_input.size());
+    for (auto code_point : m_latin1_input)
+        m_decoded_input.unchecked_append(code_point);
+    m_latin1_input.clear();
+    m_input_is_latin1 = false;
+}
 
-    auto before = m_decoded_input.span().slice(0, m_insertion_point.position);
-    new_decoded_input.append(before.data(), before.size());
+String HTMLTokenizer::unparsed_input() const
+{
+    StringBuilder builder;
+    for (size_t i = static_cast<size_t>(m_current_offset); i < input_length(); ++i)
+        builder.append_code_point(input_code_point_at(i));
+    return builder.to_string_without_validation();
+}
 
+void HTMLTokenizer::insert_input_at_insertion_point(StringView input)
+{
     auto utf8_to_insert = MUST(String::from_utf8(input));
-    ssize_t code_points_inserted = 0;
-    for (auto code_point : utf8_to_insert.code_points()) {
-        new_decoded_input.append(code_point);
-        ++code_points_inserted;
+    auto code_points_to_insert = utf8_to_insert.code_points();
+
+    if (m_input_is_latin1) {
+        for (auto code_point : code_points_to_insert) {
+            if (code_point > 0xff) {
+                convert_decoded_input_to_utf32();
+                break;
+            }
+        }
     }
 
-    auto after = m_decoded_input.span().slice(m_insertion_point.position);
-    new_decoded_input.append(after.data(), after.size());
-    m_decoded_input = move(new_decoded_input);
+    auto old_length = input_length();
+    auto insert = [&](auto& decoded_input) {
+        auto old_input = move(decoded_input);
+        decoded_input.ensure_capacity(old_input.size() + utf8_to_insert.bytes().size());
+        auto before = old_input.span().slice(0, m_insertion_point.position);
+        decoded_input.append(before.data(), before.size());
+        append_to_decoded_input(code_points_to_insert);
+        auto after = old_input.span().slice(m_insertion_point.position);
+        decoded_input.append(after.data(), after.size());
+    };
+    if (m_input_is_latin1)
+        insert(m_latin1_input);
+    else
+        insert(m_decoded_input);
 
-    m_insertion_point.position += code_points_inserted;
+    m_insertion_point.position += static_cast<ssize_t>(input_length() - old_length);
+}
+
+void HTMLTokenizer::append_input(StringView input)
+{
+    // NOTE: Appending to the end never moves the insertion point, since it is always at or before the end of the input.
+    append_to_decoded_input(Utf8View { input });
 }
 
 void HTMLTokenizer::insert_eof()
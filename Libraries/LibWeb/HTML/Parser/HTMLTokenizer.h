@@ -134,6 +134,16 @@ public:
     void insert_eof();
     bool is_eof_inserted();
 
+    // Appends input from the network to the end of the input stream. While more input is expected, running out of
+    // input pauses the tokenizer instead of emitting an end-of-file token.
+    void append_input(StringView input);
+    void set_more_input_expected(bool more_input_expected) { m_more_input_expected = more_input_expected; }
+    bool is_waiting_for_more_input() const
+    {
+        return m_queued_tokens.is_empty() && has_consumed_all_received_input();
+    }
+    bool has_emitted_eof() const { return m_has_emitted_eof; }
+
     bool is_insertion_point_defined() const { return m_insertion_point.defined; }
     bool is_insertion_point_reached()
     {
@@ -148,11 +158,24 @@ public:
         m_insertion_point.position = m_current_offset;
     }
 
+    // The part of the input that has not been tokenized yet.
+    String unparsed_input() const;
+    size_t unparsed_input_length() const { return input_length() - static_cast<size_t>(m_current_offset); }
+
     // This permanently cuts off the tokenizer input stream.
     void abort() { m_aborted = true; }
 
 private:
     void skip(size_t count);
+
+    u32 input_code_point_at(size_t index) const { return m_input_is_latin1 ? m_latin1_input[index] : m_decoded_input[index]; }
+    size_t input_length() const { return m_input_is_latin1 ? m_latin1_input.size() : m_decoded_input.size(); }
+    bool has_consumed_all_received_input() const
+    {
+        return m_more_input_expected && m_current_offset >= static_cast<ssize_t>(input_length());
+    }
+    void append_to_decoded_input(Utf8View const&);
+    void convert_decoded_input_to_utf32();
     Optional<u32> next_code_point(StopAtInsertionPoint);
     Optional<u32> peek_code_point(ssize_t offset, StopAtInsertionPoint) const;
 
@@ -196,6 +219,10 @@ private:
     Vector<u32> m_temporary_buffer;
 
     String m_source;
+    // The decoded input. As long as every code point fits in a byte, which it does for most documents, we store one
+    // byte per code point in m_latin1_input instead of four in m_decoded_input.
+    bool m_input_is_latin1 { true };
+    Vector<u8> m_latin1_input;
     Vector<u32> m_decoded_input;
 
     struct InsertionPoint {
@@ -216,6 +243,7 @@ private:
     Optional<FlyString> m_last_emitted_start_tag_name;
 
     bool m_explicit_eof_inserted { false };
+    bool m_more_input_expected { false };
     bool m_has_emitted_eof { false };
 
     Queue<HTMLToken> m_queued_tokens;
@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/GenericLexer.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/Fetch/Infrastructure/URL.h>
+#include <LibWeb/HTML/AttributeNames.h>
+#include <LibWeb/HTML/MapOfPreloadedResources.h>
+#include <LibWeb/HTML/Parser/HTMLTokenizer.h>
+#include <LibWeb/HTML/Parser/PreloadScanner.h>
+#include <LibWeb/HTML/PotentialCORSRequest.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/TagNames.h>
+#include <LibWeb/Infra/CharacterTypes.h>
+#include <LibWeb/Loader/ResourceLoader.h>
+#include <LibWeb/MimeSniff/MimeType.h>
+
+namespace Web::HTML {
+
+PreloadScanner::PreloadScanner(DOM::Document& document)
+    : m_document(document)
+    , m_has_base_element(document.first_base_element_with_href_in_tree_order() != nullptr)
+{
+}
+
+void PreloadScanner::scan(StringView input)
+{
+    HTMLTokenizer tokenizer { input, "UTF-8"sv };
+
+    // NOTE: Without a tree builder, nothing switches the tokenizer out of the data state for elements whose contents
+    //       are not markup, so we do that ourselves.
+    Optional<StringBuilder> style_sheet_text;
+    while (auto token = tokenizer.next_token()) {
+        if (token->is_end_of_file())
+            break;
+
+        if (token->is_character()) {
+            if (style_sheet_text.has_value())
+                style_sheet_text->append_code_point(token->code_point());
+            continue;
+        }
+
+        if (token->is_end_tag()) {
+            auto const& tag_name = token->tag_name();
+            if (tag_name == TagNames::template_ && m_template_depth > 0)
+                --m_template_depth;
+            else if (tag_name == TagNames::picture && m_picture_depth > 0)
+                --m_picture_depth;
+            else if (tag_name == TagNames::style && style_sheet_text.has_value()) {
+                if (m_template_depth == 0)
+                    scan_style_sheet_for_imports(style_sheet_text->string_view());
+                style_sheet_text.clear();
+            }
+            continue;
+        }
+
+        if (!token->is_start_tag())
+            continue;
+
+        auto const& tag_name = token->tag_name();
+        if (tag_name.is_one_of(TagNames::title, TagNames::textarea)) {
+            tokenizer.switch_to(HTMLTokenizer::State::RCDATA);
+        } else if (tag_name.is_one_of(TagNames::style, TagNames::xmp, TagNames::iframe, TagNames::noembed, TagNames::noframes, TagNames::noscript)) {
+            // NOTE: We only run while the parser waits for a script, so scripting is enabled and noscript is RAWTEXT.
+            tokenizer.switch_to(HTMLTokenizer::State::RAWTEXT);
+            if (tag_name == TagNames::style)
+                style_sheet_text = StringBuilder {};
+        } else if (tag_name == TagNames::script) {
+            tokenizer.switch_to(HTMLTokenizer::State::ScriptData);
+        } else if (tag_name == TagNames::plaintext) {
+            // Nothing after this is markup.
+            break;
+        }
+
+        process_start_tag(*token);
+    }
+}
+
+void PreloadScanner::process_start_tag(HTMLToken const& token)
+{
+    auto const& tag_name = token.tag_name();
+
+    if (tag_name == TagNames::template_) {
+        ++m_template_depth;
+        return;
+    }
+
+    if (tag_name == TagNames::picture) {
+        ++m_picture_depth;
+        return;
+    }
+
+    // Template contents are inert, so nothing in them is fetched.
+    if (m_template_depth > 0)
+        return;
+
+    if (tag_name == TagNames::base) {
+        if (m_has_base_element)
+            return;
+        auto href = token.attribute(AttributeNames::href);
+        if (!href.has_value())
+            return;
+        m_has_base_element = true;
+        m_base_url = DOMURL::parse(*href, m_document->fallback_base_url(), m_document->encoding_or_default());
+        return;
+    }
+
+    auto cors_setting = cors_setting_attribute_from_keyword(token.attribute(AttributeNames::crossorigin));
+    auto integrity = token.attribute(AttributeNames::integrity).value_or({});
+    auto fetch_priority = token.attribute(AttributeNames::fetchpriority);
+
+    if (tag_name == TagNames::script) {
+        auto src = token.attribute(AttributeNames::src);
+        if (!src.has_value() || src->is_empty() || token.has_attribute(AttributeNames::nomodule))
+            return;
+
+        // We only fetch classic scripts, so the type has to be a JavaScript MIME type (or missing).
+        if (auto type = token.attribute(AttributeNames::type); type.has_value()) {
+            auto trimmed_type = MUST(type->trim(Infra::ASCII_WHITESPACE));
+            if (!trimmed_type.is_empty() && !MimeSniff::is_javascript_mime_type_essence_match(trimmed_type))
+                return;
+        } else if (auto language = token.attribute(AttributeNames::language); language.has_value() && !language->is_empty()) {
+            if (!MimeSniff::is_javascript_mime_type_essence_match(MUST(String::formatted("text/{}", *language))))
+                return;
+        }
+
+        if (auto url = parse_url(*src); url.has_value())
+            speculatively_fetch(*url, Fetch::Infrastructure::Request::Destination::Script, cors_setting, move(integrity), fetch_priority);
+        return;
+    }
+
+    if (tag_name == TagNames::link) {
+        auto rel = token.attribute(AttributeNames::rel);
+        auto href = token.attribute(AttributeNames::href);
+        if (!rel.has_value() || !href.has_value() || href->is_empty())
+            return;
+
+        bool is_stylesheet = false;
+        bool is_alternate = false;
+        bool is_dns_prefetch = false;
+        bool is_preconnect = false;
+        for (auto keyword : rel->bytes_as_string_view().split_view_if(Infra::is_ascii_whitespace)) {
+            if (keyword.equals_ignoring_ascii_case("stylesheet"sv))
+                is_stylesheet = true;
+            else if (keyword.equals_ignoring_ascii_case("alternate"sv))
+                is_alternate = true;
+            else if (keyword.equals_ignoring_ascii_case("dns-prefetch"sv))
+                is_dns_prefetch = true;
+            else if (keyword.equals_ignoring_ascii_case("preconnect"sv))
+                is_preconnect = true;
+        }
+
+        // NOTE: These only warm up RequestServer's caches, so it does no harm to do them again once the element is
+        //       inserted.
+        if (is_preconnect || is_dns_prefetch) {
+            if (auto url = parse_url(*href); url.has_value() && Fetch::Infrastructure::is_http_or_https_scheme(url->scheme())) {
+                if (is_preconnect)
+                    ResourceLoader::the().preconnect(*url);
+                else
+                    ResourceLoader::the().prefetch_dns(*url);
+            }
+        }
+
+        if (!is_stylesheet || is_alternate || token.has_attribute(AttributeNames::disabled))
+            return;
+
+        if (auto url = parse_url(*href); url.has_value())
+            speculatively_fetch(*url, Fetch::Infrastructure::Request::Destination::Style, cors_setting, move(integrity), fetch_priority);
+        return;
+    }
+
+    if (tag_name == TagNames::img) {
+        // Which image we need depends on srcset, sizes and sources, and lazy images may never be needed at all.
+        if (m_picture_depth > 0 || token.has_attribute(AttributeNames::srcset))
+            return;
+        if (auto loading = token.attribute(AttributeNames::loading); loading.has_value() && loading->equals_ignoring_ascii_case("lazy"sv))
+            return;
+
+        auto src = token.attribute(AttributeNames::src);
+        if (!src.has_value() || src->is_empty())
+            return;
+
+        if (auto url = parse_url(*src); url.has_value())
+            speculatively_fetch(*url, Fetch::Infrastructure::Request::Destination::Image, cors_setting, {}, fetch_priority);
+        return;
+    }
+}
+
+// Finds the @import rules at the start of an inline style sheet. They have to come before any other rule (except
+// @charset), so we can stop at the first thing that is neither.
+void PreloadScanner::scan_style_sheet_for_imports(StringView style_sheet)
+{
+    GenericLexer lexer { style_sheet };
+
+    auto skip_whitespace_and_comments = [&] {
+        while (!lexer.is_eof()) {
+            lexer.ignore_while(is_ascii_space);
+            if (!lexer.next_is("/*"sv))
+                break;
+            lexer.ignore(2);
+            lexer.ignore_until("*/");
+            lexer.ignore(2);
+        }
+    };
+
+    auto consume_keyword = [&](StringView keyword) {
+        if (!lexer.remaining().starts_with(keyword, CaseSensitivity::CaseInsensitive))
+            return false;
+        lexer.ignore(keyword.length());
+        return true;
+    };
+
+    auto consume_quoted_string = [&]() -> Optional<StringView> {
+        auto quote = lexer.peek();
+        if (quote != '"' && quote != '\'')
+            return {};
+        lexer.ignore();
+        auto value = lexer.consume_until(quote);
+        if (!lexer.consume_specific(quote))
+            return {};
+        return value;
+    };
+
+    while (true) {
+        skip_whitespace_and_comments();
+
+        if (consume_keyword("@charset"sv)) {
+            lexer.ignore_until(';');
+            lexer.ignore();
+            continue;
+        }
+
+        if (!consume_keyword("@import"sv))
+            return;
+
+        skip_whitespace_and_comments();
+
+        Optional<StringView> url_string;
+        if (consume_keyword("url("sv)) {
+            lexer.ignore_while(is_ascii_space);
+            url_string = consume_quoted_string();
+            if (!url_string.has_value())
+                url_string = lexer.consume_until([](char c) { return c == ')' || is_ascii_space(c); });
+        } else {
+            url_string = consume_quoted_string();
+        }
+
+        if (url_string.has_value() && !url_string->is_empty()) {
+            if (auto url = parse_url(*url_string); url.has_value())
+                speculatively_fetch(*url, Fetch::Infrastructure::Request::Destination::Style, CORSSettingAttribute::NoCORS, {}, {});
+        }
+
+        lexer.ignore_until(';');
+        if (lexer.is_eof())
+            return;
+        lexer.ignore();
+    }
+}
+
+Optional<URL::URL> PreloadScanner::parse_url(StringView url) const
+{
+    if (!m_base_url.has_value())
+        return m_document->encoding_parse_url(url);
+    return DOMURL::parse(url, *m_base_url, m_document->encoding_or_default());
+}
+
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-fetch
+// https://html.spec.whatwg.org/multipage/links.html#preload
+void PreloadScanner::speculatively_fetch(URL::URL const& url, Fetch::Infrastructure::Request::Destination destination, CORSSettingAttribute cors_setting, String integrity_metadata, Optional<String> const& fetch_priority)
+{
+    if (!Fetch::Infrastructure::is_http_or_https_scheme(url.scheme()))
+        return;
+
+    auto& realm = m_document->realm();
+    auto& vm = realm.vm();
+
+    // Let request be the result of creating a potential-CORS request given url, destination, and options's crossorigin.
+    auto request = create_potential_CORS_request(vm, url, destination, cors_setting);
+    request->set_client(&m_document->relevant_settings_object());
+    request->set_integrity_metadata(integrity_metadata);
+    if (fetch_priority.has_value())
+        request->set_priority(Fetch::Infrastructure::request_priority_from_string(*fetch_priority).value_or(Fetch::Infrastructure::Request::Priority::Auto));
+
+    // Let key be a preload key whose URL is url, destination is destination, mode is request's mode, and credentials
+    // mode is request's credentials mode.
+    auto key = MapOfPreloadedResources::Key::for_request(*request);
+
+    // NOTE: Another scan already found this resource, and its element has not consumed it yet.
+    auto& preloads = m_document->map_of_preloaded_resources();
+    if (preloads.contains(key))
+        return;
+
+    // Let entry be a new preload entry whose integrity metadata is options's integrity.
+    // Set preloads[key] to entry.
+    auto entry = preloads.create_entry(key, move(integrity_metadata));
+
+    // Fetch request, with processResponseConsumeBody set to the following steps given a response response and null,
+    // failure, or a byte sequence bytesOrNull:
+    Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
+    fetch_algorithms_input.process_response_consume_body = [&realm, entry](auto response, auto body_bytes) {
+        // 1. If bytesOrNull is a byte sequence, then set response's body to the first return value of safely
+        //    extracting bytesOrNull.
+        if (auto const* bytes = body_bytes.template get_pointer<ByteBuffer>())
+            response->set_body(Fetch::Infrastructure::byte_sequence_as_body(realm, *bytes));
+
+        // 2. If entry's on response available is null, then set entry's response to response; otherwise call entry's
+        //    on response available given response.
+        entry->set_response(response);
+    };
+
+    (void)Fetch::Fetching::fetch(realm, request, Fetch::Infrastructure::FetchAlgorithms::create(vm, move(fetch_algorithms_input)));
+}
+
+}
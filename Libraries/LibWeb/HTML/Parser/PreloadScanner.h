@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/StringView.h>
+#include <LibGC/Ptr.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/HTML/CORSSettingAttribute.h>
+
+namespace Web::HTML {
+
+// Looks ahead in the input that the HTML parser has not consumed yet, while it is blocked on a parser-blocking script,
+// and speculatively fetches the subresources it finds. Once the parser gets to the element that needs a resource, its
+// fetch consumes the speculative one from the document's map of preloaded resources.
+// https://html.spec.whatwg.org/multipage/parsing.html#speculative-html-parsing
+class PreloadScanner {
+public:
+    explicit PreloadScanner(DOM::Document&);
+
+    void scan(StringView input);
+
+private:
+    void process_start_tag(HTMLToken const&);
+    void scan_style_sheet_for_imports(StringView);
+
+    Optional<URL::URL> parse_url(StringView) const;
+
+    // https://html.spec.whatwg.org/multipage/parsing.html#speculative-fetch
+    void speculatively_fetch(URL::URL const&, Fetch::Infrastructure::Request::Destination, CORSSettingAttribute, String integrity_metadata, Optional<String> const& fetch_priority);
+
+    GC::Ref<DOM::Document> m_document;
+
+    // The base URL set by the first base element we see, if the document does not have one yet.
+    Optional<URL::URL> m_base_url;
+    bool m_has_base_element { false };
+
+    size_t m_template_depth { 0 };
+    size_t m_picture_depth { 0 };
+};
+
+}
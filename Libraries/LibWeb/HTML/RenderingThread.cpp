@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibCore/ElapsedTimer.h>
 #include <LibCore/EventLoop.h>
 #include <LibWeb/HTML/RenderingThread.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
@@ -64,20 +65,30 @@ void RenderingThread::rendering_thread_loop()
             break;
         }
 
+        auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
         auto painting_surface = painting_surface_for_backing_store(task->backing_store);
-        m_skia_player->execute(*task->display_list, task->scroll_state_snapshot, painting_surface);
+        // FIXME: Rasterize into a cache of fixed-size tiles covering the viewport plus a margin above and below it, so
+        //        that scrolling can reuse tiles instead of replaying the display list for the whole backing store.
+        //        Tiles could then be rasterized in parallel, but playback is not thread-safe yet: commands share
+        //        non-atomically ref-counted fonts, paths and bitmaps, and fonts lazily create their Skia objects.
+        m_damage_rect_of_current_task = task->damage_rect;
+        // Animations handed over to us are sampled now, so that frames show them where they are when rasterized,
+        // no matter how long ago the main thread recorded the frame.
+        task->compositor_layer_state_snapshot.sample_animations_at(MonotonicTime::now());
+        m_skia_player->execute(*task->display_list, task->scroll_state_snapshot, painting_surface, task->damage_rect, task->compositor_layer_state_snapshot);
+        auto rasterization_time = timer.elapsed_time();
         if (m_exit)
             break;
-        m_main_thread_event_loop.deferred_invoke([callback = move(task->callback)] {
-            callback();
+        m_main_thread_event_loop.deferred_invoke([callback = move(task->callback), rasterization_time] {
+            callback(rasterization_time);
         });
     }
 }
 
-void RenderingThread::enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshot&& scroll_state_snapshot, NonnullRefPtr<Painting::BackingStore> backing_store, Function<void()>&& callback)
+void RenderingThread::enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList> display_list, Painting::ScrollStateSnapshot&& scroll_state_snapshot, NonnullRefPtr<Painting::BackingStore> backing_store, Optional<Gfx::IntRect> damage_rect, Painting::CompositorLayerStateSnapshot&& compositor_layer_state_snapshot, Function<void(AK::Duration rasterization_time)>&& callback)
 {
     Threading::MutexLocker const locker { m_rendering_task_mutex };
-    m_rendering_tasks.enqueue(Task { move(display_list), move(scroll_state_snapshot), move(backing_store), move(callback) });
+    m_rendering_tasks.enqueue(Task { move(display_list), move(scroll_state_snapshot), move(backing_store), damage_rect, move(compositor_layer_state_snapshot), move(callback) });
     m_rendering_task_ready_wake_condition.signal();
 }
 
@@ -93,7 +104,14 @@ NonnullRefPtr<Gfx::PaintingSurface> RenderingThread::painting_surface_for_backin
 #ifdef USE_VULKAN
         // Vulkan: Try to create an accelerated surface.
         new_surface = Gfx::PaintingSurface::create_with_size(m_skia_backend_context, backing_store.size(), Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied);
-        new_surface->on_flush = [backing_store = static_cast<NonnullRefPtr<Painting::BackingStore>>(backing_store)](auto& surface) { surface.read_into_bitmap(backing_store->bitmap()); };
+        // NOTE: The pixels outside the damage rect are the same in the surface and the bitmap, so we only need to
+        //       read back the damaged part.
+        new_surface->on_flush = [this, backing_store = static_cast<NonnullRefPtr<Painting::BackingStore>>(backing_store)](auto& surface) {
+            if (m_damage_rect_of_current_task.has_value())
+                surface.read_into_bitmap(backing_store->bitmap(), *m_damage_rect_of_current_task);
+            else
+                surface.read_into_bitmap(backing_store->bitmap());
+        };
 #endif
 #ifdef AK_OS_MACOS
         // macOS: Wrap an IOSurface if available.
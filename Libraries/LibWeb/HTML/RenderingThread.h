@@ -29,7 +29,7 @@ public:
     void start(DisplayListPlayerType);
     void set_skia_player(OwnPtr<Painting::DisplayListPlayerSkia>&& player) { m_skia_player = move(player); }
     void set_skia_backend_context(RefPtr<Gfx::SkiaBackendContext> context) { m_skia_backend_context = move(context); }
-    void enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList>, Painting::ScrollStateSnapshot&&, NonnullRefPtr<Painting::BackingStore>, Function<void()>&& callback);
+    void enqueue_rendering_task(NonnullRefPtr<Painting::DisplayList>, Painting::ScrollStateSnapshot&&, NonnullRefPtr<Painting::BackingStore>, Optional<Gfx::IntRect> damage_rect, Painting::CompositorLayerStateSnapshot&&, Function<void(AK::Duration rasterization_time)>&& callback);
     void clear_bitmap_to_surface_cache();
 
 private:
@@ -50,7 +50,9 @@ private:
         NonnullRefPtr<Painting::DisplayList> display_list;
         Painting::ScrollStateSnapshot scroll_state_snapshot;
         NonnullRefPtr<Painting::BackingStore> backing_store;
-        Function<void()> callback;
+        Optional<Gfx::IntRect> damage_rect;
+        Painting::CompositorLayerStateSnapshot compositor_layer_state_snapshot;
+        Function<void(AK::Duration rasterization_time)> callback;
     };
     // NOTE: Queue will only contain multiple items in case tasks were scheduled by screenshot requests.
     //       Otherwise, it will contain only one item at a time.
@@ -60,6 +62,10 @@ private:
 
     HashMap<Gfx::Bitmap*, NonnullRefPtr<Gfx::PaintingSurface>> m_bitmap_to_surface;
     bool m_needs_to_clear_bitmap_to_surface_cache { false };
+
+    // Only touched on the rendering thread, so that surfaces flushed while executing a task can tell which part of
+    // their backing store it changed.
+    Optional<Gfx::IntRect> m_damage_rect_of_current_task;
 };
 
 }
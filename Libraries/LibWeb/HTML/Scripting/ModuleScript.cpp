@@ -49,6 +49,8 @@ WebIDL::ExceptionOr<GC::Ptr<JavaScriptModuleScript>> JavaScriptModuleScript::cre
     script->set_error_to_rethrow(JS::js_null());
 
     // 7. Let result be ParseModule(source, realm, script).
+    // FIXME: Parse modules on a background thread once the parser no longer relies on non-thread-safe FlyString
+    //        interning and AST reference counting.
     auto result = JS::SourceTextModule::parse(source, realm, filename.view(), script);
 
     // 8. If result is a list of errors, then:
@@ -11,6 +11,7 @@
 #include <AK/Variant.h>
 #include <LibIPC/File.h>
 #include <LibIPC/Forward.h>
+#include <LibWeb/FileAPI/BlobByteSequence.h>
 
 namespace Web::HTML {
 
@@ -28,7 +29,11 @@ public:
 
     ByteString const& name() const { return m_name; }
     auto const& file_or_contents() const { return m_file_or_contents; }
-    ByteBuffer take_contents();
+
+    ErrorOr<ByteBuffer> take_contents();
+
+    // Files are mapped into memory rather than read, so that selecting a large file does not read it in its entirety.
+    ErrorOr<FileAPI::BlobByteSequence> take_byte_sequence();
 
 private:
     ByteString m_name;
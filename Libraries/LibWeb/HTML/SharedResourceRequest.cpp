@@ -60,6 +60,7 @@ void SharedResourceRequest::visit_edges(JS::Cell::Visitor& visitor)
     for (auto& callback : m_callbacks) {
         visitor.visit(callback.on_finish);
         visitor.visit(callback.on_fail);
+        visitor.visit(callback.on_partial_image_data);
     }
     visitor.visit(m_image_data);
 }
@@ -79,6 +80,11 @@ void SharedResourceRequest::set_fetch_controller(GC::Ptr<Fetch::Infrastructure::
     m_fetch_controller = move(fetch_controller);
 }
 
+static bool is_svg_image(URL::URL const& url, StringView mime_type)
+{
+    return mime_type == "image/svg+xml"sv || url.basename().ends_with(".svg"sv);
+}
+
 void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infrastructure::Request> request)
 {
     Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
@@ -102,6 +108,45 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
             return;
         }
 
+        // AD-HOC: Bitmap images are handed to the decoder as their data arrives, so that what has been decoded so far
+        //         can be displayed before the whole image has been fetched.
+        auto extracted_mime_type = response->header_list()->extract_mime_type();
+        auto mime_type = extracted_mime_type.has_value() ? extracted_mime_type.value().essence() : String {};
+        if (!is_svg_image(request->url(), mime_type)) {
+            auto on_partial_image = [strong_this = GC::Root(*this)](NonnullRefPtr<Gfx::Bitmap> bitmap) {
+                strong_this->handle_partial_image(move(bitmap));
+            };
+            auto on_decoded = [strong_this = GC::Root(*this)](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
+                strong_this->handle_successful_bitmap_decode(result);
+                return {};
+            };
+            auto on_failed = [strong_this = GC::Root(*this)](Error&) {
+                strong_this->handle_failed_fetch();
+            };
+            m_incremental_image_decoder = Web::Platform::ImageCodecPlugin::the().start_incremental_decoding(move(on_partial_image), move(on_decoded), move(on_failed));
+        }
+
+        if (m_incremental_image_decoder) {
+            auto process_body_chunk = GC::create_function(heap(), [this](ByteBuffer chunk) {
+                if (!m_incremental_image_decoder)
+                    return;
+                m_incremental_image_decoder->append_data(chunk);
+                if (m_encoded_data.try_append(chunk).is_error())
+                    m_encoded_data.clear();
+            });
+            auto process_end_of_body = GC::create_function(heap(), [this] {
+                if (auto incremental_image_decoder = move(m_incremental_image_decoder))
+                    incremental_image_decoder->finish();
+            });
+            auto process_incremental_body_error = GC::create_function(heap(), [this](JS::Value) {
+                // NOTE: Dropping the decoder before it has been finished cancels the decoding.
+                m_incremental_image_decoder = nullptr;
+                handle_failed_fetch();
+            });
+            response->body()->incrementally_read(process_body_chunk, process_end_of_body, process_incremental_body_error, GC::Ref { realm.global_object() });
+            return;
+        }
+
         response->body()->fully_read(realm, process_body, process_body_error, GC::Ref { realm.global_object() });
     };
 
@@ -116,7 +161,7 @@ void SharedResourceRequest::fetch_resource(JS::Realm& realm, GC::Ref<Fetch::Infr
     set_fetch_controller(fetch_controller);
 }
 
-void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail)
+void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partial_image_data)
 {
     if (m_state == State::Finished) {
         if (on_finish)
@@ -135,6 +180,8 @@ void SharedResourceRequest::add_callbacks(Function<void()> on_finish, Function<v
         callbacks.on_finish = GC::create_function(vm().heap(), move(on_finish));
     if (on_fail)
         callbacks.on_fail = GC::create_function(vm().heap(), move(on_fail));
+    if (on_partial_image_data)
+        callbacks.on_partial_image_data = GC::create_function(vm().heap(), move(on_partial_image_data));
 
     m_callbacks.append(move(callbacks));
 }
@@ -144,9 +191,7 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
     // AD-HOC: At this point, things gets very ad-hoc.
     // FIXME: Bring this closer to spec.
 
-    bool const is_svg_image = mime_type == "image/svg+xml"sv || url_string.basename().ends_with(".svg"sv);
-
-    if (is_svg_image) {
+    if (is_svg_image(url_string, mime_type)) {
         auto result = SVG::SVGDecodedImageData::create(m_document->realm(), m_page, url_string, data);
         if (result.is_error()) {
             handle_failed_fetch();
@@ -157,16 +202,10 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
         return;
     }
 
+    m_encoded_data = move(data);
+
     auto handle_successful_bitmap_decode = [strong_this = GC::Root(*this)](Web::Platform::DecodedImage& result) -> ErrorOr<void> {
-        Vector<AnimatedBitmapDecodedImageData::Frame> frames;
-        for (auto& frame : result.frames) {
-            frames.append(AnimatedBitmapDecodedImageData::Frame {
-                .bitmap = Gfx::ImmutableBitmap::create(*frame.bitmap, Gfx::AlphaType::Premultiplied, result.color_space),
-                .duration = static_cast<int>(frame.duration),
-            });
-        }
-        strong_this->m_image_data = AnimatedBitmapDecodedImageData::create(strong_this->m_document->realm(), move(frames), result.loop_count, result.is_animated).release_value_but_fixme_should_propagate_errors();
-        strong_this->handle_successful_resource_load();
+        strong_this->handle_successful_bitmap_decode(result);
         return {};
     };
 
@@ -174,7 +213,50 @@ void SharedResourceRequest::handle_successful_fetch(URL::URL const& url_string,
         strong_this->handle_failed_fetch();
     };
 
-    (void)Web::Platform::ImageCodecPlugin::the().decode_image(data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode));
+    (void)Web::Platform::ImageCodecPlugin::the().decode_image(m_encoded_data.bytes(), move(handle_successful_bitmap_decode), move(handle_failed_decode));
+}
+
+void SharedResourceRequest::handle_successful_bitmap_decode(Web::Platform::DecodedImage& result)
+{
+    Vector<AnimatedBitmapDecodedImageData::Frame> frames;
+    for (auto& frame : result.frames) {
+        frames.append(AnimatedBitmapDecodedImageData::Frame {
+            .bitmap = Gfx::ImmutableBitmap::create(*frame.bitmap, Gfx::AlphaType::Premultiplied, result.color_space),
+            .duration = static_cast<int>(frame.duration),
+        });
+    }
+    if (result.frame_source) {
+        m_image_data = AnimatedBitmapDecodedImageData::create(m_document->realm(), move(frames), result.loop_count, result.frame_count, result.frame_source.release_nonnull(), move(result.color_space)).release_value_but_fixme_should_propagate_errors();
+    } else {
+        auto image_data = AnimatedBitmapDecodedImageData::create(m_document->realm(), move(frames), result.loop_count, result.is_animated).release_value_but_fixme_should_propagate_errors();
+
+        // Still images can be decoded again from their encoded data, so their bitmaps may be discarded while unused.
+        if (!result.is_animated && image_data->frame_count() == 1 && !m_encoded_data.is_empty())
+            image_data->make_discardable(m_document, move(m_encoded_data));
+
+        m_image_data = image_data;
+    }
+    m_encoded_data.clear();
+
+    handle_successful_resource_load();
+}
+
+void SharedResourceRequest::handle_partial_image(NonnullRefPtr<Gfx::Bitmap> bitmap)
+{
+    // NOTE: A partial image may still arrive after the fetch has failed, or after the complete image has been decoded.
+    if (m_state != State::Fetching)
+        return;
+
+    Vector<AnimatedBitmapDecodedImageData::Frame> frames;
+    frames.append(AnimatedBitmapDecodedImageData::Frame {
+        .bitmap = Gfx::ImmutableBitmap::create(move(bitmap)),
+    });
+    m_image_data = AnimatedBitmapDecodedImageData::create(m_document->realm(), move(frames), 0, false).release_value_but_fixme_should_propagate_errors();
+
+    for (auto& callback : m_callbacks) {
+        if (callback.on_partial_image_data)
+            callback.on_partial_image_data->function()();
+    }
 }
 
 void SharedResourceRequest::handle_failed_fetch()
@@ -6,10 +6,12 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <AK/Error.h>
 #include <AK/OwnPtr.h>
 #include <LibGC/Function.h>
 #include <LibGC/Root.h>
+#include <LibGfx/Forward.h>
 #include <LibGfx/Size.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Forward.h>
@@ -34,7 +36,8 @@ public:
 
     void fetch_resource(JS::Realm&, GC::Ref<Fetch::Infrastructure::Request>);
 
-    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail);
+    // on_partial_image_data is called whenever more of the image has been decoded while it is still being fetched.
+    void add_callbacks(Function<void()> on_finish, Function<void()> on_fail, Function<void()> on_partial_image_data = {});
 
     bool is_fetching() const;
     bool needs_fetching() const;
@@ -46,6 +49,8 @@ private:
     virtual void visit_edges(JS::Cell::Visitor&) override;
 
     void handle_successful_fetch(URL::URL const&, StringView mime_type, ByteBuffer data);
+    void handle_successful_bitmap_decode(Platform::DecodedImage&);
+    void handle_partial_image(NonnullRefPtr<Gfx::Bitmap>);
     void handle_failed_fetch();
     void handle_successful_resource_load();
 
@@ -63,12 +68,17 @@ private:
     struct Callbacks {
         GC::Ptr<GC::Function<void()>> on_finish;
         GC::Ptr<GC::Function<void()>> on_fail;
+        GC::Ptr<GC::Function<void()>> on_partial_image_data;
     };
     Vector<Callbacks> m_callbacks;
 
     URL::URL m_url;
     GC::Ptr<DecodedImageData> m_image_data;
     GC::Ptr<Fetch::Infrastructure::FetchController> m_fetch_controller;
+    RefPtr<Platform::IncrementalImageDecoder> m_incremental_image_decoder;
+
+    // The encoded data of the image, kept until it has been decoded.
+    ByteBuffer m_encoded_data;
 
     GC::Ptr<DOM::Document> m_document;
 };
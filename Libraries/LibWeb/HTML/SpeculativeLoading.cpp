@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AllOf.h>
+#include <AK/AnyOf.h>
+#include <AK/Array.h>
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOMURL/DOMURL.h>
+#include <LibWeb/Fetch/Fetching/Fetching.h>
+#include <LibWeb/Fetch/Infrastructure/FetchAlgorithms.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Fetch/Infrastructure/URL.h>
+#include <LibWeb/HTML/Navigable.h>
+#include <LibWeb/HTML/SpeculativeLoading.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#speculation-rule-eagerness
+static Optional<SpeculationRuleEagerness> speculation_rule_eagerness_from_string(StringView eagerness)
+{
+    if (eagerness == "immediate"sv)
+        return SpeculationRuleEagerness::Immediate;
+    if (eagerness == "eager"sv)
+        return SpeculationRuleEagerness::Eager;
+    if (eagerness == "moderate"sv)
+        return SpeculationRuleEagerness::Moderate;
+    if (eagerness == "conservative"sv)
+        return SpeculationRuleEagerness::Conservative;
+    return {};
+}
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#valid-speculation-rule-tag
+static bool is_valid_speculation_rule_tag(StringView tag)
+{
+    // A speculation rule tag is either an ASCII string whose code points are all in the range U+0020 to U+007E
+    // inclusive, or null.
+    return all_of(tag, [](char code_point) { return code_point >= 0x20 && code_point <= 0x7E; });
+}
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#parse-a-speculation-rule
+static WebIDL::ExceptionOr<Optional<SpeculationRule>> parse_a_speculation_rule(JsonValue const& input, DOM::Document const& document, URL::URL base_url)
+{
+    // 1. If input is not a map:
+    if (!input.is_object()) {
+        // 1. The user agent may report a warning to the console indicating that the rule needs to be a JSON object.
+        dbgln("Speculation rules: Ignoring a rule that is not a JSON object");
+
+        // 2. Return null.
+        return OptionalNone {};
+    }
+    auto const& rule = input.as_object();
+
+    // 2. If input has any key other than "source", "urls", "where", "relative_to", "eagerness", "referrer_policy",
+    //    "tag", "requires", "expects_no_vary_search", or "target_hint", then the user agent may report a warning to the
+    //    console indicating that the rule has unrecognized keys, and return null.
+    bool has_unrecognized_keys = false;
+    rule.for_each_member([&](String const& key, JsonValue const&) {
+        if (!key.is_one_of("source"sv, "urls"sv, "where"sv, "relative_to"sv, "eagerness"sv, "referrer_policy"sv, "tag"sv, "requires"sv, "expects_no_vary_search"sv, "target_hint"sv))
+            has_unrecognized_keys = true;
+    });
+    if (has_unrecognized_keys) {
+        dbgln("Speculation rules: Ignoring a rule with unrecognized keys");
+        return OptionalNone {};
+    }
+
+    // 3. If input["source"] exists, then let source be input["source"].
+    Optional<StringView> source;
+    if (auto value = rule.get("source"sv); value.has_value()) {
+        if (value->is_string())
+            source = value->as_string().bytes_as_string_view();
+    }
+    // 4. Otherwise, if input["urls"] exists and input["where"] does not exist, then let source be "list".
+    else if (rule.has("urls"sv) && !rule.has("where"sv)) {
+        source = "list"sv;
+    }
+    // 5. Otherwise, if input["where"] exists and input["urls"] does not exist, then let source be "document".
+    else if (rule.has("where"sv) && !rule.has("urls"sv)) {
+        source = "document"sv;
+    }
+
+    // 6. If source is neither "list" nor "document", then the user agent may report a warning to the console indicating
+    //    that a source could not be inferred or an invalid source was specified, and return null.
+    if (source != "list"sv && source != "document"sv) {
+        dbgln("Speculation rules: Ignoring a rule without a valid source");
+        return OptionalNone {};
+    }
+
+    // FIXME: Support document rules, which select the links in the document that match a predicate.
+    if (source == "document"sv) {
+        dbgln("FIXME: Speculation rules: Ignoring a document rule");
+        return OptionalNone {};
+    }
+
+    SpeculationRule result;
+
+    // 7. If source is "list":
+    // 1. If input["where"] exists, then the user agent may report a warning to the console indicating that there were
+    //    conflicting sources for this rule, and return null.
+    if (rule.has("where"sv)) {
+        dbgln("Speculation rules: Ignoring a list rule with conflicting sources");
+        return OptionalNone {};
+    }
+
+    // 2. If input["relative_to"] exists:
+    if (auto relative_to = rule.get("relative_to"sv); relative_to.has_value()) {
+        // 1. If input["relative_to"] is neither "ruleset" nor "document", then the user agent may report a warning to
+        //    the console indicating that the supplied relative-to value was invalid, and return null.
+        if (!relative_to->is_string() || !relative_to->as_string().is_one_of("ruleset"sv, "document"sv)) {
+            dbgln("Speculation rules: Ignoring a rule with an invalid relative_to value");
+            return OptionalNone {};
+        }
+
+        // 2. If input["relative_to"] is "document", then set baseURL to document's document base URL.
+        if (relative_to->as_string() == "document"sv)
+            base_url = document.base_url();
+    }
+
+    // 3. If input["urls"] does not exist or is not a list, then the user agent may report a warning to the console
+    //    indicating that the supplied URL list was invalid, and return null.
+    auto urls = rule.get_array("urls"sv);
+    if (!urls.has_value()) {
+        dbgln("Speculation rules: Ignoring a rule with an invalid URL list");
+        return OptionalNone {};
+    }
+
+    // 4. For each urlString of input["urls"]:
+    for (auto const& url_string : urls->values()) {
+        // 1. If urlString is not a string, then throw a TypeError indicating that the supplied URL must be a string.
+        if (!url_string.is_string())
+            return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The URLs of a speculation rule must be strings"sv };
+
+        // 2. Let parsedURL be the result of URL parsing urlString with baseURL.
+        auto parsed_url = DOMURL::parse(url_string.as_string(), base_url);
+
+        // 3. If parsedURL is failure, or parsedURL's scheme is not an HTTP(S) scheme, then the user agent may report a
+        //    warning to the console indicating that the supplied URL string was unparseable, and continue.
+        if (!parsed_url.has_value() || !Fetch::Infrastructure::is_http_or_https_scheme(parsed_url->scheme())) {
+            dbgln("Speculation rules: Ignoring the URL '{}'", url_string.as_string());
+            continue;
+        }
+
+        // 4. Append parsedURL to urls.
+        result.urls.append(parsed_url.release_value());
+    }
+
+    // 8. If input["eagerness"] exists:
+    if (auto eagerness = rule.get("eagerness"sv); eagerness.has_value()) {
+        // 1. If input["eagerness"] is not a speculation rule eagerness, then the user agent may report a warning to the
+        //    console indicating that the eagerness was invalid, and return null.
+        auto value = eagerness->is_string() ? speculation_rule_eagerness_from_string(eagerness->as_string()) : OptionalNone {};
+        if (!value.has_value()) {
+            dbgln("Speculation rules: Ignoring a rule with an invalid eagerness");
+            return OptionalNone {};
+        }
+
+        // 2. Set eagerness to input["eagerness"].
+        result.eagerness = *value;
+    }
+    // 9. Otherwise, if source is "list", then set eagerness to "immediate".
+    else {
+        result.eagerness = SpeculationRuleEagerness::Immediate;
+    }
+
+    // 10. If input["referrer_policy"] exists:
+    if (auto referrer_policy = rule.get("referrer_policy"sv); referrer_policy.has_value()) {
+        // 1. If input["referrer_policy"] is not a referrer policy, then the user agent may report a warning to the
+        //    console indicating that the provided referrer policy is not valid, and return null.
+        auto value = referrer_policy->is_string() ? ReferrerPolicy::from_string(referrer_policy->as_string()) : OptionalNone {};
+        if (!value.has_value()) {
+            dbgln("Speculation rules: Ignoring a rule with an invalid referrer policy");
+            return OptionalNone {};
+        }
+
+        // 2. Set referrerPolicy to input["referrer_policy"].
+        result.referrer_policy = *value;
+    }
+
+    // 11. If input["tag"] exists:
+    if (auto tag = rule.get("tag"sv); tag.has_value()) {
+        // 1. If input["tag"] is not a speculation rule tag, then the user agent may report a warning to the console
+        //    indicating that the tag is invalid, and return null.
+        if (!tag->is_string() || !is_valid_speculation_rule_tag(tag->as_string())) {
+            dbgln("Speculation rules: Ignoring a rule with an invalid tag");
+            return OptionalNone {};
+        }
+    }
+
+    // 12. If input["requires"] exists:
+    if (auto requires_ = rule.get("requires"sv); requires_.has_value()) {
+        // 1. If input["requires"] is not a list, then the user agent may report a warning to the console indicating that
+        //    the requirements were not understood, and return null.
+        if (!requires_->is_array()) {
+            dbgln("Speculation rules: Ignoring a rule with invalid requirements");
+            return OptionalNone {};
+        }
+
+        // 2. For each requirement of input["requires"]:
+        for (auto const& requirement : requires_->as_array().values()) {
+            // 1. If requirement is not a speculation rule requirement, then the user agent may report a warning to the
+            //    console indicating that the requirement was not understood, and return null.
+            if (!requirement.is_string() || requirement.as_string() != "anonymous-client-ip-when-cross-origin"sv) {
+                dbgln("Speculation rules: Ignoring a rule with an unknown requirement");
+                return OptionalNone {};
+            }
+
+            // NOTE: We only ever prefetch same-origin URLs, which this requirement doesn't apply to.
+        }
+    }
+
+    // FIXME: 13. Handle input["expects_no_vary_search"].
+
+    // 14. Return a speculation rule.
+    return result;
+}
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#parse-a-speculation-rule-set-string
+WebIDL::ExceptionOr<SpeculationRuleSet> parse_a_speculation_rule_set_string(StringView input, DOM::Document const& document, URL::URL const& base_url)
+{
+    // 1. Let parsed be the result of parsing a JSON string to an Infra value given input.
+    auto parsed = JsonValue::from_string(input);
+    if (parsed.is_error())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Speculation rules must be valid JSON"sv };
+
+    // 2. If parsed is not a map, then throw a TypeError indicating that the top-level value needs to be a JSON object.
+    if (!parsed.value().is_object())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The top-level value of speculation rules needs to be a JSON object"sv };
+    auto const& parsed_object = parsed.value().as_object();
+
+    // 3. Let result be a new speculation rule set.
+    SpeculationRuleSet result;
+
+    // 4. If parsed["tag"] exists:
+    if (auto tag = parsed_object.get("tag"sv); tag.has_value()) {
+        // 1. If parsed["tag"] is not a speculation rule tag, then throw a TypeError indicating that the speculation rule
+        //    tag is invalid.
+        if (!tag->is_string() || !is_valid_speculation_rule_tag(tag->as_string()))
+            return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The speculation rule tag is invalid"sv };
+    }
+
+    // 5. Let typesToTreatAsPrefetch be « "prefetch" ».
+    // 6. The user agent may append "prerender" to typesToTreatAsPrefetch.
+    // NOTE: We don't prerender, so prerender rules at least get their documents prefetched.
+    static constexpr Array types_to_treat_as_prefetch { "prefetch"sv, "prerender"sv };
+
+    // 7. For each type of typesToTreatAsPrefetch:
+    for (auto type : types_to_treat_as_prefetch) {
+        // 1. If parsed[type] exists:
+        auto rules = parsed_object.get(type);
+        if (!rules.has_value())
+            continue;
+
+        // 1. If parsed[type] is a list, then for each rule of parsed[type]:
+        if (rules->is_array()) {
+            for (auto const& rule_input : rules->as_array().values()) {
+                // 1. Let rule be the result of parsing a speculation rule given rule, tag, document, and baseURL.
+                auto rule = TRY(parse_a_speculation_rule(rule_input, document, base_url));
+
+                // 2. If rule is null, then continue.
+                if (!rule.has_value())
+                    continue;
+
+                // 3. Append rule to result's prefetch rules.
+                result.prefetch_rules.append(rule.release_value());
+            }
+        }
+        // 2. Otherwise, the user agent may report a warning to the console indicating that the rules list for type
+        //    needs to be a JSON array.
+        else {
+            dbgln("Speculation rules: The {} rules need to be a JSON array", type);
+        }
+    }
+
+    // 8. Return result.
+    return result;
+}
+
+// AD-HOC: This stands in for the spec's prefetch records, which a navigation would take its response from. Instead, we
+//         fetch the document ahead of time so that the navigation finds it in the HTTP cache, or at least finds a
+//         connection to its origin already open.
+static void prefetch(DOM::Document& document, URL::URL url, ReferrerPolicy::ReferrerPolicy referrer_policy)
+{
+    // NOTE: We can't yet keep a cross-origin prefetch from sending or storing cookies, so only same-origin documents
+    //       are prefetched.
+    if (!url.origin().is_same_origin(document.origin()))
+        return;
+
+    url.set_fragment({});
+    if (url.equals(document.url(), URL::ExcludeFragment::Yes))
+        return;
+    if (document.prefetched_urls().set(url) != AK::HashSetResult::InsertedNewEntry)
+        return;
+
+    auto& realm = document.realm();
+
+    auto request = Fetch::Infrastructure::Request::create(realm.vm());
+    request->set_url(move(url));
+    request->set_client(&document.relevant_settings_object());
+    request->set_destination(Fetch::Infrastructure::Request::Destination::Document);
+    request->set_initiator(Fetch::Infrastructure::Request::Initiator::Prefetch);
+    request->set_mode(Fetch::Infrastructure::Request::Mode::SameOrigin);
+    request->set_credentials_mode(Fetch::Infrastructure::Request::CredentialsMode::Include);
+    request->set_referrer_policy(referrer_policy);
+
+    // NOTE: The body has to be read for the response to make it into the HTTP cache, but there is nothing to do with it.
+    Fetch::Infrastructure::FetchAlgorithms::Input fetch_algorithms_input {};
+    fetch_algorithms_input.process_response_consume_body = [](auto, auto) {};
+
+    (void)Fetch::Fetching::fetch(realm, *request, Fetch::Infrastructure::FetchAlgorithms::create(realm.vm(), move(fetch_algorithms_input)));
+}
+
+static bool can_speculatively_load_for(DOM::Document const& document)
+{
+    // NOTE: Only documents that the user is looking at get to speculate about where they will go next.
+    auto navigable = document.navigable();
+    return navigable && navigable->is_top_level_traversable() && document.is_fully_active();
+}
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#consider-speculative-loads
+void consider_speculative_loads(DOM::Document& document)
+{
+    if (!can_speculatively_load_for(document))
+        return;
+
+    for (auto const& rule_set : document.speculation_rule_sets()) {
+        for (auto const& rule : rule_set.prefetch_rules) {
+            // NOTE: Less eager rules wait for the user to hover one of their links, see below.
+            if (rule.eagerness != SpeculationRuleEagerness::Immediate && rule.eagerness != SpeculationRuleEagerness::Eager)
+                continue;
+
+            for (auto const& url : rule.urls)
+                prefetch(document, url, rule.referrer_policy);
+        }
+    }
+}
+
+// NOTE: A "moderate" rule asks for its URLs to be loaded once the user hovers a link to one of them.
+// FIXME: "conservative" rules should load their URLs once the user presses down on a link to one of them.
+void consider_speculative_loads_for_hovered_link(DOM::Document& document, URL::URL const& url)
+{
+    if (!can_speculatively_load_for(document))
+        return;
+
+    for (auto const& rule_set : document.speculation_rule_sets()) {
+        for (auto const& rule : rule_set.prefetch_rules) {
+            if (rule.eagerness != SpeculationRuleEagerness::Moderate)
+                continue;
+
+            auto matches_url = any_of(rule.urls, [&](auto const& rule_url) { return rule_url.equals(url, URL::ExcludeFragment::Yes); });
+            if (matches_url) {
+                prefetch(document, url, rule.referrer_policy);
+                return;
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Vector.h>
+#include <LibURL/URL.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/ReferrerPolicy/ReferrerPolicy.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+
+namespace Web::HTML {
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#speculation-rule-eagerness
+enum class SpeculationRuleEagerness {
+    Immediate,
+    Eager,
+    Moderate,
+    Conservative,
+};
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#speculation-rule
+struct SpeculationRule {
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#sr-urls
+    Vector<URL::URL> urls;
+
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#sr-eagerness
+    SpeculationRuleEagerness eagerness { SpeculationRuleEagerness::Immediate };
+
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#sr-referrer-policy
+    ReferrerPolicy::ReferrerPolicy referrer_policy { ReferrerPolicy::ReferrerPolicy::EmptyString };
+};
+
+// https://html.spec.whatwg.org/multipage/speculative-loading.html#speculation-rule-set
+struct SpeculationRuleSet {
+    // https://html.spec.whatwg.org/multipage/speculative-loading.html#sr-set-prefetch
+    Vector<SpeculationRule> prefetch_rules;
+};
+
+WebIDL::ExceptionOr<SpeculationRuleSet> parse_a_speculation_rule_set_string(StringView input, DOM::Document const&, URL::URL const& base_url);
+
+void consider_speculative_loads(DOM::Document&);
+void consider_speculative_loads_for_hovered_link(DOM::Document&, URL::URL const&);
+
+}
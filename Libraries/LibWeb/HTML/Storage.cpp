@@ -46,8 +46,7 @@ Storage::Storage(JS::Realm& realm, Type type, NonnullRefPtr<StorageAPI::StorageB
         .named_property_deleter_has_identifier = true,
     };
 
-    for (auto const& item : map())
-        m_stored_bytes += item.key.byte_count() + item.value.byte_count();
+    compute_stored_bytes();
 
     all_storages().set(*this);
 }
@@ -65,6 +64,13 @@ void Storage::finalize()
     all_storages().remove(*this);
 }
 
+void Storage::compute_stored_bytes()
+{
+    m_stored_bytes = 0;
+    for (auto const& item : map())
+        m_stored_bytes += item.key.byte_count() + item.value.byte_count();
+}
+
 // https://html.spec.whatwg.org/multipage/webstorage.html#dom-storage-length
 size_t Storage::length() const
 {
@@ -171,6 +177,7 @@ void Storage::clear()
 {
     // 1. Clear this's map.
     map().clear();
+    m_stored_bytes = 0;
 
     // 2. Broadcast this with null, null, and null.
     broadcast({}, {}, {});
@@ -186,8 +193,6 @@ void Storage::reorder()
 // https://html.spec.whatwg.org/multipage/webstorage.html#concept-storage-broadcast
 void Storage::broadcast(Optional<String> const& key, Optional<String> const& old_value, Optional<String> const& new_value)
 {
-    auto& realm = this->realm();
-
     // 1. Let thisDocument be storage's relevant global object's associated Document.
     auto& relevant_global = relevant_global_object(*this);
     auto const& this_document = as<Window>(relevant_global).associated_document();
@@ -195,6 +200,11 @@ void Storage::broadcast(Optional<String> const& key, Optional<String> const& old
     // 2. Let url be the serialization of thisDocument's URL.
     auto url = this_document.url().serialize();
 
+    // AD-HOC: Persist the change. The browser process also passes it on to other WebContent processes, which broadcast it
+    //         to their own Storage objects.
+    if (type() == Type::Local)
+        StorageAPI::persist_local_storage_change(as<Window>(relevant_global), *m_storage_bottle, { key, old_value, new_value, url });
+
     // 3. Let remoteStorages be all Storage objects excluding storage whose:
     GC::RootVector<GC::Ref<Storage>> remote_storages(heap());
     for (auto storage : all_storages()) {
@@ -230,16 +240,49 @@ void Storage::broadcast(Optional<String> const& key, Optional<String> const& old
     //    global object to fire an event named storage at remoteStorage's relevant global object, using StorageEvent, with key initialized
     //    to key, oldValue initialized to oldValue, newValue initialized to newValue, url initialized to url, and storageArea initialized to
     //    remoteStorage.
-    for (auto remote_storage : remote_storages) {
-        queue_global_task(Task::Source::DOMManipulation, relevant_global, GC::create_function(heap(), [&realm, key, old_value, new_value, url, remote_storage] {
-            StorageEventInit init;
-            init.key = move(key);
-            init.old_value = move(old_value);
-            init.new_value = move(new_value);
-            init.url = move(url);
-            init.storage_area = remote_storage;
-            as<Window>(relevant_global_object(remote_storage)).dispatch_event(StorageEvent::create(realm, EventNames::storage, init));
-        }));
+    for (auto remote_storage : remote_storages)
+        remote_storage->queue_a_storage_event(key, old_value, new_value, url);
+}
+
+void Storage::queue_a_storage_event(Optional<String> key, Optional<String> old_value, Optional<String> new_value, String url)
+{
+    auto& relevant_global = relevant_global_object(*this);
+
+    queue_global_task(Task::Source::DOMManipulation, relevant_global, GC::create_function(heap(), [key = move(key), old_value = move(old_value), new_value = move(new_value), url = move(url), storage = GC::Ref { *this }] {
+        StorageEventInit init;
+        init.key = key;
+        init.old_value = old_value;
+        init.new_value = new_value;
+        init.url = url;
+        init.storage_area = storage;
+        as<Window>(relevant_global_object(storage)).dispatch_event(StorageEvent::create(storage->realm(), EventNames::storage, init));
+    }));
+}
+
+void Storage::apply_local_storage_changes_from_other_process(StringView storage_key, ReadonlySpan<StorageAPI::StorageChange> changes)
+{
+    // NOTE: If the map has not been loaded in this process yet, it will include these changes once it is.
+    auto bottle = StorageAPI::existing_local_storage_bottle_map(storage_key, "localStorage"sv);
+    if (!bottle)
+        return;
+
+    for (auto const& change : changes) {
+        if (!change.key.has_value())
+            bottle->map.clear();
+        else if (!change.new_value.has_value())
+            bottle->map.remove(*change.key);
+        else
+            bottle->map.set(*change.key, *change.new_value);
+    }
+
+    for (auto storage : all_storages()) {
+        if (storage->type() != Type::Local || storage->m_storage_bottle.ptr() != bottle.ptr())
+            continue;
+
+        storage->compute_stored_bytes();
+
+        for (auto const& change : changes)
+            storage->queue_a_storage_event(change.key, change.old_value, change.new_value, change.url);
     }
 }
 
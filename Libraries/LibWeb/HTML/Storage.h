@@ -43,6 +43,10 @@ public:
 
     void dump() const;
 
+    // AD-HOC: Applies changes that were made to the local storage of storage key in another WebContent process, and fires
+    //         storage events for them at the Storage objects of this process.
+    static void apply_local_storage_changes_from_other_process(StringView storage_key, ReadonlySpan<StorageAPI::StorageChange>);
+
 private:
     Storage(JS::Realm&, Type, NonnullRefPtr<StorageAPI::StorageBottle>);
 
@@ -57,8 +61,10 @@ private:
     virtual WebIDL::ExceptionOr<void> set_value_of_indexed_property(u32, JS::Value) override;
     virtual WebIDL::ExceptionOr<void> set_value_of_named_property(String const& key, JS::Value value) override;
 
+    void compute_stored_bytes();
     void reorder();
     void broadcast(Optional<String> const& key, Optional<String> const& old_value, Optional<String> const& new_value);
+    void queue_a_storage_event(Optional<String> key, Optional<String> old_value, Optional<String> new_value, String url);
 
     Type m_type {};
     NonnullRefPtr<StorageAPI::StorageBottle> m_storage_bottle;
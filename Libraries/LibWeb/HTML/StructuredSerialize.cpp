@@ -48,6 +48,7 @@
 #include <LibWeb/Geometry/DOMRectReadOnly.h>
 #include <LibWeb/HTML/ImageData.h>
 #include <LibWeb/HTML/MessagePort.h>
+#include <LibWeb/HTML/OffscreenCanvas.h>
 #include <LibWeb/HTML/StructuredSerialize.h>
 #include <LibWeb/WebIDL/DOMException.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -123,6 +124,9 @@ enum ValueTag {
 
     SerializableObject,
 
+    // An Array whose elements are all numbers, serialized as a whole rather than property by property.
+    PackedNumberArray,
+
     // TODO: Define many more types
 
     // This tag or higher are understood to be errors
@@ -147,6 +151,33 @@ static ErrorType error_name_to_type(String const& name)
     return Error;
 }
 
+// OPTIMIZATION: If an Array keeps its elements in simple storage without holes, has no other own properties, and nothing
+//               can intercept indexed property access, then serializing it property by property yields nothing but its
+//               elements. If those are all numbers, they can be serialized in one go.
+static Optional<ReadonlySpan<JS::Value>> packed_number_array_elements(JS::Array const& array)
+{
+    if (array.may_interfere_with_indexed_property_access() || array.shape().property_count() != 0)
+        return {};
+
+    auto const* storage = array.indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return {};
+
+    auto const& elements = static_cast<JS::SimpleIndexedPropertyStorage const&>(*storage).elements();
+    auto length = storage->array_like_size();
+    if (length > elements.size())
+        return {};
+
+    auto packed_elements = elements.span().trim(length);
+    for (auto element : packed_elements) {
+        // NOTE: Holes are special empty values, which are not numbers.
+        if (!element.is_number())
+            return {};
+    }
+
+    return packed_elements;
+}
+
 // Serializing and deserializing are each two passes:
 // 1. Fill up the memory with all the values, but without translating references
 // 2. Translate all the references into the appropriate form
@@ -156,19 +187,28 @@ public:
     Serializer(JS::VM& vm, SerializationMemory& memory, bool for_storage)
         : m_vm(vm)
         , m_memory(memory)
-        , m_next_id(memory.size())
         , m_for_storage(for_storage)
     {
     }
 
+    WebIDL::ExceptionOr<SerializationRecord> serialize(JS::Value value)
+    {
+        TRY(serialize_value(value));
+        return move(m_serialized);
+    }
+
+private:
     // https://html.spec.whatwg.org/multipage/structured-data.html#structuredserializeinternal
     // https://whatpr.org/html/9893/structured-data.html#structuredserializeinternal
-    WebIDL::ExceptionOr<SerializationRecord> serialize(JS::Value value)
+    // OPTIMIZATION: Rather than producing a record for every value and appending it to the record of its parent, every
+    //               value of the graph is serialized directly into the one record.
+    WebIDL::ExceptionOr<void> serialize_value(JS::Value value)
     {
         // 2. If memory[value] exists, then return memory[value].
-        if (m_memory.contains(value)) {
-            auto index = m_memory.get(value).value();
-            return Vector<u32> { ValueTag::ObjectReference, index };
+        if (auto index = m_memory.get(value); index.has_value()) {
+            serialize_enum(m_serialized, ValueTag::ObjectReference);
+            serialize_primitive_type(m_serialized, *index);
+            return {};
         }
 
         // 3. Let deep be false.
@@ -197,7 +237,7 @@ public:
         }
 
         if (return_primitive_type)
-            return m_serialized;
+            return {};
 
         // 5. If value is a Symbol, then throw a "DataCloneError" DOMException.
         if (value.is_symbol())
@@ -302,17 +342,26 @@ public:
 
         // 18. Otherwise, if value is an Array exotic object, then:
         else if (value.is_object() && is<JS::Array>(value.as_object())) {
-            // 1. Let valueLenDescriptor be ? OrdinaryGetOwnProperty(value, "length").
-            // 2. Let valueLen be valueLenDescriptor.[[Value]].
-            // NON-STANDARD: Array objects in LibJS do not have a real length property, so it must be accessed the usual way
-            u64 length = MUST(JS::length_of_array_like(m_vm, value.as_object()));
+            if (auto elements = packed_number_array_elements(static_cast<JS::Array const&>(value.as_object())); elements.has_value()) {
+                serialize_enum(m_serialized, ValueTag::PackedNumberArray);
+                serialize_primitive_type(m_serialized, static_cast<u64>(elements->size()));
+
+                m_serialized.ensure_capacity(m_serialized.size() + (elements->size() * sizeof(double) / sizeof(u32)));
+                for (auto element : *elements)
+                    serialize_primitive_type(m_serialized, element.as_double());
+            } else {
+                // 1. Let valueLenDescriptor be ? OrdinaryGetOwnProperty(value, "length").
+                // 2. Let valueLen be valueLenDescriptor.[[Value]].
+                // NON-STANDARD: Array objects in LibJS do not have a real length property, so it must be accessed the usual way
+                u64 length = MUST(JS::length_of_array_like(m_vm, value.as_object()));
 
-            // 3. Set serialized to { [[Type]]: "Array", [[Length]]: valueLen, [[Properties]]: a new empty List }.
-            serialize_enum(m_serialized, ValueTag::ArrayObject);
-            serialize_primitive_type(m_serialized, length);
+                // 3. Set serialized to { [[Type]]: "Array", [[Length]]: valueLen, [[Properties]]: a new empty List }.
+                serialize_enum(m_serialized, ValueTag::ArrayObject);
+                serialize_primitive_type(m_serialized, length);
 
-            // 4. Set deep to true.
-            deep = true;
+                // 4. Set deep to true.
+                deep = true;
+            }
         }
 
         // 19. Otherwise, if value is a platform object that is a serializable object:
@@ -354,7 +403,8 @@ public:
         }
 
         // 25. Set memory[value] to serialized.
-        m_memory.set(make_root(value), m_next_id++);
+        // NOTE: Values are numbered in the order they are added to memory, which is the order they are deserialized in.
+        m_memory.set(make_root(value), m_memory.size());
 
         // 26. If deep is true, then:
         if (deep) {
@@ -377,10 +427,8 @@ public:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedKey be ? StructuredSerializeInternal(entry.[[Key]], forStorage, memory).
                     // 2. Let serializedValue be ? StructuredSerializeInternal(entry.[[Value]], forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 3. Append { [[Key]]: serializedKey, [[Value]]: serializedValue } to serialized.[[MapData]].
-                    m_serialized.extend(serialized_value);
+                    TRY(serialize_value(copied_value));
                 }
             }
 
@@ -399,10 +447,8 @@ public:
                 // 3. For each entry of copiedList:
                 for (auto copied_value : copied_list) {
                     // 1. Let serializedEntry be ? StructuredSerializeInternal(entry, forStorage, memory).
-                    auto serialized_value = TRY(structured_serialize_internal(m_vm, copied_value, m_for_storage, m_memory));
-
                     // 2. Append serializedEntry to serialized.[[SetData]].
-                    m_serialized.extend(serialized_value);
+                    TRY(serialize_value(copied_value));
                 }
             }
 
@@ -426,11 +472,9 @@ public:
                         auto input_value = TRY(value.as_object().internal_get(property_key, value));
 
                         // 2. Let outputValue be ? StructuredSerializeInternal(inputValue, forStorage, memory).
-                        auto output_value = TRY(structured_serialize_internal(m_vm, input_value, m_for_storage, m_memory));
-
                         // 3. Append { [[Key]]: key, [[Value]]: outputValue } to serialized.[[Properties]].
                         TRY(serialize_string(m_vm, m_serialized, key.as_string()));
-                        m_serialized.extend(output_value);
+                        TRY(serialize_value(input_value));
 
                         property_count++;
                     }
@@ -440,13 +484,11 @@ public:
         }
 
         // 27. Return serialized.
-        return m_serialized;
+        return {};
     }
 
-private:
     JS::VM& m_vm;
     SerializationMemory& m_memory; // JS value -> index
-    u32 m_next_id { 0 };
     SerializationRecord m_serialized;
     bool m_for_storage { false };
 };
@@ -593,7 +635,11 @@ WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, Vector<u32>& vector
             // 4. Otherwise, set serialized to { [[Type]]: "SharedArrayBuffer", [[ArrayBufferData]]: value.[[ArrayBufferData]],
             //           [[ArrayBufferByteLength]]: value.[[ArrayBufferByteLength]],
             //           FIXME: [[AgentCluster]]: the surrounding agent's agent cluster }.
+            // NOTE: The Shared Data Block is identified by its token, so that an agent in the same process can refer to the very
+            //       same block. Its bytes are written too, for agents that cannot reach the block (i.e. out-of-process workers).
             serialize_enum(vector, ValueTag::SharedArrayBuffer);
+            auto shared_data_block = array_buffer.shared_data_block();
+            serialize_primitive_type(vector, shared_data_block ? shared_data_block->token() : JS::SharedDataBlock::Token { 0 });
             TRY(serialize_bytes(vm, vector, array_buffer.buffer().bytes()));
         }
     }
@@ -801,10 +847,17 @@ public:
             // 2. Otherwise, set value to a new SharedArrayBuffer object in targetRealm whose [[ArrayBufferData]] internal slot value is serialized.[[ArrayBufferData]]
             //    and whose [[ArrayBufferByteLength]] internal slot value is serialized.[[ArrayBufferByteLength]].
             auto* realm = m_vm.current_realm();
+            auto token = deserialize_primitive_type<JS::SharedDataBlock::Token>(m_serialized, m_position);
             auto bytes_or_error = deserialize_bytes(m_vm, m_serialized, m_position);
             if (bytes_or_error.is_error())
                 return WebIDL::DataCloneError::create(*realm, "out of memory"_string);
             auto bytes = bytes_or_error.release_value();
+
+            if (auto shared_data_block = JS::SharedDataBlock::find(token); shared_data_block && shared_data_block->buffer().size() == bytes.size()) {
+                value = JS::ArrayBuffer::create_shared(*realm, shared_data_block.release_nonnull());
+                break;
+            }
+
             JS::ArrayBuffer* buffer = TRY(JS::allocate_shared_array_buffer(m_vm, realm->intrinsics().shared_array_buffer_constructor(), bytes.size()));
             bytes.span().copy_to(buffer->buffer().span());
             value = buffer;
@@ -909,6 +962,18 @@ public:
             deep = true;
             break;
         }
+        case ValueTag::PackedNumberArray: {
+            auto& realm = *m_vm.current_realm();
+            auto length = deserialize_primitive_type<u64>(m_serialized, m_position);
+
+            Vector<JS::Value> elements;
+            elements.ensure_capacity(length);
+            for (u64 i = 0; i < length; ++i)
+                elements.unchecked_append(JS::Value(deserialize_primitive_type<double>(m_serialized, m_position)));
+
+            value = JS::Array::create_from(realm, elements);
+            break;
+        }
         // 20. Otherwise, if serialized.[[Type]] is "Object", then:
         case ValueTag::Object: {
             auto& realm = *m_vm.current_realm();
@@ -1242,7 +1307,6 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
                 // 3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
                 // 4. Set dataHolder.[[ArrayBufferMaxByteLength]] to transferable.[[ArrayBufferMaxByteLength]].
                 serialize_enum<TransferType>(data_holder.data, TransferType::ResizableArrayBuffer);
-                MUST(serialize_bytes(vm, data_holder.data, array_buffer->buffer().bytes())); // serializes both byte length and bytes
                 serialize_primitive_type<size_t>(data_holder.data, array_buffer->max_byte_length());
             }
 
@@ -1252,12 +1316,13 @@ WebIDL::ExceptionOr<SerializedTransferRecord> structured_serialize_with_transfer
                 // 2. Set dataHolder.[[ArrayBufferData]] to transferable.[[ArrayBufferData]].
                 // 3. Set dataHolder.[[ArrayBufferByteLength]] to transferable.[[ArrayBufferByteLength]].
                 serialize_enum<TransferType>(data_holder.data, TransferType::ArrayBuffer);
-                MUST(serialize_bytes(vm, data_holder.data, array_buffer->buffer().bytes())); // serializes both byte length and bytes
             }
 
             // 3. Perform ? DetachArrayBuffer(transferable).
             // NOTE: Specifications can use the [[ArrayBufferDetachKey]] internal slot to prevent ArrayBuffers from being detached. This is used in WebAssembly JavaScript Interface, for example. See: https://html.spec.whatwg.org/multipage/references.html#refsWASMJS
-            TRY(JS::detach_array_buffer(vm, *array_buffer));
+            // OPTIMIZATION: dataHolder.[[ArrayBufferData]] takes over transferable's data block as it is detached, rather
+            //               than holding a copy of it. Its size is the [[ArrayBufferByteLength]].
+            data_holder.array_buffer_data = TRY(JS::detach_array_buffer_and_take_data_block(vm, *array_buffer));
         }
 
         // 5. Otherwise:
@@ -1294,6 +1359,9 @@ static bool is_interface_exposed_on_target_realm(TransferType name, JS::Realm& r
     case TransferType::MessagePort:
         return intrinsics.is_exposed("MessagePort"sv);
         break;
+    case TransferType::OffscreenCanvas:
+        return intrinsics.is_exposed("OffscreenCanvas"sv);
+        break;
     case TransferType::Unknown:
         dbgln("Unknown interface type for transfer: {}", to_underlying(name));
         break;
@@ -1311,6 +1379,11 @@ static WebIDL::ExceptionOr<GC::Ref<Bindings::PlatformObject>> create_transferred
         TRY(message_port->transfer_receiving_steps(transfer_data_holder));
         return message_port;
     }
+    case TransferType::OffscreenCanvas: {
+        auto offscreen_canvas = HTML::OffscreenCanvas::create(target_realm, 0, 0);
+        TRY(offscreen_canvas->transfer_receiving_steps(transfer_data_holder));
+        return offscreen_canvas;
+    }
     case TransferType::ArrayBuffer:
     case TransferType::ResizableArrayBuffer:
         dbgln("ArrayBuffer ({}) is not a platform object.", to_underlying(name));
@@ -1351,10 +1424,7 @@ WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_tran
         //       [[ArrayBufferData]] is instead just getting transferred into the new ArrayBuffer. This could be true, for example,
         //       when both the source and target realms are in the same process.
         if (type == TransferType::ArrayBuffer) {
-            auto bytes = TRY(deserialize_bytes(vm, transfer_data_holder.data, data_holder_position));
-            JS::ArrayBuffer* data = TRY(JS::allocate_array_buffer(vm, target_realm.intrinsics().array_buffer_constructor(), bytes.size()));
-            bytes.span().copy_to(data->buffer().span());
-            value = JS::Value(data);
+            value = JS::ArrayBuffer::create(target_realm, move(transfer_data_holder.array_buffer_data));
         }
 
         // 3. Otherwise, if transferDataHolder.[[Type]] is "ResizableArrayBuffer", then set value to a new ArrayBuffer object
@@ -1363,12 +1433,10 @@ WebIDL::ExceptionOr<DeserializedTransferRecord> structured_deserialize_with_tran
         //     [[ArrayBufferMaxByteLength]] internal slot value is transferDataHolder.[[ArrayBufferMaxByteLength]].
         // NOTE: For the same reason as the previous step, this step is also unlikely to throw an exception.
         else if (type == TransferType::ResizableArrayBuffer) {
-            auto bytes = TRY(deserialize_bytes(vm, transfer_data_holder.data, data_holder_position));
             auto max_byte_length = deserialize_primitive_type<size_t>(transfer_data_holder.data, data_holder_position);
-            JS::ArrayBuffer* data = TRY(JS::allocate_array_buffer(vm, target_realm.intrinsics().array_buffer_constructor(), bytes.size()));
+            auto data = JS::ArrayBuffer::create(target_realm, move(transfer_data_holder.array_buffer_data));
             data->set_max_byte_length(max_byte_length);
-            bytes.span().copy_to(data->buffer().span());
-            value = JS::Value(data);
+            value = data;
         }
 
         // 4. Otherwise:
@@ -1460,6 +1528,7 @@ ErrorOr<void> encode(Encoder& encoder, ::Web::HTML::TransferDataHolder const& da
 {
     TRY(encoder.encode(data_holder.data));
     TRY(encoder.encode(data_holder.fds));
+    TRY(encoder.encode(data_holder.array_buffer_data));
     return {};
 }
 
@@ -1476,7 +1545,8 @@ ErrorOr<::Web::HTML::TransferDataHolder> decode(Decoder& decoder)
 {
     auto data = TRY(decoder.decode<Vector<u32>>());
     auto fds = TRY(decoder.decode<Vector<IPC::File>>());
-    return ::Web::HTML::TransferDataHolder { move(data), move(fds) };
+    auto array_buffer_data = TRY(decoder.decode<ByteBuffer>());
+    return ::Web::HTML::TransferDataHolder { move(data), move(fds), move(array_buffer_data) };
 }
 
 template<>
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AK/ByteBuffer.h>
 #include <AK/Result.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
@@ -27,6 +28,9 @@ namespace Web::HTML {
 struct TransferDataHolder {
     Vector<u32> data;
     Vector<IPC::File> fds;
+
+    // The [[ArrayBufferData]] of a transferred ArrayBuffer, which is handed over rather than copied into data.
+    ByteBuffer array_buffer_data;
 };
 
 struct SerializedTransferRecord {
@@ -49,6 +53,7 @@ enum class TransferType : u8 {
     MessagePort = 1,
     ArrayBuffer = 2,
     ResizableArrayBuffer = 3,
+    OffscreenCanvas = 4,
 };
 
 WebIDL::ExceptionOr<SerializationRecord> structured_serialize(JS::VM& vm, JS::Value);
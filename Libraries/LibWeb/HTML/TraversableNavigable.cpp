@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/QuickSort.h>
 #include <LibGfx/SkiaBackendContext.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -73,6 +74,7 @@ void TraversableNavigable::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_session_history_entries);
     visitor.visit(m_session_history_traversal_queue);
+    visitor.visit(m_documents_in_back_forward_cache);
 }
 
 static OrderedHashTable<TraversableNavigable*>& user_agent_top_level_traversable_set()
@@ -1117,6 +1119,46 @@ void TraversableNavigable::clear_the_forward_session_history()
     }
 }
 
+void TraversableNavigable::store_document_in_back_forward_cache(GC::Ref<DOM::Document> document)
+{
+    // Documents whose session history entries are gone (e.g. because the forward session history was cleared) can
+    // never be traversed back to.
+    auto is_referenced_by_an_entry = [&](DOM::Document const& cached_document) {
+        return any_of(m_session_history_entries, [&](auto const& entry) { return entry->document() == &cached_document; });
+    };
+    auto cached_documents = m_documents_in_back_forward_cache;
+    for (auto const& cached_document : cached_documents) {
+        if (!is_referenced_by_an_entry(cached_document))
+            evict_document_from_back_forward_cache(cached_document);
+    }
+
+    m_documents_in_back_forward_cache.append(document);
+
+    while (m_documents_in_back_forward_cache.size() > maximum_number_of_documents_in_back_forward_cache)
+        evict_document_from_back_forward_cache(m_documents_in_back_forward_cache.first());
+}
+
+void TraversableNavigable::did_restore_document_from_back_forward_cache(GC::Ref<DOM::Document> document)
+{
+    m_documents_in_back_forward_cache.remove_first_matching([&](auto const& cached_document) { return cached_document == document; });
+}
+
+void TraversableNavigable::evict_document_from_back_forward_cache(GC::Ref<DOM::Document> document)
+{
+    m_documents_in_back_forward_cache.remove_first_matching([&](auto const& cached_document) { return cached_document == document; });
+
+    // NOTE: A document that became active again without being reactivated has left the cache by itself.
+    if (document->is_active() || document->has_been_destroyed())
+        return;
+
+    document->destroy();
+
+    for (auto& entry : m_session_history_entries) {
+        if (entry->document() == document)
+            entry->document_state()->set_document(nullptr);
+    }
+}
+
 bool TraversableNavigable::can_go_forward() const
 {
     auto step = current_session_history_step();
@@ -1270,6 +1312,13 @@ void TraversableNavigable::destroy_top_level_traversable()
             document->destroy();
     }
 
+    // AD-HOC: Also destroy documents in the back/forward cache that no session history entry refers to anymore.
+    for (auto const& document : m_documents_in_back_forward_cache) {
+        if (!document->has_been_destroyed())
+            document->destroy();
+    }
+    m_documents_in_back_forward_cache.clear();
+
     // 3. Remove browsingContext.
     if (!browsing_context) {
         dbgln("TraversableNavigable::destroy_top_level_traversable: No browsing context?");
@@ -1401,6 +1450,16 @@ void TraversableNavigable::set_viewport_size(CSSPixelSize size)
 
     // Invalidate the surface cache if the traversable changed size.
     m_rendering_thread.clear_bitmap_to_surface_cache();
+
+    set_entire_viewport_damaged();
+}
+
+Optional<CSSPixelRect> TraversableNavigable::take_damage_rect()
+{
+    auto damage_rect = exchange(m_damage_rect, {});
+    if (exchange(m_entire_viewport_is_damaged, false))
+        return {};
+    return damage_rect;
 }
 
 RefPtr<Painting::DisplayList> TraversableNavigable::record_display_list(DevicePixelRect const& content_rect, PaintOptions paint_options)
@@ -1424,10 +1483,14 @@ RefPtr<Painting::DisplayList> TraversableNavigable::record_display_list(DevicePi
     return document->record_display_list(paint_config);
 }
 
-void TraversableNavigable::start_display_list_rendering(NonnullRefPtr<Painting::DisplayList> display_list, NonnullRefPtr<Painting::BackingStore> backing_store, Function<void()>&& callback)
+void TraversableNavigable::start_display_list_rendering(NonnullRefPtr<Painting::DisplayList> display_list, NonnullRefPtr<Painting::BackingStore> backing_store, Optional<Gfx::IntRect> damage_rect, Function<void()>&& callback)
 {
     auto scroll_state_snapshot = active_document()->paintable()->scroll_state().snapshot();
-    m_rendering_thread.enqueue_rendering_task(move(display_list), move(scroll_state_snapshot), move(backing_store), move(callback));
+    auto compositor_layer_state_snapshot = active_document()->compositor_layer_state_snapshot();
+    m_rendering_thread.enqueue_rendering_task(move(display_list), move(scroll_state_snapshot), move(backing_store), damage_rect, move(compositor_layer_state_snapshot), [traversable = GC::make_root(*this), callback = move(callback)](AK::Duration rasterization_time) {
+        traversable->m_frame_timings.rasterization_time.record(rasterization_time);
+        callback();
+    });
 }
 
 }
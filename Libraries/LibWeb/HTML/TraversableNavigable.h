@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/Vector.h>
+#include <LibWeb/HTML/FrameTimings.h>
 #include <LibWeb/HTML/Navigable.h>
 #include <LibWeb/HTML/NavigationType.h>
 #include <LibWeb/HTML/RenderingThread.h>
@@ -79,6 +80,13 @@ public:
 
     Vector<int> get_all_used_history_steps() const;
     void clear_the_forward_session_history();
+
+    // Unloaded documents kept alive in their session history entries, so that traversing back to them is instant.
+    // The least recently unloaded ones are destroyed once there are more than this.
+    static constexpr size_t maximum_number_of_documents_in_back_forward_cache = 4;
+
+    void store_document_in_back_forward_cache(GC::Ref<DOM::Document>);
+    void did_restore_document_from_back_forward_cache(GC::Ref<DOM::Document>);
     void traverse_the_history_by_delta(int delta, GC::Ptr<DOM::Document> source_document = {});
 
     void close_top_level_traversable();
@@ -101,7 +109,7 @@ public:
     [[nodiscard]] GC::Ptr<DOM::Node> currently_focused_area();
 
     RefPtr<Painting::DisplayList> record_display_list(DevicePixelRect const&, PaintOptions);
-    void start_display_list_rendering(NonnullRefPtr<Painting::DisplayList>, NonnullRefPtr<Painting::BackingStore>, Function<void()>&& callback);
+    void start_display_list_rendering(NonnullRefPtr<Painting::DisplayList>, NonnullRefPtr<Painting::BackingStore>, Optional<Gfx::IntRect> damage_rect, Function<void()>&& callback);
 
     enum class CheckIfUnloadingIsCanceledResult {
         CanceledByBeforeUnload,
@@ -120,6 +128,16 @@ public:
     bool needs_repaint() const { return m_needs_repaint; }
     void set_needs_repaint() { m_needs_repaint = true; }
 
+    // Damage tracking: the part of the viewport (in CSS pixels) whose pixels changed since the last frame was taken.
+    void add_damage_rect(CSSPixelRect const& viewport_rect) { m_damage_rect.unite(viewport_rect); }
+    void set_entire_viewport_damaged() { m_entire_viewport_is_damaged = true; }
+
+    // Returns the damage accumulated since the last call, or an empty Optional if the entire viewport has to be repainted.
+    Optional<CSSPixelRect> take_damage_rect();
+
+    FrameTimings& frame_timings() { return m_frame_timings; }
+    FrameTimings const& frame_timings() const { return m_frame_timings; }
+
 private:
     TraversableNavigable(GC::Ref<Page>);
 
@@ -151,6 +169,11 @@ private:
     // https://html.spec.whatwg.org/multipage/document-sequences.html#tn-session-history-entries
     Vector<GC::Ref<SessionHistoryEntry>> m_session_history_entries;
 
+    void evict_document_from_back_forward_cache(GC::Ref<DOM::Document>);
+
+    // Least recently unloaded first.
+    Vector<GC::Ref<DOM::Document>> m_documents_in_back_forward_cache;
+
     // FIXME: https://html.spec.whatwg.org/multipage/document-sequences.html#tn-session-history-traversal-queue
 
     // https://html.spec.whatwg.org/multipage/document-sequences.html#tn-running-nested-apply-history-step
@@ -173,6 +196,11 @@ private:
     RefPtr<Gfx::SkiaBackendContext> m_skia_backend_context;
 
     bool m_needs_repaint { true };
+
+    CSSPixelRect m_damage_rect;
+    bool m_entire_viewport_is_damaged { true };
+
+    FrameTimings m_frame_timings;
 };
 
 struct BrowsingContextAndDocument {
@@ -467,7 +467,7 @@ WebIDL::ExceptionOr<GC::Ref<Storage>> Window::local_storage()
         return WebIDL::SecurityError::create(realm, "localStorage is not available"_string);
 
     // 4. Let storage be a new Storage object whose map is map.
-    auto storage = Storage::create(realm, Storage::Type::Session, map.release_nonnull());
+    auto storage = Storage::create(realm, Storage::Type::Local, map.release_nonnull());
 
     // 5. Set this's associated Document's local storage holder to storage.
     associated_document.set_local_storage_holder(storage);
@@ -651,6 +651,11 @@ void Window::invoke_idle_callbacks()
 void Window::set_associated_document(DOM::Document& document)
 {
     m_associated_document = &document;
+
+    if (has_event_listeners()) {
+        for (auto& listener : event_listener_list())
+            document.did_add_event_listener(listener->type);
+    }
 }
 
 void Window::set_current_event(DOM::Event* event)
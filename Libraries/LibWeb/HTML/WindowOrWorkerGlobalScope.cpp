@@ -40,6 +40,7 @@
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Platform/ImageCodecPlugin.h>
 #include <LibWeb/ResourceTiming/PerformanceResourceTiming.h>
+#include <LibWeb/ServiceWorker/CacheStorage.h>
 #include <LibWeb/UserTiming/PerformanceMark.h>
 #include <LibWeb/UserTiming/PerformanceMeasure.h>
 #include <LibWeb/WebIDL/AbstractOperations.h>
@@ -77,6 +78,7 @@ void WindowOrWorkerGlobalScopeMixin::visit_edges(JS::Cell::Visitor& visitor)
         entry.value.visit_edges(visitor);
     visitor.visit(m_registered_event_sources);
     visitor.visit(m_crypto);
+    visitor.visit(m_caches);
     visitor.visit(m_resource_timing_secondary_buffer);
 }
 
@@ -1020,4 +1022,16 @@ GC::Ref<Crypto::Crypto> WindowOrWorkerGlobalScopeMixin::crypto()
     return GC::Ref { *m_crypto };
 }
 
+// https://w3c.github.io/ServiceWorker/#global-caches
+GC::Ref<ServiceWorker::CacheStorage> WindowOrWorkerGlobalScopeMixin::caches()
+{
+    auto& platform_object = this_impl();
+    auto& realm = platform_object.realm();
+
+    // The caches getter steps are to return this's associated CacheStorage object.
+    if (!m_caches)
+        m_caches = ServiceWorker::CacheStorage::create(realm);
+    return GC::Ref { *m_caches };
+}
+
 }
@@ -82,6 +82,8 @@ public:
     };
     AffectedAnyWebSockets make_disappear_all_web_sockets();
 
+    bool has_open_network_connections() const { return !m_registered_event_sources.is_empty() || !m_registered_web_sockets.is_empty(); }
+
     void run_steps_after_a_timeout(i32 timeout, Function<void()> completion_step);
 
     [[nodiscard]] GC::Ref<HighResolutionTime::Performance> performance();
@@ -100,6 +102,8 @@ public:
 
     [[nodiscard]] GC::Ref<Crypto::Crypto> crypto();
 
+    [[nodiscard]] GC::Ref<ServiceWorker::CacheStorage> caches();
+
 protected:
     void initialize(JS::Realm&);
     void visit_edges(JS::Cell::Visitor&);
@@ -146,6 +150,8 @@ private:
 
     GC::Ptr<Crypto::Crypto> m_crypto;
 
+    GC::Ptr<ServiceWorker::CacheStorage> m_caches;
+
     bool m_error_reporting_mode { false };
 
     WebSockets::WebSocket::List m_registered_web_sockets;
@@ -48,6 +48,46 @@ void IDBTransaction::visit_edges(Visitor& visitor)
     visitor.visit(m_associated_request);
     visitor.visit(m_scope);
     visitor.visit(m_cleanup_event_loop);
+
+    for (auto const& pending_request : m_pending_requests) {
+        visitor.visit(pending_request.request);
+        visitor.visit(pending_request.operation);
+    }
+
+    for (auto const& performed_request : m_performed_requests) {
+        visitor.visit(performed_request.request);
+        performed_request.result.visit([&](auto const& result) { visitor.visit(result); });
+    }
+}
+
+bool IDBTransaction::enqueue_pending_request(PendingRequest pending_request)
+{
+    m_pending_requests.append(move(pending_request));
+    return m_pending_requests.size() - m_next_pending_request_index == 1;
+}
+
+Optional<IDBTransaction::PendingRequest> IDBTransaction::take_next_pending_request()
+{
+    if (m_next_pending_request_index == m_pending_requests.size()) {
+        m_pending_requests.clear_with_capacity();
+        m_next_pending_request_index = 0;
+        return {};
+    }
+
+    // NOTE: Requests are taken from the front without shifting the rest, as batches of thousands of requests are common.
+    //       They stay in the list until the batch is done, so that they are kept alive in the meantime.
+    return m_pending_requests[m_next_pending_request_index++];
+}
+
+Optional<IDBTransaction::PerformedRequest> IDBTransaction::take_next_performed_request()
+{
+    if (m_next_performed_request_index == m_performed_requests.size()) {
+        m_performed_requests.clear_with_capacity();
+        m_next_performed_request_index = 0;
+        return {};
+    }
+
+    return m_performed_requests[m_next_performed_request_index++];
 }
 
 void IDBTransaction::set_onabort(WebIDL::CallbackType* event_handler)
@@ -33,6 +33,18 @@ class IDBTransaction : public DOM::EventTarget {
     };
 
 public:
+    // AD-HOC: Requests are not performed in a task of their own, but queued on their transaction and performed in
+    //         batches. See asynchronously_execute_a_request().
+    struct PendingRequest {
+        GC::Ref<IDBRequest> request;
+        GC::Ref<GC::Function<WebIDL::ExceptionOr<JS::Value>()>> operation;
+    };
+
+    struct PerformedRequest {
+        GC::Ref<IDBRequest> request;
+        Variant<JS::Value, GC::Ref<WebIDL::DOMException>> result;
+    };
+
     virtual ~IDBTransaction() override;
 
     [[nodiscard]] static GC::Ref<IDBTransaction> create(JS::Realm&, GC::Ref<IDBDatabase>, Bindings::IDBTransactionMode, Bindings::IDBTransactionDurability, Vector<GC::Ref<ObjectStore>>);
@@ -60,6 +72,13 @@ public:
     [[nodiscard]] bool is_readwrite() const { return m_mode == Bindings::IDBTransactionMode::Readwrite; }
     [[nodiscard]] bool is_finished() const { return m_state == TransactionState::Finished; }
 
+    // Returns whether a batch has to be scheduled to perform the request.
+    [[nodiscard]] bool enqueue_pending_request(PendingRequest);
+    Optional<PendingRequest> take_next_pending_request();
+
+    void did_perform_request(PerformedRequest performed_request) { m_performed_requests.append(move(performed_request)); }
+    Optional<PerformedRequest> take_next_performed_request();
+
     GC::Ptr<ObjectStore> object_store_named(String const& name) const;
     void add_to_scope(GC::Ref<ObjectStore> object_store) { m_scope.append(object_store); }
 
@@ -110,6 +129,12 @@ private:
     // A transaction optionally has a cleanup event loop which is an event loop.
     GC::Ptr<HTML::EventLoop> m_cleanup_event_loop;
 
+    // AD-HOC: Requests that are waiting to be performed, and requests whose results have yet to be delivered.
+    Vector<PendingRequest> m_pending_requests;
+    size_t m_next_pending_request_index { 0 };
+    Vector<PerformedRequest> m_performed_requests;
+    size_t m_next_performed_request_index { 0 };
+
     // NOTE: Used for debug purposes
     String m_uuid;
 };
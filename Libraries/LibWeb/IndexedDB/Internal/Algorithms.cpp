@@ -32,6 +32,8 @@
 #include <LibWeb/IndexedDB/Internal/Database.h>
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/Key.h>
+#include <LibWeb/IndexedDB/Internal/PersistentStorage.h>
+#include <LibWeb/IndexedDB/Internal/SortedRecords.h>
 #include <LibWeb/Infra/Strings.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/StorageAPI/StorageKey.h>
@@ -69,6 +71,10 @@ WebIDL::ExceptionOr<GC::Ref<IDBDatabase>> open_a_database_connection(JS::Realm&
         return queue.all_previous_requests_processed(request);
     }));
 
+    // AD-HOC: Databases are only read back from persistent storage once they are first used in this process.
+    if (!Database::for_key_and_name(storage_key, name).has_value())
+        (void)load_persisted_database(realm, storage_key, name);
+
     // 4. Let db be the database named name in storageKey, or null otherwise.
     GC::Ptr<Database> db;
     auto maybe_db = Database::for_key_and_name(storage_key, name);
@@ -457,6 +463,10 @@ WebIDL::ExceptionOr<u64> delete_a_database(JS::Realm& realm, StorageAPI::Storage
         return queue.all_previous_requests_processed(request);
     }));
 
+    // AD-HOC: Databases are only read back from persistent storage once they are first used in this process.
+    if (!Database::for_key_and_name(storage_key, name).has_value())
+        (void)load_persisted_database(realm, storage_key, name);
+
     // 4. Let db be the database named name in storageKey, if one exists. Otherwise, return 0 (zero).
     auto maybe_db = Database::for_key_and_name(storage_key, name);
     if (!maybe_db.has_value())
@@ -528,6 +538,8 @@ WebIDL::ExceptionOr<u64> delete_a_database(JS::Realm& realm, StorageAPI::Storage
     if (maybe_deleted.is_error())
         return WebIDL::OperationError::create(realm, "Unable to delete database"_string);
 
+    delete_persisted_database(realm, storage_key, name);
+
     // 12. Return version.
     return version;
 }
@@ -768,8 +780,17 @@ void commit_a_transaction(JS::Realm& realm, GC::Ref<IDBTransaction> transaction)
         if (transaction->state() != IDBTransaction::TransactionState::Committing)
             return;
 
-        // FIXME: 3. Attempt to write any outstanding changes made by transaction to the database, considering transaction’s durability hint.
-        // FIXME: 4. If an error occurs while writing the changes to the database, then run abort a transaction with transaction and an appropriate type for the error, for example "QuotaExceededError" or "UnknownError" DOMException, and terminate these steps.
+        // 3. Attempt to write any outstanding changes made by transaction to the database, considering transaction’s durability hint.
+        auto result = persist_changes_made_by_transaction(realm, transaction);
+
+        // 4. If an error occurs while writing the changes to the database, then run abort a transaction with transaction and an appropriate type for the error, for example "QuotaExceededError" or "UnknownError" DOMException, and terminate these steps.
+        if (result.is_error()) {
+            if (result.error().is_errno() && result.error().code() == ENOSPC)
+                abort_a_transaction(transaction, WebIDL::QuotaExceededError::create(realm, "Writing the changes to the database would exceed the storage quota"_string));
+            else
+                abort_a_transaction(transaction, WebIDL::UnknownError::create(realm, "Unable to write the changes to the database"_string));
+            return;
+        }
 
         // 5. Queue a task to run these steps:
         HTML::queue_a_task(HTML::Task::Source::DatabaseAccess, nullptr, nullptr, GC::create_function(transaction->realm().vm().heap(), [transaction]() {
@@ -1121,6 +1142,82 @@ void fire_a_success_event(JS::Realm& realm, GC::Ref<IDBRequest> request)
     }
 }
 
+static void perform_pending_requests(JS::Realm& realm, GC::Ref<IDBTransaction> transaction)
+{
+    HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+    while (auto pending_request = transaction->take_next_pending_request(); pending_request.has_value()) {
+        auto request = pending_request->request;
+
+        // 1. Wait until request is the first item in transaction’s request list that is not processed.
+        // NOTE: Pending requests are performed in the order they were made, so this only has to wait in rare cases.
+        if (!transaction->request_list().all_previous_requests_processed(request)) {
+            HTML::main_thread_event_loop().spin_until(GC::create_function(realm.vm().heap(), [transaction, request]() {
+                return transaction->request_list().all_previous_requests_processed(request);
+            }));
+        }
+
+        // 2. Let result be the result of performing operation.
+        auto result = pending_request->operation->function()();
+
+        // 3. If result is an error and transaction’s state is committing, then run abort a transaction with transaction and result, and terminate these steps.
+        if (result.is_error() && transaction->state() == IDBTransaction::TransactionState::Committing) {
+            abort_a_transaction(*transaction, result.exception().get<GC::Ref<WebIDL::DOMException>>());
+
+            // NOTE: Aborting the transaction has taken care of the requests that are still pending.
+            while (transaction->take_next_pending_request().has_value()) { }
+            return;
+        }
+
+        // FIXME: 4. If result is an error, then revert all changes made by operation.
+
+        // 5. Set request’s processed flag to true.
+        request->set_processed(true);
+
+        if (result.is_error())
+            transaction->did_perform_request({ request, result.exception().get<GC::Ref<WebIDL::DOMException>>() });
+        else
+            transaction->did_perform_request({ request, result.release_value() });
+    }
+
+    // 6. Queue a task to run these steps:
+    // AD-HOC: The results of the whole batch are delivered from a single task, in the order the requests were made.
+    HTML::queue_a_task(HTML::Task::Source::DatabaseAccess, nullptr, nullptr, GC::create_function(realm.vm().heap(), [&realm, transaction]() {
+        while (auto performed_request = transaction->take_next_performed_request(); performed_request.has_value()) {
+            auto [request, result] = performed_request.release_value();
+
+            // 1. Remove request from transaction’s request list.
+            transaction->request_list().remove_first_matching([&request](auto& entry) { return entry.ptr() == request.ptr(); });
+
+            // 2. Set request’s done flag to true.
+            request->set_done(true);
+
+            result.visit(
+                // 3. If result is an error, then:
+                [&](GC::Ref<WebIDL::DOMException> error) {
+                    // 1. Set request’s result to undefined.
+                    request->set_result(JS::js_undefined());
+
+                    // 2. Set request’s error to result.
+                    request->set_error(error);
+
+                    // 3. Fire an error event at request.
+                    fire_an_error_event(realm, request);
+                },
+                [&](JS::Value value) {
+                    // 1. Set request’s result to result.
+                    request->set_result(value);
+
+                    // 2. Set request’s error to undefined.
+                    request->set_error(nullptr);
+
+                    // 3. Fire a success event at request.
+                    fire_a_success_event(realm, request);
+                });
+        }
+    }));
+}
+
 // https://w3c.github.io/IndexedDB/#asynchronously-execute-a-request
 GC::Ref<IDBRequest> asynchronously_execute_a_request(JS::Realm& realm, IDBRequestSource source, GC::Ref<GC::Function<WebIDL::ExceptionOr<JS::Value>()>> operation, GC::Ptr<IDBRequest> request_input)
 {
@@ -1153,66 +1250,13 @@ GC::Ref<IDBRequest> asynchronously_execute_a_request(JS::Realm& realm, IDBReques
     request->set_transaction(transaction);
 
     // 5. Run these steps in parallel:
-    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, transaction, operation, request]() {
-        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
-
-        // 1. Wait until request is the first item in transaction’s request list that is not processed.
-        HTML::main_thread_event_loop().spin_until(GC::create_function(realm.vm().heap(), [transaction, request]() {
-            if constexpr (IDB_DEBUG) {
-                dbgln("asynchronously_execute_a_request: waiting for step 5.1");
-                dbgln("requests in queue:");
-                for (auto const& item : transaction->request_list()) {
-                    dbgln("[{}] - {} = {}", item == request ? "x"sv : " "sv, item->uuid(), item->processed() ? "processed"sv : "not processed"sv);
-                }
-            }
-
-            return transaction->request_list().all_previous_requests_processed(request);
-        }));
-
-        // 2. Let result be the result of performing operation.
-        auto result = operation->function()();
-
-        // 3. If result is an error and transaction’s state is committing, then run abort a transaction with transaction and result, and terminate these steps.
-        if (result.is_error() && transaction->state() == IDBTransaction::TransactionState::Committing) {
-            abort_a_transaction(*transaction, result.exception().get<GC::Ref<WebIDL::DOMException>>());
-            return;
-        }
-
-        // FIXME: 4. If result is an error, then revert all changes made by operation.
-
-        // 5. Set request’s processed flag to true.
-        request->set_processed(true);
-
-        // 6. Queue a task to run these steps:
-        HTML::queue_a_task(HTML::Task::Source::DatabaseAccess, nullptr, nullptr, GC::create_function(realm.vm().heap(), [&realm, request, result, transaction]() mutable {
-            // 1. Remove request from transaction’s request list.
-            transaction->request_list().remove_first_matching([&request](auto& entry) { return entry.ptr() == request.ptr(); });
-
-            // 2. Set request’s done flag to true.
-            request->set_done(true);
-
-            // 3. If result is an error, then:
-            if (result.is_error()) {
-                // 1. Set request’s result to undefined.
-                request->set_result(JS::js_undefined());
-
-                // 2. Set request’s error to result.
-                request->set_error(result.exception().get<GC::Ref<WebIDL::DOMException>>());
-
-                // 3. Fire an error event at request.
-                fire_an_error_event(realm, request);
-            } else {
-                // 1. Set request’s result to result.
-                request->set_result(result.release_value());
-
-                // 2. Set request’s error to undefined.
-                request->set_error(nullptr);
-
-                // 3. Fire a success event at request.
-                fire_a_success_event(realm, request);
-            }
+    // AD-HOC: Rather than performing every request in a task of its own that first has to wait for all of the requests
+    //         before it, requests are queued on their transaction and performed in order in a single batch.
+    if (transaction->enqueue_pending_request({ request, operation })) {
+        Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(realm.heap(), [&realm, transaction]() {
+            perform_pending_requests(realm, *transaction);
         }));
-    }));
+    }
 
     // 6. Return request.
     return request;
@@ -1705,6 +1749,28 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         return is_in_range;
     };
 
+    // AD-HOC: Records are sorted by key, so rather than checking the requirements below against every record in source,
+    //         only look at the records with a key in range that are not before (or after, when iterating backwards) key
+    //         and position.
+    auto candidate_records = [&]() {
+        auto is_forward = direction == Bindings::IDBCursorDirection::Next || direction == Bindings::IDBCursorDirection::Nextunique;
+
+        return records.visit([&](auto content) -> Variant<ReadonlySpan<Record>, ReadonlySpan<IndexRecord>> {
+            content = records_in_range(content, *range);
+
+            for (auto bound : { key, position }) {
+                if (!bound)
+                    continue;
+                if (is_forward)
+                    content = content.slice(lower_bound_for_key(content, *bound));
+                else
+                    content = content.trim(upper_bound_for_key(content, *bound));
+            }
+
+            return content;
+        });
+    };
+
     // 9. While count is greater than 0:
     Variant<Empty, Record, IndexRecord> found_record;
     while (count > 0) {
@@ -1712,7 +1778,7 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         switch (direction) {
         case Bindings::IDBCursorDirection::Next: {
             // Let found record be the first record in records which satisfy all of the following requirements:
-            found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
+            found_record = candidate_records().visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
                 auto value = content.first_matching(next_requirements);
                 if (value.has_value())
                     return *value;
@@ -1723,7 +1789,7 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         }
         case Bindings::IDBCursorDirection::Nextunique: {
             // Let found record be the first record in records which satisfy all of the following requirements:
-            found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
+            found_record = candidate_records().visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
                 auto value = content.first_matching(next_unique_requirements);
                 if (value.has_value())
                     return *value;
@@ -1734,7 +1800,7 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
         }
         case Bindings::IDBCursorDirection::Prev: {
             // Let found record be the last record in records which satisfy all of the following requirements:
-            found_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
+            found_record = candidate_records().visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
                 auto value = content.last_matching(prev_requirements);
                 if (value.has_value())
                     return *value;
@@ -1746,7 +1812,7 @@ GC::Ptr<IDBCursor> iterate_a_cursor(JS::Realm& realm, GC::Ref<IDBCursor> cursor,
 
         case Bindings::IDBCursorDirection::Prevunique: {
             // Let temp record be the last record in records which satisfy all of the following requirements:
-            auto temp_record = records.visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
+            auto temp_record = candidate_records().visit([&](auto content) -> Variant<Empty, Record, IndexRecord> {
                 auto value = content.last_matching(prev_unique_requirements);
                 if (value.has_value())
                     return *value;
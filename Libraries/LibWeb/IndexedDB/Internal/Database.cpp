@@ -76,6 +76,7 @@ ErrorOr<GC::Root<Database>> Database::create_for_key_and_name(JS::Realm& realm,
     }));
 
     auto value = Database::create(realm, name);
+    value->m_storage_key = key;
 
     database_mapping.set(name, value);
     m_databases.set(key, database_mapping);
@@ -25,6 +25,9 @@ public:
     u64 version() const { return m_version; }
     String name() const { return m_name; }
 
+    // AD-HOC: The storage key this database was created for, so that its changes can be persisted.
+    Optional<StorageAPI::StorageKey> const& storage_key() const { return m_storage_key; }
+
     void set_upgrade_transaction(GC::Ptr<IDBTransaction> transaction) { m_upgrade_transaction = transaction; }
     [[nodiscard]] GC::Ptr<IDBTransaction> upgrade_transaction() { return m_upgrade_transaction; }
 
@@ -72,6 +75,7 @@ private:
 
     // A database has a name which identifies it within a specific storage key.
     String m_name;
+    Optional<StorageAPI::StorageKey> m_storage_key;
 
     // A database has a version. When a database is first created, its version is 0 (zero).
     u64 m_version { 0 };
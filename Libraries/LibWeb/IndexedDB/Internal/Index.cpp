@@ -6,6 +6,7 @@
 
 #include <LibWeb/IndexedDB/Internal/Index.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+#include <LibWeb/IndexedDB/Internal/SortedRecords.h>
 
 namespace Web::IndexedDB {
 
@@ -50,11 +51,19 @@ void Index::set_name(String name)
 
 bool Index::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(record.key, key);
-    });
+    auto index = lower_bound_for_key(records(), key);
+    return index < m_records.size() && Key::equals(m_records[index].key, key);
+}
+
+void Index::store_a_record(IndexRecord const& record)
+{
+    // The record is stored in index’s list of records such that the list is sorted primarily on the records keys,
+    // and secondarily on the records values, in ascending order.
+    auto position = lower_bound_for_key(records(), record.key);
+    while (position < m_records.size() && Key::equals(m_records[position].key, record.key) && !Key::greater_than(m_records[position].value, record.value))
+        ++position;
 
-    return index != m_records.end();
+    m_records.insert(position, record);
 }
 
 // https://w3c.github.io/IndexedDB/#index-referenced-value
@@ -62,13 +71,7 @@ HTML::SerializationRecord Index::referenced_value(IndexRecord const& index_recor
 {
     // Records in an index are said to have a referenced value.
     // This is the value of the record in the index’s referenced object store which has a key equal to the index’s record’s value.
-    return m_object_store
-        ->records()
-        .first_matching([&](auto const& store_record) {
-            return Key::equals(store_record.key, index_record.value);
-        })
-        .value()
-        .value;
+    return m_object_store->find_record(index_record.value).value().value;
 }
 
 void Index::clear_records()
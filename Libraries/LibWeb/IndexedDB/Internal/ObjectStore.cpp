@@ -4,9 +4,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/QuickSort.h>
 #include <LibWeb/IndexedDB/IDBKeyRange.h>
 #include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+#include <LibWeb/IndexedDB/Internal/SortedRecords.h>
 
 namespace Web::IndexedDB {
 
@@ -43,45 +43,42 @@ void ObjectStore::visit_edges(Visitor& visitor)
 
 void ObjectStore::remove_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    m_records.remove_all_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto indices = record_indices_in_range(records(), range);
+    m_records.remove(indices.begin, indices.size());
 }
 
 bool ObjectStore::has_record_with_key(GC::Ref<Key> key)
 {
-    auto index = m_records.find_if([&key](auto const& record) {
-        return Key::equals(key, record.key);
-    });
+    return find_record(key).has_value();
+}
+
+Optional<Record const&> ObjectStore::find_record(GC::Ref<Key> key) const
+{
+    auto index = lower_bound_for_key(records(), key);
+    if (index == m_records.size() || !Key::equals(m_records[index].key, key))
+        return {};
 
-    return index != m_records.end();
+    return m_records[index];
 }
 
 void ObjectStore::store_a_record(Record const& record)
 {
-    m_records.append(record);
-
     // NOTE: The record is stored in the object store’s list of records such that the list is sorted according to the key of the records in ascending order.
-    AK::quick_sort(m_records, [](auto const& a, auto const& b) {
-        return Key::compare_two_keys(a.key, b.key) < 0;
-    });
+    m_records.insert(upper_bound_for_key(records(), record.key), record);
 }
 
 u64 ObjectStore::count_records_in_range(GC::Ref<IDBKeyRange> range)
 {
-    u64 count = 0;
-    for (auto const& record : m_records) {
-        if (range->is_in_range(record.key))
-            ++count;
-    }
-    return count;
+    return record_indices_in_range(records(), range).size();
 }
 
 Optional<Record&> ObjectStore::first_in_range(GC::Ref<IDBKeyRange> range)
 {
-    return m_records.first_matching([&](auto const& record) {
-        return range->is_in_range(record.key);
-    });
+    auto indices = record_indices_in_range(records(), range);
+    if (indices.size() == 0)
+        return {};
+
+    return m_records[indices.begin];
 }
 
 void ObjectStore::clear_records()
@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/MemoryStream.h>
+#include <LibWeb/Bindings/PrincipalHostDefined.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/IndexedDB/IDBDatabase.h>
+#include <LibWeb/IndexedDB/IDBTransaction.h>
+#include <LibWeb/IndexedDB/Internal/Database.h>
+#include <LibWeb/IndexedDB/Internal/Index.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+#include <LibWeb/IndexedDB/Internal/ObjectStore.h>
+#include <LibWeb/IndexedDB/Internal/PersistentStorage.h>
+#include <LibWeb/Page/Page.h>
+
+namespace Web::IndexedDB {
+
+// Bump this whenever the format below changes. Persisted databases in an older format are discarded.
+static constexpr u32 persisted_format_version = 1;
+
+enum class KeyPathType : u8 {
+    None,
+    String,
+    List,
+};
+
+static ErrorOr<void> write_bytes(Stream& stream, ReadonlyBytes bytes)
+{
+    TRY(stream.write_value<u32>(bytes.size()));
+    TRY(stream.write_until_depleted(bytes));
+    return {};
+}
+
+static ErrorOr<ByteBuffer> read_bytes(Stream& stream)
+{
+    auto size = TRY(stream.read_value<u32>());
+    auto bytes = TRY(ByteBuffer::create_uninitialized(size));
+    TRY(stream.read_until_filled(bytes));
+    return bytes;
+}
+
+static ErrorOr<void> write_string(Stream& stream, String const& string)
+{
+    return write_bytes(stream, string.bytes());
+}
+
+static ErrorOr<String> read_string(Stream& stream)
+{
+    auto bytes = TRY(read_bytes(stream));
+    return String::from_utf8(bytes);
+}
+
+static ErrorOr<void> write_key_path(Stream& stream, Optional<KeyPath> const& key_path)
+{
+    if (!key_path.has_value())
+        return stream.write_value(KeyPathType::None);
+
+    return key_path->visit(
+        [&](String const& path) -> ErrorOr<void> {
+            TRY(stream.write_value(KeyPathType::String));
+            return write_string(stream, path);
+        },
+        [&](Vector<String> const& paths) -> ErrorOr<void> {
+            TRY(stream.write_value(KeyPathType::List));
+            TRY(stream.write_value<u32>(paths.size()));
+            for (auto const& path : paths)
+                TRY(write_string(stream, path));
+            return {};
+        });
+}
+
+static ErrorOr<Optional<KeyPath>> read_key_path(Stream& stream)
+{
+    switch (TRY(stream.read_value<KeyPathType>())) {
+    case KeyPathType::None:
+        return OptionalNone {};
+    case KeyPathType::String:
+        return Optional<KeyPath> { TRY(read_string(stream)) };
+    case KeyPathType::List: {
+        auto count = TRY(stream.read_value<u32>());
+
+        Vector<String> paths;
+        TRY(paths.try_ensure_capacity(count));
+        for (u32 i = 0; i < count; ++i)
+            paths.unchecked_append(TRY(read_string(stream)));
+
+        return Optional<KeyPath> { move(paths) };
+    }
+    }
+
+    return Error::from_string_literal("Invalid key path type");
+}
+
+static ErrorOr<void> write_key(Stream& stream, Key& key)
+{
+    TRY(stream.write_value<u8>(key.type()));
+
+    switch (key.type()) {
+    case Key::KeyType::Number:
+    case Key::KeyType::Date:
+        return stream.write_value(key.value_as_double());
+    case Key::KeyType::String:
+    case Key::KeyType::Invalid:
+        return write_string(stream, key.value_as_string());
+    case Key::KeyType::Binary:
+        return write_bytes(stream, key.value_as_byte_buffer());
+    case Key::KeyType::Array: {
+        auto subkeys = key.subkeys();
+
+        TRY(stream.write_value<u32>(subkeys.size()));
+        for (auto const& subkey : subkeys)
+            TRY(write_key(stream, *subkey));
+
+        return {};
+    }
+    }
+
+    VERIFY_NOT_REACHED();
+}
+
+static ErrorOr<GC::Ref<Key>> read_key(JS::Realm& realm, Stream& stream)
+{
+    auto type = TRY(stream.read_value<u8>());
+
+    switch (type) {
+    case Key::KeyType::Number:
+        return Key::create_number(realm, TRY(stream.read_value<double>()));
+    case Key::KeyType::Date:
+        return Key::create_date(realm, TRY(stream.read_value<double>()));
+    case Key::KeyType::String:
+        return Key::create_string(realm, TRY(read_string(stream)));
+    case Key::KeyType::Invalid:
+        return Key::create_invalid(realm, TRY(read_string(stream)));
+    case Key::KeyType::Binary:
+        return Key::create_binary(realm, TRY(read_bytes(stream)));
+    case Key::KeyType::Array: {
+        auto count = TRY(stream.read_value<u32>());
+
+        Vector<GC::Root<Key>> subkeys;
+        TRY(subkeys.try_ensure_capacity(count));
+        for (u32 i = 0; i < count; ++i)
+            subkeys.unchecked_append(TRY(read_key(realm, stream)));
+
+        return Key::create_array(realm, subkeys);
+    }
+    }
+
+    return Error::from_string_literal("Invalid key type");
+}
+
+ErrorOr<ByteBuffer> serialize_database_schema(Database& database)
+{
+    AllocatingMemoryStream stream;
+
+    TRY(stream.write_value(persisted_format_version));
+    TRY(stream.write_value<u64>(database.version()));
+
+    auto object_stores = database.object_stores();
+    TRY(stream.write_value<u32>(object_stores.size()));
+
+    for (auto const& object_store : object_stores) {
+        TRY(write_string(stream, object_store->name()));
+        TRY(write_key_path(stream, object_store->key_path()));
+
+        TRY(stream.write_value(object_store->uses_a_key_generator()));
+        if (object_store->uses_a_key_generator())
+            TRY(stream.write_value<u64>(object_store->key_generator().current_number()));
+
+        auto const& indexes = object_store->index_set();
+        TRY(stream.write_value<u32>(indexes.size()));
+
+        for (auto const& [name, index] : indexes) {
+            TRY(write_string(stream, name));
+            TRY(write_key_path(stream, index->key_path()));
+            TRY(stream.write_value(index->unique()));
+            TRY(stream.write_value(index->multi_entry()));
+        }
+    }
+
+    return stream.read_until_eof();
+}
+
+ErrorOr<ByteBuffer> serialize_object_store_records(ObjectStore& object_store)
+{
+    AllocatingMemoryStream stream;
+
+    auto records = object_store.records();
+    TRY(stream.write_value<u32>(records.size()));
+
+    for (auto const& record : records) {
+        TRY(write_key(stream, *record.key));
+        TRY(write_bytes(stream, { record.value.data(), record.value.size() * sizeof(u32) }));
+    }
+
+    auto const& indexes = object_store.index_set();
+    TRY(stream.write_value<u32>(indexes.size()));
+
+    for (auto const& [name, index] : indexes) {
+        auto index_records = index->records();
+
+        TRY(write_string(stream, name));
+        TRY(stream.write_value<u32>(index_records.size()));
+
+        for (auto const& index_record : index_records) {
+            TRY(write_key(stream, *index_record.key));
+            TRY(write_key(stream, *index_record.value));
+        }
+    }
+
+    return stream.read_until_eof();
+}
+
+static ErrorOr<void> restore_object_store_records(JS::Realm& realm, ObjectStore& object_store, ReadonlyBytes bytes)
+{
+    FixedMemoryStream stream { bytes };
+
+    auto record_count = TRY(stream.read_value<u32>());
+    for (u32 i = 0; i < record_count; ++i) {
+        auto key = TRY(read_key(realm, stream));
+        auto value = TRY(read_bytes(stream));
+
+        if (value.size() % sizeof(u32) != 0)
+            return Error::from_string_literal("Invalid record value size");
+
+        HTML::SerializationRecord serialized;
+        TRY(serialized.try_resize(value.size() / sizeof(u32)));
+        __builtin_memcpy(serialized.data(), value.data(), value.size());
+
+        object_store.store_a_record({ .key = key, .value = move(serialized) });
+    }
+
+    auto index_count = TRY(stream.read_value<u32>());
+    for (u32 i = 0; i < index_count; ++i) {
+        auto name = TRY(read_string(stream));
+
+        auto index = object_store.index_set().get(name);
+        if (!index.has_value())
+            return Error::from_string_literal("Records of an unknown index");
+
+        auto index_record_count = TRY(stream.read_value<u32>());
+        for (u32 j = 0; j < index_record_count; ++j) {
+            auto key = TRY(read_key(realm, stream));
+            auto value = TRY(read_key(realm, stream));
+
+            (*index)->store_a_record({ .key = key, .value = value });
+        }
+    }
+
+    return {};
+}
+
+ErrorOr<void> restore_persisted_database(JS::Realm& realm, Database& database, PersistedDatabase const& persisted_database)
+{
+    FixedMemoryStream stream { persisted_database.schema.bytes() };
+
+    if (TRY(stream.read_value<u32>()) != persisted_format_version)
+        return Error::from_string_literal("Unsupported persisted database format");
+
+    database.set_version(TRY(stream.read_value<u64>()));
+
+    auto object_store_count = TRY(stream.read_value<u32>());
+    for (u32 i = 0; i < object_store_count; ++i) {
+        auto name = TRY(read_string(stream));
+        auto key_path = TRY(read_key_path(stream));
+
+        auto uses_a_key_generator = TRY(stream.read_value<bool>());
+        auto object_store = ObjectStore::create(realm, database, name, uses_a_key_generator, key_path);
+
+        if (uses_a_key_generator)
+            object_store->key_generator().set(TRY(stream.read_value<u64>()));
+
+        auto index_count = TRY(stream.read_value<u32>());
+        for (u32 j = 0; j < index_count; ++j) {
+            auto index_name = TRY(read_string(stream));
+            auto index_key_path = TRY(read_key_path(stream));
+            if (!index_key_path.has_value())
+                return Error::from_string_literal("Index without a key path");
+
+            auto unique = TRY(stream.read_value<bool>());
+            auto multi_entry = TRY(stream.read_value<bool>());
+            Index::create(realm, object_store, index_name, *index_key_path, unique, multi_entry);
+        }
+
+        if (auto records = persisted_database.object_store_records.get(name); records.has_value())
+            TRY(restore_object_store_records(realm, object_store, *records));
+    }
+
+    return {};
+}
+
+static Optional<Page&> page_for_persistent_storage(JS::Realm& realm, StorageAPI::StorageKey const& storage_key)
+{
+    // Databases of opaque origins cannot be reopened after the fact, so there is no point in persisting them.
+    if (storage_key.origin.is_opaque())
+        return {};
+
+    return Bindings::principal_host_defined_page(HTML::principal_realm(realm));
+}
+
+GC::Ptr<Database> load_persisted_database(JS::Realm& realm, StorageAPI::StorageKey& storage_key, String& name)
+{
+    auto page = page_for_persistent_storage(realm, storage_key);
+    if (!page.has_value())
+        return nullptr;
+
+    auto persisted_database = page->client().page_did_request_indexed_db_database(storage_key.origin.serialize(), name);
+    if (!persisted_database.has_value())
+        return nullptr;
+
+    auto database = Database::create_for_key_and_name(realm, storage_key, name);
+    if (database.is_error())
+        return nullptr;
+
+    if (auto result = restore_persisted_database(realm, *database.value(), *persisted_database); result.is_error()) {
+        dbgln("Unable to restore IndexedDB database '{}' of {}: {}", name, storage_key.origin.serialize(), result.error());
+
+        (void)Database::delete_for_key_and_name(storage_key, name);
+        page->client().page_did_delete_indexed_db_database(storage_key.origin.serialize(), name);
+        return nullptr;
+    }
+
+    return *database.value();
+}
+
+ErrorOr<void> persist_changes_made_by_transaction(JS::Realm& realm, IDBTransaction& transaction)
+{
+    if (transaction.is_readonly())
+        return {};
+
+    auto database = transaction.connection()->associated_database();
+
+    auto const& storage_key = database->storage_key();
+    if (!storage_key.has_value())
+        return {};
+
+    auto page = page_for_persistent_storage(realm, *storage_key);
+    if (!page.has_value())
+        return {};
+
+    PersistedDatabase persisted_database;
+    persisted_database.schema = TRY(serialize_database_schema(database));
+
+    // An upgrade transaction may have created, renamed or deleted any of the object stores, so all of them are written.
+    auto object_stores = transaction.is_upgrade_transaction() ? database->object_stores() : transaction.scope();
+
+    for (auto const& object_store : object_stores)
+        TRY(persisted_database.object_store_records.try_set(object_store->name(), TRY(serialize_object_store_records(object_store))));
+
+    Vector<String> object_store_names;
+    TRY(object_store_names.try_ensure_capacity(database->object_stores().size()));
+    for (auto const& object_store : database->object_stores())
+        object_store_names.unchecked_append(object_store->name());
+
+    // NOTE: The browser process refuses to persist changes that would make the storage key use more than its quota.
+    if (!page->client().page_did_update_indexed_db_database(storage_key->origin.serialize(), database->name(), persisted_database, object_store_names))
+        return Error::from_errno(ENOSPC);
+    return {};
+}
+
+void delete_persisted_database(JS::Realm& realm, StorageAPI::StorageKey const& storage_key, String const& name)
+{
+    if (auto page = page_for_persistent_storage(realm, storage_key); page.has_value())
+        page->client().page_did_delete_indexed_db_database(storage_key.origin.serialize(), name);
+}
+
+}
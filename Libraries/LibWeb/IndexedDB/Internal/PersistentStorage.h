@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/HashMap.h>
+#include <AK/String.h>
+#include <LibGC/Ptr.h>
+#include <LibJS/Forward.h>
+#include <LibWeb/Forward.h>
+#include <LibWeb/StorageAPI/StorageKey.h>
+
+namespace Web::IndexedDB {
+
+// A database as it is persisted by the browser process: its schema (the version, object stores and indexes), and the
+// records of each of its object stores. The two are kept apart so that a transaction only has to write out the object
+// stores in its scope.
+struct PersistedDatabase {
+    ByteBuffer schema;
+    HashMap<String, ByteBuffer> object_store_records;
+};
+
+ErrorOr<ByteBuffer> serialize_database_schema(Database&);
+ErrorOr<ByteBuffer> serialize_object_store_records(ObjectStore&);
+ErrorOr<void> restore_persisted_database(JS::Realm&, Database&, PersistedDatabase const&);
+
+// Returns the database named name in storage key from persistent storage, if it has been persisted before.
+GC::Ptr<Database> load_persisted_database(JS::Realm&, StorageAPI::StorageKey&, String&);
+
+// Writes the changes made by a readwrite or upgrade transaction to persistent storage.
+ErrorOr<void> persist_changes_made_by_transaction(JS::Realm&, IDBTransaction&);
+
+void delete_persisted_database(JS::Realm&, StorageAPI::StorageKey const&, String const&);
+
+}
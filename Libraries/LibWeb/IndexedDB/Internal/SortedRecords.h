@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Span.h>
+#include <LibGC/Ptr.h>
+#include <LibWeb/IndexedDB/IDBKeyRange.h>
+#include <LibWeb/IndexedDB/Internal/Key.h>
+
+namespace Web::IndexedDB {
+
+// The lists of records of object stores and indexes are sorted by key in ascending order, so the records with a given
+// key, or with a key in a given range, can be found with a binary search rather than by visiting every record.
+
+// Returns the index of the first record whose key is greater than or equal to key (or greater than key, if exclusive).
+template<typename RecordType>
+size_t first_record_index_after(ReadonlySpan<RecordType> records, GC::Ref<Key> key, bool exclusive)
+{
+    size_t low = 0;
+    size_t high = records.size();
+
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        auto comparison = Key::compare_two_keys(records[middle].key, key);
+
+        if (comparison < 0 || (comparison == 0 && exclusive))
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return low;
+}
+
+template<typename RecordType>
+size_t lower_bound_for_key(ReadonlySpan<RecordType> records, GC::Ref<Key> key)
+{
+    return first_record_index_after(records, key, false);
+}
+
+template<typename RecordType>
+size_t upper_bound_for_key(ReadonlySpan<RecordType> records, GC::Ref<Key> key)
+{
+    return first_record_index_after(records, key, true);
+}
+
+struct RecordIndexRange {
+    size_t begin { 0 };
+    size_t end { 0 };
+
+    size_t size() const { return end - begin; }
+};
+
+// Returns the indices of the first record with key in range, and of the record one past the last such record.
+template<typename RecordType>
+RecordIndexRange record_indices_in_range(ReadonlySpan<RecordType> records, IDBKeyRange const& range)
+{
+    size_t begin = 0;
+    size_t end = records.size();
+
+    if (auto lower_key = range.lower_key())
+        begin = first_record_index_after(records, *lower_key, range.lower_open());
+    if (auto upper_key = range.upper_key())
+        end = first_record_index_after(records, *upper_key, !range.upper_open());
+
+    return { .begin = begin, .end = max(begin, end) };
+}
+
+template<typename RecordType>
+ReadonlySpan<RecordType> records_in_range(ReadonlySpan<RecordType> records, IDBKeyRange const& range)
+{
+    auto indices = record_indices_in_range(records, range);
+    return records.slice(indices.begin, indices.size());
+}
+
+}
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/Bindings/InternalsPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
@@ -12,6 +13,7 @@
 #include <LibWeb/DOM/EventTarget.h>
 #include <LibWeb/DOMURL/DOMURL.h>
 #include <LibWeb/HTML/HTMLElement.h>
+#include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Internals/Internals.h>
 #include <LibWeb/Page/InputEvent.h>
@@ -239,6 +241,49 @@ void Internals::set_browser_zoom(double factor)
     page().client().page_did_set_browser_zoom(factor);
 }
 
+JS::Object* Internals::get_last_frame_statistics()
+{
+    auto const& statistics = window().associated_document().last_frame_statistics();
+    auto result = JS::Object::create(realm(), nullptr);
+    auto define_property = [&](FlyString const& name, JS::Value value) {
+        result->define_direct_property(name, value, JS::default_attributes);
+    };
+    define_property("timeSpentUpdatingStyle"_fly_string, JS::Value(statistics.time_spent_updating_style.to_microseconds() / 1000.0));
+    define_property("timeSpentUpdatingLayout"_fly_string, JS::Value(statistics.time_spent_updating_layout.to_microseconds() / 1000.0));
+    define_property("timeSpentRecordingDisplayList"_fly_string, JS::Value(statistics.time_spent_recording_display_list.to_microseconds() / 1000.0));
+    define_property("styleUpdates"_fly_string, JS::Value(statistics.number_of_style_updates));
+    define_property("elementsWithRecomputedStyle"_fly_string, JS::Value(statistics.number_of_elements_with_recomputed_style));
+    define_property("elementsWithSharedMatchingRules"_fly_string, JS::Value(statistics.number_of_elements_with_shared_matching_rules));
+    define_property("ruleCandidatesTested"_fly_string, JS::Value(statistics.number_of_rule_candidates_tested));
+    define_property("layoutUpdates"_fly_string, JS::Value(statistics.number_of_layout_updates));
+    define_property("layoutNodesBuilt"_fly_string, JS::Value(statistics.number_of_layout_nodes_built));
+    define_property("intrinsicSizeCacheHits"_fly_string, JS::Value(statistics.number_of_intrinsic_size_cache_hits));
+    define_property("intrinsicSizeCacheMisses"_fly_string, JS::Value(statistics.number_of_intrinsic_size_cache_misses));
+    define_property("displayListsRecorded"_fly_string, JS::Value(statistics.number_of_display_lists_recorded));
+    define_property("displayListCommands"_fly_string, JS::Value(statistics.number_of_display_list_commands));
+    return result.ptr();
+}
+
+JS::Object* Internals::get_frame_timings()
+{
+    auto const& timings = page().top_level_traversable()->frame_timings();
+    auto result = JS::Object::create(realm(), nullptr);
+    auto histogram_object = [&](HTML::FrameTimeHistogram const& histogram) {
+        auto object = JS::Object::create(realm(), nullptr);
+        object->define_direct_property("count"_fly_string, JS::Value(histogram.count()), JS::default_attributes);
+        object->define_direct_property("totalMs"_fly_string, JS::Value(histogram.total().to_microseconds() / 1000.0), JS::default_attributes);
+        object->define_direct_property("maxMs"_fly_string, JS::Value(histogram.max().to_microseconds() / 1000.0), JS::default_attributes);
+        auto buckets = JS::Array::create_from<u64>(realm(), histogram.buckets().span(), [](u64 count) { return JS::Value(count); });
+        object->define_direct_property("buckets"_fly_string, buckets, JS::default_attributes);
+        return object;
+    };
+    result->define_direct_property("mainThreadTime"_fly_string, histogram_object(timings.main_thread_time), JS::default_attributes);
+    result->define_direct_property("rasterizationTime"_fly_string, histogram_object(timings.rasterization_time), JS::default_attributes);
+    result->define_direct_property("presentationLatency"_fly_string, histogram_object(timings.presentation_latency), JS::default_attributes);
+    result->define_direct_property("skippedFrames"_fly_string, JS::Value(timings.number_of_skipped_frames), JS::default_attributes);
+    return result.ptr();
+}
+
 bool Internals::headless()
 {
     return page().client().is_headless();
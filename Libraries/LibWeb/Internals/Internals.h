@@ -58,6 +58,9 @@ public:
 
     void set_browser_zoom(double factor);
 
+    JS::Object* get_last_frame_statistics();
+    JS::Object* get_frame_timings();
+
     bool headless();
 
 private:
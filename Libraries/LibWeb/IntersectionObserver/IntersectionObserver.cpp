@@ -144,6 +144,9 @@ void IntersectionObserver::observe(DOM::Element& target)
 
     // 4. Add target to observer’s internal [[ObservationTargets]] slot.
     m_observation_targets.append(target);
+
+    // The new target has to be evaluated in the next update, even if nothing on the page moves until then.
+    m_geometry_generation_of_last_update.clear();
 }
 
 // https://w3c.github.io/IntersectionObserver/#dom-intersectionobserver-unobserve
@@ -67,6 +67,10 @@ public:
 
     void queue_entry(Badge<DOM::Document>, GC::Ref<IntersectionObserverEntry>);
 
+    // The page geometry generation at which all of our targets were last evaluated, if none were added since.
+    Optional<u64> geometry_generation_of_last_update() const { return m_geometry_generation_of_last_update; }
+    void set_geometry_generation_of_last_update(Badge<DOM::Document>, u64 generation) { m_geometry_generation_of_last_update = generation; }
+
     WebIDL::CallbackType& callback() { return *m_callback; }
 
 private:
@@ -107,6 +111,8 @@ private:
 
     // AD-HOC: This is the document where we've registered the IntersectionObserver.
     WeakPtr<DOM::Document> m_document;
+
+    Optional<u64> m_geometry_generation_of_last_update;
 };
 
 }
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/GenericShorthands.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/HTML/HTMLHtmlElement.h>
 #include <LibWeb/Layout/BlockContainer.h>
@@ -57,6 +58,36 @@ Optional<CSSPixelFraction> Box::natural_aspect_ratio() const
     return m_natural_aspect_ratio;
 }
 
+bool Box::is_intrinsic_size_boundary() const
+{
+    // NOTE: Inline-level boxes can contribute a baseline derived from their contents to their line box.
+    if (!display().is_block_outside())
+        return false;
+
+    auto const& values = computed_values();
+    if (!values.width().is_length() || !values.height().is_length())
+        return false;
+
+    auto is_auto_or_length = [](CSS::Size const& size) { return size.is_auto() || size.is_length(); };
+    auto is_none_or_length = [](CSS::Size const& size) { return size.is_none() || size.is_length(); };
+    if (!is_auto_or_length(values.min_width()) || !is_auto_or_length(values.min_height()))
+        return false;
+    if (!is_none_or_length(values.max_width()) || !is_none_or_length(values.max_height()))
+        return false;
+
+    // A flex basis of content, or of an intrinsic size keyword, sizes a flex item by its contents.
+    auto const* flex_basis = values.flex_basis().get_pointer<CSS::Size>();
+    if (!flex_basis || !is_auto_or_length(*flex_basis))
+        return false;
+
+    // NOTE: Scroll containers establish an independent formatting context, so floats and margins inside can't escape.
+    //       Flex and grid items that are scroll containers also have no content-based automatic minimum size.
+    auto is_scroll_container_overflow = [](CSS::Overflow overflow) {
+        return first_is_one_of(overflow, CSS::Overflow::Hidden, CSS::Overflow::Scroll, CSS::Overflow::Auto);
+    };
+    return is_scroll_container_overflow(values.overflow_x()) && is_scroll_container_overflow(values.overflow_y());
+}
+
 void Box::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
@@ -71,6 +71,9 @@ public:
     }
     void reset_cached_intrinsic_sizes() const { m_cached_intrinsic_sizes.clear(); }
 
+    // Whether this box's size and contribution to its ancestors' intrinsic sizes are independent of its contents.
+    [[nodiscard]] bool is_intrinsic_size_boundary() const;
+
 protected:
     Box(DOM::Document&, DOM::Node*, GC::Ref<CSS::ComputedProperties>);
     Box(DOM::Document&, DOM::Node*, NonnullOwnPtr<CSS::ComputedValues>);
@@ -244,6 +244,10 @@ OwnPtr<FormattingContext> FormattingContext::layout_inside(Box const& child_box,
     if (!child_box.can_have_children())
         return {};
 
+    // FIXME: Independent formatting contexts whose available space is known up front (e.g. flex items with definite
+    //        sizes or table cells) could be laid out on a thread pool. That needs LayoutState to stop creating used
+    //        values on demand from const lookups, font shaping caches and the GC heap to be safe to use off the main
+    //        thread, and layout nodes to stop being mutated during layout (e.g. by cached intrinsic sizes).
     auto independent_formatting_context = create_independent_formatting_context_if_needed(m_state, layout_mode, child_box);
     if (independent_formatting_context)
         independent_formatting_context->run(available_space);
@@ -496,6 +500,15 @@ CSSPixels FormattingContext::compute_table_box_height_inside_table_wrapper(Box c
     return available_space.height.is_definite() ? min(table_used_height, available_height) : table_used_height;
 }
 
+static void record_intrinsic_size_cache_lookup(Box const& box, bool hit)
+{
+    auto& statistics = box.document().frame_statistics();
+    if (hit)
+        ++statistics.number_of_intrinsic_size_cache_hits;
+    else
+        ++statistics.number_of_intrinsic_size_cache_misses;
+}
+
 // 10.3.2 Inline, replaced elements, https://www.w3.org/TR/CSS22/visudet.html#inline-replaced-width
 CSSPixels FormattingContext::tentative_width_for_replaced_element(Box const& box, CSS::Size const& computed_width, AvailableSpace const& available_space) const
 {
@@ -1451,6 +1464,7 @@ CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box)
         return *box.natural_width();
 
     auto& cache = box.cached_intrinsic_sizes().min_content_width;
+    record_intrinsic_size_cache_lookup(box, cache.has_value());
     if (cache.has_value())
         return cache.value();
 
@@ -1483,6 +1497,7 @@ CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box)
         return *box.natural_width();
 
     auto& cache = box.cached_intrinsic_sizes().max_content_width;
+    record_intrinsic_size_cache_lookup(box, cache.has_value());
     if (cache.has_value())
         return cache.value();
 
@@ -1520,6 +1535,7 @@ CSSPixels FormattingContext::calculate_min_content_height(Layout::Box const& box
         return *box.natural_height();
 
     auto& cache = box.cached_intrinsic_sizes().min_content_height.ensure(width);
+    record_intrinsic_size_cache_lookup(box, cache.has_value());
     if (cache.has_value())
         return cache.value();
 
@@ -1551,6 +1567,7 @@ CSSPixels FormattingContext::calculate_max_content_height(Layout::Box const& box
         return *box.natural_height();
 
     auto& cache_slot = box.cached_intrinsic_sizes().max_content_height.ensure(width);
+    record_intrinsic_size_cache_lookup(box, cache_slot.has_value());
     if (cache_slot.has_value())
         return cache_slot.value();
 
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/SegmentedVector.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Point.h>
 #include <LibWeb/Layout/Box.h>
@@ -55,6 +56,10 @@ struct StaticPositionRect {
 };
 
 struct LayoutState {
+    AK_MAKE_NONCOPYABLE(LayoutState);
+    AK_MAKE_NONMOVABLE(LayoutState);
+
+public:
     struct UsedValues {
         NodeWithStyle const& node() const { return *m_node; }
         NodeWithStyle& node() { return const_cast<NodeWithStyle&>(*m_node); }
@@ -197,6 +202,7 @@ struct LayoutState {
         Optional<StaticPositionRect> m_static_position_rect;
     };
 
+    LayoutState();
     ~LayoutState();
 
     // Commits the used values produced by layout and builds a paintable tree.
@@ -205,10 +211,19 @@ struct LayoutState {
     UsedValues& get_mutable(NodeWithStyle const&);
     UsedValues const& get(NodeWithStyle const&) const;
 
-    HashMap<GC::Ref<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
+    // Returns the used values of the node if this state has any, without creating them.
+    UsedValues const* try_get(NodeWithStyle const&) const;
 
 private:
     void resolve_relative_positions();
+
+    Optional<u32> find_used_values_index(NodeWithStyle const&) const;
+
+    // Used values are allocated in creation order from segments of contiguous storage, and stay at the same
+    // address for the lifetime of the state. Nodes are mapped to an index into this storage.
+    mutable SegmentedVector<UsedValues, 32> m_used_values;
+    mutable HashMap<GC::Ref<Layout::NodeWithStyle const>, u32> m_used_values_index_per_layout_node;
+    u64 m_serial_number { 0 };
 };
 
 inline CSSPixels clamp_to_max_dimension_value(CSSPixels value)
@@ -1285,7 +1285,7 @@ void NodeWithStyleAndBoxModelMetrics::visit_edges(Cell::Visitor& visitor)
 
 void Node::set_needs_layout_update(DOM::SetNeedsLayoutReason reason)
 {
-    if (m_needs_layout_update)
+    if (m_needs_layout_update && m_needs_intrinsic_sizes_update)
         return;
 
     if constexpr (UPDATE_LAYOUT_DEBUG) {
@@ -1296,20 +1296,29 @@ void Node::set_needs_layout_update(DOM::SetNeedsLayoutReason reason)
     }
 
     m_needs_layout_update = true;
+    m_needs_intrinsic_sizes_update = true;
 
     // Mark any anonymous children generated by this node for layout update.
     // NOTE: if this node generated an anonymous parent, all ancestors are indiscriminately marked below.
     for_each_child_of_type<Box>([&](Box& child) {
         if (child.is_anonymous() && !is<TableWrapper>(child)) {
             child.m_needs_layout_update = true;
+            child.m_needs_intrinsic_sizes_update = true;
         }
         return IterationDecision::Continue;
     });
 
+    // NOTE: Layout always starts from the viewport, so every ancestor needs layout. The intrinsic sizes of ancestors
+    //       above an intrinsic size boundary can't have changed though, so their cached intrinsic sizes are kept.
+    bool intrinsic_sizes_may_have_changed = true;
     for (auto* ancestor = parent(); ancestor; ancestor = ancestor->parent()) {
-        if (ancestor->m_needs_layout_update)
+        if (ancestor->m_needs_layout_update && (ancestor->m_needs_intrinsic_sizes_update || !intrinsic_sizes_may_have_changed))
             break;
         ancestor->m_needs_layout_update = true;
+        if (intrinsic_sizes_may_have_changed)
+            ancestor->m_needs_intrinsic_sizes_update = true;
+        if (auto* box = as_if<Box>(*ancestor); box && box->is_intrinsic_size_boundary())
+            intrinsic_sizes_may_have_changed = false;
     }
 }
 
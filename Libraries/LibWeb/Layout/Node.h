@@ -47,7 +47,15 @@ public:
 
     bool needs_layout_update() const { return m_needs_layout_update; }
     void set_needs_layout_update(DOM::SetNeedsLayoutReason);
-    void reset_needs_layout_update() { m_needs_layout_update = false; }
+    void reset_needs_layout_update()
+    {
+        m_needs_layout_update = false;
+        m_needs_intrinsic_sizes_update = false;
+    }
+
+    // Whether a change at or below this node may have changed its intrinsic sizes. This is only false for nodes that
+    // need layout because of changes inside an intrinsic size boundary somewhere below them.
+    bool needs_intrinsic_sizes_update() const { return m_needs_intrinsic_sizes_update; }
 
     bool is_generated() const { return m_generated_for.has_value(); }
     bool is_generated_for_before_pseudo_element() const { return m_generated_for == CSS::GeneratedPseudoElement::Before; }
@@ -220,6 +228,7 @@ private:
     bool m_has_been_wrapped_in_table_wrapper { false };
 
     bool m_needs_layout_update { false };
+    bool m_needs_intrinsic_sizes_update { false };
 
     Optional<CSS::GeneratedPseudoElement> m_generated_for {};
 
@@ -257,6 +266,8 @@ protected:
     NodeWithStyle(DOM::Document&, DOM::Node*, NonnullOwnPtr<CSS::ComputedValues>);
 
 private:
+    friend struct LayoutState;
+
     virtual bool is_node_with_style() const final { return true; }
 
     void reset_table_box_computed_values_used_by_wrapper_to_init_values();
@@ -264,6 +275,11 @@ private:
 
     NonnullOwnPtr<CSS::ComputedValues> m_computed_values;
     RefPtr<CSS::AbstractImageStyleValue const> m_list_style_image;
+
+    // Remembers where this node's used values live in the most recent LayoutState that looked them up,
+    // so that repeated lookups in that state don't have to go through its hash map.
+    mutable u64 m_cached_layout_state_serial_number { 0 };
+    mutable u32 m_cached_used_values_index { 0 };
 };
 
 template<>
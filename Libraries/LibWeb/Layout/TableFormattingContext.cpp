@@ -121,10 +121,31 @@ void TableFormattingContext::compute_cell_measures()
         CSSPixels border_left = use_collapsing_borders_model ? round(cell_state.border_left / 2) : computed_values.border_left().width;
         CSSPixels border_right = use_collapsing_borders_model ? round(cell_state.border_right / 2) : computed_values.border_right().width;
 
-        auto min_content_width = calculate_min_content_width(cell.box);
-        auto max_content_width = calculate_max_content_width(cell.box);
-        auto min_content_height = calculate_min_content_height(cell.box, max_content_width);
-        auto max_content_height = calculate_max_content_height(cell.box, min_content_width);
+        // For fixed mode, according to https://www.w3.org/TR/css-tables-3/#computing-column-measures:
+        // The min-content and max-content width of cells is considered zero unless they are directly specified as a length-percentage,
+        // in which case they are resolved based on the table width (if it is definite, otherwise use 0).
+        auto width_is_specified_length_or_percentage = computed_values.width().is_length() || computed_values.width().is_percentage();
+
+        // OPTIMIZATION: In fixed mode, only the first row contributes to the column widths, and the height of a row is
+        //               established by laying out its cells at their final widths. The content of other cells that
+        //               don't span multiple rows or columns doesn't need to be measured, which keeps large fixed
+        //               tables from running intrinsic sizing for every single cell.
+        auto content_contributes_to_measures = !use_fixed_mode_layout()
+            || cell.row_index == 0
+            || cell.row_span != 1
+            || cell.column_span != 1
+            || width_is_specified_length_or_percentage;
+
+        CSSPixels min_content_width = 0;
+        CSSPixels max_content_width = 0;
+        CSSPixels min_content_height = 0;
+        CSSPixels max_content_height = 0;
+        if (content_contributes_to_measures) {
+            min_content_width = calculate_min_content_width(cell.box);
+            max_content_width = calculate_max_content_width(cell.box);
+            min_content_height = calculate_min_content_height(cell.box, max_content_width);
+            max_content_height = calculate_max_content_height(cell.box, min_content_width);
+        }
 
         // The outer min-content height of a table-cell is max(min-height, min-content height) adjusted by the cell intrinsic offsets.
         auto min_height = computed_values.min_height().to_px(cell.box, containing_block.content_height());
@@ -133,10 +154,6 @@ void TableFormattingContext::compute_cell_measures()
         // The outer min-content width of a table-cell is max(min-width, min-content width) adjusted by the cell intrinsic offsets.
         auto min_width = computed_values.min_width().to_px(cell.box, containing_block.content_width());
         auto cell_intrinsic_width_offsets = padding_left + padding_right + border_left + border_right;
-        // For fixed mode, according to https://www.w3.org/TR/css-tables-3/#computing-column-measures:
-        // The min-content and max-content width of cells is considered zero unless they are directly specified as a length-percentage,
-        // in which case they are resolved based on the table width (if it is definite, otherwise use 0).
-        auto width_is_specified_length_or_percentage = computed_values.width().is_length() || computed_values.width().is_percentage();
         if (!use_fixed_mode_layout() || width_is_specified_length_or_percentage) {
             cell.outer_min_width = max(min_width, min_content_width) + cell_intrinsic_width_offsets;
         }
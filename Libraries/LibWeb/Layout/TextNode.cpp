@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Array.h>
 #include <AK/CharacterTypes.h>
 #include <AK/StringBuilder.h>
 #include <LibUnicode/CharacterTypes.h>
@@ -415,11 +416,13 @@ TextNode::ChunkIterator::ChunkIterator(TextNode const& text_node, bool wrap_line
     , m_respect_linebreaks(respect_linebreaks)
     , m_utf8_view(text_node.text_for_rendering())
     , m_font_cascade_list(text_node.computed_values().font_list())
-    , m_grapheme_segmenter(text_node.grapheme_segmenter())
+    , m_text_is_ascii(m_utf8_view.as_string().is_ascii())
 {
+    if (!m_text_is_ascii)
+        m_grapheme_segmenter = &text_node.grapheme_segmenter();
 }
 
-static Gfx::GlyphRun::TextType text_type_for_code_point(u32 code_point)
+static Gfx::GlyphRun::TextType compute_text_type_for_code_point(u32 code_point)
 {
     switch (Unicode::bidirectional_class(code_point)) {
     case Unicode::BidiClass::WhiteSpaceNeutral:
@@ -460,6 +463,21 @@ static Gfx::GlyphRun::TextType text_type_for_code_point(u32 code_point)
     }
 }
 
+static Gfx::GlyphRun::TextType text_type_for_code_point(u32 code_point)
+{
+    // OPTIMIZATION: Look up the text type of ASCII code points in a table instead of asking ICU for their bidi class.
+    if (is_ascii(code_point)) {
+        static auto const ascii_text_types = [] {
+            Array<Gfx::GlyphRun::TextType, 128> text_types;
+            for (u32 ascii_code_point = 0; ascii_code_point < text_types.size(); ++ascii_code_point)
+                text_types[ascii_code_point] = compute_text_type_for_code_point(ascii_code_point);
+            return text_types;
+        }();
+        return ascii_text_types[code_point];
+    }
+    return compute_text_type_for_code_point(code_point);
+}
+
 Optional<TextNode::Chunk> TextNode::ChunkIterator::next()
 {
     if (!m_peek_queue.is_empty())
@@ -487,8 +505,16 @@ Optional<TextNode::Chunk> TextNode::ChunkIterator::next_without_peek()
     auto current_code_point = [this]() {
         return *m_utf8_view.iterator_at_byte_offset_without_validation(m_current_index);
     };
-    auto next_grapheme_boundary = [this]() {
-        return m_grapheme_segmenter.next_boundary(m_current_index).value_or(m_utf8_view.byte_length());
+    auto next_grapheme_boundary = [this]() -> size_t {
+        // OPTIMIZATION: In ASCII text, every code point is its own grapheme cluster, except for CR LF.
+        //               https://unicode.org/reports/tr29/#GB3
+        if (m_text_is_ascii) {
+            auto const* bytes = m_utf8_view.bytes();
+            if (bytes[m_current_index] == '\r' && m_current_index + 1 < m_utf8_view.byte_length() && bytes[m_current_index + 1] == '\n')
+                return m_current_index + 2;
+            return m_current_index + 1;
+        }
+        return m_grapheme_segmenter->next_boundary(m_current_index).value_or(m_utf8_view.byte_length());
     };
 
     auto code_point = current_code_point();
@@ -55,7 +55,9 @@ public:
         Utf8View m_utf8_view;
         Gfx::FontCascadeList const& m_font_cascade_list;
 
-        Unicode::Segmenter& m_grapheme_segmenter;
+        // NOTE: Grapheme boundaries in ASCII text can be found without a segmenter, so this is null for ASCII text.
+        Unicode::Segmenter* m_grapheme_segmenter { nullptr };
+        bool m_text_is_ascii { false };
         size_t m_current_index { 0 };
 
         Vector<Chunk> m_peek_queue;
@@ -10,6 +10,7 @@
 #include <AK/HashMap.h>
 #include <AK/Time.h>
 #include <LibCore/ElapsedTimer.h>
+#include <LibRequests/RequestPriority.h>
 #include <LibURL/URL.h>
 #include <LibWeb/Forward.h>
 #include <LibWeb/Page/Page.h>
@@ -27,6 +28,9 @@ public:
     bool is_main_resource() const { return m_main_resource; }
     void set_main_resource(bool b) { m_main_resource = b; }
 
+    Requests::RequestPriority priority() const { return m_priority; }
+    void set_priority(Requests::RequestPriority priority) { m_priority = priority; }
+
     bool is_valid() const { return m_url.has_value(); }
 
     int id() const { return m_id; }
@@ -83,6 +87,7 @@ private:
     Core::ElapsedTimer m_load_timer;
     GC::Root<Page> m_page;
     bool m_main_resource { false };
+    Requests::RequestPriority m_priority { Requests::RequestPriority::Normal };
 };
 
 }
@@ -6,16 +6,54 @@
 
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/SourceBufferPrototype.h>
+#include <LibWeb/DOM/Event.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/TimeRanges.h>
 #include <LibWeb/MediaSourceExtensions/EventNames.h>
 #include <LibWeb/MediaSourceExtensions/SourceBuffer.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/DOMException.h>
 
 namespace Web::MediaSourceExtensions {
 
 GC_DEFINE_ALLOCATOR(SourceBuffer);
 
+// The number of bytes of coded frames a SourceBuffer may hold before appending requires evicting some of them.
+static constexpr size_t SOURCE_BUFFER_QUOTA = 150 * MiB;
+
 SourceBuffer::SourceBuffer(JS::Realm& realm)
     : DOM::EventTarget(realm)
 {
+    m_stream_parser.on_initialization_segment = [this](auto const&, auto const& tracks) -> Media::DecoderErrorOr<void> {
+        // https://w3c.github.io/media-source/#sourcebuffer-init-segment-received
+        // FIXME: Implement the rest of the initialization segment received algorithm, which creates the audio and video
+        //        tracks of the media element.
+        for (auto const& track : tracks) {
+            if (m_track_buffers.contains(track.key))
+                continue;
+            m_track_buffers.set(track.key, make<Media::TrackBuffer>(SOURCE_BUFFER_QUOTA));
+        }
+        return {};
+    };
+
+    m_stream_parser.on_block = [this](auto const& track, auto const& block) -> Media::DecoderErrorOr<void> {
+        // https://w3c.github.io/media-source/#sourcebuffer-coded-frame-processing
+        // FIXME: Apply timestampOffset, the append window and the discontinuity handling of the coded frame processing
+        //        algorithm.
+        auto track_buffer = m_track_buffers.get(track.track_number());
+        if (!track_buffer.has_value())
+            return Media::DecoderError::corrupted("Block belongs to a track that was not in the initialization segment"sv);
+
+        for (auto const& frame : block.frames()) {
+            if (track_buffer.value()->append(block.timestamp(), block.only_keyframes(), frame).is_error())
+                return Media::DecoderError::with_description(Media::DecoderErrorCategory::Memory, "Failed to buffer coded frame"sv);
+        }
+
+        // If this SourceBuffer is full and cannot accept more media data, then set the [[buffer full flag]] to true.
+        if (buffered_size_in_bytes() >= SOURCE_BUFFER_QUOTA)
+            m_buffer_full_flag = true;
+        return {};
+    };
 }
 
 SourceBuffer::~SourceBuffer() = default;
@@ -86,4 +124,279 @@ GC::Ptr<WebIDL::CallbackType> SourceBuffer::onabort()
     return event_handler_attribute(EventNames::abort);
 }
 
+size_t SourceBuffer::buffered_size_in_bytes() const
+{
+    size_t size = 0;
+    for (auto const& track_buffer : m_track_buffers)
+        size += track_buffer.value->size_in_bytes();
+    return size;
+}
+
+void SourceBuffer::queue_event(FlyString const& name)
+{
+    HTML::queue_a_task(HTML::Task::Source::Unspecified, nullptr, nullptr, GC::create_function(heap(), [this, name] {
+        dispatch_event(DOM::Event::create(realm(), name));
+    }));
+}
+
+// https://w3c.github.io/media-source/#dom-sourcebuffer-buffered
+GC::Ref<HTML::TimeRanges> SourceBuffer::buffered() const
+{
+    auto& realm = this->realm();
+
+    // 2. Let highest end time be the largest track buffer ranges end time across all the track buffers managed by this
+    //    SourceBuffer object.
+    // 3. Let intersection ranges equal a TimeRanges object containing a single range from 0 to highest end time.
+    // 4. For each audio and video track buffer managed by this SourceBuffer, run the following steps:
+    //    1. Let track ranges equal the track buffer ranges for the current track buffer.
+    //    2. FIXME: If readyState is "ended", then set the end time on the last range in track ranges to highest end time.
+    //    3. Let new intersection ranges equal the intersection between the intersection ranges and the track ranges.
+    //    4. Replace the ranges in intersection ranges with the new intersection ranges.
+    Optional<Vector<Media::TrackBuffer::TimeRange>> intersection_ranges;
+    for (auto const& track_buffer : m_track_buffers) {
+        auto track_ranges = track_buffer.value->buffered_ranges();
+        if (!intersection_ranges.has_value()) {
+            intersection_ranges = move(track_ranges);
+            continue;
+        }
+
+        Vector<Media::TrackBuffer::TimeRange> new_intersection_ranges;
+        size_t i = 0;
+        size_t j = 0;
+        while (i < intersection_ranges->size() && j < track_ranges.size()) {
+            auto const& a = intersection_ranges->at(i);
+            auto const& b = track_ranges[j];
+            auto start = max(a.start, b.start);
+            auto end = min(a.end, b.end);
+            if (start < end)
+                new_intersection_ranges.append({ start, end });
+            if (a.end < b.end)
+                i++;
+            else
+                j++;
+        }
+        intersection_ranges = move(new_intersection_ranges);
+    }
+
+    // 5. If intersection ranges does not contain the exact same range information as the current value of this
+    //    attribute, then update the current value of this attribute to intersection ranges.
+    // 6. Return the current value of this attribute.
+    auto time_ranges = realm.create<HTML::TimeRanges>(realm);
+    if (intersection_ranges.has_value()) {
+        for (auto const& range : *intersection_ranges)
+            time_ranges->add_range(range.start.to_nanoseconds() / 1e9, range.end.to_nanoseconds() / 1e9);
+    }
+    return time_ranges;
+}
+
+// https://w3c.github.io/media-source/#dom-sourcebuffer-appendbuffer
+WebIDL::ExceptionOr<void> SourceBuffer::append_buffer(GC::Root<WebIDL::BufferSource> const& data)
+{
+    // 1. Run the prepare append algorithm.
+    TRY(prepare_append());
+
+    // 2. Add data to the end of the [[input buffer]].
+    auto bytes = WebIDL::get_buffer_source_copy(*data->raw_object());
+    if (bytes.is_error() || m_pending_append.try_append(bytes.value()).is_error())
+        return WebIDL::QuotaExceededError::create(realm(), "Unable to allocate memory for the appended data"_string);
+
+    // 3. Set the updating attribute to true.
+    m_updating = true;
+
+    // 4. Queue a task to fire an event named updatestart at this SourceBuffer object.
+    queue_event(EventNames::updatestart);
+
+    // 5. Asynchronously run the buffer append algorithm.
+    HTML::queue_a_task(HTML::Task::Source::Unspecified, nullptr, nullptr, GC::create_function(heap(), [this] {
+        run_buffer_append();
+    }));
+    return {};
+}
+
+// https://w3c.github.io/media-source/#sourcebuffer-prepare-append
+WebIDL::ExceptionOr<void> SourceBuffer::prepare_append()
+{
+    // FIXME: 1. If the SourceBuffer has been removed from the sourceBuffers attribute of the parent media source then
+    //           throw an InvalidStateError exception and abort these steps.
+
+    // 2. If the updating attribute equals true, then throw an InvalidStateError exception and abort these steps.
+    if (m_updating)
+        return WebIDL::InvalidStateError::create(realm(), "SourceBuffer is already updating"_string);
+
+    // FIXME: 3. Let recent element error be determined as follows: ...
+    // FIXME: 5. If the readyState attribute of the parent media source is in the "ended" state then run the following
+    //           steps: ...
+
+    // 6. Run the coded frame eviction algorithm.
+    run_coded_frame_eviction();
+
+    // 7. If the [[buffer full flag]] equals true, then throw a QuotaExceededError exception and abort these steps.
+    if (m_buffer_full_flag)
+        return WebIDL::QuotaExceededError::create(realm(), "SourceBuffer is full"_string);
+
+    return {};
+}
+
+// https://w3c.github.io/media-source/#sourcebuffer-coded-frame-eviction
+void SourceBuffer::run_coded_frame_eviction()
+{
+    // 2. If the [[buffer full flag]] equals false, then abort these steps.
+    if (!m_buffer_full_flag)
+        return;
+
+    // 3. Let removal ranges equal a list of presentation time ranges that can be evicted from the presentation to make
+    //    room for the new data.
+    // NOTE: We evict everything that has already been played, except for the frames that are still needed to decode
+    //       the current playback position, which each track buffer finds for itself.
+    // FIXME: Use the current playback position of the media element, once a MediaSource can be attached to one.
+    auto current_playback_position = AK::Duration::zero();
+
+    // 4. For each range in removal ranges, run the coded frame removal algorithm with start and end equal to the removal
+    //    range start and end timestamp respectively.
+    for (auto& track_buffer : m_track_buffers)
+        track_buffer.value->evict_before(current_playback_position);
+
+    if (buffered_size_in_bytes() < SOURCE_BUFFER_QUOTA)
+        m_buffer_full_flag = false;
+}
+
+// https://w3c.github.io/media-source/#sourcebuffer-buffer-append
+void SourceBuffer::run_buffer_append()
+{
+    // NOTE: The append may have been aborted while this task was queued.
+    if (!m_updating)
+        return;
+
+    // 1. Run the segment parser loop algorithm.
+    auto data = move(m_pending_append);
+    auto result = m_stream_parser.append(data);
+
+    // 2. If the segment parser loop algorithm in the previous step was aborted, then abort this algorithm.
+    if (result.is_error()) {
+        dbgln("SourceBuffer: Failed to parse appended data: {}", result.error().description());
+        run_append_error();
+        return;
+    }
+
+    // 3. Set the updating attribute to false.
+    m_updating = false;
+
+    // 4. Queue a task to fire an event named update at this SourceBuffer object.
+    queue_event(EventNames::update);
+
+    // 5. Queue a task to fire an event named updateend at this SourceBuffer object.
+    queue_event(EventNames::updateend);
+}
+
+// https://w3c.github.io/media-source/#sourcebuffer-append-error
+void SourceBuffer::run_append_error()
+{
+    // 1. Run the reset parser state algorithm.
+    reset_parser_state();
+
+    // 2. Set the updating attribute to false.
+    m_updating = false;
+
+    // 3. Queue a task to fire an event named error at this SourceBuffer object.
+    queue_event(EventNames::error);
+
+    // 4. Queue a task to fire an event named updateend at this SourceBuffer object.
+    queue_event(EventNames::updateend);
+
+    // FIXME: 5. Run the end of stream algorithm with the error parameter set to "decode".
+}
+
+// https://w3c.github.io/media-source/#sourcebuffer-reset-parser-state
+void SourceBuffer::reset_parser_state()
+{
+    // 7. Remove all bytes from the [[input buffer]].
+    m_pending_append.clear();
+    m_stream_parser.reset();
+}
+
+// https://w3c.github.io/media-source/#dom-sourcebuffer-abort
+WebIDL::ExceptionOr<void> SourceBuffer::abort()
+{
+    // FIXME: 1. If this object has been removed from the sourceBuffers attribute of the parent media source then throw
+    //           an InvalidStateError exception and abort these steps.
+    // FIXME: 2. If the readyState attribute of the parent media source is not in the "open" state then throw an
+    //           InvalidStateError exception and abort these steps.
+    // FIXME: 3. If the range removal algorithm is running, then throw an InvalidStateError exception and abort these
+    //           steps.
+
+    // 4. If the updating attribute equals true, then run the following steps:
+    if (m_updating) {
+        // 1. Abort the buffer append algorithm if it is running.
+        // 2. Set the updating attribute to false.
+        m_updating = false;
+
+        // 3. Queue a task to fire an event named abort at this SourceBuffer object.
+        queue_event(EventNames::abort);
+
+        // 4. Queue a task to fire an event named updateend at this SourceBuffer object.
+        queue_event(EventNames::updateend);
+    }
+
+    // 5. Run the reset parser state algorithm.
+    reset_parser_state();
+
+    // FIXME: 6. Set appendWindowStart to the presentation start time.
+    // FIXME: 7. Set appendWindowEnd to positive Infinity.
+    return {};
+}
+
+// https://w3c.github.io/media-source/#dom-sourcebuffer-remove
+WebIDL::ExceptionOr<void> SourceBuffer::remove(double start, double end)
+{
+    // FIXME: 1. If this object has been removed from the sourceBuffers attribute of the parent media source then throw
+    //           an InvalidStateError exception and abort these steps.
+
+    // 2. If the updating attribute equals true, then throw an InvalidStateError exception and abort these steps.
+    if (m_updating)
+        return WebIDL::InvalidStateError::create(realm(), "SourceBuffer is already updating"_string);
+
+    // FIXME: 3. If duration equals NaN, then throw a TypeError exception and abort these steps.
+    // 4. If start is negative or greater than duration, then throw a TypeError exception and abort these steps.
+    // FIXME: Check start against the duration of the parent media source.
+    if (start < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Start must not be negative"sv };
+
+    // 5. If end is less than or equal to start or end equals NaN, then throw a TypeError exception and abort these steps.
+    if (end <= start || isnan(end))
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "End must be greater than start"sv };
+
+    // FIXME: 6. If the readyState attribute of the parent media source is in the "ended" state then run the following
+    //           steps: ...
+
+    // 7. Run the range removal algorithm with start and end as the start and end of the removal range.
+    // https://w3c.github.io/media-source/#dfn-range-removal
+    // 3. Set the updating attribute to true.
+    m_updating = true;
+
+    // 4. Queue a task to fire an event named updatestart at this SourceBuffer object.
+    queue_event(EventNames::updatestart);
+
+    // 5. Return control to the caller and run the rest of the steps asynchronously.
+    HTML::queue_a_task(HTML::Task::Source::Unspecified, nullptr, nullptr, GC::create_function(heap(), [this, start, end] {
+        // 6. Run the coded frame removal algorithm with start and end as the start and end of the removal range.
+        auto removal_end = isinf(end) ? AK::Duration::max() : AK::Duration::from_nanoseconds(static_cast<i64>(end * 1'000'000'000));
+        for (auto& track_buffer : m_track_buffers)
+            track_buffer.value->remove(AK::Duration::from_nanoseconds(static_cast<i64>(start * 1'000'000'000)), removal_end);
+
+        // NOTE: The coded frame removal algorithm sets the [[buffer full flag]] to false once there is room again.
+        if (buffered_size_in_bytes() < SOURCE_BUFFER_QUOTA)
+            m_buffer_full_flag = false;
+
+        // 7. Set the updating attribute to false.
+        m_updating = false;
+
+        // 8. Queue a task to fire an event named update at this SourceBuffer object.
+        queue_event(EventNames::update);
+
+        // 9. Queue a task to fire an event named updateend at this SourceBuffer object.
+        queue_event(EventNames::updateend);
+    }));
+    return {};
+}
+
 }
@@ -6,7 +6,11 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
+#include <LibMedia/Containers/Matroska/Reader.h>
+#include <LibMedia/TrackBuffer.h>
 #include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/WebIDL/Buffers.h>
 
 namespace Web::MediaSourceExtensions {
 
@@ -31,6 +35,15 @@ public:
     void set_onabort(GC::Ptr<WebIDL::CallbackType>);
     GC::Ptr<WebIDL::CallbackType> onabort();
 
+    // https://w3c.github.io/media-source/#dom-sourcebuffer-updating
+    bool updating() const { return m_updating; }
+
+    GC::Ref<HTML::TimeRanges> buffered() const;
+
+    WebIDL::ExceptionOr<void> append_buffer(GC::Root<WebIDL::BufferSource> const&);
+    WebIDL::ExceptionOr<void> abort();
+    WebIDL::ExceptionOr<void> remove(double start, double end);
+
 protected:
     SourceBuffer(JS::Realm&);
 
@@ -39,6 +52,26 @@ protected:
     virtual void initialize(JS::Realm&) override;
 
 private:
+    WebIDL::ExceptionOr<void> prepare_append();
+    void run_coded_frame_eviction();
+    void run_buffer_append();
+    void run_append_error();
+    void reset_parser_state();
+    void queue_event(FlyString const& name);
+
+    size_t buffered_size_in_bytes() const;
+
+    bool m_updating { false };
+
+    // https://w3c.github.io/media-source/#dfn-buffer-full-flag
+    bool m_buffer_full_flag { false };
+
+    // NOTE: Rather than keeping an input buffer of its own, the parser only holds on to the data of the element it is
+    //       in the middle of. Coded frames are moved straight into the track buffers as they are parsed, and
+    //       m_pending_append only holds the appended data until the buffer append task gets to run.
+    Media::Matroska::IncrementalReader m_stream_parser;
+    ByteBuffer m_pending_append;
+    HashMap<u64, NonnullOwnPtr<Media::TrackBuffer>> m_track_buffers;
 };
 
 }
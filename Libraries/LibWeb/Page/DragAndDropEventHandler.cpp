@@ -95,12 +95,17 @@ EventResult DragAndDropEventHandler::handle_drag_start(
     //        The file's contents and name.
     for (auto& file : files) {
         auto contents = file.take_contents();
-        auto mime_type = MimeSniff::Resource::sniff(contents);
+        if (contents.is_error()) {
+            dbgln("Unable to read dragged file '{}': {}", file.name(), contents.error());
+            continue;
+        }
+
+        auto mime_type = MimeSniff::Resource::sniff(contents.value());
 
         m_drag_data_store->add_item({
             .kind = HTML::DragDataStoreItem::Kind::File,
             .type_string = mime_type.essence(),
-            .data = move(contents),
+            .data = contents.release_value(),
             .file_name = file.name(),
         });
     }
@@ -97,6 +97,17 @@ void Page::traverse_the_history_by_delta(int delta)
     top_level_traversable()->traverse_the_history_by_delta(delta);
 }
 
+void Page::set_is_frozen(bool frozen)
+{
+    if (m_is_frozen == frozen)
+        return;
+    m_is_frozen = frozen;
+
+    // NOTE: Tasks that were held back while we were frozen are runnable again, so make sure the event loop gets to them.
+    if (!m_is_frozen)
+        HTML::main_thread_event_loop().schedule();
+}
+
 Gfx::Palette Page::palette() const
 {
     return m_client->palette();
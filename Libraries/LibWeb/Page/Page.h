@@ -33,10 +33,13 @@
 #include <LibWeb/HTML/SelectItem.h>
 #include <LibWeb/HTML/TokenizedFeatures.h>
 #include <LibWeb/HTML/WebViewHints.h>
+#include <LibWeb/IndexedDB/Internal/PersistentStorage.h>
 #include <LibWeb/Loader/FileRequest.h>
 #include <LibWeb/Page/EventResult.h>
 #include <LibWeb/Page/InputEvent.h>
 #include <LibWeb/PixelUnits.h>
+#include <LibWeb/StorageAPI/StorageChange.h>
+#include <LibWeb/StorageAPI/StorageEstimate.h>
 #include <LibWeb/UIEvents/KeyCode.h>
 
 namespace Web {
@@ -110,6 +113,11 @@ public:
     bool is_scripting_enabled() const { return m_is_scripting_enabled; }
     void set_is_scripting_enabled(bool b) { m_is_scripting_enabled = b; }
 
+    // While a page is frozen (e.g. because it has been in a background tab for a while), the tasks of its documents,
+    // including timers, are held back until it is unfrozen.
+    bool is_frozen() const { return m_is_frozen; }
+    void set_is_frozen(bool);
+
     bool should_block_pop_ups() const { return m_should_block_pop_ups; }
     void set_should_block_pop_ups(bool b) { m_should_block_pop_ups = b; }
 
@@ -223,6 +231,11 @@ public:
     bool listen_for_dom_mutations() const { return m_listen_for_dom_mutations; }
     void set_listen_for_dom_mutations(bool listen_for_dom_mutations) { m_listen_for_dom_mutations = listen_for_dom_mutations; }
 
+    // Incremented whenever layout, paint-only properties (such as transforms) or scroll offsets may have changed in
+    // any document of this page, so that observers of box geometry can tell whether anything has moved.
+    u64 geometry_generation() const { return m_geometry_generation; }
+    void did_change_geometry() { ++m_geometry_generation; }
+
 private:
     explicit Page(GC::Ref<PageClient>);
     virtual void visit_edges(Visitor&) override;
@@ -251,6 +264,8 @@ private:
 
     bool m_is_scripting_enabled { true };
 
+    bool m_is_frozen { false };
+
     bool m_should_block_pop_ups { true };
 
     // https://w3c.github.io/webdriver/#dfn-webdriver-active-flag
@@ -297,6 +312,8 @@ private:
     URL::URL m_last_find_in_page_url;
 
     bool m_listen_for_dom_mutations { false };
+
+    u64 m_geometry_generation { 0 };
 };
 
 struct PaintOptions {
@@ -375,6 +392,12 @@ public:
     virtual void page_did_set_cookie(URL::URL const&, Cookie::ParsedCookie const&, Cookie::Source) { }
     virtual void page_did_update_cookie(Web::Cookie::Cookie const&) { }
     virtual void page_did_expire_cookies_with_time_offset(AK::Duration) { }
+    virtual Optional<IndexedDB::PersistedDatabase> page_did_request_indexed_db_database(String const&, String const&) { return {}; }
+    virtual bool page_did_update_indexed_db_database(String const&, String const&, IndexedDB::PersistedDatabase const&, Vector<String> const&) { return true; }
+    virtual void page_did_delete_indexed_db_database(String const&, String const&) { }
+    virtual OrderedHashMap<String, String> page_did_request_local_storage(String const&) { return {}; }
+    virtual void page_did_change_local_storage(String const&, Vector<StorageAPI::StorageChange> const&) { }
+    virtual Optional<StorageAPI::StorageEstimate> page_did_request_storage_estimate(String const&) { return {}; }
     virtual void page_did_update_resource_count(i32) { }
     struct NewWebViewResult {
         GC::Ptr<Page> page;
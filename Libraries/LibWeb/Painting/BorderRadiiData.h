@@ -19,6 +19,8 @@ struct CornerRadius {
     {
         return horizontal_radius > 0 && vertical_radius > 0;
     }
+
+    bool operator==(CornerRadius const&) const = default;
 };
 
 struct BorderRadiusData {
@@ -57,6 +59,8 @@ struct CornerRadii {
     {
         return top_left || top_right || bottom_right || bottom_left;
     }
+
+    bool operator==(CornerRadii const&) const = default;
 };
 
 struct BorderRadiiData {
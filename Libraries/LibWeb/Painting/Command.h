@@ -130,6 +130,8 @@ struct PushStackingContext {
     // A translation to be applied after the stacking context has been transformed.
     StackingContextTransform transform;
     Optional<Gfx::Path> clip_path = {};
+    // If set, the opacity and transform above are replaced by the compositor layer's state at playback time.
+    Optional<size_t> compositor_layer_id = {};
 
     void translate_by(Gfx::IntPoint const& offset)
     {
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/Animations/Animation.h>
+#include <LibWeb/Animations/DocumentTimeline.h>
+#include <LibWeb/Animations/KeyframeEffect.h>
+#include <LibWeb/CSS/StyleValues/NumberStyleValue.h>
+#include <LibWeb/CSS/StyleValues/PercentageStyleValue.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/Painting/CompositorLayerState.h>
+#include <LibWeb/Painting/PaintableBox.h>
+#include <LibWeb/Painting/StackingContext.h>
+
+namespace Web::Painting {
+
+static Optional<float> opacity_from_keyframe_value(Animations::KeyframeEffect::KeyFrameSet::ResolvedKeyFrame const& keyframe)
+{
+    auto property = keyframe.properties.get(CSS::PropertyID::Opacity);
+    if (!property.has_value() || !property->has<NonnullRefPtr<CSS::CSSStyleValue const>>())
+        return {};
+    auto const& value = property->get<NonnullRefPtr<CSS::CSSStyleValue const>>();
+    if (value->is_number())
+        return static_cast<float>(value->as_number().number());
+    if (value->is_percentage())
+        return static_cast<float>(value->as_percentage().percentage().as_fraction());
+    return {};
+}
+
+// Only the simplest, and by far most common, kind of opacity animation is handed to the rendering thread: a single
+// running animation with a finite, non-zero iteration duration, whose keyframes all have plain opacity values.
+// Everything else keeps using the value computed on the main thread.
+static Optional<CompositorOpacityAnimation> opacity_animation_for_layer(PaintableBox const& paintable_box)
+{
+    auto const* element = as_if<DOM::Element>(paintable_box.dom_node().ptr());
+    if (!element)
+        return {};
+
+    GC::Ptr<Animations::KeyframeEffect> opacity_effect;
+    for (auto const& animation : element->associated_animations()) {
+        auto effect = animation->effect();
+        if (!effect || !effect->is_keyframe_effect() || !effect->target_properties().contains(CSS::PropertyID::Opacity))
+            continue;
+        if (!animation->is_relevant())
+            continue;
+        // Several animations of the same property would have to be composited, so leave that to the main thread.
+        if (opacity_effect)
+            return {};
+        opacity_effect = static_cast<Animations::KeyframeEffect&>(*effect);
+    }
+    if (!opacity_effect)
+        return {};
+
+    auto& animation = *opacity_effect->associated_animation();
+    if (animation.play_state() != Bindings::AnimationPlayState::Running || animation.pending())
+        return {};
+    if (!animation.timeline() || !is<Animations::DocumentTimeline>(*animation.timeline()))
+        return {};
+    if (opacity_effect->pseudo_element_type().has_value() || opacity_effect->composite() != Bindings::CompositeOperation::Replace)
+        return {};
+    if (!opacity_effect->is_in_the_active_phase())
+        return {};
+
+    auto local_time = opacity_effect->local_time();
+    auto const& iteration_duration = opacity_effect->iteration_duration();
+    if (!local_time.has_value() || !iteration_duration.has<double>() || iteration_duration.get<double>() <= 0.0)
+        return {};
+
+    auto const* key_frame_set = opacity_effect->key_frame_set();
+    if (!key_frame_set || key_frame_set->keyframes_by_key.size() < 2)
+        return {};
+
+    Vector<CompositorOpacityAnimation::Keyframe> keyframes;
+    keyframes.ensure_capacity(key_frame_set->keyframes_by_key.size());
+    for (auto it = key_frame_set->keyframes_by_key.begin(); it != key_frame_set->keyframes_by_key.end(); ++it) {
+        auto opacity = opacity_from_keyframe_value(*it);
+        if (!opacity.has_value())
+            return {};
+        auto offset = static_cast<double>(it.key()) / (100.0 * Animations::KeyframeEffect::AnimationKeyFrameKeyScaleFactor);
+        keyframes.unchecked_append({ offset, *opacity });
+    }
+
+    return CompositorOpacityAnimation {
+        .snapshot_time = MonotonicTime::now(),
+        .local_time_at_snapshot = *local_time,
+        .playback_rate = animation.playback_rate(),
+        .start_delay = opacity_effect->start_delay(),
+        .iteration_duration = iteration_duration.get<double>(),
+        .iteration_count = opacity_effect->iteration_count(),
+        .iteration_start = opacity_effect->iteration_start(),
+        .playback_direction = opacity_effect->playback_direction(),
+        .timing_function = opacity_effect->timing_function(),
+        .keyframes = move(keyframes),
+    };
+}
+
+// This follows the timing model of AnimationEffect and the keyframe interpolation of StyleComputer, restricted to the
+// active phase.
+Optional<float> CompositorOpacityAnimation::sample_at(MonotonicTime time) const
+{
+    auto elapsed_time = static_cast<double>((time - snapshot_time).to_nanoseconds()) / 1'000'000.0;
+    auto local_time = local_time_at_snapshot + elapsed_time * playback_rate;
+
+    // https://www.w3.org/TR/web-animations-1/#calculating-the-active-time
+    auto active_time = local_time - start_delay;
+    auto active_duration = iteration_duration * iteration_count;
+    if (active_time < 0.0 || active_time >= active_duration)
+        return {};
+
+    // https://www.w3.org/TR/web-animations-1/#calculating-the-overall-progress
+    auto overall_progress = active_time / iteration_duration + iteration_start;
+
+    // https://www.w3.org/TR/web-animations-1/#calculating-the-simple-iteration-progress
+    auto simple_iteration_progress = fmod(overall_progress, 1.0);
+
+    // https://www.w3.org/TR/web-animations-1/#calculating-the-directed-progress
+    auto current_iteration = floor(overall_progress);
+    bool going_forwards = true;
+    if (playback_direction == Bindings::PlaybackDirection::Reverse) {
+        going_forwards = false;
+    } else if (playback_direction == Bindings::PlaybackDirection::Alternate || playback_direction == Bindings::PlaybackDirection::AlternateReverse) {
+        if (playback_direction == Bindings::PlaybackDirection::AlternateReverse)
+            current_iteration += 1.0;
+        going_forwards = fmod(current_iteration, 2.0) == 0.0;
+    }
+    auto directed_progress = going_forwards ? simple_iteration_progress : 1.0 - simple_iteration_progress;
+
+    // https://www.w3.org/TR/web-animations-1/#calculating-the-transformed-progress
+    // NOTE: The before flag is never set in the active phase.
+    auto transformed_progress = timing_function.evaluate_at(directed_progress, false);
+
+    // Find the keyframes surrounding the progress, extrapolating from the first or last pair if the timing function
+    // takes it outside of [0, 1].
+    size_t end_index = 1;
+    while (end_index < keyframes.size() - 1 && keyframes[end_index].offset <= transformed_progress)
+        ++end_index;
+    auto const& start = keyframes[end_index - 1];
+    auto const& end = keyframes[end_index];
+
+    if (end.offset == start.offset)
+        return clamp(end.opacity, 0.0f, 1.0f);
+    auto progress_in_keyframe = static_cast<float>((transformed_progress - start.offset) / (end.offset - start.offset));
+    return clamp(start.opacity + (end.opacity - start.opacity) * progress_in_keyframe, 0.0f, 1.0f);
+}
+
+CompositorLayerStateSnapshot CompositorLayerStateSnapshot::create(ReadonlySpan<GC::Ref<PaintableBox const>> layers, float device_pixels_per_css_pixel)
+{
+    CompositorLayerStateSnapshot snapshot;
+    snapshot.m_entries.ensure_capacity(layers.size());
+    for (auto const& paintable_box : layers) {
+        auto opacity_animation = opacity_animation_for_layer(paintable_box);
+        if (opacity_animation.has_value())
+            snapshot.m_has_animations = true;
+        snapshot.m_entries.append({
+            .opacity = paintable_box->computed_values().opacity(),
+            .transform_matrix = StackingContext::transform_matrix_in_device_pixels(paintable_box, device_pixels_per_css_pixel),
+            .opacity_animation = move(opacity_animation),
+        });
+    }
+    return snapshot;
+}
+
+void CompositorLayerStateSnapshot::sample_animations_at(MonotonicTime time)
+{
+    if (!m_has_animations)
+        return;
+    for (auto& entry : m_entries) {
+        if (!entry.opacity_animation.has_value())
+            continue;
+        if (auto opacity = entry.opacity_animation->sample_at(time); opacity.has_value())
+            entry.opacity = *opacity;
+    }
+}
+
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibGC/Ptr.h>
+#include <LibGfx/Matrix4x4.h>
+#include <LibWeb/Bindings/AnimationEffectPrototype.h>
+#include <LibWeb/CSS/StyleValues/EasingStyleValue.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::Painting {
+
+// A running opacity animation or transition of a compositor layer, with everything needed to sample it away from the
+// main thread. The rendering thread samples it at the time a frame is rasterized, rather than using the value the
+// main thread computed when it recorded the frame.
+struct CompositorOpacityAnimation {
+    struct Keyframe {
+        double offset { 0 };
+        float opacity { 1 };
+    };
+
+    MonotonicTime snapshot_time;
+    double local_time_at_snapshot { 0 };
+    double playback_rate { 1 };
+
+    double start_delay { 0 };
+    double iteration_duration { 0 };
+    double iteration_count { 1 };
+    double iteration_start { 0 };
+    Bindings::PlaybackDirection playback_direction { Bindings::PlaybackDirection::Normal };
+    CSS::EasingStyleValue::Function timing_function { CSS::EasingStyleValue::Linear::identity() };
+
+    // Sorted by offset, with at least two keyframes.
+    Vector<Keyframe> keyframes;
+
+    // Returns the animated opacity at the given time, or an empty Optional once the animation has left its active
+    // interval, in which case the value computed by the main thread is used.
+    Optional<float> sample_at(MonotonicTime) const;
+};
+
+// The opacity and transform of every stacking context that was promoted to a compositor layer while recording a
+// display list. Like scroll offsets, these are applied when the display list is played back, so animating them
+// doesn't require recording a new display list.
+class CompositorLayerStateSnapshot {
+public:
+    static CompositorLayerStateSnapshot create(ReadonlySpan<GC::Ref<PaintableBox const>> layers, float device_pixels_per_css_pixel);
+
+    struct Entry {
+        float opacity { 1 };
+        Gfx::FloatMatrix4x4 transform_matrix;
+        Optional<CompositorOpacityAnimation> opacity_animation;
+    };
+
+    Entry const* entry_for_layer_with_id(size_t id) const
+    {
+        if (id >= m_entries.size())
+            return nullptr;
+        return &m_entries[id];
+    }
+
+    bool has_animations() const { return m_has_animations; }
+    void sample_animations_at(MonotonicTime);
+
+private:
+    Vector<Entry> m_entries;
+    bool m_has_animations { false };
+};
+
+}
@@ -8,8 +8,58 @@
 
 namespace Web::Painting {
 
+static bool command_only_changes_painter_state(Command const& command)
+{
+    return command.has<AddClipRect>() || command.has<AddRoundedRectClip>() || command.has<Translate>();
+}
+
+static bool fill_rects_can_be_merged(Gfx::IntRect const& a, Gfx::IntRect const& b)
+{
+    if (a.top() == b.top() && a.bottom() == b.bottom())
+        return a.right() == b.left() || b.right() == a.left();
+    if (a.left() == b.left() && a.right() == b.right())
+        return a.bottom() == b.top() || b.bottom() == a.top();
+    return false;
+}
+
 void DisplayList::append(Command&& command, Optional<i32> scroll_frame_id)
 {
+    // OPTIMIZATION: A save/restore pair that only changes clip or translation in between doesn't paint anything,
+    //               so drop it along with everything it encloses.
+    if (command.has<Restore>()) {
+        auto index = m_commands.size();
+        while (index > m_optimization_barrier && command_only_changes_painter_state(m_commands[index - 1].command))
+            --index;
+        if (index > m_optimization_barrier && m_commands[index - 1].command.has<Save>()) {
+            while (m_commands.size() >= index)
+                (void)m_commands.take_last();
+            return;
+        }
+    }
+
+    if (m_commands.size() > m_optimization_barrier) {
+        auto& last = m_commands[m_commands.size() - 1];
+        if (last.scroll_frame_id == scroll_frame_id) {
+            // OPTIMIZATION: Consecutive clip rects are equivalent to a single clip by their intersection.
+            if (command.has<AddClipRect>() && last.command.has<AddClipRect>()) {
+                auto& last_clip_rect = last.command.get<AddClipRect>().rect;
+                last_clip_rect.intersect(command.get<AddClipRect>().rect);
+                return;
+            }
+
+            // OPTIMIZATION: Fill adjacent rects of the same color with a single draw. The rects don't overlap,
+            //               so this is also correct for translucent colors.
+            if (command.has<FillRect>() && last.command.has<FillRect>()) {
+                auto& last_fill_rect = last.command.get<FillRect>();
+                auto const& fill_rect = command.get<FillRect>();
+                if (last_fill_rect.color == fill_rect.color && fill_rects_can_be_merged(last_fill_rect.rect, fill_rect.rect)) {
+                    last_fill_rect.rect.unite(fill_rect.rect);
+                    return;
+                }
+            }
+        }
+    }
+
     m_commands.append({ scroll_frame_id, move(command) });
 }
 
@@ -35,18 +85,18 @@ static bool command_is_clip_or_mask(Command const& command)
         });
 }
 
-void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface)
+void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface, Optional<Gfx::IntRect> damage_rect, CompositorLayerStateSnapshot const& compositor_layer_state)
 {
     if (surface) {
         surface->lock_context();
     }
-    execute_impl(display_list, scroll_state, surface);
+    execute_impl(display_list, scroll_state, surface, damage_rect, compositor_layer_state);
     if (surface) {
         surface->unlock_context();
     }
 }
 
-void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface)
+void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface> surface, Optional<Gfx::IntRect> damage_rect, CompositorLayerStateSnapshot const& compositor_layer_state)
 {
     if (surface)
         m_surfaces.append(*surface);
@@ -60,26 +110,57 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
 
     VERIFY(!m_surfaces.is_empty());
 
+    // NOTE: Clipping to the damage rect also lets us skip every command that lies entirely outside of it,
+    //       as those are considered fully clipped by the painter.
+    if (damage_rect.has_value()) {
+        save({});
+        add_clip_rect({ *damage_rect });
+    }
+
     for (size_t command_index = 0; command_index < commands.size(); command_index++) {
-        auto scroll_frame_id = commands[command_index].scroll_frame_id;
-        auto command = commands[command_index].command;
+        auto const& item = commands[command_index];
+        auto scroll_frame_id = item.scroll_frame_id;
+
+        Gfx::IntPoint scroll_offset;
+        if (scroll_frame_id.has_value()) {
+            auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(scroll_frame_id.value());
+            scroll_offset = cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
+        }
 
-        if (command.has<PaintScrollBar>()) {
-            auto& paint_scroll_bar = command.get<PaintScrollBar>();
-            auto scroll_offset = scroll_state.own_offset_for_frame_with_id(paint_scroll_bar.scroll_frame_id);
+        // OPTIMIZATION: Only copy the commands that have to be adjusted for the current scroll and compositor layer
+        //               state. Copying every command would allocate for each path, dash array and gradient on every frame.
+        bool needs_adjustment = !scroll_offset.is_zero()
+            || item.command.has<PaintScrollBar>()
+            || (item.command.has<PushStackingContext>() && item.command.get<PushStackingContext>().compositor_layer_id.has_value());
+        Optional<Command> adjusted_command;
+        if (needs_adjustment)
+            adjusted_command = item.command;
+        Command const& command = adjusted_command.has_value() ? adjusted_command.value() : item.command;
+
+        if (adjusted_command.has_value() && adjusted_command->has<PaintScrollBar>()) {
+            auto& paint_scroll_bar = adjusted_command->get<PaintScrollBar>();
+            auto own_scroll_offset = scroll_state.own_offset_for_frame_with_id(paint_scroll_bar.scroll_frame_id);
             if (paint_scroll_bar.vertical) {
-                auto offset = scroll_offset.y() * paint_scroll_bar.scroll_size;
+                auto offset = own_scroll_offset.y() * paint_scroll_bar.scroll_size;
                 paint_scroll_bar.thumb_rect.translate_by(0, -offset.to_int() * device_pixels_per_css_pixel);
             } else {
-                auto offset = scroll_offset.x() * paint_scroll_bar.scroll_size;
+                auto offset = own_scroll_offset.x() * paint_scroll_bar.scroll_size;
                 paint_scroll_bar.thumb_rect.translate_by(-offset.to_int() * device_pixels_per_css_pixel, 0);
             }
         }
 
-        if (scroll_frame_id.has_value()) {
-            auto cumulative_offset = scroll_state.cumulative_offset_for_frame_with_id(scroll_frame_id.value());
-            auto scroll_offset = cumulative_offset.to_type<double>().scaled(device_pixels_per_css_pixel).to_type<int>();
-            command.visit(
+        if (adjusted_command.has_value() && adjusted_command->has<PushStackingContext>()) {
+            auto& push_stacking_context = adjusted_command->get<PushStackingContext>();
+            if (push_stacking_context.compositor_layer_id.has_value()) {
+                if (auto const* layer_state = compositor_layer_state.entry_for_layer_with_id(*push_stacking_context.compositor_layer_id)) {
+                    push_stacking_context.opacity = layer_state->opacity;
+                    push_stacking_context.transform.matrix = layer_state->transform_matrix;
+                }
+            }
+        }
+
+        if (adjusted_command.has_value() && !scroll_offset.is_zero()) {
+            adjusted_command->visit(
                 [&](auto& command) {
                     if constexpr (requires { command.translate_by(scroll_offset); }) {
                         command.translate_by(scroll_offset);
@@ -149,6 +230,9 @@ void DisplayListPlayer::execute_impl(DisplayList& display_list, ScrollStateSnaps
         // clang-format on
     }
 
+    if (damage_rect.has_value())
+        restore({});
+
     if (surface)
         flush();
 }
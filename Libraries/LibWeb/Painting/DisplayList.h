@@ -16,6 +16,7 @@
 #include <LibGfx/PaintStyle.h>
 #include <LibWeb/CSS/Enums.h>
 #include <LibWeb/Painting/Command.h>
+#include <LibWeb/Painting/CompositorLayerState.h>
 #include <LibWeb/Painting/ScrollState.h>
 
 namespace Web::Painting {
@@ -26,11 +27,12 @@ class DisplayListPlayer {
 public:
     virtual ~DisplayListPlayer() = default;
 
-    void execute(DisplayList&, ScrollStateSnapshot const&, RefPtr<Gfx::PaintingSurface>);
+    // If a damage rect is given, only the pixels within it are painted and the rest of the surface is left untouched.
+    void execute(DisplayList&, ScrollStateSnapshot const&, RefPtr<Gfx::PaintingSurface>, Optional<Gfx::IntRect> damage_rect = {}, CompositorLayerStateSnapshot const& = {});
 
 protected:
     Gfx::PaintingSurface& surface() const { return m_surfaces.last(); }
-    void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>);
+    void execute_impl(DisplayList&, ScrollStateSnapshot const& scroll_state, RefPtr<Gfx::PaintingSurface>, Optional<Gfx::IntRect> damage_rect = {}, CompositorLayerStateSnapshot const& = {});
 
 private:
     virtual void flush() = 0;
@@ -93,6 +95,10 @@ public:
 
     AK::SegmentedVector<CommandListItem, 512> const& commands() const { return m_commands; }
 
+    // Commands appended so far are no longer changed by the optimizations done in append(), so that they can be
+    // copied out as a self-contained range once the commands that follow have been appended.
+    void mark_optimization_barrier() { m_optimization_barrier = m_commands.size(); }
+
     void set_device_pixels_per_css_pixel(double device_pixels_per_css_pixel) { m_device_pixels_per_css_pixel = device_pixels_per_css_pixel; }
     double device_pixels_per_css_pixel() const { return m_device_pixels_per_css_pixel; }
 
@@ -100,6 +106,7 @@ private:
     DisplayList() = default;
 
     AK::SegmentedVector<CommandListItem, 512> m_commands;
+    size_t m_optimization_barrier { 0 };
     double m_device_pixels_per_css_pixel;
 };
 
@@ -14,6 +14,7 @@
 #include <core/SkPathEffect.h>
 #include <core/SkRRect.h>
 #include <core/SkSurface.h>
+#include <core/SkTextBlob.h>
 #include <effects/SkDashPathEffect.h>
 #include <effects/SkGradientShader.h>
 #include <effects/SkImageFilters.h>
@@ -68,46 +69,77 @@ static SkMatrix to_skia_matrix(Gfx::AffineTransform const& affine_transform)
     return matrix;
 }
 
+// Shadows that haven't been painted by this many playbacks are dropped from the cache.
+static constexpr u64 max_unused_playbacks_of_cached_shadow = 60;
+static constexpr size_t max_cached_outer_box_shadows = 256;
+static constexpr int max_cached_outer_box_shadow_area = 1024 * 1024;
+
 void DisplayListPlayerSkia::flush()
 {
     if (m_context)
         m_context->flush_and_submit(&surface().sk_surface());
     surface().flush();
+
+    ++m_playback_count;
+    m_outer_box_shadow_cache.remove_all_matching([&](auto const&, auto const& cached_shadow) {
+        return m_playback_count - cached_shadow.last_used_playback > max_unused_playbacks_of_cached_shadow;
+    });
+    m_text_blob_cache.remove_all_matching([&](auto const&, auto const& cached_text_blob) {
+        return m_playback_count - cached_text_blob.last_used_playback > max_unused_playbacks_of_cached_text_blob;
+    });
 }
 
-void DisplayListPlayerSkia::draw_glyph_run(DrawGlyphRun const& command)
+// Text blobs that haven't been drawn by this many playbacks are dropped from the cache.
+static constexpr u64 max_unused_playbacks_of_cached_text_blob = 60;
+static constexpr size_t max_cached_text_blobs = 4096;
+
+static sk_sp<SkTextBlob> make_text_blob(Gfx::GlyphRun const& glyph_run, double scale)
 {
-    auto const& gfx_font = command.glyph_run->font();
-    auto sk_font = gfx_font.skia_font(command.scale);
-
-    auto glyph_count = command.glyph_run->glyphs().size();
-    Vector<SkGlyphID> glyphs;
-    glyphs.ensure_capacity(glyph_count);
-    Vector<SkPoint> positions;
-    positions.ensure_capacity(glyph_count);
+    auto const& gfx_font = glyph_run.font();
+    auto sk_font = gfx_font.skia_font(scale);
     auto font_ascent = gfx_font.pixel_metrics().ascent;
-    for (auto const& glyph : command.glyph_run->glyphs()) {
-        auto transformed_glyph = glyph;
-        transformed_glyph.position.set_y(glyph.position.y() + font_ascent);
-        transformed_glyph.position = transformed_glyph.position.scaled(command.scale);
-        auto const& point = transformed_glyph.position;
-        glyphs.append(transformed_glyph.glyph_id);
-        positions.append(to_skia_point(point));
+
+    SkTextBlobBuilder builder;
+    auto const& run = builder.allocRunPos(sk_font, glyph_run.glyphs().size());
+    for (size_t i = 0; i < glyph_run.glyphs().size(); ++i) {
+        auto const& glyph = glyph_run.glyphs()[i];
+        run.glyphs[i] = glyph.glyph_id;
+        run.points()[i] = to_skia_point(Gfx::FloatPoint { glyph.position.x(), glyph.position.y() + font_ascent }.scaled(scale));
+    }
+    return builder.make();
+}
+
+void DisplayListPlayerSkia::draw_glyph_run(DrawGlyphRun const& command)
+{
+    if (command.glyph_run->is_empty())
+        return;
+
+    // NOTE: Skia keeps the glyphs it rasterized for a text blob in its glyph atlas for as long as the blob is drawn, so
+    //       glyph runs that are painted over and over (which is most text on most pages) reuse one blob across playbacks.
+    sk_sp<SkTextBlob> text_blob;
+    if (auto it = m_text_blob_cache.find(command.glyph_run.ptr()); it != m_text_blob_cache.end() && it->value.scale == command.scale) {
+        it->value.last_used_playback = m_playback_count;
+        text_blob = it->value.text_blob;
+    } else {
+        text_blob = make_text_blob(*command.glyph_run, command.scale);
+        if (m_text_blob_cache.size() < max_cached_text_blobs || it != m_text_blob_cache.end())
+            m_text_blob_cache.set(command.glyph_run.ptr(), { command.glyph_run, command.scale, text_blob, m_playback_count });
     }
 
     SkPaint paint;
     paint.setColor(to_skia_color(command.color));
 
     auto& canvas = surface().canvas();
+    auto translation = to_skia_point(command.translation);
     switch (command.orientation) {
     case Gfx::Orientation::Horizontal:
-        canvas.drawGlyphs(glyphs.size(), glyphs.data(), positions.data(), to_skia_point(command.translation), sk_font, paint);
+        canvas.drawTextBlob(text_blob, translation.x(), translation.y(), paint);
         break;
     case Gfx::Orientation::Vertical:
         canvas.save();
         canvas.translate(command.rect.width(), 0);
         canvas.rotate(90, command.rect.top_left().x(), command.rect.top_left().y());
-        canvas.drawGlyphs(glyphs.size(), glyphs.data(), positions.data(), to_skia_point(command.translation), sk_font, paint);
+        canvas.drawTextBlob(text_blob, translation.x(), translation.y(), paint);
         canvas.restore();
         break;
     }
@@ -475,16 +507,63 @@ void DisplayListPlayerSkia::paint_outer_box_shadow(PaintOuterBoxShadow const& co
     add_spread_distance_to_corner_radius(corner_radii.bottom_right);
     add_spread_distance_to_corner_radius(corner_radii.bottom_left);
 
+    auto paint_shadow = [&](SkCanvas& canvas) {
+        canvas.save();
+        canvas.clipRRect(content_rrect, SkClipOp::kDifference, true);
+        SkPaint paint;
+        paint.setAntiAlias(true);
+        paint.setColor(to_skia_color(color));
+        paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, blur_radius / 2));
+        auto shadow_rounded_rect = to_skia_rrect(shadow_rect, corner_radii);
+        canvas.drawRRect(shadow_rounded_rect, paint);
+        canvas.restore();
+    };
+
     auto& canvas = surface().canvas();
-    canvas.save();
-    canvas.clipRRect(content_rrect, SkClipOp::kDifference, true);
-    SkPaint paint;
-    paint.setAntiAlias(true);
-    paint.setColor(to_skia_color(color));
-    paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, blur_radius / 2));
-    auto shadow_rounded_rect = to_skia_rrect(shadow_rect, corner_radii);
-    canvas.drawRRect(shadow_rounded_rect, paint);
-    canvas.restore();
+
+    // OPTIMIZATION: Blurring is expensive, so keep the shadows of blurred boxes around and draw them again as an image
+    //               for as long as they keep being painted. This only matches painting them directly if the image
+    //               maps onto whole device pixels, i.e. if we're only translating by an integer amount.
+    auto const& matrix = canvas.getTotalMatrix();
+    bool can_use_cached_shadow = blur_radius > 0
+        && matrix.isTranslate()
+        && matrix.getTranslateX() == roundf(matrix.getTranslateX())
+        && matrix.getTranslateY() == roundf(matrix.getTranslateY());
+
+    // NOTE: A blur mask filter with sigma s extends about 3s past the shape, and ours uses s = blur_radius / 2.
+    auto image_rect = shadow_rect.inflated(blur_radius * 4, blur_radius * 4);
+    if (!can_use_cached_shadow || image_rect.is_empty() || image_rect.width() * image_rect.height() > max_cached_outer_box_shadow_area) {
+        paint_shadow(canvas);
+        return;
+    }
+
+    OuterBoxShadowCacheKey key {
+        .content_size = outer_box_shadow_params.device_content_rect.size(),
+        .corner_radii = outer_box_shadow_params.corner_radii,
+        .color = color,
+        .offset_x = offset_x,
+        .offset_y = offset_y,
+        .blur_radius = blur_radius,
+        .spread_distance = spread_distance,
+    };
+
+    if (m_outer_box_shadow_cache.size() >= max_cached_outer_box_shadows && !m_outer_box_shadow_cache.contains(key)) {
+        paint_shadow(canvas);
+        return;
+    }
+
+    auto& cached_shadow = m_outer_box_shadow_cache.ensure(key, [&] {
+        auto shadow_surface = Gfx::PaintingSurface::create_with_size(m_context, image_rect.size(), Gfx::BitmapFormat::BGRA8888, Gfx::AlphaType::Premultiplied);
+        auto& shadow_canvas = shadow_surface->canvas();
+        shadow_canvas.clear(SK_ColorTRANSPARENT);
+        shadow_canvas.translate(-image_rect.x(), -image_rect.y());
+        paint_shadow(shadow_canvas);
+        return CachedOuterBoxShadow { move(shadow_surface), m_playback_count };
+    });
+    cached_shadow.last_used_playback = m_playback_count;
+
+    auto image = cached_shadow.surface->sk_surface().makeImageSnapshot();
+    canvas.drawImage(image, image_rect.x(), image_rect.y());
 }
 
 void DisplayListPlayerSkia::paint_inner_box_shadow(PaintInnerBoxShadow const& command)
@@ -6,14 +6,51 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <LibGfx/PaintingSurface.h>
 #include <LibGfx/SkiaBackendContext.h>
 #include <LibWeb/Painting/DisplayListRecorder.h>
 
+#include <core/SkTextBlob.h>
+
 class GrDirectContext;
 
 namespace Web::Painting {
 
+// Everything an outer box shadow looks like depends on, except for where it's painted.
+struct OuterBoxShadowCacheKey {
+    Gfx::IntSize content_size;
+    CornerRadii corner_radii;
+    Color color;
+    int offset_x { 0 };
+    int offset_y { 0 };
+    int blur_radius { 0 };
+    int spread_distance { 0 };
+
+    bool operator==(OuterBoxShadowCacheKey const&) const = default;
+};
+
+}
+
+namespace AK {
+
+template<>
+struct Traits<Web::Painting::OuterBoxShadowCacheKey> : public DefaultTraits<Web::Painting::OuterBoxShadowCacheKey> {
+    static unsigned hash(Web::Painting::OuterBoxShadowCacheKey const& key)
+    {
+        auto hash = pair_int_hash(key.content_size.width(), key.content_size.height());
+        for (auto const* corner : { &key.corner_radii.top_left, &key.corner_radii.top_right, &key.corner_radii.bottom_right, &key.corner_radii.bottom_left })
+            hash = pair_int_hash(hash, pair_int_hash(corner->horizontal_radius, corner->vertical_radius));
+        hash = pair_int_hash(hash, key.color.value());
+        hash = pair_int_hash(hash, pair_int_hash(key.offset_x, key.offset_y));
+        return pair_int_hash(hash, pair_int_hash(key.blur_radius, key.spread_distance));
+    }
+};
+
+}
+
+namespace Web::Painting {
+
 class DisplayListPlayerSkia final : public DisplayListPlayer {
 public:
     DisplayListPlayerSkia(RefPtr<Gfx::SkiaBackendContext>);
@@ -63,6 +100,22 @@ private:
     bool would_be_fully_clipped_by_painter(Gfx::IntRect) const override;
 
     RefPtr<Gfx::SkiaBackendContext> m_context;
+
+    struct CachedOuterBoxShadow {
+        NonnullRefPtr<Gfx::PaintingSurface> surface;
+        u64 last_used_playback { 0 };
+    };
+    HashMap<OuterBoxShadowCacheKey, CachedOuterBoxShadow> m_outer_box_shadow_cache;
+
+    // Glyph runs are kept alive by their cached text blob, so that their address can't be reused by another one.
+    struct CachedTextBlob {
+        NonnullRefPtr<Gfx::GlyphRun const> glyph_run;
+        double scale { 1 };
+        sk_sp<SkTextBlob> text_blob;
+        u64 last_used_playback { 0 };
+    };
+    HashMap<Gfx::GlyphRun const*, CachedTextBlob> m_text_blob_cache;
+    u64 m_playback_count { 0 };
 };
 
 }
@@ -311,7 +311,8 @@ void DisplayListRecorder::push_stacking_context(PushStackingContextParams params
             .origin = params.transform.origin,
             .matrix = params.transform.matrix,
         },
-        .clip_path = params.clip_path });
+        .clip_path = params.clip_path,
+        .compositor_layer_id = params.compositor_layer_id });
     m_scroll_frame_id_stack.append({});
 }
 
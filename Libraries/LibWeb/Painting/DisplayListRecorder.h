@@ -125,6 +125,7 @@ public:
         Gfx::IntRect source_paintable_rect;
         StackingContextTransform transform;
         Optional<Gfx::Path> clip_path = {};
+        Optional<size_t> compositor_layer_id = {};
     };
     void push_stacking_context(PushStackingContextParams params);
     void pop_stacking_context();
@@ -83,6 +83,11 @@ public:
 
     u64 paint_generation_id() const { return m_paint_generation_id; }
 
+    // Set while recording a document's display list. Stacking contexts reuse the commands they recorded for an
+    // earlier display list of the same generation, unless they have been invalidated since.
+    Optional<u64> display_list_generation() const { return m_display_list_generation; }
+    void set_display_list_generation(u64 generation) { m_display_list_generation = generation; }
+
 private:
     Painting::DisplayListRecorder& m_display_list_recorder;
     Palette m_palette;
@@ -94,6 +99,7 @@ private:
     bool m_draw_svg_geometry_for_clip_path { false };
     Gfx::AffineTransform m_svg_transform;
     u64 m_paint_generation_id { 0 };
+    Optional<u64> m_display_list_generation;
 };
 
 }
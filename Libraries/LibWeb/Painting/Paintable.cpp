@@ -158,22 +158,78 @@ StackingContext* Paintable::enclosing_stacking_context()
     VERIFY_NOT_REACHED();
 }
 
+void Paintable::invalidate_cached_stacking_context_commands()
+{
+    // NOTE: Unlike enclosing_stacking_context(), this also has to work while the stacking context tree isn't built,
+    //       in which case there's nothing to invalidate.
+    for (auto* paintable = this; paintable; paintable = paintable->parent()) {
+        if (!paintable->is_paintable_box())
+            continue;
+        if (auto* stacking_context = static_cast<PaintableBox&>(*paintable).stacking_context()) {
+            stacking_context->invalidate_cached_commands();
+            return;
+        }
+    }
+}
+
 void Paintable::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
     auto& document = const_cast<DOM::Document&>(this->document());
+
     if (should_invalidate_display_list == InvalidateDisplayList::Yes)
-        document.invalidate_display_list();
+        invalidate_cached_stacking_context_commands();
 
     auto* containing_block = this->containing_block();
-    if (!containing_block)
+    if (!containing_block || !is<Painting::PaintableWithLines>(*containing_block)) {
+        if (should_invalidate_display_list == InvalidateDisplayList::Yes)
+            document.invalidate_display_list(DOM::Document::DiscardCachedStackingContextCommands::No);
         return;
+    }
 
-    if (!is<Painting::PaintableWithLines>(*containing_block))
-        return;
+    CSSPixelRect fragments_rect;
     static_cast<Painting::PaintableWithLines const&>(*containing_block).for_each_fragment([&](auto& fragment) {
-        document.set_needs_display(fragment.absolute_rect(), InvalidateDisplayList::No);
+        fragments_rect.unite(fragment.absolute_rect());
         return IterationDecision::Continue;
     });
+
+    // NOTE: The caret is painted just past the end of the last fragment, so leave some room for it.
+    fragments_rect.inflate(2, 2);
+
+    auto damage_rect = viewport_damage_rect_for(fragments_rect);
+    if (!damage_rect.has_value()) {
+        if (should_invalidate_display_list == InvalidateDisplayList::Yes)
+            document.invalidate_display_list(DOM::Document::DiscardCachedStackingContextCommands::No);
+        document.set_needs_display(InvalidateDisplayList::No);
+        return;
+    }
+
+    // Changes to inline content (such as the caret blinking or the selection changing) only repaint our fragments,
+    // even though they require recording a new display list.
+    if (should_invalidate_display_list == InvalidateDisplayList::Yes)
+        document.invalidate_display_list_within(*damage_rect);
+    document.set_needs_display(*damage_rect, InvalidateDisplayList::No);
+}
+
+Optional<CSSPixelRect> Paintable::viewport_damage_rect_for(CSSPixelRect const& absolute_rect) const
+{
+    if (is_fixed_position() || is_sticky_position() || is_svg_paintable())
+        return {};
+    if (is_paintable_box() && static_cast<PaintableBox const&>(*this).has_css_transform())
+        return {};
+
+    // Walk the containing block chain like ViewportPaintable::assign_scroll_frames() does to find the scroll frame
+    // our rect is painted in, while making sure nothing along the way moves it in ways we don't account for.
+    RefPtr<ScrollFrame const> scroll_frame;
+    for (auto const* block = containing_block(); block; block = block->containing_block()) {
+        if (block->is_fixed_position() || block->has_css_transform() || !block->computed_values().filter().is_empty())
+            return {};
+        if (!scroll_frame)
+            scroll_frame = block->own_scroll_frame();
+    }
+
+    if (!scroll_frame)
+        return {};
+    return absolute_rect.translated(scroll_frame->cumulative_offset());
 }
 
 CSSPixelPoint Paintable::box_type_agnostic_position() const
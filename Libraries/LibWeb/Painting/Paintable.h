@@ -117,6 +117,13 @@ public:
 
     virtual void set_needs_display(InvalidateDisplayList = InvalidateDisplayList::Yes);
 
+    // Invalidates the commands cached by the stacking contexts that paint this paintable.
+    void invalidate_cached_stacking_context_commands();
+
+    // Maps a rect in absolute coordinates, painted by this paintable, to the part of the viewport it ends up in.
+    // Returns an empty Optional if that can't be determined cheaply for damage tracking (e.g. due to transforms).
+    Optional<CSSPixelRect> viewport_damage_rect_for(CSSPixelRect const& absolute_rect) const;
+
     PaintableBox* containing_block() const;
 
     template<typename T>
@@ -1259,7 +1259,22 @@ TraversalDecision PaintableWithLines::hit_test(CSSPixelPoint position, HitTestTy
 
 void PaintableBox::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
-    document().set_needs_display(absolute_rect(), should_invalidate_display_list);
+    // NOTE: Recording a new display list may change more than our own box (think shadows or outlines), which
+    //       Document::invalidate_display_list() accounts for by damaging the entire viewport.
+    if (should_invalidate_display_list == InvalidateDisplayList::Yes) {
+        // NOTE: Things like focus or selection changes are reported to the viewport, but may affect any paintable.
+        if (layout_node().is_viewport()) {
+            document().invalidate_display_list();
+        } else {
+            invalidate_cached_stacking_context_commands();
+            document().invalidate_display_list(DOM::Document::DiscardCachedStackingContextCommands::No);
+        }
+    }
+    if (auto damage_rect = viewport_damage_rect_for(absolute_border_box_rect()); damage_rect.has_value()) {
+        document().set_needs_display(*damage_rect, InvalidateDisplayList::No);
+        return;
+    }
+    document().set_needs_display(InvalidateDisplayList::No);
 }
 
 Optional<CSSPixelRect> PaintableBox::get_masking_area() const
@@ -51,6 +51,24 @@ static Gfx::WindingRule to_gfx_winding_rule(SVG::FillRule fill_rule)
     }
 }
 
+SVGPathPaintable::DevicePaths const& SVGPathPaintable::device_paths(Gfx::AffineTransform const& paint_transform) const
+{
+    if (m_cached_device_paths.has_value() && m_cached_device_paths->transform == paint_transform)
+        return *m_cached_device_paths;
+
+    auto path = computed_path()->copy_transformed(paint_transform);
+
+    // Fills are computed as though all subpaths are closed (https://svgwg.org/svg2-draft/painting.html#FillProperties)
+    // We need to fill the path before applying the stroke, however the filled
+    // path must be closed, whereas the stroke path may not necessary be closed.
+    // Copy the path and close it for filling, but use the previous path for stroke
+    auto closed_path = path;
+    closed_path.close_all_subpaths();
+
+    m_cached_device_paths = DevicePaths { paint_transform, move(path), move(closed_path) };
+    return *m_cached_device_paths;
+}
+
 void SVGPathPaintable::paint(PaintContext& context, PaintPhase phase) const
 {
     if (!is_visible() || !computed_path().has_value())
@@ -72,17 +90,9 @@ void SVGPathPaintable::paint(PaintContext& context, PaintPhase phase) const
     auto maybe_view_box = svg_node->dom_node().view_box();
 
     auto paint_transform = computed_transforms().svg_to_device_pixels_transform(context);
-    auto path = computed_path()->copy_transformed(paint_transform);
-
-    // Fills are computed as though all subpaths are closed (https://svgwg.org/svg2-draft/painting.html#FillProperties)
-    auto closed_path = [&] {
-        // We need to fill the path before applying the stroke, however the filled
-        // path must be closed, whereas the stroke path may not necessary be closed.
-        // Copy the path and close it for filling, but use the previous path for stroke
-        auto copy = path;
-        copy.close_all_subpaths();
-        return copy;
-    };
+    auto const& device_paths = this->device_paths(paint_transform);
+    auto const& path = device_paths.path;
+    auto closed_path = [&] { return device_paths.closed_path; };
 
     auto svg_viewport = [&] {
         if (maybe_view_box.has_value())
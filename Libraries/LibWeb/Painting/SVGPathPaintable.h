@@ -28,6 +28,7 @@ public:
     void set_computed_path(Gfx::Path path)
     {
         m_computed_path = move(path);
+        m_cached_device_paths.clear();
     }
 
     Optional<Gfx::Path> const& computed_path() const { return m_computed_path; }
@@ -36,6 +37,18 @@ protected:
     SVGPathPaintable(Layout::SVGGraphicsBox const&);
 
     Optional<Gfx::Path> m_computed_path = {};
+
+private:
+    // The computed path transformed to device pixels, as painted the last time, since repaints mostly happen at the
+    // same transform.
+    struct DevicePaths {
+        Gfx::AffineTransform transform;
+        Gfx::Path path;
+        Gfx::Path closed_path;
+    };
+    DevicePaths const& device_paths(Gfx::AffineTransform const&) const;
+
+    mutable Optional<DevicePaths> m_cached_device_paths;
 };
 
 }
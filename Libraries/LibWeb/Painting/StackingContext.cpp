@@ -11,6 +11,9 @@
 #include <LibGfx/Matrix4x4.h>
 #include <LibGfx/Rect.h>
 #include <LibWeb/CSS/StyleValues/TransformationStyleValue.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/HTML/Navigable.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/ReplacedBox.h>
 #include <LibWeb/Layout/Viewport.h>
@@ -62,6 +65,12 @@ void StackingContext::set_last_paint_generation_id(u64 generation_id)
     m_last_paint_generation_id = generation_id;
 }
 
+void StackingContext::invalidate_cached_commands()
+{
+    for (auto* stacking_context = this; stacking_context; stacking_context = stacking_context->m_parent)
+        stacking_context->m_cached_commands.clear();
+}
+
 static PaintPhase to_paint_phase(StackingContext::StackingContextPaintPhase phase)
 {
     // There are not a fully correct mapping since some stacking context phases are combined.
@@ -300,7 +309,75 @@ static Gfx::FloatMatrix4x4 matrix_with_scaled_translation(Gfx::FloatMatrix4x4 ma
     return matrix;
 }
 
+Gfx::FloatMatrix4x4 StackingContext::transform_matrix_in_device_pixels(PaintableBox const& paintable_box, float device_pixels_per_css_pixel)
+{
+    return matrix_with_scaled_translation(paintable_box.transform(), device_pixels_per_css_pixel);
+}
+
+static bool should_promote_to_compositor_layer(PaintableBox const& paintable_box)
+{
+    // NOTE: Only the layers of the top-level document are updated at playback time.
+    //       See TraversableNavigable::start_display_list_rendering().
+    auto navigable = paintable_box.document().navigable();
+    if (!navigable || !navigable->is_traversable())
+        return false;
+
+    auto const* element = as_if<DOM::Element>(paintable_box.dom_node().ptr());
+    if (!element)
+        return false;
+    auto style = element->computed_properties();
+    if (!style)
+        return false;
+
+    auto const& animated_property_values = style->animated_property_values();
+    return animated_property_values.contains(CSS::PropertyID::Opacity)
+        || animated_property_values.contains(CSS::PropertyID::Transform)
+        || animated_property_values.contains(CSS::PropertyID::Rotate)
+        || animated_property_values.contains(CSS::PropertyID::Scale)
+        || animated_property_values.contains(CSS::PropertyID::Translate);
+}
+
 void StackingContext::paint(PaintContext& context) const
+{
+    // NOTE: The root stacking context is recorded again for every new display list, and the document already caches
+    //       that as a whole.
+    auto display_list_generation = context.display_list_generation();
+    if (!display_list_generation.has_value() || !m_parent) {
+        record(context);
+        return;
+    }
+
+    auto& display_list = context.display_list_recorder().display_list();
+    display_list.mark_optimization_barrier();
+
+    // OPTIMIZATION: Splice in what we recorded for an earlier display list, instead of walking our paintables again.
+    if (m_cached_commands.has_value() && m_cached_commands->display_list_generation == *display_list_generation) {
+        for (auto const& item : m_cached_commands->commands)
+            display_list.append(Command { item.command }, item.scroll_frame_id);
+        return;
+    }
+
+    auto& document = paintable_box().document();
+    auto number_of_compositor_layers = document.number_of_compositor_layers();
+    auto first_command_index = display_list.commands().size();
+
+    record(context);
+
+    // Compositor layer IDs are only valid for the display list they were registered for, so don't keep commands
+    // that refer to them.
+    if (document.number_of_compositor_layers() != number_of_compositor_layers) {
+        m_cached_commands.clear();
+        return;
+    }
+
+    CachedCommands cached_commands { .display_list_generation = *display_list_generation, .commands = {} };
+    cached_commands.commands.ensure_capacity(display_list.commands().size() - first_command_index);
+    for (auto i = first_command_index; i < display_list.commands().size(); ++i)
+        cached_commands.commands.append(display_list.commands()[i]);
+    m_cached_commands = move(cached_commands);
+}
+
+void StackingContext::record(PaintContext& context) const
 {
     auto opacity = paintable_box().computed_values().opacity();
     if (opacity == 0.0f)
@@ -328,6 +405,9 @@ void StackingContext::paint(PaintContext& context) const
         },
     };
 
+    if (should_promote_to_compositor_layer(paintable_box()))
+        push_stacking_context_params.compositor_layer_id = const_cast<DOM::Document&>(paintable_box().document()).register_compositor_layer(paintable_box());
+
     auto const& computed_values = paintable_box().computed_values();
     if (auto clip_path = computed_values.clip_path(); clip_path.has_value() && clip_path->is_basic_shape()) {
         auto const& masking_area = paintable_box().get_masking_area();
@@ -8,6 +8,7 @@
 
 #include <AK/Vector.h>
 #include <LibGfx/Matrix4x4.h>
+#include <LibWeb/Painting/DisplayList.h>
 #include <LibWeb/Painting/Paintable.h>
 
 namespace Web::Painting {
@@ -40,12 +41,17 @@ public:
 
     Gfx::AffineTransform affine_transform_matrix() const;
 
+    static Gfx::FloatMatrix4x4 transform_matrix_in_device_pixels(PaintableBox const&, float device_pixels_per_css_pixel);
+
     void dump(int indent = 0) const;
 
     void sort();
 
     void set_last_paint_generation_id(u64 generation_id);
 
+    // Makes this stacking context and its ancestors record their commands again for the next display list.
+    void invalidate_cached_commands();
+
 private:
     GC::Ref<PaintableBox> m_paintable;
     StackingContext* const m_parent { nullptr };
@@ -56,8 +62,15 @@ private:
     Vector<GC::Ref<PaintableBox const>> m_positioned_descendants_and_stacking_contexts_with_stack_level_0;
     Vector<GC::Ref<PaintableBox const>> m_non_positioned_floating_descendants;
 
+    struct CachedCommands {
+        u64 display_list_generation { 0 };
+        Vector<DisplayList::CommandListItem> commands;
+    };
+    mutable Optional<CachedCommands> m_cached_commands;
+
     static void paint_child(PaintContext&, StackingContext const&);
     void paint_internal(PaintContext&) const;
+    void record(PaintContext&) const;
 };
 
 }
@@ -4,13 +4,12 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
-#include <AK/MemoryStream.h>
 #include <AK/String.h>
 #include <AK/WeakPtr.h>
 #include <LibCore/EventLoop.h>
 #include <LibCore/ThreadedPromise.h>
 #include <LibCore/Timer.h>
-#include <LibMedia/Audio/Loader.h>
+#include <LibMedia/Audio/BufferedLoader.h>
 
 #include "AudioCodecPluginAgnostic.h"
 
@@ -18,18 +17,22 @@ namespace Web::Platform {
 
 constexpr int update_interval = 50;
 
+// How much audio is decoded ahead of the output, so that the output never has to wait for the decoder.
+constexpr auto decode_ahead_duration = AK::Duration::from_milliseconds(500);
+
 static AK::Duration timestamp_from_samples(i64 samples, u32 sample_rate)
 {
     return AK::Duration::from_milliseconds(samples * 1000 / sample_rate);
 }
 
-static AK::Duration get_loader_timestamp(NonnullRefPtr<Audio::Loader> const& loader)
+static AK::Duration get_loader_timestamp(NonnullRefPtr<Audio::BufferedLoader> const& loader)
 {
-    return timestamp_from_samples(loader->loaded_samples(), loader->sample_rate());
+    return timestamp_from_samples(loader->position(), loader->sample_rate());
 }
 
-ErrorOr<NonnullOwnPtr<AudioCodecPluginAgnostic>> AudioCodecPluginAgnostic::create(NonnullRefPtr<Audio::Loader> const& loader)
+ErrorOr<NonnullOwnPtr<AudioCodecPluginAgnostic>> AudioCodecPluginAgnostic::create(NonnullRefPtr<Audio::Loader> const& decoding_loader)
 {
+    auto loader = TRY(Audio::BufferedLoader::create(decoding_loader, decode_ahead_duration));
     auto duration = timestamp_from_samples(loader->total_samples(), loader->sample_rate());
 
     auto update_timer = Core::Timer::create();
@@ -44,32 +47,26 @@ ErrorOr<NonnullOwnPtr<AudioCodecPluginAgnostic>> AudioCodecPluginAgnostic::creat
         Audio::OutputState::Suspended, loader->sample_rate(), /* channels = */ 2, latency_ms,
         [&plugin = *plugin, loader](Bytes buffer, Audio::PcmSampleFormat format, size_t sample_count) -> ReadonlyBytes {
             VERIFY(format == Audio::PcmSampleFormat::Float32);
-
-            auto samples_result = loader->get_more_samples(sample_count);
-            if (samples_result.is_error()) {
-                dbgln("Error while loading samples: {}", samples_result.error());
-                plugin.on_decoder_error(MUST(String::formatted("Decoding failure: {}", samples_result.error())));
+            VERIFY(buffer.size() >= sample_count * sizeof(Audio::Sample));
+
+            // NOTE: Our stereo samples have the same layout as the interleaved floats that the output asks for, so they
+            //       can be copied straight out of the decoded sample ring.
+            Span<Audio::Sample> samples { reinterpret_cast<Audio::Sample*>(buffer.data()), sample_count };
+            auto samples_read = loader->read_samples(samples);
+            if (samples_read.is_error()) {
+                dbgln("Error while loading samples: {}", samples_read.error());
+                plugin.on_decoder_error(MUST(String::formatted("Decoding failure: {}", samples_read.error())));
                 return buffer.trim(0);
             }
 
-            auto samples = samples_result.release_value();
-            VERIFY(samples.size() <= sample_count);
-
-            FixedMemoryStream writing_stream { buffer };
-
-            for (auto& sample : samples) {
-                MUST(writing_stream.write_value(sample.left));
-                MUST(writing_stream.write_value(sample.right));
-            }
-
             // FIXME: Check if we have loaded samples past the current known duration, and if so, update it
             //        and notify the media element.
-            return buffer.trim(writing_stream.offset());
+            return buffer.trim(samples_read.value() * sizeof(Audio::Sample));
         }));
 
     output->set_underrun_callback([&plugin = *plugin, loader, output]() {
         auto new_device_time = output->total_time_played().release_value_but_fixme_should_propagate_errors();
-        auto new_media_time = timestamp_from_samples(loader->loaded_samples(), loader->sample_rate());
+        auto new_media_time = get_loader_timestamp(loader);
         plugin.m_main_thread_event_loop.deferred_invoke([&plugin, new_device_time, new_media_time]() {
             plugin.m_last_resume_in_device_time = new_device_time;
             plugin.m_last_resume_in_media_time = new_media_time;
@@ -81,7 +78,7 @@ ErrorOr<NonnullOwnPtr<AudioCodecPluginAgnostic>> AudioCodecPluginAgnostic::creat
     return plugin;
 }
 
-AudioCodecPluginAgnostic::AudioCodecPluginAgnostic(NonnullRefPtr<Audio::Loader> loader, AK::Duration duration, NonnullRefPtr<Core::Timer> update_timer)
+AudioCodecPluginAgnostic::AudioCodecPluginAgnostic(NonnullRefPtr<Audio::BufferedLoader> loader, AK::Duration duration, NonnullRefPtr<Core::Timer> update_timer)
     : m_loader(move(loader))
     , m_duration(duration)
     , m_main_thread_event_loop(Core::EventLoop::current())
@@ -122,7 +119,7 @@ void AudioCodecPluginAgnostic::pause_playback()
             if (!self)
                 return {};
 
-            auto new_media_time = timestamp_from_samples(self->m_loader->loaded_samples(), self->m_loader->sample_rate());
+            auto new_media_time = get_loader_timestamp(self->m_loader);
             auto new_device_time = TRY(self->m_output->total_time_played());
 
             self->m_main_thread_event_loop.deferred_invoke([self, new_media_time, new_device_time]() {
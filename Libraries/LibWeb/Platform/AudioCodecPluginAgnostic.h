@@ -7,6 +7,7 @@
 #pragma once
 
 #include <LibCore/Timer.h>
+#include <LibMedia/Audio/BufferedLoader.h>
 #include <LibMedia/Audio/PlaybackStream.h>
 #include <LibWeb/Platform/AudioCodecPlugin.h>
 
@@ -24,11 +25,11 @@ public:
     virtual AK::Duration duration() override;
 
 private:
-    explicit AudioCodecPluginAgnostic(NonnullRefPtr<Audio::Loader> loader, AK::Duration, NonnullRefPtr<Core::Timer> update_timer);
+    explicit AudioCodecPluginAgnostic(NonnullRefPtr<Audio::BufferedLoader> loader, AK::Duration, NonnullRefPtr<Core::Timer> update_timer);
 
     void update_timestamp();
 
-    NonnullRefPtr<Audio::Loader> m_loader;
+    NonnullRefPtr<Audio::BufferedLoader> m_loader;
     RefPtr<Audio::PlaybackStream> m_output { nullptr };
     AK::Duration m_duration { AK::Duration::zero() };
     AK::Duration m_last_resume_in_media_time { AK::Duration::zero() };
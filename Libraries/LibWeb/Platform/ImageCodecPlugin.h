@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/RefCounted.h>
 #include <AK/RefPtr.h>
 #include <AK/Vector.h>
 #include <LibCore/Promise.h>
@@ -20,11 +21,36 @@ struct Frame {
     size_t duration { 0 };
 };
 
+// Decodes the frames of an animated image that were not decoded up front. Dropping the last reference to it releases
+// the decoder.
+class AnimationFrameSource : public RefCounted<AnimationFrameSource> {
+public:
+    virtual ~AnimationFrameSource() = default;
+
+    // Decodes up to `count` frames starting at `first_frame_index`. Fewer frames are passed to the callback if some
+    // could not be decoded.
+    virtual void request_frames(size_t first_frame_index, size_t count, ESCAPING Function<void(size_t first_frame_index, Vector<Frame>)> on_frames_decoded) = 0;
+};
+
+// Decodes an image while its data is still arriving. Dropping the last reference to it before finish() has been
+// called cancels the decoding.
+class IncrementalImageDecoder : public RefCounted<IncrementalImageDecoder> {
+public:
+    virtual ~IncrementalImageDecoder() = default;
+
+    virtual void append_data(ReadonlyBytes) = 0;
+    virtual void finish() = 0;
+};
+
 struct DecodedImage {
     bool is_animated { false };
     u32 loop_count { 0 };
     Vector<Frame> frames;
     Gfx::ColorSpace color_space;
+
+    // Set if the image has more frames than were decoded up front.
+    size_t frame_count { 0 };
+    RefPtr<AnimationFrameSource> frame_source;
 };
 
 class ImageCodecPlugin {
@@ -35,6 +61,10 @@ public:
     virtual ~ImageCodecPlugin();
 
     virtual NonnullRefPtr<Core::Promise<DecodedImage>> decode_image(ReadonlyBytes, ESCAPING Function<ErrorOr<void>(DecodedImage&)> on_resolved, ESCAPING Function<void(Error&)> on_rejected) = 0;
+
+    // Partially decoded images are passed to on_partial_image while the data arrives, if the image format allows it.
+    // Returns null if images can only be decoded once all of their data has arrived.
+    virtual RefPtr<IncrementalImageDecoder> start_incremental_decoding(ESCAPING Function<void(NonnullRefPtr<Gfx::Bitmap>)>, ESCAPING Function<ErrorOr<void>(DecodedImage&)>, ESCAPING Function<void(Error&)>) { return nullptr; }
 };
 
 }
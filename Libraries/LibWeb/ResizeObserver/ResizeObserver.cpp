@@ -71,6 +71,9 @@ void ResizeObserver::observe(DOM::Element& target, ResizeObserverOptions options
 
     // 4. Add the resizeObservation to the [[observationTargets]] slot.
     m_observation_targets.append(resize_observation);
+
+    // A new observation starts out active, even if nothing on the page changes until the next update.
+    m_geometry_generation_without_active_observations.clear();
 }
 
 // https://drafts.csswg.org/resize-observer-1/#dom-resizeobserver-unobserve
@@ -37,6 +37,10 @@ public:
     Vector<GC::Ref<ResizeObservation>>& active_targets() { return m_active_targets; }
     Vector<GC::Ref<ResizeObservation>>& skipped_targets() { return m_skipped_targets; }
 
+    // The page geometry generation at which none of our observations were active, if none were added since.
+    Optional<u64> geometry_generation_without_active_observations() const { return m_geometry_generation_without_active_observations; }
+    void set_geometry_generation_without_active_observations(Badge<DOM::Document>, u64 generation) { m_geometry_generation_without_active_observations = generation; }
+
 private:
     explicit ResizeObserver(JS::Realm&, WebIDL::CallbackType* callback);
 
@@ -51,6 +55,8 @@ private:
 
     // AD-HOC: This is the document where we've registered the observer.
     WeakPtr<DOM::Document> m_document;
+
+    Optional<u64> m_geometry_generation_without_active_observations;
 };
 
 }
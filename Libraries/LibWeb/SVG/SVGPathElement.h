@@ -30,6 +30,10 @@ private:
     virtual void initialize(JS::Realm&) override;
 
     Vector<PathInstruction> m_instructions;
+
+    // The path built from m_instructions, which is kept until the "d" attribute changes. Copies of a Gfx::Path
+    // share their underlying path data, so handing out copies of it is cheap.
+    Optional<Gfx::Path> m_path;
 };
 
 [[nodiscard]] Gfx::Path path_from_path_instructions(ReadonlySpan<PathInstruction>);
@@ -0,0 +1,656 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/AnyOf.h>
+#include <AK/StringHash.h>
+#include <LibGC/RootVector.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/Realm.h>
+#include <LibWeb/Bindings/CachePrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/AbortSignal.h>
+#include <LibWeb/Fetch/FetchMethod.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Bodies.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Requests.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Responses.h>
+#include <LibWeb/Fetch/Infrastructure/HTTP/Statuses.h>
+#include <LibWeb/Fetch/Response.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/ServiceWorker/Cache.h>
+
+namespace Web::ServiceWorker {
+
+GC_DEFINE_ALLOCATOR(Cache);
+GC_DEFINE_ALLOCATOR(RequestResponseList);
+
+static HashMap<u32, Vector<CachedResponseBody*>>& cached_response_bodies()
+{
+    static HashMap<u32, Vector<CachedResponseBody*>> cached_response_bodies;
+    return cached_response_bodies;
+}
+
+NonnullRefPtr<CachedResponseBody> CachedResponseBody::create(ByteBuffer bytes)
+{
+    auto hash = string_hash(reinterpret_cast<char const*>(bytes.data()), bytes.size());
+
+    if (auto candidates = cached_response_bodies().get(hash); candidates.has_value()) {
+        for (auto* candidate : *candidates) {
+            if (candidate->bytes() == bytes.bytes())
+                return *candidate;
+        }
+    }
+
+    auto body = adopt_ref(*new CachedResponseBody(move(bytes), hash));
+    cached_response_bodies().ensure(hash).append(body.ptr());
+    return body;
+}
+
+CachedResponseBody::CachedResponseBody(ByteBuffer bytes, u32 hash)
+    : m_bytes(move(bytes))
+    , m_hash(hash)
+{
+}
+
+CachedResponseBody::~CachedResponseBody()
+{
+    auto candidates = cached_response_bodies().find(m_hash);
+    VERIFY(candidates != cached_response_bodies().end());
+
+    candidates->value.remove_first_matching([&](auto* candidate) { return candidate == this; });
+    if (candidates->value.is_empty())
+        cached_response_bodies().remove(candidates);
+}
+
+GC::Ref<RequestResponseList> RequestResponseList::create(JS::VM& vm)
+{
+    return vm.heap().allocate<RequestResponseList>();
+}
+
+void RequestResponseList::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+
+    for (auto const& entry : m_entries) {
+        visitor.visit(entry.request);
+        visitor.visit(entry.response);
+    }
+}
+
+// https://w3c.github.io/ServiceWorker/#request-matches-cached-item-algorithm
+static bool request_matches_cached_item(Fetch::Infrastructure::Request const& request_query, Fetch::Infrastructure::Request const& request, GC::Ptr<Fetch::Infrastructure::Response> response, CacheQueryOptions const& options)
+{
+    // 1. If options["ignoreMethod"] is false and request’s method is not `GET`, return false.
+    if (!options.ignore_method && request.method() != "GET"sv.bytes())
+        return false;
+
+    // 2. Let queryURL be requestQuery’s url.
+    auto query_url = request_query.url();
+
+    // 3. Let cachedURL be request’s url.
+    auto cached_url = request.url();
+
+    // 4. If options["ignoreSearch"] is true, then:
+    if (options.ignore_search) {
+        // 1. Set cachedURL’s query to the empty string.
+        cached_url.set_query(String {});
+
+        // 2. Set queryURL’s query to the empty string.
+        query_url.set_query(String {});
+    }
+
+    // 5. If queryURL does not equal cachedURL with exclude fragment set to true, then return false.
+    if (!query_url.equals(cached_url, URL::ExcludeFragment::Yes))
+        return false;
+
+    // 6. If response is null, options["ignoreVary"] is true, or response’s header list does not contain `Vary`, then
+    //    return true.
+    if (!response || options.ignore_vary || !response->header_list()->contains("Vary"sv.bytes()))
+        return true;
+
+    // 7. Let fieldValues be the list containing the elements corresponding to the field-values of the Vary header for
+    //    the value of the header with name `Vary`.
+    auto field_values = response->header_list()->get_decode_and_split("Vary"sv.bytes()).value_or({});
+
+    // 8. For each fieldValue in fieldValues:
+    for (auto const& field_value : field_values) {
+        // 1. If fieldValue matches "*", or the combined value given fieldValue and request’s header list does not match
+        //    the combined value given fieldValue and requestQuery’s header list, then return false.
+        if (field_value == "*"sv)
+            return false;
+        if (request.header_list()->get(field_value.bytes()) != request_query.header_list()->get(field_value.bytes()))
+            return false;
+    }
+
+    // 9. Return true.
+    return true;
+}
+
+// https://w3c.github.io/ServiceWorker/#query-cache-algorithm
+Vector<RequestResponseList::Entry> RequestResponseList::query_cache(Fetch::Infrastructure::Request const& request_query, CacheQueryOptions const& options) const
+{
+    // 1. Let resultList be an empty list.
+    Vector<Entry> result_list;
+
+    // 2. Let storage be null.
+    // 3. If the optional argument targetStorage is omitted, set storage to the relevant request response list.
+    // 4. Else, set storage to targetStorage.
+    // 5. For each requestResponse of storage:
+    for (auto const& request_response : m_entries) {
+        // 1. Let cachedRequest be requestResponse’s request.
+        // 2. Let cachedResponse be requestResponse’s response.
+        // 3. If Request Matches Cached Item with requestQuery, cachedRequest, cachedResponse, and options returns true,
+        //    then:
+        //     1. Let requestCopy be a copy of cachedRequest.
+        //     2. Let responseCopy be a copy of cachedResponse.
+        //     3. Add requestCopy/responseCopy to resultList.
+        // NOTE: Entries are never modified in place, so they are shared rather than copied.
+        if (request_matches_cached_item(request_query, request_response.request, request_response.response, options))
+            result_list.append(request_response);
+    }
+
+    // 6. Return resultList.
+    return result_list;
+}
+
+static bool has_vary_header_matching_any_field(Fetch::Infrastructure::Response const& response)
+{
+    auto field_values = response.header_list()->get_decode_and_split("Vary"sv.bytes());
+    if (!field_values.has_value())
+        return false;
+
+    return field_values->contains_slow("*"_string);
+}
+
+static WebIDL::ExceptionOr<GC::Ref<Fetch::Infrastructure::Request>> inner_request_for(JS::Realm& realm, Fetch::RequestInfo const& request)
+{
+    // If request is a Request object, then set r to request’s request.
+    if (auto const* request_object = request.get_pointer<GC::Root<Fetch::Request>>())
+        return (*request_object)->request();
+
+    // Else if request is a string, then set r to the associated request of the result of invoking the initial value of
+    // Request as constructor with request as its argument. If this throws an exception, return a promise rejected with
+    // that exception.
+    auto request_object = TRY(Fetch::Request::construct_impl(realm, request));
+    return request_object->request();
+}
+
+GC::Ref<Fetch::Response> create_response_object_for_cached_entry(JS::Realm& realm, RequestResponseList::Entry const& entry)
+{
+    auto response = entry.response->clone(realm);
+
+    // NOTE: Every match gets a body of its own, whose stream reads from the shared bytes of the cached body.
+    if (entry.body)
+        response->set_body(Fetch::Infrastructure::byte_sequence_as_body(realm, entry.body->bytes()));
+
+    return Fetch::Response::create(realm, response, Fetch::Headers::Guard::Immutable);
+}
+
+static GC::Ref<JS::Array> create_frozen_array(JS::Realm& realm, GC::RootVector<JS::Value> const& values)
+{
+    auto array = JS::Array::create_from(realm, values);
+    MUST(array->set_integrity_level(JS::Object::IntegrityLevel::Frozen));
+    return array;
+}
+
+GC::Ref<Cache> Cache::create(JS::Realm& realm, GC::Ref<RequestResponseList> request_response_list)
+{
+    return realm.create<Cache>(realm, request_response_list);
+}
+
+Cache::Cache(JS::Realm& realm, GC::Ref<RequestResponseList> request_response_list)
+    : Bindings::PlatformObject(realm)
+    , m_request_response_list(request_response_list)
+{
+}
+
+void Cache::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(Cache);
+    Base::initialize(realm);
+}
+
+void Cache::visit_edges(Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_request_response_list);
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-match
+GC::Ref<WebIDL::Promise> Cache::match(Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let promise be a new promise.
+    // 2. Run these substeps in parallel:
+    //     1. Let p be the result of running the algorithm specified in matchAll(request, options) method with request
+    //        and options.
+    auto p = match_all(request, options);
+
+    //     2. Wait until p settles.
+    //     3. If p rejects with an exception, then:
+    //         1. Reject promise with that exception.
+    //     4. Else if p resolves with an array, responses, then:
+    //         1. If responses is an empty array, then:
+    //             1. Resolve promise with undefined.
+    //         2. Else:
+    //             1. Resolve promise with the first element of responses.
+    // 3. Return promise.
+    return WebIDL::upon_fulfillment(p, GC::create_function(realm.heap(), [](JS::Value responses) -> WebIDL::ExceptionOr<JS::Value> {
+        // NOTE: The first element of an empty array is undefined.
+        return MUST(responses.as_object().get(0));
+    }));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-matchall
+GC::Ref<WebIDL::Promise> Cache::match_all(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let r be null.
+    GC::Ptr<Fetch::Infrastructure::Request> r;
+
+    // 2. If the optional argument request is not omitted, then:
+    if (request.has_value()) {
+        // 1. If request is a Request object, then:
+        //     1. Set r to request’s request.
+        //     2. If r’s method is not `GET` and options.ignoreMethod is false, return a promise resolved with an empty
+        //        array.
+        // 2. Else if request is a string, then:
+        //     1. Set r to the associated request of the result of invoking the initial value of Request as constructor
+        //        with request as its argument. If this throws an exception, return a promise rejected with that
+        //        exception.
+        auto inner_request = inner_request_for(realm, *request);
+        if (inner_request.is_exception())
+            return WebIDL::create_rejected_promise_from_exception(realm, inner_request.release_error());
+
+        r = inner_request.release_value();
+        if (r->method() != "GET"sv.bytes() && !options.ignore_method)
+            return WebIDL::create_resolved_promise(realm, create_frozen_array(realm, GC::RootVector<JS::Value> { realm.heap() }));
+    }
+
+    // 3. Let realm be this’s relevant realm.
+    // 4. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 5. Run these substeps in parallel:
+    // NOTE: The request response list lives in this process, so it is queried right away.
+
+    //     1. Let responses be an empty list.
+    Vector<RequestResponseList::Entry> responses;
+
+    //     2. If the optional argument request is omitted, then:
+    if (!r) {
+        // 1. For each requestResponse of the relevant request response list:
+        //     1. Add a copy of requestResponse’s response to responses.
+        responses = m_request_response_list->entries();
+    }
+    //     3. Else:
+    else {
+        // 1. Let requestResponses be the result of running Query Cache with r and options.
+        // 2. For each requestResponse of requestResponses:
+        //     1. Add a copy of requestResponse’s response to responses.
+        responses = m_request_response_list->query_cache(*r, options);
+    }
+
+    //     4. For each response of responses:
+    //         1. If response’s type is "opaque" and cross-origin resource policy check with promise’s relevant settings
+    //            object’s origin, promise’s relevant settings object, "", and response’s internal response returns
+    //            blocked, then reject promise with a TypeError and abort these steps.
+    // FIXME: Implement the cross-origin resource policy check.
+
+    //     5. Queue a task, on promise’s relevant settings object’s responsible event loop using the DOM manipulation
+    //        task source, to perform the following steps:
+    // NOTE: The Response objects are created right away, so that the cached responses cannot be collected in between.
+    //         1. Let responseList be a list.
+    GC::RootVector<JS::Value> response_list { realm.heap() };
+
+    //         2. For each response of responses:
+    //             1. Add a new Response object associated with response and a new Headers object whose guard is
+    //                "immutable" to responseList.
+    for (auto const& response : responses)
+        response_list.append(create_response_object_for_cached_entry(realm, response));
+
+    //         3. Resolve promise with a frozen array created from responseList, in realm.
+    WebIDL::resolve_promise(realm, promise, create_frozen_array(realm, response_list));
+
+    // 6. Return promise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-add
+GC::Ref<WebIDL::Promise> Cache::add(Fetch::RequestInfo const& request)
+{
+    // 1. Let requests be an array containing only request.
+    // 2. Let responseArrayPromise be the result of running the algorithm specified in addAll(requests) passing requests
+    //    as the argument.
+    // 3. Return the result of reacting to responseArrayPromise with a fulfillment handler that returns undefined.
+    // NOTE: addAll() already fulfills with undefined.
+    return add_all({ request });
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-addAll
+GC::Ref<WebIDL::Promise> Cache::add_all(Vector<Fetch::RequestInfo> const& requests)
+{
+    auto& realm = this->realm();
+
+    auto is_cacheable_request = [](Fetch::Infrastructure::Request const& request) {
+        return request.url().scheme().is_one_of("http"sv, "https"sv) && request.method() == "GET"sv.bytes();
+    };
+
+    // 1. Let responsePromises be an empty list.
+    Vector<GC::Ref<WebIDL::Promise>> response_promises;
+
+    // 2. Let requestList be an empty list.
+    GC::RootVector<GC::Ref<Fetch::Request>> request_list { realm.heap() };
+
+    // 3. For each request whose type is Request in requests:
+    for (auto const& request : requests) {
+        auto const* request_object = request.get_pointer<GC::Root<Fetch::Request>>();
+        if (!request_object)
+            continue;
+
+        // 1. Let r be request’s request.
+        // 2. If r’s url’s scheme is not one of "http" and "https", or r’s method is not `GET`, return a promise rejected
+        //    with a TypeError.
+        if (!is_cacheable_request((*request_object)->request()))
+            return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Only GET requests over HTTP(S) can be cached"sv));
+    }
+
+    // 4. Let fetchControllers be a list of fetch controllers.
+    // 5. For each request in requests:
+    for (auto const& request : requests) {
+        // 1. Let r be the associated request of the result of invoking the initial value of Request as constructor with
+        //    request as its argument. If this throws an exception, return a promise rejected with that exception.
+        auto request_object = Fetch::Request::construct_impl(realm, request);
+        if (request_object.is_exception())
+            return WebIDL::create_rejected_promise_from_exception(realm, request_object.release_error());
+
+        // 2. If r’s url’s scheme is not one of "http" and "https", then:
+        //     1. For each fetchController of fetchControllers, abort fetchController.
+        //     2. Return a promise rejected with a TypeError.
+        if (!is_cacheable_request(request_object.value()->request()))
+            return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Only GET requests over HTTP(S) can be cached"sv));
+
+        // 3. If r’s client’s global object is a ServiceWorkerGlobalScope object, set request’s service-workers mode to
+        //    "none".
+        // FIXME: 4. Set r’s initiator to "fetch" and destination to "subresource".
+
+        // 5. Add r to requestList.
+        request_list.append(request_object.value());
+    }
+
+    for (auto request : request_list) {
+        // 6. Let responsePromise be a new promise.
+        // 7. Run the following substeps in parallel:
+        //     1. Append the result of fetching r.
+        //     2. To processResponse for response, run these substeps:
+        //         1. If response’s type is "error", or response’s status is not an ok status or is 206, reject
+        //            responsePromise with a TypeError.
+        //         2. Else if response’s header list contains a header named `Vary`, then:
+        //             1. Let fieldValues be the list containing the items corresponding to the Vary header’s
+        //                field-values.
+        //             2. For each fieldValue in fieldValues:
+        //                 1. If fieldValue matches "*", then:
+        //                     1. Reject responsePromise with a TypeError.
+        //                     2. For each fetchController of fetchControllers, abort fetchController.
+        //                     3. Abort these steps.
+        //     3. To processResponseEndOfBody for response given abort, run these substeps:
+        //         1. If abort is true, reject responsePromise with an "AbortError" DOMException.
+        //         2. Resolve responsePromise with response.
+        // 8. Add responsePromise to responsePromises.
+        auto fetch_promise = Fetch::fetch(realm.vm(), GC::make_root(request));
+
+        response_promises.append(WebIDL::upon_fulfillment(fetch_promise, GC::create_function(realm.heap(), [](JS::Value value) -> WebIDL::ExceptionOr<JS::Value> {
+            auto response = as<Fetch::Response>(value.as_object()).response();
+
+            if (response->type() == Fetch::Infrastructure::Response::Type::Error || !Fetch::Infrastructure::is_ok_status(response->status()) || response->status() == 206)
+                return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Response is not cacheable"sv };
+            if (has_vary_header_matching_any_field(*response))
+                return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "Response varies on all request headers"sv };
+
+            return value;
+        })));
+    }
+
+    // 6. Let p be the result of getting a promise to wait for all of responsePromises.
+    auto p = WebIDL::get_promise_for_wait_for_all(realm, response_promises);
+
+    // 7. Return the result of reacting to p with a fulfillment handler that, when called with argument responses,
+    //    performs the following substeps:
+    // NOTE: Each response is stored with the steps of put(), which read its body into the cache.
+    return WebIDL::upon_fulfillment(p, GC::create_function(realm.heap(), [&realm, cache = GC::Ref { *this }, request_list = move(request_list)](JS::Value responses) -> WebIDL::ExceptionOr<JS::Value> {
+        auto& array = as<JS::Array>(responses.as_object());
+
+        Vector<GC::Ref<WebIDL::Promise>> put_promises;
+        for (size_t index = 0; index < request_list.size(); ++index) {
+            auto& response = as<Fetch::Response>(MUST(array.get(index)).as_object());
+            put_promises.append(cache->put(GC::make_root(request_list[index]), response));
+        }
+
+        auto all_put = WebIDL::get_promise_for_wait_for_all(realm, put_promises);
+        return WebIDL::upon_fulfillment(all_put, GC::create_function(realm.heap(), [](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
+            return JS::js_undefined();
+        }))->promise();
+    }));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-put
+GC::Ref<WebIDL::Promise> Cache::put(Fetch::RequestInfo const& request, GC::Ref<Fetch::Response> response)
+{
+    auto& realm = this->realm();
+
+    // 1. Let innerRequest be null.
+    // 2. If request is a Request object, then set innerRequest to request’s request.
+    // 3. Else:
+    //     1. Let requestObj be the result of invoking Request's constructor with request as its argument. If this
+    //        throws an exception, return a promise rejected with exception.
+    //     2. Set innerRequest to requestObj’s request.
+    auto maybe_inner_request = inner_request_for(realm, request);
+    if (maybe_inner_request.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, maybe_inner_request.release_error());
+    auto inner_request = maybe_inner_request.release_value();
+
+    // 4. If innerRequest’s url's scheme is not one of "http" and "https", or innerRequest’s method is not `GET`, return
+    //    a promise rejected with a TypeError.
+    if (!inner_request->url().scheme().is_one_of("http"sv, "https"sv) || inner_request->method() != "GET"sv.bytes())
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Only GET requests over HTTP(S) can be cached"sv));
+
+    // 5. Let innerResponse be response’s response.
+    auto inner_response = response->response();
+
+    // 6. If innerResponse’s status is 206, return a promise rejected with a TypeError.
+    if (inner_response->status() == 206)
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Partial responses cannot be cached"sv));
+
+    // 7. If innerResponse’s header list contains a header named `Vary`, then:
+    //     1. Let fieldValues be the list containing the elements corresponding to the field-values of the Vary header.
+    //     2. For each fieldValue in fieldValues:
+    //         1. If fieldValue matches "*", return a promise rejected with a TypeError.
+    if (has_vary_header_matching_any_field(*inner_response))
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Response varies on all request headers"sv));
+
+    // 8. If innerResponse’s body is disturbed or locked, return a promise rejected with a TypeError.
+    if (response->is_unusable())
+        return WebIDL::create_rejected_promise(realm, JS::TypeError::create(realm, "Response body has already been used"sv));
+
+    // 9. Let clonedResponse be the result of cloning innerResponse.
+    // NOTE: The body is not cloned. Its bytes are read into a CachedResponseBody below, which every match reads from.
+    auto body = inner_response->body();
+    inner_response->set_body(nullptr);
+    auto cloned_response = inner_response->clone(realm);
+    inner_response->set_body(body);
+
+    auto promise = WebIDL::create_promise(realm);
+
+    // NOTE: These are the steps that run once bodyReadPromise is fulfilled.
+    // 12. Let operations be an empty list.
+    // 13. Let operation be a cache batch operation.
+    // 14. Set operation’s type to "put".
+    // 15. Set operation’s request to innerRequest.
+    // 16. Set operation’s response to clonedResponse.
+    // 17. Append operation to operations.
+    // 18. Let realm be this’s relevant realm.
+    // 19. Return the result of the fulfillment of bodyReadPromise:
+    //     1. Let cacheJobPromise be a new promise.
+    //     2. Return cacheJobPromise and run these steps in parallel:
+    //         1. Let errorData be null.
+    //         2. Invoke Batch Cache Operations with operations. If this throws an exception, set errorData to the
+    //            exception.
+    //         3. Queue a task, on cacheJobPromise’s relevant settings object’s responsible event loop using the DOM
+    //            manipulation task source, to perform the following substeps:
+    //             1. If errorData is null, resolve cacheJobPromise with undefined.
+    //             2. Else, reject cacheJobPromise with a new exception with errorData and a user agent-defined
+    //                message, in realm.
+    auto store = GC::create_function(realm.heap(), [&realm, promise, list = m_request_response_list, inner_request, cloned_response](RefPtr<CachedResponseBody> cached_body) {
+        HTML::TemporaryExecutionContext context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+
+        // https://w3c.github.io/ServiceWorker/#batch-cache-operations-algorithm
+        // 1. Let requestResponses be the result of running Query Cache with operation’s request.
+        // 2. For each requestResponse of requestResponses:
+        //     1. Remove the item whose value matches requestResponse from cache.
+        auto request_responses = list->query_cache(*inner_request, {});
+        list->entries().remove_all_matching([&](auto const& entry) {
+            return any_of(request_responses, [&](auto const& request_response) { return request_response.request == entry.request; });
+        });
+
+        // 3. Append operation’s request/operation’s response to cache.
+        list->entries().append({ inner_request, cloned_response, move(cached_body) });
+
+        WebIDL::resolve_promise(realm, promise, JS::js_undefined());
+    });
+
+    // 10. Let bodyReadPromise be a promise resolved with undefined.
+    // 11. If innerResponse’s body is non-null, run these substeps:
+    if (!body) {
+        store->function()(nullptr);
+        return promise;
+    }
+
+    //     1. Let stream be innerResponse’s body’s stream.
+    //     2. Let reader be the result of getting a reader for stream.
+    //     3. Set bodyReadPromise to the result of reading all bytes from reader.
+    auto process_body = GC::create_function(realm.heap(), [store](ByteBuffer bytes) {
+        store->function()(CachedResponseBody::create(move(bytes)));
+    });
+    auto process_body_error = GC::create_function(realm.heap(), [&realm, promise](JS::Value error) {
+        HTML::TemporaryExecutionContext context { realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes };
+        WebIDL::reject_promise(realm, promise, error);
+    });
+    body->fully_read(realm, process_body, process_body_error, GC::Ref { HTML::relevant_global_object(*this) });
+
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-delete
+GC::Ref<WebIDL::Promise> Cache::delete_(Fetch::RequestInfo const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let r be null.
+    // 2. If request is a Request object, then:
+    //     1. Set r to request’s request.
+    //     2. If r’s method is not `GET` and options.ignoreMethod is false, return a promise resolved with false.
+    // 3. Else if request is a string, then:
+    //     1. Set r to the associated request of the result of invoking the initial value of Request as constructor with
+    //        request as its argument. If this throws an exception, return a promise rejected with that exception.
+    auto maybe_request = inner_request_for(realm, request);
+    if (maybe_request.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, maybe_request.release_error());
+    auto r = maybe_request.release_value();
+
+    if (r->method() != "GET"sv.bytes() && !options.ignore_method)
+        return WebIDL::create_resolved_promise(realm, JS::Value(false));
+
+    // 4. Let operations be an empty list.
+    // 5. Let operation be a cache batch operation.
+    // 6. Set operation’s type to "delete".
+    // 7. Set operation’s request to r.
+    // 8. Set operation’s options to options.
+    // 9. Append operation to operations.
+    // 10. Let realm be this’s relevant realm.
+    // 11. Let cacheJobPromise be a new promise.
+    // 12. Run the following substeps in parallel:
+    //     1. Let errorData be null.
+    //     2. Let requestResponses be the result of running Batch Cache Operations with operations. If this throws an
+    //        exception, set errorData to the exception.
+    auto request_responses = m_request_response_list->query_cache(*r, options);
+    m_request_response_list->entries().remove_all_matching([&](auto const& entry) {
+        return any_of(request_responses, [&](auto const& request_response) { return request_response.request == entry.request; });
+    });
+
+    //     3. Queue a task, on cacheJobPromise’s relevant settings object’s responsible event loop using the DOM
+    //        manipulation task source, to perform the following substeps:
+    //         1. If errorData is null, then:
+    //             1. If requestResponses is not empty, resolve cacheJobPromise with true.
+    //             2. Else, resolve cacheJobPromise with false.
+    //         2. Else, reject cacheJobPromise with a new exception with errorData and a user agent-defined message, in
+    //            realm.
+    // 13. Return cacheJobPromise.
+    return WebIDL::create_resolved_promise(realm, JS::Value(!request_responses.is_empty()));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-keys
+GC::Ref<WebIDL::Promise> Cache::keys(Optional<Fetch::RequestInfo> const& request, CacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. Let r be null.
+    GC::Ptr<Fetch::Infrastructure::Request> r;
+
+    // 2. If the optional argument request is not omitted, then:
+    if (request.has_value()) {
+        // 1. If request is a Request object, then:
+        //     1. Set r to request’s request.
+        //     2. If r’s method is not `GET` and options.ignoreMethod is false, return a promise resolved with an empty
+        //        array.
+        // 2. Else if request is a string, then:
+        //     1. Set r to the associated request of the result of invoking the initial value of Request as constructor
+        //        with request as its argument. If this throws an exception, return a promise rejected with that
+        //        exception.
+        auto inner_request = inner_request_for(realm, *request);
+        if (inner_request.is_exception())
+            return WebIDL::create_rejected_promise_from_exception(realm, inner_request.release_error());
+
+        r = inner_request.release_value();
+        if (r->method() != "GET"sv.bytes() && !options.ignore_method)
+            return WebIDL::create_resolved_promise(realm, create_frozen_array(realm, GC::RootVector<JS::Value> { realm.heap() }));
+    }
+
+    // 3. Let realm be this’s relevant realm.
+    // 4. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 5. Run these substeps in parallel:
+    //     1. Let requests be an empty list.
+    //     2. If the optional argument request is omitted, then:
+    //         1. For each requestResponse of the relevant request response list:
+    //             1. Add requestResponse’s request to requests.
+    //     3. Else:
+    //         1. Let requestResponses be the result of running Query Cache with r and options.
+    //         2. For each requestResponse of requestResponses:
+    //             1. Add requestResponse’s request to requests.
+    auto request_responses = r ? m_request_response_list->query_cache(*r, options) : m_request_response_list->entries();
+
+    //     4. Queue a task, on promise’s relevant settings object’s responsible event loop using the DOM manipulation
+    //        task source, to perform the following steps:
+    //         1. Let requestList be a list.
+    GC::RootVector<JS::Value> request_list { realm.heap() };
+
+    //         2. For each request of requests:
+    //             1. Add a new Request object associated with request and a new associated Headers object whose guard
+    //                is "request" to requestList.
+    for (auto const& request_response : request_responses)
+        request_list.append(Fetch::Request::create(realm, request_response.request, Fetch::Headers::Guard::Request, MUST(DOM::AbortSignal::construct_impl(realm))));
+
+    //         3. Resolve promise with a frozen array created from requestList, in realm.
+    WebIDL::resolve_promise(realm, promise, create_frozen_array(realm, request_list));
+
+    // 6. Return promise.
+    return promise;
+}
+
+}
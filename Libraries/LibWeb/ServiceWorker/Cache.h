@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
+#include <AK/Vector.h>
+#include <LibJS/Heap/Cell.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Fetch/Request.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::ServiceWorker {
+
+// https://w3c.github.io/ServiceWorker/#dictdef-cachequeryoptions
+struct CacheQueryOptions {
+    bool ignore_search { false };
+    bool ignore_method { false };
+    bool ignore_vary { false };
+};
+
+// The bytes of the body of a cached response. Bodies are content-addressed, so that responses with identical bodies
+// (e.g. the same asset cached under several URLs, or in several caches) share a single copy of their bytes.
+class CachedResponseBody : public RefCounted<CachedResponseBody> {
+public:
+    static NonnullRefPtr<CachedResponseBody> create(ByteBuffer);
+    ~CachedResponseBody();
+
+    ReadonlyBytes bytes() const { return m_bytes; }
+
+private:
+    CachedResponseBody(ByteBuffer, u32 hash);
+
+    ByteBuffer m_bytes;
+    u32 m_hash { 0 };
+};
+
+// https://w3c.github.io/ServiceWorker/#dfn-request-response-list
+class RequestResponseList final : public JS::Cell {
+    GC_CELL(RequestResponseList, JS::Cell);
+    GC_DECLARE_ALLOCATOR(RequestResponseList);
+
+public:
+    // NOTE: Cached responses do not keep a body, as bodies are tied to the realm that created their stream. Their bytes
+    //       are kept in a CachedResponseBody instead, and handed out as a new body in the realm of each match.
+    struct Entry {
+        GC::Ref<Fetch::Infrastructure::Request> request;
+        GC::Ref<Fetch::Infrastructure::Response> response;
+        RefPtr<CachedResponseBody> body;
+    };
+
+    [[nodiscard]] static GC::Ref<RequestResponseList> create(JS::VM&);
+
+    Vector<Entry>& entries() { return m_entries; }
+    Vector<Entry> const& entries() const { return m_entries; }
+
+    Vector<Entry> query_cache(Fetch::Infrastructure::Request const& request_query, CacheQueryOptions const&) const;
+
+private:
+    RequestResponseList() = default;
+
+    virtual void visit_edges(Visitor&) override;
+
+    Vector<Entry> m_entries;
+};
+
+// https://w3c.github.io/ServiceWorker/#cache-interface
+class Cache final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(Cache, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(Cache);
+
+public:
+    [[nodiscard]] static GC::Ref<Cache> create(JS::Realm&, GC::Ref<RequestResponseList>);
+
+    GC::Ref<WebIDL::Promise> match(Fetch::RequestInfo const&, CacheQueryOptions const&);
+    GC::Ref<WebIDL::Promise> match_all(Optional<Fetch::RequestInfo> const&, CacheQueryOptions const&);
+    GC::Ref<WebIDL::Promise> add(Fetch::RequestInfo const&);
+    GC::Ref<WebIDL::Promise> add_all(Vector<Fetch::RequestInfo> const&);
+    GC::Ref<WebIDL::Promise> put(Fetch::RequestInfo const&, GC::Ref<Fetch::Response>);
+    GC::Ref<WebIDL::Promise> delete_(Fetch::RequestInfo const&, CacheQueryOptions const&);
+    GC::Ref<WebIDL::Promise> keys(Optional<Fetch::RequestInfo> const&, CacheQueryOptions const&);
+
+private:
+    Cache(JS::Realm&, GC::Ref<RequestResponseList>);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Visitor&) override;
+
+    // https://w3c.github.io/ServiceWorker/#dfn-cache-request-response-list
+    GC::Ref<RequestResponseList> m_request_response_list;
+};
+
+GC::Ref<Fetch::Response> create_response_object_for_cached_entry(JS::Realm&, RequestResponseList::Entry const&);
+
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGC/RootVector.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/Realm.h>
+#include <LibWeb/Bindings/CacheStoragePrototype.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/ServiceWorker/CacheStorage.h>
+#include <LibWeb/StorageAPI/StorageKey.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::ServiceWorker {
+
+GC_DEFINE_ALLOCATOR(CacheStorage);
+
+// NOTE: The caches of every storage key live for as long as this process. They are shared between every global object
+//       of the storage key, which is why they are rooted rather than owned by a CacheStorage object.
+static HashMap<StorageAPI::StorageKey, NameToCacheMap>& name_to_cache_maps()
+{
+    static HashMap<StorageAPI::StorageKey, NameToCacheMap> name_to_cache_maps;
+    return name_to_cache_maps;
+}
+
+GC::Ref<CacheStorage> CacheStorage::create(JS::Realm& realm)
+{
+    return realm.create<CacheStorage>(realm);
+}
+
+CacheStorage::CacheStorage(JS::Realm& realm)
+    : Bindings::PlatformObject(realm)
+{
+}
+
+void CacheStorage::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(CacheStorage);
+    Base::initialize(realm);
+}
+
+// https://w3c.github.io/ServiceWorker/#cachestorage-relevant-name-to-cache-map
+Optional<NameToCacheMap&> CacheStorage::relevant_name_to_cache_map()
+{
+    // The relevant name to cache map for a CacheStorage object is the name to cache map associated with the result of
+    // running obtain a local storage bottle map with the object’s relevant settings object and "caches".
+    auto storage_key = StorageAPI::obtain_a_storage_key(HTML::relevant_settings_object(*this));
+    if (!storage_key.has_value())
+        return {};
+
+    return name_to_cache_maps().ensure(storage_key.release_value());
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-match
+GC::Ref<WebIDL::Promise> CacheStorage::match(Fetch::RequestInfo const& request, MultiCacheQueryOptions const& options)
+{
+    auto& realm = this->realm();
+
+    auto name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map.has_value())
+        return WebIDL::create_rejected_promise(realm, WebIDL::SecurityError::create(realm, "Failed to obtain a storage key"_string));
+
+    // 1. If options["cacheName"] exists, then:
+    if (options.cache_name.has_value()) {
+        // 1. Return a new promise promise and run the following substeps in parallel:
+        //     1. For each cacheName → cache of the relevant name to cache map:
+        //         1. If options["cacheName"] matches cacheName, then:
+        //             1. Resolve promise with the result of running the algorithm specified in match(request, options)
+        //                method of Cache interface with request and options (providing cache as thisArgument to the
+        //                [[Call]] internal method of match(request, options).)
+        //             2. Abort these steps.
+        //     2. Resolve promise with undefined.
+        if (auto cache = name_to_cache_map->get(*options.cache_name); cache.has_value())
+            return Cache::create(realm, **cache)->match(request, options);
+
+        return WebIDL::create_resolved_promise(realm, JS::js_undefined());
+    }
+
+    // 2. Else:
+    //     1. Let promise be a promise resolved with undefined.
+    auto promise = WebIDL::create_resolved_promise(realm, JS::js_undefined());
+
+    //     2. For each cacheName → cache of the relevant name to cache map:
+    for (auto const& [cache_name, request_response_list] : *name_to_cache_map) {
+        // 1. Set promise to the result of reacting to itself with a fulfillment handler that, when called with argument
+        //    response, performs the following substeps:
+        //     1. If response is not undefined, return response.
+        //     2. Return the result of running the algorithm specified in match(request, options) method of Cache
+        //        interface with request and options as the arguments (providing cache as thisArgument to the [[Call]]
+        //        internal method of match(request, options).)
+        auto cache = Cache::create(realm, *request_response_list);
+        promise = WebIDL::upon_fulfillment(promise, GC::create_function(realm.heap(), [cache, request, options](JS::Value response) -> WebIDL::ExceptionOr<JS::Value> {
+            if (!response.is_undefined())
+                return response;
+            return cache->match(request, options)->promise();
+        }));
+    }
+
+    // 3. Return promise.
+    return promise;
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-has
+GC::Ref<WebIDL::Promise> CacheStorage::has(String const& cache_name)
+{
+    auto& realm = this->realm();
+
+    auto name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map.has_value())
+        return WebIDL::create_rejected_promise(realm, WebIDL::SecurityError::create(realm, "Failed to obtain a storage key"_string));
+
+    // 1. Let promise be a new promise.
+    // 2. Run the following substeps in parallel:
+    //     1. For each key → value of the relevant name to cache map:
+    //         1. If cacheName matches key, resolve promise with true and abort these steps.
+    //     2. Resolve promise with false.
+    // 3. Return promise.
+    return WebIDL::create_resolved_promise(realm, JS::Value(name_to_cache_map->contains(cache_name)));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-open
+GC::Ref<WebIDL::Promise> CacheStorage::open(String const& cache_name)
+{
+    auto& realm = this->realm();
+
+    auto name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map.has_value())
+        return WebIDL::create_rejected_promise(realm, WebIDL::SecurityError::create(realm, "Failed to obtain a storage key"_string));
+
+    // 1. Let promise be a new promise.
+    // 2. Run the following substeps in parallel:
+    //     1. For each key → value of the relevant name to cache map:
+    //         1. If cacheName matches key, then:
+    //             1. Resolve promise with a new Cache object that represents value.
+    //             2. Abort these steps.
+    if (auto cache = name_to_cache_map->get(cache_name); cache.has_value())
+        return WebIDL::create_resolved_promise(realm, Cache::create(realm, **cache));
+
+    //     2. Let cache be a new request response list.
+    auto cache = RequestResponseList::create(realm.vm());
+
+    //     3. Set the relevant name to cache map[cacheName] to cache. If this cache write operation failed due to
+    //        exceeding the granted quota limit, reject promise with a "QuotaExceededError" DOMException and abort these
+    //        steps.
+    name_to_cache_map->set(cache_name, GC::make_root(cache));
+
+    //     4. Resolve promise with a new Cache object that represents cache.
+    // 3. Return promise.
+    return WebIDL::create_resolved_promise(realm, Cache::create(realm, cache));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-delete
+GC::Ref<WebIDL::Promise> CacheStorage::delete_(String const& cache_name)
+{
+    auto& realm = this->realm();
+
+    auto name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map.has_value())
+        return WebIDL::create_rejected_promise(realm, WebIDL::SecurityError::create(realm, "Failed to obtain a storage key"_string));
+
+    // 1. Let promise be the result of running the algorithm specified in has(cacheName) method with cacheName.
+    // 2. Return the result of reacting to promise with a fulfillment handler that, when called with argument cacheExists,
+    //    performs the following substeps:
+    //     1. If cacheExists is false, then:
+    //         1. Return false.
+    //     2. Let cacheJobPromise be a new promise.
+    //     3. Run the following substeps in parallel:
+    //         1. Remove the relevant name to cache map[cacheName].
+    //         2. Resolve cacheJobPromise with true.
+    //     4. Return cacheJobPromise.
+    // NOTE: Cache objects that were opened before keep their request response list alive, as the spec requires.
+    return WebIDL::create_resolved_promise(realm, JS::Value(name_to_cache_map->remove(cache_name)));
+}
+
+// https://w3c.github.io/ServiceWorker/#cache-storage-keys
+GC::Ref<WebIDL::Promise> CacheStorage::keys()
+{
+    auto& realm = this->realm();
+
+    auto name_to_cache_map = relevant_name_to_cache_map();
+    if (!name_to_cache_map.has_value())
+        return WebIDL::create_rejected_promise(realm, WebIDL::SecurityError::create(realm, "Failed to obtain a storage key"_string));
+
+    // 1. Let promise be a new promise.
+    // 2. Run the following substeps in parallel:
+    //     1. Let cacheKeys be the result of getting the keys of the relevant name to cache map.
+    //     2. Resolve promise with cacheKeys.
+    // 3. Return promise.
+    auto cache_names = name_to_cache_map->keys();
+    auto cache_keys = JS::Array::create_from<String>(realm, cache_names, [&](auto const& cache_name) -> JS::Value {
+        return JS::PrimitiveString::create(realm.vm(), cache_name);
+    });
+    return WebIDL::create_resolved_promise(realm, cache_keys);
+}
+
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/String.h>
+#include <LibGC/Root.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/ServiceWorker/Cache.h>
+#include <LibWeb/WebIDL/Promise.h>
+
+namespace Web::ServiceWorker {
+
+// https://w3c.github.io/ServiceWorker/#dictdef-multicachequeryoptions
+struct MultiCacheQueryOptions : public CacheQueryOptions {
+    Optional<String> cache_name;
+};
+
+// https://w3c.github.io/ServiceWorker/#dfn-name-to-cache-map
+using NameToCacheMap = OrderedHashMap<String, GC::Root<RequestResponseList>>;
+
+// https://w3c.github.io/ServiceWorker/#cachestorage-interface
+class CacheStorage final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(CacheStorage, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(CacheStorage);
+
+public:
+    [[nodiscard]] static GC::Ref<CacheStorage> create(JS::Realm&);
+
+    GC::Ref<WebIDL::Promise> match(Fetch::RequestInfo const&, MultiCacheQueryOptions const&);
+    GC::Ref<WebIDL::Promise> has(String const& cache_name);
+    GC::Ref<WebIDL::Promise> open(String const& cache_name);
+    GC::Ref<WebIDL::Promise> delete_(String const& cache_name);
+    GC::Ref<WebIDL::Promise> keys();
+
+private:
+    explicit CacheStorage(JS::Realm&);
+
+    virtual void initialize(JS::Realm&) override;
+
+    Optional<NameToCacheMap&> relevant_name_to_cache_map();
+};
+
+}
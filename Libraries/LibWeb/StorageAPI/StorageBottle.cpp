@@ -7,6 +7,8 @@
 #include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/StorageAPI/StorageBottle.h>
 #include <LibWeb/StorageAPI/StorageEndpoint.h>
 #include <LibWeb/StorageAPI/StorageShed.h>
@@ -82,7 +84,53 @@ RefPtr<StorageBottle> obtain_a_local_storage_bottle_map(HTML::EnvironmentSetting
 {
     // To obtain a local storage bottle map, given an environment settings object environment and storage identifier identifier,
     // return the result of running obtain a storage bottle map with "local", environment, and identifier.
-    return obtain_a_storage_bottle_map(StorageType::Local, environment, identifier);
+    auto bottle = obtain_a_storage_bottle_map(StorageType::Local, environment, identifier);
+
+    // AD-HOC: Load the persisted map the first time it is obtained in this process.
+    if (bottle && !bottle->has_loaded_persisted_map) {
+        bottle->has_loaded_persisted_map = true;
+
+        if (auto const& origin = environment.origin(); !origin.is_opaque()) {
+            auto& page = as<HTML::Window>(environment.global_object()).page();
+            bottle->map = page.client().page_did_request_local_storage(origin.serialize());
+        }
+    }
+
+    return bottle;
+}
+
+void persist_local_storage_change(HTML::Window& window, StorageBottle& bottle, StorageChange change)
+{
+    auto const& origin = window.associated_document().origin();
+    if (origin.is_opaque())
+        return;
+
+    bottle.unpersisted_changes.append(move(change));
+    if (bottle.unpersisted_changes.size() > 1)
+        return;
+
+    // NOTE: Scripts tend to make many changes in a row, so they are coalesced into a single message to the browser process.
+    Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(window.heap(), [page = GC::Ref { window.page() }, bottle = NonnullRefPtr { bottle }, storage_key = origin.serialize()]() {
+        page->client().page_did_change_local_storage(storage_key, bottle->unpersisted_changes);
+        bottle->unpersisted_changes.clear();
+    }));
+}
+
+RefPtr<StorageBottle> existing_local_storage_bottle_map(StringView serialized_storage_key, StringView identifier)
+{
+    auto shelf = user_agent_storage_shed().existing_storage_shelf(serialized_storage_key);
+    if (!shelf.has_value())
+        return {};
+
+    auto bucket = shelf->bucket_map.get("default"sv);
+    if (!bucket.has_value())
+        return {};
+
+    auto bottle = bucket->bottle_map.get(identifier);
+    if (!bottle.has_value() || !(*bottle)->has_loaded_persisted_map)
+        return {};
+
+    return *bottle;
 }
 
 }
@@ -9,6 +9,7 @@
 #include <AK/HashMap.h>
 #include <AK/String.h>
 #include <LibWeb/Forward.h>
+#include <LibWeb/StorageAPI/StorageChange.h>
 #include <LibWeb/StorageAPI/StorageType.h>
 
 namespace Web::StorageAPI {
@@ -27,6 +28,12 @@ struct StorageBottle : public RefCounted<StorageBottle> {
     // the total amount of bytes it can hold. Null indicates the lack of a limit.
     Optional<u64> quota;
 
+    // AD-HOC: The local storage bottle maps of a WebContent process are copies of the ones persisted by the browser
+    //         process. A copy is only loaded once its map is first obtained, and the changes made to it are sent back
+    //         to the browser process in batches, once the current task is done.
+    bool has_loaded_persisted_map { false };
+    Vector<StorageChange> unpersisted_changes;
+
 private:
     explicit StorageBottle(Optional<u64> quota_)
         : quota(quota_)
@@ -49,4 +56,7 @@ RefPtr<StorageBottle> obtain_a_session_storage_bottle_map(HTML::EnvironmentSetti
 RefPtr<StorageBottle> obtain_a_local_storage_bottle_map(HTML::EnvironmentSettingsObject&, StringView storage_identifier);
 RefPtr<StorageBottle> obtain_a_storage_bottle_map(StorageType, HTML::EnvironmentSettingsObject&, StringView storage_identifier);
 
+void persist_local_storage_change(HTML::Window&, StorageBottle&, StorageChange);
+RefPtr<StorageBottle> existing_local_storage_bottle_map(StringView serialized_storage_key, StringView storage_identifier);
+
 }
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibIPC/Decoder.h>
+#include <LibIPC/Encoder.h>
+#include <LibWeb/StorageAPI/StorageChange.h>
+
+template<>
+ErrorOr<void> IPC::encode(Encoder& encoder, Web::StorageAPI::StorageChange const& change)
+{
+    TRY(encoder.encode(change.key));
+    TRY(encoder.encode(change.old_value));
+    TRY(encoder.encode(change.new_value));
+    TRY(encoder.encode(change.url));
+    return {};
+}
+
+template<>
+ErrorOr<Web::StorageAPI::StorageChange> IPC::decode(Decoder& decoder)
+{
+    auto key = TRY(decoder.decode<Optional<String>>());
+    auto old_value = TRY(decoder.decode<Optional<String>>());
+    auto new_value = TRY(decoder.decode<Optional<String>>());
+    auto url = TRY(decoder.decode<String>());
+
+    return Web::StorageAPI::StorageChange { move(key), move(old_value), move(new_value), move(url) };
+}
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <LibIPC/Forward.h>
+
+namespace Web::StorageAPI {
+
+// A change made to a local storage bottle map, as it is sent to the browser process to be persisted, and from there to
+// every other WebContent process that may hold the same map. The fields mirror the arguments of broadcasting a change:
+// a null key means the map was cleared, and a null new value means the key was removed.
+struct StorageChange {
+    Optional<String> key;
+    Optional<String> old_value;
+    Optional<String> new_value;
+    String url;
+};
+
+}
+
+namespace IPC {
+
+template<>
+ErrorOr<void> encode(Encoder&, Web::StorageAPI::StorageChange const&);
+
+template<>
+ErrorOr<Web::StorageAPI::StorageChange> decode(Decoder&);
+
+}
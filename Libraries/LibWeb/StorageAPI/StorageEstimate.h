@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Types.h>
+
+namespace Web::StorageAPI {
+
+// https://storage.spec.whatwg.org/#dictdef-storageestimate
+struct StorageEstimate {
+    u64 usage { 0 };
+    u64 quota { 0 };
+};
+
+}
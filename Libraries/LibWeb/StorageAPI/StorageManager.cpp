@@ -4,10 +4,18 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibJS/Runtime/Error.h>
+#include <LibJS/Runtime/Object.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/Bindings/PrincipalHostDefined.h>
 #include <LibWeb/Bindings/StorageManagerPrototype.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/StorageAPI/StorageEstimate.h>
 #include <LibWeb/StorageAPI/StorageManager.h>
+#include <LibWeb/StorageAPI/StorageShed.h>
 
 namespace Web::StorageAPI {
 
@@ -29,4 +37,56 @@ void StorageManager::initialize(JS::Realm& realm)
     Base::initialize(realm);
 }
 
+// https://storage.spec.whatwg.org/#dom-storagemanager-estimate
+GC::Ref<WebIDL::Promise> StorageManager::estimate() const
+{
+    auto& realm = this->realm();
+
+    // 1. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 2. Let global be this’s relevant global object.
+    auto& global = HTML::relevant_global_object(*this);
+
+    // 3. Let shelf be the result of running obtain a local storage shelf with this’s relevant settings object.
+    auto& environment = HTML::relevant_settings_object(*this);
+    auto shelf = user_agent_storage_shed().obtain_a_storage_shelf(environment, StorageType::Local);
+
+    // 4. If shelf is failure, then reject promise with a TypeError.
+    if (!shelf.has_value()) {
+        WebIDL::reject_promise(realm, promise, JS::TypeError::create(realm, "Failed to obtain a storage shelf"sv));
+        return promise;
+    }
+
+    // 5. Otherwise, run these steps in parallel:
+    //    1. Let usage be storage usage for shelf.
+    //    2. Let quota be storage quota for shelf.
+    // NOTE: The browser process keeps track of the usage of every storage key as it persists their storage, so this
+    //       does not have to walk through any of the stored data.
+    auto storage_key = obtain_a_storage_key(environment);
+    auto estimate = Bindings::principal_host_defined_page(HTML::principal_realm(realm)).client().page_did_request_storage_estimate(storage_key->origin.serialize());
+
+    //    3. Let dictionary be a new StorageEstimate dictionary whose usage member is usage and quota member is quota.
+    //    4. If there was an internal error while obtaining usage and quota, then queue a storage task with global to
+    //       reject promise with a TypeError.
+    //    5. Otherwise, queue a storage task with global to resolve promise with dictionary.
+    HTML::queue_global_task(HTML::Task::Source::Storage, global, GC::create_function(realm.heap(), [realm = GC::Ref { realm }, promise, estimate]() {
+        HTML::TemporaryExecutionContext context(realm);
+
+        if (!estimate.has_value()) {
+            WebIDL::reject_promise(realm, promise, JS::TypeError::create(realm, "Failed to estimate storage usage"sv));
+            return;
+        }
+
+        auto dictionary = JS::Object::create(realm, realm->intrinsics().object_prototype());
+        MUST(dictionary->create_data_property("usage"_fly_string, JS::Value(static_cast<double>(estimate->usage))));
+        MUST(dictionary->create_data_property("quota"_fly_string, JS::Value(static_cast<double>(estimate->quota))));
+
+        WebIDL::resolve_promise(realm, promise, dictionary);
+    }));
+
+    // 6. Return promise.
+    return promise;
+}
+
 }
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::StorageAPI {
 
@@ -18,6 +19,8 @@ public:
     static WebIDL::ExceptionOr<GC::Ref<StorageManager>> create(JS::Realm&);
     virtual ~StorageManager() override = default;
 
+    GC::Ref<WebIDL::Promise> estimate() const;
+
 private:
     StorageManager(JS::Realm&);
 
@@ -26,6 +26,16 @@ Optional<StorageShelf&> StorageShed::obtain_a_storage_shelf(HTML::EnvironmentSet
     });
 }
 
+Optional<StorageShelf&> StorageShed::existing_storage_shelf(StringView serialized_storage_key)
+{
+    for (auto& [key, shelf] : m_data) {
+        if (!key.origin.is_opaque() && key.origin.serialize() == serialized_storage_key)
+            return shelf;
+    }
+
+    return {};
+}
+
 // https://storage.spec.whatwg.org/#user-agent-storage-shed
 StorageShed& user_agent_storage_shed()
 {
@@ -20,6 +20,9 @@ class StorageShed {
 public:
     Optional<StorageShelf&> obtain_a_storage_shelf(HTML::EnvironmentSettingsObject const&, StorageType);
 
+    // Returns the shelf of the storage key with the given serialized origin, if it has been obtained before.
+    Optional<StorageShelf&> existing_storage_shelf(StringView serialized_storage_key);
+
 private:
     OrderedHashMap<StorageKey, StorageShelf> m_data;
 };
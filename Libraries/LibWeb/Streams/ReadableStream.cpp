@@ -276,7 +276,7 @@ WebIDL::ExceptionOr<GC::Ref<ReadableStreamDefaultReader>> ReadableStream::get_a_
 }
 
 // https://streams.spec.whatwg.org/#readablestream-pull-from-bytes
-WebIDL::ExceptionOr<void> ReadableStream::pull_from_bytes(ByteBuffer bytes)
+WebIDL::ExceptionOr<void> ReadableStream::pull_from_bytes(ByteBuffer& bytes)
 {
     auto& realm = this->realm();
 
@@ -298,7 +298,7 @@ WebIDL::ExceptionOr<void> ReadableStream::pull_from_bytes(ByteBuffer bytes)
     auto pull_size = min(available, desired_size);
 
     // 6. Let pulled be the first pullSize bytes of bytes.
-    auto pulled = pull_size == available ? move(bytes) : MUST(bytes.slice(0, pull_size));
+    auto pulled = pull_size == available ? exchange(bytes, {}) : MUST(bytes.slice(0, pull_size));
 
     // 7. Remove the first pullSize bytes from bytes.
     if (pull_size != available)
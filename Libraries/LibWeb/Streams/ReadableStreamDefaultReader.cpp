@@ -199,7 +199,7 @@ void ReadableStreamDefaultReader::read_a_chunk(Fetch::Infrastructure::Incrementa
 }
 
 // https://streams.spec.whatwg.org/#readablestreamdefaultreader-read-all-bytes
-void ReadableStreamDefaultReader::read_all_bytes(GC::Ref<ReadLoopReadRequest::SuccessSteps> success_steps, GC::Ref<ReadLoopReadRequest::FailureSteps> failure_steps)
+void ReadableStreamDefaultReader::read_all_bytes(GC::Ref<ReadLoopReadRequest::SuccessSteps> success_steps, GC::Ref<ReadLoopReadRequest::FailureSteps> failure_steps, Optional<u64> expected_length)
 {
     auto& realm = this->realm();
 
@@ -207,6 +207,12 @@ void ReadableStreamDefaultReader::read_all_bytes(GC::Ref<ReadLoopReadRequest::Su
     //    NOTE: items and steps in ReadLoopReadRequest.
     auto read_request = heap().allocate<ReadLoopReadRequest>(realm, *this, success_steps, failure_steps);
 
+    // OPTIMIZATION: If we know roughly how many bytes to expect, allocate room for them up front. The expectation may
+    //               come from an untrusted header, so cap it.
+    static constexpr u64 max_preallocated_length = 64 * MiB;
+    if (expected_length.has_value())
+        read_request->reserve_bytes(min(*expected_length, max_preallocated_length));
+
     // 2. Perform ! ReadableStreamDefaultReaderRead(this, readRequest).
     readable_stream_default_reader_read(*this, read_request);
 }
@@ -49,6 +49,9 @@ public:
     // AD-HOC: callback triggered on every chunk received from the stream.
     using ChunkSteps = GC::Function<void(ByteBuffer)>;
 
+    // AD-HOC: Allocates room for the bytes we expect to read up front, instead of growing the buffer chunk by chunk.
+    void reserve_bytes(size_t count) { (void)m_bytes.try_ensure_capacity(count); }
+
 private:
     ReadLoopReadRequest(JS::Realm&, ReadableStreamDefaultReader&, GC::Ref<SuccessSteps>, GC::Ref<FailureSteps>, GC::Ptr<ChunkSteps> = {});
 
@@ -91,7 +94,7 @@ public:
     GC::Ref<WebIDL::Promise> read();
 
     void read_a_chunk(Fetch::Infrastructure::IncrementalReadLoopReadRequest& read_request);
-    void read_all_bytes(GC::Ref<ReadLoopReadRequest::SuccessSteps>, GC::Ref<ReadLoopReadRequest::FailureSteps>);
+    void read_all_bytes(GC::Ref<ReadLoopReadRequest::SuccessSteps>, GC::Ref<ReadLoopReadRequest::FailureSteps>, Optional<u64> expected_length = {});
     GC::Ref<WebIDL::Promise> read_all_bytes_deprecated();
 
     void release_lock();
@@ -4,8 +4,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/TemporaryChange.h>
 #include <LibWeb/HTML/EventLoop/EventLoop.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/Streams/ReadableByteStreamController.h>
+#include <LibWeb/Streams/ReadableStreamDefaultController.h>
 #include <LibWeb/Streams/ReadableStreamDefaultReader.h>
 #include <LibWeb/Streams/ReadableStreamOperations.h>
 #include <LibWeb/Streams/ReadableStreamPipeTo.h>
@@ -102,6 +105,7 @@ void ReadableStreamPipeTo::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_signal);
     visitor.visit(m_pending_writes);
     visitor.visit(m_unwritten_chunks);
+    visitor.visit(m_read_request);
 }
 
 void ReadableStreamPipeTo::process()
@@ -109,6 +113,30 @@ void ReadableStreamPipeTo::process()
     if (check_for_error_and_close_states())
         return;
 
+    observe_closed_promises();
+
+    // OPTIMIZATION: Chunks that are already queued in the source can be read synchronously. While the destination is
+    //               ready for more, move them over in one batch, rather than taking a microtask and a trip through the
+    //               writer's ready promise for every chunk. Backpressure is still honored, as the writer's ready promise
+    //               is replaced by a pending one as soon as the destination's queue fills up.
+    while (source_has_queued_chunks()) {
+        if (auto ready_promise = m_writer->ready(); !ready_promise || !WebIDL::is_promise_fulfilled(*ready_promise))
+            break;
+
+        {
+            TemporaryChange reading_synchronously { m_reading_synchronously, true };
+            read_chunk();
+        }
+
+        if (m_unwritten_chunks.is_empty())
+            break;
+
+        write_chunk();
+
+        if (check_for_error_and_close_states())
+            return;
+    }
+
     auto ready_promise = m_writer->ready();
 
     if (ready_promise && WebIDL::is_promise_fulfilled(*ready_promise)) {
@@ -117,7 +145,7 @@ void ReadableStreamPipeTo::process()
     }
 
     auto when_ready = GC::create_function(m_realm->heap(), [this](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
-        read_chunk();
+        process();
         return JS::js_undefined();
     });
 
@@ -128,8 +156,6 @@ void ReadableStreamPipeTo::process()
 
     if (ready_promise)
         WebIDL::react_to_promise(*ready_promise, when_ready, shutdown);
-    if (auto promise = m_reader->closed())
-        WebIDL::react_to_promise(*promise, shutdown, shutdown);
 }
 
 void ReadableStreamPipeTo::set_abort_signal(GC::Ref<DOM::AbortSignal> signal, DOM::AbortSignal::AbortSignal::AbortAlgorithmID signal_id)
@@ -217,9 +243,21 @@ void ReadableStreamPipeTo::read_chunk()
     if (check_for_error_and_close_states())
         return;
 
+    readable_stream_default_reader_read(m_reader, read_request());
+}
+
+GC::Ref<ReadableStreamPipeToReadRequest> ReadableStreamPipeTo::read_request()
+{
+    if (m_read_request)
+        return *m_read_request;
+
     auto on_chunk = GC::create_function(heap(), [this](JS::Value chunk) {
         m_unwritten_chunks.append(chunk);
 
+        // The batch in process() writes chunks that were read synchronously itself.
+        if (m_reading_synchronously)
+            return;
+
         if (check_for_error_and_close_states())
             return;
 
@@ -240,13 +278,38 @@ void ReadableStreamPipeTo::read_chunk()
         return JS::js_undefined();
     });
 
-    auto read_request = heap().allocate<ReadableStreamPipeToReadRequest>(on_chunk, on_complete, shutdown);
-    readable_stream_default_reader_read(m_reader, read_request);
+    m_read_request = heap().allocate<ReadableStreamPipeToReadRequest>(on_chunk, on_complete, shutdown);
+    return *m_read_request;
+}
 
+void ReadableStreamPipeTo::observe_closed_promises()
+{
+    // The closed promises only settle once, so reacting to them a single time is enough, rather than piling up reactions
+    // for every chunk that passes through the pipe.
+    if (m_observing_closed_promises)
+        return;
+    m_observing_closed_promises = true;
+
+    auto shutdown = GC::create_function(heap(), [this](JS::Value) -> WebIDL::ExceptionOr<JS::Value> {
+        check_for_error_and_close_states();
+        return JS::js_undefined();
+    });
+
+    if (auto promise = m_reader->closed())
+        WebIDL::react_to_promise(*promise, shutdown, shutdown);
     if (auto promise = m_writer->closed())
         WebIDL::react_to_promise(*promise, shutdown, shutdown);
 }
 
+bool ReadableStreamPipeTo::source_has_queued_chunks() const
+{
+    auto const& controller = m_source->controller();
+    if (!controller.has_value())
+        return false;
+
+    return controller->visit([](auto const& controller) { return !controller->queue().is_empty(); });
+}
+
 void ReadableStreamPipeTo::write_chunk()
 {
     // Shutdown must stop activity: if shuttingDown becomes true, the user agent must not initiate further reads from
@@ -258,6 +321,9 @@ void ReadableStreamPipeTo::write_chunk()
     auto promise = writable_stream_default_writer_write(m_writer, m_unwritten_chunks.take_first());
     WebIDL::mark_promise_as_handled(promise);
 
+    // Writes that have already succeeded don't need to be waited for during shutdown, so don't keep the promise of every
+    // write of a long-running pipe alive.
+    m_pending_writes.remove_all_matching([](auto const& pending_write) { return WebIDL::is_promise_fulfilled(*pending_write); });
     m_pending_writes.append(promise);
 }
 
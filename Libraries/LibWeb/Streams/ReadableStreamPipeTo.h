@@ -15,6 +15,8 @@
 
 namespace Web::Streams::Detail {
 
+class ReadableStreamPipeToReadRequest;
+
 // https://streams.spec.whatwg.org/#ref-for-in-parallel
 class ReadableStreamPipeTo final : public JS::Cell {
     GC_CELL(ReadableStreamPipeTo, JS::Cell);
@@ -45,6 +47,10 @@ private:
     void read_chunk();
     void write_chunk();
 
+    GC::Ref<ReadableStreamPipeToReadRequest> read_request();
+    void observe_closed_promises();
+    bool source_has_queued_chunks() const;
+
     void write_unwritten_chunks();
     void wait_for_pending_writes_to_complete(Function<void()> on_complete);
 
@@ -71,6 +77,11 @@ private:
     Vector<GC::Ref<WebIDL::Promise>> m_pending_writes;
     Vector<JS::Value, 1> m_unwritten_chunks;
 
+    // Every read of the pipe goes through the same read request, as only one read is ever outstanding.
+    GC::Ptr<ReadableStreamPipeToReadRequest> m_read_request;
+    bool m_reading_synchronously { false };
+    bool m_observing_closed_promises { false };
+
     bool m_prevent_close { false };
     bool m_prevent_abort { false };
     bool m_prevent_cancel { false };
@@ -9,6 +9,7 @@
 #include <AK/MemoryStream.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
+#include <LibCrypto/Hash/SHA2.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -410,18 +411,74 @@ JS::ThrowCompletionOr<NonnullOwnPtr<Wasm::ModuleInstance>> instantiate_module(JS
 }
 
 // // https://webassembly.github.io/spec/js-api/#compile-a-webassembly-module
+// OPTIMIZATION: Pages loaded into the same process often compile the exact same module, e.g. a common Emscripten
+//               runtime on every navigation. Validated modules are never modified, so they are shared between all
+//               realms by the SHA-256 digest of their bytes instead of being parsed and validated again.
+struct ValidatedModuleCacheEntry {
+    Crypto::Hash::SHA256::DigestType digest;
+    NonnullRefPtr<Wasm::Module> module;
+};
+
+static constexpr size_t max_number_of_validated_modules_to_cache = 16;
+static constexpr size_t minimum_module_size_for_validated_module_cache = 4 * KiB;
+
+static Vector<ValidatedModuleCacheEntry>& validated_module_cache()
+{
+    static Vector<ValidatedModuleCacheEntry> cache;
+    return cache;
+}
+
+static RefPtr<Wasm::Module> find_validated_module(Crypto::Hash::SHA256::DigestType const& digest)
+{
+    auto& cache = validated_module_cache();
+    for (size_t i = 0; i < cache.size(); ++i) {
+        if (cache[i].digest.bytes() != digest.bytes())
+            continue;
+
+        // Keep the most recently used module at the front.
+        auto entry = cache.take(i);
+        auto module = entry.module;
+        cache.prepend(move(entry));
+        return module;
+    }
+    return nullptr;
+}
+
+static void cache_validated_module(Crypto::Hash::SHA256::DigestType const& digest, NonnullRefPtr<Wasm::Module> module)
+{
+    auto& cache = validated_module_cache();
+    if (cache.size() >= max_number_of_validated_modules_to_cache)
+        cache.take_last();
+    cache.prepend({ digest, move(module) });
+}
+
 JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::VM& vm, ByteBuffer data)
 {
+    auto& cache = get_cache(*vm.current_realm());
+
+    Optional<Crypto::Hash::SHA256::DigestType> digest;
+    if (data.size() >= minimum_module_size_for_validated_module_cache) {
+        digest = Crypto::Hash::SHA256::hash(data);
+        if (auto module = find_validated_module(*digest)) {
+            auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module.release_nonnull());
+            cache.add_compiled_module(compiled_module);
+            return compiled_module;
+        }
+    }
+
     FixedMemoryStream stream { data.bytes() };
     auto module_result = Wasm::Module::parse(stream);
     if (module_result.is_error()) {
         return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
     }
 
-    auto& cache = get_cache(*vm.current_realm());
     if (auto validation_result = cache.abstract_machine().validate(module_result.value()); validation_result.is_error()) {
         return vm.throw_completion<CompileError>(validation_result.error().error_string);
     }
+
+    if (digest.has_value())
+        cache_validated_module(*digest, module_result.value());
+
     auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module_result.release_value());
     cache.add_compiled_module(compiled_module);
     return compiled_module;
@@ -632,6 +689,8 @@ GC::Ref<WebIDL::Promise> asynchronously_compile_webassembly_module(JS::VM& vm, B
     auto promise = WebIDL::create_promise(realm);
 
     // 2. Run the following steps in parallel:
+    // FIXME: Parse and validate the module on a background thread, and start doing so while the response body is
+    //        still streaming in. This currently happens on the event loop once all of the bytes have arrived.
     Platform::EventLoopPlugin::the().deferred_invoke(GC::create_function(vm.heap(), [&vm, &realm, bytes = move(bytes), promise, task_source]() mutable {
         HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
         // 1. Compile the WebAssembly module bytes and store the result as module.
@@ -834,16 +893,15 @@ GC::Ref<WebIDL::Promise> compile_potential_webassembly_response(JS::VM& vm, GC::
         // 9. Upon fulfillment of bodyPromise with value bodyArrayBuffer:
         auto body_fulfillment_steps = GC::create_function(vm.heap(), [&vm, return_value](JS::Value body_array_buffer) -> WebIDL::ExceptionOr<JS::Value> {
             // 1. Let stableBytes be a copy of the bytes held by the buffer bodyArrayBuffer.
-            VERIFY(body_array_buffer.is_object());
-            auto stable_bytes = WebIDL::get_buffer_source_copy(body_array_buffer.as_object());
-            if (stable_bytes.is_error()) {
-                VERIFY(stable_bytes.error().code() == ENOMEM);
-                WebIDL::reject_promise(HTML::relevant_realm(*return_value->promise()), return_value, vm.throw_completion<JS::InternalError>(vm.error_message(JS::VM::ErrorMessage::OutOfMemory)).value());
-                return JS::js_undefined();
-            }
+            // OPTIMIZATION: bodyArrayBuffer was created by consuming the response's body above and is never exposed to
+            //               script, so nothing can observe its contents changing. Take its bytes instead of copying what
+            //               may well be a module of several megabytes.
+            auto& array_buffer = as<JS::ArrayBuffer>(body_array_buffer.as_object());
+            auto stable_bytes = move(array_buffer.buffer());
+            array_buffer.detach_buffer();
 
             // 2. Asynchronously compile the WebAssembly module stableBytes using the networking task source and resolve returnValue with the result.
-            auto result = asynchronously_compile_webassembly_module(vm, stable_bytes.release_value(), HTML::Task::Source::Networking);
+            auto result = asynchronously_compile_webassembly_module(vm, move(stable_bytes), HTML::Task::Source::Networking);
 
             // Need to manually convert WebIDL promise to an ECMAScript value here to resolve
             WebIDL::resolve_promise(HTML::relevant_realm(*return_value->promise()), return_value, result->promise());
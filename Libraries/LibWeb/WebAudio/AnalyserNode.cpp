@@ -13,6 +13,7 @@
 #include <LibWeb/Bindings/AnalyserNodePrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/WebAudio/AnalyserNode.h>
+#include <LibWeb/WebAudio/DSP.h>
 #include <LibWeb/WebIDL/Buffers.h>
 #include <LibWeb/WebIDL/DOMException.h>
 
@@ -79,24 +80,32 @@ Vector<f32> AnalyserNode::apply_a_blackman_window(Vector<f32> const& x) const
 // https://webaudio.github.io/web-audio-api/#fourier-transform
 static Vector<f32> apply_a_fourier_transform(Vector<f32> const& input)
 {
-    dbgln("FIXME: Analyser node: implement apply a fourier transform");
-    auto result = Vector<f32>();
-    result.resize(input.size());
+    // X[k] = 1/N * sum(x̂[n] * e^(-2πikn/N)), for k = 0, ..., N/2 - 1
+    // NOTE: Only the magnitude of X[k] is used from here on, so that is what gets returned.
+    auto real = input;
+    Vector<f32> imaginary;
+    imaginary.resize(input.size());
+    DSP::fft(real.span(), imaginary.span());
+
+    auto const scale = 1.0f / static_cast<f32>(input.size());
+    Vector<f32> result;
+    result.ensure_capacity(input.size() / 2);
+    for (size_t k = 0; k < input.size() / 2; k++)
+        result.unchecked_append(AK::hypot(real[k], imaginary[k]) * scale);
     return result;
 }
 
 // https://webaudio.github.io/web-audio-api/#smoothing-over-time
 Vector<f32> AnalyserNode::smoothing_over_time(Vector<f32> const& current_block)
 {
-    auto X = apply_a_fourier_transform(current_block);
+    // NOTE: current_block holds the magnitudes of the current block's Fourier transform.
+    auto const& X = current_block;
 
     // FIXME: Naive
     Vector<f32> result;
-    result.ensure_capacity(m_fft_size);
-    for (unsigned long i = 0; i < m_fft_size; i++) {
-        // FIXME: Complex modulus on X[i]
-        result.unchecked_append(m_smoothing_time_constant * m_previous_block[i] + (1.f - m_smoothing_time_constant) * abs(X[i]));
-    }
+    result.ensure_capacity(X.size());
+    for (size_t i = 0; i < X.size(); i++)
+        result.unchecked_append(m_smoothing_time_constant * m_previous_block[i] + (1.f - m_smoothing_time_constant) * X[i]);
 
     m_previous_block = result;
 
@@ -110,7 +119,7 @@ Vector<f32> AnalyserNode::conversion_to_dB(Vector<f32> const& X_hat) const
     result.ensure_capacity(X_hat.size());
     // FIXME: Naive
     for (auto x : X_hat)
-        result.unchecked_append(20.0f * AK::log(x));
+        result.unchecked_append(20.0f * AK::log10(x));
 
     return result;
 }
@@ -146,6 +146,21 @@ AudioBuffer::AudioBuffer(JS::Realm& realm, AudioBufferOptions const& options)
 {
 }
 
+// https://webaudio.github.io/web-audio-api/#acquire-the-content
+Vector<Vector<float>> AudioBuffer::acquire_the_content() const
+{
+    // NOTE: Instead of detaching the channel data and handing out the underlying data blocks, the content is copied, so
+    //       that the rendering thread gets data that script can no longer modify.
+    Vector<Vector<float>> content;
+    content.ensure_capacity(m_channels.size());
+    for (auto const& channel : m_channels) {
+        Vector<float> channel_content;
+        channel_content.append(channel->data().data(), channel->data().size());
+        content.unchecked_append(move(channel_content));
+    }
+    return content;
+}
+
 void AudioBuffer::initialize(JS::Realm& realm)
 {
     WEB_SET_PROTOTYPE_FOR_INTERFACE(AudioBuffer);
@@ -40,6 +40,8 @@ public:
     WebIDL::ExceptionOr<void> copy_from_channel(GC::Root<WebIDL::BufferSource> const&, WebIDL::UnsignedLong channel_number, WebIDL::UnsignedLong buffer_offset = 0) const;
     WebIDL::ExceptionOr<void> copy_to_channel(GC::Root<WebIDL::BufferSource> const&, WebIDL::UnsignedLong channel_number, WebIDL::UnsignedLong buffer_offset = 0);
 
+    Vector<Vector<float>> acquire_the_content() const;
+
 private:
     explicit AudioBuffer(JS::Realm&, AudioBufferOptions const&);
 
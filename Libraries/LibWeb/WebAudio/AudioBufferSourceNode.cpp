@@ -9,6 +9,7 @@
 #include <LibWeb/WebAudio/AudioBuffer.h>
 #include <LibWeb/WebAudio/AudioBufferSourceNode.h>
 #include <LibWeb/WebAudio/AudioParam.h>
+#include <LibWeb/WebAudio/AudioRenderGraph.h>
 #include <LibWeb/WebAudio/AudioScheduledSourceNode.h>
 
 namespace Web::WebAudio {
@@ -45,7 +46,13 @@ WebIDL::ExceptionOr<void> AudioBufferSourceNode::set_buffer(GC::Ptr<AudioBuffer>
     // 4. Assign new buffer to the buffer attribute.
     m_buffer = new_buffer;
 
-    // FIXME: 5. If start() has previously been called on this node, perform the operation acquire the content on buffer.
+    // 5. If start() has previously been called on this node, perform the operation acquire the content on buffer.
+    if (source_started() && new_buffer) {
+        render_graph().queue_control_message([&node = render_buffer_source_node(), content = new_buffer->acquire_the_content(), sample_rate = new_buffer->sample_rate()]() mutable {
+            swap(node.buffer, content);
+            node.buffer_sample_rate = sample_rate;
+        });
+    }
 
     return {};
 }
@@ -72,6 +79,7 @@ GC::Ref<AudioParam> AudioBufferSourceNode::detune() const
 WebIDL::ExceptionOr<void> AudioBufferSourceNode::set_loop(bool loop)
 {
     m_loop = loop;
+    update_render_loop();
     return {};
 }
 
@@ -85,6 +93,7 @@ bool AudioBufferSourceNode::loop() const
 WebIDL::ExceptionOr<void> AudioBufferSourceNode::set_loop_start(double loop_start)
 {
     m_loop_start = loop_start;
+    update_render_loop();
     return {};
 }
 
@@ -98,6 +107,7 @@ double AudioBufferSourceNode::loop_start() const
 WebIDL::ExceptionOr<void> AudioBufferSourceNode::set_loop_end(double loop_end)
 {
     m_loop_end = loop_end;
+    update_render_loop();
     return {};
 }
 
@@ -130,14 +140,49 @@ WebIDL::ExceptionOr<void> AudioBufferSourceNode::start(Optional<double> when, Op
     // 3. Set the internal slot [[source started]] on this AudioBufferSourceNode to true.
     set_source_started(true);
 
-    // FIXME: 4. Queue a control message to start the AudioBufferSourceNode, including the parameter values in the message.
-    // FIXME: 5. Acquire the contents of the buffer if the buffer has been set.
-    // FIXME: 6. Send a control message to the associated AudioContext to start running its rendering thread only when all the following conditions are met:
-
-    dbgln("FIXME: Implement AudioBufferSourceNode::start(when, offset, duration)");
+    // 4. Queue a control message to start the AudioBufferSourceNode, including the parameter values in the message.
+    // 5. Acquire the contents of the buffer if the buffer has been set.
+    // 6. Send a control message to the associated AudioContext to start running its rendering thread only when all the following conditions are met:
+    Vector<Vector<float>> content;
+    float buffer_sample_rate = 0;
+    if (m_buffer) {
+        content = m_buffer->acquire_the_content();
+        buffer_sample_rate = m_buffer->sample_rate();
+    }
+
+    queue_start_control_message(when.value_or(0), [content = move(content), buffer_sample_rate, offset = offset.value_or(0), duration](RenderScheduledSourceNode& node) mutable {
+        auto& buffer_source_node = static_cast<RenderAudioBufferSourceNode&>(node);
+        swap(buffer_source_node.buffer, content);
+        buffer_source_node.buffer_sample_rate = buffer_sample_rate;
+        buffer_source_node.offset = offset;
+        buffer_source_node.duration = duration;
+    });
     return {};
 }
 
+RenderAudioBufferSourceNode& AudioBufferSourceNode::render_buffer_source_node()
+{
+    return static_cast<RenderAudioBufferSourceNode&>(render_node());
+}
+
+void AudioBufferSourceNode::update_render_loop()
+{
+    render_graph().queue_control_message([&node = render_buffer_source_node(), loop = m_loop, loop_start = m_loop_start, loop_end = m_loop_end] {
+        node.loop = loop;
+        node.loop_start = loop_start;
+        node.loop_end = loop_end;
+    });
+}
+
+RenderNode& AudioBufferSourceNode::create_render_node(AudioRenderGraph& graph)
+{
+    auto& node = graph.create_node<RenderAudioBufferSourceNode>(m_playback_rate->render_param(), m_detune->render_param());
+    node.loop = m_loop;
+    node.loop_start = m_loop_start;
+    node.loop_end = m_loop_end;
+    return node;
+}
+
 WebIDL::ExceptionOr<GC::Ref<AudioBufferSourceNode>> AudioBufferSourceNode::create(JS::Realm& realm, GC::Ref<BaseAudioContext> context, AudioBufferSourceOptions const& options)
 {
     return construct_impl(realm, context, options);
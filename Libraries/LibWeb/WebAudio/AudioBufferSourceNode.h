@@ -55,7 +55,12 @@ protected:
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
+    virtual RenderNode& create_render_node(AudioRenderGraph&) override;
+
 private:
+    RenderAudioBufferSourceNode& render_buffer_source_node();
+    void update_render_loop();
+
     GC::Ptr<AudioBuffer> m_buffer;
     GC::Ref<AudioParam> m_playback_rate;
     GC::Ref<AudioParam> m_detune;
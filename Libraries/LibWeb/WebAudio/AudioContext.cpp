@@ -14,6 +14,7 @@
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/WebAudio/AudioContext.h>
 #include <LibWeb/WebAudio/AudioDestinationNode.h>
+#include <LibWeb/WebAudio/AudioRenderGraph.h>
 #include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::WebAudio {
@@ -94,6 +95,7 @@ WebIDL::ExceptionOr<GC::Ref<AudioContext>> AudioContext::construct_impl(JS::Real
 
         // 2. Set this [[rendering thread state]] to running on the AudioContext.
         context->set_rendering_state(Bindings::AudioContextState::Running);
+        context->start_rendering_audio_graph();
 
         // 3. Queue a media element task to execute the following steps:
         context->queue_a_media_element_task(GC::create_function(context->heap(), [&realm, context]() {
@@ -253,7 +255,8 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> AudioContext::suspend()
     // 7. Queue a control message to suspend the AudioContext.
     // FIXME: Implement control message queue to run following steps on the rendering thread
 
-    // FIXME: 7.1: Attempt to release system resources.
+    // 7.1: Attempt to release system resources.
+    render_graph().suspend_rendering();
 
     // 7.2: Set the [[rendering thread state]] on the AudioContext to suspended.
     set_rendering_state(Bindings::AudioContextState::Suspended);
@@ -306,7 +309,8 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> AudioContext::close()
     // 5. Queue a control message to close the AudioContext.
     // FIXME: Implement control message queue to run following steps on the rendering thread
 
-    // FIXME: 5.1: Attempt to release system resources.
+    // 5.1: Attempt to release system resources.
+    render_graph().stop_rendering();
 
     // 5.2: Set the [[rendering thread state]] to "suspended".
     set_rendering_state(Bindings::AudioContextState::Suspended);
@@ -335,11 +339,36 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> AudioContext::close()
     return promise;
 }
 
-// FIXME: Actually implement the rendering thread
 bool AudioContext::start_rendering_audio_graph()
 {
-    bool render_result = true;
-    return render_result;
+    // NOTE: There is no need to hold on to an audio output while nothing in the graph can make a sound.
+    if (!m_has_started_sources)
+        return true;
+
+    auto& graph = render_graph();
+    if (graph.is_rendering()) {
+        graph.resume_rendering();
+        return true;
+    }
+
+    // NOTE: The graph is rendered on the audio output's own rendering thread, so that it keeps playing even while this
+    //       thread is busy running script.
+    static constexpr u32 target_latency_ms = 20;
+    if (auto result = graph.start_rendering(target_latency_ms); result.is_error()) {
+        dbgln("Failed to start rendering the audio graph: {}", result.error());
+        return false;
+    }
+    return true;
+}
+
+void AudioContext::did_start_source()
+{
+    if (m_has_started_sources)
+        return;
+    m_has_started_sources = true;
+
+    if (rendering_state() == Bindings::AudioContextState::Running)
+        start_rendering_audio_graph();
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audiocontext-createmediaelementsource
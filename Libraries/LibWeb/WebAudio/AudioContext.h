@@ -42,6 +42,8 @@ public:
 
     WebIDL::ExceptionOr<GC::Ref<MediaElementAudioSourceNode>> create_media_element_source(GC::Ptr<HTML::HTMLMediaElement>);
 
+    virtual void did_start_source() override;
+
 private:
     explicit AudioContext(JS::Realm& realm)
         : BaseAudioContext(realm)
@@ -57,6 +59,7 @@ private:
     bool m_allowed_to_start = true;
     Vector<GC::Ref<WebIDL::Promise>> m_pending_resume_promises;
     bool m_suspended_by_user = false;
+    bool m_has_started_sources = false;
 
     bool start_rendering_audio_graph();
 };
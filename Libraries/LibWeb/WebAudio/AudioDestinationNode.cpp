@@ -10,6 +10,7 @@
 #include <LibWeb/WebAudio/AudioContext.h>
 #include <LibWeb/WebAudio/AudioDestinationNode.h>
 #include <LibWeb/WebAudio/AudioNode.h>
+#include <LibWeb/WebAudio/AudioRenderGraph.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/OfflineAudioContext.h>
 
@@ -59,6 +60,11 @@ void AudioDestinationNode::visit_edges(Cell::Visitor& visitor)
     Base::visit_edges(visitor);
 }
 
+RenderNode& AudioDestinationNode::create_render_node(AudioRenderGraph& graph)
+{
+    return graph.destination();
+}
+
 // https://webaudio.github.io/web-audio-api/#dom-audionode-channelcount
 WebIDL::ExceptionOr<void> AudioDestinationNode::set_channel_count(WebIDL::UnsignedLong channel_count)
 {
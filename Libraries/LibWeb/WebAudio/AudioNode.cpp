@@ -6,6 +6,8 @@
 
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/WebAudio/AudioNode.h>
+#include <LibWeb/WebAudio/AudioParam.h>
+#include <LibWeb/WebAudio/AudioRenderGraph.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 
 namespace Web::WebAudio {
@@ -51,9 +53,6 @@ WebIDL::ExceptionOr<void> AudioNode::initialize_audio_node_options(AudioNodeOpti
 // https://webaudio.github.io/web-audio-api/#dom-audionode-connect
 WebIDL::ExceptionOr<GC::Ref<AudioNode>> AudioNode::connect(GC::Ref<AudioNode> destination_node, WebIDL::UnsignedLong output, WebIDL::UnsignedLong input)
 {
-    // There can only be one connection between a given output of one specific node and a given input of another specific node.
-    // Multiple connections with the same termini are ignored.
-
     // If the destination parameter is an AudioNode that has been created using another AudioContext, an InvalidAccessError MUST be thrown.
     if (m_context != destination_node->m_context) {
         return WebIDL::InvalidAccessError::create(realm(), "Cannot connect to an AudioNode in a different AudioContext"_string);
@@ -71,7 +70,16 @@ WebIDL::ExceptionOr<GC::Ref<AudioNode>> AudioNode::connect(GC::Ref<AudioNode> de
         return WebIDL::IndexSizeError::create(realm(), MUST(String::formatted("Input index '{}' exceeds number of inputs", input)));
     }
 
-    dbgln("FIXME: Implement Audio::connect(AudioNode)");
+    // There can only be one connection between a given output of one specific node and a given input of another specific node.
+    // Multiple connections with the same termini are ignored.
+    auto already_connected = m_node_connections.first_matching([&](auto const& connection) {
+        return connection.destination_node == destination_node && connection.output == output && connection.input == input;
+    }).has_value();
+    if (!already_connected) {
+        m_node_connections.append({ destination_node, output, input });
+        destination_node->add_input_node(*this);
+    }
+
     return destination_node;
 }
 
@@ -90,14 +98,25 @@ WebIDL::ExceptionOr<void> AudioNode::connect(GC::Ref<AudioParam> destination_par
         return WebIDL::IndexSizeError::create(realm(), MUST(String::formatted("Output index {} exceeds number of outputs", output)));
     }
 
-    dbgln("FIXME: Implement AudioNode::connect(AudioParam)");
+    // There can only be one connection between a given output of one specific node and a specific AudioParam.
+    // Multiple connections with the same termini are ignored.
+    auto already_connected = m_param_connections.first_matching([&](auto const& connection) {
+        return connection.destination_param == destination_param && connection.output == output;
+    }).has_value();
+    if (!already_connected) {
+        m_param_connections.append({ destination_param, output });
+        destination_param->add_input_node(*this);
+    }
+
     return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect
 void AudioNode::disconnect()
 {
-    dbgln("FIXME: Implement AudioNode::disconnect()");
+    // Disconnects all outgoing connections from the AudioNode.
+    remove_node_connections([](auto const&) { return true; });
+    remove_param_connections([](auto const&) { return true; });
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-output
@@ -110,35 +129,43 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(WebIDL::UnsignedLong output)
         return WebIDL::IndexSizeError::create(realm(), MUST(String::formatted("Output index {} exceeds number of outputs", output)));
     }
 
-    dbgln("FIXME: Implement AudioNode::disconnect(output)");
+    remove_node_connections([&](auto const& connection) { return connection.output == output; });
+    remove_param_connections([&](auto const& connection) { return connection.output == output; });
     return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-destinationnode
-void AudioNode::disconnect(GC::Ref<AudioNode> destination_node)
+WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioNode> destination_node)
 {
-    (void)destination_node;
-    dbgln("FIXME: Implement AudioNode::disconnect(destination_node)");
+    // The destinationNode parameter is the AudioNode to disconnect. It disconnects all outgoing connections to the given destinationNode.
+    // If there is no connection to the destinationNode, an InvalidAccessError exception MUST be thrown.
+    auto removed = remove_node_connections([&](auto const& connection) { return connection.destination_node == destination_node; });
+    if (removed == 0)
+        return WebIDL::InvalidAccessError::create(realm(), "No connection to the given AudioNode"_string);
+    return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-destinationnode-output
 WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioNode> destination_node, WebIDL::UnsignedLong output)
 {
-    (void)destination_node;
     // The output parameter is an index describing which output of the AudioNode from which to disconnect.
     // If this parameter is out-of-bounds, an IndexSizeError exception MUST be thrown.
     if (output >= number_of_outputs()) {
         return WebIDL::IndexSizeError::create(realm(), MUST(String::formatted("Output index {} exceeds number of outputs", output)));
     }
 
-    dbgln("FIXME: Implement AudioNode::disconnect(destination_node, output)");
+    // If there is no connection to the destinationNode, an InvalidAccessError exception MUST be thrown.
+    auto removed = remove_node_connections([&](auto const& connection) {
+        return connection.destination_node == destination_node && connection.output == output;
+    });
+    if (removed == 0)
+        return WebIDL::InvalidAccessError::create(realm(), "No connection from the given output to the given AudioNode"_string);
     return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-destinationnode-output-input
 WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioNode> destination_node, WebIDL::UnsignedLong output, WebIDL::UnsignedLong input)
 {
-    (void)destination_node;
     // The output parameter is an index describing which output of the AudioNode from which to disconnect.
     // If this parameter is out-of-bounds, an IndexSizeError exception MUST be thrown.
     if (output >= number_of_outputs()) {
@@ -151,31 +178,131 @@ WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioNode> destination_n
         return WebIDL::IndexSizeError::create(realm(), MUST(String::formatted("Input index '{}' exceeds number of inputs", input)));
     }
 
-    dbgln("FIXME: Implement AudioNode::disconnect(destination_node, output, input)");
+    // If there is no connection to the destinationNode, an InvalidAccessError exception MUST be thrown.
+    auto removed = remove_node_connections([&](auto const& connection) {
+        return connection.destination_node == destination_node && connection.output == output && connection.input == input;
+    });
+    if (removed == 0)
+        return WebIDL::InvalidAccessError::create(realm(), "No connection from the given output to the given input of the AudioNode"_string);
     return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-destinationparam
-void AudioNode::disconnect(GC::Ref<AudioParam> destination_param)
+WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioParam> destination_param)
 {
-    (void)destination_param;
-    dbgln("FIXME: Implement AudioNode::disconnect(destination_param)");
+    // The destinationParam parameter is the AudioParam to disconnect.
+    // If there is no connection to the destinationParam, an InvalidAccessError exception MUST be thrown.
+    auto removed = remove_param_connections([&](auto const& connection) { return connection.destination_param == destination_param; });
+    if (removed == 0)
+        return WebIDL::InvalidAccessError::create(realm(), "No connection to the given AudioParam"_string);
+    return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audionode-disconnect-destinationparam-output
 WebIDL::ExceptionOr<void> AudioNode::disconnect(GC::Ref<AudioParam> destination_param, WebIDL::UnsignedLong output)
 {
-    (void)destination_param;
     // The output parameter is an index describing which output of the AudioNode from which to disconnect.
     // If this parameter is out-of-bounds, an IndexSizeError exception MUST be thrown.
     if (output >= number_of_outputs()) {
         return WebIDL::IndexSizeError::create(realm(), MUST(String::formatted("Output index {} exceeds number of outputs", output)));
     }
 
-    dbgln("FIXME: Implement AudioNode::disconnect(destination_param, output)");
+    // If there is no connection to the destinationParam, an InvalidAccessError exception MUST be thrown.
+    auto removed = remove_param_connections([&](auto const& connection) {
+        return connection.destination_param == destination_param && connection.output == output;
+    });
+    if (removed == 0)
+        return WebIDL::InvalidAccessError::create(realm(), "No connection from the given output to the given AudioParam"_string);
     return {};
 }
 
+size_t AudioNode::remove_node_connections(Function<bool(NodeConnection const&)> const& predicate)
+{
+    size_t removed = 0;
+    m_node_connections.remove_all_matching([&](auto const& connection) {
+        if (!predicate(connection))
+            return false;
+        connection.destination_node->remove_input_node(*this);
+        ++removed;
+        return true;
+    });
+    return removed;
+}
+
+size_t AudioNode::remove_param_connections(Function<bool(ParamConnection const&)> const& predicate)
+{
+    size_t removed = 0;
+    m_param_connections.remove_all_matching([&](auto const& connection) {
+        if (!predicate(connection))
+            return false;
+        connection.destination_param->remove_input_node(*this);
+        ++removed;
+        return true;
+    });
+    return removed;
+}
+
+void AudioNode::add_input_node(AudioNode& node)
+{
+    m_input_nodes.append(node);
+    update_render_inputs();
+}
+
+void AudioNode::remove_input_node(AudioNode& node)
+{
+    m_input_nodes.remove_first_matching([&](auto const& input_node) { return input_node.ptr() == &node; });
+    update_render_inputs();
+}
+
+// FIXME: Keep track of which input of the rendering node each connection goes to, once nodes with more than one input
+//        are rendered.
+void AudioNode::update_render_inputs()
+{
+    Vector<RenderNode*> inputs;
+    inputs.ensure_capacity(m_input_nodes.size());
+    for (auto& input_node : m_input_nodes)
+        inputs.unchecked_append(&input_node->render_node());
+
+    render_graph().queue_control_message([&node = render_node(), inputs = move(inputs)]() mutable {
+        swap(node.inputs, inputs);
+    });
+}
+
+void AudioNode::update_render_channel_configuration()
+{
+    if (!m_render_node)
+        return;
+
+    render_graph().queue_control_message([&node = *m_render_node, channel_count = m_channel_count, channel_count_mode = m_channel_count_mode, channel_interpretation = m_channel_interpretation] {
+        node.channel_count = channel_count;
+        node.channel_count_mode = channel_count_mode;
+        node.channel_interpretation = channel_interpretation;
+    });
+}
+
+RenderNode& AudioNode::render_node()
+{
+    if (!m_render_node) {
+        // NOTE: The rendering thread can only see this node once a control message has referred to it, so it can be
+        //       set up directly here.
+        m_render_node = &create_render_node(render_graph());
+        m_render_node->channel_count = m_channel_count;
+        m_render_node->channel_count_mode = m_channel_count_mode;
+        m_render_node->channel_interpretation = m_channel_interpretation;
+    }
+    return *m_render_node;
+}
+
+RenderNode& AudioNode::create_render_node(AudioRenderGraph& graph)
+{
+    return graph.create_node<RenderPassThroughNode>();
+}
+
+AudioRenderGraph& AudioNode::render_graph() const
+{
+    return m_context->render_graph();
+}
+
 // https://webaudio.github.io/web-audio-api/#dom-audionode-channelcount
 WebIDL::ExceptionOr<void> AudioNode::set_channel_count(WebIDL::UnsignedLong channel_count)
 {
@@ -185,6 +312,7 @@ WebIDL::ExceptionOr<void> AudioNode::set_channel_count(WebIDL::UnsignedLong chan
         return WebIDL::NotSupportedError::create(realm(), "Invalid channel count"_string);
 
     m_channel_count = channel_count;
+    update_render_channel_configuration();
     return {};
 }
 
@@ -192,6 +320,7 @@ WebIDL::ExceptionOr<void> AudioNode::set_channel_count(WebIDL::UnsignedLong chan
 WebIDL::ExceptionOr<void> AudioNode::set_channel_count_mode(Bindings::ChannelCountMode channel_count_mode)
 {
     m_channel_count_mode = channel_count_mode;
+    update_render_channel_configuration();
     return {};
 }
 
@@ -205,6 +334,7 @@ Bindings::ChannelCountMode AudioNode::channel_count_mode()
 WebIDL::ExceptionOr<void> AudioNode::set_channel_interpretation(Bindings::ChannelInterpretation channel_interpretation)
 {
     m_channel_interpretation = channel_interpretation;
+    update_render_channel_configuration();
     return {};
 }
 
@@ -224,6 +354,11 @@ void AudioNode::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_context);
+    for (auto& connection : m_node_connections)
+        visitor.visit(connection.destination_node);
+    for (auto& connection : m_param_connections)
+        visitor.visit(connection.destination_param);
+    visitor.visit(m_input_nodes);
 }
 
 }
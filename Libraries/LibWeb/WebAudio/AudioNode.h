@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <AK/Function.h>
 #include <AK/Optional.h>
+#include <AK/Vector.h>
 #include <LibJS/Forward.h>
 #include <LibWeb/Bindings/AudioNodePrototype.h>
 #include <LibWeb/Bindings/PlatformObject.h>
@@ -15,6 +17,9 @@
 
 namespace Web::WebAudio {
 
+class AudioRenderGraph;
+class RenderNode;
+
 // https://webaudio.github.io/web-audio-api/#AudioNodeOptions
 struct AudioNodeOptions {
     Optional<WebIDL::UnsignedLong> channel_count;
@@ -41,10 +46,10 @@ public:
 
     void disconnect();
     WebIDL::ExceptionOr<void> disconnect(WebIDL::UnsignedLong output);
-    void disconnect(GC::Ref<AudioNode> destination_node);
+    WebIDL::ExceptionOr<void> disconnect(GC::Ref<AudioNode> destination_node);
     WebIDL::ExceptionOr<void> disconnect(GC::Ref<AudioNode> destination_node, WebIDL::UnsignedLong output);
     WebIDL::ExceptionOr<void> disconnect(GC::Ref<AudioNode> destination_node, WebIDL::UnsignedLong output, WebIDL::UnsignedLong input);
-    void disconnect(GC::Ref<AudioParam> destination_param);
+    WebIDL::ExceptionOr<void> disconnect(GC::Ref<AudioParam> destination_param);
     WebIDL::ExceptionOr<void> disconnect(GC::Ref<AudioParam> destination_param, WebIDL::UnsignedLong output);
 
     // https://webaudio.github.io/web-audio-api/#dom-audionode-context
@@ -70,14 +75,52 @@ public:
 
     WebIDL::ExceptionOr<void> initialize_audio_node_options(AudioNodeOptions const& given_options, AudioNodeDefaultOptions const& default_options);
 
+    // The counterpart of this node on the rendering thread.
+    RenderNode& render_node();
+
 protected:
     AudioNode(JS::Realm&, GC::Ref<BaseAudioContext>, WebIDL::UnsignedLong channel_count = 2);
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
+    // Creates the counterpart of this node on the rendering thread. Nodes that do not know how to process audio yet
+    // pass their input through unchanged.
+    virtual RenderNode& create_render_node(AudioRenderGraph&);
+
+    BaseAudioContext& audio_context() const { return m_context; }
+    AudioRenderGraph& render_graph() const;
+
 private:
+    struct NodeConnection {
+        GC::Ref<AudioNode> destination_node;
+        WebIDL::UnsignedLong output { 0 };
+        WebIDL::UnsignedLong input { 0 };
+    };
+
+    struct ParamConnection {
+        GC::Ref<AudioParam> destination_param;
+        WebIDL::UnsignedLong output { 0 };
+    };
+
+    size_t remove_node_connections(Function<bool(NodeConnection const&)> const&);
+    size_t remove_param_connections(Function<bool(ParamConnection const&)> const&);
+
+    void add_input_node(AudioNode&);
+    void remove_input_node(AudioNode&);
+    void update_render_inputs();
+    void update_render_channel_configuration();
+
     GC::Ref<BaseAudioContext> m_context;
+
+    Vector<NodeConnection> m_node_connections;
+    Vector<ParamConnection> m_param_connections;
+
+    // The nodes connected to any of the inputs of this node, once for every connection.
+    Vector<GC::Ref<AudioNode>> m_input_nodes;
+
+    RenderNode* m_render_node { nullptr };
+
     WebIDL::UnsignedLong m_channel_count { 2 };
     Bindings::ChannelCountMode m_channel_count_mode { Bindings::ChannelCountMode::Max };
     Bindings::ChannelInterpretation m_channel_interpretation { Bindings::ChannelInterpretation::Speakers };
@@ -6,6 +6,7 @@
 
 #include <LibWeb/Bindings/AudioParamPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/WebAudio/AudioNode.h>
 #include <LibWeb/WebAudio/AudioParam.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
@@ -23,6 +24,7 @@ AudioParam::AudioParam(JS::Realm& realm, GC::Ref<BaseAudioContext> context, floa
     , m_max_value(max_value)
     , m_automation_rate(automation_rate)
     , m_fixed_automation_rate(fixed_automation_rate)
+    , m_render_param(context->render_graph().create_param(default_value, min_value, max_value, automation_rate))
 {
 }
 
@@ -37,6 +39,11 @@ AudioParam::~AudioParam() = default;
 // https://webaudio.github.io/web-audio-api/#simple-nominal-range
 float AudioParam::value() const
 {
+    // NOTE: Once automation or connections determine the value of the parameter, it can only be known by rendering the
+    //       graph, so the value computed for the most recent render quantum is returned.
+    if (!m_automation_events.is_empty() || !m_input_nodes.is_empty())
+        return m_render_param.last_computed_value();
+
     // Each AudioParam includes minValue and maxValue attributes that together form the simple nominal range
     // for the parameter. In effect, value of the parameter is clamped to the range [minValue, maxValue].
     return clamp(m_current_value, min_value(), max_value());
@@ -46,6 +53,10 @@ float AudioParam::value() const
 void AudioParam::set_value(float value)
 {
     m_current_value = value;
+
+    m_context->render_graph().queue_control_message([&param = m_render_param, value] {
+        param.set_intrinsic_value(value);
+    });
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-automationrate
@@ -61,6 +72,10 @@ WebIDL::ExceptionOr<void> AudioParam::set_automation_rate(Bindings::AutomationRa
         return WebIDL::InvalidStateError::create(realm(), "Automation rate cannot be changed"_string);
 
     m_automation_rate = automation_rate;
+
+    m_context->render_graph().queue_control_message([&param = m_render_param, automation_rate] {
+        param.automation_rate = automation_rate;
+    });
     return {};
 }
 
@@ -85,51 +100,183 @@ float AudioParam::max_value() const
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-setvalueattime
 WebIDL::ExceptionOr<GC::Ref<AudioParam>> AudioParam::set_value_at_time(float value, double start_time)
 {
-    (void)value;
-    (void)start_time;
-    dbgln("FIXME: Implement AudioParam::set_value_at_time");
+    // If startTime is negative a RangeError exception MUST be thrown.
+    if (start_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "startTime must not be negative"sv };
+
+    // If startTime is less than currentTime, it is clamped to currentTime.
+    AutomationEvent event;
+    event.type = AutomationEvent::Type::SetValue;
+    event.value = value;
+    event.time = max(start_time, m_context->current_time());
+    TRY(insert_automation_event(move(event)));
     return GC::Ref<AudioParam> { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-linearramptovalueattime
 WebIDL::ExceptionOr<GC::Ref<AudioParam>> AudioParam::linear_ramp_to_value_at_time(float value, double end_time)
 {
-    (void)value;
-    (void)end_time;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioParam::linear_ramp_to_value_at_time"_string);
+    // If endTime is negative a RangeError exception MUST be thrown.
+    if (end_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "endTime must not be negative"sv };
+
+    // If endTime is less than currentTime, it is clamped to currentTime.
+    AutomationEvent event;
+    event.type = AutomationEvent::Type::LinearRamp;
+    event.value = value;
+    event.time = max(end_time, m_context->current_time());
+    event.scheduled_at_time = m_context->current_time();
+    TRY(insert_automation_event(move(event)));
+    return GC::Ref<AudioParam> { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-exponentialramptovalueattime
 WebIDL::ExceptionOr<GC::Ref<AudioParam>> AudioParam::exponential_ramp_to_value_at_time(float value, double end_time)
 {
-    (void)value;
-    (void)end_time;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioParam::exponential_ramp_to_value_at_time"_string);
+    // A RangeError exception MUST be thrown if this value is equal to 0.
+    if (value == 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "value must not be zero"sv };
+
+    // If endTime is negative a RangeError exception MUST be thrown.
+    if (end_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "endTime must not be negative"sv };
+
+    // If endTime is less than currentTime, it is clamped to currentTime.
+    AutomationEvent event;
+    event.type = AutomationEvent::Type::ExponentialRamp;
+    event.value = value;
+    event.time = max(end_time, m_context->current_time());
+    event.scheduled_at_time = m_context->current_time();
+    TRY(insert_automation_event(move(event)));
+    return GC::Ref<AudioParam> { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-settargetattime
 WebIDL::ExceptionOr<GC::Ref<AudioParam>> AudioParam::set_target_at_time(float target, double start_time, float time_constant)
 {
-    (void)target;
-    (void)start_time;
-    (void)time_constant;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioParam::set_target_at_time"_string);
+    // If startTime is negative a RangeError exception MUST be thrown.
+    if (start_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "startTime must not be negative"sv };
+
+    // If timeConstant is negative, a RangeError exception MUST be thrown.
+    if (time_constant < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "timeConstant must not be negative"sv };
+
+    // If startTime is less than currentTime, it is clamped to currentTime.
+    AutomationEvent event;
+    event.type = AutomationEvent::Type::SetTarget;
+    event.value = target;
+    event.time = max(start_time, m_context->current_time());
+    event.time_constant = time_constant;
+    TRY(insert_automation_event(move(event)));
+    return GC::Ref<AudioParam> { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-setvaluecurveattime
 WebIDL::ExceptionOr<GC::Ref<AudioParam>> AudioParam::set_value_curve_at_time(Span<float> values, double start_time, double duration)
 {
-    (void)values;
-    (void)start_time;
-    (void)duration;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioParam::set_value_curve_at_time"_string);
+    // An InvalidStateError MUST be thrown if this attribute is a sequence<float> object that has a length less than 2.
+    if (values.size() < 2)
+        return WebIDL::InvalidStateError::create(realm(), "values must contain at least two elements"_string);
+
+    // If startTime is negative a RangeError exception MUST be thrown.
+    if (start_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "startTime must not be negative"sv };
+
+    // A RangeError exception MUST be thrown if duration is not strictly positive or is not finite.
+    if (!(duration > 0) || isinf(duration))
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "duration must be strictly positive"sv };
+
+    // If startTime is less than currentTime, it is clamped to currentTime.
+    AutomationEvent event;
+    event.type = AutomationEvent::Type::SetValueCurve;
+    event.time = max(start_time, m_context->current_time());
+    event.duration = duration;
+    event.curve.append(values.data(), values.size());
+    TRY(insert_automation_event(move(event)));
+    return GC::Ref<AudioParam> { *this };
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-cancelscheduledvalues
 WebIDL::ExceptionOr<GC::Ref<AudioParam>> AudioParam::cancel_scheduled_values(double cancel_time)
 {
-    (void)cancel_time;
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioParam::cancel_scheduled_values"_string);
+    // If cancelTime is negative a RangeError exception MUST be thrown.
+    if (cancel_time < 0)
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "cancelTime must not be negative"sv };
+
+    // If cancelTime is less than currentTime, it is clamped to currentTime.
+    cancel_time = max(cancel_time, m_context->current_time());
+
+    // Cancels all scheduled parameter changes with times greater than or equal to cancelTime. If there is an active
+    // setValueCurveAtTime() automation event at cancelTime, it is removed as well.
+    m_automation_events.remove_all_matching([&](auto const& event) {
+        return event.time >= cancel_time || event.end_time() > cancel_time;
+    });
+    update_render_timeline();
+    return GC::Ref<AudioParam> { *this };
+}
+
+WebIDL::ExceptionOr<void> AudioParam::insert_automation_event(AutomationEvent event)
+{
+    // https://webaudio.github.io/web-audio-api/#dom-audioparam-setvaluecurveattime
+    // An exception MUST be thrown if any automation method is called at a time which is contained in [T, T+D), T
+    // being startTime, D being duration. For setValueCurveAtTime(), if any of the existing events falls in that range,
+    // a NotSupportedError exception MUST be thrown as well.
+    for (auto const& existing_event : m_automation_events) {
+        auto overlaps_existing_curve = existing_event.type == AutomationEvent::Type::SetValueCurve
+            && event.time >= existing_event.time && event.time < existing_event.end_time();
+        auto overlaps_new_curve = event.type == AutomationEvent::Type::SetValueCurve
+            && existing_event.time >= event.time && existing_event.time < event.end_time();
+        if (overlaps_existing_curve || overlaps_new_curve)
+            return WebIDL::NotSupportedError::create(realm(), "Automation event overlaps with a setValueCurveAtTime() event"_string);
+    }
+
+    // https://webaudio.github.io/web-audio-api/#dom-audioparam-setvalueattime
+    // If one of these events is added at a time where there is already one or more events, then it will be placed in
+    // the list after them, but before events whose times are after the event.
+    auto insertion_index = m_automation_events.size();
+    for (size_t i = 0; i < m_automation_events.size(); ++i) {
+        if (m_automation_events[i].time > event.time) {
+            insertion_index = i;
+            break;
+        }
+    }
+    m_automation_events.insert(insertion_index, move(event));
+
+    update_render_timeline();
+    return {};
+}
+
+void AudioParam::update_render_timeline()
+{
+    auto events = m_automation_events;
+    m_context->render_graph().queue_control_message([&param = m_render_param, events = move(events)]() mutable {
+        param.swap_events(events);
+    });
+}
+
+void AudioParam::add_input_node(AudioNode& node)
+{
+    m_input_nodes.append(node);
+    update_render_inputs();
+}
+
+void AudioParam::remove_input_node(AudioNode& node)
+{
+    m_input_nodes.remove_first_matching([&](auto const& input_node) { return input_node.ptr() == &node; });
+    update_render_inputs();
+}
+
+void AudioParam::update_render_inputs()
+{
+    Vector<RenderNode*> inputs;
+    inputs.ensure_capacity(m_input_nodes.size());
+    for (auto& input_node : m_input_nodes)
+        inputs.unchecked_append(&input_node->render_node());
+
+    m_context->render_graph().queue_control_message([&param = m_render_param, inputs = move(inputs)]() mutable {
+        swap(param.inputs, inputs);
+    });
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioparam-cancelandholdattime
@@ -149,6 +296,7 @@ void AudioParam::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_context);
+    visitor.visit(m_input_nodes);
 }
 
 }
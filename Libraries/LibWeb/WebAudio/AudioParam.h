@@ -6,9 +6,11 @@
 
 #pragma once
 
+#include <AK/Vector.h>
 #include <LibJS/Forward.h>
 #include <LibWeb/Bindings/AudioParamPrototype.h>
 #include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/WebAudio/AudioRenderGraph.h>
 
 namespace Web::WebAudio {
 
@@ -46,6 +48,12 @@ public:
     WebIDL::ExceptionOr<GC::Ref<AudioParam>> cancel_scheduled_values(double cancel_time);
     WebIDL::ExceptionOr<GC::Ref<AudioParam>> cancel_and_hold_at_time(double cancel_time);
 
+    // The counterpart of this param on the rendering thread.
+    RenderParam& render_param() const { return m_render_param; }
+
+    void add_input_node(AudioNode&);
+    void remove_input_node(AudioNode&);
+
 private:
     AudioParam(JS::Realm&, GC::Ref<BaseAudioContext>, float default_value, float min_value, float max_value, Bindings::AutomationRate, FixedAutomationRate = FixedAutomationRate::No);
 
@@ -63,6 +71,19 @@ private:
 
     FixedAutomationRate m_fixed_automation_rate { FixedAutomationRate::No };
 
+    WebIDL::ExceptionOr<void> insert_automation_event(AutomationEvent);
+    void update_render_timeline();
+    void update_render_inputs();
+
+    RenderParam& m_render_param;
+
+    // The automation events scheduled on this param, ordered by time. A copy of these is handed to the rendering
+    // thread whenever they change.
+    Vector<AutomationEvent> m_automation_events;
+
+    // The nodes connected to this param, once for every connection.
+    Vector<GC::Ref<AudioNode>> m_input_nodes;
+
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 };
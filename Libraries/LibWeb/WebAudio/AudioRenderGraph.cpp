@@ -0,0 +1,771 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <LibCore/Timer.h>
+#include <LibWeb/WebAudio/AudioRenderGraph.h>
+#include <LibWeb/WebAudio/DSP.h>
+#include <math.h>
+
+namespace Web::WebAudio {
+
+static constexpr size_t OUTPUT_CHANNEL_COUNT = 2;
+
+void AudioBlock::clear()
+{
+    for (auto& channel : channels)
+        channel.fill(0);
+}
+
+// https://webaudio.github.io/web-audio-api/#channel-up-mixing-and-down-mixing
+void AudioBlock::mix_in(AudioBlock const& other, Bindings::ChannelInterpretation interpretation)
+{
+    if (other.channel_count == channel_count || interpretation == Bindings::ChannelInterpretation::Discrete) {
+        // If the number of channels matches, or if the interpretation is "discrete", channels are mixed one to one,
+        // dropping or leaving silent any channels that do not have a counterpart.
+        for (size_t i = 0; i < min(channel_count, other.channel_count); ++i)
+            DSP::add(channel(i), other.channel(i));
+        return;
+    }
+
+    // Up-mix from mono to stereo: output.L = input; output.R = input;
+    if (other.channel_count == 1) {
+        DSP::add(channel(0), other.channel(0));
+        DSP::add(channel(1), other.channel(0));
+        return;
+    }
+
+    // Down-mix from stereo to mono: output = 0.5 * (input.L + input.R);
+    DSP::multiply_add(channel(0), other.channel(0), 0.5f);
+    DSP::multiply_add(channel(0), other.channel(1), 0.5f);
+}
+
+RenderParam::RenderParam(float default_value, float min_value, float max_value, Bindings::AutomationRate automation_rate)
+    : automation_rate(automation_rate)
+    , m_intrinsic_value(default_value)
+    , m_min_value(min_value)
+    , m_max_value(max_value)
+    , m_anchor_value(default_value)
+    , m_last_computed_value(default_value)
+{
+    m_input_block.channel_count = 1;
+}
+
+void RenderParam::set_intrinsic_value(float value)
+{
+    m_intrinsic_value = value;
+    m_last_computed_value.store(clamp(value, m_min_value, m_max_value), AK::memory_order_relaxed);
+    reset_timeline_evaluation();
+}
+
+void RenderParam::swap_events(Vector<AutomationEvent>& events)
+{
+    swap(m_events, events);
+    reset_timeline_evaluation();
+}
+
+void RenderParam::reset_timeline_evaluation()
+{
+    m_first_pending_event = 0;
+    m_anchor_value = m_intrinsic_value;
+    m_anchor_time = 0;
+    m_active_target_event = {};
+}
+
+// https://webaudio.github.io/web-audio-api/#computation-of-value
+void RenderParam::compute(RenderQuantum const& quantum)
+{
+    auto frame_count = is_a_rate() ? RENDER_QUANTUM_SIZE : 1;
+
+    // 1. paramIntrinsicValue will be calculated at each time, which is either the value set directly to the value
+    //    attribute, or, if there are any automation events with times before or at this time, the value as calculated
+    //    from these events.
+    auto values = m_values.span().trim(frame_count);
+    auto start_time = quantum.start_time();
+    auto end_time = start_time + static_cast<double>(frame_count) / quantum.sample_rate;
+    if (!timeline_changes_before(end_time)) {
+        // NOTE: Nothing on the timeline changes the value during this quantum, which is by far the most common case.
+        m_is_constant = true;
+        values.fill(value_at_time(start_time));
+    } else {
+        m_is_constant = frame_count == 1;
+        for (size_t i = 0; i < frame_count; ++i)
+            values[i] = value_at_time(start_time + static_cast<double>(i) / quantum.sample_rate);
+    }
+
+    // 2. Set [[current value]] to the value of paramIntrinsicValue at the beginning of this render quantum.
+    m_last_computed_value.store(clamp(m_values[0], m_min_value, m_max_value), AK::memory_order_relaxed);
+
+    // 3. paramComputedValue is the sum of the paramIntrinsicValue value and the value of the input AudioParam buffer.
+    //    If the sum is NaN, replace the sum with the defaultValue.
+    // NOTE: The inputs are down-mixed to mono, and k-rate parameters only look at the first frame of them.
+    if (!inputs.is_empty()) {
+        m_input_block.clear();
+        for (auto* input : inputs)
+            m_input_block.mix_in(input->pull(quantum), Bindings::ChannelInterpretation::Speakers);
+
+        DSP::add(values, m_input_block.channel(0));
+        m_is_constant = frame_count == 1;
+    }
+
+    // 4. Clamp paramComputedValue to the simple nominal range.
+    DSP::clamp(values, m_min_value, m_max_value, m_intrinsic_value);
+}
+
+bool RenderParam::timeline_changes_before(double time) const
+{
+    if (m_active_target_event.has_value())
+        return true;
+    if (m_first_pending_event >= m_events.size())
+        return false;
+
+    // NOTE: A ramp changes the value all the way up to its end time.
+    auto const& event = m_events[m_first_pending_event];
+    return event.is_ramp() || event.time < time;
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-audioparam-setvalueattime and friends describe how each kind of event
+// affects the value of the parameter.
+float RenderParam::value_at_time(double time)
+{
+    // Returns the value the timeline has at the given time, if no further events have started by then.
+    auto value_after_last_event = [&](double at) -> float {
+        if (!m_active_target_event.has_value())
+            return m_anchor_value;
+
+        // https://webaudio.github.io/web-audio-api/#dom-audioparam-settargetattime
+        // v(t) = V1 + (V0 - V1) * e^(-(t - T0) / timeConstant)
+        auto const& event = m_events[*m_active_target_event];
+        if (event.time_constant <= 0)
+            return event.value;
+        return event.value + (m_anchor_value - event.value) * static_cast<float>(AK::exp(-(at - m_anchor_time) / event.time_constant));
+    };
+
+    while (m_first_pending_event < m_events.size()) {
+        auto const& event = m_events[m_first_pending_event];
+
+        if (event.is_ramp()) {
+            if (time < event.time) {
+                // NOTE: A ramp starts at the time of the previous event, or when it was scheduled if there is none.
+                auto ramp_start_time = m_first_pending_event == 0 ? event.scheduled_at_time : m_anchor_time;
+                auto ramp_start_value = value_after_last_event(ramp_start_time);
+                if (time < ramp_start_time)
+                    return value_after_last_event(time);
+                if (event.time <= ramp_start_time)
+                    return event.value;
+
+                auto progress = (time - ramp_start_time) / (event.time - ramp_start_time);
+
+                // https://webaudio.github.io/web-audio-api/#dom-audioparam-linearramptovalueattime
+                // v(t) = V0 + (V1 - V0) * ((t - T0) / (T1 - T0))
+                if (event.type == AutomationEvent::Type::LinearRamp)
+                    return ramp_start_value + (event.value - ramp_start_value) * static_cast<float>(progress);
+
+                // https://webaudio.github.io/web-audio-api/#dom-audioparam-exponentialramptovalueattime
+                // If V0 and V1 have opposite signs or if V0 is zero, then v(t) = V0 for T0 ≤ t < T1.
+                if (ramp_start_value == 0 || (ramp_start_value < 0) != (event.value < 0))
+                    return ramp_start_value;
+
+                // v(t) = V0 * (V1 / V0) ^ ((t - T0) / (T1 - T0))
+                return ramp_start_value * static_cast<float>(AK::pow(static_cast<double>(event.value / ramp_start_value), progress));
+            }
+
+            // The ramp has completed, so it now holds its end value.
+            m_anchor_value = event.value;
+            m_anchor_time = event.time;
+            m_active_target_event = {};
+            ++m_first_pending_event;
+            continue;
+        }
+
+        if (time < event.time)
+            break;
+
+        switch (event.type) {
+        case AutomationEvent::Type::SetValue:
+            m_anchor_value = event.value;
+            m_anchor_time = event.time;
+            m_active_target_event = {};
+            break;
+        case AutomationEvent::Type::SetTarget:
+            m_anchor_value = value_after_last_event(event.time);
+            m_anchor_time = event.time;
+            m_active_target_event = m_first_pending_event;
+            break;
+        case AutomationEvent::Type::SetValueCurve: {
+            auto const& curve = event.curve;
+            if (time < event.end_time()) {
+                // https://webaudio.github.io/web-audio-api/#dom-audioparam-setvaluecurveattime
+                // k = floor((N - 1) / duration * (t - T0)), v(t) is linearly interpolated between V[k] and V[k + 1].
+                auto position = static_cast<double>(curve.size() - 1) / event.duration * (time - event.time);
+                auto k = min(static_cast<size_t>(position), curve.size() - 2);
+                auto fraction = static_cast<float>(position - static_cast<double>(k));
+                return curve[k] + (curve[k + 1] - curve[k]) * fraction;
+            }
+            m_anchor_value = curve.last();
+            m_anchor_time = event.end_time();
+            m_active_target_event = {};
+            break;
+        }
+        case AutomationEvent::Type::LinearRamp:
+        case AutomationEvent::Type::ExponentialRamp:
+            VERIFY_NOT_REACHED();
+        }
+        ++m_first_pending_event;
+    }
+
+    return value_after_last_event(time);
+}
+
+AudioBlock const& RenderNode::pull(RenderQuantum const& quantum)
+{
+    if (m_last_rendered_quantum == quantum.index)
+        return m_output;
+
+    // NOTE: This is set before pulling the inputs, so that a cycle in the graph reads this node's previous output
+    //       instead of recursing forever.
+    m_last_rendered_quantum = quantum.index;
+
+    size_t max_input_channels = 1;
+    for (auto* input : inputs)
+        max_input_channels = max(max_input_channels, input->pull(quantum).channel_count);
+
+    m_input.channel_count = computed_number_of_channels(max_input_channels);
+    m_input.clear();
+    for (auto* input : inputs)
+        m_input.mix_in(input->pull(quantum), channel_interpretation);
+
+    m_output.channel_count = m_input.channel_count;
+    process(quantum, m_input, m_output);
+    return m_output;
+}
+
+// https://webaudio.github.io/web-audio-api/#computednumberofchannels
+size_t RenderNode::computed_number_of_channels(size_t max_input_channels) const
+{
+    size_t computed_number_of_channels = 0;
+    switch (channel_count_mode) {
+    case Bindings::ChannelCountMode::Max:
+        computed_number_of_channels = max_input_channels;
+        break;
+    case Bindings::ChannelCountMode::ClampedMax:
+        computed_number_of_channels = min(max_input_channels, channel_count);
+        break;
+    case Bindings::ChannelCountMode::Explicit:
+        computed_number_of_channels = channel_count;
+        break;
+    }
+    return clamp(computed_number_of_channels, 1u, MAX_RENDER_CHANNELS);
+}
+
+void RenderPassThroughNode::process(RenderQuantum const&, AudioBlock const& input, AudioBlock& output)
+{
+    output = input;
+}
+
+void RenderDestinationNode::process(RenderQuantum const&, AudioBlock const& input, AudioBlock& output)
+{
+    // NOTE: The input has already been mixed to the destination's channel count, which is what gets rendered.
+    output = input;
+}
+
+// https://webaudio.github.io/web-audio-api/#GainNode
+void RenderGainNode::process(RenderQuantum const& quantum, AudioBlock const& input, AudioBlock& output)
+{
+    m_gain.compute(quantum);
+
+    for (size_t channel = 0; channel < output.channel_count; ++channel) {
+        if (m_gain.has_constant_value())
+            DSP::multiply(output.channel(channel), input.channel(channel), m_gain.value_at(0));
+        else
+            DSP::multiply(output.channel(channel), input.channel(channel), m_gain.values());
+    }
+}
+
+// https://webaudio.github.io/web-audio-api/#BiquadFilterNode
+void RenderBiquadFilterNode::process(RenderQuantum const& quantum, AudioBlock const& input, AudioBlock& output)
+{
+    static_assert(MAX_RENDER_CHANNELS <= DSP::MAX_BIQUAD_CHANNELS);
+
+    m_frequency.compute(quantum);
+    m_detune.compute(quantum);
+    m_q.compute(quantum);
+    m_gain.compute(quantum);
+
+    output = input;
+    Array<Span<float>, MAX_RENDER_CHANNELS> channels;
+    for (size_t channel = 0; channel < output.channel_count; ++channel)
+        channels[channel] = output.channel(channel);
+
+    auto coefficients_at = [&](size_t frame) {
+        return compute_biquad_coefficients(type, quantum.sample_rate, m_frequency.value_at(frame), m_detune.value_at(frame), m_q.value_at(frame), m_gain.value_at(frame));
+    };
+
+    if (m_frequency.has_constant_value() && m_detune.has_constant_value() && m_q.has_constant_value() && m_gain.has_constant_value()) {
+        DSP::biquad(channels.span().trim(output.channel_count), coefficients_at(0), m_state);
+        return;
+    }
+
+    // While any of the parameters is being automated, the filter has to be recomputed for every frame.
+    for (size_t frame = 0; frame < RENDER_QUANTUM_SIZE; ++frame) {
+        Array<Span<float>, MAX_RENDER_CHANNELS> frame_channels;
+        for (size_t channel = 0; channel < output.channel_count; ++channel)
+            frame_channels[channel] = channels[channel].slice(frame, 1);
+        DSP::biquad(frame_channels.span().trim(output.channel_count), coefficients_at(frame), m_state);
+    }
+}
+
+// https://webaudio.github.io/web-audio-api/#filters-characteristics
+DSP::BiquadCoefficients compute_biquad_coefficients(Bindings::BiquadFilterType type, float sample_rate, float frequency, float detune, float q, float gain)
+{
+    // computedFrequency = frequency * pow(2, detune / 1200)
+    auto nyquist_frequency = static_cast<double>(sample_rate) / 2;
+    auto computed_frequency = clamp(static_cast<double>(frequency) * AK::exp2(static_cast<double>(detune) / 1200), 0.0, nyquist_frequency);
+
+    // A = 10^(G / 40)
+    auto A = AK::pow(10.0, static_cast<double>(gain) / 40);
+
+    // ω0 = 2π * f0 / Fs
+    auto w0 = 2 * AK::Pi<double> * computed_frequency / static_cast<double>(sample_rate);
+    auto cos_w0 = AK::cos(w0);
+    auto sin_w0 = AK::sin(w0);
+
+    // αQ = sin(ω0) / (2Q)
+    auto alpha_q = sin_w0 / (2 * static_cast<double>(q));
+
+    // αQ_dB = sin(ω0) / (2 * 10^(Q / 20))
+    auto alpha_q_db = sin_w0 / (2 * AK::pow(10.0, static_cast<double>(q) / 20));
+
+    // αS = sin(ω0) / 2 * sqrt((A + 1 / A) * (1 / S - 1) + 2), where S = 1
+    constexpr double S = 1;
+    auto alpha_s = sin_w0 / 2 * AK::sqrt((A + 1 / A) * (1 / S - 1) + 2);
+    auto two_sqrt_a_alpha_s = 2 * AK::sqrt(A) * alpha_s;
+
+    double b0 = 1, b1 = 0, b2 = 0, a0 = 1, a1 = 0, a2 = 0;
+    switch (type) {
+    case Bindings::BiquadFilterType::Lowpass:
+        b0 = (1 - cos_w0) / 2;
+        b1 = 1 - cos_w0;
+        b2 = (1 - cos_w0) / 2;
+        a0 = 1 + alpha_q_db;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha_q_db;
+        break;
+    case Bindings::BiquadFilterType::Highpass:
+        b0 = (1 + cos_w0) / 2;
+        b1 = -(1 + cos_w0);
+        b2 = (1 + cos_w0) / 2;
+        a0 = 1 + alpha_q_db;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha_q_db;
+        break;
+    case Bindings::BiquadFilterType::Bandpass:
+        b0 = alpha_q;
+        b1 = 0;
+        b2 = -alpha_q;
+        a0 = 1 + alpha_q;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha_q;
+        break;
+    case Bindings::BiquadFilterType::Notch:
+        b0 = 1;
+        b1 = -2 * cos_w0;
+        b2 = 1;
+        a0 = 1 + alpha_q;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha_q;
+        break;
+    case Bindings::BiquadFilterType::Allpass:
+        b0 = 1 - alpha_q;
+        b1 = -2 * cos_w0;
+        b2 = 1 + alpha_q;
+        a0 = 1 + alpha_q;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha_q;
+        break;
+    case Bindings::BiquadFilterType::Peaking:
+        b0 = 1 + alpha_q * A;
+        b1 = -2 * cos_w0;
+        b2 = 1 - alpha_q * A;
+        a0 = 1 + alpha_q / A;
+        a1 = -2 * cos_w0;
+        a2 = 1 - alpha_q / A;
+        break;
+    case Bindings::BiquadFilterType::Lowshelf:
+        b0 = A * ((A + 1) - (A - 1) * cos_w0 + two_sqrt_a_alpha_s);
+        b1 = 2 * A * ((A - 1) - (A + 1) * cos_w0);
+        b2 = A * ((A + 1) - (A - 1) * cos_w0 - two_sqrt_a_alpha_s);
+        a0 = (A + 1) + (A - 1) * cos_w0 + two_sqrt_a_alpha_s;
+        a1 = -2 * ((A - 1) + (A + 1) * cos_w0);
+        a2 = (A + 1) + (A - 1) * cos_w0 - two_sqrt_a_alpha_s;
+        break;
+    case Bindings::BiquadFilterType::Highshelf:
+        b0 = A * ((A + 1) + (A - 1) * cos_w0 + two_sqrt_a_alpha_s);
+        b1 = -2 * A * ((A - 1) + (A + 1) * cos_w0);
+        b2 = A * ((A + 1) + (A - 1) * cos_w0 - two_sqrt_a_alpha_s);
+        a0 = (A + 1) - (A - 1) * cos_w0 + two_sqrt_a_alpha_s;
+        a1 = 2 * ((A - 1) - (A + 1) * cos_w0);
+        a2 = (A + 1) - (A - 1) * cos_w0 - two_sqrt_a_alpha_s;
+        break;
+    }
+
+    // FIXME: Implement the limiting cases the spec describes for a Q of 0 and for frequencies at 0 or Nyquist. Until
+    //        then, a filter that would divide by zero passes its input through unchanged.
+    if (a0 == 0 || !isfinite(b0 / a0) || !isfinite(b1 / a0) || !isfinite(b2 / a0) || !isfinite(a1 / a0) || !isfinite(a2 / a0))
+        return {};
+
+    return {
+        .b0 = static_cast<float>(b0 / a0),
+        .b1 = static_cast<float>(b1 / a0),
+        .b2 = static_cast<float>(b2 / a0),
+        .a1 = static_cast<float>(a1 / a0),
+        .a2 = static_cast<float>(a2 / a0),
+    };
+}
+
+RenderScheduledSourceNode::ActiveFrames RenderScheduledSourceNode::active_frames(RenderQuantum const& quantum, AudioBlock& output) const
+{
+    output.clear();
+    if (!start_time.has_value())
+        return {};
+
+    auto frame_in_quantum = [&](double time) -> size_t {
+        auto frame = AK::ceil(time * quantum.sample_rate) - static_cast<double>(quantum.start_frame);
+        return static_cast<size_t>(clamp(frame, 0.0, static_cast<double>(RENDER_QUANTUM_SIZE)));
+    };
+
+    ActiveFrames frames;
+    frames.first = frame_in_quantum(*start_time);
+    frames.end = stop_time.has_value() ? frame_in_quantum(*stop_time) : RENDER_QUANTUM_SIZE;
+    return frames;
+}
+
+// https://webaudio.github.io/web-audio-api/#OscillatorNode
+void RenderOscillatorNode::process(RenderQuantum const& quantum, AudioBlock const&, AudioBlock& output)
+{
+    m_frequency.compute(quantum);
+    m_detune.compute(quantum);
+
+    output.channel_count = 1;
+    auto frames = active_frames(quantum, output);
+    if (frames.is_empty())
+        return;
+
+    if (type == Bindings::OscillatorType::Custom && custom_waveform.is_empty())
+        return;
+
+    auto samples = output.channel(0);
+    for (size_t i = frames.first; i < frames.end; ++i) {
+        // computedOscFrequency(t) = frequency(t) * pow(2, detune(t) / 1200)
+        auto frequency = static_cast<double>(m_frequency.value_at(i)) * AK::exp2(static_cast<double>(m_detune.value_at(i)) / 1200);
+
+        auto phase = m_phase;
+        switch (type) {
+        case Bindings::OscillatorType::Sine:
+            samples[i] = static_cast<float>(AK::sin(2 * AK::Pi<double> * phase));
+            break;
+        case Bindings::OscillatorType::Square:
+            samples[i] = phase < 0.5 ? 1.0f : -1.0f;
+            break;
+        case Bindings::OscillatorType::Sawtooth:
+            samples[i] = static_cast<float>(2 * (phase - AK::floor(phase + 0.5)));
+            break;
+        case Bindings::OscillatorType::Triangle:
+            if (phase < 0.25)
+                samples[i] = static_cast<float>(4 * phase);
+            else if (phase < 0.75)
+                samples[i] = static_cast<float>(2 - 4 * phase);
+            else
+                samples[i] = static_cast<float>(4 * phase - 4);
+            break;
+        case Bindings::OscillatorType::Custom: {
+            // Linearly interpolate the waveform generated from the PeriodicWave, wrapping around at its end.
+            auto position = phase * static_cast<double>(custom_waveform.size());
+            auto index = min(static_cast<size_t>(position), custom_waveform.size() - 1);
+            auto next_index = (index + 1) % custom_waveform.size();
+            auto fraction = static_cast<float>(position - static_cast<double>(index));
+            samples[i] = custom_waveform[index] + (custom_waveform[next_index] - custom_waveform[index]) * fraction;
+            break;
+        }
+        }
+
+        m_phase += frequency / quantum.sample_rate;
+        m_phase -= AK::floor(m_phase);
+    }
+}
+
+// https://webaudio.github.io/web-audio-api/#ConstantSourceNode
+void RenderConstantSourceNode::process(RenderQuantum const& quantum, AudioBlock const&, AudioBlock& output)
+{
+    m_offset.compute(quantum);
+
+    output.channel_count = 1;
+    auto frames = active_frames(quantum, output);
+    auto samples = output.channel(0);
+    for (size_t i = frames.first; i < frames.end; ++i)
+        samples[i] = m_offset.value_at(i);
+}
+
+// https://webaudio.github.io/web-audio-api/#playback-AudioBufferSourceNode
+void RenderAudioBufferSourceNode::process(RenderQuantum const& quantum, AudioBlock const&, AudioBlock& output)
+{
+    m_playback_rate.compute(quantum);
+    m_detune.compute(quantum);
+
+    output.channel_count = clamp(buffer.size(), 1u, MAX_RENDER_CHANNELS);
+    auto frames = active_frames(quantum, output);
+    if (frames.is_empty() || m_has_finished || buffer.is_empty())
+        return;
+
+    auto buffer_length = static_cast<double>(buffer.first().size());
+    auto buffer_frames_per_output_frame = static_cast<double>(buffer_sample_rate) / quantum.sample_rate;
+
+    // computedPlaybackRate(t) = playbackRate(t) * pow(2, detune(t) / 1200)
+    auto playback_rate = static_cast<double>(m_playback_rate.value_at(0)) * AK::exp2(static_cast<double>(m_detune.value_at(0)) / 1200);
+    auto step = playback_rate * buffer_frames_per_output_frame;
+
+    auto actual_loop_start = 0.0;
+    auto actual_loop_end = buffer_length;
+    if (loop && loop_start >= 0 && loop_end > 0 && loop_start < loop_end) {
+        actual_loop_start = min(loop_start * buffer_sample_rate, buffer_length);
+        actual_loop_end = min(loop_end * buffer_sample_rate, buffer_length);
+    }
+
+    if (!m_playhead.has_value())
+        m_playhead = offset * buffer_sample_rate;
+
+    auto& playhead = *m_playhead;
+    for (size_t i = frames.first; i < frames.end;) {
+        if (duration.has_value() && m_played_duration >= *duration) {
+            m_has_finished = true;
+            return;
+        }
+
+        if (loop && actual_loop_end > actual_loop_start) {
+            auto loop_length = actual_loop_end - actual_loop_start;
+            if (playhead >= actual_loop_end)
+                playhead = actual_loop_start + AK::fmod(playhead - actual_loop_start, loop_length);
+            else if (playhead < actual_loop_start && step < 0)
+                playhead = actual_loop_end - AK::fmod(actual_loop_start - playhead, loop_length);
+        } else if (playhead < 0 || playhead >= buffer_length) {
+            m_has_finished = true;
+            return;
+        }
+
+        // Frames that neither wrap around the loop, nor run into the end of the buffer or of the duration, are
+        // interpolated all at once.
+        if (auto run_length = frames_until_next_boundary(playhead, step, actual_loop_end); run_length > 1) {
+            run_length = min(run_length, frames.end - i);
+            for (size_t channel = 0; channel < output.channel_count; ++channel)
+                DSP::linear_interpolate(output.channel(channel).slice(i, run_length), buffer[channel].span(), playhead, step);
+
+            playhead += step * static_cast<double>(run_length);
+            m_played_duration += step * static_cast<double>(run_length) / buffer_sample_rate;
+            i += run_length;
+            continue;
+        }
+
+        // Linearly interpolate between the two buffer frames surrounding the playhead.
+        auto index = static_cast<size_t>(playhead);
+        auto next_index = min(index + 1, static_cast<size_t>(buffer_length) - 1);
+        auto fraction = static_cast<float>(playhead - static_cast<double>(index));
+        for (size_t channel = 0; channel < output.channel_count; ++channel) {
+            auto const& data = buffer[channel];
+            output.channel(channel)[i] = data[index] + (data[next_index] - data[index]) * fraction;
+        }
+
+        playhead += step;
+        m_played_duration += AK::fabs(step) / buffer_sample_rate;
+        ++i;
+    }
+}
+
+size_t RenderAudioBufferSourceNode::frames_until_next_boundary(double playhead, double step, double actual_loop_end) const
+{
+    if (step <= 0)
+        return 0;
+
+    // NOTE: Every frame that is interpolated from has to be followed by another frame in the buffer.
+    auto limit = min(loop ? actual_loop_end : static_cast<double>(buffer.first().size()), static_cast<double>(buffer.first().size() - 1));
+    if (playhead >= limit)
+        return 0;
+    auto frame_count = AK::ceil((limit - playhead) / step);
+
+    if (duration.has_value())
+        frame_count = min(frame_count, AK::ceil((*duration - m_played_duration) * buffer_sample_rate / step));
+
+    return static_cast<size_t>(max(frame_count, 0.0));
+}
+
+NonnullRefPtr<AudioRenderGraph> AudioRenderGraph::create()
+{
+    return adopt_ref(*new AudioRenderGraph);
+}
+
+AudioRenderGraph::AudioRenderGraph()
+{
+    m_destination = &create_node<RenderDestinationNode>();
+}
+
+AudioRenderGraph::~AudioRenderGraph() = default;
+
+RenderParam& AudioRenderGraph::create_param(float default_value, float min_value, float max_value, Bindings::AutomationRate automation_rate)
+{
+    auto param = make<RenderParam>(default_value, min_value, max_value, automation_rate);
+    auto& param_reference = *param;
+    m_params.append(move(param));
+    return param_reference;
+}
+
+void AudioRenderGraph::queue_control_message(Function<void()> steps)
+{
+    // NOTE: Until the graph is rendered on an audio output, nothing else can be looking at it, so the message can run
+    //       right away.
+    if (!m_is_rendering_on_output) {
+        steps();
+        return;
+    }
+
+    // NOTE: Once rendering has stopped for good, there is nobody left to run the message.
+    if (m_has_stopped_rendering)
+        return;
+
+    collect_completed_control_messages();
+    m_pending_control_messages.append(make<ControlMessage>(move(steps)));
+    flush_pending_control_messages();
+}
+
+void AudioRenderGraph::flush_pending_control_messages()
+{
+    size_t flushed_message_count = 0;
+    for (auto& message : m_pending_control_messages) {
+        if (!m_control_messages.try_enqueue(move(message)))
+            break;
+        ++flushed_message_count;
+    }
+    m_pending_control_messages.remove(0, flushed_message_count);
+
+    // If the rendering thread has fallen behind, try again once it had a chance to catch up.
+    if (!m_pending_control_messages.is_empty() && m_flush_pending_control_messages_timer)
+        m_flush_pending_control_messages_timer->start();
+}
+
+void AudioRenderGraph::collect_completed_control_messages()
+{
+    while (m_completed_control_messages.try_dequeue().has_value())
+        ;
+}
+
+void AudioRenderGraph::run_control_messages()
+{
+    // NOTE: Messages are handed back to the control thread once they have run, so that any memory they hold on to is
+    //       freed there instead of on the rendering thread.
+    while (!m_completed_control_messages.is_full()) {
+        auto message = m_control_messages.try_dequeue();
+        if (!message.has_value())
+            break;
+        (*message)->steps();
+        auto enqueued = m_completed_control_messages.try_enqueue(message.release_value());
+        VERIFY(enqueued);
+    }
+}
+
+ErrorOr<void> AudioRenderGraph::start_rendering(u32 target_latency_ms)
+{
+    if (m_is_rendering_on_output)
+        return Error::from_string_literal("Audio graph has already been rendered on an audio output");
+
+    m_flush_pending_control_messages_timer = Core::Timer::create_single_shot(target_latency_ms, [this] {
+        collect_completed_control_messages();
+        flush_pending_control_messages();
+    });
+
+    // NOTE: The audio output calls back into the graph from its own high priority thread whenever it needs more data,
+    //       which is where the graph is rendered from now on.
+    m_is_rendering_on_output = true;
+    m_output = TRY(Audio::PlaybackStream::create(Audio::OutputState::Playing, static_cast<u32>(m_sample_rate), OUTPUT_CHANNEL_COUNT, target_latency_ms,
+        [graph = NonnullRefPtr { *this }](Bytes buffer, Audio::PcmSampleFormat format, size_t sample_count) {
+            return graph->render(buffer, format, sample_count);
+        }));
+    return {};
+}
+
+void AudioRenderGraph::resume_rendering()
+{
+    if (m_output)
+        m_output->resume();
+}
+
+void AudioRenderGraph::suspend_rendering()
+{
+    if (m_output)
+        m_output->discard_buffer_and_suspend();
+}
+
+void AudioRenderGraph::stop_rendering()
+{
+    // NOTE: This drops the audio output's reference to the graph along with the output itself.
+    if (m_is_rendering_on_output)
+        m_has_stopped_rendering = true;
+    if (m_output) {
+        m_output->discard_buffer_and_suspend();
+        m_output = nullptr;
+    }
+    if (m_flush_pending_control_messages_timer) {
+        m_flush_pending_control_messages_timer->stop();
+        m_flush_pending_control_messages_timer = nullptr;
+    }
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-baseaudiocontext-currenttime
+double AudioRenderGraph::current_time() const
+{
+    if (m_sample_rate == 0)
+        return 0;
+    return static_cast<double>(m_rendered_frames.load(AK::memory_order_acquire)) / m_sample_rate;
+}
+
+void AudioRenderGraph::render_quantum(AudioBlock& output)
+{
+    // https://webaudio.github.io/web-audio-api/#rendering-loop
+    // 4.1. Process the control message queue.
+    run_control_messages();
+
+    // 4.4. Process the graph.
+    m_quantum.sample_rate = m_sample_rate;
+    output = m_destination->pull(m_quantum);
+
+    // 4.6. Atomically perform the following steps:
+    //      1. Increment [[current frame]] by the [[render quantum size]].
+    //      2. Set currentTime to [[current frame]] divided by sampleRate.
+    ++m_quantum.index;
+    m_quantum.start_frame += RENDER_QUANTUM_SIZE;
+    m_rendered_frames.store(m_quantum.start_frame, AK::memory_order_release);
+}
+
+ReadonlyBytes AudioRenderGraph::render(Bytes buffer, Audio::PcmSampleFormat format, size_t frame_count)
+{
+    VERIFY(format == Audio::PcmSampleFormat::Float32);
+
+    frame_count = min(frame_count, buffer.size() / (sizeof(float) * OUTPUT_CHANNEL_COUNT));
+    auto* samples = reinterpret_cast<float*>(buffer.data());
+
+    for (size_t frame = 0; frame < frame_count; ++frame) {
+        if (m_frames_left_in_output_block == 0) {
+            render_quantum(m_output_block);
+            m_frames_left_in_output_block = RENDER_QUANTUM_SIZE;
+        }
+
+        // NOTE: A mono destination is played on every output channel.
+        auto index = RENDER_QUANTUM_SIZE - m_frames_left_in_output_block--;
+        for (size_t channel = 0; channel < OUTPUT_CHANNEL_COUNT; ++channel)
+            samples[frame * OUTPUT_CHANNEL_COUNT + channel] = m_output_block.channel(min(channel, m_output_block.channel_count - 1))[index];
+    }
+
+    return buffer.trim(frame_count * sizeof(float) * OUTPUT_CHANNEL_COUNT);
+}
+
+}
@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Atomic.h>
+#include <AK/AtomicRefCounted.h>
+#include <AK/Function.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/OwnPtr.h>
+#include <AK/SPSCQueue.h>
+#include <AK/Vector.h>
+#include <LibCore/Forward.h>
+#include <LibMedia/Audio/PlaybackStream.h>
+#include <LibWeb/Bindings/AudioNodePrototype.h>
+#include <LibWeb/Bindings/AudioParamPrototype.h>
+#include <LibWeb/Bindings/BiquadFilterNodePrototype.h>
+#include <LibWeb/Bindings/OscillatorNodePrototype.h>
+#include <LibWeb/WebAudio/DSP.h>
+
+namespace Web::WebAudio {
+
+// This file contains the rendering side of the audio graph. The AudioNode and AudioParam objects that JS interacts with
+// live on the control thread, and each of them owns a counterpart here that is only ever touched by the rendering
+// thread once the graph is being rendered. The control thread describes graph changes as control messages, which are
+// handed to the rendering thread through lock-free queues and applied at the start of the next render quantum.
+
+// https://webaudio.github.io/web-audio-api/#render-quantum-size
+static constexpr size_t RENDER_QUANTUM_SIZE = 128;
+
+// FIXME: Support rendering more than two channels per connection.
+static constexpr size_t MAX_RENDER_CHANNELS = 2;
+
+struct RenderQuantum {
+    u64 index { 0 };
+    u64 start_frame { 0 };
+    float sample_rate { 0 };
+
+    double start_time() const { return static_cast<double>(start_frame) / sample_rate; }
+};
+
+// https://webaudio.github.io/web-audio-api/#audio-block
+struct AudioBlock {
+    size_t channel_count { 1 };
+    Array<Array<float, RENDER_QUANTUM_SIZE>, MAX_RENDER_CHANNELS> channels {};
+
+    Span<float> channel(size_t index) { return channels[index].span(); }
+    ReadonlySpan<float> channel(size_t index) const { return channels[index].span(); }
+
+    void clear();
+
+    // https://webaudio.github.io/web-audio-api/#channel-up-mixing-and-down-mixing
+    void mix_in(AudioBlock const&, Bindings::ChannelInterpretation);
+};
+
+// https://webaudio.github.io/web-audio-api/#dom-audioparam-setvalueattime etc.
+struct AutomationEvent {
+    enum class Type : u8 {
+        SetValue,
+        LinearRamp,
+        ExponentialRamp,
+        SetTarget,
+        SetValueCurve,
+    };
+
+    Type type { Type::SetValue };
+    float value { 0 };
+
+    // The time at which the event starts. For ramps, this is the time at which the ramp ends.
+    double time { 0 };
+
+    // When a ramp is the first event of the timeline, it starts at the time it was scheduled at.
+    double scheduled_at_time { 0 };
+
+    double time_constant { 0 };
+    double duration { 0 };
+    Vector<float> curve;
+
+    bool is_ramp() const { return type == Type::LinearRamp || type == Type::ExponentialRamp; }
+    double end_time() const { return type == Type::SetValueCurve ? time + duration : time; }
+};
+
+class RenderNode;
+
+// The rendering thread's counterpart of an AudioParam.
+class RenderParam {
+public:
+    RenderParam(float default_value, float min_value, float max_value, Bindings::AutomationRate);
+
+    // https://webaudio.github.io/web-audio-api/#computation-of-value
+    void compute(RenderQuantum const&);
+
+    bool is_a_rate() const { return automation_rate == Bindings::AutomationRate::ARate; }
+    float value_at(size_t frame) const { return m_values[is_a_rate() ? frame : 0]; }
+    ReadonlySpan<float> values() const { return m_values.span(); }
+
+    // Whether every frame of the most recently computed quantum has the same value.
+    bool has_constant_value() const { return m_is_constant; }
+
+    // The value computed for the most recent render quantum. May be read from any thread.
+    float last_computed_value() const { return m_last_computed_value.load(AK::memory_order_relaxed); }
+
+    // These may only be called through control messages once the graph is being rendered.
+    void set_intrinsic_value(float);
+    void swap_events(Vector<AutomationEvent>&);
+
+    // These may only be touched through control messages once the graph is being rendered.
+    Bindings::AutomationRate automation_rate { Bindings::AutomationRate::ARate };
+    Vector<RenderNode*> inputs;
+
+private:
+    void reset_timeline_evaluation();
+    bool timeline_changes_before(double time) const;
+    float value_at_time(double time);
+
+    float m_intrinsic_value { 0 };
+    float m_min_value { 0 };
+    float m_max_value { 0 };
+    Vector<AutomationEvent> m_events;
+
+    // NOTE: Events that have completely passed are folded into these, so that evaluating the timeline does not have to
+    //       walk the events from the start for every sample.
+    size_t m_first_pending_event { 0 };
+    float m_anchor_value { 0 };
+    double m_anchor_time { 0 };
+    Optional<size_t> m_active_target_event;
+
+    AudioBlock m_input_block;
+    Array<float, RENDER_QUANTUM_SIZE> m_values {};
+    bool m_is_constant { true };
+    Atomic<float> m_last_computed_value { 0 };
+};
+
+// The rendering thread's counterpart of an AudioNode.
+class RenderNode {
+public:
+    virtual ~RenderNode() = default;
+
+    // Renders the node for the given quantum, at most once per quantum.
+    AudioBlock const& pull(RenderQuantum const&);
+
+    // These may only be touched through control messages once the graph is being rendered.
+    Vector<RenderNode*> inputs;
+    size_t channel_count { 2 };
+    Bindings::ChannelCountMode channel_count_mode { Bindings::ChannelCountMode::Max };
+    Bindings::ChannelInterpretation channel_interpretation { Bindings::ChannelInterpretation::Speakers };
+
+protected:
+    RenderNode() = default;
+
+    virtual void process(RenderQuantum const&, AudioBlock const& input, AudioBlock& output) = 0;
+
+    // https://webaudio.github.io/web-audio-api/#computednumberofchannels
+    size_t computed_number_of_channels(size_t max_input_channels) const;
+
+private:
+    Optional<u64> m_last_rendered_quantum;
+    AudioBlock m_input;
+    AudioBlock m_output;
+};
+
+// Any node type whose processing has not been implemented yet passes its input through unchanged.
+class RenderPassThroughNode final : public RenderNode {
+private:
+    virtual void process(RenderQuantum const&, AudioBlock const& input, AudioBlock& output) override;
+};
+
+// https://webaudio.github.io/web-audio-api/#AudioDestinationNode
+class RenderDestinationNode final : public RenderNode {
+private:
+    virtual void process(RenderQuantum const&, AudioBlock const& input, AudioBlock& output) override;
+};
+
+// https://webaudio.github.io/web-audio-api/#GainNode
+class RenderGainNode final : public RenderNode {
+public:
+    explicit RenderGainNode(RenderParam& gain)
+        : m_gain(gain)
+    {
+    }
+
+private:
+    virtual void process(RenderQuantum const&, AudioBlock const& input, AudioBlock& output) override;
+
+    RenderParam& m_gain;
+};
+
+// https://webaudio.github.io/web-audio-api/#BiquadFilterNode
+class RenderBiquadFilterNode final : public RenderNode {
+public:
+    RenderBiquadFilterNode(RenderParam& frequency, RenderParam& detune, RenderParam& q, RenderParam& gain, Bindings::BiquadFilterType type)
+        : type(type)
+        , m_frequency(frequency)
+        , m_detune(detune)
+        , m_q(q)
+        , m_gain(gain)
+    {
+    }
+
+    Bindings::BiquadFilterType type;
+
+private:
+    virtual void process(RenderQuantum const&, AudioBlock const& input, AudioBlock& output) override;
+
+    RenderParam& m_frequency;
+    RenderParam& m_detune;
+    RenderParam& m_q;
+    RenderParam& m_gain;
+    DSP::BiquadState m_state;
+};
+
+// https://webaudio.github.io/web-audio-api/#filters-characteristics
+DSP::BiquadCoefficients compute_biquad_coefficients(Bindings::BiquadFilterType, float sample_rate, float frequency, float detune, float q, float gain);
+
+// https://webaudio.github.io/web-audio-api/#AudioScheduledSourceNode
+class RenderScheduledSourceNode : public RenderNode {
+public:
+    // These may only be touched through control messages once the graph is being rendered.
+    Optional<double> start_time;
+    Optional<double> stop_time;
+
+protected:
+    // Returns the range of frames in the quantum during which the source is playing, clearing the rest of the output.
+    struct ActiveFrames {
+        size_t first { 0 };
+        size_t end { 0 };
+        bool is_empty() const { return first >= end; }
+    };
+    ActiveFrames active_frames(RenderQuantum const&, AudioBlock& output) const;
+};
+
+// https://webaudio.github.io/web-audio-api/#OscillatorNode
+class RenderOscillatorNode final : public RenderScheduledSourceNode {
+public:
+    RenderOscillatorNode(RenderParam& frequency, RenderParam& detune, Bindings::OscillatorType type)
+        : type(type)
+        , m_frequency(frequency)
+        , m_detune(detune)
+    {
+    }
+
+    static constexpr size_t CUSTOM_WAVEFORM_SIZE = 4096;
+
+    // These may only be touched through control messages once the graph is being rendered.
+    Bindings::OscillatorType type;
+    Vector<float> custom_waveform;
+
+private:
+    virtual void process(RenderQuantum const&, AudioBlock const& input, AudioBlock& output) override;
+
+    RenderParam& m_frequency;
+    RenderParam& m_detune;
+    double m_phase { 0 };
+};
+
+// https://webaudio.github.io/web-audio-api/#ConstantSourceNode
+class RenderConstantSourceNode final : public RenderScheduledSourceNode {
+public:
+    explicit RenderConstantSourceNode(RenderParam& offset)
+        : m_offset(offset)
+    {
+    }
+
+private:
+    virtual void process(RenderQuantum const&, AudioBlock const& input, AudioBlock& output) override;
+
+    RenderParam& m_offset;
+};
+
+// https://webaudio.github.io/web-audio-api/#AudioBufferSourceNode
+class RenderAudioBufferSourceNode final : public RenderScheduledSourceNode {
+public:
+    RenderAudioBufferSourceNode(RenderParam& playback_rate, RenderParam& detune)
+        : m_playback_rate(playback_rate)
+        , m_detune(detune)
+    {
+    }
+
+    // These may only be touched through control messages once the graph is being rendered.
+    Vector<Vector<float>> buffer;
+    float buffer_sample_rate { 0 };
+    double offset { 0 };
+    Optional<double> duration;
+    bool loop { false };
+    double loop_start { 0 };
+    double loop_end { 0 };
+
+private:
+    virtual void process(RenderQuantum const&, AudioBlock const& input, AudioBlock& output) override;
+
+    size_t frames_until_next_boundary(double playhead, double step, double actual_loop_end) const;
+
+    RenderParam& m_playback_rate;
+    RenderParam& m_detune;
+    Optional<double> m_playhead;
+    double m_played_duration { 0 };
+    bool m_has_finished { false };
+};
+
+// Owns the rendering side of a BaseAudioContext's audio graph, and renders it on the audio output's rendering thread.
+class AudioRenderGraph : public AtomicRefCounted<AudioRenderGraph> {
+public:
+    static NonnullRefPtr<AudioRenderGraph> create();
+    ~AudioRenderGraph();
+
+    // The methods below may only be called from the control thread.
+
+    template<typename NodeType, typename... Args>
+    NodeType& create_node(Args&&... args)
+    {
+        auto node = make<NodeType>(forward<Args>(args)...);
+        auto& node_reference = *node;
+        m_nodes.append(move(node));
+        return node_reference;
+    }
+
+    RenderParam& create_param(float default_value, float min_value, float max_value, Bindings::AutomationRate);
+
+    RenderDestinationNode& destination() { return *m_destination; }
+
+    // Queues a control message, which is run on the rendering thread before the next render quantum. Any data that
+    // the message moves out of the render graph should be kept in its captures, as the message is destroyed on the
+    // control thread after it has run.
+    void queue_control_message(Function<void()>);
+
+    void set_sample_rate(float sample_rate) { m_sample_rate = sample_rate; }
+
+    ErrorOr<void> start_rendering(u32 target_latency_ms);
+    bool is_rendering() const { return m_output; }
+    void resume_rendering();
+    void suspend_rendering();
+    void stop_rendering();
+
+    // https://webaudio.github.io/web-audio-api/#dom-baseaudiocontext-currenttime
+    double current_time() const;
+
+    // Renders the graph synchronously, for when it is not being rendered on an audio output.
+    void render_quantum(AudioBlock& output);
+
+private:
+    AudioRenderGraph();
+
+    struct ControlMessage {
+        Function<void()> steps;
+    };
+
+    void flush_pending_control_messages();
+    void collect_completed_control_messages();
+
+    // The methods below may only be called from the rendering thread.
+    ReadonlyBytes render(Bytes buffer, Audio::PcmSampleFormat, size_t frame_count);
+    void run_control_messages();
+
+    static constexpr size_t CONTROL_MESSAGE_QUEUE_SIZE = 256;
+    SPSCQueue<OwnPtr<ControlMessage>, CONTROL_MESSAGE_QUEUE_SIZE> m_control_messages;
+    SPSCQueue<OwnPtr<ControlMessage>, CONTROL_MESSAGE_QUEUE_SIZE> m_completed_control_messages;
+    Vector<OwnPtr<ControlMessage>> m_pending_control_messages;
+
+    // NOTE: Nodes and params are only ever destroyed together with the graph, so that the rendering thread never has to
+    //       free memory.
+    // FIXME: Collect the rendering side of nodes that are no longer reachable from JS and no longer playing.
+    Vector<NonnullOwnPtr<RenderNode>> m_nodes;
+    Vector<NonnullOwnPtr<RenderParam>> m_params;
+    RenderDestinationNode* m_destination { nullptr };
+
+    RefPtr<Audio::PlaybackStream> m_output;
+    float m_sample_rate { 0 };
+
+    bool m_is_rendering_on_output { false };
+    bool m_has_stopped_rendering { false };
+    RefPtr<Core::Timer> m_flush_pending_control_messages_timer;
+
+    RenderQuantum m_quantum;
+    AudioBlock m_output_block;
+    size_t m_frames_left_in_output_block { 0 };
+    Atomic<u64> m_rendered_frames { 0 };
+};
+
+}
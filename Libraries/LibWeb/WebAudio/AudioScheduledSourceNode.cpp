@@ -7,7 +7,9 @@
 #include <LibWeb/Bindings/AudioScheduledSourceNodePrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/WebAudio/AudioRenderGraph.h>
 #include <LibWeb/WebAudio/AudioScheduledSourceNode.h>
+#include <LibWeb/WebAudio/BaseAudioContext.h>
 
 namespace Web::WebAudio {
 
@@ -47,10 +49,10 @@ WebIDL::ExceptionOr<void> AudioScheduledSourceNode::start(double when)
     // 3. Set the internal slot [[source started]] on this AudioScheduledSourceNode to true.
     set_source_started(true);
 
-    // FIXME: 4. Queue a control message to start the AudioScheduledSourceNode, including the parameter values in the message.
-    // FIXME: 5. Send a control message to the associated AudioContext to start running its rendering thread only when all the following conditions are met:
-
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioScheduledSourceNode::start"_string);
+    // 4. Queue a control message to start the AudioScheduledSourceNode, including the parameter values in the message.
+    // 5. Send a control message to the associated AudioContext to start running its rendering thread only when all the following conditions are met:
+    queue_start_control_message(when);
+    return {};
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-audioscheduledsourcenode-stop
@@ -65,9 +67,29 @@ WebIDL::ExceptionOr<void> AudioScheduledSourceNode::stop(double when)
     if (when < 0)
         return WebIDL::SimpleException { WebIDL::SimpleExceptionType::RangeError, "when must not be negative"sv };
 
-    // FIXME: 3. Queue a control message to stop the AudioScheduledSourceNode, including the parameter values in the message.
+    // 3. Queue a control message to stop the AudioScheduledSourceNode, including the parameter values in the message.
+    // NOTE: If stop() is called again after already having been called, the last invocation will be the only one applied.
+    render_graph().queue_control_message([&node = render_source_node(), when] {
+        node.stop_time = when;
+    });
+    return {};
+}
+
+RenderScheduledSourceNode& AudioScheduledSourceNode::render_source_node()
+{
+    return static_cast<RenderScheduledSourceNode&>(render_node());
+}
 
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement AudioScheduledSourceNode::stop"_string);
+void AudioScheduledSourceNode::queue_start_control_message(double when, Function<void(RenderScheduledSourceNode&)> additional_steps)
+{
+    render_graph().queue_control_message([&node = render_source_node(), when, additional_steps = move(additional_steps)] {
+        if (additional_steps)
+            additional_steps(node);
+        node.start_time = when;
+    });
+
+    // NOTE: The audio output is only acquired once there is a source that can actually make a sound.
+    audio_context().did_start_source();
 }
 
 void AudioScheduledSourceNode::initialize(JS::Realm& realm)
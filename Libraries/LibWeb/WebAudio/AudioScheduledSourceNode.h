@@ -10,6 +10,8 @@
 
 namespace Web::WebAudio {
 
+class RenderScheduledSourceNode;
+
 // https://webaudio.github.io/web-audio-api/#AudioScheduledSourceNode
 class AudioScheduledSourceNode : public AudioNode {
     WEB_PLATFORM_OBJECT(AudioScheduledSourceNode, AudioNode);
@@ -30,6 +32,9 @@ protected:
     bool source_started() const { return m_source_started; }
     void set_source_started(bool started) { m_source_started = started; }
 
+    RenderScheduledSourceNode& render_source_node();
+    void queue_start_control_message(double when, Function<void(RenderScheduledSourceNode&)> additional_steps = {});
+
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
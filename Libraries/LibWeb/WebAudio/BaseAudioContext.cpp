@@ -15,6 +15,7 @@
 #include <LibWeb/WebAudio/AudioBuffer.h>
 #include <LibWeb/WebAudio/AudioBufferSourceNode.h>
 #include <LibWeb/WebAudio/AudioDestinationNode.h>
+#include <LibWeb/WebAudio/AudioRenderGraph.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/BiquadFilterNode.h>
 #include <LibWeb/WebAudio/ChannelMergerNode.h>
@@ -30,11 +31,16 @@ namespace Web::WebAudio {
 BaseAudioContext::BaseAudioContext(JS::Realm& realm, float sample_rate)
     : DOM::EventTarget(realm)
     , m_sample_rate(sample_rate)
+    , m_render_graph(AudioRenderGraph::create())
     , m_listener(AudioListener::create(realm, *this))
 {
+    m_render_graph->set_sample_rate(sample_rate);
 }
 
-BaseAudioContext::~BaseAudioContext() = default;
+BaseAudioContext::~BaseAudioContext()
+{
+    m_render_graph->stop_rendering();
+}
 
 void BaseAudioContext::initialize(JS::Realm& realm)
 {
@@ -50,6 +56,21 @@ void BaseAudioContext::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_listener);
 }
 
+// https://webaudio.github.io/web-audio-api/#dom-baseaudiocontext-currenttime
+double BaseAudioContext::current_time() const
+{
+    // This is the time in seconds of the sample frame immediately following the last sample-frame in the block of
+    // audio most recently processed by the context’s rendering graph.
+    return m_render_graph->current_time();
+}
+
+// https://webaudio.github.io/web-audio-api/#dom-baseaudiocontext-samplerate
+void BaseAudioContext::set_sample_rate(float sample_rate)
+{
+    m_sample_rate = sample_rate;
+    m_render_graph->set_sample_rate(sample_rate);
+}
+
 void BaseAudioContext::set_onstatechange(WebIDL::CallbackType* event_handler)
 {
     set_event_handler_attribute(HTML::EventNames::statechange, event_handler);
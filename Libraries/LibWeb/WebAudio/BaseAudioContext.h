@@ -24,6 +24,7 @@
 namespace Web::WebAudio {
 
 class AudioDestinationNode;
+class AudioRenderGraph;
 
 // https://webaudio.github.io/web-audio-api/#BaseAudioContext
 class BaseAudioContext : public DOM::EventTarget {
@@ -44,8 +45,9 @@ public:
     static constexpr float MAX_SAMPLE_RATE { 192000 };
 
     GC::Ref<AudioDestinationNode> destination() const { return *m_destination; }
+    AudioRenderGraph& render_graph() const { return *m_render_graph; }
     float sample_rate() const { return m_sample_rate; }
-    double current_time() const { return m_current_time; }
+    double current_time() const;
     GC::Ref<AudioListener> listener() const { return m_listener; }
     Bindings::AudioContextState state() const { return m_control_thread_state; }
 
@@ -55,9 +57,13 @@ public:
     void set_onstatechange(WebIDL::CallbackType*);
     WebIDL::CallbackType* onstatechange();
 
-    void set_sample_rate(float sample_rate) { m_sample_rate = sample_rate; }
+    void set_sample_rate(float sample_rate);
     void set_control_state(Bindings::AudioContextState state) { m_control_thread_state = state; }
     void set_rendering_state(Bindings::AudioContextState state) { m_rendering_thread_state = state; }
+    Bindings::AudioContextState rendering_state() const { return m_rendering_thread_state; }
+
+    // Called whenever an AudioScheduledSourceNode of this context is started.
+    virtual void did_start_source() { }
 
     static WebIDL::ExceptionOr<void> verify_audio_options_inside_nominal_range(JS::Realm&, float sample_rate);
     static WebIDL::ExceptionOr<void> verify_audio_options_inside_nominal_range(JS::Realm&, WebIDL::UnsignedLong number_of_channels, WebIDL::UnsignedLong length, float sample_rate);
@@ -94,7 +100,9 @@ private:
     void queue_a_decoding_operation(GC::Ref<JS::PromiseCapability>, GC::Root<WebIDL::BufferSource>, GC::Ptr<WebIDL::CallbackType>, GC::Ptr<WebIDL::CallbackType>);
 
     float m_sample_rate { 0 };
-    double m_current_time { 0 };
+
+    // NOTE: This has to be created before any AudioParam is, including the ones of the listener below.
+    NonnullRefPtr<AudioRenderGraph> m_render_graph;
 
     GC::Ref<AudioListener> m_listener;
 
@@ -5,13 +5,17 @@
  */
 
 #include <AK/Math.h>
+#include <LibJS/Runtime/TypedArray.h>
 #include <LibWeb/Bindings/AudioParamPrototype.h>
 #include <LibWeb/Bindings/BiquadFilterNodePrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/WebAudio/AudioNode.h>
 #include <LibWeb/WebAudio/AudioParam.h>
+#include <LibWeb/WebAudio/AudioRenderGraph.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/BiquadFilterNode.h>
+#include <LibWeb/WebIDL/Buffers.h>
+#include <LibWeb/WebIDL/DOMException.h>
 
 namespace Web::WebAudio {
 
@@ -33,6 +37,9 @@ BiquadFilterNode::~BiquadFilterNode() = default;
 void BiquadFilterNode::set_type(Bindings::BiquadFilterType type)
 {
     m_type = type;
+    render_graph().queue_control_message([&node = static_cast<RenderBiquadFilterNode&>(render_node()), type] {
+        node.type = type;
+    });
 }
 
 // https://webaudio.github.io/web-audio-api/#dom-biquadfilternode-type
@@ -68,10 +75,52 @@ GC::Ref<AudioParam> BiquadFilterNode::gain() const
 // https://webaudio.github.io/web-audio-api/#dom-biquadfilternode-getfrequencyresponse
 WebIDL::ExceptionOr<void> BiquadFilterNode::get_frequency_response(GC::Root<WebIDL::BufferSource> const& frequency_hz, GC::Root<WebIDL::BufferSource> const& mag_response, GC::Root<WebIDL::BufferSource> const& phase_response)
 {
-    (void)frequency_hz;
-    (void)mag_response;
-    (void)phase_response;
-    dbgln("FIXME: Implement BiquadFilterNode::get_frequency_response(Float32Array, Float32Array, Float32Array)");
+    auto& vm = this->vm();
+    for (auto const* array : { &frequency_hz, &mag_response, &phase_response }) {
+        if (!is<JS::Float32Array>(*(*array)->raw_object()))
+            return vm.throw_completion<JS::TypeError>(JS::ErrorType::NotAnObjectOfType, "Float32Array");
+    }
+    auto frequencies = static_cast<JS::Float32Array&>(*frequency_hz->raw_object()).data();
+    auto magnitudes = static_cast<JS::Float32Array&>(*mag_response->raw_object()).data();
+    auto phases = static_cast<JS::Float32Array&>(*phase_response->raw_object()).data();
+
+    // The three parameters MUST be of the same length, or an InvalidAccessError MUST be thrown.
+    if (frequencies.size() != magnitudes.size() || frequencies.size() != phases.size())
+        return WebIDL::InvalidAccessError::create(realm(), "Frequency, magnitude and phase arrays must be of the same length"_string);
+
+    // The frequency response returned MUST be computed with the AudioParam sampled for the current processing block.
+    auto sample_rate = context()->sample_rate();
+    auto coefficients = compute_biquad_coefficients(m_type, sample_rate, m_frequency->value(), m_detune->value(), m_q->value(), m_gain->value());
+
+    for (size_t i = 0; i < frequencies.size(); ++i) {
+        // If a value in frequencyHz is not within [0, sampleRate/2], where sampleRate is the value of the sampleRate
+        // property of the AudioContext, the corresponding value at the same index of the magResponse and phaseResponse
+        // array MUST be NaN.
+        auto frequency = static_cast<double>(frequencies[i]);
+        if (!(frequency >= 0 && frequency <= static_cast<double>(sample_rate) / 2)) {
+            magnitudes[i] = AK::NaN<float>;
+            phases[i] = AK::NaN<float>;
+            continue;
+        }
+
+        // H(z) = (b0 + b1 * z^-1 + b2 * z^-2) / (1 + a1 * z^-1 + a2 * z^-2), evaluated at z = e^(iω).
+        auto omega = 2 * AK::Pi<double> * frequency / static_cast<double>(sample_rate);
+        auto cos_omega = AK::cos(omega);
+        auto sin_omega = AK::sin(omega);
+        auto cos_2_omega = AK::cos(2 * omega);
+        auto sin_2_omega = AK::sin(2 * omega);
+
+        auto numerator_real = coefficients.b0 + coefficients.b1 * cos_omega + coefficients.b2 * cos_2_omega;
+        auto numerator_imaginary = -(coefficients.b1 * sin_omega + coefficients.b2 * sin_2_omega);
+        auto denominator_real = 1 + coefficients.a1 * cos_omega + coefficients.a2 * cos_2_omega;
+        auto denominator_imaginary = -(coefficients.a1 * sin_omega + coefficients.a2 * sin_2_omega);
+
+        auto magnitude = AK::hypot(numerator_real, numerator_imaginary) / AK::hypot(denominator_real, denominator_imaginary);
+        auto phase = AK::atan2(numerator_imaginary, numerator_real) - AK::atan2(denominator_imaginary, denominator_real);
+        magnitudes[i] = static_cast<float>(magnitude);
+        phases[i] = static_cast<float>(AK::atan2(AK::sin(phase), AK::cos(phase)));
+    }
+
     return {};
 }
 
@@ -100,6 +149,11 @@ WebIDL::ExceptionOr<GC::Ref<BiquadFilterNode>> BiquadFilterNode::construct_impl(
     return node;
 }
 
+RenderNode& BiquadFilterNode::create_render_node(AudioRenderGraph& graph)
+{
+    return graph.create_node<RenderBiquadFilterNode>(m_frequency->render_param(), m_detune->render_param(), m_q->render_param(), m_gain->render_param(), m_type);
+}
+
 void BiquadFilterNode::initialize(JS::Realm& realm)
 {
     WEB_SET_PROTOTYPE_FOR_INTERFACE(BiquadFilterNode);
@@ -7,6 +7,8 @@
 #include <AK/NumericLimits.h>
 #include <LibWeb/Bindings/ConstantSourceNodePrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/WebAudio/AudioParam.h>
+#include <LibWeb/WebAudio/AudioRenderGraph.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/ConstantSourceNode.h>
 
@@ -44,4 +46,9 @@ void ConstantSourceNode::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_offset);
 }
 
+RenderNode& ConstantSourceNode::create_render_node(AudioRenderGraph& graph)
+{
+    return graph.create_node<RenderConstantSourceNode>(m_offset->render_param());
+}
+
 }
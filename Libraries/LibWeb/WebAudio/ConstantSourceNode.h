@@ -37,6 +37,8 @@ private:
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
+    virtual RenderNode& create_render_node(AudioRenderGraph&) override;
+
     // https://webaudio.github.io/web-audio-api/#dom-constantsourcenode-offset
     GC::Ref<AudioParam> m_offset;
 };
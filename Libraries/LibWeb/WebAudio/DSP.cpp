@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Math.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
+#include <AK/SIMDMath.h>
+#include <AK/Vector.h>
+#include <LibWeb/WebAudio/DSP.h>
+
+// See the comment in SIMDMath.h on why this is safe to ignore.
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+namespace Web::WebAudio::DSP {
+
+using AK::SIMD::f32x4;
+using AK::SIMD::load_unaligned;
+using AK::SIMD::store_unaligned;
+
+static constexpr size_t LANES = 4;
+
+void add(Span<float> destination, ReadonlySpan<float> source)
+{
+    VERIFY(destination.size() <= source.size());
+
+    size_t i = 0;
+    for (; i + LANES <= destination.size(); i += LANES) {
+        auto value = load_unaligned<f32x4>(&destination[i]) + load_unaligned<f32x4>(&source[i]);
+        store_unaligned(&destination[i], value);
+    }
+    for (; i < destination.size(); ++i)
+        destination[i] += source[i];
+}
+
+void multiply_add(Span<float> destination, ReadonlySpan<float> source, float gain)
+{
+    VERIFY(destination.size() <= source.size());
+
+    auto gains = AK::SIMD::expand4(gain);
+    size_t i = 0;
+    for (; i + LANES <= destination.size(); i += LANES) {
+        auto value = load_unaligned<f32x4>(&destination[i]) + load_unaligned<f32x4>(&source[i]) * gains;
+        store_unaligned(&destination[i], value);
+    }
+    for (; i < destination.size(); ++i)
+        destination[i] += source[i] * gain;
+}
+
+void multiply(Span<float> destination, ReadonlySpan<float> source, float gain)
+{
+    VERIFY(destination.size() <= source.size());
+
+    auto gains = AK::SIMD::expand4(gain);
+    size_t i = 0;
+    for (; i + LANES <= destination.size(); i += LANES)
+        store_unaligned(&destination[i], load_unaligned<f32x4>(&source[i]) * gains);
+    for (; i < destination.size(); ++i)
+        destination[i] = source[i] * gain;
+}
+
+void multiply(Span<float> destination, ReadonlySpan<float> source, ReadonlySpan<float> gain)
+{
+    VERIFY(destination.size() <= source.size());
+    VERIFY(destination.size() <= gain.size());
+
+    size_t i = 0;
+    for (; i + LANES <= destination.size(); i += LANES)
+        store_unaligned(&destination[i], load_unaligned<f32x4>(&source[i]) * load_unaligned<f32x4>(&gain[i]));
+    for (; i < destination.size(); ++i)
+        destination[i] = source[i] * gain[i];
+}
+
+void clamp(Span<float> values, float min, float max, float nan_replacement)
+{
+    auto replacements = AK::SIMD::expand4(nan_replacement);
+    size_t i = 0;
+    for (; i + LANES <= values.size(); i += LANES) {
+        auto value = load_unaligned<f32x4>(&values[i]);
+        // NOTE: NaN is the only value that does not compare equal to itself.
+        value = value == value ? value : replacements;
+        store_unaligned(&values[i], AK::SIMD::clamp(value, min, max));
+    }
+    for (; i < values.size(); ++i) {
+        auto value = values[i];
+        if (value != value)
+            value = nan_replacement;
+        values[i] = AK::clamp(value, min, max);
+    }
+}
+
+void linear_interpolate(Span<float> destination, ReadonlySpan<float> source, double position, double step)
+{
+    // NOTE: Positions are tracked in double precision, as buffers may well be longer than a float can index exactly.
+    struct IndexAndFraction {
+        size_t index;
+        float fraction;
+    };
+    auto index_and_fraction = [&](size_t frame) {
+        auto frame_position = position + static_cast<double>(frame) * step;
+        auto index = static_cast<size_t>(frame_position);
+        VERIFY(index + 1 < source.size());
+        return IndexAndFraction { index, static_cast<float>(frame_position - static_cast<double>(index)) };
+    };
+
+    size_t i = 0;
+    for (; i + LANES <= destination.size(); i += LANES) {
+        auto [index0, fraction0] = index_and_fraction(i);
+        auto [index1, fraction1] = index_and_fraction(i + 1);
+        auto [index2, fraction2] = index_and_fraction(i + 2);
+        auto [index3, fraction3] = index_and_fraction(i + 3);
+
+        auto current = AK::SIMD::load4(&source[index0], &source[index1], &source[index2], &source[index3]);
+        auto next = AK::SIMD::load4(&source[index0 + 1], &source[index1 + 1], &source[index2 + 1], &source[index3 + 1]);
+        f32x4 fractions { fraction0, fraction1, fraction2, fraction3 };
+        store_unaligned(&destination[i], current + (next - current) * fractions);
+    }
+    for (; i < destination.size(); ++i) {
+        auto [index, fraction] = index_and_fraction(i);
+        destination[i] = source[index] + (source[index + 1] - source[index]) * fraction;
+    }
+}
+
+void biquad(Span<Span<float>> channels, BiquadCoefficients const& coefficients, BiquadState& state)
+{
+    VERIFY(channels.size() <= MAX_BIQUAD_CHANNELS);
+    if (channels.is_empty())
+        return;
+
+    auto frame_count = channels[0].size();
+    for (auto const& channel : channels)
+        VERIFY(channel.size() == frame_count);
+
+    auto b0 = AK::SIMD::expand4(coefficients.b0);
+    auto b1 = AK::SIMD::expand4(coefficients.b1);
+    auto b2 = AK::SIMD::expand4(coefficients.b2);
+    auto a1 = AK::SIMD::expand4(coefficients.a1);
+    auto a2 = AK::SIMD::expand4(coefficients.a2);
+    auto z1 = load_unaligned<f32x4>(state.z1.data());
+    auto z2 = load_unaligned<f32x4>(state.z2.data());
+
+    for (size_t i = 0; i < frame_count; ++i) {
+        f32x4 x {};
+        for (size_t channel = 0; channel < channels.size(); ++channel)
+            x[channel] = channels[channel][i];
+
+        // y[n] = b0 * x[n] + z1[n - 1]
+        // z1[n] = b1 * x[n] - a1 * y[n] + z2[n - 1]
+        // z2[n] = b2 * x[n] - a2 * y[n]
+        auto y = b0 * x + z1;
+        z1 = b1 * x - a1 * y + z2;
+        z2 = b2 * x - a2 * y;
+
+        for (size_t channel = 0; channel < channels.size(); ++channel)
+            channels[channel][i] = y[channel];
+    }
+
+    // NOTE: Denormals in a decaying filter state would make every following frame very slow to compute.
+    auto flush_denormals = [](f32x4 value) {
+        auto magnitude = value < 0.0f ? -value : value;
+        return magnitude < NumericLimits<float>::min_normal() ? f32x4 {} : value;
+    };
+    store_unaligned(state.z1.data(), flush_denormals(z1));
+    store_unaligned(state.z2.data(), flush_denormals(z2));
+}
+
+static void bit_reverse_permute(Span<float> real, Span<float> imaginary)
+{
+    auto size = real.size();
+    for (size_t i = 1, j = 0; i < size; ++i) {
+        auto bit = size >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+
+        if (i < j) {
+            swap(real[i], real[j]);
+            swap(imaginary[i], imaginary[j]);
+        }
+    }
+}
+
+void fft(Span<float> real, Span<float> imaginary)
+{
+    auto size = real.size();
+    VERIFY(imaginary.size() == size);
+    VERIFY(is_power_of_two(size));
+    if (size < 2)
+        return;
+
+    bit_reverse_permute(real, imaginary);
+
+    // W[k] = e^(-2πik/N), for every k < N / 2.
+    Vector<float> twiddle_real;
+    Vector<float> twiddle_imaginary;
+    twiddle_real.resize(size / 2);
+    twiddle_imaginary.resize(size / 2);
+    for (size_t k = 0; k < size / 2; ++k) {
+        auto angle = -2 * AK::Pi<double> * static_cast<double>(k) / static_cast<double>(size);
+        twiddle_real[k] = static_cast<float>(AK::cos(angle));
+        twiddle_imaginary[k] = static_cast<float>(AK::sin(angle));
+    }
+
+    for (size_t span = 2; span <= size; span *= 2) {
+        auto half = span / 2;
+        auto twiddle_stride = size / span;
+
+        for (size_t start = 0; start < size; start += span) {
+            size_t j = 0;
+
+            // Four butterflies at a time, for every stage but the first two.
+            for (; j + LANES <= half; j += LANES) {
+                auto* w_real = &twiddle_real[j * twiddle_stride];
+                auto* w_imaginary = &twiddle_imaginary[j * twiddle_stride];
+                auto wr = AK::SIMD::load4(w_real, w_real + twiddle_stride, w_real + 2 * twiddle_stride, w_real + 3 * twiddle_stride);
+                auto wi = AK::SIMD::load4(w_imaginary, w_imaginary + twiddle_stride, w_imaginary + 2 * twiddle_stride, w_imaginary + 3 * twiddle_stride);
+
+                auto a = start + j;
+                auto b = a + half;
+                auto ur = load_unaligned<f32x4>(&real[a]);
+                auto ui = load_unaligned<f32x4>(&imaginary[a]);
+                auto br = load_unaligned<f32x4>(&real[b]);
+                auto bi = load_unaligned<f32x4>(&imaginary[b]);
+                auto vr = br * wr - bi * wi;
+                auto vi = br * wi + bi * wr;
+
+                store_unaligned(&real[a], ur + vr);
+                store_unaligned(&imaginary[a], ui + vi);
+                store_unaligned(&real[b], ur - vr);
+                store_unaligned(&imaginary[b], ui - vi);
+            }
+
+            for (; j < half; ++j) {
+                auto wr = twiddle_real[j * twiddle_stride];
+                auto wi = twiddle_imaginary[j * twiddle_stride];
+
+                auto a = start + j;
+                auto b = a + half;
+                auto vr = real[b] * wr - imaginary[b] * wi;
+                auto vi = real[b] * wi + imaginary[b] * wr;
+
+                real[b] = real[a] - vr;
+                imaginary[b] = imaginary[a] - vi;
+                real[a] += vr;
+                imaginary[a] += vi;
+            }
+        }
+    }
+}
+
+void inverse_fft(Span<float> real, Span<float> imaginary)
+{
+    // The inverse transform is the forward transform of the complex conjugate, conjugated again.
+    multiply(imaginary, imaginary, -1);
+    fft(real, imaginary);
+    multiply(imaginary, imaginary, -1);
+}
+
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/Span.h>
+#include <AK/Types.h>
+
+// Vectorized kernels for the inner loops of audio rendering. All of them accept spans of any length, and process the
+// frames that don't fill up a whole vector one at a time.
+namespace Web::WebAudio::DSP {
+
+// destination[i] += source[i]
+void add(Span<float> destination, ReadonlySpan<float> source);
+
+// destination[i] += source[i] * gain
+void multiply_add(Span<float> destination, ReadonlySpan<float> source, float gain);
+
+// destination[i] = source[i] * gain
+void multiply(Span<float> destination, ReadonlySpan<float> source, float gain);
+
+// destination[i] = source[i] * gain[i]
+void multiply(Span<float> destination, ReadonlySpan<float> source, ReadonlySpan<float> gain);
+
+// Replaces any NaN with nan_replacement, then clamps each value to [min, max].
+void clamp(Span<float> values, float min, float max, float nan_replacement);
+
+// destination[i] = source linearly interpolated at (position + i * step). The frame following every position that is
+// read from must lie inside of source.
+void linear_interpolate(Span<float> destination, ReadonlySpan<float> source, double position, double step);
+
+// https://webaudio.github.io/web-audio-api/#filters-characteristics
+// The coefficients are normalized, such that a0 is 1.
+struct BiquadCoefficients {
+    float b0 { 1 };
+    float b1 { 0 };
+    float b2 { 0 };
+    float a1 { 0 };
+    float a2 { 0 };
+};
+
+static constexpr size_t MAX_BIQUAD_CHANNELS = 4;
+
+struct BiquadState {
+    Array<float, MAX_BIQUAD_CHANNELS> z1 {};
+    Array<float, MAX_BIQUAD_CHANNELS> z2 {};
+};
+
+// Runs a biquad filter in transposed direct form II over each of the given channels, in place. As every output frame
+// depends on the previous one, the channels are filtered side by side in the lanes of a vector instead.
+void biquad(Span<Span<float>> channels, BiquadCoefficients const&, BiquadState&);
+
+// In-place radix-2 fast Fourier transform, computing X[k] = sum(x[n] * e^(-2πikn/N)). The size must be a power of two.
+void fft(Span<float> real, Span<float> imaginary);
+
+// In-place inverse of fft(), computing x[n] = sum(X[k] * e^(2πikn/N)), without dividing by N.
+void inverse_fft(Span<float> real, Span<float> imaginary);
+
+}
@@ -7,6 +7,7 @@
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/WebAudio/AudioNode.h>
 #include <LibWeb/WebAudio/AudioParam.h>
+#include <LibWeb/WebAudio/AudioRenderGraph.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/GainNode.h>
 
@@ -57,4 +58,9 @@ void GainNode::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_gain);
 }
 
+RenderNode& GainNode::create_render_node(AudioRenderGraph& graph)
+{
+    return graph.create_node<RenderGainNode>(m_gain->render_param());
+}
+
 }
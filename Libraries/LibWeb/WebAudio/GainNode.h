@@ -38,6 +38,8 @@ protected:
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
+    virtual RenderNode& create_render_node(AudioRenderGraph&) override;
+
 private:
     // https://webaudio.github.io/web-audio-api/#dom-gainnode-gain
     GC::Ref<AudioParam> m_gain;
@@ -4,16 +4,25 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <LibWeb/Bindings/ExceptionOrUtils.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/Event.h>
 #include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/HTML/Window.h>
+#include <LibWeb/WebAudio/AudioBuffer.h>
 #include <LibWeb/WebAudio/AudioDestinationNode.h>
+#include <LibWeb/WebAudio/AudioRenderGraph.h>
 #include <LibWeb/WebAudio/OfflineAudioContext.h>
+#include <LibWeb/WebIDL/Promise.h>
 
 namespace Web::WebAudio {
 
 GC_DEFINE_ALLOCATOR(OfflineAudioContext);
 
+// NOTE: Rendering is split up into slices of this many render quanta, each rendered from its own task.
+static constexpr size_t RENDER_QUANTA_PER_SLICE = 1024;
+
 // https://webaudio.github.io/web-audio-api/#dom-offlineaudiocontext-offlineaudiocontext
 WebIDL::ExceptionOr<GC::Ref<OfflineAudioContext>> OfflineAudioContext::construct_impl(JS::Realm& realm, OfflineAudioContextOptions const& context_options)
 {
@@ -23,7 +32,7 @@ WebIDL::ExceptionOr<GC::Ref<OfflineAudioContext>> OfflineAudioContext::construct
     TRY(verify_audio_options_inside_nominal_range(realm, context_options.number_of_channels, context_options.length, context_options.sample_rate));
 
     // Let c be a new OfflineAudioContext object. Initialize c as follows:
-    auto c = realm.create<OfflineAudioContext>(realm, context_options.length, context_options.sample_rate);
+    auto c = realm.create<OfflineAudioContext>(realm, context_options.number_of_channels, context_options.length, context_options.sample_rate);
 
     // 1. Set the [[control thread state]] for c to "suspended".
     c->set_control_state(Bindings::AudioContextState::Suspended);
@@ -58,7 +67,115 @@ OfflineAudioContext::~OfflineAudioContext() = default;
 // https://webaudio.github.io/web-audio-api/#dom-offlineaudiocontext-startrendering
 WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> OfflineAudioContext::start_rendering()
 {
-    return WebIDL::NotSupportedError::create(realm(), "FIXME: Implement OfflineAudioContext::start_rendering"_string);
+    auto& realm = this->realm();
+
+    // 1. If this's relevant global object's associated Document is not fully active then return a promise rejected
+    //    with "InvalidStateError" DOMException.
+    auto const& associated_document = as<HTML::Window>(HTML::relevant_global_object(*this)).associated_document();
+    if (!associated_document.is_fully_active())
+        return WebIDL::InvalidStateError::create(realm, "Document is not fully active"_string);
+
+    // 2. If the [[rendering started]] slot on the OfflineAudioContext is true, return a rejected promise with
+    //    InvalidStateError, and abort these steps.
+    if (m_rendering_started)
+        return WebIDL::InvalidStateError::create(realm, "Rendering has already been started"_string);
+
+    // 3. Set the [[rendering started]] slot of the OfflineAudioContext to true.
+    m_rendering_started = true;
+
+    // 4. Let promise be a new promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 5. Create a new AudioBuffer, with a number of channels, length and sample rate equal respectively to the
+    //    numberOfChannels, length and sampleRate values passed to this instance's constructor in the contextOptions
+    //    parameter. Assign this buffer to an internal slot [[rendered buffer]] in the OfflineAudioContext.
+    auto buffer = AudioBuffer::create(realm, m_number_of_channels, m_length, sample_rate());
+
+    // 6. If an exception was thrown during the preceding AudioBuffer constructor call, reject promise with this exception.
+    if (buffer.is_exception()) {
+        WebIDL::reject_promise(realm, promise, Bindings::exception_to_throw_completion(realm.vm(), buffer.release_error()).release_value());
+        return promise;
+    }
+    m_rendered_buffer = buffer.release_value();
+
+    // 7. Otherwise, in the case that the buffer was successfully constructed, begin offline rendering.
+    begin_offline_rendering(promise);
+
+    // 8. Append promise to [[pending promises]].
+    m_pending_promises.append(promise);
+
+    // 9. Return promise.
+    return promise;
+}
+
+// https://webaudio.github.io/web-audio-api/#begin-offline-rendering
+void OfflineAudioContext::begin_offline_rendering(GC::Ref<WebIDL::Promise> promise)
+{
+    set_rendering_state(Bindings::AudioContextState::Running);
+    set_control_state(Bindings::AudioContextState::Running);
+    queue_a_media_element_task(GC::create_function(heap(), [this] {
+        dispatch_event(DOM::Event::create(realm(), HTML::EventNames::statechange));
+    }));
+
+    // NOTE: Instead of rendering on a thread of its own, the graph is rendered in slices from tasks on the event loop.
+    //       Script can still change the graph in between two slices, just like control messages would between two
+    //       render quanta.
+    queue_a_media_element_task(GC::create_function(heap(), [this, promise] {
+        render_next_slice(promise);
+    }));
+}
+
+void OfflineAudioContext::render_next_slice(GC::Ref<WebIDL::Promise> promise)
+{
+    // 1. Given the current connections and scheduled changes, start rendering length sample-frames of audio into
+    //    [[rendered buffer]].
+    Vector<Span<float>> channels;
+    for (size_t channel = 0; channel < m_rendered_buffer->number_of_channels(); ++channel)
+        channels.append(MUST(m_rendered_buffer->get_channel_data(channel))->data());
+
+    // FIXME: 2. For every render quantum, check and suspend rendering if necessary.
+    // FIXME: 3. If a suspended context is resumed, continue to render the buffer.
+    AudioBlock block;
+    for (size_t quantum = 0; quantum < RENDER_QUANTA_PER_SLICE && m_rendered_frame_count < m_length; ++quantum) {
+        render_graph().render_quantum(block);
+
+        // NOTE: A mono destination is up-mixed to every channel of the buffer, and any channels that the destination
+        //       does not render stay silent.
+        auto frame_count = min(RENDER_QUANTUM_SIZE, m_length - m_rendered_frame_count);
+        for (size_t channel = 0; channel < channels.size(); ++channel) {
+            if (block.channel_count != 1 && channel >= block.channel_count)
+                continue;
+            auto source = block.channel(block.channel_count == 1 ? 0 : channel).trim(frame_count);
+            source.copy_to(channels[channel].slice(m_rendered_frame_count, frame_count));
+        }
+        m_rendered_frame_count += frame_count;
+    }
+
+    if (m_rendered_frame_count < m_length) {
+        queue_a_media_element_task(GC::create_function(heap(), [this, promise] {
+            render_next_slice(promise);
+        }));
+        return;
+    }
+
+    // 4. Once the rendering is complete, queue a media element task to execute the following steps:
+    queue_a_media_element_task(GC::create_function(heap(), [this, promise] {
+        auto& realm = this->realm();
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+        // 1. Resolve the promise created by startRendering() with [[rendered buffer]].
+        WebIDL::resolve_promise(realm, promise, m_rendered_buffer);
+        m_pending_promises.remove_first_matching([&promise](auto& pending_promise) {
+            return pending_promise == promise;
+        });
+
+        // 2. Queue a media element task to fire an event named complete using an instance of
+        //    OfflineAudioCompletionEvent whose renderedBuffer property is set to [[rendered buffer]].
+        // FIXME: Fire an OfflineAudioCompletionEvent once that interface is implemented.
+        queue_a_media_element_task(GC::create_function(heap(), [this] {
+            dispatch_event(DOM::Event::create(this->realm(), HTML::EventNames::complete));
+        }));
+    }));
 }
 
 WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> OfflineAudioContext::resume()
@@ -91,8 +208,9 @@ void OfflineAudioContext::set_oncomplete(GC::Ptr<WebIDL::CallbackType> value)
     set_event_handler_attribute(HTML::EventNames::complete, value);
 }
 
-OfflineAudioContext::OfflineAudioContext(JS::Realm& realm, WebIDL::UnsignedLong length, float sample_rate)
+OfflineAudioContext::OfflineAudioContext(JS::Realm& realm, WebIDL::UnsignedLong number_of_channels, WebIDL::UnsignedLong length, float sample_rate)
     : BaseAudioContext(realm, sample_rate)
+    , m_number_of_channels(number_of_channels)
     , m_length(length)
 {
 }
@@ -106,6 +224,7 @@ void OfflineAudioContext::initialize(JS::Realm& realm)
 void OfflineAudioContext::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
+    visitor.visit(m_rendered_buffer);
 }
 
 }
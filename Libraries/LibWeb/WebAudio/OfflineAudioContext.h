@@ -42,12 +42,23 @@ public:
     void set_oncomplete(GC::Ptr<WebIDL::CallbackType>);
 
 private:
-    OfflineAudioContext(JS::Realm&, WebIDL::UnsignedLong length, float sample_rate);
+    OfflineAudioContext(JS::Realm&, WebIDL::UnsignedLong number_of_channels, WebIDL::UnsignedLong length, float sample_rate);
 
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
+    void begin_offline_rendering(GC::Ref<WebIDL::Promise>);
+    void render_next_slice(GC::Ref<WebIDL::Promise>);
+
+    WebIDL::UnsignedLong m_number_of_channels {};
     WebIDL::UnsignedLong m_length {};
+
+    // https://webaudio.github.io/web-audio-api/#dom-offlineaudiocontext-rendering-started-slot
+    bool m_rendering_started { false };
+
+    // https://webaudio.github.io/web-audio-api/#dom-offlineaudiocontext-rendered-buffer-slot
+    GC::Ptr<AudioBuffer> m_rendered_buffer;
+    size_t m_rendered_frame_count { 0 };
 };
 
 }
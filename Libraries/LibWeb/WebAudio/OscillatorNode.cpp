@@ -9,8 +9,10 @@
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/OscillatorNodePrototype.h>
 #include <LibWeb/WebAudio/AudioParam.h>
+#include <LibWeb/WebAudio/AudioRenderGraph.h>
 #include <LibWeb/WebAudio/BaseAudioContext.h>
 #include <LibWeb/WebAudio/OscillatorNode.h>
+#include <LibWeb/WebAudio/PeriodicWave.h>
 
 namespace Web::WebAudio {
 
@@ -71,6 +73,7 @@ WebIDL::ExceptionOr<void> OscillatorNode::set_type(Bindings::OscillatorType type
     set_periodic_wave(nullptr);
 
     m_type = type;
+    update_render_type();
     return {};
 }
 
@@ -79,6 +82,24 @@ void OscillatorNode::set_periodic_wave(GC::Ptr<PeriodicWave> periodic_wave)
 {
     m_periodic_wave = periodic_wave;
     m_type = Bindings::OscillatorType::Custom;
+    update_render_type();
+}
+
+void OscillatorNode::update_render_type()
+{
+    Vector<float> waveform;
+    if (m_type == Bindings::OscillatorType::Custom && m_periodic_wave)
+        waveform = m_periodic_wave->generate_waveform(RenderOscillatorNode::CUSTOM_WAVEFORM_SIZE);
+
+    render_graph().queue_control_message([&node = static_cast<RenderOscillatorNode&>(render_node()), type = m_type, waveform = move(waveform)]() mutable {
+        node.type = type;
+        swap(node.custom_waveform, waveform);
+    });
+}
+
+RenderNode& OscillatorNode::create_render_node(AudioRenderGraph& graph)
+{
+    return graph.create_node<RenderOscillatorNode>(m_frequency->render_param(), m_detune->render_param(), m_type);
 }
 
 void OscillatorNode::initialize(JS::Realm& realm)
@@ -47,7 +47,11 @@ protected:
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
 
+    virtual RenderNode& create_render_node(AudioRenderGraph&) override;
+
 private:
+    void update_render_type();
+
     // https://webaudio.github.io/web-audio-api/#dom-oscillatornode-type
     Bindings::OscillatorType m_type { Bindings::OscillatorType::Sine };
 
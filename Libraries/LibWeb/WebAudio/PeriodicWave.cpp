@@ -5,9 +5,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Math.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/PeriodicWavePrototype.h>
+#include <LibWeb/WebAudio/DSP.h>
 #include <LibWeb/WebAudio/PeriodicWave.h>
 #include <LibWeb/WebIDL/ExceptionOr.h>
 
@@ -105,6 +107,40 @@ PeriodicWave::PeriodicWave(JS::Realm& realm)
 
 PeriodicWave::~PeriodicWave() = default;
 
+// https://webaudio.github.io/web-audio-api/#waveform-generation
+Vector<float> PeriodicWave::generate_waveform(size_t size) const
+{
+    VERIFY(is_power_of_two(size));
+
+    // x(t) = sum(a[k] * cos(2πkt) + b[k] * sin(2πkt)), for 1 <= k < L, where a is [[real]] and b is [[imag]].
+    // NOTE: This is the real part of the inverse Fourier transform of X[k] = a[k] - i * b[k]. Any coefficients past the
+    //       Nyquist frequency of the waveform can not be represented by it, and are dropped.
+    auto real = m_real->data();
+    auto imaginary = m_imag->data();
+    auto coefficient_count = min(real.size(), size / 2);
+
+    Vector<float> waveform;
+    Vector<float> waveform_imaginary;
+    waveform.resize(size);
+    waveform_imaginary.resize(size);
+    for (size_t k = 1; k < coefficient_count; ++k) {
+        waveform[k] = real[k];
+        waveform_imaginary[k] = -imaginary[k];
+    }
+    DSP::inverse_fft(waveform.span(), waveform_imaginary.span());
+
+    // If normalization is enabled, x~(t) = x(t) / max(|x(t)|).
+    if (m_normalize) {
+        float peak = 0;
+        for (auto sample : waveform)
+            peak = max(peak, AK::fabs(sample));
+        if (peak > 0)
+            DSP::multiply(waveform.span(), waveform.span(), 1 / peak);
+    }
+
+    return waveform;
+}
+
 void PeriodicWave::initialize(JS::Realm& realm)
 {
     WEB_SET_PROTOTYPE_FOR_INTERFACE(PeriodicWave);
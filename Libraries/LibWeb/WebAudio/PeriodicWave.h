@@ -34,6 +34,8 @@ public:
     explicit PeriodicWave(JS::Realm&);
     virtual ~PeriodicWave() override;
 
+    Vector<float> generate_waveform(size_t size) const;
+
 protected:
     virtual void initialize(JS::Realm&) override;
     virtual void visit_edges(Cell::Visitor&) override;
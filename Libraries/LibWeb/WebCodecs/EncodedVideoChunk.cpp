@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/WebCodecs/EncodedVideoChunk.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::WebCodecs {
+
+GC_DEFINE_ALLOCATOR(EncodedVideoChunk);
+
+// https://w3c.github.io/webcodecs/#dom-encodedvideochunk-encodedvideochunk
+WebIDL::ExceptionOr<GC::Ref<EncodedVideoChunk>> EncodedVideoChunk::construct_impl(JS::Realm& realm, EncodedVideoChunkInit const& init)
+{
+    // FIXME: 1. If init.transfer contains more than one reference to the same ArrayBuffer, then throw a DataCloneError
+    //           DOMException.
+    // FIXME: 2. For each transferable in init.transfer: If [[Detached]] internal slot is true, then throw a
+    //           DataCloneError DOMException.
+
+    // 3. Let chunk be a new EncodedVideoChunk object, initialized as follows
+    //    1. Assign init.type to [[type]].
+    //    2. Assign init.timestamp to [[timestamp]].
+    //    3. If init.duration exists, assign it to [[duration]], or assign null otherwise.
+    //    4. Assign init.data.byteLength to [[byte length]];
+    //    5. FIXME: If init.transfer contains an ArrayBuffer referenced by init.data the User Agent MAY choose to:
+    //              Let resource be a new media resource referencing sample data in init.data.
+    //    6. Otherwise: Assign a copy of init.data to [[internal data]].
+    auto internal_data = WebIDL::get_buffer_source_copy(*init.data->raw_object());
+    if (internal_data.is_error())
+        return WebIDL::QuotaExceededError::create(realm, "Unable to allocate memory for the chunk data"_string);
+
+    // FIXME: 4. For each transferable in init.transfer: Perform DetachArrayBuffer on transferable.
+
+    // 5. Return chunk.
+    return realm.create<EncodedVideoChunk>(realm, init.type, init.timestamp, init.duration, internal_data.release_value());
+}
+
+EncodedVideoChunk::EncodedVideoChunk(JS::Realm& realm, Bindings::EncodedVideoChunkType type, WebIDL::LongLong timestamp, Optional<WebIDL::UnsignedLongLong> duration, ByteBuffer internal_data)
+    : PlatformObject(realm)
+    , m_type(type)
+    , m_timestamp(timestamp)
+    , m_duration(duration)
+    , m_internal_data(move(internal_data))
+{
+}
+
+EncodedVideoChunk::~EncodedVideoChunk() = default;
+
+void EncodedVideoChunk::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(EncodedVideoChunk);
+    Base::initialize(realm);
+}
+
+// https://w3c.github.io/webcodecs/#dom-encodedvideochunk-copyto
+WebIDL::ExceptionOr<void> EncodedVideoChunk::copy_to(GC::Root<WebIDL::BufferSource> const& destination)
+{
+    // 1. If the [[byte length]] of this EncodedVideoChunk is greater than in destination, throw a TypeError.
+    if (m_internal_data.size() > destination->byte_length())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The destination buffer is too small to hold the chunk data"sv };
+
+    // 2. Copy the [[internal data]] into destination.
+    destination->viewed_array_buffer()->buffer().overwrite(destination->byte_offset(), m_internal_data.data(), m_internal_data.size());
+    return {};
+}
+
+}
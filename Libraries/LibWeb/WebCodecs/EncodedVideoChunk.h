@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <LibWeb/Bindings/EncodedVideoChunkPrototype.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/WebIDL/Buffers.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::WebCodecs {
+
+// https://w3c.github.io/webcodecs/#dictdef-encodedvideochunkinit
+struct EncodedVideoChunkInit {
+    Bindings::EncodedVideoChunkType type;
+    WebIDL::LongLong timestamp;
+    Optional<WebIDL::UnsignedLongLong> duration;
+    GC::Root<WebIDL::BufferSource> data;
+};
+
+// https://w3c.github.io/webcodecs/#encodedvideochunk-interface
+class EncodedVideoChunk final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(EncodedVideoChunk, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(EncodedVideoChunk);
+
+public:
+    static WebIDL::ExceptionOr<GC::Ref<EncodedVideoChunk>> construct_impl(JS::Realm&, EncodedVideoChunkInit const&);
+
+    virtual ~EncodedVideoChunk() override;
+
+    Bindings::EncodedVideoChunkType type() const { return m_type; }
+    WebIDL::LongLong timestamp() const { return m_timestamp; }
+    Optional<WebIDL::UnsignedLongLong> duration() const { return m_duration; }
+    WebIDL::UnsignedLong byte_length() const { return m_internal_data.size(); }
+
+    WebIDL::ExceptionOr<void> copy_to(GC::Root<WebIDL::BufferSource> const& destination);
+
+    ReadonlyBytes internal_data() const { return m_internal_data; }
+
+private:
+    EncodedVideoChunk(JS::Realm&, Bindings::EncodedVideoChunkType, WebIDL::LongLong timestamp, Optional<WebIDL::UnsignedLongLong> duration, ByteBuffer internal_data);
+
+    virtual void initialize(JS::Realm&) override;
+
+    // https://w3c.github.io/webcodecs/#dom-encodedvideochunk-type-slot
+    Bindings::EncodedVideoChunkType m_type;
+
+    // https://w3c.github.io/webcodecs/#dom-encodedvideochunk-timestamp-slot
+    WebIDL::LongLong m_timestamp { 0 };
+
+    // https://w3c.github.io/webcodecs/#dom-encodedvideochunk-duration-slot
+    Optional<WebIDL::UnsignedLongLong> m_duration;
+
+    // https://w3c.github.io/webcodecs/#dom-encodedvideochunk-internal-data-slot
+    // NOTE: The byte length slot is always the size of the internal data.
+    ByteBuffer m_internal_data;
+};
+
+}
@@ -0,0 +1,520 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibMedia/FFmpeg/FFmpegVideoDecoder.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/DOM/Event.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/EventNames.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/WebCodecs/EncodedVideoChunk.h>
+#include <LibWeb/WebCodecs/VideoDecoder.h>
+#include <LibWeb/WebCodecs/VideoFrame.h>
+#include <LibWeb/WebIDL/AbstractOperations.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::WebCodecs {
+
+GC_DEFINE_ALLOCATOR(VideoDecoder);
+
+// https://w3c.github.io/webcodecs-codec-registry/
+Optional<Media::CodecID> codec_id_from_codec_string(StringView codec)
+{
+    // https://www.w3.org/TR/webcodecs-vp8-codec-registration/#fully-qualified-codec-strings
+    if (codec == "vp8"sv)
+        return Media::CodecID::VP8;
+    // https://www.w3.org/TR/webcodecs-vp9-codec-registration/#fully-qualified-codec-strings
+    if (codec.starts_with("vp09."sv))
+        return Media::CodecID::VP9;
+    // https://www.w3.org/TR/webcodecs-avc-codec-registration/#fully-qualified-codec-strings
+    if (codec.starts_with("avc1."sv) || codec.starts_with("avc3."sv))
+        return Media::CodecID::H264;
+    // https://www.w3.org/TR/webcodecs-hevc-codec-registration/#fully-qualified-codec-strings
+    if (codec.starts_with("hev1."sv) || codec.starts_with("hvc1."sv))
+        return Media::CodecID::H265;
+    // https://www.w3.org/TR/webcodecs-av1-codec-registration/#fully-qualified-codec-strings
+    if (codec.starts_with("av01."sv))
+        return Media::CodecID::AV1;
+    return {};
+}
+
+// https://w3c.github.io/webcodecs/#valid-videodecoderconfig
+bool VideoDecoderConfig::is_valid_video_decoder_config() const
+{
+    // 1. If codec is empty after stripping leading and trailing ASCII whitespace, return false.
+    if (codec.bytes_as_string_view().trim_whitespace().is_empty())
+        return false;
+
+    // 2. If one of codedWidth or codedHeight is provided and the other isn’t, return false.
+    if (coded_width.has_value() != coded_height.has_value())
+        return false;
+
+    // 3. If codedWidth = 0 or codedHeight = 0, return false.
+    if (coded_width == 0u || coded_height == 0u)
+        return false;
+
+    // 4. If one of displayAspectWidth or displayAspectHeight is provided and the other isn’t, return false.
+    if (display_aspect_width.has_value() != display_aspect_height.has_value())
+        return false;
+
+    // 5. If displayAspectWidth = 0 or displayAspectHeight = 0, return false.
+    if (display_aspect_width == 0u || display_aspect_height == 0u)
+        return false;
+
+    // 6. If description is [detached], return false.
+    if (description.has_value()) {
+        auto buffer = description.value()->viewed_array_buffer();
+        if (buffer && buffer->is_detached())
+            return false;
+    }
+
+    // 7. Return true.
+    return true;
+}
+
+// https://w3c.github.io/webcodecs/#check-configuration-support
+static bool check_configuration_support(VideoDecoderConfig const& config)
+{
+    // 1. If the codec string in config.codec is not a valid codec string or is otherwise unrecognized by the User
+    //    Agent, return false.
+    auto codec_id = codec_id_from_codec_string(config.codec);
+    if (!codec_id.has_value())
+        return false;
+
+    // 2. If config is a VideoDecoderConfig or VideoEncoderConfig and the User Agent can’t provide a codec that can
+    //    decode or encode the exact profile (where present), level (where present), and constraint bits (where
+    //    present) indicated by the codec string in config.codec, return false.
+    // NOTE: Creating a decoder is cheap, and tells us whether our media backend has a decoder for the codec at all.
+    return !Media::FFmpeg::FFmpegVideoDecoder::try_create(codec_id.value(), {}).is_error();
+
+    // FIXME: 3-4. Check the colorSpace and hardwareAcceleration members of config.
+}
+
+WebIDL::ExceptionOr<GC::Ref<VideoDecoder>> VideoDecoder::construct_impl(JS::Realm& realm, VideoDecoderInit const& init)
+{
+    auto codec_implementation = VideoDecoderThread::create();
+    if (codec_implementation.is_error())
+        return WebIDL::NotSupportedError::create(realm, "Unable to start a video decoder"_string);
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-videodecoder
+    // 1. Let d be a new VideoDecoder object.
+    // 2. Assign a new queue to [[control message queue]].
+    // 3. Assign false to [[message queue blocked]].
+    // 4. Assign null to [[codec implementation]].
+    // 5. Assign the result of starting a new parallel queue to [[codec work queue]].
+    // 6. Assign false to [[codec saturated]].
+    // 7. Assign init.output to [[output callback]].
+    // 8. Assign init.error to [[error callback]].
+    // 9. Assign true to [[key chunk required]].
+    // 10. Assign "unconfigured" to [[state]]
+    // 11. Assign 0 to [[decodeQueueSize]].
+    // 12. Assign a new list to [[pending flush promises]].
+    // 13. Assign false to [[dequeue event scheduled]].
+    // 14. Return d.
+    // NOTE: The codec work queue and the codec implementation are both represented by a VideoDecoderThread. Since
+    //       its work queue is unbounded, the codec is never saturated, the control message queue is never blocked,
+    //       and control messages run as soon as they are queued.
+    return realm.create<VideoDecoder>(realm, codec_implementation.release_value(), init);
+}
+
+VideoDecoder::VideoDecoder(JS::Realm& realm, NonnullRefPtr<VideoDecoderThread> codec_implementation, VideoDecoderInit const& init)
+    : DOM::EventTarget(realm)
+    , m_codec_implementation(move(codec_implementation))
+    , m_output_callback(init.output)
+    , m_error_callback(init.error)
+{
+    m_codec_implementation->on_results = [this](auto results) {
+        handle_results(move(results));
+    };
+}
+
+VideoDecoder::~VideoDecoder() = default;
+
+void VideoDecoder::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(VideoDecoder);
+    Base::initialize(realm);
+}
+
+void VideoDecoder::visit_edges(Cell::Visitor& visitor)
+{
+    Base::visit_edges(visitor);
+    visitor.visit(m_output_callback);
+    visitor.visit(m_error_callback);
+    for (auto const& pending_flush : m_pending_flush_promises)
+        visitor.visit(pending_flush.promise);
+}
+
+void VideoDecoder::finalize()
+{
+    Base::finalize();
+    m_codec_implementation->stop();
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-ondequeue
+void VideoDecoder::set_ondequeue(GC::Ptr<WebIDL::CallbackType> event_handler)
+{
+    set_event_handler_attribute(HTML::EventNames::dequeue, event_handler);
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-ondequeue
+GC::Ptr<WebIDL::CallbackType> VideoDecoder::ondequeue()
+{
+    return event_handler_attribute(HTML::EventNames::dequeue);
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-configure
+WebIDL::ExceptionOr<void> VideoDecoder::configure(VideoDecoderConfig const& config)
+{
+    // 1. If config is not a valid VideoDecoderConfig, throw a TypeError.
+    if (!config.is_valid_video_decoder_config())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The given configuration is not a valid VideoDecoderConfig"sv };
+
+    // 2. If [[state]] is “closed”, throw an InvalidStateError DOMException.
+    if (m_state == Bindings::CodecState::Closed)
+        return WebIDL::InvalidStateError::create(realm(), "VideoDecoder is closed"_string);
+
+    // 3. Set [[state]] to "configured".
+    m_state = Bindings::CodecState::Configured;
+
+    // 4. Set [[key chunk required]] to true.
+    m_key_chunk_required = true;
+
+    // 5. Queue a control message to configure the decoder with config.
+    // 6. Process the control message queue.
+    // Running a control message to configure the decoder means running these steps:
+    // 1. Assign true to [[message queue blocked]].
+    // 2. Enqueue the following steps to [[codec work queue]]:
+    //    1. Let supported be the result of running the Check Configuration Support algorithm with config.
+    //    2. If supported is false, queue a task to run the Close VideoDecoder algorithm with NotSupportedError
+    //       DOMException and abort these steps.
+    auto codec_id = codec_id_from_codec_string(config.codec);
+    if (!codec_id.has_value()) {
+        HTML::queue_global_task(HTML::Task::Source::Unspecified, HTML::relevant_global_object(*this), GC::create_function(heap(), [this] {
+            close_video_decoder(WebIDL::NotSupportedError::create(realm(), "The codec is not supported"_string));
+        }));
+        return {};
+    }
+
+    //    3. If needed, assign [[codec implementation]] with an implementation supporting config.
+    //    4. Configure [[codec implementation]] with config.
+    //    5. queue a task to run the following steps:
+    //       1. Assign false to [[message queue blocked]].
+    //       2. Queue a task to Process the control message queue.
+    // 3. Return "processed".
+    ByteBuffer codec_initialization_data;
+    if (config.description.has_value()) {
+        auto description = WebIDL::get_buffer_source_copy(*config.description.value()->raw_object());
+        if (description.is_error())
+            return WebIDL::QuotaExceededError::create(realm(), "Unable to allocate memory for the codec description"_string);
+        codec_initialization_data = description.release_value();
+    }
+    m_codec_implementation->configure(codec_id.value(), move(codec_initialization_data));
+    return {};
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-decode
+WebIDL::ExceptionOr<void> VideoDecoder::decode(EncodedVideoChunk& chunk)
+{
+    // 1. If [[state]] is not "configured", throw an InvalidStateError DOMException.
+    if (m_state != Bindings::CodecState::Configured)
+        return WebIDL::InvalidStateError::create(realm(), "VideoDecoder is not configured"_string);
+
+    // 2. If [[key chunk required]] is true:
+    if (m_key_chunk_required) {
+        // 1. If chunk.type is not key, throw a DataError.
+        if (chunk.type() != Bindings::EncodedVideoChunkType::Key)
+            return WebIDL::DataError::create(realm(), "A key chunk is required"_string);
+
+        // 2. Implementers SHOULD inspect the chunk’s [[internal data]] to verify that it is truly a key chunk. If a
+        //    mismatch is detected, throw a DataError.
+        // 3. Otherwise, assign false to [[key chunk required]].
+        m_key_chunk_required = false;
+    }
+
+    // 3. Increment [[decodeQueueSize]].
+    ++m_decode_queue_size;
+
+    // 4. Queue a control message to decode the chunk.
+    // 5. Process the control message queue.
+    // Running a control message to decode the chunk means performing these steps:
+    // 1. If [[codec saturated]] equals true, return "not processed".
+    // 2. If decoding chunk will cause the [[codec implementation]] to become saturated, assign true to
+    //    [[codec saturated]].
+    // 3. Decrement [[decodeQueueSize]] and run the Schedule Dequeue Event algorithm.
+    --m_decode_queue_size;
+    schedule_dequeue_event();
+
+    // 4. Enqueue the following steps to the [[codec work queue]]:
+    //    1. Attempt to use [[codec implementation]] to decode the chunk.
+    //    2. If decoding results in an error, queue a task to run the Close VideoDecoder algorithm with EncodingError
+    //       DOMException.
+    //    3. If [[codec saturated]] equals true and [[codec implementation]] is no longer saturated, queue a task to
+    //       perform the following steps:
+    //       1. Assign false to [[codec saturated]].
+    //       2. Process the control message queue.
+    //    4. Let decoded outputs be a list of decoded video data outputs emitted by [[codec implementation]] in
+    //       presentation order.
+    //    5. If decoded outputs is not empty, queue a task to run the Output VideoFrame algorithm with decoded outputs.
+    // 5. Return "processed".
+    auto data = ByteBuffer::copy(chunk.internal_data());
+    if (data.is_error())
+        return WebIDL::QuotaExceededError::create(realm(), "Unable to allocate memory for the chunk data"_string);
+    m_chunk_durations.set(chunk.timestamp(), chunk.duration());
+    m_codec_implementation->decode(chunk.timestamp(), data.release_value());
+    return {};
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-flush
+GC::Ref<WebIDL::Promise> VideoDecoder::flush()
+{
+    auto& realm = this->realm();
+
+    // 1. If [[state]] is not "configured", return a promise rejected with InvalidStateError DOMException.
+    if (m_state != Bindings::CodecState::Configured)
+        return WebIDL::create_rejected_promise_from_exception(realm, WebIDL::InvalidStateError::create(realm, "VideoDecoder is not configured"_string));
+
+    // 2. Set [[key chunk required]] to true.
+    m_key_chunk_required = true;
+
+    // 3. Let promise be a new Promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 4. Append promise to [[pending flush promises]].
+    auto flush_id = m_next_flush_id++;
+    m_pending_flush_promises.append({ flush_id, promise });
+
+    // 5. Queue a control message to flush the codec with promise.
+    // 6. Process the control message queue.
+    // Running a control message to flush the codec means performing these steps with promise:
+    // 1. Signal [[codec implementation]] to emit all internal pending outputs.
+    // 2. Let decoded outputs be a list of decoded video data outputs emitted by [[codec implementation]].
+    // 3. Queue a task to perform these steps:
+    //    1. If decoded outputs is not empty, run the Output VideoFrame algorithm with decoded outputs.
+    //    2. Remove promise from [[pending flush promises]].
+    //    3. Resolve promise.
+    // 4. Return "processed".
+    m_codec_implementation->flush(flush_id);
+
+    // 7. Return promise.
+    return promise;
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-reset
+WebIDL::ExceptionOr<void> VideoDecoder::reset()
+{
+    // 1. Run the Reset VideoDecoder algorithm with an AbortError DOMException.
+    return reset_video_decoder(WebIDL::AbortError::create(realm(), "VideoDecoder was reset"_string));
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-close
+WebIDL::ExceptionOr<void> VideoDecoder::close()
+{
+    // NOTE: The Reset VideoDecoder algorithm that closing runs throws if the decoder is already closed.
+    if (m_state == Bindings::CodecState::Closed)
+        return WebIDL::InvalidStateError::create(realm(), "VideoDecoder is closed"_string);
+
+    // 1. Run the Close VideoDecoder algorithm with an AbortError DOMException.
+    close_video_decoder(WebIDL::AbortError::create(realm(), "VideoDecoder was closed"_string));
+    return {};
+}
+
+// https://w3c.github.io/webcodecs/#dom-videodecoder-isconfigsupported
+GC::Ref<WebIDL::Promise> VideoDecoder::is_config_supported(JS::VM& vm, VideoDecoderConfig const& config)
+{
+    auto& realm = *vm.current_realm();
+
+    // 1. If config is not a valid VideoDecoderConfig, return a promise rejected with TypeError.
+    if (!config.is_valid_video_decoder_config())
+        return WebIDL::create_rejected_promise_from_exception(realm, vm.throw_completion<JS::TypeError>("The given configuration is not a valid VideoDecoderConfig"sv));
+
+    // 2. Let p be a new Promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 3. Let checkSupportQueue be the result of starting a new parallel queue.
+    // 4. Enqueue the following steps to checkSupportQueue:
+    //    1. Let supported be the result of running the Check Configuration Support algorithm with config.
+    auto supported = check_configuration_support(config);
+
+    //    2. Queue a task to run the following steps:
+    //       1. Let decoderSupport be a newly constructed VideoDecoderSupport, initialized as follows:
+    //          1. Set config to the result of running the Clone Configuration algorithm with config.
+    //          2. Set supported to supported.
+    //       2. Resolve p with decoderSupport.
+    auto cloned_config = JS::Object::create(realm, realm.intrinsics().object_prototype());
+    MUST(cloned_config->create_data_property("codec"_fly_string, JS::PrimitiveString::create(vm, config.codec)));
+    if (config.description.has_value()) {
+        if (auto description = WebIDL::get_buffer_source_copy(*config.description.value()->raw_object()); !description.is_error())
+            MUST(cloned_config->create_data_property("description"_fly_string, JS::ArrayBuffer::create(realm, description.release_value())));
+    }
+    if (config.coded_width.has_value())
+        MUST(cloned_config->create_data_property("codedWidth"_fly_string, JS::Value(config.coded_width.value())));
+    if (config.coded_height.has_value())
+        MUST(cloned_config->create_data_property("codedHeight"_fly_string, JS::Value(config.coded_height.value())));
+    if (config.display_aspect_width.has_value())
+        MUST(cloned_config->create_data_property("displayAspectWidth"_fly_string, JS::Value(config.display_aspect_width.value())));
+    if (config.display_aspect_height.has_value())
+        MUST(cloned_config->create_data_property("displayAspectHeight"_fly_string, JS::Value(config.display_aspect_height.value())));
+    MUST(cloned_config->create_data_property("hardwareAcceleration"_fly_string, JS::PrimitiveString::create(vm, Bindings::idl_enum_to_string(config.hardware_acceleration))));
+    if (config.optimize_for_latency.has_value())
+        MUST(cloned_config->create_data_property("optimizeForLatency"_fly_string, JS::Value(config.optimize_for_latency.value())));
+    MUST(cloned_config->create_data_property("rotation"_fly_string, JS::Value(config.rotation)));
+    MUST(cloned_config->create_data_property("flip"_fly_string, JS::Value(config.flip)));
+
+    HTML::queue_global_task(HTML::Task::Source::Unspecified, realm.global_object(), GC::create_function(realm.heap(), [&realm, promise, supported, cloned_config] {
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+        auto decoder_support = JS::Object::create(realm, realm.intrinsics().object_prototype());
+        MUST(decoder_support->create_data_property("supported"_fly_string, JS::Value(supported)));
+        MUST(decoder_support->create_data_property("config"_fly_string, cloned_config));
+        WebIDL::resolve_promise(realm, promise, decoder_support);
+    }));
+
+    // 5. Return p.
+    return promise;
+}
+
+void VideoDecoder::handle_results(Vector<VideoDecoderThread::Result> results)
+{
+    // NOTE: Results are delivered in the order the codec work queue produced them, and each of them queues the task
+    //       that its step of the specification asks for.
+    for (auto& result : results) {
+        result.visit(
+            [&](VideoDecoderThread::FrameDecoded& frame_decoded) {
+                HTML::queue_global_task(HTML::Task::Source::Unspecified, HTML::relevant_global_object(*this), GC::create_function(heap(), [this, bitmap = move(frame_decoded.bitmap), timestamp = frame_decoded.timestamp]() mutable {
+                    // https://w3c.github.io/webcodecs/#output-videoframes
+                    // 1. For each output in outputs:
+                    //    1. Let timestamp and duration be the timestamp and duration from the EncodedVideoChunk
+                    //       associated with output.
+                    auto duration = m_chunk_durations.take(timestamp).value_or({});
+
+                    //    2-4. FIXME: Let displayAspectWidth, displayAspectHeight, rotation, flip and colorSpace be
+                    //                taken from [[active decoder config]].
+                    //    5. Let frame be the result of running the Create a VideoFrame algorithm with output, timestamp,
+                    //       duration, displayAspectWidth, displayAspectHeight, colorSpace, rotation, and flip.
+                    auto& realm = this->realm();
+                    auto frame = VideoFrame::create(realm, move(bitmap), timestamp, duration);
+
+                    //    6. Invoke [[output callback]] with frame.
+                    HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+                    (void)WebIDL::invoke_callback(*m_output_callback, {}, WebIDL::ExceptionBehavior::Report, { { frame } });
+                }));
+            },
+            [&](VideoDecoderThread::FlushCompleted const& flush_completed) {
+                HTML::queue_global_task(HTML::Task::Source::Unspecified, HTML::relevant_global_object(*this), GC::create_function(heap(), [this, flush_id = flush_completed.flush_id] {
+                    // 2. Remove promise from [[pending flush promises]].
+                    auto index = m_pending_flush_promises.find_first_index_if([&](auto const& pending_flush) { return pending_flush.id == flush_id; });
+                    if (!index.has_value())
+                        return;
+                    auto promise = m_pending_flush_promises.take(index.value()).promise;
+
+                    // NOTE: Frames still waiting for their chunk's duration have all been output by now.
+                    if (m_pending_flush_promises.is_empty())
+                        m_chunk_durations.clear();
+
+                    // 3. Resolve promise.
+                    auto& realm = this->realm();
+                    HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+                    WebIDL::resolve_promise(realm, promise);
+                }));
+            },
+            [&](VideoDecoderThread::ConfigurationFailed const&) {
+                HTML::queue_global_task(HTML::Task::Source::Unspecified, HTML::relevant_global_object(*this), GC::create_function(heap(), [this] {
+                    if (m_state == Bindings::CodecState::Closed)
+                        return;
+                    close_video_decoder(WebIDL::NotSupportedError::create(realm(), "The configuration is not supported"_string));
+                }));
+            },
+            [&](VideoDecoderThread::DecodingFailed const& decoding_failed) {
+                HTML::queue_global_task(HTML::Task::Source::Unspecified, HTML::relevant_global_object(*this), GC::create_function(heap(), [this, message = decoding_failed.message] {
+                    if (m_state == Bindings::CodecState::Closed)
+                        return;
+                    close_video_decoder(WebIDL::EncodingError::create(realm(), message));
+                }));
+            });
+    }
+}
+
+// https://w3c.github.io/webcodecs/#reset-videodecoder
+WebIDL::ExceptionOr<void> VideoDecoder::reset_video_decoder(GC::Ref<WebIDL::DOMException> exception)
+{
+    auto& realm = this->realm();
+
+    // 1. If [[state]] is "closed", throw an InvalidStateError.
+    if (m_state == Bindings::CodecState::Closed)
+        return WebIDL::InvalidStateError::create(realm, "VideoDecoder is closed"_string);
+
+    // 2. Set [[state]] to "unconfigured".
+    m_state = Bindings::CodecState::Unconfigured;
+
+    // 3. Signal [[codec implementation]] to cease producing output for the previous configuration.
+    // 4. Remove all control messages from the [[control message queue]].
+    m_codec_implementation->reset();
+    m_chunk_durations.clear();
+
+    // 5. If [[decodeQueueSize]] is greater than zero:
+    if (m_decode_queue_size > 0) {
+        // 1. Set [[decodeQueueSize]] to zero.
+        m_decode_queue_size = 0;
+
+        // 2. Run the Schedule Dequeue Event algorithm.
+        schedule_dequeue_event();
+    }
+
+    // 6. For each promise in [[pending flush promises]]:
+    //    1. Reject promise with exception.
+    //    2. Remove promise from [[pending flush promises]].
+    auto pending_flush_promises = move(m_pending_flush_promises);
+    for (auto const& pending_flush : pending_flush_promises) {
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+        WebIDL::reject_promise(realm, pending_flush.promise, exception);
+    }
+
+    return {};
+}
+
+// https://w3c.github.io/webcodecs/#close-videodecoder
+void VideoDecoder::close_video_decoder(GC::Ref<WebIDL::DOMException> exception)
+{
+    // 1. Run the Reset VideoDecoder algorithm with exception.
+    MUST(reset_video_decoder(exception));
+
+    // 2. Set [[state]] to "closed".
+    m_state = Bindings::CodecState::Closed;
+
+    // 3. Clear [[codec implementation]] and release associated system resources.
+    m_codec_implementation->stop();
+
+    // 4. If exception is not an AbortError DOMException, invoke the [[error callback]] with exception.
+    if (exception->name() != "AbortError"sv) {
+        HTML::TemporaryExecutionContext context(realm(), HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+        (void)WebIDL::invoke_callback(*m_error_callback, {}, WebIDL::ExceptionBehavior::Report, { { exception } });
+    }
+}
+
+// https://w3c.github.io/webcodecs/#videodecoder-schedule-dequeue-event
+void VideoDecoder::schedule_dequeue_event()
+{
+    // 1. If [[dequeue event scheduled]] equals true, return.
+    if (m_dequeue_event_scheduled)
+        return;
+
+    // 2. Assign true to [[dequeue event scheduled]].
+    m_dequeue_event_scheduled = true;
+
+    // 3. Queue a task to run the following steps:
+    HTML::queue_global_task(HTML::Task::Source::Unspecified, HTML::relevant_global_object(*this), GC::create_function(heap(), [this] {
+        // 1. Fire a simple event named dequeue at this.
+        dispatch_event(DOM::Event::create(realm(), HTML::EventNames::dequeue));
+
+        // 2. Assign false to [[dequeue event scheduled]].
+        m_dequeue_event_scheduled = false;
+    }));
+}
+
+}
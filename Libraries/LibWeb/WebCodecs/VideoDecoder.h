@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <LibMedia/CodecID.h>
+#include <LibWeb/Bindings/VideoDecoderPrototype.h>
+#include <LibWeb/DOM/EventTarget.h>
+#include <LibWeb/WebCodecs/VideoDecoderThread.h>
+#include <LibWeb/WebIDL/Buffers.h>
+#include <LibWeb/WebIDL/CallbackType.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Promise.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::WebCodecs {
+
+// https://w3c.github.io/webcodecs/#dictdef-videodecoderinit
+struct VideoDecoderInit {
+    GC::Ptr<WebIDL::CallbackType> output;
+    GC::Ptr<WebIDL::CallbackType> error;
+};
+
+// https://w3c.github.io/webcodecs/#dictdef-videodecoderconfig
+struct VideoDecoderConfig {
+    String codec;
+    Optional<GC::Root<WebIDL::BufferSource>> description;
+    Optional<WebIDL::UnsignedLong> coded_width;
+    Optional<WebIDL::UnsignedLong> coded_height;
+    Optional<WebIDL::UnsignedLong> display_aspect_width;
+    Optional<WebIDL::UnsignedLong> display_aspect_height;
+    Bindings::HardwareAcceleration hardware_acceleration { Bindings::HardwareAcceleration::NoPreference };
+    Optional<bool> optimize_for_latency;
+    double rotation { 0 };
+    bool flip { false };
+
+    // https://w3c.github.io/webcodecs/#valid-videodecoderconfig
+    bool is_valid_video_decoder_config() const;
+};
+
+// https://w3c.github.io/webcodecs/#videodecoder-interface
+class VideoDecoder final : public DOM::EventTarget {
+    WEB_PLATFORM_OBJECT(VideoDecoder, DOM::EventTarget);
+    GC_DECLARE_ALLOCATOR(VideoDecoder);
+
+public:
+    static WebIDL::ExceptionOr<GC::Ref<VideoDecoder>> construct_impl(JS::Realm&, VideoDecoderInit const&);
+
+    virtual ~VideoDecoder() override;
+
+    Bindings::CodecState state() const { return m_state; }
+    WebIDL::UnsignedLong decode_queue_size() const { return m_decode_queue_size; }
+
+    void set_ondequeue(GC::Ptr<WebIDL::CallbackType>);
+    GC::Ptr<WebIDL::CallbackType> ondequeue();
+
+    WebIDL::ExceptionOr<void> configure(VideoDecoderConfig const&);
+    WebIDL::ExceptionOr<void> decode(EncodedVideoChunk&);
+    GC::Ref<WebIDL::Promise> flush();
+    WebIDL::ExceptionOr<void> reset();
+    WebIDL::ExceptionOr<void> close();
+
+    static GC::Ref<WebIDL::Promise> is_config_supported(JS::VM&, VideoDecoderConfig const&);
+
+private:
+    VideoDecoder(JS::Realm&, NonnullRefPtr<VideoDecoderThread>, VideoDecoderInit const&);
+
+    virtual void initialize(JS::Realm&) override;
+    virtual void visit_edges(Cell::Visitor&) override;
+    virtual void finalize() override;
+
+    void handle_results(Vector<VideoDecoderThread::Result>);
+
+    WebIDL::ExceptionOr<void> reset_video_decoder(GC::Ref<WebIDL::DOMException>);
+    void close_video_decoder(GC::Ref<WebIDL::DOMException>);
+    void schedule_dequeue_event();
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-codec-implementation-slot
+    NonnullRefPtr<VideoDecoderThread> m_codec_implementation;
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-output-callback-slot
+    GC::Ptr<WebIDL::CallbackType> m_output_callback;
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-error-callback-slot
+    GC::Ptr<WebIDL::CallbackType> m_error_callback;
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-key-chunk-required-slot
+    bool m_key_chunk_required { true };
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-state-slot
+    Bindings::CodecState m_state { Bindings::CodecState::Unconfigured };
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-decodequeuesize-slot
+    WebIDL::UnsignedLong m_decode_queue_size { 0 };
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-pending-flush-promises-slot
+    struct PendingFlush {
+        u64 id { 0 };
+        GC::Ref<WebIDL::Promise> promise;
+    };
+    Vector<PendingFlush> m_pending_flush_promises;
+    u64 m_next_flush_id { 0 };
+
+    // https://w3c.github.io/webcodecs/#dom-videodecoder-dequeue-event-scheduled-slot
+    bool m_dequeue_event_scheduled { false };
+
+    // The durations of the chunks that are being decoded, keyed by their timestamps. Decoded frames carry only their
+    // timestamp, so this is how they find the duration of the chunk they came from.
+    HashMap<i64, Optional<WebIDL::UnsignedLongLong>> m_chunk_durations;
+};
+
+Optional<Media::CodecID> codec_id_from_codec_string(StringView);
+
+}
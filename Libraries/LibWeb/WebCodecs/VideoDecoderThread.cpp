@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/EventLoop.h>
+#include <LibMedia/FFmpeg/FFmpegVideoDecoder.h>
+#include <LibMedia/VideoFrame.h>
+#include <LibWeb/WebCodecs/VideoDecoderThread.h>
+
+namespace Web::WebCodecs {
+
+ErrorOr<NonnullRefPtr<VideoDecoderThread>> VideoDecoderThread::create()
+{
+    auto decoder_thread = TRY(adopt_nonnull_ref_or_enomem(new (nothrow) VideoDecoderThread(Core::EventLoop::current())));
+
+    decoder_thread->m_thread = TRY(Threading::Thread::try_create([&self = *decoder_thread] {
+        self.process_work_until_stopped();
+        return 0;
+    },
+        "Video Decoder"sv));
+    decoder_thread->m_thread->start();
+
+    return decoder_thread;
+}
+
+VideoDecoderThread::VideoDecoderThread(Core::EventLoop& event_loop)
+    : m_event_loop(event_loop)
+{
+}
+
+VideoDecoderThread::~VideoDecoderThread()
+{
+    stop();
+}
+
+void VideoDecoderThread::configure(Media::CodecID codec_id, ByteBuffer codec_initialization_data)
+{
+    enqueue(Configure { codec_id, move(codec_initialization_data) });
+}
+
+void VideoDecoderThread::decode(i64 timestamp, ByteBuffer data)
+{
+    enqueue(Decode { timestamp, move(data) });
+}
+
+void VideoDecoderThread::flush(u64 flush_id)
+{
+    enqueue(Flush { flush_id });
+}
+
+void VideoDecoderThread::enqueue(Variant<Configure, Decode, Flush> item)
+{
+    Threading::MutexLocker locker(m_mutex);
+    m_work_queue.enqueue({ m_generation, move(item) });
+    m_condition.broadcast();
+}
+
+void VideoDecoderThread::reset()
+{
+    Threading::MutexLocker locker(m_mutex);
+    ++m_generation;
+    m_work_queue.clear();
+    m_results.clear();
+}
+
+void VideoDecoderThread::stop()
+{
+    on_results = nullptr;
+
+    {
+        Threading::MutexLocker locker(m_mutex);
+        m_stop = true;
+        m_condition.broadcast();
+    }
+
+    if (m_thread && m_thread->needs_to_be_joined())
+        (void)m_thread->join();
+}
+
+void VideoDecoderThread::process_work_until_stopped()
+{
+    while (true) {
+        Optional<Work> work;
+        {
+            Threading::MutexLocker locker(m_mutex);
+            while (!m_stop && m_work_queue.is_empty())
+                m_condition.wait();
+            if (m_stop)
+                return;
+            work = m_work_queue.dequeue();
+        }
+
+        auto generation = work->generation;
+        work->item.visit(
+            [&](Configure& configure) {
+                m_decoder = nullptr;
+                auto decoder_or_error = Media::FFmpeg::FFmpegVideoDecoder::try_create(configure.codec_id, configure.codec_initialization_data);
+                if (decoder_or_error.is_error()) {
+                    post_result(generation, ConfigurationFailed { MUST(String::from_utf8(decoder_or_error.error().description())) });
+                    return;
+                }
+                m_decoder = decoder_or_error.release_value();
+            },
+            [&](Decode& decode) {
+                if (!m_decoder) {
+                    post_result(generation, DecodingFailed { "Decoder is not configured"_string });
+                    return;
+                }
+
+                auto timestamp = AK::Duration::from_microseconds(decode.timestamp);
+                while (true) {
+                    auto result = m_decoder->receive_sample(timestamp, decode.data.bytes());
+                    if (!result.is_error())
+                        break;
+                    // NOTE: The decoder won't accept any more input until the frames it holds have been retrieved.
+                    if (result.error().category() == Media::DecoderErrorCategory::NeedsMoreInput) {
+                        if (!drain_decoded_frames(generation))
+                            return;
+                        continue;
+                    }
+                    post_result(generation, DecodingFailed { MUST(String::from_utf8(result.error().description())) });
+                    return;
+                }
+
+                drain_decoded_frames(generation);
+            },
+            [&](Flush& flush) {
+                if (m_decoder) {
+                    if (auto result = m_decoder->signal_end_of_stream(); result.is_error()) {
+                        post_result(generation, DecodingFailed { MUST(String::from_utf8(result.error().description())) });
+                        return;
+                    }
+                    if (!drain_decoded_frames(generation))
+                        return;
+                    // NOTE: Draining ends the stream, so the decoder has to be flushed before it accepts more input.
+                    m_decoder->flush();
+                }
+                post_result(generation, FlushCompleted { flush.flush_id });
+            });
+    }
+}
+
+bool VideoDecoderThread::drain_decoded_frames(u64 generation)
+{
+    while (true) {
+        auto frame_or_error = m_decoder->get_decoded_frame();
+        if (frame_or_error.is_error()) {
+            auto category = frame_or_error.error().category();
+            if (category == Media::DecoderErrorCategory::NeedsMoreInput || category == Media::DecoderErrorCategory::EndOfStream)
+                return true;
+            post_result(generation, DecodingFailed { MUST(String::from_utf8(frame_or_error.error().description())) });
+            return false;
+        }
+
+        auto frame = frame_or_error.release_value();
+        auto timestamp = frame->timestamp().to_microseconds();
+
+        // NOTE: Converting the frame here keeps the decoded planes in the form the painter can upload directly.
+        auto bitmap_or_error = Media::VideoFrame::to_immutable_bitmap(move(frame));
+        if (bitmap_or_error.is_error()) {
+            post_result(generation, DecodingFailed { MUST(String::from_utf8(bitmap_or_error.error().description())) });
+            return false;
+        }
+        post_result(generation, FrameDecoded { bitmap_or_error.release_value(), timestamp });
+    }
+}
+
+void VideoDecoderThread::post_result(u64 generation, Result result)
+{
+    Threading::MutexLocker locker(m_mutex);
+
+    // The result belongs to work that was enqueued before the last reset, so nobody is interested in it anymore.
+    if (generation != m_generation)
+        return;
+
+    m_results.append(move(result));
+    if (m_results_delivery_scheduled)
+        return;
+    m_results_delivery_scheduled = true;
+
+    m_event_loop.deferred_invoke([self = NonnullRefPtr(*this)] {
+        self->deliver_results();
+    });
+}
+
+void VideoDecoderThread::deliver_results()
+{
+    Vector<Result> results;
+    {
+        Threading::MutexLocker locker(m_mutex);
+        results = move(m_results);
+        m_results_delivery_scheduled = false;
+    }
+
+    if (!results.is_empty() && on_results)
+        on_results(move(results));
+}
+
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/AtomicRefCounted.h>
+#include <AK/ByteBuffer.h>
+#include <AK/Function.h>
+#include <AK/Queue.h>
+#include <AK/String.h>
+#include <AK/Variant.h>
+#include <AK/Vector.h>
+#include <LibCore/Forward.h>
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibMedia/CodecID.h>
+#include <LibMedia/VideoDecoder.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
+
+namespace Web::WebCodecs {
+
+// Runs the codec implementation of a VideoDecoder on a thread of its own, which acts as the codec work queue of the
+// WebCodecs specification. Work is processed in the order it was enqueued, and results are handed back to the thread
+// that created the decoder thread through its event loop.
+class VideoDecoderThread final : public AtomicRefCounted<VideoDecoderThread> {
+public:
+    struct FrameDecoded {
+        NonnullRefPtr<Gfx::ImmutableBitmap> bitmap;
+        i64 timestamp { 0 };
+    };
+    struct FlushCompleted {
+        u64 flush_id { 0 };
+    };
+    struct ConfigurationFailed {
+        String message;
+    };
+    struct DecodingFailed {
+        String message;
+    };
+    using Result = Variant<FrameDecoded, FlushCompleted, ConfigurationFailed, DecodingFailed>;
+
+    static ErrorOr<NonnullRefPtr<VideoDecoderThread>> create();
+    ~VideoDecoderThread();
+
+    // These may only be called from the thread that created the decoder thread.
+    void configure(Media::CodecID, ByteBuffer codec_initialization_data);
+    void decode(i64 timestamp, ByteBuffer data);
+    void flush(u64 flush_id);
+
+    // Drops all work that has not been processed yet, along with every result of work that was enqueued before this
+    // call which has not been delivered yet.
+    void reset();
+
+    // Stops the thread. No more results are delivered after this returns.
+    void stop();
+
+    // Called on the thread that created the decoder thread, with results in the order they were produced.
+    Function<void(Vector<Result>)> on_results;
+
+private:
+    struct Configure {
+        Media::CodecID codec_id;
+        ByteBuffer codec_initialization_data;
+    };
+    struct Decode {
+        i64 timestamp { 0 };
+        ByteBuffer data;
+    };
+    struct Flush {
+        u64 flush_id { 0 };
+    };
+    struct Work {
+        u64 generation { 0 };
+        Variant<Configure, Decode, Flush> item;
+    };
+
+    explicit VideoDecoderThread(Core::EventLoop&);
+
+    void enqueue(Variant<Configure, Decode, Flush>);
+    void process_work_until_stopped();
+    bool drain_decoded_frames(u64 generation);
+    void post_result(u64 generation, Result);
+    void deliver_results();
+
+    Core::EventLoop& m_event_loop;
+    RefPtr<Threading::Thread> m_thread;
+
+    // This is only used on the decoder thread.
+    OwnPtr<Media::VideoDecoder> m_decoder;
+
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_condition { m_mutex };
+
+    // These are protected by m_mutex.
+    bool m_stop { false };
+    u64 m_generation { 0 };
+    Queue<Work> m_work_queue;
+    Vector<Result> m_results;
+    bool m_results_delivery_scheduled { false };
+};
+
+}
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Checked.h>
+#include <LibGfx/Bitmap.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/ArrayBuffer.h>
+#include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/HTML/EventLoop/EventLoop.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
+#include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
+#include <LibWeb/WebCodecs/VideoFrame.h>
+#include <LibWeb/WebIDL/DOMException.h>
+
+namespace Web::WebCodecs {
+
+GC_DEFINE_ALLOCATOR(VideoFrame);
+
+// Every frame is exposed to script as a single plane of 4 bytes per pixel.
+static constexpr WebIDL::UnsignedLong bytes_per_pixel = 4;
+
+GC::Ref<VideoFrame> VideoFrame::create(JS::Realm& realm, NonnullRefPtr<Gfx::ImmutableBitmap> bitmap, WebIDL::LongLong timestamp, Optional<WebIDL::UnsignedLongLong> duration)
+{
+    return realm.create<VideoFrame>(realm, move(bitmap), timestamp, duration);
+}
+
+VideoFrame::VideoFrame(JS::Realm& realm, NonnullRefPtr<Gfx::ImmutableBitmap> bitmap, WebIDL::LongLong timestamp, Optional<WebIDL::UnsignedLongLong> duration)
+    : PlatformObject(realm)
+    , m_resource_reference(bitmap)
+    , m_format(Bindings::VideoPixelFormat::Bgrx)
+    , m_coded_width(bitmap->width())
+    , m_coded_height(bitmap->height())
+    , m_display_width(bitmap->width())
+    , m_display_height(bitmap->height())
+    , m_duration(duration)
+    , m_timestamp(timestamp)
+{
+}
+
+VideoFrame::~VideoFrame() = default;
+
+void VideoFrame::initialize(JS::Realm& realm)
+{
+    WEB_SET_PROTOTYPE_FOR_INTERFACE(VideoFrame);
+    Base::initialize(realm);
+}
+
+// https://w3c.github.io/webcodecs/#videoframe-parse-videoframecopytooptions
+WebIDL::ExceptionOr<VideoFrame::CombinedLayout> VideoFrame::parse_copy_to_options(VideoFrameCopyToOptions const& options) const
+{
+    // NOTE: We only support copying the whole frame in its own format, which has a single plane.
+    CombinedLayout combined_layout;
+    Checked<WebIDL::UnsignedLong> row_bytes = m_coded_width;
+    row_bytes *= bytes_per_pixel;
+    if (row_bytes.has_overflow())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The frame is too large to be copied"sv };
+
+    // If options.layout exists, it must describe exactly one plane for each plane of the format.
+    if (options.layout.has_value()) {
+        if (options.layout->size() != 1)
+            return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The layout must describe exactly one plane"sv };
+
+        // The stride of a plane must be at least the number of bytes in one of its rows.
+        combined_layout.plane_layout = options.layout->first();
+        if (combined_layout.plane_layout.stride < row_bytes.value())
+            return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The stride of the plane is smaller than a row of the frame"sv };
+    } else {
+        combined_layout.plane_layout = { .offset = 0, .stride = row_bytes.value() };
+    }
+
+    Checked<WebIDL::UnsignedLong> allocation_size = combined_layout.plane_layout.stride;
+    allocation_size *= m_coded_height;
+    allocation_size += combined_layout.plane_layout.offset;
+    if (allocation_size.has_overflow())
+        return WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The layout describes a plane that is too large"sv };
+    combined_layout.allocation_size = allocation_size.value();
+
+    return combined_layout;
+}
+
+// https://w3c.github.io/webcodecs/#dom-videoframe-allocationsize
+WebIDL::ExceptionOr<WebIDL::UnsignedLong> VideoFrame::allocation_size(VideoFrameCopyToOptions const& options)
+{
+    // 1. If [[Detached]] is true, throw an InvalidStateError DOMException.
+    if (m_detached)
+        return WebIDL::InvalidStateError::create(realm(), "VideoFrame is closed"_string);
+
+    // 2. If [[format]] is null, throw a NotSupportedError DOMException.
+    if (!m_format.has_value())
+        return WebIDL::NotSupportedError::create(realm(), "VideoFrame has no format"_string);
+
+    // 3. Let combinedLayout be the result of running the Parse VideoFrameCopyToOptions algorithm with options.
+    // 4. If combinedLayout is an exception, throw combinedLayout.
+    auto combined_layout = TRY(parse_copy_to_options(options));
+
+    // 5. Return combinedLayout’s allocationSize.
+    return combined_layout.allocation_size;
+}
+
+// https://w3c.github.io/webcodecs/#dom-videoframe-copyto
+GC::Ref<WebIDL::Promise> VideoFrame::copy_to(GC::Root<WebIDL::BufferSource> const& destination, VideoFrameCopyToOptions const& options)
+{
+    auto& realm = this->realm();
+
+    // 1. If [[Detached]] is true, return a promise rejected with an InvalidStateError DOMException.
+    if (m_detached)
+        return WebIDL::create_rejected_promise_from_exception(realm, WebIDL::InvalidStateError::create(realm, "VideoFrame is closed"_string));
+
+    // 2. If [[format]] is null, return a promise rejected with a NotSupportedError DOMException.
+    if (!m_format.has_value())
+        return WebIDL::create_rejected_promise_from_exception(realm, WebIDL::NotSupportedError::create(realm, "VideoFrame has no format"_string));
+
+    // 3. Let combinedLayout be the result of running the Parse VideoFrameCopyToOptions algorithm with options.
+    auto combined_layout = parse_copy_to_options(options);
+
+    // 4. If combinedLayout is an exception, return a promise rejected with combinedLayout.
+    if (combined_layout.is_exception())
+        return WebIDL::create_rejected_promise_from_exception(realm, combined_layout.release_error());
+
+    // 5. If destination.byteLength is less than combinedLayout’s allocationSize, return a promise rejected with a
+    //    TypeError.
+    if (destination->byte_length() < combined_layout.value().allocation_size) {
+        return WebIDL::create_rejected_promise_from_exception(realm, WebIDL::SimpleException { WebIDL::SimpleExceptionType::TypeError, "The destination buffer is too small to hold the frame"sv });
+    }
+
+    // 6. FIXME: If options.format is equal to one of RGBA, RGBX, BGRA, BGRX then run the Convert to RGB frame
+    //           algorithm.
+
+    // 7. Let p be a new Promise.
+    auto promise = WebIDL::create_promise(realm);
+
+    // 8. Let copyStepsQueue be the result of starting a new parallel queue.
+    // 9. Let planeLayouts be a new list.
+    // 10. Enqueue the following steps to copyStepsQueue:
+    // NOTE: The destination is a JavaScript buffer, so we copy into it right away instead of doing so in parallel.
+    //    1. Let resource be the media resource referenced by [[resource reference]].
+    //       NOTE: Frames that are still in YUV form are converted to RGB here.
+    auto bitmap = m_resource_reference->bitmap();
+    VERIFY(bitmap);
+
+    //    2. Let numPlanes be the number of planes as defined by [[format]].
+    //    3. Let planeIndex be 0.
+    //    4. While planeIndex is less than combinedLayout’s numPlanes:
+    //       1-9. Copy each row of the plane to destination, starting at the offset and advancing by the stride of the
+    //            plane's layout.
+    auto const& plane_layout = combined_layout.value().plane_layout;
+    auto destination_bytes = destination->viewed_array_buffer()->buffer().bytes().slice(destination->byte_offset(), destination->byte_length());
+    bool needs_swizzle = bitmap->format() == Gfx::BitmapFormat::RGBA8888 || bitmap->format() == Gfx::BitmapFormat::RGBx8888;
+    for (int y = 0; y < bitmap->height(); ++y) {
+        auto const* source_row = bitmap->scanline_u8(y);
+        auto* destination_row = destination_bytes.offset_pointer(plane_layout.offset + y * plane_layout.stride);
+        if (!needs_swizzle) {
+            memcpy(destination_row, source_row, m_coded_width * bytes_per_pixel);
+            continue;
+        }
+        for (WebIDL::UnsignedLong x = 0; x < m_coded_width; ++x) {
+            auto const* source_pixel = source_row + x * bytes_per_pixel;
+            auto* destination_pixel = destination_row + x * bytes_per_pixel;
+            destination_pixel[0] = source_pixel[2];
+            destination_pixel[1] = source_pixel[1];
+            destination_pixel[2] = source_pixel[0];
+            destination_pixel[3] = source_pixel[3];
+        }
+    }
+
+    //       10. Let layout be a new PlaneLayout, with offset set to destinationOffset and stride set to
+    //           destinationStride.
+    //       11. Append layout to planeLayouts.
+    //       12. Increment planeIndex by 1.
+    //    5. Queue a task to resolve p with planeLayouts.
+    HTML::queue_global_task(HTML::Task::Source::Unspecified, HTML::relevant_global_object(*this), GC::create_function(realm.heap(), [&realm, promise, plane_layout] {
+        HTML::TemporaryExecutionContext context(realm, HTML::TemporaryExecutionContext::CallbacksEnabled::Yes);
+
+        auto layout = JS::Object::create(realm, realm.intrinsics().object_prototype());
+        MUST(layout->create_data_property("offset"_fly_string, JS::Value(plane_layout.offset)));
+        MUST(layout->create_data_property("stride"_fly_string, JS::Value(plane_layout.stride)));
+
+        WebIDL::resolve_promise(realm, promise, JS::Array::create_from(realm, { JS::Value(layout) }));
+    }));
+
+    // 11. Return p.
+    return promise;
+}
+
+// https://w3c.github.io/webcodecs/#dom-videoframe-clone
+WebIDL::ExceptionOr<GC::Ref<VideoFrame>> VideoFrame::clone()
+{
+    // 1. If the value of frame’s [[Detached]] internal slot is true, throw an InvalidStateError DOMException.
+    if (m_detached)
+        return WebIDL::InvalidStateError::create(realm(), "VideoFrame is closed"_string);
+
+    // 2. Return the result of running the Clone VideoFrame algorithm with this.
+    // NOTE: The clone shares the resource reference of this frame.
+    return VideoFrame::create(realm(), *m_resource_reference, m_timestamp, m_duration);
+}
+
+// https://w3c.github.io/webcodecs/#dom-videoframe-close
+void VideoFrame::close()
+{
+    // https://w3c.github.io/webcodecs/#close-videoframe
+    // 1. Assign null to frame’s [[resource reference]].
+    m_resource_reference = nullptr;
+
+    // 2. Assign true to frame’s [[Detached]].
+    m_detached = true;
+
+    // 3. Assign null to frame’s format attribute.
+    m_format = {};
+
+    // 4. Assign 0 to frame’s [[coded width]], [[coded height]], [[visible left]], [[visible top]], [[visible width]],
+    //    [[visible height]], [[rotation]], [[display width]], and [[display height]].
+    m_coded_width = 0;
+    m_coded_height = 0;
+    m_display_width = 0;
+    m_display_height = 0;
+
+    // 5. Assign false to frame’s [[flip]].
+    // 6. Assign a new VideoFrameMetadata to frame.[[metadata]].
+}
+
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibWeb/Bindings/PlatformObject.h>
+#include <LibWeb/Bindings/VideoFramePrototype.h>
+#include <LibWeb/WebIDL/Buffers.h>
+#include <LibWeb/WebIDL/ExceptionOr.h>
+#include <LibWeb/WebIDL/Promise.h>
+#include <LibWeb/WebIDL/Types.h>
+
+namespace Web::WebCodecs {
+
+// https://w3c.github.io/webcodecs/#dictdef-planelayout
+struct PlaneLayout {
+    WebIDL::UnsignedLong offset { 0 };
+    WebIDL::UnsignedLong stride { 0 };
+};
+
+// https://w3c.github.io/webcodecs/#dictdef-videoframecopytooptions
+struct VideoFrameCopyToOptions {
+    Optional<Vector<PlaneLayout>> layout;
+};
+
+// https://w3c.github.io/webcodecs/#videoframe-interface
+class VideoFrame final : public Bindings::PlatformObject {
+    WEB_PLATFORM_OBJECT(VideoFrame, Bindings::PlatformObject);
+    GC_DECLARE_ALLOCATOR(VideoFrame);
+
+public:
+    // NOTE: Decoded frames are kept in whatever form the decoder produced them, so that drawing them into a canvas
+    //       doesn't have to copy or convert them. To script they always look like opaque BGRX frames, and their
+    //       pixels are only converted when script copies them out.
+    static GC::Ref<VideoFrame> create(JS::Realm&, NonnullRefPtr<Gfx::ImmutableBitmap>, WebIDL::LongLong timestamp, Optional<WebIDL::UnsignedLongLong> duration);
+
+    virtual ~VideoFrame() override;
+
+    Optional<Bindings::VideoPixelFormat> format() const { return m_format; }
+    WebIDL::UnsignedLong coded_width() const { return m_coded_width; }
+    WebIDL::UnsignedLong coded_height() const { return m_coded_height; }
+    WebIDL::UnsignedLong display_width() const { return m_display_width; }
+    WebIDL::UnsignedLong display_height() const { return m_display_height; }
+    Optional<WebIDL::UnsignedLongLong> duration() const { return m_duration; }
+    WebIDL::LongLong timestamp() const { return m_timestamp; }
+
+    WebIDL::ExceptionOr<WebIDL::UnsignedLong> allocation_size(VideoFrameCopyToOptions const&);
+    GC::Ref<WebIDL::Promise> copy_to(GC::Root<WebIDL::BufferSource> const& destination, VideoFrameCopyToOptions const&);
+    WebIDL::ExceptionOr<GC::Ref<VideoFrame>> clone();
+    void close();
+
+    bool is_detached() const { return m_detached; }
+    RefPtr<Gfx::ImmutableBitmap> bitmap() const { return m_resource_reference; }
+
+private:
+    struct CombinedLayout {
+        WebIDL::UnsignedLong allocation_size { 0 };
+        PlaneLayout plane_layout;
+    };
+
+    VideoFrame(JS::Realm&, NonnullRefPtr<Gfx::ImmutableBitmap>, WebIDL::LongLong timestamp, Optional<WebIDL::UnsignedLongLong> duration);
+
+    virtual void initialize(JS::Realm&) override;
+
+    WebIDL::ExceptionOr<CombinedLayout> parse_copy_to_options(VideoFrameCopyToOptions const&) const;
+
+    // https://w3c.github.io/webcodecs/#dom-videoframe-detached-slot
+    bool m_detached { false };
+
+    // https://w3c.github.io/webcodecs/#dom-videoframe-resource-reference-slot
+    RefPtr<Gfx::ImmutableBitmap> m_resource_reference;
+
+    // https://w3c.github.io/webcodecs/#dom-videoframe-format-slot
+    Optional<Bindings::VideoPixelFormat> m_format;
+
+    // https://w3c.github.io/webcodecs/#dom-videoframe-coded-width-slot
+    WebIDL::UnsignedLong m_coded_width { 0 };
+
+    // https://w3c.github.io/webcodecs/#dom-videoframe-coded-height-slot
+    WebIDL::UnsignedLong m_coded_height { 0 };
+
+    // https://w3c.github.io/webcodecs/#dom-videoframe-display-width-slot
+    WebIDL::UnsignedLong m_display_width { 0 };
+
+    // https://w3c.github.io/webcodecs/#dom-videoframe-display-height-slot
+    WebIDL::UnsignedLong m_display_height { 0 };
+
+    // https://w3c.github.io/webcodecs/#dom-videoframe-duration-slot
+    Optional<WebIDL::UnsignedLongLong> m_duration;
+
+    // https://w3c.github.io/webcodecs/#dom-videoframe-timestamp-slot
+    WebIDL::LongLong m_timestamp { 0 };
+};
+
+}
@@ -42,8 +42,21 @@ OpenGLContext::OpenGLContext(NonnullRefPtr<Gfx::SkiaBackendContext> skia_backend
 {
 }
 
+// NOTE: This is how many commands are collected before they are sent to the GPU thread as one batch.
+static constexpr size_t command_buffer_batch_size = 1024;
+
 OpenGLContext::~OpenGLContext()
 {
+    if (m_gpu_thread) {
+        wait_for_gpu_thread_to_release_context();
+        {
+            Threading::MutexLocker const locker { m_gpu_thread_mutex };
+            m_should_exit = true;
+            m_gpu_thread_wake_condition.signal();
+        }
+        (void)m_gpu_thread->join();
+    }
+
 #ifdef AK_OS_MACOS
     eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
     glDeleteFramebuffers(1, &m_impl->framebuffer);
@@ -230,8 +243,106 @@ void OpenGLContext::set_size(Gfx::IntSize const& size)
 void OpenGLContext::make_current()
 {
 #ifdef AK_OS_MACOS
+    wait_for_gpu_thread_to_release_context();
     allocate_painting_surface_if_needed();
     eglMakeCurrent(m_impl->display, m_impl->surface, m_impl->surface, m_impl->context);
+    m_is_current_on_main_thread = true;
+#endif
+}
+
+void OpenGLContext::enqueue(Function<void()>&& command)
+{
+#ifdef AK_OS_MACOS
+    m_pending_commands.append(move(command));
+    if (m_pending_commands.size() >= command_buffer_batch_size)
+        flush_command_buffer();
+#else
+    command();
+#endif
+}
+
+void OpenGLContext::flush_command_buffer()
+{
+#ifdef AK_OS_MACOS
+    if (m_pending_commands.is_empty())
+        return;
+
+    // NOTE: A context can only be current on one thread at a time, so the main thread lets go of it for the GPU thread.
+    if (m_is_current_on_main_thread) {
+        eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        m_is_current_on_main_thread = false;
+    }
+
+    if (!m_gpu_thread) {
+        m_gpu_thread = Threading::Thread::construct([this] {
+            gpu_thread_loop();
+            return static_cast<intptr_t>(0);
+        },
+            "WebGL GPU"sv);
+        m_gpu_thread->start();
+    }
+
+    Threading::MutexLocker const locker { m_gpu_thread_mutex };
+    m_submitted_command_batches.enqueue(move(m_pending_commands));
+    m_gpu_thread_may_own_context = true;
+    m_gpu_thread_wake_condition.signal();
+#endif
+}
+
+void OpenGLContext::wait_for_gpu_thread_to_release_context()
+{
+    flush_command_buffer();
+    if (!m_gpu_thread_may_own_context)
+        return;
+
+    Threading::MutexLocker const locker { m_gpu_thread_mutex };
+    m_should_release_context = true;
+    m_gpu_thread_wake_condition.signal();
+    while (!m_submitted_command_batches.is_empty() || m_gpu_thread_is_running_commands || m_gpu_thread_owns_context)
+        m_gpu_thread_idle_condition.wait();
+    m_should_release_context = false;
+    m_gpu_thread_may_own_context = false;
+}
+
+void OpenGLContext::gpu_thread_loop()
+{
+#ifdef AK_OS_MACOS
+    while (true) {
+        Optional<Vector<Function<void()>>> commands;
+        {
+            Threading::MutexLocker const locker { m_gpu_thread_mutex };
+            while (m_submitted_command_batches.is_empty() && !m_should_release_context && !m_should_exit)
+                m_gpu_thread_wake_condition.wait();
+
+            if (m_submitted_command_batches.is_empty()) {
+                if (m_gpu_thread_owns_context) {
+                    eglMakeCurrent(m_impl->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+                    m_gpu_thread_owns_context = false;
+                }
+                m_gpu_thread_idle_condition.signal();
+                if (m_should_exit)
+                    return;
+                // NOTE: Wait for the main thread to take the context, so that we do not spin on the release request.
+                while (m_should_release_context && m_submitted_command_batches.is_empty() && !m_should_exit)
+                    m_gpu_thread_wake_condition.wait();
+                continue;
+            }
+
+            commands = m_submitted_command_batches.dequeue();
+            m_gpu_thread_is_running_commands = true;
+            if (!m_gpu_thread_owns_context) {
+                eglMakeCurrent(m_impl->display, m_impl->surface, m_impl->surface, m_impl->context);
+                m_gpu_thread_owns_context = true;
+            }
+        }
+
+        for (auto& command : *commands)
+            command();
+
+        Threading::MutexLocker const locker { m_gpu_thread_mutex };
+        m_gpu_thread_is_running_commands = false;
+        m_gpu_thread_idle_condition.signal();
+    }
 #endif
 }
 
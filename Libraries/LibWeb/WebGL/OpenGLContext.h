@@ -6,8 +6,14 @@
 
 #pragma once
 
+#include <AK/Function.h>
+#include <AK/Queue.h>
+#include <AK/Vector.h>
 #include <LibGfx/Forward.h>
 #include <LibGfx/Size.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
 
 namespace Web::WebGL {
 
@@ -24,8 +30,15 @@ public:
 
     ~OpenGLContext();
 
+    // Makes the context current on the calling thread, so that GL can be called directly. This waits for every queued
+    // command to have run, so it must be called before anything that needs a result from GL.
     void make_current();
 
+    // Queues a GL call that does not return anything and only captures values, to be run on the GPU thread of this
+    // context. Queued calls are sent to the GPU thread in batches, so that the main thread does not wait on the driver.
+    void enqueue(Function<void()>&&);
+    void flush_command_buffer();
+
     void set_size(Gfx::IntSize const&);
 
     RefPtr<Gfx::PaintingSurface> surface();
@@ -37,11 +50,29 @@ public:
     void request_extension(char const* extension_name);
 
 private:
+    void wait_for_gpu_thread_to_release_context();
+    void gpu_thread_loop();
+
     NonnullRefPtr<Gfx::SkiaBackendContext> m_skia_backend_context;
     Gfx::IntSize m_size;
     RefPtr<Gfx::PaintingSurface> m_painting_surface;
     NonnullOwnPtr<Impl> m_impl;
     Optional<Vector<String>> m_requestable_extensions;
+
+    // Only touched on the main thread.
+    Vector<Function<void()>> m_pending_commands;
+    bool m_is_current_on_main_thread { false };
+    bool m_gpu_thread_may_own_context { false };
+
+    RefPtr<Threading::Thread> m_gpu_thread;
+    Threading::Mutex m_gpu_thread_mutex;
+    Threading::ConditionVariable m_gpu_thread_wake_condition { m_gpu_thread_mutex };
+    Threading::ConditionVariable m_gpu_thread_idle_condition { m_gpu_thread_mutex };
+    Queue<Vector<Function<void()>>> m_submitted_command_batches;
+    bool m_gpu_thread_is_running_commands { false };
+    bool m_gpu_thread_owns_context { false };
+    bool m_should_release_context { false };
+    bool m_should_exit { false };
 };
 
 }
@@ -86,6 +86,8 @@ void WebGL2RenderingContext::present()
     m_should_present = false;
 
     // "Before the drawing buffer is presented for compositing the implementation shall ensure that all rendering operations have been flushed to the drawing buffer."
+    // NOTE: This also waits for the GPU thread to have run every queued command.
+    context().make_current();
     glFlush();
 
     // "By default, after compositing the contents of the drawing buffer shall be cleared to their default values, as shown in the table above.
@@ -112,6 +114,7 @@ void WebGL2RenderingContext::needs_to_present()
 
 void WebGL2RenderingContext::set_error(GLenum error)
 {
+    context().make_current();
     auto context_error = glGetError();
     if (context_error != GL_NO_ERROR)
         m_error = context_error;
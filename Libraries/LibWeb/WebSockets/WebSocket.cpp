@@ -370,11 +370,10 @@ void WebSocket::on_message(ByteBuffer message, bool is_text)
         return;
 
     // When a WebSocket message has been received with type type and data data, the user agent must queue a task to follow these steps:
-    HTML::queue_a_task(HTML::Task::Source::WebSocket, nullptr, nullptr, GC::create_function(heap(), [this, message = move(message), is_text] {
+    HTML::queue_a_task(HTML::Task::Source::WebSocket, nullptr, nullptr, GC::create_function(heap(), [this, message = move(message), is_text]() mutable {
         if (is_text) {
-            auto text_message = ByteString(ReadonlyBytes(message));
             HTML::MessageEventInit event_init;
-            event_init.data = JS::PrimitiveString::create(vm(), text_message);
+            event_init.data = JS::PrimitiveString::create(vm(), StringView { message });
             event_init.origin = url();
             dispatch_event(HTML::MessageEvent::create(realm(), HTML::EventNames::message, event_init));
             return;
@@ -383,14 +382,14 @@ void WebSocket::on_message(ByteBuffer message, bool is_text)
         if (m_binary_type == "blob") {
             // type indicates that the data is Binary and binaryType is "blob"
             HTML::MessageEventInit event_init;
-            event_init.data = FileAPI::Blob::create(realm(), message, "text/plain;charset=utf-8"_string);
+            event_init.data = FileAPI::Blob::create(realm(), move(message), "text/plain;charset=utf-8"_string);
             event_init.origin = url();
             dispatch_event(HTML::MessageEvent::create(realm(), HTML::EventNames::message, event_init));
             return;
         } else if (m_binary_type == "arraybuffer") {
             // type indicates that the data is Binary and binaryType is "arraybuffer"
             HTML::MessageEventInit event_init;
-            event_init.data = JS::ArrayBuffer::create(realm(), message);
+            event_init.data = JS::ArrayBuffer::create(realm(), move(message));
             event_init.origin = url();
             dispatch_event(HTML::MessageEvent::create(realm(), HTML::EventNames::message, event_init));
             return;
@@ -91,6 +91,7 @@ void XMLDocumentBuilder::element_start(const XML::Name& name, HashMap<XML::Name,
 {
     if (m_has_error)
         return;
+    flush_pending_text();
 
     Vector<NamespaceAndPrefix, 2> namespaces;
     for (auto const& [name, value] : attributes) {
@@ -182,6 +183,7 @@ void XMLDocumentBuilder::element_end(const XML::Name& name)
 {
     if (m_has_error)
         return;
+    flush_pending_text();
 
     if (--m_namespace_stack.last().depth == 0) {
         m_namespace_stack.take_last();
@@ -234,25 +236,33 @@ void XMLDocumentBuilder::text(StringView data)
 {
     if (m_has_error)
         return;
+
+    // Character data arrives in pieces (e.g. around every entity reference), so it is collected until the next node
+    // starts or ends and only then inserted, rather than rebuilding a text node for every piece.
+    text_builder.append(data);
+}
+
+void XMLDocumentBuilder::flush_pending_text()
+{
+    if (text_builder.is_empty())
+        return;
+
     auto last = m_current_node->last_child();
     if (last && last->is_text()) {
         auto& text_node = static_cast<DOM::Text&>(*last);
-        text_builder.append(text_node.data());
-        text_builder.append(data);
-        text_node.set_data(MUST(text_builder.to_string()));
-        text_builder.clear();
+        text_node.set_data(MUST(String::formatted("{}{}", text_node.data(), text_builder.string_view())));
     } else {
-        if (!data.is_empty()) {
-            auto node = m_document->create_text_node(MUST(String::from_utf8(data)));
-            MUST(m_current_node->append_child(node));
-        }
+        auto node = m_document->create_text_node(MUST(text_builder.to_string()));
+        MUST(m_current_node->append_child(node));
     }
+    text_builder.clear();
 }
 
 void XMLDocumentBuilder::comment(StringView data)
 {
     if (m_has_error)
         return;
+    flush_pending_text();
     MUST(m_document->append_child(m_document->create_comment(MUST(String::from_utf8(data)))));
 }
 
@@ -260,6 +270,9 @@ void XMLDocumentBuilder::document_end()
 {
     auto& heap = m_document->heap();
 
+    if (!m_has_error && m_current_node)
+        flush_pending_text();
+
     // When an XML parser reaches the end of its input, it must stop parsing.
     // If the active speculative HTML parser is not null, then stop the speculative HTML parser and return.
     // NOTE: Noop.
@@ -38,6 +38,7 @@ private:
     virtual void comment(StringView data) override;
     virtual void document_end() override;
 
+    void flush_pending_text();
     Optional<FlyString> namespace_for_name(XML::Name const&);
 
     GC::Ref<DOM::Document> m_document;
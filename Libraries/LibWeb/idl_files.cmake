@@ -226,6 +226,8 @@ libweb_js_bindings(HTML/NavigationDestination)
 libweb_js_bindings(HTML/NavigationHistoryEntry)
 libweb_js_bindings(HTML/NavigationTransition)
 libweb_js_bindings(HTML/Navigator)
+libweb_js_bindings(HTML/OffscreenCanvas)
+libweb_js_bindings(HTML/OffscreenCanvasRenderingContext2D)
 libweb_js_bindings(HTML/PageTransitionEvent)
 libweb_js_bindings(HTML/Path2D)
 libweb_js_bindings(HTML/Plugin)
@@ -293,6 +295,8 @@ libweb_js_bindings(ResizeObserver/ResizeObserver)
 libweb_js_bindings(ResizeObserver/ResizeObserverEntry)
 libweb_js_bindings(ResizeObserver/ResizeObserverSize)
 libweb_js_bindings(ResourceTiming/PerformanceResourceTiming)
+libweb_js_bindings(ServiceWorker/Cache)
+libweb_js_bindings(ServiceWorker/CacheStorage)
 libweb_js_bindings(ServiceWorker/ServiceWorker)
 libweb_js_bindings(ServiceWorker/ServiceWorkerContainer)
 libweb_js_bindings(ServiceWorker/ServiceWorkerGlobalScope GLOBAL)
@@ -397,6 +401,9 @@ libweb_js_bindings(WebAudio/OscillatorNode)
 libweb_js_bindings(WebAudio/PannerNode)
 libweb_js_bindings(WebAudio/PeriodicWave)
 libweb_js_bindings(WebAudio/StereoPannerNode)
+libweb_js_bindings(WebCodecs/EncodedVideoChunk)
+libweb_js_bindings(WebCodecs/VideoDecoder)
+libweb_js_bindings(WebCodecs/VideoFrame)
 libweb_js_bindings(WebGL/Extensions/ANGLEInstancedArrays)
 libweb_js_bindings(WebGL/Extensions/EXTBlendMinMax)
 libweb_js_bindings(WebGL/Extensions/EXTColorBufferFloat)
@@ -5,11 +5,14 @@
  */
 
 #include <AK/Debug.h>
+#include <AK/QuickSort.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/Environment.h>
 #include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
+#include <LibCore/MemoryPressureWatcher.h>
 #include <LibCore/TimeZoneWatcher.h>
+#include <LibCore/Timer.h>
 #include <LibDevTools/DevToolsServer.h>
 #include <LibFileSystem/FileSystem.h>
 #include <LibImageDecoderClient/Client.h>
@@ -18,14 +21,21 @@
 #include <LibWebView/CookieJar.h>
 #include <LibWebView/Database.h>
 #include <LibWebView/HelperProcess.h>
+#include <LibWebView/IndexedDBStorage.h>
+#include <LibWebView/LocalStorage.h>
+#include <LibWebView/StorageUsage.h>
 #include <LibWebView/URL.h>
 #include <LibWebView/UserAgent.h>
+#include <LibWebView/ViewImplementation.h>
 #include <LibWebView/WebContentClient.h>
 
 namespace WebView {
 
 Application* Application::s_the = nullptr;
 
+// How often WebContent processes are checked against the memory budget, if one was given.
+static constexpr int memory_budget_check_interval_ms = 30'000;
+
 struct ApplicationSettingsObserver : public SettingsObserver {
     virtual void dns_settings_changed() override
     {
@@ -68,6 +78,16 @@ Application::Application()
         }
     }
 
+    if (auto memory_pressure_watcher = Core::MemoryPressureWatcher::create(); memory_pressure_watcher.is_error()) {
+        dbgln("Unable to monitor system memory pressure: {}", memory_pressure_watcher.error());
+    } else {
+        m_memory_pressure_watcher = memory_pressure_watcher.release_value();
+
+        m_memory_pressure_watcher->on_memory_pressure = [this]() {
+            release_memory_in_all_processes();
+        };
+    }
+
     m_process_manager.on_process_exited = [this](Process&& process) {
         process_did_exit(move(process));
     };
@@ -97,6 +117,11 @@ void Application::initialize(Main::Arguments const& arguments)
     bool disable_scripting = false;
     bool disable_sql_database = false;
     u16 devtools_port = WebView::default_devtools_port;
+    size_t spare_web_content_process_count = BrowserOptions {}.spare_web_content_process_count;
+    size_t spare_web_worker_process_count = BrowserOptions {}.spare_web_worker_process_count;
+    Optional<size_t> web_content_memory_budget_in_mib;
+    Optional<size_t> freeze_background_tabs_after_seconds;
+    Optional<size_t> max_frozen_background_tabs;
     Optional<StringView> debug_process;
     Optional<StringView> profile_process;
     Optional<StringView> webdriver_content_ipc_path;
@@ -108,6 +133,7 @@ void Application::initialize(Main::Arguments const& arguments)
     bool disable_site_isolation = false;
     bool enable_idl_tracing = false;
     bool enable_http_cache = false;
+    bool enable_http_disk_cache = false;
     bool enable_autoplay = false;
     bool expose_internals_object = false;
     bool force_cpu_painting = false;
@@ -128,10 +154,16 @@ void Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(profile_process, "Enable callgrind profiling of the given process name (WebContent, RequestServer, etc.)", "profile-process", 0, "process-name");
     args_parser.add_option(webdriver_content_ipc_path, "Path to WebDriver IPC for WebContent", "webdriver-content-path", 0, "path", Core::ArgsParser::OptionHideMode::CommandLineAndMarkdown);
     args_parser.add_option(devtools_port, "Set the Firefox DevTools server port ", "devtools-port", 0, "port");
+    args_parser.add_option(spare_web_content_process_count, "Number of WebContent processes to keep launched ahead of time", "spare-web-content-processes", 0, "count");
+    args_parser.add_option(spare_web_worker_process_count, "Number of dedicated WebWorker processes to keep launched ahead of time", "spare-web-worker-processes", 0, "count");
+    args_parser.add_option(web_content_memory_budget_in_mib, "Ask WebContent processes that use more memory than this to release memory", "web-content-memory-budget", 0, "MiB");
+    args_parser.add_option(freeze_background_tabs_after_seconds, "Freeze background tabs once they have been hidden for this long", "freeze-background-tabs-after", 0, "seconds");
+    args_parser.add_option(max_frozen_background_tabs, "Discard the processes of frozen background tabs beyond this many", "max-frozen-background-tabs", 0, "count");
     args_parser.add_option(log_all_js_exceptions, "Log all JavaScript exceptions", "log-all-js-exceptions");
     args_parser.add_option(disable_site_isolation, "Disable site isolation", "disable-site-isolation");
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
     args_parser.add_option(enable_http_cache, "Enable HTTP cache", "enable-http-cache");
+    args_parser.add_option(enable_http_disk_cache, "Enable HTTP disk cache", "enable-http-disk-cache");
     args_parser.add_option(enable_autoplay, "Enable multimedia autoplay", "enable-autoplay");
     args_parser.add_option(expose_internals_object, "Expose internals object", "expose-internals-object");
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
@@ -192,6 +224,12 @@ void Application::initialize(Main::Arguments const& arguments)
                           : DNSSettings(DNSOverUDP(dns_server_address.release_value(), *dns_server_port)) }
                 : OptionalNone()),
         .devtools_port = devtools_port,
+        .enable_http_disk_cache = enable_http_disk_cache ? EnableHTTPDiskCache::Yes : EnableHTTPDiskCache::No,
+        .spare_web_content_process_count = spare_web_content_process_count,
+        .spare_web_worker_process_count = spare_web_worker_process_count,
+        .web_content_memory_budget_in_mib = web_content_memory_budget_in_mib,
+        .freeze_background_tabs_after_seconds = freeze_background_tabs_after_seconds,
+        .max_frozen_background_tabs = max_frozen_background_tabs,
     };
 
     if (webdriver_content_ipc_path.has_value())
@@ -218,8 +256,99 @@ void Application::initialize(Main::Arguments const& arguments)
     if (m_browser_options.disable_sql_database == DisableSQLDatabase::No) {
         m_database = Database::create().release_value_but_fixme_should_propagate_errors();
         m_cookie_jar = CookieJar::create(*m_database).release_value_but_fixme_should_propagate_errors();
+        m_indexed_db_storage = IndexedDBStorage::create(*m_database).release_value_but_fixme_should_propagate_errors();
+        m_local_storage = LocalStorage::create(*m_database).release_value_but_fixme_should_propagate_errors();
+        m_storage_usage = StorageUsage::create(*m_database).release_value_but_fixme_should_propagate_errors();
     } else {
         m_cookie_jar = CookieJar::create();
+        m_indexed_db_storage = IndexedDBStorage::create();
+        m_local_storage = LocalStorage::create();
+        m_storage_usage = StorageUsage::create();
+    }
+
+    if (m_browser_options.web_content_memory_budget_in_mib.has_value()) {
+        m_memory_budget_timer = Core::Timer::create_repeating(memory_budget_check_interval_ms, [this]() {
+            enforce_web_content_memory_budget();
+        });
+        m_memory_budget_timer->start();
+    }
+}
+
+void Application::release_memory_in_all_processes()
+{
+    // Frozen background tabs can be restored from their session state, so there is no need to keep their processes around.
+    discard_frozen_background_tabs(0);
+
+    WebContentClient::for_each_client([](WebContentClient& client) {
+        client.async_release_memory();
+        return IterationDecision::Continue;
+    });
+
+    if (m_request_server_client)
+        m_request_server_client->async_release_memory();
+}
+
+void Application::enforce_web_content_memory_budget()
+{
+    auto budget = *m_browser_options.web_content_memory_budget_in_mib * MiB;
+    m_process_manager.update_all_process_statistics();
+
+    auto is_over_budget = [&](pid_t pid) {
+        return m_process_manager.memory_usage_of_process(pid).value_or(0) > budget;
+    };
+
+    // Rather than asking the processes of frozen background tabs to release memory, we discard them outright.
+    Vector<ViewImplementation*> views_to_discard;
+    ViewImplementation::for_each_view([&](ViewImplementation& view) {
+        if (view.can_be_discarded() && is_over_budget(view.web_content_pid()))
+            views_to_discard.append(&view);
+        return IterationDecision::Continue;
+    });
+    for (auto* view : views_to_discard)
+        view->discard({});
+
+    WebContentClient::for_each_client([&](WebContentClient& client) {
+        if (is_over_budget(client.pid()))
+            client.async_release_memory();
+        return IterationDecision::Continue;
+    });
+}
+
+void Application::discard_frozen_background_tabs_over_limit()
+{
+    if (auto max_frozen_background_tabs = m_browser_options.max_frozen_background_tabs; max_frozen_background_tabs.has_value())
+        discard_frozen_background_tabs(*max_frozen_background_tabs);
+}
+
+void Application::discard_frozen_background_tabs(size_t number_of_tabs_to_keep)
+{
+    Vector<ViewImplementation*> discardable_views;
+    ViewImplementation::for_each_view([&](ViewImplementation& view) {
+        if (view.can_be_discarded())
+            discardable_views.append(&view);
+        return IterationDecision::Continue;
+    });
+    if (discardable_views.size() <= number_of_tabs_to_keep)
+        return;
+
+    // Keep the most recently visible tabs around, as those are the ones the user is most likely to come back to.
+    quick_sort(discardable_views, [](auto const* a, auto const* b) {
+        return a->hidden_time() > b->hidden_time();
+    });
+    for (auto* view : discardable_views.span().slice(number_of_tabs_to_keep))
+        view->discard({});
+}
+
+void Application::evict_storage_if_needed(String const& storage_key_in_use)
+{
+    // NOTE: WebContent processes that still hold a copy of an evicted local storage map keep it until they exit. Evicted
+    //       storage keys are the least recently used ones, so they are unlikely to be in use by any document.
+    for (auto const& storage_key : m_storage_usage->storage_keys_to_evict(storage_key_in_use)) {
+        dbgln("Evicting the storage of {} to relieve storage pressure", storage_key);
+
+        m_indexed_db_storage->delete_databases(storage_key);
+        m_local_storage->delete_items(storage_key);
+        m_storage_usage->did_evict(storage_key);
     }
 }
 
@@ -235,8 +364,8 @@ static ErrorOr<NonnullRefPtr<WebContentClient>> create_web_content_client(Option
 
 ErrorOr<NonnullRefPtr<WebContentClient>> Application::launch_web_content_process(ViewImplementation& view)
 {
-    if (m_spare_web_content_process) {
-        auto web_content_client = m_spare_web_content_process.release_nonnull();
+    if (!m_spare_web_content_processes.is_empty()) {
+        auto web_content_client = m_spare_web_content_processes.take_first();
         launch_spare_web_content_process();
 
         web_content_client->assign_view({}, view);
@@ -258,8 +387,12 @@ void Application::launch_spare_web_content_process()
 
     if (m_has_queued_task_to_launch_spare_web_content_process)
         return;
+    if (m_spare_web_content_processes.size() >= browser_options().spare_web_content_process_count)
+        return;
     m_has_queued_task_to_launch_spare_web_content_process = true;
 
+    // Spares are launched one per event loop iteration, so that refilling the pool after a burst of new tabs or
+    // site-isolated iframes doesn't block the UI for several process launches at once.
     Core::deferred_invoke([this]() {
         m_has_queued_task_to_launch_spare_web_content_process = false;
 
@@ -269,10 +402,55 @@ void Application::launch_spare_web_content_process()
             return;
         }
 
-        m_spare_web_content_process = web_content_client.release_value();
+        m_spare_web_content_processes.append(web_content_client.release_value());
 
-        if (auto process = find_process(m_spare_web_content_process->pid()); process.has_value())
+        if (auto process = find_process(m_spare_web_content_processes.last()->pid()); process.has_value())
             process->set_title("(spare)"_string);
+
+        launch_spare_web_content_process();
+    });
+}
+
+ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> Application::launch_web_worker_process(Web::Bindings::AgentType type)
+{
+    if (type != Web::Bindings::AgentType::DedicatedWorker)
+        return WebView::launch_web_worker_process(type);
+
+    if (!m_spare_web_worker_processes.is_empty()) {
+        auto web_worker_client = m_spare_web_worker_processes.take_first();
+        launch_spare_web_worker_process();
+        return web_worker_client;
+    }
+
+    launch_spare_web_worker_process();
+    return WebView::launch_web_worker_process(type);
+}
+
+void Application::launch_spare_web_worker_process()
+{
+    if (browser_options().debug_helper_process == ProcessType::WebWorker)
+        return;
+    if (browser_options().profile_helper_process == ProcessType::WebWorker)
+        return;
+
+    if (m_has_queued_task_to_launch_spare_web_worker_process)
+        return;
+    if (m_spare_web_worker_processes.size() >= browser_options().spare_web_worker_process_count)
+        return;
+    m_has_queued_task_to_launch_spare_web_worker_process = true;
+
+    Core::deferred_invoke([this]() {
+        m_has_queued_task_to_launch_spare_web_worker_process = false;
+
+        auto web_worker_client = WebView::launch_web_worker_process(Web::Bindings::AgentType::DedicatedWorker);
+        if (web_worker_client.is_error()) {
+            dbgln("Unable to create spare web worker client: {}", web_worker_client.error());
+            return;
+        }
+
+        m_spare_web_worker_processes.append(web_worker_client.release_value());
+
+        launch_spare_web_worker_process();
     });
 }
 
@@ -740,4 +918,26 @@ void Application::request_console_messages(DevTools::TabDescription const& descr
     view->js_console_request_messages(start_index);
 }
 
+void Application::start_javascript_profiler(DevTools::TabDescription const& description) const
+{
+    if (auto view = ViewImplementation::find_view_by_id(description.id); view.has_value())
+        view->start_js_profiler();
+}
+
+void Application::stop_javascript_profiler(DevTools::TabDescription const& description, OnJavaScriptProfileReceived on_complete) const
+{
+    auto view = ViewImplementation::find_view_by_id(description.id);
+    if (!view.has_value()) {
+        on_complete(Error::from_string_literal("Unable to locate tab"));
+        return;
+    }
+
+    view->on_received_js_profile = [&view = *view, on_complete = move(on_complete)](JsonValue profile) {
+        view.on_received_js_profile = nullptr;
+        on_complete(move(profile));
+    };
+
+    view->stop_js_profiler();
+}
+
 }
@@ -24,6 +24,18 @@
 #include <LibWebView/ProcessManager.h>
 #include <LibWebView/Settings.h>
 
+namespace Web::Bindings {
+
+enum class AgentType : u8;
+
+}
+
+namespace Web::HTML {
+
+class WebWorkerClient;
+
+}
+
 namespace WebView {
 
 struct ApplicationSettingsObserver;
@@ -47,12 +59,20 @@ public:
     static ImageDecoderClient::Client& image_decoder_client() { return *the().m_image_decoder_client; }
 
     static CookieJar& cookie_jar() { return *the().m_cookie_jar; }
+    static IndexedDBStorage& indexed_db_storage() { return *the().m_indexed_db_storage; }
+    static LocalStorage& local_storage() { return *the().m_local_storage; }
+    static StorageUsage& storage_usage() { return *the().m_storage_usage; }
+
+    void evict_storage_if_needed(String const& storage_key_in_use);
+
+    void discard_frozen_background_tabs_over_limit();
 
     static ProcessManager& process_manager() { return the().m_process_manager; }
 
     Core::EventLoop& event_loop() { return m_event_loop; }
 
     ErrorOr<NonnullRefPtr<WebContentClient>> launch_web_content_process(ViewImplementation&);
+    ErrorOr<NonnullRefPtr<Web::HTML::WebWorkerClient>> launch_web_worker_process(Web::Bindings::AgentType);
     ErrorOr<void> launch_services();
 
     void add_child_process(Process&&);
@@ -95,6 +115,11 @@ private:
     void initialize(Main::Arguments const& arguments);
 
     void launch_spare_web_content_process();
+    void launch_spare_web_worker_process();
+
+    void release_memory_in_all_processes();
+    void enforce_web_content_memory_budget();
+    void discard_frozen_background_tabs(size_t number_of_tabs_to_keep);
     ErrorOr<void> launch_request_server();
     ErrorOr<void> launch_image_decoder_server();
     ErrorOr<void> launch_devtools_server();
@@ -129,6 +154,8 @@ private:
     virtual void listen_for_console_messages(DevTools::TabDescription const&, OnConsoleMessageAvailable, OnReceivedConsoleMessages) const override;
     virtual void stop_listening_for_console_messages(DevTools::TabDescription const&) const override;
     virtual void request_console_messages(DevTools::TabDescription const&, i32) const override;
+    virtual void start_javascript_profiler(DevTools::TabDescription const&) const override;
+    virtual void stop_javascript_profiler(DevTools::TabDescription const&, OnJavaScriptProfileReceived) const override;
 
     static Application* s_the;
 
@@ -141,16 +168,27 @@ private:
     RefPtr<Requests::RequestClient> m_request_server_client;
     RefPtr<ImageDecoderClient::Client> m_image_decoder_client;
 
-    RefPtr<WebContentClient> m_spare_web_content_process;
+    Vector<NonnullRefPtr<WebContentClient>> m_spare_web_content_processes;
     bool m_has_queued_task_to_launch_spare_web_content_process { false };
 
+    // Spare dedicated worker processes are only launched once a page has created its first dedicated worker, as most
+    // pages never do. Pages that create one are likely to create more, e.g. to fill a worker pool.
+    Vector<NonnullRefPtr<Web::HTML::WebWorkerClient>> m_spare_web_worker_processes;
+    bool m_has_queued_task_to_launch_spare_web_worker_process { false };
+
     RefPtr<Database> m_database;
     OwnPtr<CookieJar> m_cookie_jar;
+    OwnPtr<IndexedDBStorage> m_indexed_db_storage;
+    OwnPtr<LocalStorage> m_local_storage;
+    OwnPtr<StorageUsage> m_storage_usage;
 
     OwnPtr<Core::TimeZoneWatcher> m_time_zone_watcher;
 
     Core::EventLoop m_event_loop;
     ProcessManager m_process_manager;
+
+    OwnPtr<Core::MemoryPressureWatcher> m_memory_pressure_watcher;
+    RefPtr<Core::Timer> m_memory_budget_timer;
     bool m_in_shutdown { false };
 
     OwnPtr<DevTools::DevToolsServer> m_devtools;
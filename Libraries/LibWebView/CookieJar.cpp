@@ -42,6 +42,8 @@ ErrorOr<NonnullOwnPtr<CookieJar>> CookieJar::create(Database& database)
         to_underlying(Web::Cookie::SameSite::Lax)))));
     database.execute_statement(create_table, {});
 
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
     statements.insert_cookie = TRY(database.prepare_statement("INSERT OR REPLACE INTO Cookies VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);"sv));
     statements.expire_cookie = TRY(database.prepare_statement("DELETE FROM Cookies WHERE (expiry_time < ?);"sv));
     statements.select_all_cookies = TRY(database.prepare_statement("SELECT * FROM Cookies;"sv));
@@ -67,11 +69,20 @@ CookieJar::CookieJar(Optional<PersistedStorage> persisted_storage)
     m_persisted_storage->synchronization_timer = Core::Timer::create_repeating(
         static_cast<int>(DATABASE_SYNCHRONIZATION_TIMER.to_milliseconds()),
         [this]() {
+            auto& database = m_persisted_storage->database;
+            auto const& statements = m_persisted_storage->statements;
+
+            // Pages may set cookies constantly, so all of the changes since the last synchronization are written in a
+            // single SQL transaction.
+            database.execute_statement(statements.begin_transaction, {});
+
             for (auto const& it : m_transient_storage.take_dirty_cookies())
                 m_persisted_storage->insert_cookie(it.value);
 
             auto now = m_transient_storage.purge_expired_cookies();
-            m_persisted_storage->database.execute_statement(m_persisted_storage->statements.expire_cookie, {}, now);
+            database.execute_statement(statements.expire_cookie, {}, now);
+
+            database.execute_statement(statements.commit_transaction, {});
         });
     m_persisted_storage->synchronization_timer->start();
 }
@@ -94,6 +105,18 @@ String CookieJar::get_cookie(const URL::URL& url, Web::Cookie::Source source)
     if (!domain.has_value())
         return {};
 
+    if (m_cookie_string_cache_version != m_transient_storage.version()) {
+        m_cookie_string_cache.clear();
+        m_cookie_string_cache_version = m_transient_storage.version();
+    }
+
+    // NOTE: The cookies that match a retrieval only depend on its URI's scheme, host, and path, and on its type. Unless the
+    //       cookie store changes in between, the same cookie-string may thus be returned for every retrieval of a page's
+    //       subresources and every read of document.cookie.
+    auto cache_key = MUST(String::formatted("{}:{}:{}:{}", to_underlying(source), url.scheme(), *domain, url.serialize_path()));
+    if (auto cookie_string = m_cookie_string_cache.get(cache_key); cookie_string.has_value())
+        return *cookie_string;
+
     auto cookie_list = get_matching_cookies(url, domain.value(), source);
 
     // 4. Serialize the cookie-list into a cookie-string by processing each cookie in the cookie-list in order:
@@ -114,7 +137,14 @@ String CookieJar::get_cookie(const URL::URL& url, Web::Cookie::Source source)
         // 3. If there is an unprocessed cookie in the cookie-list, output the characters %x3B and %x20 ("; ").
     }
 
-    return MUST(builder.to_string());
+    auto cookie_string = MUST(builder.to_string());
+
+    // Matching the cookies may have purged expired cookies, in which case the cookie-string must not be cached for the
+    // previous version of the cookie store.
+    if (m_cookie_string_cache_version == m_transient_storage.version())
+        m_cookie_string_cache.set(move(cache_key), cookie_string);
+
+    return cookie_string;
 }
 
 void CookieJar::set_cookie(const URL::URL& url, Web::Cookie::ParsedCookie const& parsed_cookie, Web::Cookie::Source source)
@@ -538,7 +568,7 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
     // 1. Let cookie-list be the set of cookies from the cookie store that meets all of the following requirements:
     Vector<Web::Cookie::Cookie> cookie_list;
 
-    m_transient_storage.for_each_cookie([&](Web::Cookie::Cookie& cookie) {
+    m_transient_storage.for_each_cookie_in_domain(canonicalized_domain, [&](Web::Cookie::Cookie& cookie) {
         // * Either:
         //     The cookie's host-only-flag is true and the canonicalized host of the retrieval's URI is identical to
         //     the cookie's domain.
@@ -612,13 +642,22 @@ Vector<Web::Cookie::Cookie> CookieJar::get_matching_cookies(const URL::URL& url,
 void CookieJar::TransientStorage::set_cookies(Cookies cookies)
 {
     m_cookies = move(cookies);
+
+    m_cookie_keys_by_domain.clear();
+    for (auto const& [key, cookie] : m_cookies)
+        m_cookie_keys_by_domain.ensure(key.domain).set(key);
+
+    ++m_version;
     purge_expired_cookies();
 }
 
 void CookieJar::TransientStorage::set_cookie(CookieStorageKey key, Web::Cookie::Cookie cookie)
 {
-    m_cookies.set(key, cookie);
+    if (m_cookies.set(key, cookie) == HashSetResult::InsertedNewEntry)
+        m_cookie_keys_by_domain.ensure(key.domain).set(key);
+
     m_dirty_cookies.set(move(key), move(cookie));
+    ++m_version;
 }
 
 Optional<Web::Cookie::Cookie const&> CookieJar::TransientStorage::get_cookie(CookieStorageKey const& key)
@@ -636,12 +675,29 @@ UnixDateTime CookieJar::TransientStorage::purge_expired_cookies(Optional<AK::Dur
             cookie.value.expiry_time -= *offset;
     }
 
-    auto is_expired = [&](auto const&, auto const& cookie) { return cookie.expiry_time < now; };
-    m_cookies.remove_all_matching(is_expired);
-
+    remove_expired_cookies(now);
     return now;
 }
 
+void CookieJar::TransientStorage::remove_expired_cookies(UnixDateTime now)
+{
+    auto did_remove_cookies = m_cookies.remove_all_matching([&](auto const& key, auto const& cookie) {
+        if (cookie.expiry_time >= now)
+            return false;
+
+        if (auto keys = m_cookie_keys_by_domain.find(key.domain); keys != m_cookie_keys_by_domain.end()) {
+            keys->value.remove(key);
+            if (keys->value.is_empty())
+                m_cookie_keys_by_domain.remove(keys);
+        }
+
+        return true;
+    });
+
+    if (did_remove_cookies)
+        ++m_version;
+}
+
 void CookieJar::TransientStorage::expire_and_purge_all_cookies()
 {
     for (auto& [key, value] : m_cookies) {
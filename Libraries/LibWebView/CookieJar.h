@@ -8,6 +8,7 @@
 
 #include <AK/Function.h>
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/Optional.h>
 #include <AK/String.h>
 #include <AK/StringView.h>
@@ -32,6 +33,8 @@ struct CookieStorageKey {
 
 class CookieJar {
     struct Statements {
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
         Database::StatementID insert_cookie { 0 };
         Database::StatementID expire_cookie { 0 };
         Database::StatementID select_all_cookies { 0 };
@@ -52,6 +55,9 @@ class CookieJar {
 
         auto take_dirty_cookies() { return move(m_dirty_cookies); }
 
+        // Incremented whenever a cookie is added, changed, or removed.
+        u64 version() const { return m_version; }
+
         template<typename Callback>
         void for_each_cookie(Callback callback)
         {
@@ -68,9 +74,31 @@ class CookieJar {
             }
         }
 
+        // Invokes the callback for every cookie whose domain is the given domain, or one of its parent domains. These
+        // are the only cookies that may domain-match the domain.
+        template<typename Callback>
+        void for_each_cookie_in_domain(StringView canonicalized_domain, Callback callback)
+        {
+            for (auto domain = canonicalized_domain; !domain.is_empty();) {
+                if (auto keys = m_cookie_keys_by_domain.get(domain); keys.has_value()) {
+                    for (auto const& key : *keys)
+                        callback(m_cookies.find(key)->value);
+                }
+
+                auto separator = domain.find('.');
+                if (!separator.has_value())
+                    break;
+                domain = domain.substring_view(*separator + 1);
+            }
+        }
+
     private:
+        void remove_expired_cookies(UnixDateTime now);
+
         Cookies m_cookies;
         Cookies m_dirty_cookies;
+        HashMap<String, HashTable<CookieStorageKey>> m_cookie_keys_by_domain;
+        u64 m_version { 0 };
     };
 
     struct PersistedStorage {
@@ -117,6 +145,11 @@ private:
 
     Optional<PersistedStorage> m_persisted_storage;
     TransientStorage m_transient_storage;
+
+    // The serialized cookie-strings that were last returned for a retrieval's URI and type. These are only valid while
+    // the cookie store is at the given version.
+    HashMap<String, String> m_cookie_string_cache;
+    u64 m_cookie_string_cache_version { 0 };
 };
 
 }
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/ByteBuffer.h>
 #include <AK/ByteString.h>
 #include <AK/String.h>
 #include <AK/Time.h>
@@ -50,6 +51,11 @@ ErrorOr<NonnullRefPtr<Database>> Database::create()
     sqlite3* m_database { nullptr };
     SQL_TRY(sqlite3_open(database_file.characters(), &m_database));
 
+    // Use write-ahead logging, so that every commit only appends to the log rather than rewriting pages of the database
+    // in place, and so that reads are not blocked by writes.
+    SQL_TRY(sqlite3_exec(m_database, "PRAGMA journal_mode = WAL;", nullptr, nullptr, nullptr));
+    SQL_TRY(sqlite3_exec(m_database, "PRAGMA synchronous = NORMAL;", nullptr, nullptr, nullptr));
+
     return adopt_nonnull_ref_or_enomem(new (nothrow) Database(m_database));
 }
 
@@ -114,15 +120,21 @@ void Database::apply_placeholder(StatementID statement_id, int index, ValueType
         SQL_MUST(sqlite3_bind_int64(statement, index, value.offset_to_epoch().to_milliseconds()));
     } else if constexpr (IsSame<ValueType, int>) {
         SQL_MUST(sqlite3_bind_int(statement, index, value));
+    } else if constexpr (IsSame<ValueType, u64>) {
+        SQL_MUST(sqlite3_bind_int64(statement, index, static_cast<sqlite3_int64>(value)));
     } else if constexpr (IsSame<ValueType, bool>) {
         SQL_MUST(sqlite3_bind_int(statement, index, static_cast<int>(value)));
+    } else if constexpr (IsSame<ValueType, ByteBuffer>) {
+        SQL_MUST(sqlite3_bind_blob64(statement, index, value.data(), value.size(), SQLITE_TRANSIENT));
     }
 }
 
 template void Database::apply_placeholder(StatementID, int, String const&);
 template void Database::apply_placeholder(StatementID, int, UnixDateTime const&);
 template void Database::apply_placeholder(StatementID, int, int const&);
+template void Database::apply_placeholder(StatementID, int, u64 const&);
 template void Database::apply_placeholder(StatementID, int, bool const&);
+template void Database::apply_placeholder(StatementID, int, ByteBuffer const&);
 
 template<typename ValueType>
 ValueType Database::result_column(StatementID statement_id, int column)
@@ -137,8 +149,14 @@ ValueType Database::result_column(StatementID statement_id, int column)
         return UnixDateTime::from_milliseconds_since_epoch(milliseconds);
     } else if constexpr (IsSame<ValueType, int>) {
         return sqlite3_column_int(statement, column);
+    } else if constexpr (IsSame<ValueType, u64>) {
+        return static_cast<u64>(sqlite3_column_int64(statement, column));
     } else if constexpr (IsSame<ValueType, bool>) {
         return static_cast<bool>(sqlite3_column_int(statement, column));
+    } else if constexpr (IsSame<ValueType, ByteBuffer>) {
+        auto const* blob = static_cast<u8 const*>(sqlite3_column_blob(statement, column));
+        auto size = static_cast<size_t>(sqlite3_column_bytes(statement, column));
+        return MUST(ByteBuffer::copy(blob, size));
     }
 
     VERIFY_NOT_REACHED();
@@ -147,6 +165,8 @@ ValueType Database::result_column(StatementID statement_id, int column)
 template String Database::result_column(StatementID, int);
 template UnixDateTime Database::result_column(StatementID, int);
 template int Database::result_column(StatementID, int);
+template u64 Database::result_column(StatementID, int);
 template bool Database::result_column(StatementID, int);
+template ByteBuffer Database::result_column(StatementID, int);
 
 }
@@ -411,9 +411,8 @@ bool EventLoopImplementationMacOS::was_exit_requested() const
 
 void EventLoopImplementationMacOS::post_event(Core::EventReceiver& receiver, NonnullOwnPtr<Core::Event>&& event)
 {
-    m_thread_event_queue.post_event(receiver, move(event));
-
-    if (&m_thread_event_queue != &Core::ThreadEventQueue::current())
+    bool needs_wake = m_thread_event_queue.post_event(receiver, move(event));
+    if (needs_wake && &m_thread_event_queue != &Core::ThreadEventQueue::current())
         wake();
 }
 
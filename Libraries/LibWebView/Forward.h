@@ -14,9 +14,12 @@ class Application;
 class Autocomplete;
 class CookieJar;
 class Database;
+class IndexedDBStorage;
+class LocalStorage;
 class OutOfProcessWebView;
 class ProcessManager;
 class Settings;
+class StorageUsage;
 class ViewImplementation;
 class WebContentClient;
 class WebUI;
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWebView/IndexedDBStorage.h>
+
+namespace WebView {
+
+ErrorOr<NonnullOwnPtr<IndexedDBStorage>> IndexedDBStorage::create(Database& database)
+{
+    Statements statements {};
+
+    auto create_databases_table = TRY(database.prepare_statement(R"#(
+        CREATE TABLE IF NOT EXISTS IndexedDBDatabases (
+            storage_key TEXT,
+            name TEXT,
+            schema BLOB,
+            PRIMARY KEY(storage_key, name)
+        );)#"sv));
+    database.execute_statement(create_databases_table, {});
+
+    auto create_object_stores_table = TRY(database.prepare_statement(R"#(
+        CREATE TABLE IF NOT EXISTS IndexedDBObjectStores (
+            storage_key TEXT,
+            database_name TEXT,
+            name TEXT,
+            records BLOB,
+            PRIMARY KEY(storage_key, database_name, name)
+        );)#"sv));
+    database.execute_statement(create_object_stores_table, {});
+
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
+    statements.select_database = TRY(database.prepare_statement("SELECT schema FROM IndexedDBDatabases WHERE storage_key = ? AND name = ?;"sv));
+    statements.insert_database = TRY(database.prepare_statement("INSERT OR REPLACE INTO IndexedDBDatabases VALUES (?, ?, ?);"sv));
+    statements.delete_database = TRY(database.prepare_statement("DELETE FROM IndexedDBDatabases WHERE storage_key = ? AND name = ?;"sv));
+    statements.select_object_stores = TRY(database.prepare_statement("SELECT name, records FROM IndexedDBObjectStores WHERE storage_key = ? AND database_name = ?;"sv));
+    statements.select_object_store_names = TRY(database.prepare_statement("SELECT name FROM IndexedDBObjectStores WHERE storage_key = ? AND database_name = ?;"sv));
+    statements.insert_object_store = TRY(database.prepare_statement("INSERT OR REPLACE INTO IndexedDBObjectStores VALUES (?, ?, ?, ?);"sv));
+    statements.delete_object_store = TRY(database.prepare_statement("DELETE FROM IndexedDBObjectStores WHERE storage_key = ? AND database_name = ? AND name = ?;"sv));
+    statements.delete_object_stores = TRY(database.prepare_statement("DELETE FROM IndexedDBObjectStores WHERE storage_key = ? AND database_name = ?;"sv));
+    statements.select_database_size = TRY(database.prepare_statement("SELECT LENGTH(schema) FROM IndexedDBDatabases WHERE storage_key = ? AND name = ?;"sv));
+    statements.select_object_store_sizes = TRY(database.prepare_statement("SELECT name, LENGTH(records) FROM IndexedDBObjectStores WHERE storage_key = ? AND database_name = ?;"sv));
+    statements.delete_databases_of_storage_key = TRY(database.prepare_statement("DELETE FROM IndexedDBDatabases WHERE storage_key = ?;"sv));
+    statements.delete_object_stores_of_storage_key = TRY(database.prepare_statement("DELETE FROM IndexedDBObjectStores WHERE storage_key = ?;"sv));
+
+    return adopt_own(*new IndexedDBStorage { PersistedStorage { database, statements } });
+}
+
+NonnullOwnPtr<IndexedDBStorage> IndexedDBStorage::create()
+{
+    return adopt_own(*new IndexedDBStorage { OptionalNone {} });
+}
+
+IndexedDBStorage::IndexedDBStorage(Optional<PersistedStorage> persisted_storage)
+    : m_persisted_storage(move(persisted_storage))
+{
+}
+
+IndexedDBStorage::~IndexedDBStorage() = default;
+
+Optional<IndexedDBStorage::StoredDatabase> IndexedDBStorage::get_database(String const& storage_key, String const& name)
+{
+    if (!m_persisted_storage.has_value()) {
+        auto databases = m_transient_storage.get(storage_key);
+        if (!databases.has_value())
+            return {};
+
+        return databases->get(name).copy();
+    }
+
+    auto& database = m_persisted_storage->database;
+    auto const& statements = m_persisted_storage->statements;
+
+    Optional<StoredDatabase> stored_database;
+
+    database.execute_statement(
+        statements.select_database,
+        [&](auto statement_id) {
+            stored_database = StoredDatabase { database.result_column<ByteBuffer>(statement_id, 0), {} };
+        },
+        storage_key, name);
+
+    if (!stored_database.has_value())
+        return {};
+
+    database.execute_statement(
+        statements.select_object_stores,
+        [&](auto statement_id) {
+            auto object_store_name = database.result_column<String>(statement_id, 0);
+            auto records = database.result_column<ByteBuffer>(statement_id, 1);
+
+            stored_database->object_store_records.set(move(object_store_name), move(records));
+        },
+        storage_key, name);
+
+    return stored_database;
+}
+
+void IndexedDBStorage::update_database(String const& storage_key, String const& name, ByteBuffer schema, HashMap<String, ByteBuffer> object_store_records, Vector<String> const& object_store_names)
+{
+    if (!m_persisted_storage.has_value()) {
+        auto& stored_database = m_transient_storage.ensure(storage_key).ensure(name);
+        stored_database.schema = move(schema);
+
+        stored_database.object_store_records.remove_all_matching([&](auto const& object_store_name, auto const&) {
+            return !object_store_names.contains_slow(object_store_name);
+        });
+        for (auto& it : object_store_records)
+            stored_database.object_store_records.set(it.key, move(it.value));
+
+        return;
+    }
+
+    auto& database = m_persisted_storage->database;
+    auto const& statements = m_persisted_storage->statements;
+
+    // Every transaction of the database is written in a single SQL transaction, so that a crash never leaves behind a
+    // mix of old and new object stores.
+    database.execute_statement(statements.begin_transaction, {});
+
+    database.execute_statement(statements.insert_database, {}, storage_key, name, schema);
+
+    Vector<String> deleted_object_store_names;
+    database.execute_statement(
+        statements.select_object_store_names,
+        [&](auto statement_id) {
+            auto object_store_name = database.result_column<String>(statement_id, 0);
+            if (!object_store_names.contains_slow(object_store_name))
+                deleted_object_store_names.append(move(object_store_name));
+        },
+        storage_key, name);
+
+    for (auto const& object_store_name : deleted_object_store_names)
+        database.execute_statement(statements.delete_object_store, {}, storage_key, name, object_store_name);
+
+    for (auto const& [object_store_name, records] : object_store_records)
+        database.execute_statement(statements.insert_object_store, {}, storage_key, name, object_store_name, records);
+
+    database.execute_statement(statements.commit_transaction, {});
+}
+
+void IndexedDBStorage::delete_database(String const& storage_key, String const& name)
+{
+    if (!m_persisted_storage.has_value()) {
+        if (auto databases = m_transient_storage.get(storage_key); databases.has_value())
+            databases->remove(name);
+        return;
+    }
+
+    auto& database = m_persisted_storage->database;
+    auto const& statements = m_persisted_storage->statements;
+
+    database.execute_statement(statements.begin_transaction, {});
+    database.execute_statement(statements.delete_object_stores, {}, storage_key, name);
+    database.execute_statement(statements.delete_database, {}, storage_key, name);
+    database.execute_statement(statements.commit_transaction, {});
+}
+
+void IndexedDBStorage::delete_databases(String const& storage_key)
+{
+    if (!m_persisted_storage.has_value()) {
+        m_transient_storage.remove(storage_key);
+        return;
+    }
+
+    auto& database = m_persisted_storage->database;
+    auto const& statements = m_persisted_storage->statements;
+
+    database.execute_statement(statements.begin_transaction, {});
+    database.execute_statement(statements.delete_object_stores_of_storage_key, {}, storage_key);
+    database.execute_statement(statements.delete_databases_of_storage_key, {}, storage_key);
+    database.execute_statement(statements.commit_transaction, {});
+}
+
+// Returns the size of the schema of the database, and of the records of each of its object stores. The records are never
+// read, as SQLite knows the length of a BLOB without reading it.
+Optional<u64> IndexedDBStorage::stored_sizes(String const& storage_key, String const& name, HashMap<String, u64>& object_store_sizes)
+{
+    if (!m_persisted_storage.has_value()) {
+        auto databases = m_transient_storage.get(storage_key);
+        if (!databases.has_value())
+            return {};
+
+        auto stored_database = databases->get(name);
+        if (!stored_database.has_value())
+            return {};
+
+        for (auto const& [object_store_name, records] : stored_database->object_store_records)
+            object_store_sizes.set(object_store_name, records.size());
+        return stored_database->schema.size();
+    }
+
+    auto& database = m_persisted_storage->database;
+    auto const& statements = m_persisted_storage->statements;
+
+    Optional<u64> schema_size;
+
+    database.execute_statement(
+        statements.select_database_size,
+        [&](auto statement_id) {
+            schema_size = database.result_column<u64>(statement_id, 0);
+        },
+        storage_key, name);
+
+    if (!schema_size.has_value())
+        return {};
+
+    database.execute_statement(
+        statements.select_object_store_sizes,
+        [&](auto statement_id) {
+            auto object_store_name = database.result_column<String>(statement_id, 0);
+            auto size = database.result_column<u64>(statement_id, 1);
+
+            object_store_sizes.set(move(object_store_name), size);
+        },
+        storage_key, name);
+
+    return schema_size;
+}
+
+u64 IndexedDBStorage::database_size(String const& storage_key, String const& name)
+{
+    HashMap<String, u64> object_store_sizes;
+
+    auto size = stored_sizes(storage_key, name, object_store_sizes).value_or(0);
+    for (auto const& it : object_store_sizes)
+        size += it.value;
+
+    return size;
+}
+
+i64 IndexedDBStorage::size_change_of_update(String const& storage_key, String const& name, ByteBuffer const& schema, HashMap<String, ByteBuffer> const& object_store_records, Vector<String> const& object_store_names)
+{
+    HashMap<String, u64> object_store_sizes;
+
+    auto size_change = static_cast<i64>(schema.size()) - static_cast<i64>(stored_sizes(storage_key, name, object_store_sizes).value_or(0));
+
+    // Object stores that are no longer part of the database are deleted, and those with new records are replaced.
+    for (auto const& [object_store_name, size] : object_store_sizes) {
+        if (!object_store_names.contains_slow(object_store_name) || object_store_records.contains(object_store_name))
+            size_change -= static_cast<i64>(size);
+    }
+    for (auto const& records : object_store_records)
+        size_change += static_cast<i64>(records.value.size());
+
+    return size_change;
+}
+
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteBuffer.h>
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibWebView/Database.h>
+#include <LibWebView/Forward.h>
+
+namespace WebView {
+
+// Stores the IndexedDB databases of every WebContent process, keyed by their storage key and name. Each database is
+// stored as its schema plus the records of each of its object stores, so that a transaction only has to rewrite the
+// object stores in its scope, and so that only the databases that are actually opened are ever read back.
+class IndexedDBStorage {
+    AK_MAKE_NONCOPYABLE(IndexedDBStorage);
+    AK_MAKE_NONMOVABLE(IndexedDBStorage);
+
+    struct Statements {
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
+        Database::StatementID select_database { 0 };
+        Database::StatementID insert_database { 0 };
+        Database::StatementID delete_database { 0 };
+        Database::StatementID select_object_stores { 0 };
+        Database::StatementID select_object_store_names { 0 };
+        Database::StatementID insert_object_store { 0 };
+        Database::StatementID delete_object_store { 0 };
+        Database::StatementID delete_object_stores { 0 };
+        Database::StatementID select_database_size { 0 };
+        Database::StatementID select_object_store_sizes { 0 };
+        Database::StatementID delete_databases_of_storage_key { 0 };
+        Database::StatementID delete_object_stores_of_storage_key { 0 };
+    };
+
+    struct PersistedStorage {
+        Database& database;
+        Statements statements;
+    };
+
+    struct StoredDatabase {
+        ByteBuffer schema;
+        HashMap<String, ByteBuffer> object_store_records;
+    };
+
+public:
+    static ErrorOr<NonnullOwnPtr<IndexedDBStorage>> create(Database&);
+    static NonnullOwnPtr<IndexedDBStorage> create();
+
+    ~IndexedDBStorage();
+
+    Optional<StoredDatabase> get_database(String const& storage_key, String const& name);
+    void update_database(String const& storage_key, String const& name, ByteBuffer schema, HashMap<String, ByteBuffer> object_store_records, Vector<String> const& object_store_names);
+    void delete_database(String const& storage_key, String const& name);
+    void delete_databases(String const& storage_key);
+
+    // The number of bytes the database takes up, and the number of bytes it would grow by (or shrink by, if negative)
+    // if it were updated with the given schema and object store records.
+    u64 database_size(String const& storage_key, String const& name);
+    i64 size_change_of_update(String const& storage_key, String const& name, ByteBuffer const& schema, HashMap<String, ByteBuffer> const& object_store_records, Vector<String> const& object_store_names);
+
+private:
+    explicit IndexedDBStorage(Optional<PersistedStorage>);
+
+    Optional<u64> stored_sizes(String const& storage_key, String const& name, HashMap<String, u64>& object_store_sizes);
+
+    Optional<PersistedStorage> m_persisted_storage;
+
+    // Without a SQL database, databases only live as long as the browser process.
+    HashMap<String, HashMap<String, StoredDatabase>> m_transient_storage;
+};
+
+}
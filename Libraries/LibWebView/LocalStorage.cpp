@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWebView/LocalStorage.h>
+
+namespace WebView {
+
+ErrorOr<NonnullOwnPtr<LocalStorage>> LocalStorage::create(Database& database)
+{
+    Statements statements {};
+
+    auto create_table = TRY(database.prepare_statement(R"#(
+        CREATE TABLE IF NOT EXISTS LocalStorage (
+            storage_key TEXT,
+            key TEXT,
+            value TEXT,
+            PRIMARY KEY(storage_key, key)
+        );)#"sv));
+    database.execute_statement(create_table, {});
+
+    statements.begin_transaction = TRY(database.prepare_statement("BEGIN TRANSACTION;"sv));
+    statements.commit_transaction = TRY(database.prepare_statement("COMMIT;"sv));
+    statements.select_items = TRY(database.prepare_statement("SELECT key, value FROM LocalStorage WHERE storage_key = ? ORDER BY rowid;"sv));
+    statements.insert_item = TRY(database.prepare_statement("INSERT OR REPLACE INTO LocalStorage VALUES (?, ?, ?);"sv));
+    statements.delete_item = TRY(database.prepare_statement("DELETE FROM LocalStorage WHERE storage_key = ? AND key = ?;"sv));
+    statements.delete_items = TRY(database.prepare_statement("DELETE FROM LocalStorage WHERE storage_key = ?;"sv));
+
+    return adopt_own(*new LocalStorage { PersistedStorage { database, statements } });
+}
+
+NonnullOwnPtr<LocalStorage> LocalStorage::create()
+{
+    return adopt_own(*new LocalStorage { OptionalNone {} });
+}
+
+LocalStorage::LocalStorage(Optional<PersistedStorage> persisted_storage)
+    : m_persisted_storage(move(persisted_storage))
+{
+}
+
+LocalStorage::~LocalStorage() = default;
+
+OrderedHashMap<String, String> LocalStorage::get_items(String const& storage_key)
+{
+    if (!m_persisted_storage.has_value()) {
+        if (auto items = m_transient_storage.get(storage_key); items.has_value())
+            return *items;
+        return {};
+    }
+
+    auto& database = m_persisted_storage->database;
+    auto const& statements = m_persisted_storage->statements;
+
+    OrderedHashMap<String, String> items;
+
+    database.execute_statement(
+        statements.select_items,
+        [&](auto statement_id) {
+            auto key = database.result_column<String>(statement_id, 0);
+            auto value = database.result_column<String>(statement_id, 1);
+
+            items.set(move(key), move(value));
+        },
+        storage_key);
+
+    return items;
+}
+
+void LocalStorage::apply_changes(String const& storage_key, ReadonlySpan<Web::StorageAPI::StorageChange> changes)
+{
+    if (!m_persisted_storage.has_value()) {
+        auto& items = m_transient_storage.ensure(storage_key);
+
+        for (auto const& change : changes) {
+            if (!change.key.has_value())
+                items.clear();
+            else if (!change.new_value.has_value())
+                items.remove(*change.key);
+            else
+                items.set(*change.key, *change.new_value);
+        }
+
+        return;
+    }
+
+    auto& database = m_persisted_storage->database;
+    auto const& statements = m_persisted_storage->statements;
+
+    // A batch of changes is written in a single SQL transaction, so that it costs a single write to the log.
+    database.execute_statement(statements.begin_transaction, {});
+
+    for (auto const& change : changes) {
+        if (!change.key.has_value())
+            database.execute_statement(statements.delete_items, {}, storage_key);
+        else if (!change.new_value.has_value())
+            database.execute_statement(statements.delete_item, {}, storage_key, *change.key);
+        else
+            database.execute_statement(statements.insert_item, {}, storage_key, *change.key, *change.new_value);
+    }
+
+    database.execute_statement(statements.commit_transaction, {});
+}
+
+void LocalStorage::delete_items(String const& storage_key)
+{
+    if (!m_persisted_storage.has_value()) {
+        m_transient_storage.remove(storage_key);
+        return;
+    }
+
+    auto& database = m_persisted_storage->database;
+    auto const& statements = m_persisted_storage->statements;
+
+    database.execute_statement(statements.delete_items, {}, storage_key);
+}
+
+}
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <LibWeb/StorageAPI/StorageChange.h>
+#include <LibWebView/Database.h>
+#include <LibWebView/Forward.h>
+
+namespace WebView {
+
+// Stores the localStorage maps of every WebContent process, keyed by their storage key. A WebContent process reads the
+// map of a storage key when a document first uses localStorage, and sends back the changes it makes in batches.
+class LocalStorage {
+    AK_MAKE_NONCOPYABLE(LocalStorage);
+    AK_MAKE_NONMOVABLE(LocalStorage);
+
+    struct Statements {
+        Database::StatementID begin_transaction { 0 };
+        Database::StatementID commit_transaction { 0 };
+        Database::StatementID select_items { 0 };
+        Database::StatementID insert_item { 0 };
+        Database::StatementID delete_item { 0 };
+        Database::StatementID delete_items { 0 };
+    };
+
+    struct PersistedStorage {
+        Database& database;
+        Statements statements;
+    };
+
+public:
+    static ErrorOr<NonnullOwnPtr<LocalStorage>> create(Database&);
+    static NonnullOwnPtr<LocalStorage> create();
+
+    ~LocalStorage();
+
+    OrderedHashMap<String, String> get_items(String const& storage_key);
+    void apply_changes(String const& storage_key, ReadonlySpan<Web::StorageAPI::StorageChange>);
+    void delete_items(String const& storage_key);
+
+private:
+    explicit LocalStorage(Optional<PersistedStorage>);
+
+    Optional<PersistedStorage> m_persisted_storage;
+
+    // Without a SQL database, maps only live as long as the browser process.
+    HashMap<String, OrderedHashMap<String, String>> m_transient_storage;
+};
+
+}
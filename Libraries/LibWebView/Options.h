@@ -59,6 +59,11 @@ using DNSSettings = Variant<SystemDNS, DNSOverTLS, DNSOverUDP>;
 
 constexpr inline u16 default_devtools_port = 6000;
 
+enum class EnableHTTPDiskCache {
+    No,
+    Yes,
+};
+
 struct BrowserOptions {
     Vector<URL::URL> urls;
     Vector<ByteString> raw_urls;
@@ -73,6 +78,16 @@ struct BrowserOptions {
     Optional<ByteString> webdriver_content_ipc_path {};
     Optional<DNSSettings> dns_settings {};
     u16 devtools_port { default_devtools_port };
+    EnableHTTPDiskCache enable_http_disk_cache { EnableHTTPDiskCache::No };
+    size_t spare_web_content_process_count { 2 };
+    size_t spare_web_worker_process_count { 2 };
+    Optional<size_t> web_content_memory_budget_in_mib {};
+
+    // Background tabs are frozen once they have been hidden for this long. Frozen tabs are discarded (i.e. their
+    // WebContent process is closed) under memory pressure, when their process exceeds the memory budget, or when
+    // there are more of them than allowed here, least recently visible first.
+    Optional<size_t> freeze_background_tabs_after_seconds {};
+    Optional<size_t> max_frozen_background_tabs {};
 };
 
 enum class IsLayoutTestMode {
@@ -130,6 +145,11 @@ enum class PaintViewportScrollbars {
     No,
 };
 
+enum class RenderOnDemand {
+    No,
+    Yes,
+};
+
 struct WebContentOptions {
     String command_line;
     String executable_path;
@@ -148,6 +168,7 @@ struct WebContentOptions {
     Optional<u16> echo_server_port {};
     IsHeadless is_headless { IsHeadless::No };
     PaintViewportScrollbars paint_viewport_scrollbars { PaintViewportScrollbars::Yes };
+    RenderOnDemand render_on_demand { RenderOnDemand::No };
 };
 
 }
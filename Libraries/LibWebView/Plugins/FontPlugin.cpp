@@ -6,6 +6,7 @@
  */
 
 #include <AK/ByteString.h>
+#include <AK/LexicalPath.h>
 #include <AK/String.h>
 #include <AK/TypeCasts.h>
 #include <LibCore/Resource.h>
@@ -35,9 +36,17 @@ FontPlugin::FontPlugin(bool is_layout_test_mode, Gfx::SystemFontProvider* font_p
         font_provider = &static_cast<Gfx::PathFontProvider&>(Gfx::FontDatabase::the().install_system_font_provider(make<Gfx::PathFontProvider>()));
     if (is<Gfx::PathFontProvider>(*font_provider)) {
         auto& path_font_provider = static_cast<Gfx::PathFontProvider&>(*font_provider);
+
+        // The index lets later processes skip opening every font file. Layout tests shouldn't write to the user's cache.
+        if (!is_layout_test_mode)
+            path_font_provider.load_index(LexicalPath::join(Core::StandardPaths::cache_directory(), "Ladybird"sv, "FontIndex"sv).string());
+
         // Load anything we can find in the system's font directories
         for (auto const& path : Core::StandardPaths::font_directories().release_value_but_fixme_should_propagate_errors())
             path_font_provider.load_all_fonts_from_uri(MUST(String::formatted("file://{}", path)));
+
+        if (auto result = path_font_provider.save_index(); result.is_error())
+            dbgln("FontPlugin: Unable to save the font index: {}", result.error());
     }
 
     update_generic_fonts();
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/WeakPtr.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibImageDecoderClient/Client.h>
@@ -13,6 +14,96 @@
 
 namespace WebView {
 
+class ImageDecoderAnimationFrameSource final : public Web::Platform::AnimationFrameSource {
+public:
+    ImageDecoderAnimationFrameSource(ImageDecoderClient::Client& client, i64 image_id)
+        : m_client(client)
+        , m_image_id(image_id)
+    {
+    }
+
+    virtual ~ImageDecoderAnimationFrameSource() override
+    {
+        if (auto client = m_client.strong_ref())
+            client->release_image(m_image_id);
+    }
+
+    virtual void request_frames(size_t first_frame_index, size_t count, Function<void(size_t first_frame_index, Vector<Web::Platform::Frame>)> on_frames_decoded) override
+    {
+        auto client = m_client.strong_ref();
+        if (!client) {
+            on_frames_decoded(first_frame_index, {});
+            return;
+        }
+
+        client->request_frames(m_image_id, first_frame_index, count, [on_frames_decoded = move(on_frames_decoded)](u32 first_frame_index, Vector<ImageDecoderClient::Frame> frames) {
+            Vector<Web::Platform::Frame> decoded_frames;
+            decoded_frames.ensure_capacity(frames.size());
+            for (auto& frame : frames)
+                decoded_frames.empend(move(frame.bitmap), frame.duration);
+            on_frames_decoded(first_frame_index, move(decoded_frames));
+        });
+    }
+
+private:
+    WeakPtr<ImageDecoderClient::Client> m_client;
+    i64 m_image_id { 0 };
+};
+
+class ImageDecoderIncrementalImageDecoder final : public Web::Platform::IncrementalImageDecoder {
+public:
+    ImageDecoderIncrementalImageDecoder(ImageDecoderClient::Client& client, i64 image_id)
+        : m_client(client)
+        , m_image_id(image_id)
+    {
+    }
+
+    virtual ~ImageDecoderIncrementalImageDecoder() override
+    {
+        if (m_is_finished)
+            return;
+        if (auto client = m_client.strong_ref())
+            client->cancel_incremental_decoding(m_image_id);
+    }
+
+    virtual void append_data(ReadonlyBytes data) override
+    {
+        VERIFY(!m_is_finished);
+        if (auto client = m_client.strong_ref())
+            client->append_incremental_data(m_image_id, data);
+    }
+
+    virtual void finish() override
+    {
+        VERIFY(!m_is_finished);
+        m_is_finished = true;
+        if (auto client = m_client.strong_ref())
+            client->finish_incremental_decoding(m_image_id);
+    }
+
+private:
+    WeakPtr<ImageDecoderClient::Client> m_client;
+    i64 m_image_id { 0 };
+    bool m_is_finished { false };
+};
+
+static Web::Platform::DecodedImage to_platform_decoded_image(ImageDecoderClient::Client& client, ImageDecoderClient::DecodedImage& result)
+{
+    // FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
+    Web::Platform::DecodedImage decoded_image;
+    decoded_image.is_animated = result.is_animated;
+    decoded_image.loop_count = result.loop_count;
+    for (auto& frame : result.frames) {
+        decoded_image.frames.empend(move(frame.bitmap), frame.duration);
+    }
+    decoded_image.color_space = move(result.color_space);
+    if (result.frame_count > result.frames.size()) {
+        decoded_image.frame_count = result.frame_count;
+        decoded_image.frame_source = adopt_ref(*new ImageDecoderAnimationFrameSource(client, result.image_id));
+    }
+    return decoded_image;
+}
+
 ImageCodecPlugin::ImageCodecPlugin(NonnullRefPtr<ImageDecoderClient::Client> client)
     : m_client(move(client))
 {
@@ -46,16 +137,8 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
 
     auto image_decoder_promise = m_client->decode_image(
         bytes,
-        [promise](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
-            // FIXME: Remove this codec plugin and just use the ImageDecoderClient directly to avoid these copies
-            Web::Platform::DecodedImage decoded_image;
-            decoded_image.is_animated = result.is_animated;
-            decoded_image.loop_count = result.loop_count;
-            for (auto& frame : result.frames) {
-                decoded_image.frames.empend(move(frame.bitmap), frame.duration);
-            }
-            decoded_image.color_space = move(result.color_space);
-            promise->resolve(move(decoded_image));
+        [promise, client = m_client](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
+            promise->resolve(to_platform_decoded_image(*client, result));
             return {};
         },
         [promise](auto& error) {
@@ -65,4 +148,29 @@ NonnullRefPtr<Core::Promise<Web::Platform::DecodedImage>> ImageCodecPlugin::deco
     return promise;
 }
 
+RefPtr<Web::Platform::IncrementalImageDecoder> ImageCodecPlugin::start_incremental_decoding(Function<void(NonnullRefPtr<Gfx::Bitmap>)> on_partial_image, Function<ErrorOr<void>(Web::Platform::DecodedImage&)> on_resolved, Function<void(Error&)> on_rejected)
+{
+    if (!m_client)
+        return nullptr;
+
+    auto promise = Core::Promise<Web::Platform::DecodedImage>::construct();
+    promise->on_resolution = move(on_resolved);
+    promise->on_rejection = move(on_rejected);
+
+    auto image_decoder_promise = Core::Promise<ImageDecoderClient::DecodedImage>::construct();
+    image_decoder_promise->on_resolution = [promise, client = m_client](ImageDecoderClient::DecodedImage& result) -> ErrorOr<void> {
+        promise->resolve(to_platform_decoded_image(*client, result));
+        return {};
+    };
+    image_decoder_promise->on_rejection = [promise](auto& error) {
+        promise->reject(Error::copy(error));
+    };
+
+    auto image_id = m_client->start_incremental_decoding(move(on_partial_image), image_decoder_promise);
+    if (!image_id.has_value())
+        return nullptr;
+
+    return adopt_ref(*new ImageDecoderIncrementalImageDecoder(*m_client, *image_id));
+}
+
 }
@@ -126,6 +126,18 @@ void ProcessManager::update_all_process_statistics()
     (void)update_process_statistics(m_statistics);
 }
 
+Optional<u64> ProcessManager::memory_usage_of_process(pid_t pid)
+{
+    Threading::MutexLocker locker { m_lock };
+
+    for (auto const& process : m_statistics.processes) {
+        if (process->pid == pid)
+            return process->memory_usage_bytes;
+    }
+
+    return {};
+}
+
 JsonValue ProcessManager::serialize_json()
 {
     Threading::MutexLocker locker { m_lock };
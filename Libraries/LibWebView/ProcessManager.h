@@ -35,6 +35,7 @@ public:
 #endif
 
     void update_all_process_statistics();
+    Optional<u64> memory_usage_of_process(pid_t);
     JsonValue serialize_json();
 
     Function<void(Process&&)> on_process_exited;
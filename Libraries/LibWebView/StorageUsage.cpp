@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <LibCore/StandardPaths.h>
+#include <LibWebView/StorageUsage.h>
+
+#ifndef AK_OS_WINDOWS
+#    include <sys/statvfs.h>
+#endif
+
+namespace WebView {
+
+// Without a disk to measure (or without being able to measure it), storage keys together may use this many bytes.
+static constexpr u64 fallback_storage_budget = 2 * GiB;
+
+// A single storage key may use a fifth of the storage budget, within these bounds.
+static constexpr u64 minimum_storage_key_quota = 10 * MiB;
+static constexpr u64 maximum_storage_key_quota = 2 * GiB;
+
+// The disk is considered to be under pressure once less than a twentieth of it, or less than this many bytes, is free.
+static constexpr u64 minimum_available_disk_space = 1 * GiB;
+
+// Last accesses only need to be roughly right to pick the storage keys to evict, so they are not written on every access.
+static constexpr auto last_access_persistence_interval = AK::Duration::from_seconds(10 * 60);
+
+struct DiskSpace {
+    u64 capacity { 0 };
+    u64 available { 0 };
+};
+
+static Optional<DiskSpace> disk_space_of_database_directory()
+{
+#ifndef AK_OS_WINDOWS
+    // FIXME: Move this to a generic "Ladybird data directory" helper.
+    auto database_path = ByteString::formatted("{}/Ladybird", Core::StandardPaths::user_data_directory());
+
+    struct statvfs stats {};
+    if (statvfs(database_path.characters(), &stats) < 0)
+        return {};
+
+    return DiskSpace {
+        .capacity = static_cast<u64>(stats.f_blocks) * stats.f_frsize,
+        .available = static_cast<u64>(stats.f_bavail) * stats.f_frsize,
+    };
+#else
+    return {};
+#endif
+}
+
+static void apply_size_change(u64& usage, i64 size_change)
+{
+    if (size_change >= 0)
+        usage += static_cast<u64>(size_change);
+    else
+        usage -= min(usage, static_cast<u64>(-size_change));
+}
+
+ErrorOr<NonnullOwnPtr<StorageUsage>> StorageUsage::create(Database& database)
+{
+    Statements statements {};
+
+    auto create_table = TRY(database.prepare_statement(R"#(
+        CREATE TABLE IF NOT EXISTS StorageAccess (
+            storage_key TEXT,
+            last_access INTEGER,
+            PRIMARY KEY(storage_key)
+        );)#"sv));
+    database.execute_statement(create_table, {});
+
+    // NOTE: SQLite knows the length of a BLOB without reading it, so counting the usage of IndexedDB does not read records.
+    statements.select_indexed_db_usage = TRY(database.prepare_statement(R"#(
+        SELECT storage_key, SUM(size) FROM (
+            SELECT storage_key, LENGTH(schema) AS size FROM IndexedDBDatabases
+            UNION ALL
+            SELECT storage_key, LENGTH(records) AS size FROM IndexedDBObjectStores
+        ) GROUP BY storage_key;)#"sv));
+    statements.select_local_storage_usage = TRY(database.prepare_statement("SELECT storage_key, SUM(LENGTH(CAST(key AS BLOB)) + LENGTH(CAST(value AS BLOB))) FROM LocalStorage GROUP BY storage_key;"sv));
+    statements.select_last_accesses = TRY(database.prepare_statement("SELECT storage_key, last_access FROM StorageAccess;"sv));
+    statements.insert_last_access = TRY(database.prepare_statement("INSERT OR REPLACE INTO StorageAccess VALUES (?, ?);"sv));
+    statements.delete_last_access = TRY(database.prepare_statement("DELETE FROM StorageAccess WHERE storage_key = ?;"sv));
+
+    auto storage_usage = adopt_own(*new StorageUsage { PersistedStorage { database, statements } });
+
+    database.execute_statement(
+        statements.select_indexed_db_usage,
+        [&](auto statement_id) {
+            auto storage_key = database.result_column<String>(statement_id, 0);
+            auto size = database.result_column<u64>(statement_id, 1);
+
+            storage_usage->m_usage.ensure(storage_key).indexed_db = size;
+            storage_usage->m_total_usage += size;
+        });
+
+    database.execute_statement(
+        statements.select_local_storage_usage,
+        [&](auto statement_id) {
+            auto storage_key = database.result_column<String>(statement_id, 0);
+            auto size = database.result_column<u64>(statement_id, 1);
+
+            storage_usage->m_usage.ensure(storage_key).local_storage = size;
+            storage_usage->m_total_usage += size;
+        });
+
+    database.execute_statement(
+        statements.select_last_accesses,
+        [&](auto statement_id) {
+            auto storage_key = database.result_column<String>(statement_id, 0);
+            auto last_access = database.result_column<UnixDateTime>(statement_id, 1);
+
+            if (auto it = storage_usage->m_usage.find(storage_key); it != storage_usage->m_usage.end()) {
+                it->value.last_access = last_access;
+                it->value.persisted_last_access = last_access;
+            }
+        });
+
+    return storage_usage;
+}
+
+NonnullOwnPtr<StorageUsage> StorageUsage::create()
+{
+    return adopt_own(*new StorageUsage { OptionalNone {} });
+}
+
+StorageUsage::StorageUsage(Optional<PersistedStorage> persisted_storage)
+    : m_persisted_storage(move(persisted_storage))
+    , m_budget(fallback_storage_budget)
+{
+    // Storage keys together may use half of the disk, as long as it is not needed for anything else.
+    if (m_persisted_storage.has_value()) {
+        if (auto disk_space = disk_space_of_database_directory(); disk_space.has_value())
+            m_budget = disk_space->capacity / 2;
+    }
+
+    m_quota = clamp(m_budget / 5, minimum_storage_key_quota, maximum_storage_key_quota);
+}
+
+StorageUsage::~StorageUsage() = default;
+
+StorageUsage::Estimate StorageUsage::estimate(String const& storage_key) const
+{
+    auto usage = m_usage.get(storage_key);
+    return { .usage = usage.has_value() ? usage->total() : 0, .quota = m_quota };
+}
+
+bool StorageUsage::can_change_usage(String const& storage_key, i64 size_change) const
+{
+    if (size_change <= 0)
+        return true;
+
+    return estimate(storage_key).usage + static_cast<u64>(size_change) <= m_quota;
+}
+
+void StorageUsage::change_usage(String const& storage_key, Endpoint endpoint, i64 size_change)
+{
+    auto& usage = m_usage.ensure(storage_key);
+    m_total_usage -= usage.total();
+
+    switch (endpoint) {
+    case Endpoint::IndexedDB:
+        apply_size_change(usage.indexed_db, size_change);
+        break;
+    case Endpoint::LocalStorage:
+        apply_size_change(usage.local_storage, size_change);
+        break;
+    }
+
+    m_total_usage += usage.total();
+    did_access(storage_key);
+}
+
+void StorageUsage::did_change_local_storage(String const& storage_key, ReadonlySpan<Web::StorageAPI::StorageChange> changes)
+{
+    for (auto const& change : changes) {
+        // A null key means the map was cleared.
+        if (!change.key.has_value()) {
+            change_usage(storage_key, Endpoint::LocalStorage, -static_cast<i64>(m_usage.ensure(storage_key).local_storage));
+            continue;
+        }
+
+        auto key_size = static_cast<i64>(change.key->bytes().size());
+        i64 size_change = 0;
+
+        if (change.old_value.has_value())
+            size_change -= key_size + static_cast<i64>(change.old_value->bytes().size());
+        if (change.new_value.has_value())
+            size_change += key_size + static_cast<i64>(change.new_value->bytes().size());
+
+        change_usage(storage_key, Endpoint::LocalStorage, size_change);
+    }
+}
+
+void StorageUsage::did_access(String const& storage_key)
+{
+    auto& usage = m_usage.ensure(storage_key);
+    usage.last_access = UnixDateTime::now();
+
+    if (!m_persisted_storage.has_value())
+        return;
+    if (usage.last_access - usage.persisted_last_access < last_access_persistence_interval)
+        return;
+
+    auto& database = m_persisted_storage->database;
+    auto const& statements = m_persisted_storage->statements;
+
+    database.execute_statement(statements.insert_last_access, {}, storage_key, usage.last_access);
+    usage.persisted_last_access = usage.last_access;
+}
+
+Vector<String> StorageUsage::storage_keys_to_evict(String const& storage_key_in_use)
+{
+    u64 excess_usage = m_total_usage > m_budget ? m_total_usage - m_budget : 0;
+
+    if (m_persisted_storage.has_value()) {
+        if (auto disk_space = disk_space_of_database_directory(); disk_space.has_value()) {
+            auto minimum_available = min(disk_space->capacity / 20, minimum_available_disk_space);
+            if (disk_space->available < minimum_available)
+                excess_usage = max(excess_usage, minimum_available - disk_space->available);
+        }
+    }
+
+    if (excess_usage == 0)
+        return {};
+
+    Vector<String> candidates;
+    for (auto const& [storage_key, usage] : m_usage) {
+        if (storage_key != storage_key_in_use && usage.total() != 0)
+            candidates.append(storage_key);
+    }
+
+    quick_sort(candidates, [&](auto const& a, auto const& b) {
+        return m_usage.get(a)->last_access < m_usage.get(b)->last_access;
+    });
+
+    Vector<String> storage_keys_to_evict;
+    u64 evicted_usage = 0;
+
+    for (auto& storage_key : candidates) {
+        if (evicted_usage >= excess_usage)
+            break;
+
+        evicted_usage += m_usage.get(storage_key)->total();
+        storage_keys_to_evict.append(move(storage_key));
+    }
+
+    return storage_keys_to_evict;
+}
+
+void StorageUsage::did_evict(String const& storage_key)
+{
+    if (auto usage = m_usage.take(storage_key); usage.has_value())
+        m_total_usage -= usage->total();
+
+    if (!m_persisted_storage.has_value())
+        return;
+
+    auto& database = m_persisted_storage->database;
+    auto const& statements = m_persisted_storage->statements;
+
+    database.execute_statement(statements.delete_last_access, {}, storage_key);
+}
+
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibWeb/StorageAPI/StorageChange.h>
+#include <LibWebView/Database.h>
+#include <LibWebView/Forward.h>
+
+namespace WebView {
+
+// Keeps track of how many bytes each storage key has persisted, and of when each storage key last used its storage.
+// Usage is counted once at startup, and then kept up to date as the storage endpoints change, so that the usage and
+// quota of a storage key can be estimated without walking through its data.
+//
+// When the storage keys together use more than the storage budget, or the disk is running out of space, the storage
+// of the least recently used storage keys is evicted. All buckets are best-effort, as persist() is not supported yet.
+class StorageUsage {
+    AK_MAKE_NONCOPYABLE(StorageUsage);
+    AK_MAKE_NONMOVABLE(StorageUsage);
+
+    struct Statements {
+        Database::StatementID select_indexed_db_usage { 0 };
+        Database::StatementID select_local_storage_usage { 0 };
+        Database::StatementID select_last_accesses { 0 };
+        Database::StatementID insert_last_access { 0 };
+        Database::StatementID delete_last_access { 0 };
+    };
+
+    struct PersistedStorage {
+        Database& database;
+        Statements statements;
+    };
+
+public:
+    enum class Endpoint : u8 {
+        IndexedDB,
+        LocalStorage,
+    };
+
+    struct Estimate {
+        u64 usage { 0 };
+        u64 quota { 0 };
+    };
+
+    // The IndexedDB and LocalStorage tables must have been created before the usage is counted.
+    static ErrorOr<NonnullOwnPtr<StorageUsage>> create(Database&);
+    static NonnullOwnPtr<StorageUsage> create();
+
+    ~StorageUsage();
+
+    Estimate estimate(String const& storage_key) const;
+
+    // Returns whether the storage key may grow its usage by the given (possibly negative) number of bytes.
+    bool can_change_usage(String const& storage_key, i64 size_change) const;
+
+    void change_usage(String const& storage_key, Endpoint, i64 size_change);
+    void did_change_local_storage(String const& storage_key, ReadonlySpan<Web::StorageAPI::StorageChange>);
+    void did_access(String const& storage_key);
+
+    // Returns the least recently used storage keys whose storage has to be evicted to relieve storage pressure. The
+    // storage key that is currently in use is never evicted.
+    Vector<String> storage_keys_to_evict(String const& storage_key_in_use);
+    void did_evict(String const& storage_key);
+
+private:
+    struct Usage {
+        u64 total() const { return indexed_db + local_storage; }
+
+        u64 indexed_db { 0 };
+        u64 local_storage { 0 };
+        UnixDateTime last_access;
+        UnixDateTime persisted_last_access;
+    };
+
+    explicit StorageUsage(Optional<PersistedStorage>);
+
+    Optional<PersistedStorage> m_persisted_storage;
+
+    HashMap<String, Usage> m_usage;
+    u64 m_total_usage { 0 };
+
+    // The number of bytes all storage keys together may use, and the number of bytes a single storage key may use.
+    u64 m_budget { 0 };
+    u64 m_quota { 0 };
+};
+
+}
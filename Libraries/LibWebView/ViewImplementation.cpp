@@ -75,6 +75,10 @@ ViewImplementation::~ViewImplementation()
 
 WebContentClient& ViewImplementation::client()
 {
+    // NOTE: Anything that needs to talk to the page of a discarded tab brings it back.
+    if (m_lifecycle_state == LifecycleState::Discarded)
+        restore_discarded_page();
+
     VERIFY(m_client_state.client);
     return *m_client_state.client;
 }
@@ -138,9 +142,111 @@ void ViewImplementation::did_update_window_rect()
 void ViewImplementation::set_system_visibility_state(Web::HTML::VisibilityState visibility_state)
 {
     m_system_visibility_state = visibility_state;
+
+    if (m_system_visibility_state == Web::HTML::VisibilityState::Visible) {
+        if (m_freeze_timer)
+            m_freeze_timer->stop();
+
+        // NOTE: The new WebContent process is told about our visibility state when it is initialized.
+        if (m_lifecycle_state == LifecycleState::Discarded) {
+            restore_discarded_page();
+            return;
+        }
+        if (m_lifecycle_state == LifecycleState::Frozen)
+            thaw();
+    } else {
+        m_hidden_time = MonotonicTime::now_coarse();
+
+        if (m_lifecycle_state == LifecycleState::Discarded)
+            return;
+        schedule_freeze();
+    }
+
     client().async_set_system_visibility_state(m_client_state.page_index, m_system_visibility_state);
 }
 
+void ViewImplementation::schedule_freeze()
+{
+    auto freeze_delay_in_seconds = Application::browser_options().freeze_background_tabs_after_seconds;
+    if (!freeze_delay_in_seconds.has_value() || m_lifecycle_state != LifecycleState::Active)
+        return;
+
+    if (!m_freeze_timer)
+        m_freeze_timer = Core::Timer::create_single_shot(0, [this] { freeze(); });
+    m_freeze_timer->restart(static_cast<int>(*freeze_delay_in_seconds * 1000));
+}
+
+void ViewImplementation::freeze()
+{
+    if (m_lifecycle_state != LifecycleState::Active || m_system_visibility_state != Web::HTML::VisibilityState::Hidden)
+        return;
+
+    // A tab that is playing audio is still doing something for the user. We try again once it stops.
+    if (m_audio_play_state == Web::HTML::AudioPlayState::Playing)
+        return;
+
+    m_lifecycle_state = LifecycleState::Frozen;
+    client().async_set_page_frozen(page_id(), true);
+
+    // The WebContent process lets go of its backing stores, so we do the same. They are reallocated once we are thawed.
+    m_client_state.front_bitmap = {};
+    m_client_state.back_bitmap = {};
+    m_client_state.has_usable_bitmap = false;
+    m_backup_bitmap = nullptr;
+}
+
+void ViewImplementation::did_freeze_page(Badge<WebContentClient>, ByteString session_state)
+{
+    // NOTE: We may have been thawed again before the WebContent process got to freezing the page.
+    if (m_lifecycle_state != LifecycleState::Frozen)
+        return;
+
+    m_session_state = move(session_state);
+    Application::the().discard_frozen_background_tabs_over_limit();
+}
+
+void ViewImplementation::thaw()
+{
+    m_lifecycle_state = LifecycleState::Active;
+    m_session_state.clear();
+
+    client().async_set_page_frozen(page_id(), false);
+}
+
+bool ViewImplementation::can_be_discarded() const
+{
+    // NOTE: We can only close a WebContent process that isn't hosting any other page, such as a pop-up we opened.
+    return m_lifecycle_state == LifecycleState::Frozen
+        && m_session_state.has_value()
+        && m_client_state.client->view_count() == 1;
+}
+
+void ViewImplementation::discard(Badge<Application>)
+{
+    VERIFY(can_be_discarded());
+    dbgln("Discarding the WebContent process of background tab {}", m_url);
+
+    m_client_state.client->unregister_view(m_client_state.page_index);
+    m_client_state = {};
+    m_lifecycle_state = LifecycleState::Discarded;
+}
+
+void ViewImplementation::restore_discarded_page()
+{
+    VERIFY(m_lifecycle_state == LifecycleState::Discarded);
+    auto session_state = m_session_state.release_value();
+    m_lifecycle_state = LifecycleState::Active;
+
+    initialize_client();
+    VERIFY(m_client_state.client);
+
+    handle_resize();
+    update_zoom();
+
+    client().async_restore_session_state(page_id(), session_state);
+    load(m_url);
+}
+
 void ViewImplementation::load(URL::URL const& url)
 {
     m_url = url;
@@ -426,6 +532,16 @@ void ViewImplementation::js_console_request_messages(i32 start_index)
     client().async_js_console_request_messages(page_id(), start_index);
 }
 
+void ViewImplementation::start_js_profiler()
+{
+    client().async_start_js_profiler(page_id());
+}
+
+void ViewImplementation::stop_js_profiler()
+{
+    client().async_stop_js_profiler(page_id());
+}
+
 void ViewImplementation::alert_closed()
 {
     client().async_alert_closed(page_id());
@@ -509,6 +625,9 @@ void ViewImplementation::did_change_audio_play_state(Badge<WebContentClient>, We
 
     if (state_changed && on_audio_play_state_changed)
         on_audio_play_state_changed(m_audio_play_state);
+
+    if (state_changed && m_audio_play_state == Web::HTML::AudioPlayState::Paused && m_system_visibility_state == Web::HTML::VisibilityState::Hidden)
+        schedule_freeze();
 }
 
 void ViewImplementation::did_update_navigation_buttons_state(Badge<WebContentClient>, bool back_enabled, bool forward_enabled) const
@@ -610,6 +729,9 @@ void ViewImplementation::handle_web_content_process_crash(LoadErrorPage load_err
     dbgln("\033[31;1mWebContent process crashed!\033[0m Last page loaded: {}", m_url);
     dbgln("Consider raising an issue at https://github.com/LadybirdBrowser/ladybird/issues/new/choose");
 
+    m_lifecycle_state = LifecycleState::Active;
+    m_session_state.clear();
+
     ++m_crash_count;
     constexpr size_t max_reasonable_crash_count = 5U;
     if (m_crash_count >= max_reasonable_crash_count) {
@@ -652,12 +774,19 @@ void ViewImplementation::handle_web_content_process_crash(LoadErrorPage load_err
 
 void ViewImplementation::languages_changed()
 {
+    // NOTE: The settings of discarded tabs are sent to their new WebContent process once they are restored.
+    if (m_lifecycle_state == LifecycleState::Discarded)
+        return;
+
     auto const& languages = Application::settings().languages();
     client().async_set_preferred_languages(page_id(), languages);
 }
 
 void ViewImplementation::autoplay_settings_changed()
 {
+    if (m_lifecycle_state == LifecycleState::Discarded)
+        return;
+
     auto const& autoplay_settings = Application::settings().autoplay_settings();
     auto const& web_content_options = Application::web_content_options();
 
@@ -669,6 +798,9 @@ void ViewImplementation::autoplay_settings_changed()
 
 void ViewImplementation::do_not_track_changed()
 {
+    if (m_lifecycle_state == LifecycleState::Discarded)
+        return;
+
     auto do_not_track = Application::settings().do_not_track();
     client().async_set_enable_do_not_track(page_id(), do_not_track == DoNotTrack::Yes);
 }
@@ -788,6 +920,20 @@ ErrorOr<LexicalPath> ViewImplementation::dump_gc_graph()
     return path;
 }
 
+ErrorOr<LexicalPath> ViewImplementation::take_heap_snapshot()
+{
+    auto promise = request_internal_page_info(PageInfoType::HeapSnapshot);
+    auto heap_snapshot_json = TRY(promise->await());
+
+    LexicalPath path { Core::StandardPaths::tempfile_directory() };
+    path = path.append(TRY(Core::DateTime::now().to_string("heap-snapshot-%Y-%m-%d-%H-%M-%S.json"sv)));
+
+    auto snapshot_file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+    TRY(snapshot_file->write_until_depleted(heap_snapshot_json.bytes()));
+
+    return path;
+}
+
 void ViewImplementation::set_user_style_sheet(String const& source)
 {
     client().async_set_user_style(page_id(), source);
@@ -13,6 +13,7 @@
 #include <AK/LexicalPath.h>
 #include <AK/Queue.h>
 #include <AK/String.h>
+#include <AK/Time.h>
 #include <LibCore/Forward.h>
 #include <LibCore/Promise.h>
 #include <LibGfx/Cursor.h>
@@ -60,6 +61,23 @@ public:
 
     void set_system_visibility_state(Web::HTML::VisibilityState);
 
+    // Background tabs are frozen once they have been hidden for a while (see BrowserOptions), and frozen tabs may then
+    // be discarded to free up their WebContent process. Discarded tabs are restored from their session state once they
+    // are needed again.
+    enum class LifecycleState {
+        Active,
+        Frozen,
+        Discarded,
+    };
+    LifecycleState lifecycle_state() const { return m_lifecycle_state; }
+    MonotonicTime hidden_time() const { return m_hidden_time; }
+
+    bool can_be_discarded() const;
+    void discard(Badge<Application>);
+    pid_t web_content_pid() const { return client().pid(); }
+
+    void did_freeze_page(Badge<WebContentClient>, ByteString session_state);
+
     void load(URL::URL const&);
     void load_html(StringView);
     void load_empty_document();
@@ -123,6 +141,9 @@ public:
     void js_console_input(String const&);
     void js_console_request_messages(i32 start_index);
 
+    void start_js_profiler();
+    void stop_js_profiler();
+
     void alert_closed();
     void confirm_closed(bool accepted);
     void prompt_closed(Optional<String> const& response);
@@ -162,6 +183,7 @@ public:
     void did_receive_internal_page_info(Badge<WebContentClient>, PageInfoType, String const&);
 
     ErrorOr<LexicalPath> dump_gc_graph();
+    ErrorOr<LexicalPath> take_heap_snapshot();
 
     void set_user_style_sheet(String const& source);
     // Load Native.css as the User style sheet, which attempts to make WebView content look as close to
@@ -210,6 +232,7 @@ public:
     Function<void(JsonValue)> on_received_js_console_result;
     Function<void(i32 message_id)> on_console_message_available;
     Function<void(i32 start_index, Vector<ConsoleOutput>)> on_received_console_messages;
+    Function<void(JsonValue)> on_received_js_profile;
     Function<void(i32 count_waiting)> on_resource_status_change;
     Function<void()> on_restore_window;
     Function<void(Gfx::IntPoint)> on_reposition_window;
@@ -263,6 +286,11 @@ protected:
     };
     void handle_web_content_process_crash(LoadErrorPage = LoadErrorPage::Yes);
 
+    void schedule_freeze();
+    void freeze();
+    void thaw();
+    void restore_discarded_page();
+
     virtual void languages_changed() override;
     virtual void autoplay_settings_changed() override;
     virtual void do_not_track_changed() override;
@@ -303,6 +331,13 @@ protected:
 
     Web::HTML::VisibilityState m_system_visibility_state { Web::HTML::VisibilityState::Hidden };
 
+    LifecycleState m_lifecycle_state { LifecycleState::Active };
+    MonotonicTime m_hidden_time { MonotonicTime::now_coarse() };
+    RefPtr<Core::Timer> m_freeze_timer;
+
+    // What the page reported when it was frozen, to restore it from if we are discarded.
+    Optional<ByteString> m_session_state;
+
     Web::HTML::AudioPlayState m_audio_play_state { Web::HTML::AudioPlayState::Paused };
     size_t m_number_of_elements_playing_audio { 0 };
 
@@ -8,6 +8,9 @@
 #include <LibWebView/Application.h>
 #include <LibWebView/CookieJar.h>
 #include <LibWebView/HelperProcess.h>
+#include <LibWebView/IndexedDBStorage.h>
+#include <LibWebView/LocalStorage.h>
+#include <LibWebView/StorageUsage.h>
 #include <LibWebView/ViewImplementation.h>
 #include <LibWebView/WebContentClient.h>
 #include <LibWebView/WebUI.h>
@@ -414,6 +417,14 @@ void WebContentClient::did_get_js_console_messages(u64 page_id, i32 start_index,
     }
 }
 
+void WebContentClient::did_stop_js_profiler(u64 page_id, JsonValue profile)
+{
+    if (auto view = view_for_page_id(page_id); view.has_value()) {
+        if (view->on_received_js_profile)
+            view->on_received_js_profile(move(profile));
+    }
+}
+
 void WebContentClient::did_request_alert(u64 page_id, String message)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
@@ -505,6 +516,77 @@ void WebContentClient::did_expire_cookies_with_time_offset(AK::Duration offset)
     Application::cookie_jar().expire_cookies_with_time_offset(offset);
 }
 
+Messages::WebContentClient::DidRequestIndexedDbDatabaseResponse WebContentClient::did_request_indexed_db_database(String storage_key, String name)
+{
+    Application::storage_usage().did_access(storage_key);
+
+    auto database = Application::indexed_db_storage().get_database(storage_key, name);
+    if (!database.has_value())
+        return { OptionalNone {}, {} };
+
+    return { move(database->schema), move(database->object_store_records) };
+}
+
+Messages::WebContentClient::DidUpdateIndexedDbDatabaseResponse WebContentClient::did_update_indexed_db_database(String storage_key, String name, ByteBuffer schema, HashMap<String, ByteBuffer> object_store_records, Vector<String> object_store_names)
+{
+    auto& storage_usage = Application::storage_usage();
+    auto& indexed_db_storage = Application::indexed_db_storage();
+
+    auto size_change = indexed_db_storage.size_change_of_update(storage_key, name, schema, object_store_records, object_store_names);
+    if (!storage_usage.can_change_usage(storage_key, size_change))
+        return false;
+
+    indexed_db_storage.update_database(storage_key, name, move(schema), move(object_store_records), object_store_names);
+    storage_usage.change_usage(storage_key, StorageUsage::Endpoint::IndexedDB, size_change);
+
+    if (size_change > 0)
+        Application::the().evict_storage_if_needed(storage_key);
+    return true;
+}
+
+void WebContentClient::did_delete_indexed_db_database(String storage_key, String name)
+{
+    auto& indexed_db_storage = Application::indexed_db_storage();
+
+    auto size = indexed_db_storage.database_size(storage_key, name);
+    indexed_db_storage.delete_database(storage_key, name);
+
+    Application::storage_usage().change_usage(storage_key, StorageUsage::Endpoint::IndexedDB, -static_cast<i64>(size));
+}
+
+Messages::WebContentClient::DidRequestLocalStorageResponse WebContentClient::did_request_local_storage(String storage_key)
+{
+    Application::storage_usage().did_access(storage_key);
+
+    return Application::local_storage().get_items(storage_key);
+}
+
+void WebContentClient::did_change_local_storage(String storage_key, Vector<Web::StorageAPI::StorageChange> changes)
+{
+    Application::local_storage().apply_changes(storage_key, changes);
+
+    auto& storage_usage = Application::storage_usage();
+    auto usage_before_changes = storage_usage.estimate(storage_key).usage;
+
+    storage_usage.did_change_local_storage(storage_key, changes);
+
+    if (storage_usage.estimate(storage_key).usage > usage_before_changes)
+        Application::the().evict_storage_if_needed(storage_key);
+
+    // Other processes may hold a copy of the same map, which has to be kept up to date.
+    for_each_client([&](WebContentClient& client) {
+        if (&client != this)
+            client.async_local_storage_changed(storage_key, changes);
+        return IterationDecision::Continue;
+    });
+}
+
+Messages::WebContentClient::DidRequestStorageEstimateResponse WebContentClient::did_request_storage_estimate(String storage_key)
+{
+    auto estimate = Application::storage_usage().estimate(storage_key);
+    return { estimate.usage, estimate.quota };
+}
+
 Messages::WebContentClient::DidRequestNewWebViewResponse WebContentClient::did_request_new_web_view(u64 page_id, Web::HTML::ActivateTab activate_tab, Web::HTML::WebViewHints hints, Optional<u64> page_index)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
@@ -655,6 +737,12 @@ void WebContentClient::did_change_audio_play_state(u64 page_id, Web::HTML::Audio
         view->did_change_audio_play_state({}, play_state);
 }
 
+void WebContentClient::did_freeze_page(u64 page_id, ByteString session_state)
+{
+    if (auto view = view_for_page_id(page_id); view.has_value())
+        view->did_freeze_page({}, move(session_state));
+}
+
 void WebContentClient::did_update_navigation_buttons_state(u64 page_id, bool back_enabled, bool forward_enabled)
 {
     if (auto view = view_for_page_id(page_id); view.has_value())
@@ -670,7 +758,7 @@ void WebContentClient::did_allocate_backing_stores(u64 page_id, i32 front_bitmap
 Messages::WebContentClient::RequestWorkerAgentResponse WebContentClient::request_worker_agent(u64 page_id, Web::Bindings::AgentType worker_type)
 {
     if (auto view = view_for_page_id(page_id); view.has_value()) {
-        auto worker_client = MUST(WebView::launch_web_worker_process(worker_type));
+        auto worker_client = MUST(Application::the().launch_web_worker_process(worker_type));
         return worker_client->clone_transport();
     }
 
@@ -47,6 +47,7 @@ public:
     void assign_view(Badge<Application>, ViewImplementation&);
     void register_view(u64 page_id, ViewImplementation&);
     void unregister_view(u64 page_id);
+    size_t view_count() const { return m_views.size(); }
 
     void web_ui_disconnected(Badge<WebUI>);
 
@@ -93,6 +94,7 @@ private:
     virtual void did_execute_js_console_input(u64 page_id, JsonValue) override;
     virtual void did_output_js_console_message(u64 page_id, i32 message_index) override;
     virtual void did_get_js_console_messages(u64 page_id, i32 start_index, Vector<ConsoleOutput>) override;
+    virtual void did_stop_js_profiler(u64 page_id, JsonValue) override;
     virtual void did_change_favicon(u64 page_id, Gfx::ShareableBitmap) override;
     virtual void did_request_alert(u64 page_id, String) override;
     virtual void did_request_confirm(u64 page_id, String) override;
@@ -106,6 +108,12 @@ private:
     virtual void did_set_cookie(URL::URL, Web::Cookie::ParsedCookie, Web::Cookie::Source) override;
     virtual void did_update_cookie(Web::Cookie::Cookie) override;
     virtual void did_expire_cookies_with_time_offset(AK::Duration) override;
+    virtual Messages::WebContentClient::DidRequestIndexedDbDatabaseResponse did_request_indexed_db_database(String storage_key, String name) override;
+    virtual Messages::WebContentClient::DidUpdateIndexedDbDatabaseResponse did_update_indexed_db_database(String storage_key, String name, ByteBuffer schema, HashMap<String, ByteBuffer> object_store_records, Vector<String> object_store_names) override;
+    virtual void did_delete_indexed_db_database(String storage_key, String name) override;
+    virtual Messages::WebContentClient::DidRequestLocalStorageResponse did_request_local_storage(String storage_key) override;
+    virtual void did_change_local_storage(String storage_key, Vector<Web::StorageAPI::StorageChange> changes) override;
+    virtual Messages::WebContentClient::DidRequestStorageEstimateResponse did_request_storage_estimate(String storage_key) override;
     virtual Messages::WebContentClient::DidRequestNewWebViewResponse did_request_new_web_view(u64 page_id, Web::HTML::ActivateTab, Web::HTML::WebViewHints, Optional<u64> page_index) override;
     virtual void did_request_activate_tab(u64 page_id) override;
     virtual void did_close_browsing_context(u64 page_id) override;
@@ -129,6 +137,7 @@ private:
     virtual void did_insert_clipboard_entry(u64 page_id, Web::Clipboard::SystemClipboardRepresentation, String presentation_style) override;
     virtual void did_request_clipboard_entries(u64 page_id, u64 request_id) override;
     virtual void did_change_audio_play_state(u64 page_id, Web::HTML::AudioPlayState) override;
+    virtual void did_freeze_page(u64 page_id, ByteString session_state) override;
     virtual void did_update_navigation_buttons_state(u64 page_id, bool back_enabled, bool forward_enabled) override;
     virtual void did_allocate_backing_stores(u64 page_id, i32 front_bitmap_id, Gfx::ShareableBitmap, i32 back_bitmap_id, Gfx::ShareableBitmap) override;
     virtual Messages::WebContentClient::RequestWorkerAgentResponse request_worker_agent(u64 page_id, Web::Bindings::AgentType worker_type) override;
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/BuiltinWrappers.h>
+#include <AK/SIMDExtras.h>
 #include <LibXML/DOM/Document.h>
 #include <LibXML/Parser/Parser.h>
 
@@ -70,6 +72,14 @@ size_t Parser::s_debug_indent_level { 0 };
 
 void Parser::append_node(NonnullOwnPtr<Node> node)
 {
+    // A listener is told about every element as it starts and ends, so only the elements that are still open have to
+    // be kept around, rather than the whole tree.
+    if (m_listener) {
+        m_open_nodes.append(move(node));
+        enter_node(*m_open_nodes.last());
+        return;
+    }
+
     if (m_entered_node) {
         auto& entered_element = m_entered_node->content.get<Node::Element>();
         entered_element.children.append(move(node));
@@ -83,7 +93,8 @@ void Parser::append_node(NonnullOwnPtr<Node> node)
 void Parser::append_text(StringView text, LineTrackingLexer::Position position)
 {
     if (m_listener) {
-        m_listener->text(text);
+        if (!text.is_empty())
+            m_listener->text(text);
         return;
     }
 
@@ -155,6 +166,8 @@ void Parser::leave_node()
     }
 
     m_entered_node = m_entered_node->parent;
+    if (m_listener)
+        m_open_nodes.take_last();
 }
 
 ErrorOr<Document, ParseError> Parser::parse()
@@ -183,6 +196,8 @@ ErrorOr<void, ParseError> Parser::parse_with_listener(Listener& listener)
         m_listener->error(result.error());
     m_listener->document_end();
     m_root_node.clear();
+    m_open_nodes.clear();
+    m_entered_node = nullptr;
     return result;
 }
 
@@ -916,6 +931,26 @@ ErrorOr<void, ParseError> Parser::parse_content()
     return {};
 }
 
+// Character data usually makes up most of a document, so this looks for the U+003C (<) or U+0026 (&) that ends it
+// 16 bytes at a time.
+static size_t find_end_of_char_data(StringView input)
+{
+    using AK::SIMD::u8x16;
+
+    auto const* bytes = reinterpret_cast<u8 const*>(input.characters_without_null_termination());
+    size_t i = 0;
+    for (; i + sizeof(u8x16) <= input.length(); i += sizeof(u8x16)) {
+        auto chunk = AK::SIMD::load_unaligned<u8x16>(bytes + i);
+        if (auto mask = AK::SIMD::maskbits(static_cast<AK::SIMD::i8x16>((chunk == '<') | (chunk == '&'))); mask != 0)
+            return i + count_trailing_zeroes(mask);
+    }
+    for (; i < input.length(); ++i) {
+        if (bytes[i] == '<' || bytes[i] == '&')
+            break;
+    }
+    return i;
+}
+
 // 2.4.14 CharData, https://www.w3.org/TR/2006/REC-xml11-20060816/#NT-CharData
 ErrorOr<StringView, ParseError> Parser::parse_char_data()
 {
@@ -923,33 +958,11 @@ ErrorOr<StringView, ParseError> Parser::parse_char_data()
     auto rule = enter_rule();
 
     // CharData ::= [^<&]* - ([^<&]* ']]>' [^<&]*)
-    auto cend_state = 0; // 1: ], 2: ], 3: >
-    auto text = m_lexer.consume_while([&](auto ch) {
-        if (ch == '<' || ch == '&' || cend_state == 3)
-            return false;
-        switch (cend_state) {
-        case 0:
-        case 1:
-            if (ch == ']')
-                cend_state++;
-            else
-                cend_state = 0;
-            return true;
-        case 2:
-            if (ch == '>') {
-                cend_state++;
-                return true;
-            }
-            cend_state = 0;
-            return true;
-        default:
-            VERIFY_NOT_REACHED();
-        }
-    });
-    if (cend_state == 3) {
-        m_lexer.retreat(3);
-        text = text.substring_view(0, text.length() - 3);
-    }
+    auto text = m_lexer.remaining();
+    text = text.substring_view(0, find_end_of_char_data(text));
+    if (auto cdata_end = text.find("]]>"sv); cdata_end.has_value())
+        text = text.substring_view(0, *cdata_end);
+    m_lexer.ignore(text.length());
 
     rollback.disarm();
     return text;
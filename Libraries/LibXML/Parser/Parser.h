@@ -208,6 +208,7 @@ private:
 
     OwnPtr<Node> m_root_node;
     Node* m_entered_node { nullptr };
+    Vector<NonnullOwnPtr<Node>> m_open_nodes;
     Version m_version { Version::Version11 };
     bool m_in_compatibility_mode { false };
     ByteString m_encoding;
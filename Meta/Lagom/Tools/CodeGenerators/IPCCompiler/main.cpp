@@ -404,7 +404,7 @@ public:)~~~");
     static i32 static_message_id() { return (int)MessageID::@message.pascal_name@; }
     virtual const char* message_name() const override { return "@endpoint.name@::@message.pascal_name@"; }
 
-    static ErrorOr<NonnullOwnPtr<@message.pascal_name@>> decode(Stream& stream, Queue<IPC::File>& files)
+    static ErrorOr<NonnullOwnPtr<@message.pascal_name@>> decode(FixedMemoryStream& stream, Queue<IPC::File>& files)
     {
         IPC::Decoder decoder { stream, files };)~~~");
 
@@ -457,7 +457,22 @@ public:)~~~");
     message_generator.append(R"~~~()
     {
         IPC::MessageBuffer buffer;
-        IPC::Encoder stream(buffer);
+        IPC::Encoder stream(buffer);)~~~");
+
+    if (!parameters.is_empty()) {
+        message_generator.append(R"~~~(
+        TRY(stream.extend_capacity(sizeof(ENDPOINT_MAGIC) + sizeof(int))~~~");
+
+        for (auto const& parameter : parameters) {
+            auto parameter_generator = message_generator.fork();
+            parameter_generator.set("parameter.name", parameter.name);
+            parameter_generator.append(" + IPC::encoded_size_hint(@parameter.name@)");
+        }
+
+        message_generator.append("));");
+    }
+
+    message_generator.append(R"~~~(
         TRY(stream.encode(ENDPOINT_MAGIC));
         TRY(stream.encode((int)MessageID::@message.pascal_name@));)~~~");
 
@@ -58,6 +58,7 @@ static bool is_platform_object(Type const& type)
         "DOMRectReadOnly"sv,
         "DynamicsCompressorNode"sv,
         "ElementInternals"sv,
+        "EncodedVideoChunk"sv,
         "EventTarget"sv,
         "FederatedCredential"sv,
         "File"sv,
@@ -84,6 +85,8 @@ static bool is_platform_object(Type const& type)
         "NavigationDestination"sv,
         "NavigationHistoryEntry"sv,
         "Node"sv,
+        "OffscreenCanvas"sv,
+        "OffscreenCanvasRenderingContext2D"sv,
         "PasswordCredential"sv,
         "Path2D"sv,
         "PerformanceEntry"sv,
@@ -111,6 +114,7 @@ static bool is_platform_object(Type const& type)
         "TimeRanges"sv,
         "URLSearchParams"sv,
         "VTTRegion"sv,
+        "VideoFrame"sv,
         "VideoTrack"sv,
         "VideoTrackList"sv,
         "WebGL2RenderingContext"sv,
@@ -3084,6 +3088,24 @@ static Vector<Interface const&> create_an_inheritance_stack(IDL::Interface const
     return inheritance_chain;
 }
 
+static bool interface_inherits_from(IDL::Interface const& start_interface, StringView ancestor_name)
+{
+    auto const* current_interface = &start_interface;
+    while (!current_interface->parent_name.is_empty()) {
+        if (current_interface->parent_name == ancestor_name)
+            return true;
+
+        auto imported_interface_iterator = start_interface.imported_modules.find_if([&current_interface](IDL::Interface const& imported_interface) {
+            return imported_interface.name == current_interface->parent_name;
+        });
+        if (imported_interface_iterator == start_interface.imported_modules.end())
+            return false;
+
+        current_interface = &*imported_interface_iterator;
+    }
+    return false;
+}
+
 // https://webidl.spec.whatwg.org/#collect-attribute-values-of-an-inheritance-stack
 static void collect_attribute_values_of_an_inheritance_stack(SourceGenerator& function_generator, Vector<Interface const&> const& inheritance_chain)
 {
@@ -3737,12 +3759,26 @@ static void generate_prototype_or_global_mixin_definitions(IDL::Interface const&
 )~~~");
         }
 
-        generator.append(R"~~~(
+        if (interface_inherits_from(interface, "Node"sv)) {
+            // OPTIMIZATION: Checking whether an object is a node, and then whether that node is of a given type, is cheap
+            //               for most node types, whereas checking the object's type directly is a dynamic cast.
+            generator.append(R"~~~(
+    if (!is<DOM::Node>(this_object))
+        return vm.throw_completion<JS::TypeError>(JS::ErrorType::NotAnObjectOfType, "@namespaced_name@");
+    auto& this_node = static_cast<DOM::Node&>(*this_object);
+    if (!is<@fully_qualified_name@>(this_node))
+        return vm.throw_completion<JS::TypeError>(JS::ErrorType::NotAnObjectOfType, "@namespaced_name@");
+    return static_cast<@fully_qualified_name@*>(&this_node);
+}
+)~~~");
+        } else {
+            generator.append(R"~~~(
     if (!is<@fully_qualified_name@>(this_object))
         return vm.throw_completion<JS::TypeError>(JS::ErrorType::NotAnObjectOfType, "@namespaced_name@");
     return static_cast<@fully_qualified_name@*>(this_object);
 }
 )~~~");
+        }
     }
 
     for (auto& attribute : interface.attributes) {
@@ -4742,6 +4778,7 @@ using namespace Web::URLPattern;
 using namespace Web::UserTiming;
 using namespace Web::WebAssembly;
 using namespace Web::WebAudio;
+using namespace Web::WebCodecs;
 using namespace Web::WebGL;
 using namespace Web::WebGL::Extensions;
 using namespace Web::WebIDL;
@@ -388,6 +388,25 @@ static void generate_webgl_object_handle_unwrap(SourceGenerator& generator, Stri
     generator.append(unwrap_generator.as_string_view());
 }
 
+// Emits a GL call that is queued to run on the GPU thread of the context. The captures must only be values, as the call
+// runs after the generated function has returned.
+static void generate_deferred_gl_call(SourceGenerator& generator, Vector<ByteString> const& captures, StringView gl_call)
+{
+    StringBuilder string_builder;
+    SourceGenerator call_generator { string_builder };
+    StringBuilder capture_list;
+    capture_list.join(", "sv, captures);
+    call_generator.set("captures", capture_list.string_view());
+    call_generator.set("gl_call", gl_call);
+    call_generator.append(R"~~~(
+    m_context->enqueue([@captures@] {
+        @gl_call@;
+    });
+)~~~");
+
+    generator.append(call_generator.as_string_view());
+}
+
 static void generate_get_active_uniform_block_parameter(SourceGenerator& generator)
 {
     generate_webgl_object_handle_unwrap(generator, "program"sv, "JS::js_null()"sv);
@@ -879,9 +898,19 @@ public:
         SourceGenerator function_impl_generator { function_impl };
         function_impl_generator.set("class_name", class_name);
 
+        // Set when every GL call of the function is queued with generate_deferred_gl_call().
+        bool defers_gl_calls = false;
+
         ScopeGuard function_guard { [&] {
             function_impl_generator.append("}\n"sv);
-            implementation_file_generator.append(function_impl_generator.as_string_view().bytes());
+            auto generated_function = ByteString { function_impl_generator.as_string_view() };
+
+            // NOTE: A function that only queues GL calls does not need the context to be current on the main thread, which
+            //       would have to wait for the GPU thread. It still needs the drawing buffer for the GPU thread to draw to.
+            if (defers_gl_calls)
+                generated_function = generated_function.replace("    m_context->make_current();\n"sv, "    m_context->allocate_painting_surface_if_needed();\n"sv, ReplaceMode::FirstOnly);
+
+            implementation_file_generator.append(generated_function.view());
         } };
 
         function_impl_generator.set("function_name", function_name);
@@ -1042,9 +1071,8 @@ public:
         }
 
         if (function.name == "vertexAttribPointer"sv) {
-            function_impl_generator.append(R"~~~(
-    glVertexAttribPointer(index, size, type, normalized, stride, reinterpret_cast<void*>(offset));
-)~~~");
+            generate_deferred_gl_call(function_impl_generator, { "index", "size", "type", "normalized", "stride", "offset" }, "glVertexAttribPointer(index, size, type, normalized, stride, reinterpret_cast<void*>(offset))"sv);
+            defers_gl_calls = true;
             continue;
         }
 
@@ -1416,18 +1444,16 @@ public:
         }
 
         if (function.name == "drawElements"sv) {
-            function_impl_generator.append(R"~~~(
-    glDrawElements(mode, count, type, reinterpret_cast<void*>(offset));
-    needs_to_present();
-)~~~");
+            generate_deferred_gl_call(function_impl_generator, { "mode", "count", "type", "offset" }, "glDrawElements(mode, count, type, reinterpret_cast<void*>(offset))"sv);
+            function_impl_generator.append("    needs_to_present();\n"sv);
+            defers_gl_calls = true;
             continue;
         }
 
         if (function.name == "drawElementsInstanced"sv) {
-            function_impl_generator.append(R"~~~(
-    glDrawElementsInstanced(mode, count, type, reinterpret_cast<void*>(offset), instance_count);
-    needs_to_present();
-)~~~");
+            generate_deferred_gl_call(function_impl_generator, { "mode", "count", "type", "offset", "instance_count" }, "glDrawElementsInstanced(mode, count, type, reinterpret_cast<void*>(offset), instance_count)"sv);
+            function_impl_generator.append("    needs_to_present();\n"sv);
+            defers_gl_calls = true;
             continue;
         }
 
@@ -1484,9 +1510,13 @@ public:
 )~~~");
             }
 
+            // NOTE: The values are copied, as the array they come from may change before the GPU thread gets to them.
             function_impl_generator.append(R"~~~(
-    glUniformMatrix@number_of_matrix_elements@fv(location->handle(), count, transpose, raw_data);
+    Vector<float> values;
+    values.append(raw_data, count * matrix_size);
 )~~~");
+            generate_deferred_gl_call(function_impl_generator, { "location_handle = location->handle()", "count", "transpose", "values = move(values)" }, ByteString::formatted("glUniformMatrix{}fv(location_handle, count, transpose, values.data())", number_of_matrix_elements));
+            defers_gl_calls = true;
             continue;
         }
 
@@ -1543,9 +1573,13 @@ public:
 )~~~");
             }
 
+            // NOTE: The values are copied, as the array they come from may change before the GPU thread gets to them.
             function_impl_generator.append(R"~~~(
-    glUniform@number_of_vector_elements@@gl_postfix@v(location->handle(), count / @number_of_vector_elements@, data);
+    Vector<@cpp_element_type@> values;
+    values.append(data, count);
 )~~~");
+            generate_deferred_gl_call(function_impl_generator, { "location_handle = location->handle()", "count", "values = move(values)" }, ByteString::formatted("glUniform{}{}v(location_handle, count / {}, values.data())", number_of_vector_elements, element_type, number_of_vector_elements));
+            defers_gl_calls = true;
             continue;
         }
 
@@ -1568,9 +1602,8 @@ public:
         }
 
         if (function.name == "vertexAttribIPointer"sv) {
-            function_impl_generator.append(R"~~~(
-    glVertexAttribIPointer(index, size, type, stride, reinterpret_cast<void*>(offset));
-)~~~");
+            generate_deferred_gl_call(function_impl_generator, { "index", "size", "type", "stride", "offset" }, "glVertexAttribIPointer(index, size, type, stride, reinterpret_cast<void*>(offset))"sv);
+            defers_gl_calls = true;
             continue;
         }
 
@@ -1793,36 +1826,33 @@ public:
         set_error(GL_INVALID_ENUM);
         return;
     }
-
-    glBindBuffer(target, buffer_handle);
 )~~~");
+            generate_deferred_gl_call(function_impl_generator, { "target", "buffer_handle" }, "glBindBuffer(target, buffer_handle)"sv);
+            defers_gl_calls = true;
             continue;
         }
 
         if (function.name == "useProgram"sv) {
             generate_webgl_object_handle_unwrap(function_impl_generator, "program"sv, ""sv);
-            function_impl_generator.append(R"~~~(
-    glUseProgram(program_handle);
-    m_current_program = program;
-)~~~");
+            generate_deferred_gl_call(function_impl_generator, { "program_handle" }, "glUseProgram(program_handle)"sv);
+            function_impl_generator.append("    m_current_program = program;\n"sv);
+            defers_gl_calls = true;
             continue;
         }
 
         if (function.name == "bindFramebuffer"sv) {
             generate_webgl_object_handle_unwrap(function_impl_generator, "framebuffer"sv, ""sv);
-            function_impl_generator.append(R"~~~(
-    glBindFramebuffer(target, framebuffer ? framebuffer_handle : m_context->default_framebuffer());
-    m_framebuffer_binding = framebuffer;
-)~~~");
+            generate_deferred_gl_call(function_impl_generator, { "target", "framebuffer_handle = framebuffer ? framebuffer_handle : m_context->default_framebuffer()" }, "glBindFramebuffer(target, framebuffer_handle)"sv);
+            function_impl_generator.append("    m_framebuffer_binding = framebuffer;\n"sv);
+            defers_gl_calls = true;
             continue;
         }
 
         if (function.name == "bindRenderbuffer"sv) {
             generate_webgl_object_handle_unwrap(function_impl_generator, "renderbuffer"sv, ""sv);
-            function_impl_generator.append(R"~~~(
-    glBindRenderbuffer(target, renderbuffer ? renderbuffer_handle : m_context->default_renderbuffer());
-    m_renderbuffer_binding = renderbuffer;
-)~~~");
+            generate_deferred_gl_call(function_impl_generator, { "target", "renderbuffer_handle = renderbuffer ? renderbuffer_handle : m_context->default_renderbuffer()" }, "glBindRenderbuffer(target, renderbuffer_handle)"sv);
+            function_impl_generator.append("    m_renderbuffer_binding = renderbuffer;\n"sv);
+            defers_gl_calls = true;
             continue;
         }
 
@@ -1855,8 +1885,9 @@ public:
         set_error(GL_INVALID_ENUM);
         return;
     }
-    glBindTexture(target, texture_handle);
 )~~~");
+            generate_deferred_gl_call(function_impl_generator, { "target", "texture_handle" }, "glBindTexture(target, texture_handle)"sv);
+            defers_gl_calls = true;
             continue;
         }
 
@@ -1985,6 +2016,14 @@ public:
             continue;
         }
 
+        // NOTE: Calls that return nothing and only take values are queued for the GPU thread. Calls that read from strings
+        //       or buffers stay synchronous, as does finish(), which has to wait for the GPU.
+        bool can_defer_gl_call = function.return_type->name() == "undefined"sv && function.name != "finish"sv;
+        for (auto const& parameter : function.parameters) {
+            if (parameter.type->is_string() || parameter.type->name() == "BufferSource"sv || parameter.type->name() == "ArrayBufferView"sv)
+                can_defer_gl_call = false;
+        }
+
         Vector<ByteString> gl_call_arguments;
         for (size_t i = 0; i < function.parameters.size(); ++i) {
             auto const& parameter = function.parameters[i];
@@ -2027,12 +2066,20 @@ public:
                 continue;
             }
             if (parameter.type->name() == "WebGLUniformLocation"sv) {
-                gl_call_arguments.append(ByteString::formatted("{} ? {}->handle() : 0", parameter_name, parameter_name));
+                function_impl_generator.set("parameter_name", parameter_name);
+                function_impl_generator.append(R"~~~(
+    auto @parameter_name@_handle = @parameter_name@ ? @parameter_name@->handle() : 0;
+)~~~");
+                gl_call_arguments.append(ByteString::formatted("{}_handle", parameter_name));
                 continue;
             }
             if (parameter.type->name() == "WebGLSync"sv) {
                 // FIXME: Remove the GLsync cast once sync_handle actually returns the proper GLsync type.
-                gl_call_arguments.append(ByteString::formatted("(GLsync)({} ? {}->sync_handle() : nullptr)", parameter_name, parameter_name));
+                function_impl_generator.set("parameter_name", parameter_name);
+                function_impl_generator.append(R"~~~(
+    auto @parameter_name@_handle = (GLsync)(@parameter_name@ ? @parameter_name@->sync_handle() : nullptr);
+)~~~");
+                gl_call_arguments.append(ByteString::formatted("{}_handle", parameter_name));
                 continue;
             }
             if (parameter.type->name() == "BufferSource"sv) {
@@ -2084,6 +2131,12 @@ public:
             function_impl_generator.append("    needs_to_present();\n"sv);
         }
 
+        if (can_defer_gl_call) {
+            generate_deferred_gl_call(function_impl_generator, gl_call_arguments, gl_call_string);
+            defers_gl_calls = true;
+            continue;
+        }
+
         if (function.return_type->name() == "undefined"sv) {
             function_impl_generator.append("    @call_string@;"sv);
         } else if (function.return_type->is_integer() || function.return_type->is_boolean()) {
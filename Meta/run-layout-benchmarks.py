@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+
+# Runs the benchmark pages in Tests/LibWeb/Benchmarks through headless-browser and reports the median (p50) and 95th
+# percentile (p95) of every measurement they report. Layout benchmarks report the time spent per frame updating
+# style, updating layout, and recording the display list (painting); script benchmarks report the time taken by each
+# of their cases (HTML parsing, DOM API calls).
+#
+# headless-browser only knows how to run pages that live in a test root, so the benchmark pages are copied into
+# the text tests of a temporary test root. Each page reports its samples by calling internals.signalTestIsDone(),
+# and --rebaseline makes headless-browser write that report to the expectation file, where we pick it up.
+
+import argparse
+import json
+import os
+import platform
+import shutil
+import subprocess
+import sys
+import tempfile
+
+from pathlib import Path
+
+LADYBIRD_SOURCE_DIR = Path(__file__).resolve().parent.parent
+BENCHMARKS_DIR = LADYBIRD_SOURCE_DIR / 'Tests' / 'LibWeb' / 'Benchmarks'
+
+
+def default_headless_browser_path():
+    build_dir = LADYBIRD_SOURCE_DIR / 'Build' / 'release'
+    if platform.system() == 'Darwin':
+        return build_dir / 'bin' / 'Ladybird.app' / 'Contents' / 'MacOS' / 'headless-browser'
+    return build_dir / 'bin' / 'headless-browser'
+
+
+def percentile(samples, fraction):
+    if not samples:
+        return 0.0
+    ordered = sorted(samples)
+    index = min(len(ordered) - 1, max(0, round(fraction * (len(ordered) - 1))))
+    return ordered[index]
+
+
+def create_test_root(directory):
+    test_root = Path(directory)
+    for test_type in ['Layout', 'Ref', 'Screenshot']:
+        (test_root / test_type / 'input').mkdir(parents=True)
+    (test_root / 'Crash').mkdir()
+    # headless-browser resolves symlinks before matching test paths against the filter, so copy the pages.
+    shutil.copytree(BENCHMARKS_DIR, test_root / 'Text' / 'input')
+    return test_root
+
+
+def run_benchmarks(headless_browser, test_root, benchmarks, timeout):
+    command = [
+        str(headless_browser),
+        '--run-tests', str(test_root),
+        '--rebaseline',
+        '--test-concurrency', '1',
+        '--per-test-timeout', str(timeout),
+    ]
+    for benchmark in benchmarks:
+        command += ['--filter', f'Text/input/{benchmark}.html']
+
+    subprocess.run(command, check=True, stdout=subprocess.DEVNULL)
+
+    results = {}
+    for benchmark in benchmarks:
+        report_path = test_root / 'Text' / 'expected' / f'{benchmark}.txt'
+        if not report_path.exists():
+            print(f'{benchmark}: no report was produced (did the page time out?)', file=sys.stderr)
+            continue
+        results[benchmark] = json.loads(report_path.read_text())['samples']
+        report_path.unlink()
+    return results
+
+
+def main():
+    available_benchmarks = sorted(path.stem for path in BENCHMARKS_DIR.glob('*.html'))
+
+    parser = argparse.ArgumentParser(description='Measure the LibWeb benchmark pages')
+    parser.add_argument('benchmarks', nargs='*', default=available_benchmarks,
+                        help=f'Benchmarks to run (default: all of {", ".join(available_benchmarks)})')
+    parser.add_argument('--headless-browser', type=Path,
+                        default=Path(os.environ.get('HEADLESS_BROWSER_BINARY', default_headless_browser_path())),
+                        help='Path to the headless-browser binary')
+    parser.add_argument('--runs', type=int, default=3, help='Number of times to load each page (default: 3)')
+    parser.add_argument('--timeout', type=int, default=120, help='Per-page timeout in seconds (default: 120)')
+    parser.add_argument('--json', action='store_true', help='Print the results as JSON instead of a table')
+    args = parser.parse_args()
+
+    for benchmark in args.benchmarks:
+        if benchmark not in available_benchmarks:
+            parser.error(f'Unknown benchmark "{benchmark}"')
+
+    if not args.headless_browser.exists():
+        parser.error(f'Could not find headless-browser at {args.headless_browser}; build it or pass --headless-browser')
+
+    samples = {benchmark: {} for benchmark in args.benchmarks}
+
+    with tempfile.TemporaryDirectory() as directory:
+        test_root = create_test_root(directory)
+        for _ in range(args.runs):
+            for benchmark, run_samples in run_benchmarks(args.headless_browser, test_root, args.benchmarks,
+                                                         args.timeout).items():
+                for measurement, measurement_samples in run_samples.items():
+                    samples[benchmark].setdefault(measurement, []).extend(measurement_samples)
+
+    summary = {
+        benchmark: {
+            measurement: {'p50': percentile(measurement_samples, 0.50), 'p95': percentile(measurement_samples, 0.95)}
+            for measurement, measurement_samples in benchmark_samples.items()
+        }
+        for benchmark, benchmark_samples in samples.items()
+    }
+
+    if args.json:
+        print(json.dumps(summary, indent=4))
+        return
+
+    header = f'{"benchmark":<20}{"measurement":<28}{"p50":>13}{"p95":>13}'
+    print(header)
+    print('-' * len(header))
+    for benchmark, measurements in summary.items():
+        for measurement, result in measurements.items():
+            print(f'{benchmark:<20}{measurement:<28}{result["p50"]:>11.3f}ms{result["p95"]:>11.3f}ms')
+
+
+if __name__ == '__main__':
+    main()
@@ -11,12 +11,22 @@
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibGfx/ImageFormats/TIFFMetadata.h>
+#include <LibGfx/ImmutableBitmap.h>
+#include <LibGfx/Painter.h>
 
 namespace ImageDecoder {
 
 static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
 static IDAllocator s_client_ids;
 
+// Animations whose frames would take up more than this much memory are decoded a few frames at a time, on demand.
+static constexpr u64 maximum_eagerly_decoded_animation_size = 32 * MiB;
+static constexpr size_t initially_decoded_frame_count = 8;
+
+// Decoding a partial image starts over from the beginning of its data, so we only do it again once a good amount of
+// additional data has arrived.
+static constexpr size_t minimum_data_growth_between_partial_decodes = 64 * KiB;
+
 ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transport)
     : IPC::ConnectionFromClient<ImageDecoderClientEndpoint, ImageDecoderServerEndpoint>(*this, move(transport), s_client_ids.allocate())
 {
@@ -29,6 +39,8 @@ void ConnectionFromClient::die()
         job->cancel();
     }
     m_pending_jobs.clear();
+    m_animation_decoders.clear();
+    m_incremental_decodes.clear();
 
     auto client_id = this->client_id();
     s_connections.remove(client_id);
@@ -84,21 +96,63 @@ Messages::ImageDecoderServer::ConnectNewClientsResponse ConnectionFromClient::co
     return files;
 }
 
-static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations)
+// Most decoders can only decode images at their natural size, so frames that are larger than the ideal size are scaled
+// down afterwards. Each step at most halves the bitmap, as resampling by much more than that discards detail unevenly.
+static ErrorOr<NonnullRefPtr<Gfx::Bitmap>> scale_down_to_ideal_size(NonnullRefPtr<Gfx::Bitmap> bitmap, Optional<Gfx::IntSize> ideal_size)
+{
+    if (!ideal_size.has_value() || ideal_size->is_empty())
+        return bitmap;
+
+    if (bitmap->size() == *ideal_size || bitmap->width() < ideal_size->width() || bitmap->height() < ideal_size->height())
+        return bitmap;
+
+    while (bitmap->size() != *ideal_size) {
+        Gfx::IntSize step_size {
+            max(ideal_size->width(), ceil_div(bitmap->width(), 2)),
+            max(ideal_size->height(), ceil_div(bitmap->height(), 2)),
+        };
+
+        auto scaled_bitmap = TRY(Gfx::Bitmap::create(bitmap->format(), bitmap->alpha_type(), step_size));
+        auto painter = Gfx::Painter::create(scaled_bitmap);
+        painter->draw_bitmap(scaled_bitmap->rect().to_type<float>(), Gfx::ImmutableBitmap::create(bitmap), bitmap->rect(), Gfx::ScalingMode::BoxSampling, {}, 1.0f, Gfx::CompositingAndBlendingOperator::Normal);
+        bitmap = move(scaled_bitmap);
+    }
+
+    return bitmap;
+}
+
+static void decode_image_to_bitmaps_and_durations_with_decoder(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size, size_t first_frame_index, size_t frame_count, Vector<RefPtr<Gfx::Bitmap>>& bitmaps, Vector<u32>& durations)
 {
-    for (size_t i = 0; i < decoder.frame_count(); ++i) {
+    auto end_frame_index = min(first_frame_index + frame_count, decoder.frame_count());
+    for (size_t i = first_frame_index; i < end_frame_index; ++i) {
         auto frame_or_error = decoder.frame(i, ideal_size);
         if (frame_or_error.is_error()) {
             bitmaps.append({});
             durations.append(0);
         } else {
             auto frame = frame_or_error.release_value();
-            bitmaps.append(frame.image.release_nonnull());
+            auto bitmap_or_error = scale_down_to_ideal_size(frame.image.release_nonnull(), ideal_size);
+            if (bitmap_or_error.is_error()) {
+                bitmaps.append({});
+                durations.append(0);
+                continue;
+            }
+            bitmaps.append(bitmap_or_error.release_value());
             durations.append(frame.duration);
         }
     }
 }
 
+static bool should_decode_frames_on_demand(Gfx::ImageDecoder const& decoder, Optional<Gfx::IntSize> ideal_size)
+{
+    if (!decoder.is_animated() || decoder.frame_count() <= initially_decoded_frame_count)
+        return false;
+
+    auto frame_size = ideal_size.value_or(decoder.size());
+    auto animation_size = static_cast<u64>(frame_size.width()) * static_cast<u64>(frame_size.height()) * sizeof(Gfx::ARGB32) * decoder.frame_count();
+    return animation_size > maximum_eagerly_decoded_animation_size;
+}
+
 static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core::AnonymousBuffer const& encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> const& known_mime_type)
 {
     auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() }, known_mime_type));
@@ -112,6 +166,7 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
     ConnectionFromClient::DecodeResult result;
     result.is_animated = decoder->is_animated();
     result.loop_count = decoder->loop_count();
+    result.frame_count = decoder->frame_count();
 
     if (auto maybe_icc_data = decoder->color_space(); !maybe_icc_data.is_error())
         result.color_profile = maybe_icc_data.value();
@@ -132,7 +187,13 @@ static ErrorOr<ConnectionFromClient::DecodeResult> decode_image_to_details(Core:
         }
     }
 
-    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, move(ideal_size), bitmaps, result.durations);
+    auto frame_count = decoder->frame_count();
+    if (should_decode_frames_on_demand(*decoder, ideal_size)) {
+        frame_count = initially_decoded_frame_count;
+        result.animation_decoder = adopt_ref(*new ConnectionFromClient::AnimationDecoder(*decoder, encoded_buffer, ideal_size));
+    }
+
+    decode_image_to_bitmaps_and_durations_with_decoder(*decoder, ideal_size, 0, frame_count, bitmaps, result.durations);
 
     if (bitmaps.is_empty())
         return Error::from_string_literal("Could not decode image");
@@ -149,7 +210,9 @@ NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image
             return TRY(decode_image_to_details(encoded_buffer, ideal_size, mime_type));
         },
         [strong_this = NonnullRefPtr(*this), image_id](DecodeResult result) -> ErrorOr<void> {
-            strong_this->async_did_decode_image(image_id, result.is_animated, result.loop_count, move(result.bitmaps), move(result.durations), result.scale, move(result.color_profile));
+            if (result.animation_decoder)
+                strong_this->m_animation_decoders.set(image_id, result.animation_decoder.release_nonnull());
+            strong_this->async_did_decode_image(image_id, result.is_animated, result.loop_count, move(result.bitmaps), move(result.durations), result.scale, move(result.color_profile), result.frame_count);
             strong_this->m_pending_jobs.remove(image_id);
             return {};
         },
@@ -160,6 +223,62 @@ NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_image
         });
 }
 
+NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_frames_job(i64 image_id, NonnullRefPtr<AnimationDecoder> animation_decoder, u32 first_frame_index, u32 count)
+{
+    return Job::construct(
+        [animation_decoder = move(animation_decoder), first_frame_index, count](auto&) -> ErrorOr<DecodeResult> {
+            DecodeResult result;
+            Vector<RefPtr<Gfx::Bitmap>> bitmaps;
+            decode_image_to_bitmaps_and_durations_with_decoder(*animation_decoder->decoder, animation_decoder->ideal_size, first_frame_index, count, bitmaps, result.durations);
+            result.bitmaps = Gfx::BitmapSequence { move(bitmaps) };
+            return result;
+        },
+        [strong_this = NonnullRefPtr(*this), image_id, first_frame_index](DecodeResult result) -> ErrorOr<void> {
+            strong_this->async_did_decode_frames(image_id, first_frame_index, move(result.bitmaps), move(result.durations));
+            strong_this->m_pending_jobs.remove(image_id);
+            return {};
+        },
+        [strong_this = NonnullRefPtr(*this), image_id, first_frame_index](Error error) -> void {
+            // NOTE: Cancelled jobs report their cancellation from the background thread.
+            if (error.is_errno() && error.code() == ECANCELED)
+                return;
+
+            dbgln("Decoding frames of image {} failed: {}", image_id, error);
+            if (strong_this->is_open())
+                strong_this->async_did_decode_frames(image_id, first_frame_index, {}, {});
+            strong_this->m_pending_jobs.remove(image_id);
+        });
+}
+
+NonnullRefPtr<ConnectionFromClient::Job> ConnectionFromClient::make_decode_partial_image_job(i64 image_id, Core::AnonymousBuffer encoded_buffer, Optional<ByteString> mime_type)
+{
+    return Job::construct(
+        [encoded_buffer = move(encoded_buffer), mime_type = move(mime_type)](auto&) -> ErrorOr<DecodeResult> {
+            auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(ReadonlyBytes { encoded_buffer.data<u8>(), encoded_buffer.size() }, mime_type));
+            if (!decoder)
+                return Error::from_string_literal("Could not find suitable image decoder plugin for data");
+
+            DecodeResult result;
+            result.bitmaps.bitmaps.append(TRY(decoder->partial_frame()));
+            return result;
+        },
+        [strong_this = NonnullRefPtr(*this), image_id](DecodeResult result) -> ErrorOr<void> {
+            strong_this->async_did_decode_partial_image(image_id, result.bitmaps.bitmaps.first()->to_shareable_bitmap());
+            strong_this->did_finish_decoding_partial_image(image_id);
+            return {};
+        },
+        [strong_this = NonnullRefPtr(*this), image_id](Error error) -> void {
+            // NOTE: Cancelled jobs report their cancellation from the background thread.
+            if (error.is_errno() && error.code() == ECANCELED)
+                return;
+
+            dbgln_if(IMAGE_DECODER_DEBUG, "Could not partially decode image {}: {}", image_id, error);
+            if (auto incremental_decode = strong_this->m_incremental_decodes.get(image_id); incremental_decode.has_value())
+                incremental_decode->can_decode_partially = false;
+            strong_this->did_finish_decoding_partial_image(image_id);
+        });
+}
+
 Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_image(Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type)
 {
     auto image_id = m_next_image_id++;
@@ -177,9 +296,118 @@ Messages::ImageDecoderServer::DecodeImageResponse ConnectionFromClient::decode_i
 
 void ConnectionFromClient::cancel_decoding(i64 image_id)
 {
+    m_incremental_decodes.remove(image_id);
+
     if (auto job = m_pending_jobs.take(image_id); job.has_value()) {
         job.value()->cancel();
     }
 }
 
+void ConnectionFromClient::request_frames(i64 image_id, u32 first_frame_index, u32 count)
+{
+    auto animation_decoder = m_animation_decoders.get(image_id);
+    if (!animation_decoder.has_value()) {
+        dbgln_if(IMAGE_DECODER_DEBUG, "No animation decoder for image {}", image_id);
+        async_did_decode_frames(image_id, first_frame_index, {}, {});
+        return;
+    }
+
+    // NOTE: Clients only ask for more frames once their previous request has been answered.
+    if (m_pending_jobs.contains(image_id)) {
+        dbgln("Frames of image {} are already being decoded", image_id);
+        return;
+    }
+
+    m_pending_jobs.set(image_id, make_decode_frames_job(image_id, *animation_decoder.value(), first_frame_index, count));
+}
+
+void ConnectionFromClient::release_image(i64 image_id)
+{
+    cancel_decoding(image_id);
+    m_animation_decoders.remove(image_id);
+}
+
+Messages::ImageDecoderServer::StartIncrementalDecodingResponse ConnectionFromClient::start_incremental_decoding(Optional<ByteString> mime_type)
+{
+    auto image_id = m_next_image_id++;
+    m_incremental_decodes.set(image_id, { .mime_type = move(mime_type) });
+    return image_id;
+}
+
+void ConnectionFromClient::append_incremental_data(i64 image_id, ByteBuffer data)
+{
+    auto incremental_decode = m_incremental_decodes.get(image_id);
+    if (!incremental_decode.has_value() || incremental_decode->has_all_data)
+        return;
+
+    incremental_decode->encoded_data.append(data);
+    decode_partial_image_if_needed(image_id);
+}
+
+void ConnectionFromClient::finish_incremental_decoding(i64 image_id)
+{
+    auto incremental_decode = m_incremental_decodes.get(image_id);
+    if (!incremental_decode.has_value())
+        return;
+
+    incremental_decode->has_all_data = true;
+
+    // A partial decode that is still running is left to finish first, as it uses the only background thread.
+    if (!m_pending_jobs.contains(image_id))
+        decode_incrementally_decoded_image(image_id);
+}
+
+void ConnectionFromClient::decode_partial_image_if_needed(i64 image_id)
+{
+    if (m_pending_jobs.contains(image_id))
+        return;
+
+    auto& incremental_decode = m_incremental_decodes.get(image_id).value();
+    if (!incremental_decode.can_decode_partially)
+        return;
+
+    auto encoded_size = incremental_decode.encoded_data.size();
+    auto last_encoded_size = incremental_decode.encoded_size_at_last_partial_decode;
+    if (encoded_size - last_encoded_size < max(minimum_data_growth_between_partial_decodes, last_encoded_size / 4))
+        return;
+
+    auto encoded_buffer = Core::AnonymousBuffer::create_with_size(encoded_size);
+    if (encoded_buffer.is_error()) {
+        dbgln("Could not allocate buffer to partially decode image {}: {}", image_id, encoded_buffer.error());
+        return;
+    }
+    memcpy(encoded_buffer.value().data<void>(), incremental_decode.encoded_data.data(), encoded_size);
+
+    incremental_decode.encoded_size_at_last_partial_decode = encoded_size;
+    m_pending_jobs.set(image_id, make_decode_partial_image_job(image_id, encoded_buffer.release_value(), incremental_decode.mime_type));
+}
+
+void ConnectionFromClient::did_finish_decoding_partial_image(i64 image_id)
+{
+    m_pending_jobs.remove(image_id);
+
+    auto incremental_decode = m_incremental_decodes.get(image_id);
+    if (!incremental_decode.has_value())
+        return;
+
+    if (incremental_decode->has_all_data)
+        decode_incrementally_decoded_image(image_id);
+    else
+        decode_partial_image_if_needed(image_id);
+}
+
+void ConnectionFromClient::decode_incrementally_decoded_image(i64 image_id)
+{
+    auto incremental_decode = m_incremental_decodes.take(image_id).release_value();
+
+    auto encoded_buffer = Core::AnonymousBuffer::create_with_size(incremental_decode.encoded_data.size());
+    if (encoded_buffer.is_error() || !encoded_buffer.value().is_valid()) {
+        async_did_fail_to_decode_image(image_id, "Encoded data is invalid"_string);
+        return;
+    }
+    memcpy(encoded_buffer.value().data<void>(), incremental_decode.encoded_data.data(), incremental_decode.encoded_data.size());
+
+    m_pending_jobs.set(image_id, make_decode_image_job(image_id, encoded_buffer.release_value(), {}, move(incremental_decode.mime_type)));
+}
+
 }
@@ -6,12 +6,14 @@
 
 #pragma once
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/HashMap.h>
 #include <ImageDecoder/Forward.h>
 #include <ImageDecoder/ImageDecoderClientEndpoint.h>
 #include <ImageDecoder/ImageDecoderServerEndpoint.h>
 #include <LibGfx/BitmapSequence.h>
 #include <LibGfx/ColorSpace.h>
+#include <LibGfx/ImageFormats/ImageDecoder.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibThreading/BackgroundAction.h>
 
@@ -26,13 +28,30 @@ public:
 
     virtual void die() override;
 
+    // The decoder of an animated image that is too large to be decoded all at once, kept alive to decode further
+    // frames whenever the client asks for them. It is only ever used from the background thread.
+    struct AnimationDecoder : public AtomicRefCounted<AnimationDecoder> {
+        AnimationDecoder(NonnullRefPtr<Gfx::ImageDecoder> decoder, Core::AnonymousBuffer encoded_buffer, Optional<Gfx::IntSize> ideal_size)
+            : decoder(move(decoder))
+            , encoded_buffer(move(encoded_buffer))
+            , ideal_size(ideal_size)
+        {
+        }
+
+        NonnullRefPtr<Gfx::ImageDecoder> decoder;
+        Core::AnonymousBuffer encoded_buffer;
+        Optional<Gfx::IntSize> ideal_size;
+    };
+
     struct DecodeResult {
         bool is_animated = false;
         u32 loop_count = 0;
+        u32 frame_count = 0;
         Gfx::FloatPoint scale { 1, 1 };
         Gfx::BitmapSequence bitmaps;
         Vector<u32> durations;
         Gfx::ColorSpace color_profile;
+        RefPtr<AnimationDecoder> animation_decoder;
     };
 
 private:
@@ -42,15 +61,36 @@ private:
 
     virtual Messages::ImageDecoderServer::DecodeImageResponse decode_image(Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type) override;
     virtual void cancel_decoding(i64 image_id) override;
+    virtual void request_frames(i64 image_id, u32 first_frame_index, u32 count) override;
+    virtual void release_image(i64 image_id) override;
+    virtual Messages::ImageDecoderServer::StartIncrementalDecodingResponse start_incremental_decoding(Optional<ByteString> mime_type) override;
+    virtual void append_incremental_data(i64 image_id, ByteBuffer data) override;
+    virtual void finish_incremental_decoding(i64 image_id) override;
     virtual Messages::ImageDecoderServer::ConnectNewClientsResponse connect_new_clients(size_t count) override;
     virtual Messages::ImageDecoderServer::InitTransportResponse init_transport(int peer_pid) override;
 
     ErrorOr<IPC::File> connect_new_client();
 
     NonnullRefPtr<Job> make_decode_image_job(i64 image_id, Core::AnonymousBuffer, Optional<Gfx::IntSize> ideal_size, Optional<ByteString> mime_type);
+    NonnullRefPtr<Job> make_decode_frames_job(i64 image_id, NonnullRefPtr<AnimationDecoder>, u32 first_frame_index, u32 count);
+    NonnullRefPtr<Job> make_decode_partial_image_job(i64 image_id, Core::AnonymousBuffer, Optional<ByteString> mime_type);
+
+    void decode_partial_image_if_needed(i64 image_id);
+    void did_finish_decoding_partial_image(i64 image_id);
+    void decode_incrementally_decoded_image(i64 image_id);
 
     i64 m_next_image_id { 0 };
     HashMap<i64, NonnullRefPtr<Job>> m_pending_jobs;
+    HashMap<i64, NonnullRefPtr<AnimationDecoder>> m_animation_decoders;
+
+    struct IncrementalDecode {
+        Optional<ByteString> mime_type;
+        ByteBuffer encoded_data;
+        size_t encoded_size_at_last_partial_decode { 0 };
+        bool can_decode_partially { true };
+        bool has_all_data { false };
+    };
+    HashMap<i64, IncrementalDecode> m_incremental_decodes;
 };
 
 }
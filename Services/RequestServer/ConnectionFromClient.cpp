@@ -7,6 +7,8 @@
 #include "WebSocketImplCurl.h"
 
 #include <AK/Badge.h>
+#include <AK/CharacterTypes.h>
+#include <AK/GenericLexer.h>
 #include <AK/IDAllocator.h>
 #include <AK/NonnullOwnPtr.h>
 #include <LibCore/ElapsedTimer.h>
@@ -18,9 +20,11 @@
 #include <LibRequests/WebSocket.h>
 #include <LibTLS/TLSv12.h>
 #include <LibTextCodec/Decoder.h>
+#include <LibURL/Parser.h>
 #include <LibWebSocket/ConnectionInfo.h>
 #include <LibWebSocket/Message.h>
 #include <RequestServer/ConnectionFromClient.h>
+#include <RequestServer/NetworkStatistics.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #ifdef AK_OS_WINDOWS
 // needed because curl.h includes winsock2.h
@@ -31,9 +35,21 @@
 namespace RequestServer {
 
 ByteString g_default_certificate_path;
+OwnPtr<DiskCache> g_disk_cache;
 static HashMap<int, RefPtr<ConnectionFromClient>> s_connections;
 static IDAllocator s_client_ids;
 static long s_connect_timeout_seconds = 90L;
+
+// The default pipe capacity on Linux is 64 KiB, which is less than a single curl write callback may deliver, so large
+// bodies stall on every chunk until the client has drained the pipe.
+static constexpr int s_response_pipe_capacity = 1 * MiB;
+
+// While high priority requests are in flight, only this many low priority requests may compete with them for bandwidth.
+static constexpr size_t s_max_low_priority_requests_during_high_priority_requests = 2;
+
+// Warming up a connection to an origin that we have just warmed up would only waste a socket.
+static constexpr auto s_connection_warm_up_interval = AK::Duration::from_seconds(10);
+
 static struct {
     Optional<Core::SocketAddress> server_address;
     Optional<ByteString> server_hostname;
@@ -104,17 +120,36 @@ struct ConnectionFromClient::ActiveRequest {
     CURL* easy { nullptr };
     Vector<curl_slist*> curl_string_lists;
     i32 request_id { 0 };
+    Requests::RequestPriority priority { Requests::RequestPriority::Normal };
     RefPtr<Core::Notifier> notifier;
     WeakPtr<ConnectionFromClient> client;
     int writer_fd { 0 };
     HTTP::HeaderMap headers;
     bool got_all_headers { false };
     bool is_connect_only { false };
+    bool is_receiving_informational_response { false };
     size_t downloaded_so_far { 0 };
     String url;
     Optional<String> reason_phrase;
     ByteBuffer body;
 
+    // State for storing the response in the disk cache, or for validating a stale cached response.
+    URL::URL url_for_disk_cache;
+    ByteString method;
+    HTTP::HeaderMap request_headers;
+    UnixDateTime request_time;
+    UnixDateTime response_time;
+    u32 status_code { 0 };
+    Optional<DiskCache::CachedResponse> cached_response;
+    bool did_revalidate_cached_response { false };
+    bool should_store_in_disk_cache { false };
+    ByteBuffer body_for_disk_cache;
+
+    // The parts of the request's waterfall that curl does not measure for us.
+    String origin;
+    AK::Duration domain_lookup_duration;
+    AK::Duration delivery_duration;
+
     ActiveRequest(ConnectionFromClient& client, CURLM* multi, CURL* easy, i32 request_id, int writer_fd)
         : multi(multi)
         , easy(easy)
@@ -129,6 +164,9 @@ struct ConnectionFromClient::ActiveRequest {
         if (writer_fd > 0)
             MUST(Core::System::close(writer_fd));
 
+        if (!is_connect_only)
+            NetworkStatistics::the().did_end_transfer();
+
         auto result = curl_multi_remove_handle(multi, easy);
         VERIFY(result == CURLM_OK);
         curl_easy_cleanup(easy);
@@ -145,16 +183,187 @@ struct ConnectionFromClient::ActiveRequest {
         long http_status_code = 0;
         auto result = curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &http_status_code);
         VERIFY(result == CURLE_OK);
-        client->async_headers_became_available(request_id, headers, http_status_code, reason_phrase);
+        status_code = http_status_code;
+        response_time = UnixDateTime::now();
+
+        if (g_disk_cache && !is_connect_only) {
+            if (status_code == 304 && cached_response.has_value()) {
+                // The stored response is still valid, so we serve it with its headers updated by the 304 response.
+                headers = g_disk_cache->freshen_response(url_for_disk_cache, request_headers, *cached_response, headers, request_time, response_time);
+                status_code = cached_response->status_code;
+                reason_phrase = cached_response->reason_phrase;
+                did_revalidate_cached_response = true;
+                NetworkStatistics::the().did_revalidate_cached_response();
+            } else {
+                if (cached_response.has_value())
+                    NetworkStatistics::the().did_miss_disk_cache();
+                cached_response.clear();
+                should_store_in_disk_cache = DiskCache::may_store_response(method, request_headers, status_code, headers);
+            }
+        }
+
+        client->queue_headers_became_available(request_id, headers, status_code, reason_phrase);
+    }
+
+    void append_to_body_for_disk_cache(ReadonlyBytes data)
+    {
+        if (!should_store_in_disk_cache)
+            return;
+
+        if (body_for_disk_cache.size() + data.size() > g_disk_cache->maximum_entry_size()) {
+            should_store_in_disk_cache = false;
+            body_for_disk_cache.clear();
+            return;
+        }
+
+        body_for_disk_cache.append(data);
     }
 };
 
+// TLS sessions are shared by the transfers of all clients, so that a connection to an origin that any client has
+// talked to before can resume the previous session instead of going through a full handshake.
+static CURLSH* tls_session_share()
+{
+    static CURLSH* s_share = [] {
+        auto* share = curl_share_init();
+        VERIFY(share);
+
+        // NOTE: RequestServer drives curl from a single thread, so we don't need to provide locking callbacks.
+        auto result = curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        VERIFY(result == CURLSHE_OK);
+        return share;
+    }();
+    return s_share;
+}
+
+static ErrorOr<Array<int, 2>> create_response_pipe()
+{
+    auto fds = TRY(Core::System::pipe2(O_NONBLOCK));
+
+#if defined(AK_OS_LINUX)
+    // NOTE: This is capped by /proc/sys/fs/pipe-max-size, so we just stick with the default capacity if it fails.
+    (void)Core::System::fcntl(fds[1], F_SETPIPE_SZ, s_response_pipe_capacity);
+#endif
+
+    return fds;
+}
+
+static void write_to_pipe(int fd, ReadonlyBytes bytes)
+{
+    while (!bytes.is_empty()) {
+        auto result = Core::System::write(fd, bytes);
+        if (result.is_error()) {
+            if (result.error().code() != EAGAIN) {
+                dbgln("write_to_pipe: write failed: {}", result.error());
+                VERIFY_NOT_REACHED();
+            }
+            sched_yield();
+            continue;
+        }
+        auto nwritten = result.value();
+        if (nwritten == 0) {
+            dbgln("write_to_pipe: write returned 0");
+            VERIFY_NOT_REACHED();
+        }
+        bytes = bytes.slice(nwritten);
+    }
+}
+
+// https://httpwg.org/specs/rfc8288.html#header
+static Vector<StringView> preconnect_targets_from_link_header(StringView value)
+{
+    Vector<StringView> targets;
+    GenericLexer lexer { value };
+
+    auto is_end_of_token = [](char c) { return c == '=' || c == ';' || c == ',' || is_ascii_space(c); };
+
+    while (!lexer.is_eof()) {
+        lexer.ignore_while(is_ascii_space);
+        if (!lexer.consume_specific('<'))
+            break;
+
+        auto target = lexer.consume_until('>');
+        if (!lexer.consume_specific('>'))
+            break;
+
+        bool is_preconnect = false;
+
+        while (true) {
+            lexer.ignore_while(is_ascii_space);
+            if (!lexer.consume_specific(';'))
+                break;
+
+            lexer.ignore_while(is_ascii_space);
+            auto name = lexer.consume_until(is_end_of_token);
+            lexer.ignore_while(is_ascii_space);
+
+            StringView parameter_value;
+            if (lexer.consume_specific('=')) {
+                lexer.ignore_while(is_ascii_space);
+                if (lexer.consume_specific('"')) {
+                    parameter_value = lexer.consume_until('"');
+                    lexer.ignore();
+                } else {
+                    parameter_value = lexer.consume_until(is_end_of_token);
+                }
+            }
+
+            if (name.equals_ignoring_ascii_case("rel"sv)) {
+                for (auto relation : parameter_value.split_view_if(is_ascii_space)) {
+                    if (relation.equals_ignoring_ascii_case("preconnect"sv))
+                        is_preconnect = true;
+                }
+            }
+        }
+
+        if (is_preconnect)
+            targets.append(target);
+
+        lexer.ignore_until(',');
+        lexer.ignore();
+    }
+
+    return targets;
+}
+
 size_t ConnectionFromClient::on_header_received(void* buffer, size_t size, size_t nmemb, void* user_data)
 {
     auto* request = static_cast<ActiveRequest*>(user_data);
     size_t total_size = size * nmemb;
     auto header_line = StringView { static_cast<char const*>(buffer), total_size };
 
+    // NOTE: Informational (1xx) responses, such as 103 (Early Hints), arrive ahead of the final response. Their headers
+    //       are not part of it, but may tell us which origins the final response is going to need.
+    if (header_line.starts_with("HTTP/"sv)) {
+        auto status_line_parts = header_line.split_view(' ');
+        auto status_code = status_line_parts.size() > 1 ? status_line_parts[1].to_number<u32>() : Optional<u32> {};
+        request->is_receiving_informational_response = status_code.has_value() && *status_code >= 100 && *status_code < 200;
+    }
+
+    if (request->is_receiving_informational_response) {
+        auto colon_index = header_line.find(':');
+        if (!colon_index.has_value() || !header_line.substring_view(0, *colon_index).trim_whitespace().equals_ignoring_ascii_case("Link"sv))
+            return total_size;
+
+        auto base_url = URL::Parser::basic_parse(request->url);
+        if (!base_url.has_value())
+            return total_size;
+
+        for (auto target : preconnect_targets_from_link_header(header_line.substring_view(*colon_index + 1).trim_whitespace())) {
+            auto url = base_url->complete_url(target);
+            if (!url.has_value() || !url->scheme().is_one_of("http"sv, "https"sv))
+                continue;
+
+            // NOTE: curl does not allow adding transfers to the multi handle from within one of its callbacks.
+            Core::deferred_invoke([client = request->client, url = url.release_value()]() mutable {
+                if (client)
+                    client->ensure_connection(move(url), CacheLevel::CreateConnection);
+            });
+        }
+
+        return total_size;
+    }
+
     // NOTE: We need to extract the HTTP reason phrase since it can be a custom value.
     //       Fetching infrastructure needs this value for setting the status message.
     if (!request->reason_phrase.has_value() && header_line.starts_with("HTTP/"sv)) {
@@ -187,27 +396,15 @@ size_t ConnectionFromClient::on_data_received(void* buffer, size_t size, size_t
     request->flush_headers_if_needed();
 
     size_t total_size = size * nmemb;
+    ReadonlyBytes data { static_cast<u8 const*>(buffer), total_size };
 
-    size_t remaining_length = total_size;
-    u8 const* remaining_data = static_cast<u8 const*>(buffer);
-    while (remaining_length > 0) {
-        auto result = Core::System::write(request->writer_fd, { remaining_data, remaining_length });
-        if (result.is_error()) {
-            if (result.error().code() != EAGAIN) {
-                dbgln("on_data_received: write failed: {}", result.error());
-                VERIFY_NOT_REACHED();
-            }
-            sched_yield();
-            continue;
-        }
-        auto nwritten = result.value();
-        if (nwritten == 0) {
-            dbgln("on_data_received: write returned 0");
-            VERIFY_NOT_REACHED();
-        }
-        remaining_data += nwritten;
-        remaining_length -= nwritten;
-    }
+    // NOTE: The client must learn about the response headers before it reads any of the body.
+    request->client->flush_request_lifecycle_events();
+
+    auto delivery_start_time = MonotonicTime::now();
+    write_to_pipe(request->writer_fd, data);
+    request->delivery_duration += MonotonicTime::now() - delivery_start_time;
+    request->append_to_body_for_disk_cache(data);
 
     request->downloaded_so_far += total_size;
 
@@ -295,6 +492,7 @@ ConnectionFromClient::ConnectionFromClient(NonnullOwnPtr<IPC::Transport> transpo
 
 ConnectionFromClient::~ConnectionFromClient()
 {
+    m_deferred_requests.clear();
     m_active_requests.clear();
 
     curl_multi_cleanup(m_curl_multi);
@@ -384,26 +582,58 @@ void ConnectionFromClient::set_use_system_dns()
 }
 
 #ifdef AK_OS_WINDOWS
-void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData)
+void ConnectionFromClient::start_request(i32, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Requests::RequestPriority)
 {
     VERIFY(0 && "RequestServer::ConnectionFromClient::start_request is not implemented");
 }
 #else
-void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data)
+void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL::URL url, HTTP::HeaderMap request_headers, ByteBuffer request_body, Core::ProxyData proxy_data, Requests::RequestPriority priority)
 {
+    Optional<DiskCache::CachedResponse> cached_response;
+    if (g_disk_cache) {
+        cached_response = g_disk_cache->open_entry(url, method, request_headers);
+        if (cached_response.has_value() && cached_response->is_fresh) {
+            NetworkStatistics::the().did_serve_response_from_disk_cache(url.origin().serialize(), cached_response->body.size());
+            serve_response_from_disk_cache(request_id, cached_response.release_value());
+            return;
+        }
+    }
+
+    if (priority == Requests::RequestPriority::Low && should_defer_low_priority_request()) {
+        dbgln_if(REQUESTSERVER_DEBUG, "StartRequest: Deferring low priority request {} for {}", request_id, url);
+        m_deferred_requests.append({ request_id, move(method), move(url), move(request_headers), move(request_body), move(proxy_data) });
+        return;
+    }
+
+    if (g_disk_cache && !cached_response.has_value())
+        NetworkStatistics::the().did_miss_disk_cache();
+
+    auto request_time = UnixDateTime::now();
     auto host = url.serialized_host().to_byte_string();
 
+    did_start_resolving_host(priority);
+    auto domain_lookup_start_time = MonotonicTime::now();
+
     m_resolver->dns.lookup(host, DNS::Messages::Class::IN, { DNS::Messages::ResourceType::A, DNS::Messages::ResourceType::AAAA })
-        ->when_rejected([this, request_id](auto const& error) {
+        ->when_rejected([this, request_id, priority, url, domain_lookup_start_time](auto const& error) {
+            did_finish_resolving_host(priority);
+            NetworkStatistics::the().did_finish_request(url.origin().serialize(), { .url = url.to_string(), .domain_lookup = MonotonicTime::now() - domain_lookup_start_time, .failed = true });
+
             dbgln("StartRequest: DNS lookup failed: {}", error);
             // FIXME: Implement timing info for DNS lookup failure.
-            async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
+            queue_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
+            start_deferred_requests_if_possible();
         })
-        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data](auto const& dns_result) mutable {
+        .when_resolved([this, request_id, host = move(host), url = move(url), method = move(method), request_body = move(request_body), request_headers = move(request_headers), proxy_data, priority, cached_response = move(cached_response), request_time, domain_lookup_start_time](auto const& dns_result) mutable {
+            did_finish_resolving_host(priority);
+            auto domain_lookup_duration = MonotonicTime::now() - domain_lookup_start_time;
+
             if (dns_result->records().is_empty() || dns_result->cached_addresses().is_empty()) {
                 dbgln("StartRequest: DNS lookup failed for '{}'", host);
+                NetworkStatistics::the().did_finish_request(url.origin().serialize(), { .url = url.to_string(), .domain_lookup = domain_lookup_duration, .failed = true });
                 // FIXME: Implement timing info for DNS lookup failure.
-                async_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
+                queue_request_finished(request_id, 0, {}, Requests::NetworkError::UnableToResolveHost);
+                start_deferred_requests_if_possible();
                 return;
             }
 
@@ -413,7 +643,7 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
                 return;
             }
 
-            auto fds_or_error = Core::System::pipe2(O_NONBLOCK);
+            auto fds_or_error = create_response_pipe();
             if (fds_or_error.is_error()) {
                 dbgln("StartRequest: Failed to create pipe: {}", fds_or_error.error());
                 return;
@@ -426,6 +656,10 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
 
             auto request = make<ActiveRequest>(*this, m_curl_multi, easy, request_id, writer_fd);
             request->url = url.to_string();
+            request->priority = priority;
+            request->origin = url.origin().serialize();
+            request->domain_lookup_duration = domain_lookup_duration;
+            NetworkStatistics::the().did_start_transfer();
 
             auto set_option = [easy](auto option, auto value) {
                 auto result = curl_easy_setopt(easy, option, value);
@@ -437,17 +671,32 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             };
 
             set_option(CURLOPT_PRIVATE, request.ptr());
+            set_option(CURLOPT_SHARE, tls_session_share());
 
             if (!g_default_certificate_path.is_empty())
                 set_option(CURLOPT_CAINFO, g_default_certificate_path.characters());
 
-            set_option(CURLOPT_ACCEPT_ENCODING, "gzip, deflate, br");
+            // NOTE: An empty string makes curl advertise, and decode as the body streams in, every content encoding
+            //       it was built with, so that e.g. zstd is only offered if we are actually able to decode it.
+            set_option(CURLOPT_ACCEPT_ENCODING, "");
             set_option(CURLOPT_URL, url.to_string().to_byte_string().characters());
             set_option(CURLOPT_PORT, url.port_or_default());
             set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
 
+            // NOTE: Stream weights are how HTTP/2 servers that predate RFC 9218 learn about priorities. The default is 16.
+            if (priority == Requests::RequestPriority::High)
+                set_option(CURLOPT_STREAM_WEIGHT, 64L);
+            else if (priority == Requests::RequestPriority::Low)
+                set_option(CURLOPT_STREAM_WEIGHT, 4L);
+
             bool did_set_body = false;
 
+#ifdef CURLSSLOPT_EARLYDATA
+            // NOTE: TLS 1.3 early data may be replayed by an attacker, so we only send requests that are safe to repeat.
+            if (method.is_one_of("GET"sv, "HEAD"sv))
+                set_option(CURLOPT_SSL_OPTIONS, static_cast<long>(CURLSSLOPT_EARLYDATA));
+#endif
+
             if (method == "GET"sv) {
                 set_option(CURLOPT_HTTPGET, 1L);
             } else if (method.is_one_of("POST"sv, "PUT"sv, "PATCH"sv, "DELETE"sv)) {
@@ -486,6 +735,23 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
                 curl_headers = curl_slist_append(curl_headers, header_string.characters());
             }
 
+            // https://httpwg.org/specs/rfc9218.html#header
+            // NOTE: The default urgency is 3, so we only need to say something about requests that are more or less urgent.
+            if (priority != Requests::RequestPriority::Normal && !request_headers.contains("Priority"sv))
+                curl_headers = curl_slist_append(curl_headers, priority == Requests::RequestPriority::High ? "Priority: u=1" : "Priority: u=5");
+
+            // https://httpwg.org/specs/rfc9111.html#validation.sent
+            if (cached_response.has_value()) {
+                if (cached_response->etag.has_value()) {
+                    auto header_string = ByteString::formatted("If-None-Match: {}", *cached_response->etag);
+                    curl_headers = curl_slist_append(curl_headers, header_string.characters());
+                }
+                if (cached_response->last_modified.has_value()) {
+                    auto header_string = ByteString::formatted("If-Modified-Since: {}", *cached_response->last_modified);
+                    curl_headers = curl_slist_append(curl_headers, header_string.characters());
+                }
+            }
+
             if (curl_headers) {
                 set_option(CURLOPT_HTTPHEADER, curl_headers);
                 request->curl_string_lists.append(curl_headers);
@@ -507,6 +773,14 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
             } else
                 VERIFY_NOT_REACHED();
 
+            if (g_disk_cache) {
+                request->url_for_disk_cache = url;
+                request->method = method;
+                request->request_headers = move(request_headers);
+                request->request_time = request_time;
+                request->cached_response = move(cached_response);
+            }
+
             auto result = curl_multi_add_handle(m_curl_multi, easy);
             VERIFY(result == CURLM_OK);
 
@@ -515,6 +789,37 @@ void ConnectionFromClient::start_request(i32 request_id, ByteString method, URL:
 }
 #endif
 
+void ConnectionFromClient::serve_response_from_disk_cache(i32 request_id, DiskCache::CachedResponse cached_response)
+{
+    // Fresh responses are handed out from shared memory, so that clients loading the same resource share its pages.
+    if (!cached_response.body.is_empty()) {
+        if (auto shared_body = g_disk_cache->shared_body_for(cached_response); !shared_body.is_error()) {
+            queue_headers_became_available(request_id, cached_response.response_headers, cached_response.status_code, cached_response.reason_phrase);
+            flush_request_lifecycle_events();
+            async_request_body_available_in_shared_memory(request_id, shared_body.release_value());
+            queue_request_finished(request_id, cached_response.body.size(), {}, {});
+            return;
+        }
+    }
+
+    auto fds_or_error = create_response_pipe();
+    if (fds_or_error.is_error()) {
+        dbgln("StartRequest: Failed to create pipe: {}", fds_or_error.error());
+        queue_request_finished(request_id, 0, {}, Requests::NetworkError::Unknown);
+        return;
+    }
+
+    auto fds = fds_or_error.release_value();
+    async_request_started(request_id, IPC::File::adopt_fd(fds[0]));
+    queue_headers_became_available(request_id, cached_response.response_headers, cached_response.status_code, cached_response.reason_phrase);
+    flush_request_lifecycle_events();
+
+    write_to_pipe(fds[1], cached_response.body);
+    MUST(Core::System::close(fds[1]));
+
+    queue_request_finished(request_id, cached_response.body.size(), {}, {});
+}
+
 static Requests::NetworkError map_curl_code_to_network_error(CURLcode const& code)
 {
     switch (code) {
@@ -610,6 +915,45 @@ static Requests::RequestTimingInfo get_timing_info_from_curl_easy_handle(CURL* e
     };
 }
 
+static RequestWaterfall get_waterfall_from_curl_easy_handle(CURL* easy_handle)
+{
+    auto get_time = [easy_handle](auto option) {
+        curl_off_t time_value = 0;
+        auto result = curl_easy_getinfo(easy_handle, option, &time_value);
+        VERIFY(result == CURLE_OK);
+        return time_value;
+    };
+
+    // NOTE: curl measures every phase from the start of the transfer, and skips phases that did not happen (e.g. the
+    //       connect phase of a transfer that reused a connection), so phases may seem to end before they started.
+    auto duration_between = [](curl_off_t start, curl_off_t end) {
+        return AK::Duration::from_microseconds(end > start ? end - start : 0);
+    };
+
+    auto queue_time = get_time(CURLINFO_QUEUE_TIME_T);
+    auto domain_lookup_time = get_time(CURLINFO_NAMELOOKUP_TIME_T);
+    auto connect_time = get_time(CURLINFO_CONNECT_TIME_T);
+    auto secure_connect_time = get_time(CURLINFO_APPCONNECT_TIME_T);
+    auto request_start_time = get_time(CURLINFO_PRETRANSFER_TIME_T);
+    auto response_start_time = get_time(CURLINFO_STARTTRANSFER_TIME_T);
+    auto response_end_time = get_time(CURLINFO_TOTAL_TIME_T);
+    auto encoded_body_size = get_time(CURLINFO_SIZE_DOWNLOAD_T);
+
+    long new_connections = 0;
+    auto result = curl_easy_getinfo(easy_handle, CURLINFO_NUM_CONNECTS, &new_connections);
+    VERIFY(result == CURLE_OK);
+
+    return RequestWaterfall {
+        .queue = AK::Duration::from_microseconds(queue_time),
+        .connect = duration_between(domain_lookup_time, connect_time),
+        .secure_connect = secure_connect_time != 0 ? duration_between(connect_time, secure_connect_time) : AK::Duration {},
+        .time_to_first_byte = duration_between(request_start_time, response_start_time),
+        .download = duration_between(response_start_time, response_end_time),
+        .encoded_body_size = static_cast<u64>(encoded_body_size),
+        .reused_connection = new_connections == 0,
+    };
+}
+
 void ConnectionFromClient::check_active_requests()
 {
     int msgs_in_queue = 0;
@@ -660,21 +1004,129 @@ void ConnectionFromClient::check_active_requests()
                 }
             }
 
-            async_request_finished(request->request_id, request->downloaded_so_far, timing_info, network_error);
+            if (request_was_successful && request->did_revalidate_cached_response) {
+                flush_request_lifecycle_events();
+                write_to_pipe(request->writer_fd, request->cached_response->body);
+                request->downloaded_so_far = request->cached_response->body.size();
+            } else if (request_was_successful && request->should_store_in_disk_cache) {
+                g_disk_cache->store_response(request->url_for_disk_cache, request->request_headers, request->status_code, request->reason_phrase, request->headers, request->body_for_disk_cache, request->request_time, request->response_time);
+            }
+
+            queue_request_finished(request->request_id, request->downloaded_so_far, timing_info, network_error);
+
+            auto waterfall = get_waterfall_from_curl_easy_handle(msg->easy_handle);
+            waterfall.url = request->url;
+            waterfall.domain_lookup = request->domain_lookup_duration;
+            waterfall.delivery = request->delivery_duration;
+            waterfall.decoded_body_size = request->downloaded_so_far;
+            waterfall.failed = !request_was_successful;
+            NetworkStatistics::the().did_finish_request(request->origin, move(waterfall));
         }
 
         m_active_requests.remove(request->request_id);
     }
+
+    start_deferred_requests_if_possible();
+}
+
+void ConnectionFromClient::did_start_resolving_host(Requests::RequestPriority priority)
+{
+    if (priority == Requests::RequestPriority::High)
+        ++m_high_priority_requests_resolving_host;
+    else if (priority == Requests::RequestPriority::Low)
+        ++m_low_priority_requests_resolving_host;
+}
+
+void ConnectionFromClient::did_finish_resolving_host(Requests::RequestPriority priority)
+{
+    if (priority == Requests::RequestPriority::High)
+        --m_high_priority_requests_resolving_host;
+    else if (priority == Requests::RequestPriority::Low)
+        --m_low_priority_requests_resolving_host;
+}
+
+void ConnectionFromClient::queue_headers_became_available(i32 request_id, HTTP::HeaderMap const& response_headers, Optional<u32> status_code, Optional<String> const& reason_phrase)
+{
+    queue_request_lifecycle_event({ request_id, Requests::RequestLifecycleEvent::HeadersReceived { response_headers, status_code, reason_phrase } });
+}
+
+void ConnectionFromClient::queue_request_finished(i32 request_id, u64 total_size, Requests::RequestTimingInfo const& timing_info, Optional<Requests::NetworkError> const& network_error)
+{
+    queue_request_lifecycle_event({ request_id, Requests::RequestLifecycleEvent::Finished { total_size, timing_info, network_error } });
+}
+
+void ConnectionFromClient::queue_request_lifecycle_event(Requests::RequestLifecycleEvent event)
+{
+    m_pending_request_lifecycle_events.append(move(event));
+    if (m_pending_request_lifecycle_events.size() != 1)
+        return;
+
+    Core::deferred_invoke([weak_this = make_weak_ptr<ConnectionFromClient>()] {
+        if (weak_this)
+            weak_this->flush_request_lifecycle_events();
+    });
+}
+
+void ConnectionFromClient::flush_request_lifecycle_events()
+{
+    if (m_pending_request_lifecycle_events.is_empty())
+        return;
+
+    async_request_lifecycle_events(move(m_pending_request_lifecycle_events));
+    m_pending_request_lifecycle_events.clear();
+}
+
+bool ConnectionFromClient::should_defer_low_priority_request() const
+{
+    // NOTE: Requests that are still waiting for DNS are not active yet, but they will be soon.
+    size_t high_priority_requests = m_high_priority_requests_resolving_host;
+    size_t low_priority_requests = m_low_priority_requests_resolving_host;
+
+    for (auto const& it : m_active_requests) {
+        if (it.value->is_connect_only)
+            continue;
+        if (it.value->priority == Requests::RequestPriority::High)
+            ++high_priority_requests;
+        else if (it.value->priority == Requests::RequestPriority::Low)
+            ++low_priority_requests;
+    }
+
+    return high_priority_requests > 0 && low_priority_requests >= s_max_low_priority_requests_during_high_priority_requests;
+}
+
+void ConnectionFromClient::start_deferred_requests_if_possible()
+{
+    while (!m_deferred_requests.is_empty() && !should_defer_low_priority_request()) {
+        auto request = m_deferred_requests.take_first();
+        start_request(request.request_id, move(request.method), move(request.url), move(request.request_headers), move(request.request_body), move(request.proxy_data), Requests::RequestPriority::Low);
+    }
+}
+
+Messages::RequestServer::NetworkStatisticsResponse ConnectionFromClient::network_statistics()
+{
+    return NetworkStatistics::the().to_json();
+}
+
+void ConnectionFromClient::release_memory()
+{
+    NetworkStatistics::the().discard_recent_requests();
 }
 
 Messages::RequestServer::StopRequestResponse ConnectionFromClient::stop_request(i32 request_id)
 {
+    auto did_remove_deferred_request = m_deferred_requests.remove_first_matching([&](auto const& request) {
+        return request.request_id == request_id;
+    });
+    if (did_remove_deferred_request)
+        return true;
+
     auto request = m_active_requests.take(request_id);
     if (!request.has_value()) {
         dbgln("StopRequest: Request ID {} not found", request_id);
         return false;
     }
 
+    start_deferred_requests_if_possible();
     return true;
 }
 
@@ -691,6 +1143,16 @@ void ConnectionFromClient::ensure_connection(URL::URL url, ::RequestServer::Cach
     auto const url_string_value = url.to_string();
 
     if (cache_level == CacheLevel::CreateConnection) {
+        // NOTE: Pages, hovered links and early hints all ask for the same few origins over and over again.
+        auto origin = url.origin().serialize().to_byte_string();
+        auto now = MonotonicTime::now_coarse();
+        if (auto last_warm_up = m_connection_warm_up_times.get(origin); last_warm_up.has_value() && now - *last_warm_up < s_connection_warm_up_interval)
+            return;
+        m_connection_warm_up_times.remove_all_matching([&](auto const&, auto const& warm_up_time) {
+            return now - warm_up_time >= s_connection_warm_up_interval;
+        });
+        m_connection_warm_up_times.set(origin, now);
+
         auto* easy = curl_easy_init();
         if (!easy) {
             dbgln("EnsureConnection: Failed to initialize curl easy handle");
@@ -713,6 +1175,7 @@ void ConnectionFromClient::ensure_connection(URL::URL url, ::RequestServer::Cach
         request->is_connect_only = true;
 
         set_option(CURLOPT_PRIVATE, request.ptr());
+        set_option(CURLOPT_SHARE, tls_session_share());
         set_option(CURLOPT_URL, url_string_value.to_byte_string().characters());
         set_option(CURLOPT_PORT, url.port_or_default());
         set_option(CURLOPT_CONNECTTIMEOUT, s_connect_timeout_seconds);
@@ -773,15 +1236,19 @@ void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL url, Byt
                 async_websocket_connected(websocket_id);
             };
             connection->on_message = [this, websocket_id](auto message) {
-                async_websocket_received(websocket_id, message.is_text(), message.data());
+                queue_websocket_message(websocket_id, move(message));
             };
+            // NOTE: Messages that were received before a socket changes its state must reach the client first.
             connection->on_error = [this, websocket_id](auto message) {
+                flush_websocket_messages(websocket_id);
                 async_websocket_errored(websocket_id, (i32)message);
             };
             connection->on_close = [this, websocket_id](u16 code, ByteString reason, bool was_clean) {
+                flush_websocket_messages(websocket_id);
                 async_websocket_closed(websocket_id, code, move(reason), was_clean);
             };
             connection->on_ready_state_change = [this, websocket_id](auto state) {
+                flush_websocket_messages(websocket_id);
                 async_websocket_ready_state_changed(websocket_id, (u32)state);
             };
 
@@ -790,6 +1257,35 @@ void ConnectionFromClient::websocket_connect(i64 websocket_id, URL::URL url, Byt
         });
 }
 
+void ConnectionFromClient::queue_websocket_message(i64 websocket_id, WebSocket::Message message)
+{
+    auto is_first_pending_message = m_pending_websocket_messages.is_empty();
+
+    m_pending_websocket_messages.ensure(websocket_id).append({ message.release_data(), message.is_text() });
+    if (!is_first_pending_message)
+        return;
+
+    Core::deferred_invoke([weak_this = make_weak_ptr<ConnectionFromClient>()] {
+        if (weak_this)
+            weak_this->flush_websocket_messages();
+    });
+}
+
+void ConnectionFromClient::flush_websocket_messages()
+{
+    auto pending_websocket_messages = move(m_pending_websocket_messages);
+    m_pending_websocket_messages.clear();
+
+    for (auto& [websocket_id, messages] : pending_websocket_messages)
+        async_websocket_received(websocket_id, move(messages));
+}
+
+void ConnectionFromClient::flush_websocket_messages(i64 websocket_id)
+{
+    if (auto messages = m_pending_websocket_messages.take(websocket_id); messages.has_value())
+        async_websocket_received(websocket_id, messages.release_value());
+}
+
 void ConnectionFromClient::websocket_send(i64 websocket_id, bool is_text, ByteBuffer data)
 {
     if (auto connection = m_websockets.get(websocket_id).value_or({}); connection && connection->ready_state() == WebSocket::ReadyState::Open)
@@ -10,6 +10,7 @@
 #include <LibDNS/Resolver.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibWebSocket/WebSocket.h>
+#include <RequestServer/DiskCache.h>
 #include <RequestServer/RequestClientEndpoint.h>
 #include <RequestServer/RequestServerEndpoint.h>
 
@@ -42,10 +43,12 @@ private:
     virtual Messages::RequestServer::IsSupportedProtocolResponse is_supported_protocol(ByteString) override;
     virtual void set_dns_server(ByteString host_or_address, u16 port, bool use_tls) override;
     virtual void set_use_system_dns() override;
-    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData) override;
+    virtual void start_request(i32 request_id, ByteString, URL::URL, HTTP::HeaderMap, ByteBuffer, Core::ProxyData, Requests::RequestPriority) override;
     virtual Messages::RequestServer::StopRequestResponse stop_request(i32) override;
     virtual Messages::RequestServer::SetCertificateResponse set_certificate(i32, ByteString, ByteString) override;
     virtual void ensure_connection(URL::URL url, ::RequestServer::CacheLevel cache_level) override;
+    virtual Messages::RequestServer::NetworkStatisticsResponse network_statistics() override;
+    virtual void release_memory() override;
 
     virtual void websocket_connect(i64 websocket_id, URL::URL, ByteString, Vector<ByteString>, Vector<ByteString>, HTTP::HeaderMap) override;
     virtual void websocket_send(i64 websocket_id, bool, ByteBuffer) override;
@@ -54,6 +57,14 @@ private:
 
     HashMap<i32, RefPtr<WebSocket::WebSocket>> m_websockets;
 
+    void queue_websocket_message(i64 websocket_id, WebSocket::Message);
+    void flush_websocket_messages();
+    void flush_websocket_messages(i64 websocket_id);
+
+    // Received messages are sent to the client in one batch per WebSocket and event loop iteration, so that sockets
+    // receiving many small frames don't cost an IPC message for every one of them.
+    HashMap<i64, Vector<Requests::WebSocket::Message>> m_pending_websocket_messages;
+
     struct ActiveRequest;
     friend struct ActiveRequest;
 
@@ -64,7 +75,36 @@ private:
 
     HashMap<i32, NonnullOwnPtr<ActiveRequest>> m_active_requests;
 
+    // Low priority requests that are held back until the high priority requests in flight have finished.
+    struct DeferredRequest {
+        i32 request_id { 0 };
+        ByteString method;
+        URL::URL url;
+        HTTP::HeaderMap request_headers;
+        ByteBuffer request_body;
+        Core::ProxyData proxy_data;
+    };
+    Vector<DeferredRequest> m_deferred_requests;
+
+    HashMap<ByteString, MonotonicTime> m_connection_warm_up_times;
+    size_t m_high_priority_requests_resolving_host { 0 };
+    size_t m_low_priority_requests_resolving_host { 0 };
+
+    void did_start_resolving_host(Requests::RequestPriority);
+    void did_finish_resolving_host(Requests::RequestPriority);
+    bool should_defer_low_priority_request() const;
+    void start_deferred_requests_if_possible();
+
+    void queue_headers_became_available(i32 request_id, HTTP::HeaderMap const&, Optional<u32> status_code, Optional<String> const& reason_phrase);
+    void queue_request_finished(i32 request_id, u64 total_size, Requests::RequestTimingInfo const&, Optional<Requests::NetworkError> const&);
+    void queue_request_lifecycle_event(Requests::RequestLifecycleEvent);
+    void flush_request_lifecycle_events();
+
+    // Lifecycle events are sent to the client in one batch per event loop iteration.
+    Vector<Requests::RequestLifecycleEvent> m_pending_request_lifecycle_events;
+
     void check_active_requests();
+    void serve_response_from_disk_cache(i32 request_id, DiskCache::CachedResponse);
     void* m_curl_multi { nullptr };
     RefPtr<Core::Timer> m_timer;
     HashMap<int, NonnullRefPtr<Core::Notifier>> m_read_notifiers;
@@ -0,0 +1,643 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/Debug.h>
+#include <AK/Endian.h>
+#include <AK/Hex.h>
+#include <AK/LexicalPath.h>
+#include <AK/MemoryStream.h>
+#include <LibCore/DateTime.h>
+#include <LibCore/Directory.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibCrypto/Hash/SHA1.h>
+#include <RequestServer/DiskCache.h>
+
+namespace RequestServer {
+
+static constexpr u32 entry_magic = 0x4C424843; // "LBHC"
+static constexpr u32 index_magic = 0x4C424849; // "LBHI"
+static constexpr u32 format_version = 1;
+static constexpr auto index_file_name = "index"sv;
+static constexpr auto index_flush_delay_in_milliseconds = 1000;
+static constexpr u64 maximum_shared_bodies_size = 32 * MiB;
+
+// https://httpwg.org/specs/rfc9110.html#rfc.section.15.1
+// https://httpwg.org/specs/rfc9111.html#heuristic.freshness
+static bool is_heuristically_cacheable_status(u32 status_code)
+{
+    switch (status_code) {
+    case 200:
+    case 203:
+    case 204:
+    case 300:
+    case 301:
+    case 308:
+    case 404:
+    case 405:
+    case 410:
+    case 414:
+    case 501:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// https://httpwg.org/specs/rfc9111.html#field.cache-control
+struct CacheControlDirectives {
+    bool no_store { false };
+    bool no_cache { false };
+    Optional<i64> max_age;
+};
+
+static CacheControlDirectives parse_cache_control(HTTP::HeaderMap const& headers)
+{
+    CacheControlDirectives directives;
+
+    auto value = headers.get("Cache-Control"sv);
+    if (!value.has_value())
+        return directives;
+
+    for (auto directive : value->split_view(',')) {
+        directive = directive.trim_whitespace();
+
+        auto name = directive;
+        Optional<StringView> argument;
+        if (auto equals_index = directive.find('='); equals_index.has_value()) {
+            name = directive.substring_view(0, *equals_index).trim_whitespace();
+            argument = directive.substring_view(*equals_index + 1).trim_whitespace().trim("\""sv);
+        }
+
+        if (name.equals_ignoring_ascii_case("no-store"sv)) {
+            directives.no_store = true;
+        } else if (name.equals_ignoring_ascii_case("no-cache"sv)) {
+            directives.no_cache = true;
+        } else if (name.equals_ignoring_ascii_case("max-age"sv) && argument.has_value()) {
+            // A cache MUST consider a malformed max-age to be stale.
+            directives.max_age = argument->to_number<i64>().value_or(0);
+        }
+    }
+
+    return directives;
+}
+
+// https://httpwg.org/specs/rfc9110.html#http.date
+static Optional<UnixDateTime> parse_http_date(Optional<ByteString const&> value)
+{
+    if (!value.has_value())
+        return {};
+
+    // FIXME: Also accept the obsolete RFC 850 and asctime() formats.
+    auto date = Core::DateTime::parse("%a, %d %b %Y %H:%M:%S %Z"sv, value->view().trim_whitespace());
+    if (!date.has_value())
+        return {};
+    return UnixDateTime::from_seconds_since_epoch(date->timestamp());
+}
+
+// https://httpwg.org/specs/rfc9111.html#calculating.freshness.lifetime
+static AK::Duration freshness_lifetime(u32 status_code, HTTP::HeaderMap const& headers, UnixDateTime response_time)
+{
+    // If the max-age response directive is present, use its value, or
+    if (auto max_age = parse_cache_control(headers).max_age; max_age.has_value())
+        return AK::Duration::from_seconds(*max_age);
+
+    auto date = parse_http_date(headers.get("Date"sv)).value_or(response_time);
+
+    // If the Expires response header field is present, use its value minus the value of the Date response header
+    // field (using the time the message was received if it is not present), or
+    if (headers.contains("Expires"sv)) {
+        // A cache recipient MUST interpret invalid date formats, especially the value "0", as representing a time in
+        // the past (i.e., "already expired").
+        auto expires = parse_http_date(headers.get("Expires"sv));
+        if (!expires.has_value())
+            return {};
+        return *expires - date;
+    }
+
+    // Otherwise, no explicit expiration time is present in the response. A heuristic freshness lifetime might be
+    // applicable.
+    // NOTE: Like other implementations, we use 10% of the time since the response was last modified, and cap it to
+    //       avoid serving very old resources for too long without checking back.
+    if (is_heuristically_cacheable_status(status_code)) {
+        if (auto last_modified = parse_http_date(headers.get("Last-Modified"sv)); last_modified.has_value() && *last_modified < date) {
+            auto heuristic_lifetime = AK::Duration::from_seconds((date - *last_modified).to_seconds() / 10);
+            return min(heuristic_lifetime, AK::Duration::from_seconds(24 * 60 * 60));
+        }
+    }
+
+    return {};
+}
+
+// https://httpwg.org/specs/rfc9111.html#age.calculations
+static AK::Duration current_age(HTTP::HeaderMap const& headers, UnixDateTime request_time, UnixDateTime response_time)
+{
+    auto age_value = AK::Duration::from_seconds(headers.get("Age"sv).map([](auto const& age) { return age.template to_number<i64>().value_or(0); }).value_or(0));
+    auto date_value = parse_http_date(headers.get("Date"sv)).value_or(response_time);
+    auto now = UnixDateTime::now();
+
+    auto apparent_age = max(AK::Duration {}, response_time - date_value);
+
+    auto response_delay = response_time - request_time;
+    auto corrected_age_value = age_value + response_delay;
+
+    auto corrected_initial_age = max(apparent_age, corrected_age_value);
+
+    auto resident_time = now - response_time;
+    return corrected_initial_age + resident_time;
+}
+
+static bool request_forbids_stored_response(HTTP::HeaderMap const& request_headers)
+{
+    // We let the origin server handle requests that are already conditional or ask for part of a resource.
+    static constexpr Array passthrough_headers { "Range"sv, "If-Match"sv, "If-None-Match"sv, "If-Modified-Since"sv, "If-Unmodified-Since"sv, "If-Range"sv };
+    for (auto header : passthrough_headers) {
+        if (request_headers.contains(header))
+            return true;
+    }
+
+    return parse_cache_control(request_headers).no_store;
+}
+
+// https://httpwg.org/specs/rfc9111.html#caching.negotiated.responses
+static Vector<ByteString> vary_header_names(HTTP::HeaderMap const& response_headers)
+{
+    Vector<ByteString> names;
+    if (auto vary = response_headers.get("Vary"sv); vary.has_value()) {
+        for (auto name : vary->split_view(','))
+            names.append(name.trim_whitespace());
+    }
+    return names;
+}
+
+struct StoredEntry {
+    ByteString url;
+    u32 status_code { 0 };
+    Optional<String> reason_phrase;
+    UnixDateTime request_time;
+    UnixDateTime response_time;
+    HTTP::HeaderMap response_headers;
+    Vector<HTTP::Header> vary_request_headers;
+    ReadonlyBytes body;
+};
+
+static void append_u32(ByteBuffer& buffer, u32 value)
+{
+    LittleEndian<u32> little_endian_value { value };
+    buffer.append(&little_endian_value, sizeof(little_endian_value));
+}
+
+static void append_u64(ByteBuffer& buffer, u64 value)
+{
+    LittleEndian<u64> little_endian_value { value };
+    buffer.append(&little_endian_value, sizeof(little_endian_value));
+}
+
+static void append_string(ByteBuffer& buffer, StringView string)
+{
+    append_u32(buffer, string.length());
+    buffer.append(string.bytes());
+}
+
+static ErrorOr<ByteString> read_string(Stream& stream)
+{
+    auto length = TRY(stream.read_value<LittleEndian<u32>>());
+    auto buffer = TRY(ByteBuffer::create_uninitialized(length));
+    TRY(stream.read_until_filled(buffer));
+    return ByteString { buffer.bytes() };
+}
+
+static ByteBuffer serialize_entry(StoredEntry const& entry)
+{
+    ByteBuffer buffer;
+    append_u32(buffer, entry_magic);
+    append_u32(buffer, format_version);
+    append_string(buffer, entry.url);
+    append_u32(buffer, entry.status_code);
+    append_string(buffer, entry.reason_phrase.has_value() ? entry.reason_phrase->bytes_as_string_view() : ""sv);
+    append_u64(buffer, entry.request_time.seconds_since_epoch());
+    append_u64(buffer, entry.response_time.seconds_since_epoch());
+
+    append_u32(buffer, entry.response_headers.headers().size());
+    for (auto const& header : entry.response_headers.headers()) {
+        append_string(buffer, header.name);
+        append_string(buffer, header.value);
+    }
+
+    append_u32(buffer, entry.vary_request_headers.size());
+    for (auto const& header : entry.vary_request_headers) {
+        append_string(buffer, header.name);
+        append_string(buffer, header.value);
+    }
+
+    append_u64(buffer, entry.body.size());
+    buffer.append(entry.body);
+    return buffer;
+}
+
+static ErrorOr<StoredEntry> parse_entry(Core::MappedFile& file)
+{
+    StoredEntry entry;
+
+    if (TRY(file.read_value<LittleEndian<u32>>()) != entry_magic || TRY(file.read_value<LittleEndian<u32>>()) != format_version)
+        return Error::from_string_literal("Not a cache entry of this version");
+
+    entry.url = TRY(read_string(file));
+    entry.status_code = TRY(file.read_value<LittleEndian<u32>>());
+    if (auto reason_phrase = TRY(read_string(file)); !reason_phrase.is_empty())
+        entry.reason_phrase = TRY(String::from_byte_string(reason_phrase));
+    entry.request_time = UnixDateTime::from_seconds_since_epoch(TRY(file.read_value<LittleEndian<u64>>()));
+    entry.response_time = UnixDateTime::from_seconds_since_epoch(TRY(file.read_value<LittleEndian<u64>>()));
+
+    auto header_count = TRY(file.read_value<LittleEndian<u32>>());
+    for (u32 i = 0; i < header_count; ++i) {
+        auto name = TRY(read_string(file));
+        auto value = TRY(read_string(file));
+        entry.response_headers.set(move(name), move(value));
+    }
+
+    auto vary_header_count = TRY(file.read_value<LittleEndian<u32>>());
+    for (u32 i = 0; i < vary_header_count; ++i) {
+        auto name = TRY(read_string(file));
+        auto value = TRY(read_string(file));
+        entry.vary_request_headers.append({ move(name), move(value) });
+    }
+
+    auto body_size = TRY(file.read_value<LittleEndian<u64>>());
+    auto body_offset = TRY(file.tell());
+    if (body_offset + body_size != file.bytes().size())
+        return Error::from_string_literal("Truncated cache entry");
+
+    entry.body = file.bytes().slice(body_offset, body_size);
+    return entry;
+}
+
+static Vector<HTTP::Header> vary_request_headers(HTTP::HeaderMap const& request_headers, HTTP::HeaderMap const& response_headers)
+{
+    Vector<HTTP::Header> headers;
+    for (auto& name : vary_header_names(response_headers))
+        headers.append({ name, request_headers.get(name).value_or(ByteString {}) });
+    return headers;
+}
+
+static ByteString cache_key(URL::URL const& url)
+{
+    auto digest = Crypto::Hash::SHA1::hash(url.serialize(URL::ExcludeFragment::Yes).bytes_as_string_view());
+    return encode_hex(digest.bytes());
+}
+
+ErrorOr<NonnullOwnPtr<DiskCache>> DiskCache::create(ByteString directory, u64 maximum_size)
+{
+    TRY(Core::Directory::create(directory, Core::Directory::CreateDirectories::Yes));
+
+    auto disk_cache = adopt_own(*new DiskCache(move(directory), maximum_size));
+    if (auto result = disk_cache->load_index(); result.is_error())
+        dbgln("DiskCache: Unable to load the cache index, starting with an empty cache: {}", result.error());
+
+    return disk_cache;
+}
+
+DiskCache::DiskCache(ByteString directory, u64 maximum_size)
+    : m_directory(move(directory))
+    , m_maximum_size(maximum_size)
+{
+    m_index_flush_timer = Core::Timer::create_single_shot(index_flush_delay_in_milliseconds, [this] {
+        if (auto result = flush_index(); result.is_error())
+            dbgln("DiskCache: Unable to write the cache index: {}", result.error());
+    });
+}
+
+DiskCache::~DiskCache()
+{
+    if (m_index_flush_timer->is_active())
+        (void)flush_index();
+}
+
+ByteString DiskCache::path_for_entry(StringView key) const
+{
+    return LexicalPath::join(m_directory, key).string();
+}
+
+ErrorOr<void> DiskCache::load_index()
+{
+    auto index_path = LexicalPath::join(m_directory, index_file_name).string();
+
+    if (auto index_file = Core::MappedFile::map(index_path); !index_file.is_error()) {
+        auto& stream = *index_file.value();
+        if (TRY(stream.read_value<LittleEndian<u32>>()) == index_magic && TRY(stream.read_value<LittleEndian<u32>>()) == format_version) {
+            auto entry_count = TRY(stream.read_value<LittleEndian<u32>>());
+            for (u32 i = 0; i < entry_count; ++i) {
+                auto key = TRY(read_string(stream));
+                auto size = TRY(stream.read_value<LittleEndian<u64>>());
+                auto last_access_time = UnixDateTime::from_seconds_since_epoch(TRY(stream.read_value<LittleEndian<u64>>()));
+                m_index.set(move(key), { size, last_access_time });
+            }
+        }
+    }
+
+    // Drop any file the index doesn't know about (e.g. because we crashed before flushing it), and any index entry
+    // whose file has gone missing.
+    HashTable<ByteString> existing_files;
+    TRY(Core::Directory::for_each_entry(m_directory, Core::DirIterator::SkipParentAndBaseDir, [&](auto const& entry, auto const&) -> ErrorOr<IterationDecision> {
+        if (entry.name == index_file_name)
+            return IterationDecision::Continue;
+        if (!m_index.contains(entry.name)) {
+            (void)Core::System::unlink(path_for_entry(entry.name));
+            return IterationDecision::Continue;
+        }
+        existing_files.set(entry.name);
+        return IterationDecision::Continue;
+    }));
+
+    m_index.remove_all_matching([&](auto const& key, auto const&) {
+        return !existing_files.contains(key);
+    });
+
+    for (auto const& it : m_index)
+        m_current_size += it.value.size;
+
+    evict_entries_if_needed();
+    return {};
+}
+
+void DiskCache::schedule_index_flush()
+{
+    if (!m_index_flush_timer->is_active())
+        m_index_flush_timer->start();
+}
+
+ErrorOr<void> DiskCache::flush_index()
+{
+    m_index_flush_timer->stop();
+
+    ByteBuffer buffer;
+    append_u32(buffer, index_magic);
+    append_u32(buffer, format_version);
+    append_u32(buffer, m_index.size());
+    for (auto const& it : m_index) {
+        append_string(buffer, it.key);
+        append_u64(buffer, it.value.size);
+        append_u64(buffer, it.value.last_access_time.seconds_since_epoch());
+    }
+
+    auto index_path = LexicalPath::join(m_directory, index_file_name).string();
+    auto temporary_path = ByteString::formatted("{}.tmp", index_path);
+
+    auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    TRY(file->write_until_depleted(buffer));
+    file->close();
+
+    TRY(Core::System::rename(temporary_path, index_path));
+    return {};
+}
+
+void DiskCache::remove_entry(ByteString const& key)
+{
+    if (auto shared_body = m_shared_bodies.take(key); shared_body.has_value())
+        m_shared_bodies_size -= shared_body->buffer.size();
+
+    auto entry = m_index.take(key);
+    if (!entry.has_value())
+        return;
+
+    m_current_size -= entry->size;
+    (void)Core::System::unlink(path_for_entry(key));
+    schedule_index_flush();
+}
+
+void DiskCache::evict_entries_if_needed()
+{
+    while (m_current_size > m_maximum_size && !m_index.is_empty()) {
+        auto least_recently_used = m_index.begin();
+        for (auto it = m_index.begin(); it != m_index.end(); ++it) {
+            if (it->value.last_access_time < least_recently_used->value.last_access_time)
+                least_recently_used = it;
+        }
+
+        dbgln_if(REQUESTSERVER_DEBUG, "DiskCache: Evicting {} ({} bytes)", least_recently_used->key, least_recently_used->value.size);
+        remove_entry(ByteString { least_recently_used->key });
+    }
+}
+
+void DiskCache::evict_shared_bodies_if_needed()
+{
+    while (m_shared_bodies_size > maximum_shared_bodies_size && !m_shared_bodies.is_empty()) {
+        auto least_recently_used = m_shared_bodies.begin();
+        for (auto it = m_shared_bodies.begin(); it != m_shared_bodies.end(); ++it) {
+            if (it->value.last_access_serial < least_recently_used->value.last_access_serial)
+                least_recently_used = it;
+        }
+
+        m_shared_bodies_size -= least_recently_used->value.buffer.size();
+        m_shared_bodies.remove(least_recently_used);
+    }
+}
+
+// https://httpwg.org/specs/rfc9111.html#constructing.responses.from.caches
+Optional<DiskCache::CachedResponse> DiskCache::open_entry(URL::URL const& url, ByteString const& method, HTTP::HeaderMap const& request_headers)
+{
+    // The presented target URI and that of the stored response match, and
+    // the request method associated with the stored response allows it to be used for the presented request, and
+    if (method != "GET"sv || request_forbids_stored_response(request_headers))
+        return {};
+
+    auto key = cache_key(url);
+    auto index_entry = m_index.get(key);
+    if (!index_entry.has_value())
+        return {};
+
+    auto file_or_error = Core::MappedFile::map(path_for_entry(key));
+    if (file_or_error.is_error()) {
+        remove_entry(key);
+        return {};
+    }
+    auto file = file_or_error.release_value();
+
+    auto entry_or_error = parse_entry(*file);
+    if (entry_or_error.is_error() || entry_or_error.value().url != url.serialize(URL::ExcludeFragment::Yes).bytes_as_string_view()) {
+        remove_entry(key);
+        return {};
+    }
+    auto entry = entry_or_error.release_value();
+
+    // request header fields nominated by the stored response (if any) match those presented, and
+    for (auto const& header : entry.vary_request_headers) {
+        if (header.name == "*"sv || request_headers.get(header.name).value_or(ByteString {}) != header.value)
+            return {};
+    }
+
+    // the stored response is one of the following: fresh, allowed to be served stale, or successfully validated.
+    auto response_directives = parse_cache_control(entry.response_headers);
+    auto request_directives = parse_cache_control(request_headers);
+
+    auto age = current_age(entry.response_headers, entry.request_time, entry.response_time);
+    bool is_fresh = freshness_lifetime(entry.status_code, entry.response_headers, entry.response_time) > age
+        && !response_directives.no_cache
+        && !request_directives.no_cache
+        && !request_headers.get("Pragma"sv).map([](auto const& pragma) { return pragma.equals_ignoring_ascii_case("no-cache"sv); }).value_or(false)
+        && (!request_directives.max_age.has_value() || age.to_seconds() <= *request_directives.max_age);
+
+    auto etag = entry.response_headers.get("ETag"sv).copy();
+    auto last_modified = entry.response_headers.get("Last-Modified"sv).copy();
+
+    // A stale response that can't be validated is of no use to us.
+    if (!is_fresh && !etag.has_value() && !last_modified.has_value())
+        return {};
+
+    index_entry->last_access_time = UnixDateTime::now();
+    schedule_index_flush();
+
+    dbgln_if(REQUESTSERVER_DEBUG, "DiskCache: Found {} entry for {}", is_fresh ? "fresh"sv : "stale"sv, url);
+
+    return CachedResponse {
+        .key = move(key),
+        .status_code = entry.status_code,
+        .reason_phrase = move(entry.reason_phrase),
+        .response_headers = move(entry.response_headers),
+        .file = move(file),
+        .body = entry.body,
+        .is_fresh = is_fresh,
+        .etag = move(etag),
+        .last_modified = move(last_modified),
+    };
+}
+
+// https://httpwg.org/specs/rfc9111.html#response.cacheability
+bool DiskCache::may_store_response(ByteString const& method, HTTP::HeaderMap const& request_headers, u32 status_code, HTTP::HeaderMap const& response_headers)
+{
+    // - the request method is understood by the cache;
+    if (method != "GET"sv)
+        return false;
+
+    // - the response status code is final and understood by the cache;
+    // NOTE: We don't store partial content.
+    if (!is_heuristically_cacheable_status(status_code))
+        return false;
+
+    if (request_forbids_stored_response(request_headers))
+        return false;
+
+    // - the no-store cache directive is not present in the response;
+    if (parse_cache_control(response_headers).no_store)
+        return false;
+
+    // - if the cache is shared: the Authorization header field is not present in the request;
+    // NOTE: We are a private cache, but play it safe with credentials, and with responses that set cookies, since
+    //       replaying those from the cache would resurrect cookies the user may have since cleared.
+    if (request_headers.contains("Authorization"sv) || response_headers.contains("Set-Cookie"sv))
+        return false;
+
+    // A Vary header field value of "*" always fails to match.
+    if (vary_header_names(response_headers).contains_slow("*"sv))
+        return false;
+
+    // - the response contains at least one of the following: an Expires header field, a max-age response directive,
+    //   a status code that is defined as heuristically cacheable, ...
+    // NOTE: Every status code we accept is heuristically cacheable, but a response is only useful to us if it will be
+    //       fresh for a while, or if it can be validated once it goes stale.
+    return response_headers.contains("Expires"sv)
+        || parse_cache_control(response_headers).max_age.has_value()
+        || response_headers.contains("Last-Modified"sv)
+        || response_headers.contains("ETag"sv);
+}
+
+void DiskCache::store_response(URL::URL const& url, HTTP::HeaderMap const& request_headers, u32 status_code, Optional<String> const& reason_phrase, HTTP::HeaderMap const& response_headers, ReadonlyBytes body, UnixDateTime request_time, UnixDateTime response_time)
+{
+    if (body.size() > maximum_entry_size())
+        return;
+
+    auto key = cache_key(url);
+
+    StoredEntry entry;
+    entry.url = url.serialize(URL::ExcludeFragment::Yes).to_byte_string();
+    entry.status_code = status_code;
+    entry.reason_phrase = reason_phrase;
+    entry.request_time = request_time;
+    entry.response_time = response_time;
+    entry.response_headers = response_headers;
+    entry.vary_request_headers = vary_request_headers(request_headers, response_headers);
+    entry.body = body;
+
+    auto serialized_entry = serialize_entry(entry);
+
+    // Write the entry next to its final location, then move it into place, so that a concurrently mapped version of
+    // the previous entry stays intact.
+    auto path = path_for_entry(key);
+    auto temporary_path = ByteString::formatted("{}.tmp", path);
+    auto result = [&]() -> ErrorOr<void> {
+        auto file = TRY(Core::File::open(temporary_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+        TRY(file->write_until_depleted(serialized_entry));
+        file->close();
+        TRY(Core::System::rename(temporary_path, path));
+        return {};
+    }();
+
+    if (result.is_error()) {
+        dbgln("DiskCache: Unable to store {}: {}", url, result.error());
+        (void)Core::System::unlink(temporary_path);
+        remove_entry(key);
+        return;
+    }
+
+    if (auto previous_entry = m_index.get(key); previous_entry.has_value())
+        m_current_size -= previous_entry->size;
+
+    // Clients that were already handed the previous body keep their mapping of it, but new clients must see this one.
+    if (auto shared_body = m_shared_bodies.take(key); shared_body.has_value())
+        m_shared_bodies_size -= shared_body->buffer.size();
+
+    m_index.set(key, { serialized_entry.size(), UnixDateTime::now() });
+    m_current_size += serialized_entry.size();
+
+    dbgln_if(REQUESTSERVER_DEBUG, "DiskCache: Stored {} ({} bytes)", url, serialized_entry.size());
+
+    evict_entries_if_needed();
+    schedule_index_flush();
+}
+
+ErrorOr<Core::AnonymousBuffer> DiskCache::shared_body_for(CachedResponse const& cached_response)
+{
+    if (auto shared_body = m_shared_bodies.get(cached_response.key); shared_body.has_value()) {
+        shared_body->last_access_serial = ++m_shared_body_access_serial;
+        return shared_body->buffer;
+    }
+
+    auto buffer = TRY(Core::AnonymousBuffer::create_with_size(cached_response.body.size()));
+    cached_response.body.copy_to({ buffer.data<u8>(), buffer.size() });
+
+    m_shared_bodies.set(cached_response.key, { buffer, ++m_shared_body_access_serial });
+    m_shared_bodies_size += buffer.size();
+    evict_shared_bodies_if_needed();
+
+    return buffer;
+}
+
+// https://httpwg.org/specs/rfc9111.html#freshening.responses
+HTTP::HeaderMap DiskCache::freshen_response(URL::URL const& url, HTTP::HeaderMap const& request_headers, CachedResponse const& cached_response, HTTP::HeaderMap const& not_modified_headers, UnixDateTime request_time, UnixDateTime response_time)
+{
+    // The cache MUST use the header fields provided in the 304 (Not Modified) response to replace all instances of
+    // the corresponding header fields in the stored response, except for header fields that describe the framing of
+    // the stored content.
+    auto is_updated_header = [&](ByteString const& name) {
+        return !name.equals_ignoring_ascii_case("Content-Length"sv) && not_modified_headers.contains(name);
+    };
+
+    HTTP::HeaderMap headers;
+    for (auto const& header : cached_response.response_headers.headers()) {
+        if (!is_updated_header(header.name))
+            headers.set(header.name, header.value);
+    }
+    for (auto const& header : not_modified_headers.headers()) {
+        if (is_updated_header(header.name))
+            headers.set(header.name, header.value);
+    }
+
+    store_response(url, request_headers, cached_response.status_code, cached_response.reason_phrase, headers, cached_response.body, request_time, response_time);
+    return headers;
+}
+
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
+#include <AK/Time.h>
+#include <LibCore/AnonymousBuffer.h>
+#include <LibCore/MappedFile.h>
+#include <LibCore/Timer.h>
+#include <LibHTTP/HeaderMap.h>
+#include <LibURL/URL.h>
+
+namespace RequestServer {
+
+// A private HTTP cache, as described by RFC 9111, shared by every client of this RequestServer process.
+//
+// Every stored response lives in its own file, named after a hash of its URL, which holds the response's status and
+// headers followed by its body. The body is memory-mapped when the response is served. An index file records how
+// large each entry is and when it was last used, so that the cache can be kept within its size limit by evicting the
+// least recently used entries.
+//
+// The bodies of recently served fresh responses are additionally kept in anonymous shared memory, which is handed to
+// clients as-is. Every client that loads the same resource then maps the same pages, rather than each receiving its
+// own copy of the body through a pipe.
+class DiskCache {
+    AK_MAKE_NONCOPYABLE(DiskCache);
+    AK_MAKE_NONMOVABLE(DiskCache);
+
+public:
+    static ErrorOr<NonnullOwnPtr<DiskCache>> create(ByteString directory, u64 maximum_size);
+    ~DiskCache();
+
+    struct CachedResponse {
+        ByteString key;
+        u32 status_code { 0 };
+        Optional<String> reason_phrase;
+        HTTP::HeaderMap response_headers;
+        NonnullOwnPtr<Core::MappedFile> file;
+        ReadonlyBytes body;
+
+        // https://httpwg.org/specs/rfc9111.html#expiration.model
+        bool is_fresh { false };
+
+        // https://httpwg.org/specs/rfc9111.html#validation.sent
+        Optional<ByteString> etag;
+        Optional<ByteString> last_modified;
+    };
+
+    // Returns the stored response that may be used to satisfy this request, either directly if it is fresh, or after
+    // validating it with the origin server.
+    Optional<CachedResponse> open_entry(URL::URL const&, ByteString const& method, HTTP::HeaderMap const& request_headers);
+
+    // https://httpwg.org/specs/rfc9111.html#response.cacheability
+    static bool may_store_response(ByteString const& method, HTTP::HeaderMap const& request_headers, u32 status_code, HTTP::HeaderMap const& response_headers);
+
+    void store_response(URL::URL const&, HTTP::HeaderMap const& request_headers, u32 status_code, Optional<String> const& reason_phrase, HTTP::HeaderMap const& response_headers, ReadonlyBytes body, UnixDateTime request_time, UnixDateTime response_time);
+
+    // https://httpwg.org/specs/rfc9111.html#freshening.responses
+    // Updates the stored response with the headers of a 304 (Not Modified) response, and returns the updated headers.
+    HTTP::HeaderMap freshen_response(URL::URL const&, HTTP::HeaderMap const& request_headers, CachedResponse const&, HTTP::HeaderMap const& not_modified_headers, UnixDateTime request_time, UnixDateTime response_time);
+
+    // Returns the body of the stored response in shared memory that may be sent to clients as-is.
+    ErrorOr<Core::AnonymousBuffer> shared_body_for(CachedResponse const&);
+
+    u64 maximum_entry_size() const { return m_maximum_size / 8; }
+
+private:
+    DiskCache(ByteString directory, u64 maximum_size);
+
+    struct IndexEntry {
+        u64 size { 0 };
+        UnixDateTime last_access_time;
+    };
+
+    struct SharedBody {
+        Core::AnonymousBuffer buffer;
+        u64 last_access_serial { 0 };
+    };
+
+    ErrorOr<void> load_index();
+    void schedule_index_flush();
+    ErrorOr<void> flush_index();
+
+    ByteString path_for_entry(StringView key) const;
+    void remove_entry(ByteString const& key);
+    void evict_entries_if_needed();
+    void evict_shared_bodies_if_needed();
+
+    ByteString m_directory;
+    u64 m_maximum_size { 0 };
+    u64 m_current_size { 0 };
+
+    HashMap<ByteString, IndexEntry> m_index;
+    RefPtr<Core::Timer> m_index_flush_timer;
+
+    HashMap<ByteString, SharedBody> m_shared_bodies;
+    u64 m_shared_bodies_size { 0 };
+    u64 m_shared_body_access_serial { 0 };
+};
+
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <RequestServer/NetworkStatistics.h>
+
+namespace RequestServer {
+
+NetworkStatistics& NetworkStatistics::the()
+{
+    static NetworkStatistics s_the;
+    return s_the;
+}
+
+void NetworkStatistics::did_finish_request(String const& origin, RequestWaterfall waterfall)
+{
+    ++m_finished_requests;
+    if (waterfall.failed)
+        ++m_failed_requests;
+
+    if (waterfall.reused_connection)
+        ++m_reused_connections;
+    else if (!waterfall.failed)
+        ++m_new_connections;
+
+    auto& origin_statistics = m_origins.ensure(origin);
+    ++origin_statistics.requests;
+    origin_statistics.encoded_bytes += waterfall.encoded_body_size;
+    origin_statistics.decoded_bytes += waterfall.decoded_body_size;
+
+    m_recent_requests.enqueue(move(waterfall));
+}
+
+void NetworkStatistics::did_serve_response_from_disk_cache(String const& origin, u64 body_size)
+{
+    ++m_disk_cache_hits;
+
+    auto& origin_statistics = m_origins.ensure(origin);
+    ++origin_statistics.requests;
+    origin_statistics.decoded_bytes += body_size;
+}
+
+static double ratio(u64 numerator, u64 denominator)
+{
+    if (denominator == 0)
+        return 0;
+    return static_cast<double>(numerator) / static_cast<double>(denominator);
+}
+
+String NetworkStatistics::to_json() const
+{
+    JsonObject requests;
+    requests.set("active_transfers"sv, m_active_transfers);
+    requests.set("finished"sv, m_finished_requests);
+    requests.set("failed"sv, m_failed_requests);
+
+    JsonObject connections;
+    connections.set("new"sv, m_new_connections);
+    connections.set("reused"sv, m_reused_connections);
+    connections.set("reuse_rate"sv, ratio(m_reused_connections, m_new_connections + m_reused_connections));
+
+    JsonObject disk_cache;
+    disk_cache.set("hits"sv, m_disk_cache_hits);
+    disk_cache.set("revalidations"sv, m_disk_cache_revalidations);
+    disk_cache.set("misses"sv, m_disk_cache_misses);
+    disk_cache.set("hit_ratio"sv, ratio(m_disk_cache_hits + m_disk_cache_revalidations, m_disk_cache_hits + m_disk_cache_revalidations + m_disk_cache_misses));
+
+    JsonObject origins;
+    for (auto const& [origin, origin_statistics] : m_origins) {
+        JsonObject object;
+        object.set("requests"sv, origin_statistics.requests);
+        object.set("encoded_bytes"sv, origin_statistics.encoded_bytes);
+        object.set("decoded_bytes"sv, origin_statistics.decoded_bytes);
+        origins.set(origin, move(object));
+    }
+
+    JsonArray recent_requests;
+    recent_requests.ensure_capacity(m_recent_requests.size());
+    for (auto const& waterfall : m_recent_requests) {
+        JsonObject object;
+        object.set("url"sv, waterfall.url);
+        object.set("queue_microseconds"sv, waterfall.queue.to_microseconds());
+        object.set("domain_lookup_microseconds"sv, waterfall.domain_lookup.to_microseconds());
+        object.set("connect_microseconds"sv, waterfall.connect.to_microseconds());
+        object.set("secure_connect_microseconds"sv, waterfall.secure_connect.to_microseconds());
+        object.set("time_to_first_byte_microseconds"sv, waterfall.time_to_first_byte.to_microseconds());
+        object.set("download_microseconds"sv, waterfall.download.to_microseconds());
+        object.set("delivery_microseconds"sv, waterfall.delivery.to_microseconds());
+        object.set("encoded_body_size"sv, waterfall.encoded_body_size);
+        object.set("decoded_body_size"sv, waterfall.decoded_body_size);
+        object.set("reused_connection"sv, waterfall.reused_connection);
+        object.set("failed"sv, waterfall.failed);
+        recent_requests.must_append(move(object));
+    }
+
+    JsonObject statistics;
+    statistics.set("requests"sv, move(requests));
+    statistics.set("connections"sv, move(connections));
+    statistics.set("disk_cache"sv, move(disk_cache));
+    statistics.set("origins"sv, move(origins));
+    statistics.set("recent_requests"sv, move(recent_requests));
+    return statistics.serialized();
+}
+
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/CircularQueue.h>
+#include <AK/HashMap.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+
+namespace RequestServer {
+
+// How long each phase of a request took, in the order in which the phases happen.
+struct RequestWaterfall {
+    String url;
+    AK::Duration queue;
+    AK::Duration domain_lookup;
+    AK::Duration connect;
+    AK::Duration secure_connect;
+    AK::Duration time_to_first_byte;
+    AK::Duration download;
+    AK::Duration delivery;
+    u64 encoded_body_size { 0 };
+    u64 decoded_body_size { 0 };
+    bool reused_connection { false };
+    bool failed { false };
+};
+
+// Counters about the network activity of this RequestServer process, shared by all of its clients.
+class NetworkStatistics {
+public:
+    static NetworkStatistics& the();
+
+    void did_start_transfer() { ++m_active_transfers; }
+    void did_end_transfer() { --m_active_transfers; }
+    void did_finish_request(String const& origin, RequestWaterfall);
+
+    void did_serve_response_from_disk_cache(String const& origin, u64 body_size);
+    void did_revalidate_cached_response() { ++m_disk_cache_revalidations; }
+    void did_miss_disk_cache() { ++m_disk_cache_misses; }
+
+    void discard_recent_requests() { m_recent_requests.clear(); }
+
+    String to_json() const;
+
+private:
+    NetworkStatistics() = default;
+
+    struct OriginStatistics {
+        u64 requests { 0 };
+        u64 encoded_bytes { 0 };
+        u64 decoded_bytes { 0 };
+    };
+
+    size_t m_active_transfers { 0 };
+    u64 m_finished_requests { 0 };
+    u64 m_failed_requests { 0 };
+
+    u64 m_new_connections { 0 };
+    u64 m_reused_connections { 0 };
+
+    u64 m_disk_cache_hits { 0 };
+    u64 m_disk_cache_revalidations { 0 };
+    u64 m_disk_cache_misses { 0 };
+
+    HashMap<String, OriginStatistics> m_origins;
+    CircularQueue<RequestWaterfall, 256> m_recent_requests;
+};
+
+}
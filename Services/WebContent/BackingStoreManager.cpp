@@ -40,6 +40,8 @@ void BackingStoreManager::restart_resize_timer()
 
 void BackingStoreManager::reallocate_backing_stores(Gfx::IntSize size)
 {
+    m_page_client.did_reallocate_backing_stores();
+
 #ifdef AK_OS_MACOS
     if (s_browser_mach_port.has_value()) {
         auto back_iosurface = Core::IOSurfaceHandle::create(size.width(), size.height());
@@ -102,6 +104,16 @@ void BackingStoreManager::reallocate_backing_stores(Gfx::IntSize size)
     m_page_client.page_did_allocate_backing_stores(m_front_bitmap_id, front_bitmap->to_shareable_bitmap(), m_back_bitmap_id, back_bitmap->to_shareable_bitmap());
 }
 
+void BackingStoreManager::release_backing_stores()
+{
+    m_backing_store_shrink_timer->stop();
+
+    m_front_store.clear();
+    m_back_store.clear();
+    m_front_bitmap_id = -1;
+    m_back_bitmap_id = -1;
+}
+
 void BackingStoreManager::resize_backing_stores_if_needed(WindowResizingInProgress window_resize_in_progress)
 {
     auto css_pixels_viewpor_rect = m_page_client.page().top_level_traversable()->viewport_rect();
@@ -23,6 +23,7 @@ public:
     };
     void resize_backing_stores_if_needed(WindowResizingInProgress window_resize_in_progress);
     void reallocate_backing_stores(Gfx::IntSize);
+    void release_backing_stores();
     void restart_resize_timer();
 
     struct BackingStore {
@@ -13,11 +13,15 @@
 #include <AK/QuickSort.h>
 #include <LibCore/EventLoop.h>
 #include <LibGC/Heap.h>
+#include <LibGC/HeapSnapshot.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/SystemTheme.h>
+#include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/ExecutionContext.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibUnicode/TimeZone.h>
 #include <LibWeb/ARIA/RoleType.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -32,6 +36,7 @@
 #include <LibWeb/DOM/Text.h>
 #include <LibWeb/Dump.h>
 #include <LibWeb/HTML/BrowsingContext.h>
+#include <LibWeb/HTML/DecodedImageCache.h>
 #include <LibWeb/HTML/HTMLInputElement.h>
 #include <LibWeb/HTML/SelectedFile.h>
 #include <LibWeb/HTML/Storage.h>
@@ -201,6 +206,14 @@ void ConnectionFromClient::key_event(u64 page_id, Web::KeyEvent event)
 
 void ConnectionFromClient::mouse_event(u64 page_id, Web::MouseEvent event)
 {
+    // FIXME: Wheel events only reach us once the main thread gets back to the event loop, so scrolling stalls
+    //        while JavaScript is busy, even though scroll offsets are applied at playback time via ScrollStateSnapshot.
+    //        Scrolling asynchronously would need:
+    //        - these messages received on a separate thread.
+    //        - a thread-safe copy of the scroll frames and their scrollable overflow rects, to find the wheel
+    //          event's target and clamp its offset without touching the paintable tree.
+    //        - the RenderingThread replaying its last display list with the adjusted snapshot.
+    //        - the new offsets synced back to the main thread, which would then fire scroll events.
     // OPTIMIZATION: Coalesce consecutive unprocessed mouse move and wheel events.
     auto event_to_coalesce = [&]() -> Web::MouseEvent const* {
         if (m_input_event_queue.is_empty())
@@ -285,6 +298,28 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteSt
         return;
     }
 
+    if (request == "dump-frame-timings") {
+        auto const& timings = page->page().top_level_traversable()->frame_timings();
+        auto dump_histogram = [](StringView name, Web::HTML::FrameTimeHistogram const& histogram) {
+            if (histogram.count() == 0) {
+                dbgln("{}: no frames", name);
+                return;
+            }
+            dbgln("{}: {} frames, average {} us, max {} us", name, histogram.count(), histogram.total().to_microseconds() / static_cast<i64>(histogram.count()), histogram.max().to_microseconds());
+            for (size_t i = 0; i < histogram.buckets().size(); ++i) {
+                if (i < Web::HTML::FrameTimeHistogram::bucket_upper_bounds_in_milliseconds.size())
+                    dbgln("    < {:>2} ms: {}", Web::HTML::FrameTimeHistogram::bucket_upper_bounds_in_milliseconds[i], histogram.buckets()[i]);
+                else
+                    dbgln("   >= {:>2} ms: {}", Web::HTML::FrameTimeHistogram::bucket_upper_bounds_in_milliseconds.last(), histogram.buckets()[i]);
+            }
+        };
+        dump_histogram("Main thread time"sv, timings.main_thread_time);
+        dump_histogram("Rasterization time"sv, timings.rasterization_time);
+        dump_histogram("Presentation latency"sv, timings.presentation_latency);
+        dbgln("Skipped frames: {}", timings.number_of_skipped_frames);
+        return;
+    }
+
     if (request == "dump-style-sheets") {
         if (auto* doc = page->page().top_level_browsing_context().active_document()) {
             dbgln("=== In document: ===");
@@ -967,6 +1002,51 @@ static void append_gc_graph(StringBuilder& builder)
     gc_graph.serialize(builder);
 }
 
+static String capture_allocation_site()
+{
+    // NOTE: A few of the innermost frames are enough to tell allocation sites apart, and keep the number of distinct
+    //       sites down.
+    static constexpr size_t max_frame_count = 4;
+
+    auto const& execution_context_stack = Web::Bindings::main_thread_vm().execution_context_stack();
+    StringBuilder builder;
+
+    for (size_t i = execution_context_stack.size(), frame_count = 0; i > 0 && frame_count < max_frame_count; --i, ++frame_count) {
+        auto const& context = *execution_context_stack[i - 1];
+        auto function_name = context.function_name ? context.function_name->utf8_string() : "(anonymous)"_string;
+
+        if (frame_count > 0)
+            builder.append(" <- "sv);
+
+        if (context.executable) {
+            auto source_range = context.executable->source_range_at(context.program_counter).realize();
+            builder.appendff("{} @ {}:{}:{}", function_name, source_range.filename(), source_range.start.line, source_range.start.column);
+        } else {
+            builder.append(function_name);
+        }
+    }
+
+    if (builder.is_empty())
+        return "(native)"_string;
+    return MUST(builder.to_string());
+}
+
+void ConnectionFromClient::append_heap_snapshot(StringBuilder& builder)
+{
+    static constexpr size_t allocation_site_sample_interval_in_bytes = 64 * KiB;
+
+    auto& heap = Web::Bindings::main_thread_vm().heap();
+    auto snapshot = make<GC::HeapSnapshot>(GC::HeapSnapshot::take(heap));
+    MUST(snapshot->serialize(builder, m_previous_heap_snapshot.ptr()));
+
+    // Allocation sites are only sampled from the first snapshot on, so they show up for the cells that were allocated
+    // between it and the following snapshots, which are the ones to look at when hunting for leaks.
+    if (!heap.is_sampling_allocation_sites())
+        heap.start_sampling_allocation_sites(allocation_site_sample_interval_in_bytes, capture_allocation_site);
+
+    m_previous_heap_snapshot = move(snapshot);
+}
+
 void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::PageInfoType type)
 {
     auto page = this->page(page_id);
@@ -999,6 +1079,12 @@ void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::Page
         append_gc_graph(builder);
     }
 
+    if (has_flag(type, WebView::PageInfoType::HeapSnapshot)) {
+        if (!builder.is_empty())
+            builder.append("\n"sv);
+        append_heap_snapshot(builder);
+    }
+
     async_did_get_internal_page_info(page_id, type, MUST(builder.to_string()));
 }
 
@@ -1200,6 +1286,18 @@ void ConnectionFromClient::set_system_visibility_state(u64 page_id, Web::HTML::V
         page->page().top_level_traversable()->set_system_visibility_state(visibility_state);
 }
 
+void ConnectionFromClient::set_page_frozen(u64 page_id, bool frozen)
+{
+    if (auto page = this->page(page_id); page.has_value())
+        page->set_frozen(frozen);
+}
+
+void ConnectionFromClient::restore_session_state(u64 page_id, ByteString session_state)
+{
+    if (auto page = this->page(page_id); page.has_value())
+        page->set_session_state_to_restore(move(session_state));
+}
+
 void ConnectionFromClient::js_console_input(u64 page_id, String js_source)
 {
     auto page = this->page(page_id);
@@ -1221,6 +1319,34 @@ void ConnectionFromClient::js_console_request_messages(u64 page_id, i32 start_in
         page->js_console_request_messages(start_index);
 }
 
+void ConnectionFromClient::start_js_profiler(u64)
+{
+    // NOTE: The profiler samples everything running in this process, no matter which page asked for it.
+    if (m_js_profiler)
+        return;
+
+    auto profiler = JS::SamplingProfiler::start(Web::Bindings::main_thread_vm());
+    if (profiler.is_error()) {
+        dbgln("Unable to start the JavaScript profiler: {}", profiler.error());
+        return;
+    }
+
+    m_js_profiler = profiler.release_value();
+}
+
+void ConnectionFromClient::stop_js_profiler(u64 page_id)
+{
+    if (!m_js_profiler) {
+        async_did_stop_js_profiler(page_id, JsonValue {});
+        return;
+    }
+
+    auto profile = m_js_profiler->stop();
+    m_js_profiler = nullptr;
+
+    async_did_stop_js_profiler(page_id, move(profile));
+}
+
 void ConnectionFromClient::alert_closed(u64 page_id)
 {
     if (auto page = this->page(page_id); page.has_value())
@@ -1305,4 +1431,17 @@ void ConnectionFromClient::system_time_zone_changed()
     Unicode::clear_system_time_zone_cache();
 }
 
+void ConnectionFromClient::local_storage_changed(String storage_key, Vector<Web::StorageAPI::StorageChange> changes)
+{
+    Web::HTML::Storage::apply_local_storage_changes_from_other_process(storage_key, changes);
+}
+
+void ConnectionFromClient::release_memory()
+{
+    Web::ResourceLoader::the().clear_cache();
+    Web::HTML::DecodedImageCache::the().discard_all_images();
+
+    Web::Bindings::main_thread_vm().heap().collect_garbage();
+}
+
 }
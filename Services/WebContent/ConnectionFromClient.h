@@ -11,6 +11,7 @@
 #include <AK/HashMap.h>
 #include <AK/Queue.h>
 #include <AK/SourceLocation.h>
+#include <LibGC/Forward.h>
 #include <LibGC/Root.h>
 #include <LibIPC/ConnectionFromClient.h>
 #include <LibJS/Forward.h>
@@ -117,11 +118,16 @@ private:
     virtual void did_update_window_rect(u64 page_id) override;
     virtual void handle_file_return(u64 page_id, i32 error, Optional<IPC::File> file, i32 request_id) override;
     virtual void set_system_visibility_state(u64 page_id, Web::HTML::VisibilityState) override;
+    virtual void set_page_frozen(u64 page_id, bool frozen) override;
+    virtual void restore_session_state(u64 page_id, ByteString session_state) override;
 
     virtual void js_console_input(u64 page_id, String) override;
     virtual void run_javascript(u64 page_id, String) override;
     virtual void js_console_request_messages(u64 page_id, i32) override;
 
+    virtual void start_js_profiler(u64 page_id) override;
+    virtual void stop_js_profiler(u64 page_id) override;
+
     virtual void alert_closed(u64 page_id) override;
     virtual void confirm_closed(u64 page_id, bool accepted) override;
     virtual void prompt_closed(u64 page_id, Optional<String> response) override;
@@ -158,15 +164,23 @@ private:
     virtual void paste(u64 page_id, String text) override;
 
     virtual void system_time_zone_changed() override;
+    virtual void local_storage_changed(String storage_key, Vector<Web::StorageAPI::StorageChange> changes) override;
+
+    virtual void release_memory() override;
 
     NonnullOwnPtr<PageHost> m_page_host;
 
     HashMap<int, Web::FileRequest> m_requested_files {};
     int last_id { 0 };
 
+    void append_heap_snapshot(StringBuilder&);
+
     void enqueue_input_event(Web::QueuedInputEvent);
 
     Queue<Web::QueuedInputEvent> m_input_event_queue;
+
+    OwnPtr<JS::SamplingProfiler> m_js_profiler;
+    OwnPtr<GC::HeapSnapshot> m_previous_heap_snapshot;
 };
 
 }
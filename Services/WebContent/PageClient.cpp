@@ -20,6 +20,7 @@
 #include <LibWeb/DOM/Element.h>
 #include <LibWeb/DOM/MutationType.h>
 #include <LibWeb/DOM/NodeList.h>
+#include <LibWeb/HTML/DecodedImageCache.h>
 #include <LibWeb/HTML/HTMLLinkElement.h>
 #include <LibWeb/HTML/Scripting/ClassicScript.h>
 #include <LibWeb/HTML/TraversableNavigable.h>
@@ -30,6 +31,7 @@
 #include <WebContent/DevToolsConsoleClient.h>
 #include <WebContent/PageClient.h>
 #include <WebContent/PageHost.h>
+#include <WebContent/SessionState.h>
 #include <WebContent/WebContentClientEndpoint.h>
 #include <WebContent/WebDriverConnection.h>
 #include <WebContent/WebUIConnection.h>
@@ -38,6 +40,7 @@ namespace WebContent {
 
 static PageClient::UseSkiaPainter s_use_skia_painter = PageClient::UseSkiaPainter::GPUBackendIfAvailable;
 static bool s_is_headless { false };
+static bool s_render_on_demand { false };
 
 GC_DEFINE_ALLOCATOR(PageClient);
 
@@ -56,6 +59,11 @@ void PageClient::set_is_headless(bool is_headless)
     s_is_headless = is_headless;
 }
 
+void PageClient::set_render_on_demand(bool render_on_demand)
+{
+    s_render_on_demand = render_on_demand;
+}
+
 GC::Ref<PageClient> PageClient::create(JS::VM& vm, PageHost& page_host, u64 id)
 {
     return vm.heap().allocate<PageClient>(page_host, id);
@@ -74,7 +82,8 @@ PageClient::PageClient(PageHost& owner, u64 id)
         Web::HTML::main_thread_event_loop().queue_task_to_update_the_rendering();
     });
 
-    m_paint_refresh_timer->start();
+    if (!s_render_on_demand)
+        m_paint_refresh_timer->start();
 }
 
 PageClient::~PageClient() = default;
@@ -103,6 +112,15 @@ ConnectionFromClient& PageClient::client() const
 void PageClient::set_has_focus(bool has_focus)
 {
     m_has_focus = has_focus;
+
+    // Focus affects how the entire page is painted.
+    page().top_level_traversable()->set_entire_viewport_damaged();
+}
+
+void PageClient::set_should_show_line_box_borders(bool should_show_line_box_borders)
+{
+    m_should_show_line_box_borders = should_show_line_box_borders;
+    page().top_level_traversable()->set_entire_viewport_damaged();
 }
 
 void PageClient::setup_palette()
@@ -219,6 +237,11 @@ void PageClient::ready_to_paint()
 {
     m_number_of_queued_rasterization_tasks--;
     VERIFY(m_number_of_queued_rasterization_tasks >= 0 && m_number_of_queued_rasterization_tasks < 2);
+
+    if (!m_queued_rasterization_task_start_times.is_empty()) {
+        auto presentation_latency = MonotonicTime::now() - m_queued_rasterization_task_start_times.dequeue();
+        page().top_level_traversable()->frame_timings().presentation_latency.record(presentation_latency);
+    }
 }
 
 void PageClient::paint_next_frame()
@@ -229,14 +252,67 @@ void PageClient::paint_next_frame()
 
     VERIFY(m_number_of_queued_rasterization_tasks <= 1);
     m_number_of_queued_rasterization_tasks++;
+    m_queued_rasterization_task_start_times.enqueue(MonotonicTime::now());
 
     auto viewport_rect = page().css_to_device_rect(page().top_level_traversable()->viewport_rect());
-    start_display_list_rendering(viewport_rect, *back_store, {}, [this, viewport_rect, backing_store_id] {
+    auto damage_rect = take_damage_rect_for_next_frame();
+    start_display_list_rendering(viewport_rect, *back_store, {}, damage_rect, [this, viewport_rect, backing_store_id] {
         client().async_did_paint(m_id, viewport_rect.to_type<int>(), backing_store_id);
     });
 }
 
+Optional<Gfx::IntRect> PageClient::take_damage_rect_for_next_frame()
+{
+    Optional<Gfx::IntRect> frame_damage_rect;
+    if (auto damage_rect = page().top_level_traversable()->take_damage_rect(); damage_rect.has_value()) {
+        frame_damage_rect = page().enclosing_device_rect(*damage_rect).to_type<int>();
+
+        // Leave some room for antialiasing along the edges of the damaged area.
+        frame_damage_rect->inflate(4, 4);
+    }
+
+    // We alternate between two backing stores, so the one we're about to paint into is also missing whatever
+    // changed in the previous frame.
+    Optional<Gfx::IntRect> damage_rect_to_repaint;
+    if (frame_damage_rect.has_value() && m_previous_frame_damage_rect.has_value())
+        damage_rect_to_repaint = frame_damage_rect->united(*m_previous_frame_damage_rect);
+
+    m_previous_frame_damage_rect = frame_damage_rect;
+    return damage_rect_to_repaint;
+}
+
+void PageClient::set_frozen(bool frozen)
+{
+    if (page().is_frozen() == frozen)
+        return;
+    page().set_is_frozen(frozen);
+
+    if (frozen) {
+        // NOTE: A frame that is still being rasterized holds on to the back store, so we only let go of the backing
+        //       stores if there is none. Either way, they are reallocated when we are thawed.
+        if (m_number_of_queued_rasterization_tasks == 0)
+            m_backing_store_manager.release_backing_stores();
+        Web::HTML::DecodedImageCache::the().discard_all_images();
+
+        client().async_did_freeze_page(m_id, serialize_session_state(page()));
+    } else {
+        m_backing_store_manager.resize_backing_stores_if_needed(BackingStoreManager::WindowResizingInProgress::No);
+    }
+}
+
+void PageClient::did_reallocate_backing_stores()
+{
+    // The contents of newly allocated backing stores are undefined, so both of them have to be repainted in full.
+    m_previous_frame_damage_rect.clear();
+    page().top_level_traversable()->set_entire_viewport_damaged();
+}
+
 void PageClient::start_display_list_rendering(Web::DevicePixelRect const& content_rect, Web::Painting::BackingStore& target, Web::PaintOptions paint_options, Function<void()>&& callback)
+{
+    start_display_list_rendering(content_rect, target, paint_options, {}, move(callback));
+}
+
+void PageClient::start_display_list_rendering(Web::DevicePixelRect const& content_rect, Web::Painting::BackingStore& target, Web::PaintOptions paint_options, Optional<Gfx::IntRect> damage_rect, Function<void()>&& callback)
 {
     paint_options.should_show_line_box_borders = m_should_show_line_box_borders;
     paint_options.has_focus = m_has_focus;
@@ -246,7 +322,7 @@ void PageClient::start_display_list_rendering(Web::DevicePixelRect const& conten
         callback();
         return;
     }
-    traversable.start_display_list_rendering(*display_list, target, move(callback));
+    traversable.start_display_list_rendering(*display_list, target, damage_rect, move(callback));
 }
 
 Queue<Web::QueuedInputEvent>& PageClient::input_event_queue()
@@ -397,6 +473,9 @@ void PageClient::page_did_change_active_document_in_top_level_browsing_context(W
 
 void PageClient::page_did_finish_loading(URL::URL const& url)
 {
+    if (m_session_state_to_restore.has_value())
+        restore_session_state(page(), m_session_state_to_restore.release_value());
+
     client().async_did_finish_loading(m_id, url);
 }
 
@@ -578,6 +657,64 @@ void PageClient::page_did_expire_cookies_with_time_offset(AK::Duration offset)
     client().async_did_expire_cookies_with_time_offset(offset);
 }
 
+Optional<Web::IndexedDB::PersistedDatabase> PageClient::page_did_request_indexed_db_database(String const& storage_key, String const& name)
+{
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestIndexedDbDatabase>(storage_key, name);
+    if (!response) {
+        dbgln("WebContent client disconnected during DidRequestIndexedDbDatabase. Exiting peacefully.");
+        exit(0);
+    }
+
+    auto schema = response->take_schema();
+    if (!schema.has_value())
+        return {};
+
+    return Web::IndexedDB::PersistedDatabase { schema.release_value(), response->take_object_store_records() };
+}
+
+bool PageClient::page_did_update_indexed_db_database(String const& storage_key, String const& name, Web::IndexedDB::PersistedDatabase const& database, Vector<String> const& object_store_names)
+{
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidUpdateIndexedDbDatabase>(storage_key, name, database.schema, database.object_store_records, object_store_names);
+    if (!response) {
+        dbgln("WebContent client disconnected during DidUpdateIndexedDbDatabase. Exiting peacefully.");
+        exit(0);
+    }
+
+    return response->stored();
+}
+
+void PageClient::page_did_delete_indexed_db_database(String const& storage_key, String const& name)
+{
+    client().async_did_delete_indexed_db_database(storage_key, name);
+}
+
+OrderedHashMap<String, String> PageClient::page_did_request_local_storage(String const& storage_key)
+{
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestLocalStorage>(storage_key);
+    if (!response) {
+        dbgln("WebContent client disconnected during DidRequestLocalStorage. Exiting peacefully.");
+        exit(0);
+    }
+
+    return response->take_items();
+}
+
+void PageClient::page_did_change_local_storage(String const& storage_key, Vector<Web::StorageAPI::StorageChange> const& changes)
+{
+    client().async_did_change_local_storage(storage_key, changes);
+}
+
+Optional<Web::StorageAPI::StorageEstimate> PageClient::page_did_request_storage_estimate(String const& storage_key)
+{
+    auto response = client().send_sync_but_allow_failure<Messages::WebContentClient::DidRequestStorageEstimate>(storage_key);
+    if (!response) {
+        dbgln("WebContent client disconnected during DidRequestStorageEstimate. Exiting peacefully.");
+        exit(0);
+    }
+
+    return Web::StorageAPI::StorageEstimate { .usage = response->usage(), .quota = response->quota() };
+}
+
 void PageClient::page_did_update_resource_count(i32 count_waiting)
 {
     client().async_did_update_resource_count(m_id, count_waiting);
@@ -916,6 +1053,10 @@ void PageClient::queue_screenshot_task(Optional<Web::UniqueNodeID> node_id)
 {
     m_screenshot_tasks.enqueue({ node_id });
     page().top_level_traversable()->set_needs_repaint();
+
+    // Screenshots are taken while updating the rendering, which otherwise never happens when rendering on demand.
+    if (s_render_on_demand)
+        Web::HTML::main_thread_event_loop().queue_task_to_update_the_rendering();
 }
 
 }
@@ -38,6 +38,10 @@ public:
     virtual bool is_headless() const override;
     static void set_is_headless(bool);
 
+    // Rather than updating the rendering at a fixed refresh rate, only update it when a screenshot is requested. This is
+    // meant for batch captures, where nothing ever looks at the frames in between.
+    static void set_render_on_demand(bool);
+
     virtual bool is_ready_to_paint() const override;
 
     virtual Web::Page& page() override { return *m_page; }
@@ -60,11 +64,13 @@ public:
     void set_preferred_color_scheme(Web::CSS::PreferredColorScheme);
     void set_preferred_contrast(Web::CSS::PreferredContrast);
     void set_preferred_motion(Web::CSS::PreferredMotion);
-    void set_should_show_line_box_borders(bool b) { m_should_show_line_box_borders = b; }
+    void set_should_show_line_box_borders(bool);
     void set_has_focus(bool);
     void set_is_scripting_enabled(bool);
     void set_window_position(Web::DevicePixelPoint);
     void set_window_size(Web::DevicePixelSize);
+    void set_frozen(bool);
+    void set_session_state_to_restore(ByteString session_state) { m_session_state_to_restore = move(session_state); }
 
     Web::DevicePixelSize content_size() const { return m_content_size; }
 
@@ -156,6 +162,12 @@ private:
     virtual void page_did_set_cookie(URL::URL const&, Web::Cookie::ParsedCookie const&, Web::Cookie::Source) override;
     virtual void page_did_update_cookie(Web::Cookie::Cookie const&) override;
     virtual void page_did_expire_cookies_with_time_offset(AK::Duration) override;
+    virtual Optional<Web::IndexedDB::PersistedDatabase> page_did_request_indexed_db_database(String const& storage_key, String const& name) override;
+    virtual bool page_did_update_indexed_db_database(String const& storage_key, String const& name, Web::IndexedDB::PersistedDatabase const&, Vector<String> const& object_store_names) override;
+    virtual void page_did_delete_indexed_db_database(String const& storage_key, String const& name) override;
+    virtual OrderedHashMap<String, String> page_did_request_local_storage(String const& storage_key) override;
+    virtual void page_did_change_local_storage(String const& storage_key, Vector<Web::StorageAPI::StorageChange> const&) override;
+    virtual Optional<Web::StorageAPI::StorageEstimate> page_did_request_storage_estimate(String const& storage_key) override;
     virtual void page_did_update_resource_count(i32) override;
     virtual NewWebViewResult page_did_request_new_web_view(Web::HTML::ActivateTab, Web::HTML::WebViewHints, Web::HTML::TokenizedFeature::NoOpener) override;
     virtual void page_did_request_activate_tab() override;
@@ -181,6 +193,10 @@ private:
     void setup_palette();
     ConnectionFromClient& client() const;
 
+    void start_display_list_rendering(Web::DevicePixelRect const& content_rect, Web::Painting::BackingStore&, Web::PaintOptions, Optional<Gfx::IntRect> damage_rect, Function<void()>&& callback);
+    Optional<Gfx::IntRect> take_damage_rect_for_next_frame();
+    void did_reallocate_backing_stores();
+
     PageHost& m_owner;
     GC::Ref<Web::Page> m_page;
     RefPtr<Gfx::PaletteImpl> m_palette_impl;
@@ -193,6 +209,12 @@ private:
 
     i32 m_number_of_queued_rasterization_tasks { 0 };
 
+    // When each of the queued rasterization tasks was started, so we can tell how long it took to present the frame.
+    Queue<MonotonicTime> m_queued_rasterization_task_start_times;
+
+    // Damage (in device pixels) painted into the front store by the last frame, or an empty Optional if it repainted everything.
+    Optional<Gfx::IntRect> m_previous_frame_damage_rect;
+
     struct ScreenshotTask {
         Optional<Web::UniqueNodeID> node_id;
     };
@@ -207,6 +229,9 @@ private:
 
     BackingStoreManager m_backing_store_manager;
 
+    // Restored once the page has finished loading, see restore_session_state().
+    Optional<ByteString> m_session_state_to_restore;
+
     WeakPtr<WebContentConsoleClient> m_top_level_document_console_client;
 
     GC::Root<JS::GlobalObject> m_console_global_object;
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/HTML/HTMLInputElement.h>
+#include <LibWeb/HTML/HTMLSelectElement.h>
+#include <LibWeb/HTML/HTMLTextAreaElement.h>
+#include <LibWeb/HTML/TraversableNavigable.h>
+#include <LibWeb/Page/Page.h>
+#include <WebContent/SessionState.h>
+
+namespace WebContent {
+
+static bool should_persist_input(Web::HTML::HTMLInputElement const& input)
+{
+    using enum Web::HTML::HTMLInputElement::TypeAttributeState;
+
+    switch (input.type_state()) {
+    // NOTE: Hidden inputs are controlled by the page itself, and we don't keep passwords or selected files around.
+    case Hidden:
+    case Password:
+    case FileUpload:
+    case SubmitButton:
+    case ImageButton:
+    case ResetButton:
+    case Button:
+        return false;
+    default:
+        return true;
+    }
+}
+
+static bool is_checkable(Web::HTML::HTMLInputElement const& input)
+{
+    return input.type_state() == Web::HTML::HTMLInputElement::TypeAttributeState::Checkbox
+        || input.type_state() == Web::HTML::HTMLInputElement::TypeAttributeState::RadioButton;
+}
+
+// Calls the callback for each form control of the document, in tree order, along with its index among them.
+template<typename Callback>
+static void for_each_form_control(Web::DOM::Document& document, Callback callback)
+{
+    size_t index = 0;
+    document.for_each_in_subtree_of_type<Web::DOM::Element>([&](Web::DOM::Element& element) {
+        if (is<Web::HTML::HTMLInputElement>(element) || is<Web::HTML::HTMLTextAreaElement>(element) || is<Web::HTML::HTMLSelectElement>(element))
+            callback(element, index++);
+        return TraversalDecision::Continue;
+    });
+}
+
+ByteString serialize_session_state(Web::Page const& page)
+{
+    auto const& traversable = page.top_level_traversable();
+
+    JsonObject session_state;
+    session_state.set("scroll_x"sv, traversable->viewport_scroll_offset().x().to_double());
+    session_state.set("scroll_y"sv, traversable->viewport_scroll_offset().y().to_double());
+
+    JsonArray form_controls;
+
+    if (auto document = traversable->active_document()) {
+        for_each_form_control(*document, [&](Web::DOM::Element& element, size_t index) {
+            JsonObject form_control;
+            form_control.set("index"sv, index);
+            form_control.set("name"sv, element.get_attribute_value(Web::HTML::AttributeNames::name));
+
+            if (auto* input = as_if<Web::HTML::HTMLInputElement>(element)) {
+                if (!should_persist_input(*input))
+                    return;
+
+                // NOTE: We only remember what the user has changed, restoring everything else would mark it as dirty.
+                if (is_checkable(*input)) {
+                    if (input->checked() == input->has_attribute(Web::HTML::AttributeNames::checked))
+                        return;
+                    form_control.set("checked"sv, input->checked());
+                } else {
+                    auto value = input->value();
+                    if (value == input->default_value())
+                        return;
+                    form_control.set("value"sv, value);
+                }
+            } else if (auto* text_area = as_if<Web::HTML::HTMLTextAreaElement>(element)) {
+                auto value = text_area->value();
+                if (value == text_area->default_value())
+                    return;
+                form_control.set("value"sv, value);
+            } else if (auto* select = as_if<Web::HTML::HTMLSelectElement>(element)) {
+                form_control.set("selected_index"sv, select->selected_index());
+            }
+
+            form_controls.must_append(move(form_control));
+        });
+    }
+
+    session_state.set("form_controls"sv, move(form_controls));
+    return session_state.serialized().to_byte_string();
+}
+
+void restore_session_state(Web::Page& page, StringView serialized_session_state)
+{
+    auto json = JsonValue::from_string(serialized_session_state);
+    if (json.is_error() || !json.value().is_object()) {
+        dbgln("Unable to parse session state: {}", serialized_session_state);
+        return;
+    }
+    auto const& session_state = json.value().as_object();
+
+    auto traversable = page.top_level_traversable();
+    auto document = traversable->active_document();
+    if (!document)
+        return;
+
+    if (auto form_controls = session_state.get_array("form_controls"sv); form_controls.has_value()) {
+        HashMap<size_t, JsonObject const*> form_controls_by_index;
+        form_controls->for_each([&](JsonValue const& form_control) {
+            if (!form_control.is_object())
+                return;
+            if (auto index = form_control.as_object().get_integer<size_t>("index"sv); index.has_value())
+                form_controls_by_index.set(*index, &form_control.as_object());
+        });
+
+        for_each_form_control(*document, [&](Web::DOM::Element& element, size_t index) {
+            auto form_control = form_controls_by_index.get(index);
+            if (!form_control.has_value())
+                return;
+
+            // NOTE: The page may have changed since we serialized its state, so we only restore controls that still look the same.
+            auto name = (*form_control)->get_string("name"sv);
+            if (!name.has_value() || *name != element.get_attribute_value(Web::HTML::AttributeNames::name))
+                return;
+
+            if (auto* input = as_if<Web::HTML::HTMLInputElement>(element)) {
+                if (!should_persist_input(*input))
+                    return;
+
+                if (auto checked = (*form_control)->get_bool("checked"sv); checked.has_value() && is_checkable(*input))
+                    input->set_checked_binding(*checked);
+                else if (auto value = (*form_control)->get_string("value"sv); value.has_value() && !is_checkable(*input))
+                    (void)input->set_value(*value);
+            } else if (auto* text_area = as_if<Web::HTML::HTMLTextAreaElement>(element)) {
+                if (auto value = (*form_control)->get_string("value"sv); value.has_value())
+                    text_area->set_value(*value);
+            } else if (auto* select = as_if<Web::HTML::HTMLSelectElement>(element)) {
+                if (auto selected_index = (*form_control)->get_integer<i32>("selected_index"sv); selected_index.has_value())
+                    select->set_selected_index(*selected_index);
+            }
+        });
+    }
+
+    auto scroll_x = session_state.get_double_with_precision_loss("scroll_x"sv).value_or(0);
+    auto scroll_y = session_state.get_double_with_precision_loss("scroll_y"sv).value_or(0);
+    traversable->perform_scroll_of_viewport({ Web::CSSPixels(scroll_x), Web::CSSPixels(scroll_y) });
+}
+
+}
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/StringView.h>
+#include <LibWeb/Forward.h>
+
+namespace WebContent {
+
+// The session state of a page is what the user would lose if the page was simply reloaded: its scroll position, and
+// the values they entered into its form controls. It's what lets a discarded background tab be restored on activation.
+ByteString serialize_session_state(Web::Page const&);
+void restore_session_state(Web::Page&, StringView session_state);
+
+}
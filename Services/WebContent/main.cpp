@@ -19,6 +19,7 @@
 #include <LibMedia/Audio/Loader.h>
 #include <LibRequests/RequestClient.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Internals/Internals.h>
 #include <LibWeb/Loader/ContentFilter.h>
@@ -106,6 +107,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool force_fontconfig = false;
     bool collect_garbage_on_every_allocation = false;
     bool is_headless = false;
+    bool render_on_demand = false;
     bool disable_scrollbar_painting = false;
     StringView echo_server_port_string_view {};
 
@@ -130,6 +132,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     args_parser.add_option(disable_scrollbar_painting, "Don't paint horizontal or vertical viewport scrollbars", "disable-scrollbar-painting");
     args_parser.add_option(echo_server_port_string_view, "Echo server port used in test internals", "echo-server-port", 0, "echo_server_port");
     args_parser.add_option(is_headless, "Report that the browser is running in headless mode", "headless");
+    args_parser.add_option(render_on_demand, "Only update the rendering when a screenshot is requested", "render-on-demand");
 
     args_parser.parse(arguments);
 
@@ -156,6 +159,7 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     WebContent::PageClient::set_use_skia_painter(force_cpu_painting ? WebContent::PageClient::UseSkiaPainter::CPUBackend : WebContent::PageClient::UseSkiaPainter::GPUBackendIfAvailable);
 
     WebContent::PageClient::set_is_headless(is_headless);
+    WebContent::PageClient::set_render_on_demand(render_on_demand);
 
     if (disable_site_isolation)
         WebView::disable_site_isolation();
@@ -221,6 +225,15 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
             dbgln("Failed to reinitialize image decoder: {}", maybe_error.error());
     };
 
+    // Most WebContent processes are launched as spares ahead of the page they end up hosting. Do the
+    // work every page needs now, once the connection to the UI process is up, rather than on the
+    // critical path of the first navigation.
+    Core::deferred_invoke([] {
+        Web::CSS::StyleComputer::preload_user_agent_style_sheets();
+
+        (void)Web::Platform::FontPlugin::the().default_font(12);
+    });
+
     return event_loop.exec();
 }
 
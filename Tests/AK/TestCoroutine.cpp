@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/Coroutine.h>
+
+namespace {
+
+struct ManualResume {
+    bool await_ready() const { return false; }
+    void await_suspend(std::coroutine_handle<> handle) { s_suspended = handle; }
+    void await_resume() const { }
+
+    static inline std::coroutine_handle<> s_suspended;
+};
+
+}
+
+static Coroutine<int> return_value_immediately(int value)
+{
+    co_return value;
+}
+
+static Coroutine<int> return_value_after_suspending(int value)
+{
+    co_await ManualResume {};
+    co_return value;
+}
+
+static Coroutine<void> set_flag_after_suspending(bool& flag)
+{
+    co_await ManualResume {};
+    flag = true;
+}
+
+static Coroutine<int> add_awaited_values()
+{
+    auto a = co_await return_value_immediately(1);
+    auto b = co_await return_value_after_suspending(2);
+    co_return a + b;
+}
+
+TEST_CASE(coroutine_runs_eagerly)
+{
+    auto coroutine = return_value_immediately(42);
+    EXPECT(coroutine.is_done());
+    EXPECT_EQ(coroutine.take_result(), 42);
+}
+
+TEST_CASE(awaiting_coroutine_resumes_awaiter)
+{
+    auto coroutine = add_awaited_values();
+    EXPECT(!coroutine.is_done());
+
+    ManualResume::s_suspended.resume();
+    EXPECT(coroutine.is_done());
+    EXPECT_EQ(coroutine.take_result(), 3);
+}
+
+TEST_CASE(detached_coroutine_runs_to_completion)
+{
+    bool finished = false;
+
+    set_flag_after_suspending(finished).detach();
+    EXPECT(!finished);
+
+    ManualResume::s_suspended.resume();
+    EXPECT(finished);
+}
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/FastHashMap.h>
+#include <AK/HashMap.h>
+#include <AK/OwnPtr.h>
+#include <AK/Random.h>
+#include <AK/String.h>
+
+TEST_CASE(construct)
+{
+    using IntIntMap = FastHashMap<int, int>;
+    EXPECT(IntIntMap().is_empty());
+    EXPECT_EQ(IntIntMap().size(), 0u);
+    EXPECT_EQ(IntIntMap().memory_footprint(), 0u);
+}
+
+TEST_CASE(populate)
+{
+    FastHashMap<int, String> number_to_string {
+        { 1, "One"_string },
+        { 2, "Two"_string },
+        { 3, "Three"_string },
+    };
+    EXPECT_EQ(number_to_string.size(), 3u);
+    EXPECT_EQ(number_to_string.get(1), "One"sv);
+    EXPECT_EQ(number_to_string.get(2), "Two"sv);
+    EXPECT_EQ(number_to_string.get(3), "Three"sv);
+    EXPECT(!number_to_string.get(4).has_value());
+}
+
+TEST_CASE(set_existing_entry)
+{
+    FastHashMap<int, int> map;
+    EXPECT_EQ(map.set(1, 1), HashSetResult::InsertedNewEntry);
+    EXPECT_EQ(map.set(1, 2), HashSetResult::ReplacedExistingEntry);
+    EXPECT_EQ(map.set(1, 3, HashSetExistingEntryBehavior::Keep), HashSetResult::KeptExistingEntry);
+    EXPECT_EQ(map.size(), 1u);
+    EXPECT_EQ(map.get(1), 2);
+}
+
+TEST_CASE(find_with_compatible_key)
+{
+    FastHashMap<String, int> map;
+    map.set("one"_string, 1);
+    map.set("two"_string, 2);
+
+    EXPECT_EQ(map.get("one"sv), 1);
+    EXPECT_EQ(map.get("two"sv), 2);
+    EXPECT(!map.contains("three"sv));
+}
+
+TEST_CASE(remove_and_reinsert_many)
+{
+    FastHashMap<int, int> map;
+    for (int i = 0; i < 10000; ++i)
+        map.set(i, i * 2);
+    EXPECT_EQ(map.size(), 10000u);
+
+    for (int i = 0; i < 10000; i += 2)
+        EXPECT(map.remove(i));
+    EXPECT_EQ(map.size(), 5000u);
+
+    for (int i = 0; i < 10000; ++i)
+        EXPECT_EQ(map.get(i), i % 2 ? Optional<int> { i * 2 } : Optional<int> {});
+
+    for (int i = 0; i < 10000; i += 2)
+        map.set(i, i * 3);
+    EXPECT_EQ(map.size(), 10000u);
+    for (int i = 0; i < 10000; ++i)
+        EXPECT_EQ(map.get(i), i * (i % 2 ? 2 : 3));
+}
+
+TEST_CASE(churn_does_not_grow_the_table)
+{
+    FastHashMap<int, int> map;
+    for (int i = 0; i < 100; ++i)
+        map.set(i, i);
+    auto capacity = map.capacity();
+
+    // Removals leave deleted slots behind, which must be reclaimed rather than keep growing the table.
+    for (int i = 100; i < 100000; ++i) {
+        EXPECT(map.remove(i - 100));
+        map.set(i, i);
+    }
+    EXPECT_EQ(map.size(), 100u);
+    EXPECT(map.capacity() <= capacity * 2);
+}
+
+TEST_CASE(iteration_visits_every_entry_once)
+{
+    FastHashMap<int, int> map;
+    for (int i = 0; i < 1000; ++i)
+        map.set(i, i);
+    for (int i = 0; i < 1000; i += 3)
+        map.remove(i);
+
+    HashTable<int> seen;
+    for (auto const& [key, value] : map) {
+        EXPECT_EQ(key, value);
+        EXPECT_EQ(seen.set(key), HashSetResult::InsertedNewEntry);
+    }
+    EXPECT_EQ(seen.size(), map.size());
+}
+
+TEST_CASE(matches_hash_map_under_random_operations)
+{
+    FastHashMap<u32, u32> map;
+    HashMap<u32, u32> expected;
+
+    for (size_t i = 0; i < 200000; ++i) {
+        auto key = get_random_uniform(4096);
+        switch (get_random_uniform(4)) {
+        case 0:
+        case 1:
+            map.set(key, i);
+            expected.set(key, i);
+            break;
+        case 2:
+            EXPECT_EQ(map.remove(key), expected.remove(key));
+            break;
+        case 3:
+            EXPECT_EQ(map.get(key), expected.get(key));
+            break;
+        }
+    }
+
+    EXPECT_EQ(map.size(), expected.size());
+    for (auto const& [key, value] : expected)
+        EXPECT_EQ(map.get(key), value);
+}
+
+TEST_CASE(take_and_ensure)
+{
+    FastHashMap<int, OwnPtr<int>> map;
+    map.set(1, make<int>(10));
+    map.ensure(2, [] { return make<int>(20); });
+    map.ensure(1, [] { return make<int>(30); });
+
+    auto taken = map.take(1);
+    EXPECT(taken.has_value());
+    EXPECT_EQ(**taken, 10);
+    EXPECT_EQ(map.size(), 1u);
+    EXPECT_EQ(*map.find(2)->value, 20);
+}
+
+TEST_CASE(copy_and_move)
+{
+    FastHashMap<String, String> map;
+    map.set("a"_string, "1"_string);
+    map.set("b"_string, "2"_string);
+
+    auto copy = map;
+    copy.set("c"_string, "3"_string);
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_EQ(copy.size(), 3u);
+
+    auto moved = move(copy);
+    EXPECT(copy.is_empty());
+    EXPECT_EQ(moved.get("c"sv), "3"sv);
+
+    moved.clear_with_capacity();
+    EXPECT(moved.is_empty());
+    EXPECT(moved.capacity() > 0);
+}
+
+TEST_CASE(memory_footprint_is_smaller_than_hash_map)
+{
+    FastHashMap<u32, u32> map;
+    HashMap<u32, u32> hash_map;
+    for (u32 i = 0; i < 100000; ++i) {
+        map.set(i, i);
+        hash_map.set(i, i);
+    }
+
+    // A HashMap bucket is its state byte followed by the aligned key and value.
+    auto hash_map_footprint = hash_map.capacity() * align_up_to(1 + 2 * sizeof(u32), alignof(u32));
+    EXPECT(map.memory_footprint() < hash_map_footprint);
+}
+
+static constexpr size_t benchmark_entry_count = 1'000'000;
+
+template<typename Map>
+static Map make_benchmark_map()
+{
+    Map map;
+    for (u32 i = 0; i < benchmark_entry_count; ++i)
+        map.set(i * 2654435761u, i);
+    return map;
+}
+
+template<typename Map>
+static void benchmark_lookup()
+{
+    auto map = make_benchmark_map<Map>();
+    u64 sum = 0;
+    for (size_t round = 0; round < 4; ++round) {
+        // Half of the lookups miss.
+        for (u32 i = 0; i < benchmark_entry_count * 2; ++i)
+            sum += map.get(i * 2654435761u).value_or(0);
+    }
+    AK::taint_for_optimizer(sum);
+}
+
+template<typename Map>
+static void benchmark_iteration()
+{
+    auto map = make_benchmark_map<Map>();
+    u64 sum = 0;
+    for (size_t round = 0; round < 16; ++round) {
+        for (auto const& entry : map)
+            sum += entry.value;
+    }
+    AK::taint_for_optimizer(sum);
+}
+
+BENCHMARK_CASE(hash_map_insert)
+{
+    auto map = make_benchmark_map<HashMap<u32, u32>>();
+    AK::taint_for_optimizer(map);
+}
+
+BENCHMARK_CASE(fast_hash_map_insert)
+{
+    auto map = make_benchmark_map<FastHashMap<u32, u32>>();
+    AK::taint_for_optimizer(map);
+}
+
+BENCHMARK_CASE(hash_map_lookup)
+{
+    benchmark_lookup<HashMap<u32, u32>>();
+}
+
+BENCHMARK_CASE(fast_hash_map_lookup)
+{
+    benchmark_lookup<FastHashMap<u32, u32>>();
+}
+
+BENCHMARK_CASE(hash_map_iteration)
+{
+    benchmark_iteration<HashMap<u32, u32>>();
+}
+
+BENCHMARK_CASE(fast_hash_map_iteration)
+{
+    benchmark_iteration<FastHashMap<u32, u32>>();
+}
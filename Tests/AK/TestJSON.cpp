@@ -7,6 +7,7 @@
 #include <LibTest/TestCase.h>
 
 #include <AK/JsonObject.h>
+#include <AK/JsonStructuralIndex.h>
 #include <AK/JsonValue.h>
 #include <AK/StringBuilder.h>
 
@@ -178,6 +179,32 @@ TEST_CASE(json_parse_empty_string)
     EXPECT_EQ(value.is_error(), true);
 }
 
+TEST_CASE(json_structural_index)
+{
+    auto index = TRY_OR_FAIL(JsonStructuralIndex::create(R"( {"a\"{": [1, true,"x"] } )"sv));
+    EXPECT(index.positions() == Vector<u32>({ 1, 2, 8, 10, 11, 12, 14, 18, 19, 22, 24, 26 }).span());
+
+    EXPECT(JsonStructuralIndex::create(R"("abc)"sv).is_error());
+    EXPECT(JsonStructuralIndex::create(R"("abc\")"sv).is_error());
+}
+
+TEST_CASE(json_escapes_across_blocks)
+{
+    // Runs of backslashes that cross the 64-byte blocks of the structural index.
+    for (size_t padding = 0; padding < 70; ++padding) {
+        for (size_t backslashes = 1; backslashes < 6; ++backslashes) {
+            StringBuilder contents;
+            contents.append_repeated('x', padding);
+            contents.append_repeated('\\', backslashes * 2);
+            contents.append("\\\"]"sv);
+
+            auto json = TRY_OR_FAIL(JsonValue::from_string(MUST(String::formatted("[\"{}\", 1]", contents.string_view()))));
+            EXPECT_EQ(json.as_array().size(), 2u);
+            EXPECT_EQ(json.as_array()[0].as_string().bytes_as_string_view().length(), padding + backslashes + 2);
+        }
+    }
+}
+
 TEST_CASE(json_parse_long_decimals)
 {
     auto value = JsonValue::from_string("1644452550.6489999294281"sv);
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/ByteString.h>
+#include <AK/SPSCQueue.h>
+
+TEST_CASE(basic)
+{
+    SPSCQueue<int, 4> ints;
+    EXPECT(ints.is_empty());
+    EXPECT(!ints.try_dequeue().has_value());
+
+    EXPECT(ints.try_enqueue(1));
+    EXPECT(ints.try_enqueue(2));
+    EXPECT(!ints.is_empty());
+
+    EXPECT_EQ(ints.try_dequeue(), 1);
+    EXPECT_EQ(ints.try_dequeue(), 2);
+    EXPECT(ints.is_empty());
+}
+
+TEST_CASE(full)
+{
+    SPSCQueue<int, 2> ints;
+    EXPECT(ints.try_enqueue(1));
+    EXPECT(ints.try_enqueue(2));
+    EXPECT(ints.is_full());
+    EXPECT(!ints.try_enqueue(3));
+
+    EXPECT_EQ(ints.try_dequeue(), 1);
+    EXPECT(!ints.is_full());
+    EXPECT(ints.try_enqueue(3));
+    EXPECT_EQ(ints.try_dequeue(), 2);
+    EXPECT_EQ(ints.try_dequeue(), 3);
+    EXPECT(!ints.try_dequeue().has_value());
+}
+
+TEST_CASE(wrap_around)
+{
+    SPSCQueue<int, 4> ints;
+    for (int i = 0; i < 100; ++i) {
+        EXPECT(ints.try_enqueue(i));
+        EXPECT(ints.try_enqueue(i * 2));
+        EXPECT_EQ(ints.try_dequeue(), i);
+        EXPECT_EQ(ints.try_dequeue(), i * 2);
+    }
+    EXPECT(ints.is_empty());
+}
+
+TEST_CASE(complex_type)
+{
+    SPSCQueue<ByteString, 8> strings;
+    EXPECT(strings.try_enqueue("ABC"));
+    EXPECT(strings.try_enqueue("DEF"));
+    EXPECT_EQ(strings.try_dequeue(), "ABC");
+
+    // The remaining element is destroyed together with the queue.
+    EXPECT(strings.try_enqueue("GHI"));
+    EXPECT_EQ(strings.try_dequeue(), "DEF");
+}
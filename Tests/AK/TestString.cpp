@@ -190,6 +190,16 @@ TEST_CASE(with_replacement_character)
 
     auto string6 = String::from_utf8_with_replacement_character("\xEF\xBB\xBFWHF!"sv, String::WithBOMHandling::No);
     EXPECT_EQ(string6, "\xEF\xBB\xBFWHF!"sv);
+
+    auto string7 = String::from_utf8_with_replacement_character("valid \xff run \xc3 of \xe2\x82 text \xf0\x9f\x98\x80"sv, String::WithBOMHandling::No);
+    EXPECT_EQ(string7, "valid \uFFFD run \uFFFD of \uFFFD\uFFFD text \U0001F600"sv);
+}
+
+TEST_CASE(from_latin1)
+{
+    EXPECT_EQ(MUST(String::from_latin1("ASCII only"sv.bytes())), "ASCII only"sv);
+    EXPECT_EQ(MUST(String::from_latin1("caf\xe9 \xa9"sv.bytes())), "café ©"sv);
+    EXPECT(MUST(String::from_latin1({})).is_empty());
 }
 
 TEST_CASE(from_code_points)
@@ -117,6 +117,27 @@ TEST_CASE(deflate_decompress_zeroes)
     EXPECT(uncompressed == decompressed.bytes());
 }
 
+TEST_CASE(deflate_decompress_truncated_input)
+{
+    Array<u8, 20> const compressed {
+        0x0B, 0xC9, 0xC8, 0x2C, 0x56, 0x00, 0xA2, 0x44, 0x85, 0xE2, 0xCC, 0xDC,
+        0x82, 0x9C, 0x54, 0x85, 0x92, 0xD4, 0x8A, 0x12
+    };
+
+    auto const decompressed = Compress::DeflateDecompressor::decompress_all(compressed);
+    EXPECT(decompressed.is_error());
+}
+
+TEST_CASE(deflate_decompress_highly_compressed_input)
+{
+    auto original = TRY_OR_FAIL(ByteBuffer::create_zeroed(4 * MiB));
+    auto compressed = TRY_OR_FAIL(Compress::DeflateCompressor::compress_all(original));
+    EXPECT(compressed.size() * 4 < original.size());
+
+    auto uncompressed = TRY_OR_FAIL(Compress::DeflateDecompressor::decompress_all(compressed));
+    EXPECT(uncompressed == original);
+}
+
 TEST_CASE(deflate_round_trip_store)
 {
     auto original = ByteBuffer::create_uninitialized(1024).release_value();
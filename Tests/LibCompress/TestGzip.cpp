@@ -102,3 +102,18 @@ TEST_CASE(gzip_truncated_uncompressed_block)
     auto const decompressed_or_error = Compress::GzipDecompressor::decompress_all(compressed);
     EXPECT(decompressed_or_error.is_error());
 }
+
+TEST_CASE(gzip_round_trip_large_input)
+{
+    // Large enough to be compressed in blocks on several threads, with repetitions that reach across block boundaries.
+    auto original = ByteBuffer::create_uninitialized(3 * MiB).release_value();
+    fill_with_random(original.span().slice(0, 64 * KiB));
+    for (size_t offset = 64 * KiB; offset < original.size(); offset += 64 * KiB)
+        original.overwrite(offset, original.data(), 64 * KiB);
+
+    auto compressed = TRY_OR_FAIL(Compress::GzipCompressor::compress_all(original));
+    EXPECT(compressed.size() < original.size() / 4);
+
+    auto uncompressed = TRY_OR_FAIL(Compress::GzipDecompressor::decompress_all(compressed));
+    EXPECT(uncompressed == original);
+}
@@ -7,6 +7,7 @@
 #include <AK/ByteBuffer.h>
 #include <AK/MaybeOwned.h>
 #include <AK/MemoryStream.h>
+#include <AK/Random.h>
 #include <LibCompress/Zlib.h>
 #include <LibTest/TestCase.h>
 
@@ -77,6 +78,17 @@ TEST_CASE(zlib_round_trip_simple_fastest)
     EXPECT(decompressed.bytes() == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
 }
 
+TEST_CASE(zlib_round_trip_simple_fast)
+{
+    u8 const uncompressed[] = "This is a simple text file :)";
+
+    auto const freshly_pressed = TRY_OR_FAIL(Compress::ZlibCompressor::compress_all({ uncompressed, sizeof(uncompressed) - 1 }, Compress::GenericZlibCompressionLevel::Fast));
+    EXPECT(freshly_pressed.span().slice(0, 2) == ReadonlyBytes { { 0x78, 0x5E } });
+
+    auto const decompressed = TRY_OR_FAIL(Compress::ZlibDecompressor::decompress_all(freshly_pressed));
+    EXPECT(decompressed.bytes() == (ReadonlyBytes { uncompressed, sizeof(uncompressed) - 1 }));
+}
+
 TEST_CASE(zlib_decompress_with_missing_end_bits)
 {
     // This test case has been extracted from compressed PNG data of `/res/icons/16x16/app-masterword.png`.
@@ -108,3 +120,15 @@ TEST_CASE(zlib_decompress_with_missing_end_bits)
     auto decompressed = TRY_OR_FAIL(Compress::ZlibDecompressor::decompress_all(compressed));
     EXPECT_EQ(decompressed.span(), uncompressed.span());
 }
+
+TEST_CASE(zlib_round_trip_large_input)
+{
+    auto original = ByteBuffer::create_uninitialized(3 * MiB + 12345).release_value();
+    fill_with_random(original.span().slice(0, 64 * KiB));
+    for (size_t offset = 64 * KiB; offset < original.size(); offset += 64 * KiB)
+        original.overwrite(offset, original.data(), min(64 * KiB, original.size() - offset));
+
+    auto compressed = TRY_OR_FAIL(Compress::ZlibCompressor::compress_all(original));
+    auto uncompressed = TRY_OR_FAIL(Compress::ZlibDecompressor::decompress_all(compressed));
+    EXPECT(uncompressed == original);
+}
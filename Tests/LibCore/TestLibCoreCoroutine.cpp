@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/Coroutine.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/Promise.h>
+#include <LibCore/System.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(await_promise_resolution)
+{
+    Core::EventLoop loop;
+
+    auto promise = MUST(Core::Promise<int>::try_create());
+
+    auto coroutine = [](NonnullRefPtr<Core::Promise<int>> promise) -> Coroutine<int> {
+        auto result = co_await promise;
+        co_return result.release_value();
+    }(promise);
+    EXPECT(!coroutine.is_done());
+
+    loop.deferred_invoke([=] {
+        promise->resolve(42);
+    });
+    loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+
+    EXPECT(coroutine.is_done());
+    EXPECT_EQ(coroutine.take_result(), 42);
+}
+
+TEST_CASE(await_promise_rejection)
+{
+    Core::EventLoop loop;
+
+    auto promise = MUST(Core::Promise<int>::try_create());
+    promise->reject(Error::from_string_literal("lol no"));
+
+    auto coroutine = [](NonnullRefPtr<Core::Promise<int>> promise) -> Coroutine<ErrorOr<int>> {
+        co_return co_await promise;
+    }(promise);
+
+    EXPECT(coroutine.is_done());
+    auto result = coroutine.take_result();
+    EXPECT(result.is_error());
+    EXPECT_EQ(result.error().string_literal(), "lol no"sv);
+}
+
+TEST_CASE(await_readable_file_descriptor)
+{
+    Core::EventLoop loop;
+
+    auto pipe_fds = MUST(Core::System::pipe2(0));
+
+    auto coroutine = [](int fd) -> Coroutine<void> {
+        co_await Core::wait_for_readable(fd);
+    }(pipe_fds[0]);
+    EXPECT(!coroutine.is_done());
+
+    char byte = 0;
+    MUST(Core::System::write(pipe_fds[1], { &byte, 1 }));
+
+    while (!coroutine.is_done())
+        loop.pump();
+
+    MUST(Core::System::close(pipe_fds[0]));
+    MUST(Core::System::close(pipe_fds[1]));
+}
+
+TEST_CASE(yield_resumes_from_event_loop)
+{
+    Core::EventLoop loop;
+
+    auto coroutine = []() -> Coroutine<void> {
+        co_await Core::yield();
+    }();
+    EXPECT(!coroutine.is_done());
+
+    loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+    EXPECT(coroutine.is_done());
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/EventLoop.h>
+#include <LibCore/Notifier.h>
+#include <LibCore/System.h>
+#include <LibCore/Timer.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(notifiers_sharing_a_file_descriptor)
+{
+    Core::EventLoop event_loop;
+    auto reaper = Core::Timer::create_single_shot(1000, [] {
+        warnln("The notifiers were never activated!");
+        VERIFY_NOT_REACHED();
+    });
+    reaper->start();
+
+    auto pipe_fds = TRY_OR_FAIL(Core::System::pipe2(O_CLOEXEC));
+    auto first_notifier = Core::Notifier::construct(pipe_fds[0], Core::Notifier::Type::Read);
+    auto second_notifier = Core::Notifier::construct(pipe_fds[0], Core::Notifier::Type::Read);
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA size_t first_activation_count = 0;
+    IGNORE_USE_IN_ESCAPING_LAMBDA size_t second_activation_count = 0;
+
+    first_notifier->on_activation = [&] {
+        ++first_activation_count;
+        first_notifier->set_enabled(false);
+    };
+    second_notifier->on_activation = [&] {
+        ++second_activation_count;
+    };
+
+    // Both notifiers must be activated.
+    TRY_OR_FAIL(Core::System::write(pipe_fds[1], "x"sv.bytes()));
+    event_loop.spin_until([&] { return first_activation_count > 0 && second_activation_count > 0; });
+
+    char buffer;
+    TRY_OR_FAIL(Core::System::read(pipe_fds[0], { &buffer, 1 }));
+    event_loop.pump(Core::EventLoop::WaitMode::PollForEvents);
+
+    // Disabling one of them must not affect the other.
+    second_activation_count = 0;
+    TRY_OR_FAIL(Core::System::write(pipe_fds[1], "y"sv.bytes()));
+    event_loop.spin_until([&] { return second_activation_count > 0; });
+
+    EXPECT_EQ(first_activation_count, 1u);
+
+    reaper->stop();
+    second_notifier->set_enabled(false);
+    TRY_OR_FAIL(Core::System::close(pipe_fds[0]));
+    TRY_OR_FAIL(Core::System::close(pipe_fds[1]));
+}
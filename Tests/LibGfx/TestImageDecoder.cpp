@@ -340,6 +340,54 @@ TEST_CASE(test_jpeg_sof2_successive_aproximation)
     TRY_OR_FAIL(expect_single_frame_of_size(*plugin_decoder, { 600, 800 }));
 }
 
+TEST_CASE(test_jpeg_scaled_decoding)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/rgb24.jpg"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes()));
+
+    // The smallest DCT scale that is at least as large as the ideal size is used.
+    auto frame = TRY_OR_FAIL(plugin_decoder->frame(0, Gfx::IntSize { 16, 30 }));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(16, 32));
+    EXPECT_EQ(plugin_decoder->size(), Gfx::IntSize(64, 127));
+
+    frame = TRY_OR_FAIL(plugin_decoder->frame(0, Gfx::IntSize { 20, 40 }));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(32, 64));
+
+    frame = TRY_OR_FAIL(plugin_decoder->frame(0));
+    EXPECT_EQ(frame.image->size(), Gfx::IntSize(64, 127));
+}
+
+TEST_CASE(test_jpeg_partial_baseline)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/rgb24.jpg"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes().trim(file->size() / 2)));
+
+    // The rows that have not arrived yet are left transparent.
+    auto bitmap = TRY_OR_FAIL(plugin_decoder->partial_frame());
+    EXPECT_EQ(bitmap->get_pixel(0, 0).alpha(), 255);
+    EXPECT_EQ(bitmap->get_pixel(bitmap->width() - 1, bitmap->height() - 1).alpha(), 0);
+}
+
+TEST_CASE(test_jpeg_partial_progressive)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/successive_approximation.jpg"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes().trim(file->size() / 2)));
+
+    // Every completed scan covers the whole image, so there are no rows left out.
+    auto bitmap = TRY_OR_FAIL(plugin_decoder->partial_frame());
+    EXPECT_EQ(bitmap->size(), Gfx::IntSize(600, 800));
+    EXPECT_EQ(bitmap->get_pixel(0, 0).alpha(), 255);
+    EXPECT_EQ(bitmap->get_pixel(599, 799).alpha(), 255);
+}
+
+TEST_CASE(test_jpeg_partial_header_only)
+{
+    auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/rgb24.jpg"sv)));
+    auto plugin_decoder = TRY_OR_FAIL(Gfx::JPEGImageDecoderPlugin::create(file->bytes().trim(16)));
+
+    EXPECT(plugin_decoder->partial_frame().is_error());
+}
+
 TEST_CASE(test_jpeg_empty_icc)
 {
     auto file = TRY_OR_FAIL(Core::MappedFile::map(TEST_INPUT("jpg/gradient_empty_icc.jpg"sv)));
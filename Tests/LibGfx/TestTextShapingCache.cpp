@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibGfx/TextShapingCache.h>
+#include <LibTest/TestCase.h>
+
+static Gfx::TextShapingCache::ShapedText make_shaped_text(float width)
+{
+    Gfx::TextShapingCache::ShapedText shaped_text;
+    shaped_text.glyphs.append({ { width, 0 }, 1 });
+    shaped_text.width = width;
+    return shaped_text;
+}
+
+TEST_CASE(lookup_uses_text_letter_spacing_and_features)
+{
+    Gfx::TextShapingCache cache;
+    Gfx::ShapeFeatures features;
+    features.append({ { 'k', 'e', 'r', 'n' }, 0 });
+
+    cache.set(Utf8View("hello"sv), 0, {}, make_shaped_text(10));
+    cache.set(Utf8View("hello"sv), 1, {}, make_shaped_text(20));
+    cache.set(Utf8View("hello"sv), 0, features, make_shaped_text(30));
+
+    auto const* plain = cache.get(Utf8View("hello"sv), 0, {});
+    VERIFY(plain);
+    EXPECT_EQ(plain->width, 10);
+    EXPECT_EQ(plain->glyphs.size(), 1u);
+
+    auto const* spaced = cache.get(Utf8View("hello"sv), 1, {});
+    VERIFY(spaced);
+    EXPECT_EQ(spaced->width, 20);
+
+    auto const* without_kerning = cache.get(Utf8View("hello"sv), 0, features);
+    VERIFY(without_kerning);
+    EXPECT_EQ(without_kerning->width, 30);
+
+    EXPECT(!cache.get(Utf8View("world"sv), 0, {}));
+}
+
+TEST_CASE(least_recently_used_entry_is_evicted)
+{
+    Gfx::TextShapingCache cache;
+
+    for (size_t i = 0; i < Gfx::TextShapingCache::max_number_of_entries; ++i) {
+        auto text = ByteString::number(i);
+        cache.set(Utf8View(text), 0, {}, make_shaped_text(i));
+    }
+
+    // Touch the oldest entry, so that the second oldest one is evicted instead.
+    EXPECT(cache.get(Utf8View("0"sv), 0, {}));
+
+    cache.set(Utf8View("new"sv), 0, {}, make_shaped_text(0));
+
+    EXPECT(cache.get(Utf8View("0"sv), 0, {}));
+    EXPECT(!cache.get(Utf8View("1"sv), 0, {}));
+    EXPECT(cache.get(Utf8View("2"sv), 0, {}));
+    EXPECT(cache.get(Utf8View("new"sv), 0, {}));
+}
+
+TEST_CASE(long_text_is_not_cached)
+{
+    auto long_text = ByteString::repeated('a', Gfx::TextShapingCache::max_cached_text_length_in_bytes + 1);
+    EXPECT(!Gfx::TextShapingCache::can_cache(Utf8View(long_text)));
+    EXPECT(Gfx::TextShapingCache::can_cache(Utf8View("short"sv)));
+}
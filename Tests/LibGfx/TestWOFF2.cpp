@@ -41,3 +41,17 @@ TEST_CASE(malformed_woff2)
         EXPECT(font_or_error.is_error());
     }
 }
+
+TEST_CASE(reuse_decoded_font_for_same_data)
+{
+    auto file = MUST(Core::MappedFile::map(TEST_INPUT("woff2/incorrect_sfnt_size.woff2"sv)));
+    auto font = TRY_OR_FAIL(WOFF2::try_load_from_bytes(file->bytes()));
+
+    auto copy = MUST(ByteBuffer::copy(file->bytes()));
+    auto font_from_copy = TRY_OR_FAIL(WOFF2::try_load_from_bytes(copy));
+    EXPECT_EQ(font.ptr(), font_from_copy.ptr());
+
+    copy[copy.size() - 1] ^= 0xff;
+    if (auto other_font = WOFF2::try_load_from_bytes(copy); !other_font.is_error())
+        EXPECT_NE(font.ptr(), other_font.value().ptr());
+}
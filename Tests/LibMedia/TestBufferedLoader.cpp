@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibMedia/Audio/BufferedLoader.h>
+#include <LibTest/TestCase.h>
+#include <unistd.h>
+
+static Vector<Audio::Sample> read_all_samples(Audio::BufferedLoader& loader)
+{
+    Vector<Audio::Sample> samples;
+    Array<Audio::Sample, 512> buffer;
+    while (!loader.is_at_end_of_stream()) {
+        auto count = MUST(loader.read_samples(buffer));
+        if (count == 0) {
+            usleep(1000);
+            continue;
+        }
+        samples.append(buffer.data(), count);
+    }
+    return samples;
+}
+
+TEST_CASE(samples_match_the_decoder)
+{
+    auto loader = TRY_OR_FAIL(Audio::Loader::create("WAV/tone_44100_stereo.wav"sv));
+    Vector<Audio::Sample> expected_samples;
+    while (true) {
+        auto samples = TRY_OR_FAIL(loader->get_more_samples());
+        if (samples.is_empty())
+            break;
+        expected_samples.append(samples.data(), samples.size());
+    }
+    TRY_OR_FAIL(loader->reset());
+
+    auto buffered_loader = TRY_OR_FAIL(Audio::BufferedLoader::create(loader, AK::Duration::from_milliseconds(100)));
+    auto samples = read_all_samples(*buffered_loader);
+    EXPECT_EQ(samples.size(), expected_samples.size());
+    EXPECT_EQ(buffered_loader->position(), static_cast<int>(expected_samples.size()));
+    for (size_t i = 0; i < min(samples.size(), expected_samples.size()); ++i) {
+        EXPECT_EQ(samples[i].left, expected_samples[i].left);
+        EXPECT_EQ(samples[i].right, expected_samples[i].right);
+    }
+}
+
+TEST_CASE(seeking_drops_samples_decoded_ahead)
+{
+    auto loader = TRY_OR_FAIL(Audio::Loader::create("WAV/tone_44100_mono.wav"sv));
+    auto total_samples = loader->total_samples();
+    auto buffered_loader = TRY_OR_FAIL(Audio::BufferedLoader::create(loader, AK::Duration::from_milliseconds(100)));
+
+    Array<Audio::Sample, 512> buffer;
+    while (TRY_OR_FAIL(buffered_loader->read_samples(buffer)) == 0)
+        usleep(1000);
+
+    TRY_OR_FAIL(buffered_loader->seek(total_samples / 2));
+    EXPECT_EQ(buffered_loader->position(), total_samples / 2);
+
+    // The container may only be able to seek to the start of a packet, so allow for a little slack.
+    auto samples = read_all_samples(*buffered_loader);
+    auto expected_sample_count = total_samples - total_samples / 2;
+    EXPECT(abs(static_cast<int>(samples.size()) - expected_sample_count) < static_cast<int>(buffered_loader->sample_rate() / 10));
+}
@@ -23,3 +23,43 @@ TEST_CASE(master_elements_containing_crc32)
     MUST(matroska_reader.seek_to_random_access_point(iterator, AK::Duration::from_seconds(7)));
     MUST(iterator.next_block());
 }
+
+TEST_CASE(incremental_parsing)
+{
+    auto matroska_reader = MUST(Media::Matroska::Reader::from_file("vp9_in_webm.webm"sv));
+    Vector<AK::Duration> expected_timestamps;
+    auto iterator = MUST(matroska_reader.create_sample_iterator(1));
+    while (true) {
+        auto block = iterator.next_block();
+        if (block.is_error()) {
+            EXPECT(block.error().category() == Media::DecoderErrorCategory::EndOfStream);
+            break;
+        }
+        expected_timestamps.append(block.value().timestamp());
+    }
+
+    Media::Matroska::IncrementalReader incremental_reader;
+    bool received_initialization_segment = false;
+    Vector<AK::Duration> timestamps;
+    incremental_reader.on_initialization_segment = [&](auto const&, auto const& tracks) -> Media::DecoderErrorOr<void> {
+        EXPECT(tracks.contains(1));
+        received_initialization_segment = true;
+        return {};
+    };
+    incremental_reader.on_block = [&](auto const& track, auto const& block) -> Media::DecoderErrorOr<void> {
+        if (track.track_number() == 1)
+            timestamps.append(block.timestamp());
+        return {};
+    };
+
+    // Feed the file in chunks that split elements at arbitrary points.
+    auto file = MUST(Core::MappedFile::map("vp9_in_webm.webm"sv));
+    auto data = file->bytes();
+    for (size_t offset = 0; offset < data.size(); offset += 997)
+        MUST(incremental_reader.append(data.slice(offset, min<size_t>(997, data.size() - offset))));
+
+    EXPECT(received_initialization_segment);
+    EXPECT_EQ(incremental_reader.pending_data_size(), 0u);
+    EXPECT_EQ(timestamps.size(), expected_timestamps.size());
+    EXPECT(timestamps == expected_timestamps);
+}
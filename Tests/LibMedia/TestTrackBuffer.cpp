@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <LibMedia/TrackBuffer.h>
+
+static AK::Duration milliseconds(i64 value)
+{
+    return AK::Duration::from_milliseconds(value);
+}
+
+// Appends 100 frames of 100 bytes, 10ms apart, with a keyframe every 10 frames. Each byte of a frame holds its index.
+static Media::TrackBuffer create_track_buffer(size_t capacity)
+{
+    Media::TrackBuffer track_buffer { capacity };
+    for (u8 i = 0; i < 100; i++) {
+        Array<u8, 100> data;
+        data.fill(i);
+        MUST(track_buffer.append(milliseconds(i * 10), i % 10 == 0, data.span()));
+    }
+    return track_buffer;
+}
+
+TEST_CASE(buffered_ranges)
+{
+    auto track_buffer = create_track_buffer(64 * KiB);
+    EXPECT_EQ(track_buffer.size_in_bytes(), 10000u);
+    EXPECT(!track_buffer.is_full());
+
+    auto ranges = track_buffer.buffered_ranges();
+    EXPECT_EQ(ranges.size(), 1u);
+    EXPECT_EQ(ranges[0].start, milliseconds(0));
+    EXPECT_EQ(ranges[0].end, milliseconds(1000));
+}
+
+TEST_CASE(evict_keeps_the_frames_needed_to_decode_the_playhead)
+{
+    auto track_buffer = create_track_buffer(10000);
+    EXPECT(track_buffer.is_full());
+
+    EXPECT_EQ(track_buffer.evict_before(milliseconds(555)), 5000u);
+    EXPECT(!track_buffer.is_full());
+    EXPECT_EQ(track_buffer.frame(0).timestamp, milliseconds(500));
+    EXPECT_EQ(track_buffer.data(track_buffer.frame(0))[0], 50);
+
+    // Evicting past half of the stored data compacts it, which must leave the remaining frames intact.
+    EXPECT_EQ(track_buffer.evict_before(milliseconds(720)), 2000u);
+    EXPECT_EQ(track_buffer.frame_count(), 30u);
+    EXPECT_EQ(track_buffer.data(track_buffer.frame(0))[0], 70);
+    EXPECT_EQ(track_buffer.data(track_buffer.frame(29))[99], 99);
+
+    auto ranges = track_buffer.buffered_ranges();
+    EXPECT_EQ(ranges.size(), 1u);
+    EXPECT_EQ(ranges[0].start, milliseconds(700));
+}
+
+TEST_CASE(remove_takes_dependent_frames_along)
+{
+    auto track_buffer = create_track_buffer(64 * KiB);
+    track_buffer.remove(milliseconds(200), milliseconds(250));
+
+    // The frames up until the next keyframe at 300ms can't be decoded anymore, so they are removed as well.
+    EXPECT_EQ(track_buffer.frame_count(), 90u);
+    EXPECT_EQ(track_buffer.size_in_bytes(), 9000u);
+
+    auto ranges = track_buffer.buffered_ranges();
+    EXPECT_EQ(ranges.size(), 2u);
+    EXPECT_EQ(ranges[0].end, milliseconds(200));
+    EXPECT_EQ(ranges[1].start, milliseconds(300));
+    EXPECT_EQ(track_buffer.data(track_buffer.frame(20))[0], 30);
+}
@@ -1059,6 +1059,23 @@ BENCHMARK_CASE(anchor_performance)
     }
 }
 
+BENCHMARK_CASE(literal_search_performance)
+{
+    auto haystack = MUST(String::formatted("{}needle{}needle", g_lots_of_a_s, g_lots_of_a_s));
+    Regex<ECMA262> re("needle", ECMAScriptFlags::Global);
+    RegexResult result;
+    EXPECT_EQ(re.search(haystack.bytes_as_string_view(), result), true);
+    EXPECT_EQ(result.count, 2u);
+}
+
+BENCHMARK_CASE(compile_performance)
+{
+    for (auto i = 0; i < 100'000; i++) {
+        Regex<ECMA262> re("^([a-z0-9_\\.-]+)@([\\da-z\\.-]+)\\.([a-z\\.]{2,6})$");
+        EXPECT_EQ(re.parser_result.error, regex::Error::NoError);
+    }
+}
+
 TEST_CASE(optimizer_atomic_groups)
 {
     Array tests {
@@ -1296,3 +1313,22 @@ TEST_CASE(optimizer_repeat_offset)
         Regex<ECMA262> re("\\/?\\??#?([\\/?#]|[\\uD800-\\uDBFF]|%[c-f][0-9a-f](%[89ab][0-9a-f]){0,2}(%[89ab]?)?|%[0-9a-f]?)$"sv);
     }
 }
+
+TEST_CASE(global_literal_search)
+{
+    Regex<ECMA262> re("foo"sv, ECMAScriptFlags::Global);
+    RegexResult result;
+
+    ByteString haystack = "xxfooxxxfofoo foo";
+    EXPECT_EQ(re.search(haystack.view(), result), true);
+    EXPECT_EQ(result.count, 3u);
+    if (result.count == 3u) {
+        EXPECT_EQ(result.matches.at(0).global_offset, 2u);
+        EXPECT_EQ(result.matches.at(1).global_offset, 10u);
+        EXPECT_EQ(result.matches.at(2).global_offset, 14u);
+    }
+
+    Regex<ECMA262> insensitive_re("foo"sv, ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive);
+    EXPECT_EQ(insensitive_re.search("xFoOxfOO"sv, result), true);
+    EXPECT_EQ(result.count, 2u);
+}
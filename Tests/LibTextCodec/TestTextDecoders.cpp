@@ -48,3 +48,32 @@ TEST_CASE(test_utf16le_decode)
     auto utf8 = MUST(decoder.to_utf8(test_string));
     EXPECT_EQ(utf8, "säk😀"sv);
 }
+
+TEST_CASE(test_utf16_decode_with_unpaired_surrogates)
+{
+    // "a", a lone high surrogate, "b", a lone low surrogate, U+1F600, and a trailing odd byte.
+    auto le_decoder = TextCodec::UTF16LEDecoder();
+    auto le_string = "a\x00=\xd8"
+                     "b\x00\x00\xde=\xd8\x00\xde\x41"sv;
+    EXPECT(!le_decoder.validate(le_string));
+    EXPECT_EQ(MUST(le_decoder.to_utf8(le_string)), "a�b�😀�"sv);
+    EXPECT_EQ(MUST(le_decoder.to_utf8("a\x00=\xd8"sv)), "a�"sv);
+
+    auto be_decoder = TextCodec::UTF16BEDecoder();
+    auto be_string = "\x00"
+                     "a\xd8=\x00"
+                     "b\xde\x00\xd8=\xde\x00\x41"sv;
+    EXPECT(!be_decoder.validate(be_string));
+    EXPECT_EQ(MUST(be_decoder.to_utf8(be_string)), "a�b�😀�"sv);
+    EXPECT_EQ(MUST(be_decoder.to_utf8("\x00"
+                                      "a\xd8="sv)),
+        "a�"sv);
+}
+
+TEST_CASE(test_latin1_decode)
+{
+    auto decoder = TextCodec::Latin1Decoder();
+
+    EXPECT_EQ(MUST(decoder.to_utf8("plain ASCII"sv)), "plain ASCII"sv);
+    EXPECT_EQ(MUST(decoder.to_utf8("s\xe4k \xff"sv)), "säk ÿ"sv);
+}
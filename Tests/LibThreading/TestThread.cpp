@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/FlyString.h>
+#include <AK/String.h>
 #include <AK/Time.h>
 #include <LibTest/TestCase.h>
 #include <LibThreading/Thread.h>
@@ -71,3 +73,29 @@ TEST_CASE(join_dead_thread)
     auto join_result = TRY_OR_FAIL(thread->join<int*>());
     EXPECT_EQ(join_result, static_cast<int*>(0));
 }
+
+static intptr_t intern_fly_strings()
+{
+    for (auto round = 0; round < 1000; ++round) {
+        auto name = MUST(String::formatted("a-name-that-is-not-a-short-string-{}", round % 64));
+        FlyString from_string { name };
+        auto from_view = MUST(FlyString::from_utf8(name.bytes_as_string_view()));
+        if (from_string != from_view || from_view != name)
+            return 1;
+    }
+    return 0;
+}
+
+TEST_CASE(fly_strings_can_be_interned_from_multiple_threads)
+{
+    Vector<NonnullRefPtr<Threading::Thread>> threads;
+    for (auto i = 0; i < 4; ++i) {
+        threads.append(Threading::Thread::construct([] { return intern_fly_strings(); }));
+        threads.last()->start();
+    }
+
+    for (auto& thread : threads)
+        EXPECT(thread->join<void*>().value() == nullptr);
+
+    EXPECT_EQ(FlyString::number_of_fly_strings(), 0u);
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/FixedArray.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/ThreadPool.h>
+
+TEST_CASE(task_group_runs_every_task)
+{
+    Threading::ThreadPool pool { 4 };
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<int> counter = 0;
+
+    {
+        Threading::TaskGroup group { pool };
+        for (int i = 0; i < 1000; ++i)
+            group.spawn([&counter] { counter.fetch_add(1); });
+        group.wait();
+    }
+
+    EXPECT_EQ(counter.load(), 1000);
+}
+
+TEST_CASE(task_groups_can_be_nested)
+{
+    Threading::ThreadPool pool { 2 };
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<int> counter = 0;
+
+    Threading::TaskGroup outer { pool };
+    for (int i = 0; i < 16; ++i) {
+        outer.spawn([&pool, &counter] {
+            Threading::TaskGroup inner { pool };
+            for (int j = 0; j < 16; ++j)
+                inner.spawn([&counter] { counter.fetch_add(1); });
+        });
+    }
+    outer.wait();
+
+    EXPECT_EQ(counter.load(), 16 * 16);
+}
+
+TEST_CASE(parallel_for_visits_every_index_once)
+{
+    Threading::ThreadPool pool { 4 };
+
+    auto visits = MUST(FixedArray<Atomic<int>>::create(10'000));
+
+    Threading::parallel_for(0, visits.size(), [&](size_t i) { visits[i].fetch_add(1); }, 16, pool);
+
+    for (auto const& visit_count : visits)
+        EXPECT_EQ(visit_count.load(), 1);
+}
@@ -604,3 +604,39 @@ TEST_CASE(get_registrable_domain)
         EXPECT_EQ(*domain, "ladybird.github.io"sv);
     }
 }
+
+TEST_CASE(canonical_urls)
+{
+    {
+        auto url = URL::Parser::basic_parse("https://www.ladybird.org:8443/a/b/?x=1&y='2'#top"sv);
+        VERIFY(url.has_value());
+        EXPECT_EQ(url->scheme(), "https");
+        EXPECT_EQ(url->serialized_host(), "www.ladybird.org");
+        EXPECT_EQ(url->port(), 8443);
+        EXPECT_EQ(url->paths(), (Vector<String> { "a"_string, "b"_string, ""_string }));
+        EXPECT_EQ(url->query(), "x=1&y=%272%27"sv);
+        EXPECT_EQ(url->fragment(), "top"sv);
+    }
+    {
+        auto url = URL::Parser::basic_parse("http://ladybird.org:80?q"sv);
+        VERIFY(url.has_value());
+        EXPECT(!url->port().has_value());
+        EXPECT_EQ(url->serialize(), "http://ladybird.org/?q"sv);
+    }
+
+    // These look almost canonical, but have parts that the parser has to change.
+    EXPECT_EQ(URL::Parser::basic_parse("http://LADYBIRD.org/a/../b"sv)->serialize(), "http://ladybird.org/b"sv);
+    EXPECT_EQ(URL::Parser::basic_parse("http://ladybird.org/a%2e/./b c"sv)->serialize(), "http://ladybird.org/a%2e/b%20c"sv);
+    EXPECT_EQ(URL::Parser::basic_parse("http://0x7f.1/"sv)->serialize(), "http://127.0.0.1/"sv);
+    EXPECT(!URL::Parser::basic_parse("http://ladybird.org:65536/"sv).has_value());
+}
+
+TEST_CASE(repeated_parses_with_a_modified_base_url)
+{
+    auto base_url = URL::Parser::basic_parse("https://ladybird.org/dir/page.html"sv).value();
+    EXPECT_EQ(URL::Parser::basic_parse("../other.html"sv, base_url)->serialize(), "https://ladybird.org/other.html"sv);
+    EXPECT_EQ(URL::Parser::basic_parse("../other.html"sv, base_url)->serialize(), "https://ladybird.org/other.html"sv);
+
+    base_url.set_host(URL::Host { "example.com"_string });
+    EXPECT_EQ(URL::Parser::basic_parse("../other.html"sv, base_url)->serialize(), "https://example.com/other.html"sv);
+}
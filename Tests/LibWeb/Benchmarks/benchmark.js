@@ -0,0 +1,74 @@
+// Shared drivers for the benchmark pages in this directory.
+//
+// Layout benchmarks provide a mutate(iteration) callback that dirties style and layout. The driver calls it once per
+// animation frame, collects the statistics of the rendering update that followed, and reports the per-frame timings
+// back to the runner (Meta/run-layout-benchmarks.py) as JSON through internals.signalTestIsDone().
+//
+// Script benchmarks provide a set of named cases that are timed directly with performance.now(), and report their
+// samples the same way, keyed by case name.
+
+const __benchmarkWarmupFrames = 3;
+const __benchmarkMeasuredFrames = 30;
+
+function runLayoutBenchmark(name, mutate) {
+    if (globalThis.internals === undefined) {
+        console.log(`${name}: internals are not available; load this page with headless-browser`);
+        return;
+    }
+
+    const samples = {
+        style: [],
+        layout: [],
+        paint: [],
+    };
+
+    let frame = 0;
+    const totalFrames = __benchmarkWarmupFrames + __benchmarkMeasuredFrames;
+
+    const step = () => {
+        // The last frame's statistics describe the rendering update that ran after the previous mutation.
+        if (frame > __benchmarkWarmupFrames) {
+            const statistics = internals.getLastFrameStatistics();
+            samples.style.push(statistics.timeSpentUpdatingStyle);
+            samples.layout.push(statistics.timeSpentUpdatingLayout);
+            samples.paint.push(statistics.timeSpentRecordingDisplayList);
+        }
+
+        if (frame === totalFrames + 1) {
+            internals.signalTestIsDone(JSON.stringify({ name, samples }));
+            return;
+        }
+
+        mutate(frame++);
+        requestAnimationFrame(step);
+    };
+
+    document.addEventListener("DOMContentLoaded", () => {
+        requestAnimationFrame(step);
+    });
+}
+
+const __benchmarkScriptIterations = 20;
+
+function runScriptBenchmark(name, cases) {
+    if (globalThis.internals === undefined) {
+        console.log(`${name}: internals are not available; load this page with headless-browser`);
+        return;
+    }
+
+    document.addEventListener("DOMContentLoaded", () => {
+        const samples = {};
+        for (const [caseName, run] of Object.entries(cases)) {
+            samples[caseName] = [];
+            for (let iteration = 0; iteration < __benchmarkWarmupFrames + __benchmarkScriptIterations; ++iteration) {
+                const start = performance.now();
+                run(iteration);
+                const elapsed = performance.now() - start;
+                if (iteration >= __benchmarkWarmupFrames) {
+                    samples[caseName].push(elapsed);
+                }
+            }
+        }
+        internals.signalTestIsDone(JSON.stringify({ name, samples }));
+    });
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/CSS/Parser/Tokenizer.h>
+
+namespace Web::CSS::Parser {
+
+TEST_CASE(ident_sequences)
+{
+    auto tokens = Tokenizer::tokenize("foo-bar _baz qu\\78 x caf\xC3\xA9 a\\"sv, "utf-8"sv);
+    Vector<Token> idents;
+    for (auto const& token : tokens) {
+        if (token.is(Token::Type::Ident))
+            idents.append(token);
+    }
+    EXPECT_EQ(idents.size(), 5u);
+    EXPECT_EQ(idents[0].ident(), "foo-bar"sv);
+    EXPECT_EQ(idents[1].ident(), "_baz"sv);
+    EXPECT_EQ(idents[2].ident(), "quxx"sv);
+    EXPECT_EQ(idents[3].ident(), "caf\xC3\xA9"sv);
+    EXPECT_EQ(idents[4].ident(), "a\xEF\xBF\xBD"sv);
+}
+
+TEST_CASE(strings)
+{
+    auto tokens = Tokenizer::tokenize("\"hello world\" 'it\\'s' \"caf\xC3\xA9\\\nau lait\" \"unterminated\n"sv, "utf-8"sv);
+    EXPECT_EQ(tokens[0].type(), Token::Type::String);
+    EXPECT_EQ(tokens[0].string(), "hello world"sv);
+    EXPECT_EQ(tokens[2].type(), Token::Type::String);
+    EXPECT_EQ(tokens[2].string(), "it's"sv);
+    EXPECT_EQ(tokens[4].type(), Token::Type::String);
+    EXPECT_EQ(tokens[4].string(), "caf\xC3\xA9" "au lait"sv);
+    EXPECT_EQ(tokens[6].type(), Token::Type::BadString);
+}
+
+TEST_CASE(comments_and_positions)
+{
+    auto tokens = Tokenizer::tokenize("/* caf\xC3\xA9\n * */  \n\tfoo /* unterminated"sv, "utf-8"sv);
+    EXPECT_EQ(tokens[0].type(), Token::Type::Whitespace);
+    EXPECT_EQ(tokens[1].type(), Token::Type::Whitespace);
+    EXPECT_EQ(tokens[2].type(), Token::Type::Ident);
+    EXPECT_EQ(tokens[2].ident(), "foo"sv);
+    EXPECT_EQ(tokens[2].start_position().line, 2u);
+    EXPECT_EQ(tokens[2].start_position().column, 1u);
+    EXPECT_EQ(tokens[2].end_position().column, 4u);
+    EXPECT_EQ(tokens[3].type(), Token::Type::Whitespace);
+    EXPECT_EQ(tokens[4].type(), Token::Type::Whitespace);
+    EXPECT_EQ(tokens[5].type(), Token::Type::EndOfFile);
+}
+
+BENCHMARK_CASE(tokenize_large_style_sheet)
+{
+    StringBuilder builder;
+    for (size_t i = 0; i < 20'000; ++i) {
+        builder.appendff("/* Rule number {} */\n", i);
+        builder.appendff(".component-{} > .item:hover, #container-{} .title {{\n", i, i);
+        builder.append("    font-family: \"Helvetica Neue\", Arial, sans-serif;\n"sv);
+        builder.append("    background: url(\"images/background.png\") no-repeat center / cover;\n"sv);
+        builder.append("    margin: 0 auto 1.5rem;\n    transition: opacity 150ms ease-in-out;\n}\n"sv);
+    }
+    auto source = builder.to_byte_string();
+
+    for (size_t i = 0; i < 10; ++i) {
+        auto tokens = Tokenizer::tokenize(source, "utf-8"sv);
+        EXPECT(tokens.size() > 1'000'000);
+    }
+}
+
+}
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+#include <LibWeb/Painting/DisplayList.h>
+
+using namespace Web::Painting;
+
+TEST_CASE(save_restore_without_painting_is_dropped)
+{
+    auto display_list = DisplayList::create();
+    display_list->append(FillRect { { 0, 0, 10, 10 }, Color::Red }, {});
+    display_list->append(Save {}, {});
+    display_list->append(Save {}, {});
+    display_list->append(AddClipRect { { 0, 0, 5, 5 } }, {});
+    display_list->append(Translate { { 1, 1 } }, {});
+    display_list->append(Restore {}, {});
+    display_list->append(Restore {}, {});
+    EXPECT_EQ(display_list->commands().size(), 1u);
+    EXPECT(display_list->commands()[0].command.has<FillRect>());
+}
+
+TEST_CASE(save_restore_around_painting_is_kept)
+{
+    auto display_list = DisplayList::create();
+    display_list->append(Save {}, {});
+    display_list->append(AddClipRect { { 0, 0, 5, 5 } }, {});
+    display_list->append(FillRect { { 0, 0, 10, 10 }, Color::Red }, {});
+    display_list->append(Restore {}, {});
+    EXPECT_EQ(display_list->commands().size(), 4u);
+}
+
+TEST_CASE(consecutive_clip_rects_are_intersected)
+{
+    auto display_list = DisplayList::create();
+    display_list->append(AddClipRect { { 0, 0, 10, 10 } }, {});
+    display_list->append(AddClipRect { { 5, 5, 10, 10 } }, {});
+    display_list->append(AddClipRect { { 0, 0, 10, 10 } }, 1);
+    EXPECT_EQ(display_list->commands().size(), 2u);
+    EXPECT_EQ(display_list->commands()[0].command.get<AddClipRect>().rect, Gfx::IntRect(5, 5, 5, 5));
+}
+
+TEST_CASE(adjacent_fill_rects_of_same_color_are_merged)
+{
+    auto display_list = DisplayList::create();
+    display_list->append(FillRect { { 0, 0, 10, 10 }, Color::Red }, {});
+    display_list->append(FillRect { { 10, 0, 10, 10 }, Color::Red }, {});
+    display_list->append(FillRect { { 0, 10, 20, 5 }, Color::Red }, {});
+    EXPECT_EQ(display_list->commands().size(), 1u);
+    EXPECT_EQ(display_list->commands()[0].command.get<FillRect>().rect, Gfx::IntRect(0, 0, 20, 15));
+
+    // Overlapping rects, different colors and different scroll frames must be left alone.
+    display_list->append(FillRect { { 5, 5, 20, 15 }, Color::Red }, {});
+    display_list->append(FillRect { { 25, 5, 10, 15 }, Color::Blue }, {});
+    display_list->append(FillRect { { 35, 5, 10, 15 }, Color::Blue }, 1);
+    EXPECT_EQ(display_list->commands().size(), 4u);
+}
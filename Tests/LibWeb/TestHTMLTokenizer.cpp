@@ -6,6 +6,7 @@
 
 #include <LibTest/TestCase.h>
 
+#include <AK/Time.h>
 #include <LibCore/File.h>
 #include <LibWeb/HTML/Parser/HTMLTokenizer.h>
 
@@ -218,6 +219,19 @@ TEST_CASE(hex_character_reference)
     END_ENUMERATION();
 }
 
+TEST_CASE(non_latin1_text)
+{
+    auto tokens = run_tokenizer("<p>é日é</p>"sv);
+    BEGIN_ENUMERATION(tokens);
+    EXPECT_START_TAG_TOKEN(p, 1u, 2u);
+    EXPECT_CHARACTER_TOKEN(0xE9);
+    EXPECT_CHARACTER_TOKEN(0x65E5);
+    EXPECT_CHARACTER_TOKEN(0xE9);
+    EXPECT_END_TAG_TOKEN(p, 8u, 9u);
+    EXPECT_END_OF_FILE_TOKEN();
+    END_ENUMERATION();
+}
+
 TEST_CASE(comment)
 {
     auto tokens = run_tokenizer("<p><!-- This is a comment --></p>"sv);
@@ -253,3 +267,40 @@ TEST_CASE(regression)
     u32 hash = hash_tokens(tokens);
     EXPECT_EQ(hash, 3657343287u);
 }
+
+// A synthetic document that mixes the constructs real-world pages are made of: nested markup with attributes,
+// character references, comments, inline scripts and styles, and non-ASCII text.
+static ByteString make_tokenizer_benchmark_corpus(size_t sections)
+{
+    StringBuilder builder;
+    builder.append("<!DOCTYPE html><html lang=\"en\"><head><meta charset=\"utf-8\"><title>Benchmark</title>"sv);
+    builder.append("<style>body { margin: 0 } .nav > li a:hover { color: #336 }</style></head><body>"sv);
+    for (size_t i = 0; i < sections; ++i) {
+        builder.appendff("<section id=\"section-{}\" class=\"mw-body-content article\" data-index='{}'>", i, i);
+        builder.append("<h2><span class=mw-headline>Caf&eacute; &amp; na&#239;vet&#xE9;</span></h2>"sv);
+        builder.append("<!-- Generated content follows --><p>Lorem ipsum dolor sit amet, <a href=\"/wiki/Consectetur?a=1&b=2\" title=\"Consectetur\">consectetur</a> "sv);
+        builder.append("adipiscing elit, sed do <b>eiusmod</b> tempor <i>incididunt</i> ut labore et dolore magna aliqua.<br>"sv);
+        builder.append("Straße, 日本語, Ελληνικά &mdash; &#8212; &nbsp;</p>"sv);
+        builder.append("<ul class=\"nav\"><li><a href=#one>One</a><li><a href=#two>Two</a><li><a href=#three disabled>Three</a></ul>"sv);
+        builder.append("<script>if (a < b && c > d) { document.title = \"</p>\"; }</script>"sv);
+        builder.append("<table><tr><td>1<td>2<td>3</tr></table><img src=\"image.png\" alt=\"\" width=100 height=100></section>\n"sv);
+    }
+    builder.append("</body></html>"sv);
+    return builder.to_byte_string();
+}
+
+BENCHMARK_CASE(tokenizer_throughput)
+{
+    auto corpus = make_tokenizer_benchmark_corpus(10'000);
+
+    auto start = MonotonicTime::now();
+    size_t token_count = 0;
+    Tokenizer tokenizer { corpus, "UTF-8"sv };
+    while (tokenizer.next_token().has_value())
+        ++token_count;
+    auto elapsed = MonotonicTime::now() - start;
+
+    auto megabytes = static_cast<double>(corpus.length()) / MiB;
+    auto seconds = max(elapsed.to_microseconds(), 1) / 1'000'000.0;
+    outln("Tokenized {:.2} MiB into {} tokens in {} ms ({:.2} MiB/s)", megabytes, token_count, elapsed.to_milliseconds(), megabytes / seconds);
+}
@@ -47,3 +47,40 @@ TEST_CASE(unicode_name)
     XML::Parser parser("<div 中文=\"\"></div>"sv);
     TRY_OR_FAIL(parser.parse());
 }
+
+TEST_CASE(listener_events)
+{
+    struct RecordingListener final : public XML::Listener {
+        virtual void element_start(XML::Name const& name, HashMap<XML::Name, ByteString> const& attributes) override
+        {
+            events.append(ByteString::formatted("<{} {}>", name, attributes.get("id"sv).value_or({})));
+        }
+        virtual void element_end(XML::Name const& name) override { events.append(ByteString::formatted("</{}>", name)); }
+        virtual void text(StringView text) override { events.append(text); }
+
+        Vector<ByteString> events;
+    };
+
+    XML::Parser parser("<svg id=\"a\">This text is long enough to be scanned in chunks<g/>&amp;<path id=\"b\">]]</path></svg>"sv);
+    RecordingListener listener;
+    TRY_OR_FAIL(parser.parse_with_listener(listener));
+
+    Vector<ByteString> expected_events {
+        "<svg a>",
+        "This text is long enough to be scanned in chunks",
+        "<g >",
+        "</g>",
+        "&",
+        "<path b>",
+        "]]",
+        "</path>",
+        "</svg>",
+    };
+    EXPECT_EQ(listener.events, expected_events);
+}
+
+TEST_CASE(char_data_cannot_contain_cdata_end)
+{
+    XML::Parser parser("<a>some text that goes on ]]> and on</a>"sv);
+    EXPECT(parser.parse().is_error());
+}
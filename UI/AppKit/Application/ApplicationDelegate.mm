@@ -640,6 +640,9 @@
     [submenu addItem:[[NSMenuItem alloc] initWithTitle:@"Dump Stacking Context Tree"
                                                 action:@selector(dumpStackingContextTree:)
                                          keyEquivalent:@""]];
+    [submenu addItem:[[NSMenuItem alloc] initWithTitle:@"Dump Frame Timings"
+                                                action:@selector(dumpFrameTimings:)
+                                         keyEquivalent:@""]];
     [submenu addItem:[[NSMenuItem alloc] initWithTitle:@"Dump Style Sheets"
                                                 action:@selector(dumpStyleSheets:)
                                          keyEquivalent:@""]];
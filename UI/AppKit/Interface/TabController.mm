@@ -359,6 +359,11 @@ static NSString* const TOOLBAR_TAB_OVERVIEW_IDENTIFIER = @"ToolbarTabOverviewIde
     [self debugRequest:"dump-stacking-context-tree" argument:""];
 }
 
+- (void)dumpFrameTimings:(id)sender
+{
+    [self debugRequest:"dump-frame-timings" argument:""];
+}
+
 - (void)dumpStyleSheets:(id)sender
 {
     [self debugRequest:"dump-style-sheets" argument:""];
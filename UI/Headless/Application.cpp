@@ -34,7 +34,7 @@ void Application::create_platform_arguments(Core::ArgsParser& args_parser)
     args_parser.add_option(screenshot_timeout, "Take a screenshot after [n] seconds (default: 1)", "screenshot", 's', "n");
     args_parser.add_option(dump_layout_tree, "Dump layout tree and exit", "dump-layout-tree", 'd');
     args_parser.add_option(dump_text, "Dump text and exit", "dump-text", 'T');
-    args_parser.add_option(test_concurrency, "Maximum number of tests to run at once", "test-concurrency", 'j', "jobs");
+    args_parser.add_option(test_concurrency, "Maximum number of tests or captures to run at once", "test-concurrency", 'j', "jobs");
     args_parser.add_option(python_executable_path, "Path to python3", "python-executable", 'P', "path");
     args_parser.add_option(test_root_path, "Run tests in path", "run-tests", 'R', "test-root-path");
     args_parser.add_option(test_globs, "Only run tests matching the given glob", "filter", 'f', "glob");
@@ -47,6 +47,9 @@ void Application::create_platform_arguments(Core::ArgsParser& args_parser)
     args_parser.add_option(per_test_timeout_in_seconds, "Per-test timeout (default: 30)", "per-test-timeout", 't', "seconds");
     args_parser.add_option(width, "Set viewport width in pixels (default: 800)", "width", 'W', "pixels");
     args_parser.add_option(height, "Set viewport height in pixels (default: 600)", "height", 'H', "pixels");
+    args_parser.add_option(capture_output_directory, "Save a screenshot of each URL into a directory once it has loaded", "capture-output", 0, "path");
+    args_parser.add_option(capture_url_list_path, "Capture the URLs listed in a file, one per line", "capture-url-list", 0, "path");
+    args_parser.add_option(capture_metrics_log_path, "Write per-page capture timings to a JSON lines file", "capture-metrics-log", 0, "path");
 
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Optional,
@@ -82,6 +85,16 @@ void Application::create_platform_options(WebView::BrowserOptions& browser_optio
         web_content_options.paint_viewport_scrollbars = WebView::PaintViewportScrollbars::No;
     }
 
+    if (!capture_url_list_path.is_empty() && capture_output_directory.is_empty()) {
+        // --capture-url-list implies capturing into the current directory.
+        capture_output_directory = ".";
+    }
+
+    if (!capture_output_directory.is_empty()) {
+        // Nobody looks at the frames of pages being captured, so we only render them when taking the screenshot.
+        web_content_options.render_on_demand = WebView::RenderOnDemand::Yes;
+    }
+
     if (dump_gc_graph) {
         // Force all tests to run in serial if we are interested in the GC graph.
         test_concurrency = 1;
@@ -65,6 +65,9 @@ public:
     int per_test_timeout_in_seconds { 30 };
     int width { 800 };
     int height { 600 };
+    ByteString capture_output_directory;
+    ByteString capture_url_list_path;
+    ByteString capture_metrics_log_path;
 
 private:
     Vector<NonnullOwnPtr<HeadlessWebView>> m_web_views;
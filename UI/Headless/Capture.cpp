@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ByteString.h>
+#include <AK/JsonObject.h>
+#include <AK/LexicalPath.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibCore/Directory.h>
+#include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
+#include <LibCore/Promise.h>
+#include <LibCore/Timer.h>
+#include <LibGfx/Bitmap.h>
+#include <LibGfx/ImageFormats/PNGWriter.h>
+#include <LibURL/URL.h>
+#include <LibWebView/URL.h>
+#include <UI/Headless/Application.h>
+#include <UI/Headless/Capture.h>
+#include <UI/Headless/HeadlessWebView.h>
+
+namespace Ladybird {
+
+enum class CaptureResult {
+    Captured,
+    Failed,
+    Timeout,
+    Crashed,
+};
+
+static StringView capture_result_to_string(CaptureResult result)
+{
+    switch (result) {
+    case CaptureResult::Captured:
+        return "Captured"sv;
+    case CaptureResult::Failed:
+        return "Failed"sv;
+    case CaptureResult::Timeout:
+        return "Timeout"sv;
+    case CaptureResult::Crashed:
+        return "Crashed"sv;
+    }
+    VERIFY_NOT_REACHED();
+}
+
+using CapturePromise = Core::Promise<CaptureResult>;
+
+struct Capture {
+    size_t index { 0 };
+    URL::URL url;
+    ByteString output_path;
+
+    MonotonicTime start_time { MonotonicTime::now() };
+    Optional<MonotonicTime> load_start_time;
+    Optional<MonotonicTime> load_end_time;
+    Optional<MonotonicTime> screenshot_time;
+    MonotonicTime end_time { MonotonicTime::now() };
+
+    CaptureResult result { CaptureResult::Failed };
+    RefPtr<Core::Timer> timeout_timer;
+};
+
+static ErrorOr<Vector<URL::URL>> collect_capture_urls(Application const& app)
+{
+    if (app.capture_url_list_path.is_empty())
+        return WebView::Application::browser_options().urls;
+
+    auto file = TRY(Core::File::open(app.capture_url_list_path, Core::File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+
+    Vector<URL::URL> urls;
+
+    for (auto line : StringView { contents }.lines()) {
+        line = line.trim_whitespace();
+        if (line.is_empty() || line.starts_with('#'))
+            continue;
+
+        if (auto url = WebView::sanitize_url(line); url.has_value())
+            urls.append(url.release_value());
+        else
+            warnln("Skipping invalid URL '{}' in {}", line, app.capture_url_list_path);
+    }
+
+    return urls;
+}
+
+static void clear_capture_callbacks(HeadlessWebView& view)
+{
+    view.on_load_finish = {};
+    view.on_web_content_crashed = {};
+}
+
+static void set_ui_callbacks_for_captures(HeadlessWebView& view)
+{
+    // Nobody is around to answer dialogs, so dismiss them right away to unblock JS execution.
+    view.on_request_alert = [&](auto const&) {
+        view.alert_closed();
+    };
+    view.on_request_confirm = [&](auto const&) {
+        view.confirm_closed(false);
+    };
+    view.on_request_prompt = [&](auto const&, auto const&) {
+        view.prompt_closed({});
+    };
+}
+
+static ErrorOr<void> save_screenshot(Capture const& capture, Gfx::Bitmap const& screenshot)
+{
+    auto image_buffer = TRY(Gfx::PNGWriter::encode(screenshot));
+
+    auto output_file = TRY(Core::File::open(capture.output_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    TRY(output_file->write_until_depleted(image_buffer.bytes()));
+
+    return {};
+}
+
+static void finish_capture(HeadlessWebView& view, Capture& capture, CapturePromise& promise, CaptureResult result)
+{
+    if (promise.is_resolved())
+        return;
+
+    clear_capture_callbacks(view);
+    capture.timeout_timer->stop();
+    capture.end_time = MonotonicTime::now();
+    capture.result = result;
+
+    promise.resolve(move(result));
+}
+
+static void load_page_for_capture(HeadlessWebView& view, Capture& capture, NonnullRefPtr<CapturePromise> promise)
+{
+    view.on_load_finish = [&view, &capture, promise](auto const& loaded_url) {
+        // We don't want subframe loads to trigger the capture.
+        if (!capture.url.equals(loaded_url, URL::ExcludeFragment::Yes))
+            return;
+
+        capture.load_end_time = MonotonicTime::now();
+        view.on_load_finish = {};
+
+        // The page is only rendered once, now that it has finished loading.
+        view.take_screenshot()->when_resolved([&view, &capture, promise](RefPtr<Gfx::Bitmap const> screenshot) {
+            capture.screenshot_time = MonotonicTime::now();
+
+            if (!screenshot) {
+                finish_capture(view, capture, *promise, CaptureResult::Failed);
+                return;
+            }
+
+            if (auto result = save_screenshot(capture, *screenshot); result.is_error()) {
+                warnln("Unable to save screenshot of {} to {}: {}", capture.url, capture.output_path, result.error());
+                finish_capture(view, capture, *promise, CaptureResult::Failed);
+                return;
+            }
+
+            finish_capture(view, capture, *promise, CaptureResult::Captured);
+        });
+    };
+
+    capture.load_start_time = MonotonicTime::now();
+    view.load(capture.url);
+}
+
+static NonnullRefPtr<CapturePromise> run_capture(HeadlessWebView& view, Capture& capture, Application const& app)
+{
+    auto promise = CapturePromise::construct();
+    capture.start_time = MonotonicTime::now();
+
+    capture.timeout_timer = Core::Timer::create_single_shot(app.per_test_timeout_in_seconds * 1000, [&view, &capture, promise]() {
+        view.discard_pending_screenshot();
+        finish_capture(view, capture, *promise, CaptureResult::Timeout);
+    });
+
+    view.on_web_content_crashed = [&view, &capture, promise]() {
+        finish_capture(view, capture, *promise, CaptureResult::Crashed);
+    };
+
+    // The WebContent process is reused from the previous capture, so first reset its state by clearing the document.
+    // FIXME: Implement a debug-request to do this more thoroughly.
+    view.on_load_finish = [&view, &capture, promise](auto const& url) {
+        if (!url.equals(URL::about_blank()))
+            return;
+
+        view.on_load_finish = {};
+
+        Core::deferred_invoke([&view, &capture, promise]() {
+            if (!promise->is_resolved())
+                load_page_for_capture(view, capture, promise);
+        });
+    };
+
+    view.reset_zoom();
+    view.load(URL::about_blank());
+    capture.timeout_timer->start();
+
+    return promise;
+}
+
+static JsonObject capture_metrics(Capture const& capture)
+{
+    auto milliseconds_between = [](Optional<MonotonicTime> start, Optional<MonotonicTime> end) -> JsonValue {
+        if (!start.has_value() || !end.has_value())
+            return JsonValue {};
+        return (*end - *start).to_milliseconds();
+    };
+
+    JsonObject metrics;
+    metrics.set("index"sv, capture.index);
+    metrics.set("url"sv, capture.url.serialize());
+    metrics.set("result"sv, capture_result_to_string(capture.result));
+    if (capture.result == CaptureResult::Captured)
+        metrics.set("output"sv, capture.output_path.view());
+    metrics.set("reset_ms"sv, milliseconds_between(capture.start_time, capture.load_start_time));
+    metrics.set("load_ms"sv, milliseconds_between(capture.load_start_time, capture.load_end_time));
+    metrics.set("render_ms"sv, milliseconds_between(capture.load_end_time, capture.screenshot_time));
+    metrics.set("encode_ms"sv, milliseconds_between(capture.screenshot_time, capture.end_time));
+    metrics.set("total_ms"sv, (capture.end_time - capture.start_time).to_milliseconds());
+    return metrics;
+}
+
+ErrorOr<void> run_captures(Core::AnonymousBuffer const& theme, Web::DevicePixelSize window_size)
+{
+    auto& app = Application::the();
+
+    auto urls = TRY(collect_capture_urls(app));
+    if (urls.is_empty())
+        return Error::from_string_literal("No URLs to capture");
+
+    TRY(Core::Directory::create(app.capture_output_directory, Core::Directory::CreateDirectories::Yes));
+
+    Vector<Capture> captures;
+    captures.ensure_capacity(urls.size());
+
+    for (auto& url : urls) {
+        auto index = captures.size() + 1;
+        auto output_path = LexicalPath::join(app.capture_output_directory, ByteString::formatted("capture-{}.png", index)).string();
+        captures.append({ .index = index, .url = move(url), .output_path = move(output_path) });
+    }
+
+    // Per-page timings are written as one JSON object per line, in the order that the captures complete.
+    OwnPtr<Core::File> metrics_log;
+    if (!app.capture_metrics_log_path.is_empty())
+        metrics_log = TRY(Core::File::open(app.capture_metrics_log_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+
+    auto concurrency = min(app.test_concurrency, captures.size());
+    size_t loaded_web_views = 0;
+
+    for (size_t i = 0; i < concurrency; ++i) {
+        auto& view = app.create_web_view(theme, window_size);
+        view.on_load_finish = [&](auto const&) { ++loaded_web_views; };
+    }
+
+    // We need to wait for the initial about:blank load to complete before starting the captures, otherwise we may load
+    // the URL before the about:blank load completes. WebContent currently cannot handle this, and will drop the URL.
+    Core::EventLoop::current().spin_until([&]() {
+        return loaded_web_views == concurrency;
+    });
+
+    outln("Capturing {} pages into {}...", captures.size(), app.capture_output_directory);
+
+    auto all_captures_complete = Core::Promise<Empty>::construct();
+    auto captures_remaining = captures.size();
+    auto current_capture = 0uz;
+    size_t failure_count = 0;
+
+    auto batch_start_time = MonotonicTime::now();
+
+    Function<void(HeadlessWebView&)> run_next_capture;
+    run_next_capture = [&](HeadlessWebView& view) {
+        auto index = current_capture++;
+        if (index >= captures.size())
+            return;
+
+        auto& capture = captures[index];
+
+        run_capture(view, capture, app)->when_resolved([&, &view = view, &capture = capture](CaptureResult result) {
+            if (result != CaptureResult::Captured) {
+                ++failure_count;
+                warnln("{}/{}: {} {}", capture.index, captures.size(), capture_result_to_string(result), capture.url);
+            } else if (app.verbosity >= Application::VERBOSITY_LEVEL_LOG_TEST_DURATION) {
+                outln("{}/{}: Captured {}: {}ms", capture.index, captures.size(), capture.url, (capture.end_time - capture.start_time).to_milliseconds());
+            }
+
+            if (metrics_log) {
+                auto line = ByteString::formatted("{}\n", capture_metrics(capture).serialized());
+                if (auto write_result = metrics_log->write_until_depleted(line.bytes()); write_result.is_error())
+                    warnln("Unable to write to {}: {}", app.capture_metrics_log_path, write_result.error());
+            }
+
+            if (--captures_remaining == 0) {
+                all_captures_complete->resolve({});
+                return;
+            }
+
+            Core::deferred_invoke([&run_next_capture, &view]() {
+                run_next_capture(view);
+            });
+        });
+    };
+
+    app.for_each_web_view([&](auto& view) {
+        set_ui_callbacks_for_captures(view);
+        view.clear_content_filters();
+
+        Core::deferred_invoke([&]() {
+            run_next_capture(view);
+        });
+    });
+
+    MUST(all_captures_complete->await());
+
+    auto batch_duration = MonotonicTime::now() - batch_start_time;
+    outln("Captured {} of {} pages in {}ms", captures.size() - failure_count, captures.size(), batch_duration.to_milliseconds());
+
+    app.destroy_web_views();
+
+    if (failure_count != 0)
+        return Error::from_string_literal("Failed to capture some pages");
+    return {};
+}
+
+}
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2026, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <LibCore/Forward.h>
+#include <LibWeb/PixelUnits.h>
+
+namespace Ladybird {
+
+// Loads every URL given on the command line (or listed in --capture-url-list) and saves a screenshot of each, spread over
+// a pool of web views whose WebContent processes are reused from one page to the next.
+ErrorOr<void> run_captures(Core::AnonymousBuffer const& theme, Web::DevicePixelSize window_size);
+
+}
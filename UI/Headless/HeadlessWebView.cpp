@@ -188,9 +188,16 @@ NonnullRefPtr<Core::Promise<RefPtr<Gfx::Bitmap const>>> HeadlessWebView::take_sc
     return *m_pending_screenshot;
 }
 
+void HeadlessWebView::discard_pending_screenshot()
+{
+    m_pending_screenshot.clear();
+}
+
 void HeadlessWebView::did_receive_screenshot(Badge<WebView::WebContentClient>, Gfx::ShareableBitmap const& screenshot)
 {
-    VERIFY(m_pending_screenshot);
+    // The screenshot may arrive after whoever requested it has given up waiting for it.
+    if (!m_pending_screenshot)
+        return;
 
     auto pending_screenshot = move(m_pending_screenshot);
     pending_screenshot->resolve(screenshot.bitmap());
@@ -198,7 +205,7 @@ void HeadlessWebView::did_receive_screenshot(Badge<WebView::WebContentClient>, G
 
 void HeadlessWebView::on_test_complete(TestCompletion completion)
 {
-    m_pending_screenshot.clear();
+    discard_pending_screenshot();
     m_pending_dialog = Web::Page::PendingDialog::None;
     m_pending_prompt_text.clear();
 
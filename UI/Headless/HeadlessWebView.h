@@ -26,6 +26,7 @@ public:
     void clear_content_filters();
 
     NonnullRefPtr<Core::Promise<RefPtr<Gfx::Bitmap const>>> take_screenshot();
+    void discard_pending_screenshot();
 
     TestPromise& test_promise() { return *m_test_promise; }
     void on_test_complete(TestCompletion);
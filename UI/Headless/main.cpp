@@ -23,6 +23,7 @@
 #include <LibURL/URL.h>
 #include <LibWebView/Utilities.h>
 #include <UI/Headless/Application.h>
+#include <UI/Headless/Capture.h>
 #include <UI/Headless/HeadlessWebView.h>
 #include <UI/Headless/Test.h>
 
@@ -81,6 +82,11 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         return 0;
     }
 
+    if (!app->capture_output_directory.is_empty()) {
+        TRY(Ladybird::run_captures(theme, window_size));
+        return 0;
+    }
+
     auto& view = app->create_web_view(move(theme), window_size);
 
     VERIFY(!WebView::Application::browser_options().urls.is_empty());
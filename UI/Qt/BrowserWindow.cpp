@@ -401,6 +401,13 @@ BrowserWindow::BrowserWindow(Vector<URL::URL> const& initial_urls, IsPopupWindow
         debug_request("dump-stacking-context-tree");
     });
 
+    auto* dump_frame_timings_action = new QAction("Dump &Frame Timings", this);
+    dump_frame_timings_action->setIcon(load_icon_from_uri("resource://icons/16x16/app-system-monitor.png"sv));
+    debug_menu->addAction(dump_frame_timings_action);
+    QObject::connect(dump_frame_timings_action, &QAction::triggered, this, [this] {
+        debug_request("dump-frame-timings");
+    });
+
     auto* dump_style_sheets_action = new QAction("Dump &Style Sheets", this);
     dump_style_sheets_action->setIcon(load_icon_from_uri("resource://icons/16x16/filetype-css.png"sv));
     debug_menu->addAction(dump_style_sheets_action);
@@ -463,6 +470,17 @@ BrowserWindow::BrowserWindow(Vector<URL::URL> const& initial_urls, IsPopupWindow
         }
     });
 
+    auto* take_heap_snapshot_action = new QAction("Take heap snapshot", this);
+    debug_menu->addAction(take_heap_snapshot_action);
+    QObject::connect(take_heap_snapshot_action, &QAction::triggered, this, [this] {
+        if (m_current_tab) {
+            auto heap_snapshot_path = m_current_tab->view().take_heap_snapshot();
+            warnln("\033[33;1mTook heap snapshot into {}"
+                   "\033[0m",
+                heap_snapshot_path);
+        }
+    });
+
     auto* clear_cache_action = new QAction("Clear &Cache", this);
     clear_cache_action->setIcon(load_icon_from_uri("resource://icons/browser/clear-cache.png"sv));
     debug_menu->addAction(clear_cache_action);
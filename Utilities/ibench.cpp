@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/LexicalPath.h>
+#include <AK/QuickSort.h>
+#include <LibCore/ArgsParser.h>
+#include <LibCore/Directory.h>
+#include <LibCore/ElapsedTimer.h>
+#include <LibCore/MappedFile.h>
+#include <LibCore/MimeData.h>
+#include <LibFileSystem/FileSystem.h>
+#include <LibGfx/ImageFormats/ImageDecoder.h>
+#include <LibMain/Main.h>
+
+#if !defined(AK_OS_WINDOWS)
+#    include <sys/resource.h>
+#endif
+
+struct DecodeResult {
+    u32 frame_count { 0 };
+    Gfx::IntSize decoded_size;
+    u64 decoded_pixels { 0 };
+    AK::Duration time_to_first_frame;
+    AK::Duration total_time;
+};
+
+static ErrorOr<DecodeResult> decode_image(ReadonlyBytes data, Optional<ByteString> const& mime_type, Optional<int> scale_divisor)
+{
+    DecodeResult result;
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+
+    auto decoder = TRY(Gfx::ImageDecoder::try_create_for_raw_bytes(data, mime_type));
+    if (!decoder)
+        return Error::from_string_literal("Could not find decoder for input file");
+
+    Optional<Gfx::IntSize> ideal_size;
+    if (scale_divisor.has_value())
+        ideal_size = Gfx::IntSize { max(1, decoder->width() / *scale_divisor), max(1, decoder->height() / *scale_divisor) };
+
+    // CMYK and vector images don't have an ideal-size path, so they are always decoded at their full size.
+    switch (decoder->natural_frame_format()) {
+    case Gfx::NaturalFrameFormat::CMYK: {
+        auto bitmap = TRY(decoder->cmyk_frame());
+        result.time_to_first_frame = timer.elapsed_time();
+        result.frame_count = 1;
+        result.decoded_size = bitmap->size();
+        result.decoded_pixels = bitmap->size().area();
+        break;
+    }
+    case Gfx::NaturalFrameFormat::Vector: {
+        auto frame = TRY(decoder->vector_frame(0));
+        auto bitmap = TRY(frame.image->bitmap(ideal_size.value_or(frame.image->size())));
+        result.time_to_first_frame = timer.elapsed_time();
+        result.frame_count = 1;
+        result.decoded_size = bitmap->size();
+        result.decoded_pixels = bitmap->size().area();
+        break;
+    }
+    case Gfx::NaturalFrameFormat::RGB:
+    case Gfx::NaturalFrameFormat::Grayscale:
+        for (size_t i = 0; i < decoder->frame_count(); ++i) {
+            auto frame = TRY(decoder->frame(i, ideal_size));
+            if (i == 0) {
+                result.time_to_first_frame = timer.elapsed_time();
+                result.decoded_size = frame.image->size();
+            }
+            ++result.frame_count;
+            result.decoded_pixels += frame.image->size().area();
+        }
+        break;
+    }
+
+    result.total_time = timer.elapsed_time();
+    return result;
+}
+
+static ErrorOr<void> collect_image_paths(StringView path, Vector<ByteString>& paths)
+{
+    if (!FileSystem::is_directory(path)) {
+        paths.append(path);
+        return {};
+    }
+
+    TRY(Core::Directory::for_each_entry(path, Core::DirIterator::SkipParentAndBaseDir, [&](auto const& entry, auto const& directory) -> ErrorOr<IterationDecision> {
+        TRY(collect_image_paths(LexicalPath::join(directory.path().string(), entry.name).string(), paths));
+        return IterationDecision::Continue;
+    }));
+    return {};
+}
+
+static u64 peak_resident_memory_in_bytes()
+{
+#if defined(AK_OS_WINDOWS)
+    return 0;
+#else
+    struct rusage usage {};
+    if (getrusage(RUSAGE_SELF, &usage) < 0)
+        return 0;
+#    if defined(AK_OS_MACOS)
+    return usage.ru_maxrss;
+#    else
+    return static_cast<u64>(usage.ru_maxrss) * KiB;
+#    endif
+#endif
+}
+
+static double megapixels_per_second(u64 pixels, AK::Duration duration)
+{
+    auto seconds = static_cast<double>(duration.to_microseconds()) / 1'000'000.0;
+    if (seconds <= 0)
+        return 0;
+    return static_cast<double>(pixels) / 1'000'000.0 / seconds;
+}
+
+ErrorOr<int> serenity_main(Main::Arguments arguments)
+{
+    Vector<StringView> input_paths;
+    int iterations = 3;
+    int scale_divisor = 4;
+    bool json = false;
+
+    Core::ArgsParser args_parser;
+    args_parser.set_general_help("Benchmark image decoding. Every image is decoded at its full size, and at a fraction of it to exercise the ideal size path of the decoders.");
+    args_parser.add_positional_argument(input_paths, "Image files, or directories containing them", "paths");
+    args_parser.add_option(iterations, "How many times to decode each image, the fastest run is reported (default: 3)", "iterations", 'n', "count");
+    args_parser.add_option(scale_divisor, "Fraction of the full size that images are decoded at for the ideal size run, 1 to skip it (default: 4)", "scale-divisor", 's', "divisor");
+    args_parser.add_option(json, "Output results as JSON", "json", 'j');
+    args_parser.parse(arguments);
+
+    if (iterations < 1)
+        return Error::from_string_literal("--iterations must be at least 1");
+
+    Vector<ByteString> paths;
+    for (auto path : input_paths)
+        TRY(collect_image_paths(path, paths));
+    quick_sort(paths);
+
+    Vector<Optional<int>> scale_divisors { {} };
+    if (scale_divisor > 1)
+        scale_divisors.append(scale_divisor);
+
+    JsonArray results;
+    u64 total_pixels = 0;
+    AK::Duration total_time;
+
+    for (auto const& path : paths) {
+        auto file_or_error = Core::MappedFile::map(path);
+        if (file_or_error.is_error()) {
+            warnln("{}: {}", path, file_or_error.error());
+            continue;
+        }
+        auto file = file_or_error.release_value();
+        auto mime_type = Core::guess_mime_type_based_on_filename(path);
+
+        for (auto divisor : scale_divisors) {
+            Optional<DecodeResult> fastest;
+            Optional<Error> error;
+
+            for (int i = 0; i < iterations; ++i) {
+                auto result = decode_image(file->bytes(), ByteString { mime_type }, divisor);
+                if (result.is_error()) {
+                    error = result.release_error();
+                    break;
+                }
+                if (!fastest.has_value() || result.value().total_time < fastest->total_time)
+                    fastest = result.release_value();
+            }
+
+            auto mode = divisor.has_value() ? "ideal"sv : "full"sv;
+            if (error.has_value()) {
+                warnln("{} ({}): {}", path, mode, *error);
+                continue;
+            }
+
+            total_pixels += fastest->decoded_pixels;
+            total_time += fastest->total_time;
+
+            auto throughput = megapixels_per_second(fastest->decoded_pixels, fastest->total_time);
+            auto peak_memory = peak_resident_memory_in_bytes();
+
+            if (json) {
+                JsonObject object;
+                object.set("path"sv, path.view());
+                object.set("mime_type"sv, mime_type);
+                object.set("mode"sv, mode);
+                object.set("width"sv, fastest->decoded_size.width());
+                object.set("height"sv, fastest->decoded_size.height());
+                object.set("frame_count"sv, fastest->frame_count);
+                object.set("time_to_first_frame_microseconds"sv, fastest->time_to_first_frame.to_microseconds());
+                object.set("total_microseconds"sv, fastest->total_time.to_microseconds());
+                object.set("megapixels_per_second"sv, throughput);
+                object.set("peak_resident_bytes"sv, peak_memory);
+                results.must_append(move(object));
+            } else {
+                outln("{} ({}, {}x{}, {} frame(s)): first frame {}us, total {}us, {:.2} MP/s, peak RSS {} KiB",
+                    path, mode, fastest->decoded_size.width(), fastest->decoded_size.height(), fastest->frame_count,
+                    fastest->time_to_first_frame.to_microseconds(), fastest->total_time.to_microseconds(), throughput, peak_memory / KiB);
+            }
+        }
+    }
+
+    if (json) {
+        JsonObject summary;
+        summary.set("total_microseconds"sv, total_time.to_microseconds());
+        summary.set("megapixels_per_second"sv, megapixels_per_second(total_pixels, total_time));
+        summary.set("peak_resident_bytes"sv, peak_resident_memory_in_bytes());
+
+        JsonObject output;
+        output.set("results"sv, move(results));
+        output.set("summary"sv, move(summary));
+        outln("{}", output.serialized());
+    } else {
+        outln("Total: {}us, {:.2} MP/s, peak RSS {} KiB", total_time.to_microseconds(), megapixels_per_second(total_pixels, total_time), peak_resident_memory_in_bytes() / KiB);
+    }
+
+    return 0;
+}